@@ -1,8 +1,10 @@
 ﻿// Copyright Epic Games, Inc. All Rights Reserved.
 
 // File: AssetDumpBuild.cs
-// Version: v0.5.0
+// Version: v0.7.0
 // Changelog:
+// - v0.7.0: read-only query 경로와 공용 JSON 읽기/kind registry를 담은 AssetDumpQuery module을 public 의존성으로 추가.
+// - v0.6.0: commandlet watch 모드의 content 폴더 감시를 위해 DirectoryWatcher 의존성을 추가.
 // - v0.5.0: AIRE Phase 2 Niagara typed evidence를 위해 Niagara, NiagaraCore와 NiagaraEditor Editor dependency를 추가.
 // Migration:
 // - AssetDump는 Editor module이며 Niagara public 타입을 AssetDump public header에 노출하지 않는다.
@@ -39,6 +41,7 @@ public class AssetDump : ModuleRules
 				"CoreUObject",
 				"Engine",
 				"Json",
+				"AssetDumpQuery",
 				"AssetRegistry",
 				"GameplayTags",
 				"EnhancedInput",
@@ -52,6 +55,7 @@ public class AssetDump : ModuleRules
 				"ApplicationCore",
 				"AssetRegistry",
 				"ContentBrowser",
+				"DirectoryWatcher",
 				"InputCore",
 				"Json",
 				"JsonUtilities",
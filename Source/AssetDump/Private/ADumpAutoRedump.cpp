@@ -0,0 +1,431 @@
+// File: ADumpAutoRedump.cpp
+// Version: v1.0.1
+// Changelog:
+// - v1.0.1: 직접 시작한 queue를 TickDump로 진행하지 않고 FADumpExecCtrl core ticker에 맡겨 탭 timer와 중복 진행하지 않도록 변경.
+// - v1.0.0: package 저장/AssetRegistry 이름 변경·삭제 event debounce, 기존 dump가 있는 자산과 직접 역참조 자산의 skip-if-up-to-date queue 재덤프, stale dump 정리와 background index 재생성을 추가.
+
+#include "ADumpAutoRedump.h"
+
+#include "ADumpExecCtrl.h"
+#include "ADumpJson.h"
+#include "ADumpRunOpts.h"
+#include "AssetDumpCommandlet.h"
+
+#include "Async/Async.h"
+#include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+
+namespace
+{
+	// AutoRedumpIniSection은 에디터 탭 옵션과 같은 ini 섹션이다.
+	static const TCHAR* AutoRedumpIniSection = TEXT("AssetDump.BPDumpEditorTab");
+
+	// AutoRedumpIniKey는 자동 재덤프 opt-in 저장 키다.
+	static const TCHAR* AutoRedumpIniKey = TEXT("AutoRedumpOnSave");
+
+	// AutoRedumpDebounceSeconds는 마지막 저장 event 뒤 재덤프를 시작하기까지 기다리는 시간이다. 연속 저장을 한 batch로 묶는다.
+	constexpr double AutoRedumpDebounceSeconds = 2.0;
+
+	// AutoRedumpLogPrefix는 자동 재덤프 로그 접두사다.
+	static const TCHAR* AutoRedumpLogPrefix = TEXT("[ADumpAutoRedump]");
+}
+
+FADumpAutoRedump& FADumpAutoRedump::Get()
+{
+	static FADumpAutoRedump Instance;
+	return Instance;
+}
+
+void FADumpAutoRedump::Startup()
+{
+	bool bSavedEnabled = false;
+	if (GConfig != nullptr)
+	{
+		GConfig->GetBool(AutoRedumpIniSection, AutoRedumpIniKey, bSavedEnabled, GEditorPerProjectIni);
+	}
+
+	StatusText = TEXT("자동 재덤프 꺼짐");
+	if (bSavedEnabled && !IsRunningCommandlet())
+	{
+		bEnabled = true;
+		RegisterEvents();
+		SetStatusText(TEXT("자동 재덤프 켜짐: 저장을 기다리는 중"));
+	}
+}
+
+void FADumpAutoRedump::Shutdown()
+{
+	if (IndexRebuildFuture.IsValid())
+	{
+		IndexRebuildFuture.Wait();
+		IndexRebuildFuture = TFuture<bool>();
+	}
+	bEnabled = false;
+	bOwnsRunningQueue = false;
+	UnregisterEvents();
+}
+
+bool FADumpAutoRedump::IsEnabled() const
+{
+	return bEnabled;
+}
+
+void FADumpAutoRedump::SetEnabled(bool bInEnabled)
+{
+	if (GConfig != nullptr)
+	{
+		GConfig->SetBool(AutoRedumpIniSection, AutoRedumpIniKey, bInEnabled, GEditorPerProjectIni);
+		GConfig->Flush(false, GEditorPerProjectIni);
+	}
+
+	if (bEnabled == bInEnabled)
+	{
+		return;
+	}
+
+	bEnabled = bInEnabled;
+	if (bEnabled)
+	{
+		RegisterEvents();
+		SetStatusText(TEXT("자동 재덤프 켜짐: 저장을 기다리는 중"));
+		return;
+	}
+
+	// 이미 시작한 queue와 index 재생성은 끝까지 두고, 아직 시작하지 않은 event만 버린다.
+	UnregisterEvents();
+	PendingSavedPackageNames.Reset();
+	PendingForcedObjectPaths.Reset();
+	PendingStaleObjectPaths.Reset();
+	bIndexDirty = false;
+	SetStatusText(TEXT("자동 재덤프 꺼짐"));
+}
+
+const FString& FADumpAutoRedump::GetStatusText() const
+{
+	return StatusText;
+}
+
+void FADumpAutoRedump::RegisterEvents()
+{
+	// DumpRootPath는 켤 때 실제 기본 출력 루트로 정해 이름 변경/삭제 event의 기존 dump 검사 기준으로 쓴다.
+	DumpRootPath = FPaths::Combine(ADumpJson::ResolveWritableDefaultDumpRootDirectory(), TEXT("BPDump"));
+
+	if (!PackageSavedHandle.IsValid())
+	{
+		PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddRaw(this, &FADumpAutoRedump::HandlePackageSaved);
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	if (!AssetRenamedHandle.IsValid())
+	{
+		AssetRenamedHandle = AssetRegistry.OnAssetRenamed().AddRaw(this, &FADumpAutoRedump::HandleAssetRenamed);
+	}
+	if (!AssetRemovedHandle.IsValid())
+	{
+		AssetRemovedHandle = AssetRegistry.OnAssetRemoved().AddRaw(this, &FADumpAutoRedump::HandleAssetRemoved);
+	}
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FADumpAutoRedump::HandleTick), 0.0f);
+	}
+}
+
+void FADumpAutoRedump::UnregisterEvents()
+{
+	if (PackageSavedHandle.IsValid())
+	{
+		UPackage::PackageSavedWithContextEvent.Remove(PackageSavedHandle);
+		PackageSavedHandle.Reset();
+	}
+
+	// AssetRegistry module은 종료 순서상 먼저 내려갔을 수 있으므로 로드된 경우에만 해제한다.
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+	{
+		if (AssetRenamedHandle.IsValid())
+		{
+			AssetRegistryModule->Get().OnAssetRenamed().Remove(AssetRenamedHandle);
+		}
+		if (AssetRemovedHandle.IsValid())
+		{
+			AssetRegistryModule->Get().OnAssetRemoved().Remove(AssetRemovedHandle);
+		}
+	}
+	AssetRenamedHandle.Reset();
+	AssetRemovedHandle.Reset();
+
+	// 직접 시작한 queue나 index 재생성이 남아 있으면 ticker는 그것들이 끝난 뒤 스스로 해제된다.
+	if (TickerHandle.IsValid() && !bOwnsRunningQueue && !IndexRebuildFuture.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+}
+
+void FADumpAutoRedump::HandlePackageSaved(const FString& InPackageFileName, UPackage* InPackage, FObjectPostSaveContext InSaveContext)
+{
+	if (!bEnabled
+		|| InPackage == nullptr
+		|| InSaveContext.IsProceduralSave()
+		|| (InSaveContext.GetSaveFlags() & SAVE_FromAutosave) != 0
+		|| InPackage->HasAnyPackageFlags(PKG_PlayInEditor))
+	{
+		return;
+	}
+
+	PendingSavedPackageNames.Add(InPackage->GetFName());
+	LastEventSeconds = FPlatformTime::Seconds();
+}
+
+void FADumpAutoRedump::HandleAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath)
+{
+	if (!bEnabled || !HasExistingDump(InOldObjectPath))
+	{
+		return;
+	}
+
+	PendingStaleObjectPaths.Add(InOldObjectPath);
+	PendingForcedObjectPaths.Add(InAssetData.GetObjectPathString());
+	LastEventSeconds = FPlatformTime::Seconds();
+}
+
+void FADumpAutoRedump::HandleAssetRemoved(const FAssetData& InAssetData)
+{
+	const FString ObjectPathText = InAssetData.GetObjectPathString();
+	if (!bEnabled || !HasExistingDump(ObjectPathText))
+	{
+		return;
+	}
+
+	PendingStaleObjectPaths.Add(ObjectPathText);
+	PendingForcedObjectPaths.Remove(ObjectPathText);
+	LastEventSeconds = FPlatformTime::Seconds();
+}
+
+bool FADumpAutoRedump::HandleTick(float InDeltaSeconds)
+{
+	FADumpExecCtrl& ExecCtrl = FADumpExecCtrl::Get();
+
+	// queue 단계는 ExecCtrl core ticker가 진행한다. 여기서는 직접 시작한 queue의 종료만 확인한다.
+	if (bOwnsRunningQueue)
+	{
+		if (!ExecCtrl.IsRunning())
+		{
+			bOwnsRunningQueue = false;
+			const FADumpExecSnapshot& Snapshot = ExecCtrl.GetSnapshot();
+			const int32 RedumpedCount = Snapshot.QueueCompletedCount - Snapshot.QueueSkippedCount - Snapshot.QueueFailedCount;
+			bIndexDirty |= RedumpedCount > 0;
+			SetStatusText(FString::Printf(
+				TEXT("자동 재덤프 완료: 재덤프 %d, 최신이라 건너뜀 %d, 실패 %d, 취소 %d"),
+				RedumpedCount,
+				Snapshot.QueueSkippedCount,
+				Snapshot.QueueFailedCount,
+				Snapshot.QueueCanceledCount));
+		}
+	}
+
+	if (IndexRebuildFuture.IsValid() && IndexRebuildFuture.IsReady())
+	{
+		const bool bIndexRebuilt = IndexRebuildFuture.Get();
+		IndexRebuildFuture = TFuture<bool>();
+		SetStatusText(bIndexRebuilt
+			? FString::Printf(TEXT("index 재생성 완료 (%.2f초): %s"), FPlatformTime::Seconds() - IndexRebuildStartSeconds, *DumpRootPath)
+			: FString::Printf(TEXT("index 재생성 실패: %s"), *DumpRootPath));
+	}
+
+	const bool bHasPendingEvents = PendingSavedPackageNames.Num() > 0 || PendingForcedObjectPaths.Num() > 0 || PendingStaleObjectPaths.Num() > 0;
+	const bool bBusy = ExecCtrl.IsRunning() || IndexRebuildFuture.IsValid();
+	if (bEnabled && bHasPendingEvents && !bBusy && FPlatformTime::Seconds() - LastEventSeconds >= AutoRedumpDebounceSeconds)
+	{
+		StartPendingRedump();
+	}
+	else if (bIndexDirty && !bHasPendingEvents && !bBusy)
+	{
+		StartIndexRebuild();
+	}
+
+	// 꺼진 뒤 남은 작업이 모두 끝나면 ticker를 해제한다.
+	if (!bEnabled && !bOwnsRunningQueue && !IndexRebuildFuture.IsValid())
+	{
+		TickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+void FADumpAutoRedump::StartPendingRedump()
+{
+	DumpRootPath = FPaths::Combine(ADumpJson::ResolveWritableDefaultDumpRootDirectory(), TEXT("BPDump"));
+
+	const TSet<FName> SavedPackageNames = MoveTemp(PendingSavedPackageNames);
+	const TSet<FString> ForcedObjectPaths = MoveTemp(PendingForcedObjectPaths);
+	const TSet<FString> StaleObjectPaths = MoveTemp(PendingStaleObjectPaths);
+	PendingSavedPackageNames.Reset();
+	PendingForcedObjectPaths.Reset();
+	PendingStaleObjectPaths.Reset();
+
+	int32 RemovedDumpCount = 0;
+	for (const FString& StaleObjectPath : StaleObjectPaths)
+	{
+		RemovedDumpCount += RemoveStaleDump(StaleObjectPath) ? 1 : 0;
+	}
+	bIndexDirty |= RemovedDumpCount > 0;
+
+	TArray<FString> TargetObjectPaths;
+	CollectRedumpTargets(SavedPackageNames, ForcedObjectPaths, TargetObjectPaths);
+	if (TargetObjectPaths.Num() == 0)
+	{
+		SetStatusText(FString::Printf(TEXT("자동 재덤프: 기존 dump가 있는 영향 자산 없음 (stale dump 삭제 %d)"), RemovedDumpCount));
+		return;
+	}
+
+	// 역참조 자산은 fingerprint에 dependency package 상태가 들어가므로 skip-if-up-to-date가 실제로 바뀐 자산만 다시 추출한다.
+	TArray<FADumpRunOpts> RunOptsList;
+	RunOptsList.Reserve(TargetObjectPaths.Num());
+	for (const FString& TargetObjectPath : TargetObjectPaths)
+	{
+		FADumpRunOpts& RunOpts = RunOptsList.AddDefaulted_GetRef();
+		RunOpts.AssetObjectPath = TargetObjectPath;
+		RunOpts.SourceKind = EADumpSourceKind::EditorSelection;
+		RunOpts.bSkipIfUpToDate = true;
+	}
+
+	FString StartMessage;
+	if (!FADumpExecCtrl::Get().StartDumpAssets(RunOptsList, StartMessage))
+	{
+		SetStatusText(FString::Printf(TEXT("자동 재덤프 시작 실패: %s"), *StartMessage));
+		return;
+	}
+
+	bOwnsRunningQueue = true;
+	SetStatusText(FString::Printf(
+		TEXT("자동 재덤프 중: 저장 package %d, 대상 자산 %d (stale dump 삭제 %d)"),
+		SavedPackageNames.Num(),
+		TargetObjectPaths.Num(),
+		RemovedDumpCount));
+}
+
+void FADumpAutoRedump::CollectRedumpTargets(
+	const TSet<FName>& InSavedPackageNames,
+	const TSet<FString>& InForcedObjectPaths,
+	TArray<FString>& OutObjectPaths) const
+{
+	OutObjectPaths.Reset();
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+	// CandidatePackageNames는 저장 package와 그 직접 역참조 package다. fingerprint가 직접 dependency 상태만 담으므로 한 단계면 충분하다.
+	TSet<FName> CandidatePackageNames = InSavedPackageNames;
+	for (const FName& SavedPackageName : InSavedPackageNames)
+	{
+		TArray<FName> ReferencerPackageNames;
+		AssetRegistry.GetReferencers(SavedPackageName, ReferencerPackageNames);
+		CandidatePackageNames.Append(ReferencerPackageNames);
+	}
+
+	TSet<FString> AddedObjectPaths;
+	for (const FString& ForcedObjectPath : InForcedObjectPaths)
+	{
+		if (!AddedObjectPaths.Contains(ForcedObjectPath))
+		{
+			AddedObjectPaths.Add(ForcedObjectPath);
+			OutObjectPaths.Add(ForcedObjectPath);
+		}
+	}
+
+	for (const FName& CandidatePackageName : CandidatePackageNames)
+	{
+		if (CandidatePackageName.ToString().StartsWith(TEXT("/Script/")))
+		{
+			continue;
+		}
+
+		TArray<FAssetData> PackageAssets;
+		AssetRegistry.GetAssetsByPackageName(CandidatePackageName, PackageAssets);
+		for (const FAssetData& PackageAsset : PackageAssets)
+		{
+			const FString ObjectPathText = PackageAsset.GetObjectPathString();
+			if (!AddedObjectPaths.Contains(ObjectPathText) && HasExistingDump(ObjectPathText))
+			{
+				AddedObjectPaths.Add(ObjectPathText);
+				OutObjectPaths.Add(ObjectPathText);
+			}
+		}
+	}
+
+	OutObjectPaths.Sort();
+}
+
+FString FADumpAutoRedump::BuildManifestFilePath(const FString& InObjectPath) const
+{
+	// AssetFolderName은 기본 출력 규칙의 자산별 폴더 이름이다. 후보 경로 계산은 파일시스템을 바꾸지 않는다.
+	const FString AssetFolderName = FPaths::GetCleanFilename(FPaths::GetPath(ADumpJson::BuildDefaultOutputFilePathCandidate(InObjectPath)));
+	const FString RootPath = DumpRootPath.IsEmpty()
+		? FPaths::Combine(ADumpJson::BuildDefaultDumpRootDirectory(), TEXT("BPDump"))
+		: DumpRootPath;
+	return FPaths::Combine(RootPath, AssetFolderName, TEXT("manifest.json"));
+}
+
+bool FADumpAutoRedump::HasExistingDump(const FString& InObjectPath) const
+{
+	if (InObjectPath.IsEmpty())
+	{
+		return false;
+	}
+
+	const FString ManifestFilePath = BuildManifestFilePath(InObjectPath);
+	return ADumpJson::DoesJsonFileExist(ManifestFilePath)
+		&& ADumpJson::LoadManifestObjectPath(ManifestFilePath) == InObjectPath;
+}
+
+bool FADumpAutoRedump::RemoveStaleDump(const FString& InObjectPath)
+{
+	// 자산 폴더 이름이 같은 다른 자산의 dump를 지우지 않도록 manifest object_path를 다시 확인한다.
+	if (!HasExistingDump(InObjectPath))
+	{
+		return false;
+	}
+
+	// pack 안에만 있는 dump는 지울 수 없으므로 실제 폴더가 있을 때만 삭제한다.
+	const FString DumpDirectoryPath = FPaths::GetPath(BuildManifestFilePath(InObjectPath));
+	if (!IFileManager::Get().DirectoryExists(*DumpDirectoryPath))
+	{
+		return false;
+	}
+
+	const bool bDeleted = IFileManager::Get().DeleteDirectory(*DumpDirectoryPath, false, true);
+	UE_LOG(LogTemp, Log, TEXT("%s stale dump %s: %s"), AutoRedumpLogPrefix, bDeleted ? TEXT("deleted") : TEXT("delete failed"), *DumpDirectoryPath);
+	return bDeleted;
+}
+
+void FADumpAutoRedump::StartIndexRebuild()
+{
+	bIndexDirty = false;
+	if (DumpRootPath.IsEmpty())
+	{
+		return;
+	}
+
+	// index build는 파일 I/O와 JSON 처리만 하므로 thread pool에서 돌린다. 같은 process 직전 build의 manifest entry를 재사용한다.
+	const FString RebuildRootPath = DumpRootPath;
+	IndexRebuildStartSeconds = FPlatformTime::Seconds();
+	IndexRebuildFuture = Async(EAsyncExecution::ThreadPool, [RebuildRootPath]()
+	{
+		FString AssetIndexFilePath;
+		return UAssetDumpCommandlet::RebuildDumpIndexFiles(RebuildRootPath, AssetIndexFilePath);
+	});
+	SetStatusText(FString::Printf(TEXT("index 재생성 중: %s"), *DumpRootPath));
+}
+
+void FADumpAutoRedump::SetStatusText(const FString& InStatusText)
+{
+	StatusText = InStatusText;
+	UE_LOG(LogTemp, Log, TEXT("%s %s"), AutoRedumpLogPrefix, *StatusText);
+}
@@ -1,12 +1,22 @@
 // File: ADumpDataDiff.cpp
-// Version: v1.0.0
+// Version: v1.3.4
 // Changelog:
+// - v1.3.4: baseline도 current dump와 같은 ADumpJson 존재/stat/읽기 경로로 찾아 pack/gzip/content store에 저장된 baseline root를 비교하고, SHA-256은 저장 형태와 무관하게 해제된 JSON byte 기준으로 계산.
+// - v1.3.3: structural hash/deep 비교의 문자열과 value_text 비교를 v1.1.0 canonical 문자열 비교와 같은 대소문자 무시로 되돌리고, hot loop의 object key 복사를 제거.
+// - v1.3.2: batch diff가 비교하지 않았거나 실패한 current asset의 이전 data_asset_diff.json을 지워 다른 root 쌍의 결과가 남지 않게 하고, section에 baseline_root를 기록.
+// - v1.3.1: batch diff current dump 크기 검사를 dump pack 항목까지 포함하는 ADumpJson::GetJsonFileStat으로 변경.
+// - v1.3.0: gzip으로 저장된 baseline/current dump를 magic byte로 감지해 해제 후 비교하고, 해제 크기에도 16 MiB 제한을 적용. baseline SHA-256은 파일 원본 byte 기준을 유지.
+// - v1.2.0: 값 비교를 structural 64-bit hash + hash 일치 시 deep 비교로 바꾸고, 정렬 field 배열 단일 merge와 변경 항목만 canonical 복제로 전환.
+// - v1.1.0: asset_index_v1 기반 dump root 간 batch diff, fingerprint skip, 병렬 비교와 per-asset data_asset_diff section 저장을 추가.
 // - v1.0.0: data_asset_values_v1 JSON baseline 로드, 정규화 비교, 변경 분류, partial 품질 판정을 구현.
 
 #include "ADumpDataDiff.h"
 
 #include "ADumpDataAsset.h"
+#include "ADumpJson.h"
 
+#include "Algo/StableSort.h"
+#include "Async/ParallelFor.h"
 #include "HAL/FileManager.h"
 #include "Interfaces/IPluginManager.h"
 #include "Misc/FileHelper.h"
@@ -226,7 +236,7 @@ namespace
 		for (FString& CandidatePath : CandidatePathArray)
 		{
 			FPaths::NormalizeFilename(CandidatePath);
-			if (IFileManager::Get().FileExists(*CandidatePath))
+			if (ADumpJson::DoesJsonFileExist(CandidatePath))
 			{
 				return CandidatePath;
 			}
@@ -237,7 +247,7 @@ namespace
 		return FallbackPath;
 	}
 
-	// LoadBaselineText는 baseline JSON을 크기 제한 안에서 바이트와 문자열로 읽는다.
+	// LoadBaselineText는 baseline JSON을 current dump와 같은 ADumpJson 읽기 경로(gzip/pack/content store)로 크기 제한 안에서 읽는다. OutBytes는 해제된 UTF-8 JSON byte다.
 	bool LoadBaselineText(
 		const FString& InBaselinePath,
 		TArray<uint8>& OutBytes,
@@ -247,15 +257,16 @@ namespace
 	{
 		OutBytes.Reset();
 		OutText.Reset();
-		if (!IFileManager::Get().FileExists(*InBaselinePath))
+		if (!ADumpJson::DoesJsonFileExist(InBaselinePath))
 		{
 			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_BASE_NOT_FOUND"), FString::Printf(TEXT("DataAsset Diff baseline file was not found: %s"), *InBaselinePath), InTargetPath);
 			return false;
 		}
 
-		// FileSizeBytes는 JSON 파싱 전에 검사하는 baseline 파일 크기다.
-		const int64 FileSizeBytes = IFileManager::Get().FileSize(*InBaselinePath);
-		if (FileSizeBytes < 0)
+		// FileSizeBytes는 JSON 파싱 전에 검사하는 baseline 크기다. pack 항목이면 저장된 payload 크기, content store 항목이면 복원 크기다.
+		int64 FileSizeBytes = -1;
+		FString FileStampText;
+		if (!ADumpJson::GetJsonFileStat(InBaselinePath, FileSizeBytes, FileStampText) || FileSizeBytes < 0)
 		{
 			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_BASE_READ_FAILED"), FString::Printf(TEXT("DataAsset Diff baseline size could not be read: %s"), *InBaselinePath), InTargetPath);
 			return false;
@@ -270,9 +281,14 @@ namespace
 			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_BASE_SCHEMA_INVALID"), FString::Printf(TEXT("DataAsset Diff baseline must be a JSON file: %s"), *InBaselinePath), InTargetPath);
 			return false;
 		}
-		if (!FFileHelper::LoadFileToArray(OutBytes, *InBaselinePath))
+		if (!ADumpJson::LoadJsonBytesFromFile(InBaselinePath, OutBytes))
 		{
-			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_BASE_READ_FAILED"), FString::Printf(TEXT("DataAsset Diff baseline could not be read: %s"), *InBaselinePath), InTargetPath);
+			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_BASE_READ_FAILED"), FString::Printf(TEXT("DataAsset Diff baseline could not be read or decompressed: %s"), *InBaselinePath), InTargetPath);
+			return false;
+		}
+		if (OutBytes.Num() > DataAssetDiffMaxBaselineBytes)
+		{
+			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_BASE_TOO_LARGE"), FString::Printf(TEXT("DataAsset Diff baseline exceeds 16 MiB after decompression: %s"), *InBaselinePath), InTargetPath);
 			return false;
 		}
 		FFileHelper::BufferToString(OutText, OutBytes.GetData(), OutBytes.Num());
@@ -341,19 +357,145 @@ namespace
 		return InValue;
 	}
 
-	// CanonicalJsonText는 JSON value를 결정적 condensed 문자열로 변환한다.
-	FString CanonicalJsonText(const TSharedPtr<FJsonValue>& InValue)
+	// HashCombine64는 structural hash 누적값에 다음 64-bit 값을 섞는다.
+	uint64 HashCombine64(uint64 InSeed, uint64 InValue)
+	{
+		return InSeed ^ (InValue + 0x9e3779b97f4a7c15ull + (InSeed << 6) + (InSeed >> 2));
+	}
+
+	// HashText64는 문자열 code unit을 소문자로 접어 FNV-1a 64-bit로 해시한다. 값 비교가 대소문자를 무시하므로 hash도 같게 맞춘다.
+	uint64 HashText64(const FString& InText)
+	{
+		uint64 HashValue = 14695981039346656037ull;
+		for (int32 CharIndex = 0; CharIndex < InText.Len(); ++CharIndex)
+		{
+			HashValue ^= static_cast<uint64>(static_cast<uint32>(FChar::ToLower(InText[CharIndex])));
+			HashValue *= 1099511628211ull;
+		}
+		return HashValue;
+	}
+
+	// ComputeStructuralHash는 object key 순서와 무관한 JSON value 구조 해시를 한 번의 순회로 계산한다.
+	uint64 ComputeStructuralHash(const TSharedPtr<FJsonValue>& InValue)
 	{
-		// WrapperObject는 단일 value를 serializer에 전달하기 위한 object다.
-		TSharedRef<FJsonObject> WrapperObject = MakeShared<FJsonObject>();
-		WrapperObject->SetField(TEXT("value"), CloneCanonicalValue(InValue));
+		// ValueType은 invalid value를 canonical clone과 같게 null로 취급한 JSON type이다.
+		const EJson ValueType = InValue.IsValid() ? InValue->Type : EJson::Null;
 
-		// JsonText는 condensed canonical JSON 문자열이다.
-		FString JsonText;
-		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter =
-			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonText);
-		FJsonSerializer::Serialize(WrapperObject, JsonWriter);
-		return JsonText;
+		// HashValue는 type tag에서 시작하는 누적 hash다.
+		uint64 HashValue = HashCombine64(0, static_cast<uint64>(ValueType));
+		switch (ValueType)
+		{
+		case EJson::String:
+			return HashCombine64(HashValue, HashText64(InValue->AsString()));
+		case EJson::Number:
+		{
+			// NumberValue는 bit pattern으로 해시할 double 값이며 -0은 0과 같게 맞춘다.
+			double NumberValue = InValue->AsNumber();
+			if (NumberValue == 0.0)
+			{
+				NumberValue = 0.0;
+			}
+			uint64 NumberBits = 0;
+			FMemory::Memcpy(&NumberBits, &NumberValue, sizeof(NumberBits));
+			return HashCombine64(HashValue, NumberBits);
+		}
+		case EJson::Boolean:
+			return HashCombine64(HashValue, InValue->AsBool() ? 1ull : 0ull);
+		case EJson::Array:
+		{
+			// ArrayValues는 순서를 유지해 해시할 배열 요소다.
+			const TArray<TSharedPtr<FJsonValue>>& ArrayValues = InValue->AsArray();
+			for (const TSharedPtr<FJsonValue>& ArrayValue : ArrayValues)
+			{
+				HashValue = HashCombine64(HashValue, ComputeStructuralHash(ArrayValue));
+			}
+			return HashCombine64(HashValue, static_cast<uint64>(ArrayValues.Num()));
+		}
+		case EJson::Object:
+		{
+			// SourceObject는 field hash를 교환 가능한 합으로 모아 key 정렬을 생략할 object다.
+			const TSharedPtr<FJsonObject> SourceObject = InValue->AsObject();
+			uint64 FieldHashSum = 0;
+			int32 FieldCount = 0;
+			if (SourceObject.IsValid())
+			{
+				for (const auto& SourcePair : SourceObject->Values)
+				{
+					const FString& FieldKey = SourcePair.Key;
+					FieldHashSum += HashCombine64(HashText64(FieldKey), ComputeStructuralHash(SourcePair.Value));
+					++FieldCount;
+				}
+			}
+			return HashCombine64(HashCombine64(HashValue, FieldHashSum), static_cast<uint64>(FieldCount));
+		}
+		default:
+			return HashValue;
+		}
+	}
+
+	// AreJsonValuesEqual은 hash가 같은 두 JSON value를 구조적으로 끝까지 비교해 충돌을 배제한다. 문자열은 대소문자를 무시한다.
+	bool AreJsonValuesEqual(const TSharedPtr<FJsonValue>& InLeft, const TSharedPtr<FJsonValue>& InRight)
+	{
+		const EJson LeftType = InLeft.IsValid() ? InLeft->Type : EJson::Null;
+		const EJson RightType = InRight.IsValid() ? InRight->Type : EJson::Null;
+		if (LeftType != RightType)
+		{
+			return false;
+		}
+
+		switch (LeftType)
+		{
+		case EJson::String:
+			return InLeft->AsString().Equals(InRight->AsString(), ESearchCase::IgnoreCase);
+		case EJson::Number:
+			return InLeft->AsNumber() == InRight->AsNumber();
+		case EJson::Boolean:
+			return InLeft->AsBool() == InRight->AsBool();
+		case EJson::Array:
+		{
+			const TArray<TSharedPtr<FJsonValue>>& LeftArray = InLeft->AsArray();
+			const TArray<TSharedPtr<FJsonValue>>& RightArray = InRight->AsArray();
+			if (LeftArray.Num() != RightArray.Num())
+			{
+				return false;
+			}
+			for (int32 ElementIndex = 0; ElementIndex < LeftArray.Num(); ++ElementIndex)
+			{
+				if (!AreJsonValuesEqual(LeftArray[ElementIndex], RightArray[ElementIndex]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		case EJson::Object:
+		{
+			const TSharedPtr<FJsonObject> LeftObject = InLeft->AsObject();
+			const TSharedPtr<FJsonObject> RightObject = InRight->AsObject();
+			const int32 LeftCount = LeftObject.IsValid() ? LeftObject->Values.Num() : 0;
+			const int32 RightCount = RightObject.IsValid() ? RightObject->Values.Num() : 0;
+			if (LeftCount != RightCount)
+			{
+				return false;
+			}
+			if (LeftCount == 0)
+			{
+				return true;
+			}
+			for (const auto& LeftPair : LeftObject->Values)
+			{
+				const FString& FieldKey = LeftPair.Key;
+				const TSharedPtr<FJsonValue> RightValue = RightObject->TryGetField(FieldKey);
+				if (!RightValue.IsValid() || !AreJsonValuesEqual(LeftPair.Value, RightValue))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		default:
+			return true;
+		}
 	}
 
 	// ChangeKindToString은 변경 분류를 JSON 문자열로 변환한다.
@@ -382,7 +524,8 @@ namespace
 		DiffValue.Category = InField.Category;
 		DiffValue.CppType = InField.CppType;
 		DiffValue.ValueKind = ToString(InField.ValueKind);
-		DiffValue.ValueJson = CloneCanonicalValue(InField.ValueJson);
+		DiffValue.ValueJson = InField.ValueJson;
+		DiffValue.ValueHash = ComputeStructuralHash(InField.ValueJson);
 		DiffValue.ValueText = InField.ValueText;
 		DiffValue.bIsAssetReference = InField.bIsAssetReference;
 		DiffValue.bTruncated = InField.bTruncated;
@@ -406,47 +549,96 @@ namespace
 		InFieldObject->TryGetStringField(TEXT("value_text"), OutValue.ValueText);
 		InFieldObject->TryGetBoolField(TEXT("is_asset_reference"), OutValue.bIsAssetReference);
 		InFieldObject->TryGetBoolField(TEXT("truncated"), OutValue.bTruncated);
-		OutValue.ValueJson = CloneCanonicalValue(InFieldObject->TryGetField(TEXT("value_json")));
+		OutValue.ValueJson = InFieldObject->TryGetField(TEXT("value_json"));
+		OutValue.ValueHash = ComputeStructuralHash(OutValue.ValueJson);
 		OutValue.bIsSet = bHasCoreText;
 		return bHasCoreText;
 	}
 
-	// TryBuildBaselineFieldMap은 baseline fields 배열을 property_name map으로 변환한다.
-	bool TryBuildBaselineFieldMap(
+	// FDiffFieldEntry는 property_name 정렬 merge에 쓰는 필드 한 건이다.
+	struct FDiffFieldEntry
+	{
+		// PropertyName은 merge key가 되는 property_name이다.
+		FString PropertyName;
+
+		// Value는 비교용 메타/값과 미리 계산한 structural hash다.
+		FADumpDataAssetDiffValue Value;
+	};
+
+	// SortAndDedupeFieldEntries는 property_name을 대소문자 무시 순서로 정렬하고 같은 key는 마지막 항목만 남긴다.
+	void SortAndDedupeFieldEntries(TArray<FDiffFieldEntry>& InOutFieldEntries)
+	{
+		Algo::StableSort(InOutFieldEntries, [](const FDiffFieldEntry& InLeft, const FDiffFieldEntry& InRight)
+		{
+			return InLeft.PropertyName.Compare(InRight.PropertyName, ESearchCase::IgnoreCase) < 0;
+		});
+
+		// WriteIndex는 같은 key run의 마지막 항목을 앞으로 당겨 쓰는 위치다.
+		int32 WriteIndex = 0;
+		for (int32 ReadIndex = 0; ReadIndex < InOutFieldEntries.Num(); ++ReadIndex)
+		{
+			const bool bLastOfRun = ReadIndex + 1 == InOutFieldEntries.Num()
+				|| !InOutFieldEntries[ReadIndex].PropertyName.Equals(InOutFieldEntries[ReadIndex + 1].PropertyName, ESearchCase::IgnoreCase);
+			if (bLastOfRun)
+			{
+				if (WriteIndex != ReadIndex)
+				{
+					InOutFieldEntries[WriteIndex] = MoveTemp(InOutFieldEntries[ReadIndex]);
+				}
+				++WriteIndex;
+			}
+		}
+		InOutFieldEntries.SetNum(WriteIndex);
+	}
+
+	// TryBuildBaselineFieldEntries는 baseline fields 배열을 property_name 정렬 배열로 변환한다.
+	bool TryBuildBaselineFieldEntries(
 		const TArray<TSharedPtr<FJsonValue>>& InFieldArray,
-		TMap<FString, FADumpDataAssetDiffValue>& OutFieldMap,
+		TArray<FDiffFieldEntry>& OutFieldEntries,
 		TArray<FADumpIssue>& OutIssues,
 		const FString& InTargetPath)
 	{
-		OutFieldMap.Reset();
+		OutFieldEntries.Reset(InFieldArray.Num());
 		for (const TSharedPtr<FJsonValue>& FieldValue : InFieldArray)
 		{
 			const TSharedPtr<FJsonObject> FieldObject = FieldValue.IsValid() ? FieldValue->AsObject() : nullptr;
-			FString PropertyName;
-			FADumpDataAssetDiffValue DiffValue;
+			FDiffFieldEntry FieldEntry;
 			if (!FieldObject.IsValid()
-				|| !FieldObject->TryGetStringField(TEXT("property_name"), PropertyName)
-				|| PropertyName.IsEmpty()
-				|| !TryReadDiffValue(FieldObject, DiffValue))
+				|| !FieldObject->TryGetStringField(TEXT("property_name"), FieldEntry.PropertyName)
+				|| FieldEntry.PropertyName.IsEmpty()
+				|| !TryReadDiffValue(FieldObject, FieldEntry.Value))
 			{
 				AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_BASE_SCHEMA_INVALID"), TEXT("DataAsset Diff baseline has an invalid field entry."), InTargetPath);
 				return false;
 			}
-			OutFieldMap.Add(PropertyName, MoveTemp(DiffValue));
+			OutFieldEntries.Add(MoveTemp(FieldEntry));
 		}
+		SortAndDedupeFieldEntries(OutFieldEntries);
 		return true;
 	}
 
-	// BuildCurrentFieldMap은 current data_asset_values fields를 property_name map으로 변환한다.
-	TMap<FString, FADumpDataAssetDiffValue> BuildCurrentFieldMap(const FADumpDataAssetValues& InCurrentValues)
+	// BuildCurrentFieldEntries는 current data_asset_values fields를 property_name 정렬 배열로 변환한다.
+	TArray<FDiffFieldEntry> BuildCurrentFieldEntries(const FADumpDataAssetValues& InCurrentValues)
 	{
-		// FieldMap은 current side 필드를 property_name으로 찾기 위한 map이다.
-		TMap<FString, FADumpDataAssetDiffValue> FieldMap;
+		// FieldEntries는 current side 필드를 merge 순서로 담는 배열이다.
+		TArray<FDiffFieldEntry> FieldEntries;
+		FieldEntries.Reserve(InCurrentValues.Fields.Num());
 		for (const FADumpDataAssetField& FieldItem : InCurrentValues.Fields)
 		{
-			FieldMap.Add(FieldItem.PropertyName, MakeValueFromCurrentField(FieldItem));
+			FDiffFieldEntry& FieldEntry = FieldEntries.AddDefaulted_GetRef();
+			FieldEntry.PropertyName = FieldItem.PropertyName;
+			FieldEntry.Value = MakeValueFromCurrentField(FieldItem);
 		}
-		return FieldMap;
+		SortAndDedupeFieldEntries(FieldEntries);
+		return FieldEntries;
+	}
+
+	// MakeCanonicalChangeValue는 변경 항목에 넣을 값만 object key 정렬 canonical 사본으로 만든다.
+	FADumpDataAssetDiffValue MakeCanonicalChangeValue(const FADumpDataAssetDiffValue& InValue)
+	{
+		FADumpDataAssetDiffValue ChangeValue = InValue;
+		ChangeValue.ValueJson = CloneCanonicalValue(InValue.ValueJson);
+		return ChangeValue;
 	}
 
 	// AddPreviewLine은 diff preview 배열에 제한된 한 줄을 추가한다.
@@ -463,6 +655,367 @@ namespace
 			ChangeKindToString(InChange.ChangeKind),
 			*InChange.ComparisonQuality));
 	}
+
+	// CompareFieldEntries는 정렬된 baseline/current field 배열을 한 번 merge해 diff 카운트와 변경 항목을 채운다.
+	// 값은 미리 계산한 structural hash로 먼저 가르고, hash가 같을 때만 deep 비교로 충돌을 배제한다.
+	void CompareFieldEntries(
+		const TArray<FDiffFieldEntry>& InBaselineEntries,
+		const TArray<FDiffFieldEntry>& InCurrentEntries,
+		FADumpDataAssetDiff& InOutDataAssetDiff)
+	{
+		// BaselineIndex와 CurrentIndex는 두 정렬 배열의 merge cursor다.
+		int32 BaselineIndex = 0;
+		int32 CurrentIndex = 0;
+		while (BaselineIndex < InBaselineEntries.Num() || CurrentIndex < InCurrentEntries.Num())
+		{
+			// OrderValue는 cursor 두 항목의 property_name 순서이며 한쪽이 끝나면 남은 쪽만 진행한다.
+			const int32 OrderValue = BaselineIndex >= InBaselineEntries.Num()
+				? 1
+				: (CurrentIndex >= InCurrentEntries.Num()
+					? -1
+					: InBaselineEntries[BaselineIndex].PropertyName.Compare(InCurrentEntries[CurrentIndex].PropertyName, ESearchCase::IgnoreCase));
+			const FDiffFieldEntry* BaselineEntry = OrderValue <= 0 ? &InBaselineEntries[BaselineIndex++] : nullptr;
+			const FDiffFieldEntry* CurrentEntry = OrderValue >= 0 ? &InCurrentEntries[CurrentIndex++] : nullptr;
+			FADumpDataAssetDiffChange ChangeItem;
+			ChangeItem.PropertyName = BaselineEntry ? BaselineEntry->PropertyName : CurrentEntry->PropertyName;
+
+			if (!BaselineEntry)
+			{
+				const FADumpDataAssetDiffValue& CurrentValue = CurrentEntry->Value;
+				ChangeItem.ChangeKind = EADumpDataAssetDiffChangeKind::Added;
+				ChangeItem.AfterValue = MakeCanonicalChangeValue(CurrentValue);
+				ChangeItem.ComparisonQuality = CurrentValue.bTruncated ? TEXT("partial") : TEXT("exact");
+				++InOutDataAssetDiff.AddedCount;
+			}
+			else if (!CurrentEntry)
+			{
+				const FADumpDataAssetDiffValue& BaselineValue = BaselineEntry->Value;
+				ChangeItem.ChangeKind = EADumpDataAssetDiffChangeKind::Removed;
+				ChangeItem.BeforeValue = MakeCanonicalChangeValue(BaselineValue);
+				ChangeItem.ComparisonQuality = BaselineValue.bTruncated ? TEXT("partial") : TEXT("exact");
+				++InOutDataAssetDiff.RemovedCount;
+			}
+			else
+			{
+				const FADumpDataAssetDiffValue& BaselineValue = BaselineEntry->Value;
+				const FADumpDataAssetDiffValue& CurrentValue = CurrentEntry->Value;
+				ChangeItem.ComparisonQuality = (BaselineValue.bTruncated || CurrentValue.bTruncated) ? TEXT("partial") : TEXT("exact");
+
+				// bValueEqual은 hash가 다르면 즉시 false이고, 같으면 deep 비교 결과다.
+				const bool bValueEqual = BaselineValue.ValueHash == CurrentValue.ValueHash
+					&& AreJsonValuesEqual(BaselineValue.ValueJson, CurrentValue.ValueJson)
+					&& BaselineValue.ValueText.Equals(CurrentValue.ValueText, ESearchCase::IgnoreCase);
+				if (BaselineValue.CppType != CurrentValue.CppType || BaselineValue.ValueKind != CurrentValue.ValueKind)
+				{
+					ChangeItem.ChangeKind = EADumpDataAssetDiffChangeKind::TypeChanged;
+					++InOutDataAssetDiff.TypeChangedCount;
+				}
+				else if (!bValueEqual || BaselineValue.bTruncated || CurrentValue.bTruncated)
+				{
+					ChangeItem.ChangeKind = EADumpDataAssetDiffChangeKind::Changed;
+					++InOutDataAssetDiff.ChangedCount;
+				}
+				else
+				{
+					++InOutDataAssetDiff.UnchangedCount;
+					continue;
+				}
+				ChangeItem.BeforeValue = MakeCanonicalChangeValue(BaselineValue);
+				ChangeItem.AfterValue = MakeCanonicalChangeValue(CurrentValue);
+			}
+
+			if (ChangeItem.ComparisonQuality == TEXT("partial"))
+			{
+				++InOutDataAssetDiff.PartialCount;
+			}
+			AddPreviewLine(InOutDataAssetDiff, ChangeItem);
+			InOutDataAssetDiff.Changes.Add(MoveTemp(ChangeItem));
+		}
+	}
+
+	// TryParseDiffRootObject는 dump JSON 문자열을 최상위 object로 역직렬화한다.
+	bool TryParseDiffRootObject(const FString& InJsonText, TSharedPtr<FJsonObject>& OutRootObject)
+	{
+		OutRootObject.Reset();
+
+		// JsonReader는 dump JSON을 읽는 reader다.
+		TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(InJsonText);
+		return FJsonSerializer::Deserialize(JsonReader, OutRootObject) && OutRootObject.IsValid();
+	}
+
+	// TryReadBaselineValues는 baseline dump identity와 data_asset_values_v1 fields를 검증해 field map으로 읽는다.
+	bool TryReadBaselineValues(
+		const TSharedPtr<FJsonObject>& InBaselineRootObject,
+		const FString& InCurrentAssetPath,
+		FADumpDataAssetDiff& InOutDataAssetDiff,
+		TArray<FDiffFieldEntry>& OutBaselineEntries,
+		TArray<FADumpIssue>& OutIssues)
+	{
+		// AssetObject는 baseline asset identity object다.
+		const TSharedPtr<FJsonObject>* AssetObject = nullptr;
+		if (!InBaselineRootObject->TryGetObjectField(TEXT("asset"), AssetObject) || AssetObject == nullptr || !AssetObject->IsValid())
+		{
+			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_ASSET_MISMATCH"), TEXT("DataAsset Diff baseline is missing asset identity."), InCurrentAssetPath);
+			return false;
+		}
+		(*AssetObject)->TryGetStringField(TEXT("object_path"), InOutDataAssetDiff.BaselineAssetPath);
+		if (InOutDataAssetDiff.BaselineAssetPath.IsEmpty() || InOutDataAssetDiff.BaselineAssetPath != InCurrentAssetPath)
+		{
+			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_ASSET_MISMATCH"), FString::Printf(TEXT("DataAsset Diff baseline asset '%s' does not match current asset '%s'."), *InOutDataAssetDiff.BaselineAssetPath, *InCurrentAssetPath), InCurrentAssetPath);
+			return false;
+		}
+
+		// BaselineValuesObject는 baseline data_asset_values section이다.
+		const TSharedPtr<FJsonObject>* BaselineValuesObject = nullptr;
+		if (!InBaselineRootObject->TryGetObjectField(TEXT("data_asset_values"), BaselineValuesObject) || BaselineValuesObject == nullptr || !BaselineValuesObject->IsValid())
+		{
+			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_BASE_SCHEMA_INVALID"), TEXT("DataAsset Diff baseline is missing top-level data_asset_values object."), InCurrentAssetPath);
+			return false;
+		}
+		if (!(*BaselineValuesObject)->TryGetStringField(TEXT("schema_version"), InOutDataAssetDiff.BaselineValuesSchema)
+			|| InOutDataAssetDiff.BaselineValuesSchema != ADumpDataAsset::GetSchemaVersionText())
+		{
+			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_BASE_SCHEMA_INVALID"), TEXT("DataAsset Diff baseline data_asset_values schema must be data_asset_values_v1."), InCurrentAssetPath);
+			return false;
+		}
+
+		// BaselineFieldArray는 baseline data_asset_values.fields 배열이다.
+		const TArray<TSharedPtr<FJsonValue>>* BaselineFieldArray = nullptr;
+		if (!(*BaselineValuesObject)->TryGetArrayField(TEXT("fields"), BaselineFieldArray) || BaselineFieldArray == nullptr)
+		{
+			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_BASE_SCHEMA_INVALID"), TEXT("DataAsset Diff baseline data_asset_values.fields array is missing."), InCurrentAssetPath);
+			return false;
+		}
+		return TryBuildBaselineFieldEntries(*BaselineFieldArray, OutBaselineEntries, OutIssues, InCurrentAssetPath);
+	}
+
+	// TryReadCurrentDumpValues는 batch diff current 쪽 저장 dump에서 data_asset_values_v1 fields를 읽는다.
+	bool TryReadCurrentDumpValues(
+		const FString& InCurrentDumpPath,
+		const FString& InCurrentAssetPath,
+		FADumpDataAssetDiff& InOutDataAssetDiff,
+		TArray<FDiffFieldEntry>& OutCurrentEntries,
+		TArray<FADumpIssue>& OutIssues)
+	{
+		OutCurrentEntries.Reset();
+
+		// FileSizeBytes는 current dump를 baseline과 같은 16 MiB 제한으로 읽기 위한 크기다. pack 항목이면 저장된 payload 크기다.
+		int64 FileSizeBytes = -1;
+		FString FileStampText;
+		ADumpJson::GetJsonFileStat(InCurrentDumpPath, FileSizeBytes, FileStampText);
+
+		// CurrentBytes는 필요하면 gzip 해제까지 끝난 current dump UTF-8 JSON byte다.
+		TArray<uint8> CurrentBytes;
+		if (FileSizeBytes < 0
+			|| FileSizeBytes > DataAssetDiffMaxBaselineBytes
+			|| !ADumpJson::LoadJsonBytesFromFile(InCurrentDumpPath, CurrentBytes)
+			|| CurrentBytes.Num() > DataAssetDiffMaxBaselineBytes)
+		{
+			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_CURRENT_READ_FAILED"), FString::Printf(TEXT("DataAsset Diff current dump could not be read within 16 MiB: %s"), *InCurrentDumpPath), InCurrentAssetPath);
+			return false;
+		}
+
+		// CurrentText는 역직렬화할 current dump JSON 문자열이다.
+		FString CurrentText;
+		FFileHelper::BufferToString(CurrentText, CurrentBytes.GetData(), CurrentBytes.Num());
+
+		// CurrentRootObject는 current dump JSON 최상위 object다.
+		TSharedPtr<FJsonObject> CurrentRootObject;
+		if (!TryParseDiffRootObject(CurrentText, CurrentRootObject))
+		{
+			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_CURRENT_JSON_INVALID"), TEXT("DataAsset Diff current dump JSON is malformed."), InCurrentAssetPath);
+			return false;
+		}
+
+		// AssetObject는 current dump asset identity object다.
+		const TSharedPtr<FJsonObject>* AssetObject = nullptr;
+		FString CurrentObjectPath;
+		if (!CurrentRootObject->TryGetObjectField(TEXT("asset"), AssetObject)
+			|| AssetObject == nullptr
+			|| !AssetObject->IsValid()
+			|| !(*AssetObject)->TryGetStringField(TEXT("object_path"), CurrentObjectPath)
+			|| CurrentObjectPath != InCurrentAssetPath)
+		{
+			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_ASSET_MISMATCH"), FString::Printf(TEXT("DataAsset Diff current dump asset '%s' does not match current asset '%s'."), *CurrentObjectPath, *InCurrentAssetPath), InCurrentAssetPath);
+			return false;
+		}
+
+		// CurrentValuesObject는 current data_asset_values section이다.
+		const TSharedPtr<FJsonObject>* CurrentValuesObject = nullptr;
+		const TArray<TSharedPtr<FJsonValue>>* CurrentFieldArray = nullptr;
+		if (!CurrentRootObject->TryGetObjectField(TEXT("data_asset_values"), CurrentValuesObject)
+			|| CurrentValuesObject == nullptr
+			|| !CurrentValuesObject->IsValid()
+			|| !(*CurrentValuesObject)->TryGetStringField(TEXT("schema_version"), InOutDataAssetDiff.CurrentValuesSchema)
+			|| InOutDataAssetDiff.CurrentValuesSchema != ADumpDataAsset::GetSchemaVersionText()
+			|| !(*CurrentValuesObject)->TryGetArrayField(TEXT("fields"), CurrentFieldArray)
+			|| CurrentFieldArray == nullptr)
+		{
+			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_CURRENT_UNSUPPORTED"), TEXT("data_asset_diff requires a current dump with data_asset_values_v1 fields."), InCurrentAssetPath);
+			return false;
+		}
+		return TryBuildBaselineFieldEntries(*CurrentFieldArray, OutCurrentEntries, OutIssues, InCurrentAssetPath);
+	}
+
+	// FBatchDiffPair는 baseline/current asset_index 항목 한 쌍과 병렬 diff 결과를 보관한다.
+	struct FBatchDiffPair
+	{
+		// ObjectPath는 두 dump root를 짝짓는 asset object path다.
+		FString ObjectPath;
+
+		// BaselineFingerprint는 baseline asset_index 항목의 fingerprint다.
+		FString BaselineFingerprint;
+
+		// CurrentFingerprint는 current asset_index 항목의 fingerprint다.
+		FString CurrentFingerprint;
+
+		// BaselineDumpPath는 baseline 주 dump JSON 절대 경로다.
+		FString BaselineDumpPath;
+
+		// CurrentDumpPath는 current 주 dump JSON 절대 경로다.
+		FString CurrentDumpPath;
+
+		// SectionFilePath는 저장한 per-asset data_asset_diff section 절대 경로다.
+		FString SectionFilePath;
+
+		// Status는 unchanged_fingerprint/unchanged/changed/added_asset/removed_asset/failed 중 하나다.
+		FString Status;
+
+		// Diff는 비교를 실행한 쌍의 data_asset_diff_v1 결과다.
+		FADumpDataAssetDiff Diff;
+
+		// Issues는 비교 또는 section 저장 실패 원인이다.
+		TArray<FADumpIssue> Issues;
+	};
+
+	// NormalizeBatchDumpRoot는 dump root를 절대 normalized directory로 변환한다.
+	FString NormalizeBatchDumpRoot(const FString& InDumpRootPath)
+	{
+		FString NormalizedPath = InDumpRootPath;
+		NormalizedPath.TrimStartAndEndInline();
+		NormalizedPath.TrimQuotesInline();
+		NormalizedPath = FPaths::ConvertRelativePathToFull(NormalizedPath);
+		FPaths::NormalizeDirectoryName(NormalizedPath);
+		return NormalizedPath;
+	}
+
+	// ResolveBatchDumpFile는 asset_index output_files 상대 경로를 dump root 내부 절대 경로로 해석한다.
+	bool ResolveBatchDumpFile(const FString& InDumpRootPath, const FString& InRelativePath, FString& OutFilePath)
+	{
+		OutFilePath.Reset();
+		if (InRelativePath.IsEmpty()
+			|| !FPaths::IsRelative(InRelativePath)
+			|| InRelativePath.Contains(TEXT("\\"))
+			|| InRelativePath.StartsWith(TEXT("../")))
+		{
+			return false;
+		}
+
+		// RootPrefix는 dump root 탈출 여부를 검사하는 디렉터리 prefix다.
+		const FString RootPrefix = InDumpRootPath.EndsWith(TEXT("/")) ? InDumpRootPath : InDumpRootPath + TEXT("/");
+		OutFilePath = FPaths::ConvertRelativePathToFull(FPaths::Combine(InDumpRootPath, InRelativePath));
+		FPaths::NormalizeFilename(OutFilePath);
+		return OutFilePath.StartsWith(RootPrefix, ESearchCase::IgnoreCase);
+	}
+
+	// LoadDataAssetIndexEntries는 asset_index_v1에서 data_asset_values를 가진 ready 항목만 object_path map으로 읽는다.
+	bool LoadDataAssetIndexEntries(
+		const FString& InDumpRootPath,
+		TMap<FString, TSharedPtr<FJsonObject>>& OutEntryByObjectPath,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutEntryByObjectPath.Reset();
+
+		// AssetIndexFilePath는 dump root의 asset_index_v1 파일 경로다.
+		const FString AssetIndexFilePath = FPaths::Combine(InDumpRootPath, TEXT("asset_index.json"));
+		if (!IFileManager::Get().FileExists(*AssetIndexFilePath))
+		{
+			OutErrorCode = TEXT("ADUMP_BATCH_DIFF_INDEX_NOT_FOUND");
+			OutErrorDetail = FString::Printf(TEXT("asset_index.json was not found. Run -Mode=index first: %s"), *AssetIndexFilePath);
+			return false;
+		}
+
+		// AssetIndexText는 asset_index_v1 원문이다.
+		FString AssetIndexText;
+		TSharedPtr<FJsonObject> AssetIndexRootObject;
+		if (!FFileHelper::LoadFileToString(AssetIndexText, *AssetIndexFilePath)
+			|| !TryParseDiffRootObject(AssetIndexText, AssetIndexRootObject))
+		{
+			OutErrorCode = TEXT("ADUMP_BATCH_DIFF_INDEX_JSON_INVALID");
+			OutErrorDetail = FString::Printf(TEXT("asset_index.json could not be parsed: %s"), *AssetIndexFilePath);
+			return false;
+		}
+
+		FString SchemaVersionText;
+		const TArray<TSharedPtr<FJsonValue>>* AssetValueArray = nullptr;
+		if (!AssetIndexRootObject->TryGetStringField(TEXT("schema_version"), SchemaVersionText)
+			|| SchemaVersionText != TEXT("asset_index_v1")
+			|| !AssetIndexRootObject->TryGetArrayField(TEXT("assets"), AssetValueArray)
+			|| AssetValueArray == nullptr)
+		{
+			OutErrorCode = TEXT("ADUMP_BATCH_DIFF_INDEX_SCHEMA_UNSUPPORTED");
+			OutErrorDetail = FString::Printf(TEXT("asset_index.json must be asset_index_v1 with an assets array: %s"), *AssetIndexFilePath);
+			return false;
+		}
+
+		for (const TSharedPtr<FJsonValue>& AssetValue : *AssetValueArray)
+		{
+			const TSharedPtr<FJsonObject> AssetEntryObject = AssetValue.IsValid() ? AssetValue->AsObject() : nullptr;
+			FString ObjectPathText;
+			FString IndexStatusText;
+			const TArray<TSharedPtr<FJsonValue>>* AvailableSectionArray = nullptr;
+			if (!AssetEntryObject.IsValid()
+				|| !AssetEntryObject->TryGetStringField(TEXT("object_path"), ObjectPathText)
+				|| ObjectPathText.IsEmpty()
+				|| !AssetEntryObject->TryGetStringField(TEXT("index_status"), IndexStatusText)
+				|| IndexStatusText != TEXT("ready")
+				|| !AssetEntryObject->TryGetArrayField(TEXT("available_sections"), AvailableSectionArray)
+				|| AvailableSectionArray == nullptr)
+			{
+				continue;
+			}
+
+			// bHasDataAssetValues는 이 항목이 data_asset_values section을 실제로 가진 DataAsset dump인지 나타낸다.
+			const bool bHasDataAssetValues = AvailableSectionArray->ContainsByPredicate([](const TSharedPtr<FJsonValue>& InSectionValue)
+			{
+				return InSectionValue.IsValid() && InSectionValue->AsString() == TEXT("data_asset_values");
+			});
+			if (bHasDataAssetValues)
+			{
+				OutEntryByObjectPath.Add(ObjectPathText, AssetEntryObject);
+			}
+		}
+		return true;
+	}
+
+	// ResolveIndexedMainDumpPath는 asset_index 항목의 output_files.dump를 안전한 절대 경로로 해석한다.
+	bool ResolveIndexedMainDumpPath(const FString& InDumpRootPath, const TSharedPtr<FJsonObject>& InEntryObject, FString& OutDumpFilePath)
+	{
+		OutDumpFilePath.Reset();
+		const TSharedPtr<FJsonObject>* OutputFilesObject = nullptr;
+		FString RelativeDumpPath;
+		return InEntryObject.IsValid()
+			&& InEntryObject->TryGetObjectField(TEXT("output_files"), OutputFilesObject)
+			&& OutputFilesObject != nullptr
+			&& OutputFilesObject->IsValid()
+			&& (*OutputFilesObject)->TryGetStringField(TEXT("dump"), RelativeDumpPath)
+			&& ResolveBatchDumpFile(InDumpRootPath, RelativeDumpPath, OutDumpFilePath);
+	}
+
+	// MakeBatchRelativePath는 dump root 내부 절대 경로를 슬래시 기준 상대 경로로 바꾼다.
+	FString MakeBatchRelativePath(const FString& InFilePath, const FString& InDumpRootPath)
+	{
+		if (InFilePath.IsEmpty())
+		{
+			return FString();
+		}
+
+		FString RelativePath = InFilePath;
+		FPaths::MakePathRelativeTo(RelativePath, *(InDumpRootPath + TEXT("/")));
+		RelativePath.ReplaceInline(TEXT("\\"), TEXT("/"));
+		return RelativePath;
+	}
 }
 
 namespace ADumpDataDiff
@@ -472,6 +1025,11 @@ namespace ADumpDataDiff
 		return TEXT("data_asset_diff_v1");
 	}
 
+	const TCHAR* GetBatchSchemaVersionText()
+	{
+		return TEXT("data_asset_batch_diff_v1");
+	}
+
 	bool PrepareBaselineFile(
 		const FString& InBaselinePath,
 		FString& OutNormalizedPath,
@@ -489,7 +1047,7 @@ namespace ADumpDataDiff
 
 		OutNormalizedPath = ResolveBaselinePath(InBaselinePath);
 
-		// BaselineBytes는 SHA-256과 text decoding에 사용할 원문 바이트다.
+		// BaselineBytes는 SHA-256과 text decoding에 사용할 해제된 JSON 바이트다.
 		TArray<uint8> BaselineBytes;
 
 		// BaselineText는 읽기 가능 여부를 확인하기 위한 JSON 원문 문자열이다.
@@ -524,7 +1082,7 @@ namespace ADumpDataDiff
 			return false;
 		}
 
-		// BaselineBytes는 JSON 원문 바이트다.
+		// BaselineBytes는 해제된 baseline JSON 바이트다.
 		TArray<uint8> BaselineBytes;
 
 		// BaselineText는 역직렬화할 baseline JSON 문자열이다.
@@ -545,123 +1103,343 @@ namespace ADumpDataDiff
 			return false;
 		}
 
-		// AssetObject는 baseline asset identity object다.
-		const TSharedPtr<FJsonObject>* AssetObject = nullptr;
-		if (!BaselineRootObject->TryGetObjectField(TEXT("asset"), AssetObject) || AssetObject == nullptr || !AssetObject->IsValid())
+		// BaselineEntries는 baseline fields를 property_name merge 순서로 담은 배열이다.
+		TArray<FDiffFieldEntry> BaselineEntries;
+		if (!TryReadBaselineValues(BaselineRootObject, InCurrentAssetPath, OutDataAssetDiff, BaselineEntries, OutIssues))
 		{
-			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_ASSET_MISMATCH"), TEXT("DataAsset Diff baseline is missing asset identity."), InCurrentAssetPath);
 			return false;
 		}
-		(*AssetObject)->TryGetStringField(TEXT("object_path"), OutDataAssetDiff.BaselineAssetPath);
-		if (OutDataAssetDiff.BaselineAssetPath.IsEmpty() || OutDataAssetDiff.BaselineAssetPath != InCurrentAssetPath)
+
+		// CurrentEntries는 current fields를 property_name merge 순서로 담은 배열이다.
+		const TArray<FDiffFieldEntry> CurrentEntries = BuildCurrentFieldEntries(InCurrentValues);
+		CompareFieldEntries(BaselineEntries, CurrentEntries, OutDataAssetDiff);
+
+		OutDataAssetDiff.bCompatible = true;
+		return true;
+	}
+
+	bool BuildDataAssetDiffFromDumpFiles(
+		const FString& InBaselineDumpPath,
+		const FString& InCurrentDumpPath,
+		const FString& InCurrentAssetPath,
+		FADumpDataAssetDiff& OutDataAssetDiff,
+		TArray<FADumpIssue>& OutIssues)
+	{
+		OutDataAssetDiff = FADumpDataAssetDiff();
+		OutDataAssetDiff.SchemaVersion = GetSchemaVersionText();
+		OutDataAssetDiff.BaselineFilePath = InBaselineDumpPath;
+		OutDataAssetDiff.CurrentAssetPath = InCurrentAssetPath;
+
+		// BaselineBytes는 SHA-256 계산과 역직렬화에 함께 쓰는 해제된 baseline JSON 바이트다.
+		TArray<uint8> BaselineBytes;
+
+		// BaselineText는 역직렬화할 baseline JSON 문자열이다.
+		FString BaselineText;
+		if (!LoadBaselineText(InBaselineDumpPath, BaselineBytes, BaselineText, OutIssues, InCurrentAssetPath))
 		{
-			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_ASSET_MISMATCH"), FString::Printf(TEXT("DataAsset Diff baseline asset '%s' does not match current asset '%s'."), *OutDataAssetDiff.BaselineAssetPath, *InCurrentAssetPath), InCurrentAssetPath);
 			return false;
 		}
+		OutDataAssetDiff.BaselineSha256 = ComputeSha256Text(BaselineBytes);
 
-		// BaselineValuesObject는 baseline data_asset_values section이다.
-		const TSharedPtr<FJsonObject>* BaselineValuesObject = nullptr;
-		if (!BaselineRootObject->TryGetObjectField(TEXT("data_asset_values"), BaselineValuesObject) || BaselineValuesObject == nullptr || !BaselineValuesObject->IsValid())
+		// BaselineRootObject는 baseline dump JSON 최상위 object다.
+		TSharedPtr<FJsonObject> BaselineRootObject;
+		if (!TryParseDiffRootObject(BaselineText, BaselineRootObject))
 		{
-			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_BASE_SCHEMA_INVALID"), TEXT("DataAsset Diff baseline is missing top-level data_asset_values object."), InCurrentAssetPath);
+			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_BASE_JSON_INVALID"), TEXT("DataAsset Diff baseline JSON is malformed."), InCurrentAssetPath);
 			return false;
 		}
-		if (!(*BaselineValuesObject)->TryGetStringField(TEXT("schema_version"), OutDataAssetDiff.BaselineValuesSchema)
-			|| OutDataAssetDiff.BaselineValuesSchema != ADumpDataAsset::GetSchemaVersionText())
+
+		// BaselineEntries는 baseline fields를 property_name merge 순서로 담은 배열이다.
+		TArray<FDiffFieldEntry> BaselineEntries;
+		if (!TryReadBaselineValues(BaselineRootObject, InCurrentAssetPath, OutDataAssetDiff, BaselineEntries, OutIssues))
 		{
-			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_BASE_SCHEMA_INVALID"), TEXT("DataAsset Diff baseline data_asset_values schema must be data_asset_values_v1."), InCurrentAssetPath);
 			return false;
 		}
 
-		// BaselineFieldArray는 baseline data_asset_values.fields 배열이다.
-		const TArray<TSharedPtr<FJsonValue>>* BaselineFieldArray = nullptr;
-		if (!(*BaselineValuesObject)->TryGetArrayField(TEXT("fields"), BaselineFieldArray) || BaselineFieldArray == nullptr)
+		// CurrentEntries는 current dump fields를 property_name merge 순서로 담은 배열이다.
+		TArray<FDiffFieldEntry> CurrentEntries;
+		if (!TryReadCurrentDumpValues(InCurrentDumpPath, InCurrentAssetPath, OutDataAssetDiff, CurrentEntries, OutIssues))
 		{
-			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_BASE_SCHEMA_INVALID"), TEXT("DataAsset Diff baseline data_asset_values.fields array is missing."), InCurrentAssetPath);
 			return false;
 		}
+		CompareFieldEntries(BaselineEntries, CurrentEntries, OutDataAssetDiff);
+
+		OutDataAssetDiff.bCompatible = true;
+		return true;
+	}
+
+	bool BuildBatchDataAssetDiffJson(
+		const FString& InBaselineRootPath,
+		const FString& InCurrentRootPath,
+		FString& OutJsonText,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutJsonText.Reset();
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+
+		// StartSeconds는 index 로드부터 보고서 직렬화까지의 wall time 기준점이다.
+		const double StartSeconds = FPlatformTime::Seconds();
 
-		// BaselineFieldMap은 baseline fields를 property_name으로 찾기 위한 map이다.
-		TMap<FString, FADumpDataAssetDiffValue> BaselineFieldMap;
-		if (!TryBuildBaselineFieldMap(*BaselineFieldArray, BaselineFieldMap, OutIssues, InCurrentAssetPath))
+		// BaselineRootPath와 CurrentRootPath는 경로 비교와 상대 경로 계산에 쓰는 정규화 dump root다.
+		const FString BaselineRootPath = NormalizeBatchDumpRoot(InBaselineRootPath);
+		const FString CurrentRootPath = NormalizeBatchDumpRoot(InCurrentRootPath);
+		if (BaselineRootPath.Equals(CurrentRootPath, ESearchCase::IgnoreCase))
 		{
+			OutErrorCode = TEXT("ADUMP_BATCH_DIFF_ROOT_CONFLICT");
+			OutErrorDetail = FString::Printf(TEXT("-BaselineRoot= and -DumpRoot= must be different dump roots: %s"), *CurrentRootPath);
 			return false;
 		}
 
-		// CurrentFieldMap은 current fields를 property_name으로 찾기 위한 map이다.
-		const TMap<FString, FADumpDataAssetDiffValue> CurrentFieldMap = BuildCurrentFieldMap(InCurrentValues);
+		// BaselineEntryByPath와 CurrentEntryByPath는 data_asset_values를 가진 asset_index 항목 map이다.
+		TMap<FString, TSharedPtr<FJsonObject>> BaselineEntryByPath;
+		TMap<FString, TSharedPtr<FJsonObject>> CurrentEntryByPath;
+		if (!LoadDataAssetIndexEntries(BaselineRootPath, BaselineEntryByPath, OutErrorCode, OutErrorDetail)
+			|| !LoadDataAssetIndexEntries(CurrentRootPath, CurrentEntryByPath, OutErrorCode, OutErrorDetail))
+		{
+			return false;
+		}
 
-		// PropertyNameArray는 baseline/current union key의 deterministic 순서다.
-		TArray<FString> PropertyNameArray;
-		BaselineFieldMap.GetKeys(PropertyNameArray);
-		for (const TPair<FString, FADumpDataAssetDiffValue>& CurrentPair : CurrentFieldMap)
+		// ObjectPathArray는 두 root의 DataAsset object path union을 case-sensitive로 정렬한 목록이다.
+		TArray<FString> ObjectPathArray;
+		BaselineEntryByPath.GetKeys(ObjectPathArray);
+		for (const TPair<FString, TSharedPtr<FJsonObject>>& CurrentPair : CurrentEntryByPath)
 		{
-			PropertyNameArray.AddUnique(CurrentPair.Key);
+			if (!BaselineEntryByPath.Contains(CurrentPair.Key))
+			{
+				ObjectPathArray.Add(CurrentPair.Key);
+			}
 		}
-		PropertyNameArray.Sort();
+		ObjectPathArray.Sort([](const FString& InLeft, const FString& InRight)
+		{
+			return InLeft.Compare(InRight, ESearchCase::CaseSensitive) < 0;
+		});
 
-		for (const FString& PropertyName : PropertyNameArray)
+		// PairArray는 보고서 순서와 같은 object path 순서의 비교 쌍이다.
+		TArray<FBatchDiffPair> PairArray;
+		PairArray.SetNum(ObjectPathArray.Num());
+
+		// PendingPairIndexArray는 fingerprint가 달라 실제 dump 비교가 필요한 쌍 index다.
+		TArray<int32> PendingPairIndexArray;
+		for (int32 PairIndex = 0; PairIndex < ObjectPathArray.Num(); ++PairIndex)
 		{
-			const FADumpDataAssetDiffValue* BaselineValue = BaselineFieldMap.Find(PropertyName);
-			const FADumpDataAssetDiffValue* CurrentValue = CurrentFieldMap.Find(PropertyName);
-			FADumpDataAssetDiffChange ChangeItem;
-			ChangeItem.PropertyName = PropertyName;
+			FBatchDiffPair& Pair = PairArray[PairIndex];
+			Pair.ObjectPath = ObjectPathArray[PairIndex];
+			const TSharedPtr<FJsonObject>* BaselineEntry = BaselineEntryByPath.Find(Pair.ObjectPath);
+			const TSharedPtr<FJsonObject>* CurrentEntry = CurrentEntryByPath.Find(Pair.ObjectPath);
+			if (BaselineEntry)
+			{
+				(*BaselineEntry)->TryGetStringField(TEXT("fingerprint"), Pair.BaselineFingerprint);
+			}
+			if (CurrentEntry)
+			{
+				(*CurrentEntry)->TryGetStringField(TEXT("fingerprint"), Pair.CurrentFingerprint);
 
-			if (!BaselineValue && CurrentValue)
+				// current 경로는 비교하지 않는 쌍도 이전 실행의 section 파일을 정리하려고 먼저 해석한다.
+				ResolveIndexedMainDumpPath(CurrentRootPath, *CurrentEntry, Pair.CurrentDumpPath);
+			}
+
+			if (!BaselineEntry)
 			{
-				ChangeItem.ChangeKind = EADumpDataAssetDiffChangeKind::Added;
-				ChangeItem.AfterValue = *CurrentValue;
-				ChangeItem.ComparisonQuality = CurrentValue->bTruncated ? TEXT("partial") : TEXT("exact");
-				++OutDataAssetDiff.AddedCount;
+				Pair.Status = TEXT("added_asset");
 			}
-			else if (BaselineValue && !CurrentValue)
+			else if (!CurrentEntry)
 			{
-				ChangeItem.ChangeKind = EADumpDataAssetDiffChangeKind::Removed;
-				ChangeItem.BeforeValue = *BaselineValue;
-				ChangeItem.ComparisonQuality = BaselineValue->bTruncated ? TEXT("partial") : TEXT("exact");
-				++OutDataAssetDiff.RemovedCount;
+				Pair.Status = TEXT("removed_asset");
 			}
-			else if (BaselineValue && CurrentValue)
+			else if (!Pair.BaselineFingerprint.IsEmpty() && Pair.BaselineFingerprint == Pair.CurrentFingerprint)
 			{
-				ChangeItem.BeforeValue = *BaselineValue;
-				ChangeItem.AfterValue = *CurrentValue;
-				ChangeItem.ComparisonQuality = (BaselineValue->bTruncated || CurrentValue->bTruncated) ? TEXT("partial") : TEXT("exact");
-
-				if (BaselineValue->CppType != CurrentValue->CppType || BaselineValue->ValueKind != CurrentValue->ValueKind)
-				{
-					ChangeItem.ChangeKind = EADumpDataAssetDiffChangeKind::TypeChanged;
-					++OutDataAssetDiff.TypeChangedCount;
-				}
-				else if (CanonicalJsonText(BaselineValue->ValueJson) != CanonicalJsonText(CurrentValue->ValueJson)
-					|| BaselineValue->ValueText != CurrentValue->ValueText)
-				{
-					ChangeItem.ChangeKind = EADumpDataAssetDiffChangeKind::Changed;
-					++OutDataAssetDiff.ChangedCount;
-				}
-				else if (BaselineValue->bTruncated || CurrentValue->bTruncated)
-				{
-					ChangeItem.ChangeKind = EADumpDataAssetDiffChangeKind::Changed;
-					++OutDataAssetDiff.ChangedCount;
-				}
-				else
-				{
-					++OutDataAssetDiff.UnchangedCount;
-					continue;
-				}
+				Pair.Status = TEXT("unchanged_fingerprint");
+			}
+			else if (!ResolveIndexedMainDumpPath(BaselineRootPath, *BaselineEntry, Pair.BaselineDumpPath)
+				|| Pair.CurrentDumpPath.IsEmpty())
+			{
+				Pair.Status = TEXT("failed");
+				AddDiffIssue(Pair.Issues, TEXT("ADUMP_BATCH_DIFF_SOURCE_UNRESOLVED"), TEXT("asset_index output_files.dump could not be resolved inside the dump root."), Pair.ObjectPath);
 			}
 			else
+			{
+				PendingPairIndexArray.Add(PairIndex);
+			}
+		}
+
+		// IndexSeconds는 두 asset_index 로드와 fingerprint 분류가 끝난 시점이다.
+		const double IndexSeconds = FPlatformTime::Seconds();
+
+		// 비교는 저장 JSON만 읽는 순수 작업이라 쌍마다 독립적으로 병렬 실행하고 결과는 미리 잡아 둔 slot에만 쓴다.
+		ParallelFor(PendingPairIndexArray.Num(), [&PairArray, &PendingPairIndexArray, &BaselineRootPath](int32 PendingIndex)
+		{
+			FBatchDiffPair& Pair = PairArray[PendingPairIndexArray[PendingIndex]];
+			if (!BuildDataAssetDiffFromDumpFiles(Pair.BaselineDumpPath, Pair.CurrentDumpPath, Pair.ObjectPath, Pair.Diff, Pair.Issues))
+			{
+				Pair.Status = TEXT("failed");
+				return;
+			}
+			Pair.Status = Pair.Diff.Changes.Num() > 0 ? TEXT("changed") : TEXT("unchanged");
+
+			// SectionRootObject는 dump.json과 같은 /data_asset_diff pointer로 읽히는 per-asset section 파일이다.
+			TSharedRef<FJsonObject> SectionRootObject = MakeShared<FJsonObject>();
+			TSharedRef<FJsonObject> SectionAssetObject = MakeShared<FJsonObject>();
+			SectionAssetObject->SetStringField(TEXT("object_path"), Pair.ObjectPath);
+			SectionRootObject->SetObjectField(TEXT("asset"), SectionAssetObject);
+			SectionRootObject->SetStringField(TEXT("baseline_root"), BaselineRootPath);
+			SectionRootObject->SetObjectField(TEXT("data_asset_diff"), ADumpJson::MakeDataAssetDiffSectionObject(Pair.Diff));
+
+			FString SectionJsonText;
+			TSharedRef<TJsonWriter<>> SectionWriter = TJsonWriterFactory<>::Create(&SectionJsonText);
+			FJsonSerializer::Serialize(SectionRootObject, SectionWriter);
+
+			const FString SectionFilePath = FPaths::Combine(FPaths::GetPath(Pair.CurrentDumpPath), TEXT("data_asset_diff.json"));
+			FString SaveErrorMessage;
+			if (!ADumpJson::SaveJsonTextToFile(SectionFilePath, SectionJsonText, SaveErrorMessage))
+			{
+				Pair.Status = TEXT("failed");
+				AddDiffIssue(Pair.Issues, TEXT("ADUMP_BATCH_DIFF_SECTION_WRITE_FAILED"), SaveErrorMessage, Pair.ObjectPath);
+				return;
+			}
+			Pair.SectionFilePath = SectionFilePath;
+		});
+
+		// 이번 실행에서 section을 쓰지 않은 current asset의 이전 data_asset_diff.json은 다른 baseline 기준일 수 있어 지운다.
+		int32 StaleSectionRemovedCount = 0;
+		for (const FBatchDiffPair& Pair : PairArray)
+		{
+			if (Pair.CurrentDumpPath.IsEmpty() || !Pair.SectionFilePath.IsEmpty())
 			{
 				continue;
 			}
+			const FString StaleSectionFilePath = FPaths::Combine(FPaths::GetPath(Pair.CurrentDumpPath), TEXT("data_asset_diff.json"));
+			if (IFileManager::Get().FileExists(*StaleSectionFilePath) && IFileManager::Get().Delete(*StaleSectionFilePath, false, true, true))
+			{
+				++StaleSectionRemovedCount;
+			}
+		}
 
-			if (ChangeItem.ComparisonQuality == TEXT("partial"))
+		// DiffSeconds는 병렬 비교와 section 저장, 이전 section 정리가 끝난 시점이다.
+		const double DiffSeconds = FPlatformTime::Seconds();
+
+		// StatusCountMap은 status 문자열별 asset 개수다.
+		TMap<FString, int32> StatusCountMap;
+
+		// TotalDiff는 비교한 모든 쌍의 field 단위 합계다.
+		FADumpDataAssetDiff TotalDiff;
+
+		// AssetArray는 object path 순서의 per-asset 보고 항목이다.
+		TArray<TSharedPtr<FJsonValue>> AssetArray;
+		AssetArray.Reserve(PairArray.Num());
+		for (const FBatchDiffPair& Pair : PairArray)
+		{
+			++StatusCountMap.FindOrAdd(Pair.Status);
+			TotalDiff.AddedCount += Pair.Diff.AddedCount;
+			TotalDiff.RemovedCount += Pair.Diff.RemovedCount;
+			TotalDiff.ChangedCount += Pair.Diff.ChangedCount;
+			TotalDiff.TypeChangedCount += Pair.Diff.TypeChangedCount;
+			TotalDiff.PartialCount += Pair.Diff.PartialCount;
+			TotalDiff.UnchangedCount += Pair.Diff.UnchangedCount;
+
+			TSharedRef<FJsonObject> AssetObject = MakeShared<FJsonObject>();
+			AssetObject->SetStringField(TEXT("object_path"), Pair.ObjectPath);
+			AssetObject->SetStringField(TEXT("status"), Pair.Status);
+			AssetObject->SetStringField(TEXT("baseline_fingerprint"), Pair.BaselineFingerprint);
+			AssetObject->SetStringField(TEXT("current_fingerprint"), Pair.CurrentFingerprint);
+			AssetObject->SetStringField(TEXT("baseline_dump_file"), MakeBatchRelativePath(Pair.BaselineDumpPath, BaselineRootPath));
+			AssetObject->SetStringField(TEXT("current_dump_file"), MakeBatchRelativePath(Pair.CurrentDumpPath, CurrentRootPath));
+			AssetObject->SetStringField(TEXT("section_file"), MakeBatchRelativePath(Pair.SectionFilePath, CurrentRootPath));
+			AssetObject->SetStringField(TEXT("json_pointer"), Pair.SectionFilePath.IsEmpty() ? FString() : FString(TEXT("/data_asset_diff")));
+			AssetObject->SetNumberField(TEXT("added_count"), Pair.Diff.AddedCount);
+			AssetObject->SetNumberField(TEXT("removed_count"), Pair.Diff.RemovedCount);
+			AssetObject->SetNumberField(TEXT("changed_count"), Pair.Diff.ChangedCount);
+			AssetObject->SetNumberField(TEXT("type_changed_count"), Pair.Diff.TypeChangedCount);
+			AssetObject->SetNumberField(TEXT("partial_count"), Pair.Diff.PartialCount);
+
+			TArray<TSharedPtr<FJsonValue>> PreviewArray;
+			for (const FString& PreviewLine : Pair.Diff.PreviewLines)
+			{
+				PreviewArray.Add(MakeShared<FJsonValueString>(PreviewLine));
+			}
+			AssetObject->SetArrayField(TEXT("preview"), PreviewArray);
+
+			TArray<TSharedPtr<FJsonValue>> IssueArray;
+			for (const FADumpIssue& Issue : Pair.Issues)
 			{
-				++OutDataAssetDiff.PartialCount;
+				TSharedRef<FJsonObject> IssueObject = MakeShared<FJsonObject>();
+				IssueObject->SetStringField(TEXT("code"), Issue.Code);
+				IssueObject->SetStringField(TEXT("message"), Issue.Message);
+				IssueArray.Add(MakeShared<FJsonValueObject>(IssueObject));
 			}
-			AddPreviewLine(OutDataAssetDiff, ChangeItem);
-			OutDataAssetDiff.Changes.Add(MoveTemp(ChangeItem));
+			AssetObject->SetArrayField(TEXT("errors"), IssueArray);
+			AssetArray.Add(MakeShared<FJsonValueObject>(AssetObject));
+		}
+
+		auto GetStatusCount = [&StatusCountMap](const TCHAR* InStatus)
+		{
+			const int32* Count = StatusCountMap.Find(InStatus);
+			return Count ? *Count : 0;
+		};
+
+		TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+		RootObject->SetStringField(TEXT("schema_version"), GetBatchSchemaVersionText());
+		RootObject->SetStringField(TEXT("section_schema_version"), GetSchemaVersionText());
+		RootObject->SetStringField(TEXT("generated_time"), FDateTime::UtcNow().ToIso8601());
+		RootObject->SetStringField(TEXT("baseline_root"), BaselineRootPath);
+		RootObject->SetStringField(TEXT("dump_root"), CurrentRootPath);
+		RootObject->SetNumberField(TEXT("asset_count"), PairArray.Num());
+		RootObject->SetNumberField(TEXT("compared_count"), PendingPairIndexArray.Num());
+		RootObject->SetNumberField(TEXT("skipped_unchanged_fingerprint_count"), GetStatusCount(TEXT("unchanged_fingerprint")));
+		RootObject->SetNumberField(TEXT("unchanged_count"), GetStatusCount(TEXT("unchanged")));
+		RootObject->SetNumberField(TEXT("changed_count"), GetStatusCount(TEXT("changed")));
+		RootObject->SetNumberField(TEXT("added_asset_count"), GetStatusCount(TEXT("added_asset")));
+		RootObject->SetNumberField(TEXT("removed_asset_count"), GetStatusCount(TEXT("removed_asset")));
+		RootObject->SetNumberField(TEXT("failed_count"), GetStatusCount(TEXT("failed")));
+		RootObject->SetNumberField(TEXT("stale_section_removed_count"), StaleSectionRemovedCount);
+
+		TSharedRef<FJsonObject> FieldTotalsObject = MakeShared<FJsonObject>();
+		FieldTotalsObject->SetNumberField(TEXT("added_count"), TotalDiff.AddedCount);
+		FieldTotalsObject->SetNumberField(TEXT("removed_count"), TotalDiff.RemovedCount);
+		FieldTotalsObject->SetNumberField(TEXT("changed_count"), TotalDiff.ChangedCount);
+		FieldTotalsObject->SetNumberField(TEXT("type_changed_count"), TotalDiff.TypeChangedCount);
+		FieldTotalsObject->SetNumberField(TEXT("partial_count"), TotalDiff.PartialCount);
+		FieldTotalsObject->SetNumberField(TEXT("unchanged_count"), TotalDiff.UnchangedCount);
+		RootObject->SetObjectField(TEXT("field_totals"), FieldTotalsObject);
+
+		TSharedRef<FJsonObject> PerfObject = MakeShared<FJsonObject>();
+		PerfObject->SetNumberField(TEXT("index_ms"), FMath::RoundToInt64((IndexSeconds - StartSeconds) * 1000.0));
+		PerfObject->SetNumberField(TEXT("diff_ms"), FMath::RoundToInt64((DiffSeconds - IndexSeconds) * 1000.0));
+		RootObject->SetObjectField(TEXT("perf"), PerfObject);
+		RootObject->SetArrayField(TEXT("assets"), AssetArray);
+
+		TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&OutJsonText);
+		if (!FJsonSerializer::Serialize(RootObject, JsonWriter))
+		{
+			OutErrorCode = TEXT("ADUMP_BATCH_DIFF_SERIALIZE_FAILED");
+			OutErrorDetail = TEXT("data_asset_batch_diff_v1 report could not be serialized.");
+			return false;
+		}
+		return true;
+	}
+
+	bool BuildDataAssetDiffFromValues(
+		const FADumpDataAssetValues& InBaselineValues,
+		const FADumpDataAssetValues& InCurrentValues,
+		const FString& InAssetPath,
+		FADumpDataAssetDiff& OutDataAssetDiff,
+		TArray<FADumpIssue>& OutIssues)
+	{
+		OutDataAssetDiff = FADumpDataAssetDiff();
+		OutDataAssetDiff.SchemaVersion = GetSchemaVersionText();
+		OutDataAssetDiff.BaselineAssetPath = InAssetPath;
+		OutDataAssetDiff.CurrentAssetPath = InAssetPath;
+		OutDataAssetDiff.BaselineValuesSchema = InBaselineValues.SchemaVersion;
+		OutDataAssetDiff.CurrentValuesSchema = InCurrentValues.SchemaVersion;
+		if (InBaselineValues.SchemaVersion != ADumpDataAsset::GetSchemaVersionText()
+			|| InCurrentValues.SchemaVersion != ADumpDataAsset::GetSchemaVersionText())
+		{
+			AddDiffIssue(OutIssues, TEXT("ADUMP_DIFF_CURRENT_UNSUPPORTED"), TEXT("data_asset_diff requires data_asset_values_v1 on both sides."), InAssetPath);
+			return false;
 		}
 
+		CompareFieldEntries(BuildCurrentFieldEntries(InBaselineValues), BuildCurrentFieldEntries(InCurrentValues), OutDataAssetDiff);
 		OutDataAssetDiff.bCompatible = true;
 		return true;
 	}
@@ -1,6 +1,9 @@
 // File: ADumpEditorApi.cpp
-// Version: v0.5.0
+// Version: v0.8.0
 // Changelog:
+// - v0.8.0: 자동 재덤프 opt-in 설정/조회와 상태 요약 API를 FADumpAutoRedump에 연결.
+// - v0.7.0: Content Browser 선택 자산/폴더 경로 수집, 다중 자산 queue 덤프 시작과 queue 진행률/요약 조회를 추가.
+// - v0.6.0: 상태 getter가 캐시 스냅샷 참조를 읽고, 스냅샷 version과 로그 delta 조회 API를 추가.
 // - v0.5.0: 열린 Blueprint 자산 조회, 마지막 실패 재시도, 마지막 실행 시간(ms) 조회 API를 추가.
 // - v0.4.1: Compile Before Dump, Skip If Up To Date 옵션을 공통 실행 옵션으로 전달하도록 API 시그니처와 빌더를 확장.
 // - v0.4.0: 단계 실행형 덤프 컨트롤러 연동, 상태/로그/진행률 조회 API 추가, 외부 문자열 한국어화.
@@ -10,11 +13,13 @@
 
 #include "ADumpEditorApi.h"
 
+#include "ADumpAutoRedump.h"
 #include "ADumpExecCtrl.h"
 #include "ADumpRunOpts.h"
 #include "ADumpService.h"
 
 #include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/AssetRegistryModule.h"
 #include "ContentBrowserModule.h"
 #include "Engine/Blueprint.h"
 #include "IContentBrowserSingleton.h"
@@ -53,6 +58,28 @@ namespace
 		return false;
 	}
 
+	// ConvertContentBrowserFolderPath는 Content Browser 가상 폴더 경로(/All/Game/...)를 asset registry package path로 바꾼다.
+	FString ConvertContentBrowserFolderPath(const FString& InVirtualFolderPath)
+	{
+		FString PackagePath = InVirtualFolderPath;
+		if (PackagePath.StartsWith(TEXT("/All/")))
+		{
+			PackagePath.RightChopInline(4);
+		}
+
+		// 플러그인 콘텐츠는 /Plugins/<Mount>/... 가상 경로로 보이므로 mount root 경로로 되돌린다.
+		if (PackagePath.StartsWith(TEXT("/Plugins/")))
+		{
+			PackagePath.RightChopInline(8);
+		}
+
+		while (PackagePath.Len() > 1 && PackagePath.EndsWith(TEXT("/")))
+		{
+			PackagePath.LeftChopInline(1);
+		}
+		return PackagePath;
+	}
+
 	// ParseLinkKindText는 UI/Blueprint에서 받은 문자열을 공통 enum으로 변환한다.
 	EADumpLinkKind ParseLinkKindText(const FString& InLinkKindText)
 	{
@@ -250,6 +277,145 @@ bool UADumpEditorApi::StartDumpOpenBlueprint(
 	return FADumpExecCtrl::Get().StartDump(DumpRunOpts, OutMessage);
 }
 
+// GetSelectedContentBrowserAssetPaths는 선택 자산과 선택 폴더 하위 자산 경로를 정렬된 중복 없는 목록으로 모은다.
+bool UADumpEditorApi::GetSelectedContentBrowserAssetPaths(TArray<FString>& OutAssetObjectPaths, FString& OutMessage)
+{
+	OutAssetObjectPaths.Reset();
+	OutMessage.Reset();
+
+	FContentBrowserModule& ContentBrowserModule = FModuleManager::LoadModuleChecked<FContentBrowserModule>(TEXT("ContentBrowser"));
+
+	// SelectedAssetList는 선택 자산과 선택 폴더 아래 자산을 합친 목록이다.
+	TArray<FAssetData> SelectedAssetList;
+	ContentBrowserModule.Get().GetSelectedAssets(SelectedAssetList);
+
+	TArray<FString> SelectedFolderList;
+	ContentBrowserModule.Get().GetSelectedFolders(SelectedFolderList);
+	if (SelectedFolderList.Num() > 0)
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		for (const FString& SelectedFolderPath : SelectedFolderList)
+		{
+			const FString PackagePath = ConvertContentBrowserFolderPath(SelectedFolderPath);
+			if (!PackagePath.IsEmpty())
+			{
+				AssetRegistry.GetAssetsByPath(FName(*PackagePath), SelectedAssetList, true);
+			}
+		}
+	}
+
+	TSet<FString> SeenObjectPathSet;
+	for (const FAssetData& AssetDataItem : SelectedAssetList)
+	{
+		const FString ObjectPath = AssetDataItem.GetObjectPathString();
+		if (!ObjectPath.IsEmpty() && !SeenObjectPathSet.Contains(ObjectPath))
+		{
+			SeenObjectPathSet.Add(ObjectPath);
+			OutAssetObjectPaths.Add(ObjectPath);
+		}
+	}
+	OutAssetObjectPaths.Sort();
+
+	if (OutAssetObjectPaths.Num() <= 0)
+	{
+		OutMessage = TEXT("콘텐츠 브라우저에서 선택된 에셋이나 에셋이 있는 폴더가 없습니다.");
+		return false;
+	}
+
+	OutMessage = FString::Printf(TEXT("선택 에셋/폴더에서 에셋 %d개를 찾았습니다."), OutAssetObjectPaths.Num());
+	return true;
+}
+
+// StartDumpAssets는 자산 목록마다 공통 실행 옵션을 만들어 queue 덤프를 시작한다.
+bool UADumpEditorApi::StartDumpAssets(
+	const TArray<FString>& AssetObjectPaths,
+	bool bIncludeSummary,
+	bool bIncludeDetails,
+	bool bIncludeGraphs,
+	bool bIncludeReferences,
+	bool bCompileBeforeDump,
+	bool bSkipIfUpToDate,
+	const FString& GraphNameFilter,
+	bool bLinksOnly,
+	const FString& LinkKindText,
+	FString& OutMessage)
+{
+	// RunOptsList는 queue 자산별 실행 옵션이다. 자산마다 sidecar가 섞이지 않도록 출력은 자산별 기본 경로를 쓴다.
+	TArray<FADumpRunOpts> RunOptsList;
+	RunOptsList.Reserve(AssetObjectPaths.Num());
+	for (const FString& AssetObjectPath : AssetObjectPaths)
+	{
+		if (AssetObjectPath.TrimStartAndEnd().IsEmpty())
+		{
+			continue;
+		}
+
+		RunOptsList.Add(BuildRunOpts(
+			AssetObjectPath.TrimStartAndEnd(),
+			EADumpSourceKind::EditorSelection,
+			FString(),
+			bIncludeSummary,
+			bIncludeDetails,
+			bIncludeGraphs,
+			bIncludeReferences,
+			bCompileBeforeDump,
+			bSkipIfUpToDate,
+			GraphNameFilter,
+			bLinksOnly,
+			LinkKindText));
+	}
+
+	return FADumpExecCtrl::Get().StartDumpAssets(RunOptsList, OutMessage);
+}
+
+bool UADumpEditorApi::IsDumpQueueRunning()
+{
+	return FADumpExecCtrl::Get().GetSnapshot().bIsQueueRunning;
+}
+
+float UADumpEditorApi::GetDumpQueueProgressPercent01()
+{
+	return static_cast<float>(FADumpExecCtrl::Get().GetSnapshot().QueueProgress01);
+}
+
+FString UADumpEditorApi::GetDumpQueueSummaryText()
+{
+	const FADumpExecSnapshot& Snapshot = FADumpExecCtrl::Get().GetSnapshot();
+	if (Snapshot.QueueTotalCount <= 0)
+	{
+		return FString();
+	}
+
+	// EtaText는 남은 예상 시간 표시 문자열이다. 추정 전이면 계산 중으로 표시한다.
+	const FString EtaText = !Snapshot.bIsQueueRunning
+		? FString(TEXT("종료"))
+		: (Snapshot.QueueEtaSeconds >= 0.0 ? FString::Printf(TEXT("남은 예상 %.0f초"), Snapshot.QueueEtaSeconds) : FString(TEXT("남은 시간 계산 중")));
+	return FString::Printf(
+		TEXT("queue %d/%d 완료 (건너뜀 %d, 실패 %d, 취소 %d, 저장 중 %d) · %s"),
+		Snapshot.QueueCompletedCount,
+		Snapshot.QueueTotalCount,
+		Snapshot.QueueSkippedCount,
+		Snapshot.QueueFailedCount,
+		Snapshot.QueueCanceledCount,
+		Snapshot.QueueSavingCount,
+		*EtaText);
+}
+
+void UADumpEditorApi::SetAutoRedumpOnSaveEnabled(bool bEnabled)
+{
+	FADumpAutoRedump::Get().SetEnabled(bEnabled);
+}
+
+bool UADumpEditorApi::IsAutoRedumpOnSaveEnabled()
+{
+	return FADumpAutoRedump::Get().IsEnabled();
+}
+
+FString UADumpEditorApi::GetAutoRedumpStatusText()
+{
+	return FADumpAutoRedump::Get().GetStatusText();
+}
+
 bool UADumpEditorApi::TickActiveDump(FString& OutMessage)
 {
 	return FADumpExecCtrl::Get().TickDump(OutMessage);
@@ -308,7 +474,20 @@ FString UADumpEditorApi::GetDumpStatusMessage()
 
 FString UADumpEditorApi::GetDumpLogText()
 {
-	return FADumpExecCtrl::Get().GetSnapshot().LogText;
+	return FADumpExecCtrl::Get().BuildLogText();
+}
+
+// GetDumpStateVersion은 마지막 스냅샷 version을 반환한다.
+int64 UADumpEditorApi::GetDumpStateVersion()
+{
+	return static_cast<int64>(FADumpExecCtrl::Get().GetSnapshot().SnapshotVersion);
+}
+
+// GetDumpLogSince는 sequence 이후 로그 delta를 반환한다.
+bool UADumpEditorApi::GetDumpLogSince(int64 Sequence, TArray<FString>& OutLines, int64& OutNextSequence)
+{
+	OutLines.Reset();
+	return FADumpExecCtrl::Get().GetLogSince(Sequence, OutLines, OutNextSequence);
 }
 
 // HasRetryableFailedDump는 마지막 failed 실행 재시도 가능 여부를 반환한다.
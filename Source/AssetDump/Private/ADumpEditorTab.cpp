@@ -1,6 +1,12 @@
 // File: ADumpEditorTab.cpp
-// Version: v0.7.1
+// Version: v0.12.0
 // Changelog:
+// - v0.12.0: 덤프 단계는 FADumpExecCtrl core ticker가 탭이 닫히거나 가려져도 진행하므로 매 frame 덤프 tick timer를 제거.
+// - v0.11.1: 새 세션으로 ring이 비워져 delta가 끊기고 새 줄이 없을 때도 이전 세션 로그를 지우도록 수정.
+// - v0.11.0: 저장 시 자동 재덤프 체크박스(opt-in, ini 저장)와 자동 재덤프 상태 줄을 추가.
+// - v0.10.0: 선택 에셋/폴더 queue 덤프 버튼, queue 실행 중 집계 진행률 표시와 완료/건너뜀/실패/ETA 요약 줄을 추가.
+// - v0.9.0: 스냅샷 version이 바뀐 tick에만 상태를 읽고, 로그 패널을 sequence delta로 이어 붙이며 표시 줄 수를 제한.
+// - v0.8.0: 덤프 단계 tick을 매 frame timer(frame budget 단위 실행)로 분리하고 0.1초 timer는 UI 상태 갱신만 담당.
 // - v0.7.1: 출력 경로 안내 문구를 이전 기본 경로 표기에서 AssetDump 플러그인 Dumped/BPDump 기준으로 갱신.
 // - v0.7.0: Dump Open BP, Retry Last Failed, 마지막 실행 시간(ms) UI 표시를 추가.
 // - v0.6.2: 자동 계산된 출력 경로가 입력값으로 굳지 않도록 분리하고 체크박스 문구를 읽기 쉬운 한국어로 정리.
@@ -37,12 +43,15 @@ namespace
 
 	// DumpEditorTab 로그 카테고리 문자열이다.
 	static const TCHAR* DumpEditorTabLogPrefix = TEXT("[ADumpEditorTab]");
+
+	// MaxDisplayedLogLineCount는 로그 패널에 유지할 최대 줄 수다. 넘으면 최근 절반만 남긴다.
+	static constexpr int32 MaxDisplayedLogLineCount = 2000;
 }
 
 void SADumpEditorTab::Construct(const FArguments& InArgs)
 {
 	StatusMessage = TEXT("콘텐츠 브라우저에서 블루프린트를 선택한 뒤 선택 새로고침을 눌러주세요.");
-	LogText = StatusMessage;
+	SetLogText(StatusMessage);
 	CurrentPhaseText = TEXT("대기 중");
 	CurrentDetailText = TEXT("아직 실행된 덤프가 없습니다.");
 
@@ -170,6 +179,15 @@ void SADumpEditorTab::Construct(const FArguments& InArgs)
 							.AutoWrapText(true)
 							.Text(this, &SADumpEditorTab::GetLastExecutionMillisecondsText)
 						]
+						+ SVerticalBox::Slot()
+						.AutoHeight()
+						.Padding(0.0f, 4.0f, 0.0f, 0.0f)
+						[
+							SNew(STextBlock)
+							.AutoWrapText(true)
+							.Text(this, &SADumpEditorTab::GetQueueSummaryText)
+							.Visibility(this, &SADumpEditorTab::GetQueueSummaryVisibility)
+						]
 					]
 				]
 
@@ -222,6 +240,15 @@ void SADumpEditorTab::Construct(const FArguments& InArgs)
 							+ SHorizontalBox::Slot()
 							.FillWidth(1.0f)
 							.Padding(0.0f, 0.0f, 6.0f, 0.0f)
+							[
+								SNew(SButton)
+								.Text(LOCTEXT("DumpSelectedAssetsBtn", "선택 에셋/폴더 모두 덤프"))
+								.OnClicked(this, &SADumpEditorTab::HandleDumpSelectedAssetsClicked)
+								.IsEnabled(this, &SADumpEditorTab::CanStartDump)
+							]
+							+ SHorizontalBox::Slot()
+							.FillWidth(1.0f)
+							.Padding(0.0f, 0.0f, 6.0f, 0.0f)
 							[
 								SNew(SButton)
 								.Text(LOCTEXT("RetryLastFailedBtn", "Retry Last Failed"))
@@ -357,6 +384,23 @@ void SADumpEditorTab::Construct(const FArguments& InArgs)
 										.Text(LOCTEXT("SkipIfUpToDate", "최신 결과가 있으면 다시 추출하지 않음"))
 									]
 								]
+								+ SVerticalBox::Slot().AutoHeight().Padding(0.0f, 4.0f, 0.0f, 0.0f)
+								[
+									SNew(SCheckBox)
+									.IsChecked(this, &SADumpEditorTab::GetAutoRedumpCheckState)
+									.OnCheckStateChanged(this, &SADumpEditorTab::HandleAutoRedumpCheckStateChanged)
+									.ToolTipText(LOCTEXT("AutoRedumpTooltip", "저장/이름 변경/삭제 후 잠시 기다렸다가 이미 덤프된 에셋과 그 에셋을 직접 참조하는 에셋만 다시 덤프하고 index를 재생성합니다."))
+									[
+										SNew(STextBlock)
+										.Text(LOCTEXT("AutoRedump", "저장 시 덤프된 에셋 자동 재덤프"))
+									]
+								]
+								+ SVerticalBox::Slot().AutoHeight().Padding(20.0f, 2.0f, 0.0f, 0.0f)
+								[
+									SNew(STextBlock)
+									.AutoWrapText(true)
+									.Text(this, &SADumpEditorTab::GetAutoRedumpStatusText)
+								]
 							]
 						]
 						+ SVerticalBox::Slot()
@@ -536,8 +580,19 @@ void SADumpEditorTab::RefreshSelection()
 
 void SADumpEditorTab::RefreshRuntimeState()
 {
+	const int64 StateVersion = UADumpEditorApi::GetDumpStateVersion();
+	if (StateVersion == LastSeenStateVersion)
+	{
+		return;
+	}
+	LastSeenStateVersion = StateVersion;
+
 	bIsDumpRunning = UADumpEditorApi::IsDumpRunning();
-	ProgressPercent01 = UADumpEditorApi::GetDumpProgressPercent01();
+	// queue 실행 중에는 진행률 바가 현재 자산이 아니라 queue 전체 진행률을 보여 준다.
+	ProgressPercent01 = UADumpEditorApi::IsDumpQueueRunning()
+		? UADumpEditorApi::GetDumpQueueProgressPercent01()
+		: UADumpEditorApi::GetDumpProgressPercent01();
+	QueueSummaryText = UADumpEditorApi::GetDumpQueueSummaryText();
 	CurrentPhaseText = UADumpEditorApi::GetDumpPhaseText();
 	CurrentDetailText = UADumpEditorApi::GetDumpDetailText();
 	WarningCount = UADumpEditorApi::GetDumpWarningCount();
@@ -557,21 +612,58 @@ void SADumpEditorTab::RefreshRuntimeState()
 		StatusMessage = RuntimeStatusMessage;
 	}
 
-	const FString RuntimeLogText = UADumpEditorApi::GetDumpLogText();
-	if (!RuntimeLogText.IsEmpty())
-	{
-		LogText = RuntimeLogText;
-	}
+	RefreshLogText();
 }
 
-EActiveTimerReturnType SADumpEditorTab::HandleActiveTimerTick(double InCurrentTime, float InDeltaTime)
+void SADumpEditorTab::RefreshLogText()
 {
-	if (UADumpEditorApi::IsDumpRunning())
+	TArray<FString> NewLogLines;
+	int64 NextLogSequence = DisplayedLogNextSequence;
+	const bool bContiguous = UADumpEditorApi::GetDumpLogSince(DisplayedLogNextSequence, NewLogLines, NextLogSequence);
+	DisplayedLogNextSequence = NextLogSequence;
+	if (!bContiguous)
+	{
+		// 새 세션이거나 ring에서 밀려난 줄이 있으면 보존된 줄로 다시 그린다. 새 세션 직후 ring이 비어 있으면 패널도 비운다.
+		DisplayedLogLineCount = NewLogLines.Num();
+		SetLogText(FString::Join(NewLogLines, TEXT("\n")));
+		return;
+	}
+
+	if (NewLogLines.Num() <= 0)
+	{
+		return;
+	}
+
+	if (DisplayedLogLineCount + NewLogLines.Num() > MaxDisplayedLogLineCount)
 	{
-		FString TickMessage;
-		UADumpEditorApi::TickActiveDump(TickMessage);
+		// 표시 줄 수가 한도를 넘으면 최근 절반만 다시 가져와 패널 비용을 일정하게 유지한다.
+		TArray<FString> RecentLogLines;
+		UADumpEditorApi::GetDumpLogSince(NextLogSequence - MaxDisplayedLogLineCount / 2, RecentLogLines, DisplayedLogNextSequence);
+		DisplayedLogLineCount = RecentLogLines.Num();
+		SetLogText(FString::Join(RecentLogLines, TEXT("\n")));
+		return;
 	}
 
+	for (const FString& LogLine : NewLogLines)
+	{
+		if (!LogText.IsEmpty())
+		{
+			LogText.AppendChar(TEXT('\n'));
+		}
+		LogText.Append(LogLine);
+	}
+	DisplayedLogLineCount += NewLogLines.Num();
+	LogDisplayText = FText::FromString(LogText);
+}
+
+void SADumpEditorTab::SetLogText(const FString& InLogText)
+{
+	LogText = InLogText;
+	LogDisplayText = FText::FromString(LogText.IsEmpty() ? FString(TEXT("아직 기록된 로그가 없습니다.")) : LogText);
+}
+
+EActiveTimerReturnType SADumpEditorTab::HandleActiveTimerTick(double InCurrentTime, float InDeltaTime)
+{
 	RefreshRuntimeState();
 	return EActiveTimerReturnType::Continue;
 }
@@ -656,6 +748,53 @@ FReply SADumpEditorTab::HandleDumpOpenBlueprintClicked()
 	return FReply::Handled();
 }
 
+// HandleDumpSelectedAssetsClicked는 Content Browser 선택 에셋/폴더 전체를 현재 옵션으로 queue 덤프한다.
+FReply SADumpEditorTab::HandleDumpSelectedAssetsClicked()
+{
+	// SavedGraphNameFilterText는 queue 덤프에도 재사용할 그래프 이름 필터 스냅샷이다.
+	SavedGraphNameFilterText = GraphNameFilterTextBox.IsValid() ? GraphNameFilterTextBox->GetText().ToString() : FString();
+
+	// SavedLinkKindText는 queue 덤프에도 재사용할 링크 종류 스냅샷이다.
+	SavedLinkKindText = LinkKindTextBox.IsValid() ? LinkKindTextBox->GetText().ToString() : TEXT("all");
+	if (SavedLinkKindText.IsEmpty())
+	{
+		SavedLinkKindText = TEXT("all");
+	}
+	SaveUiOptions();
+
+	// QueueAssetObjectPaths는 선택 에셋과 선택 폴더 하위 에셋 경로 목록이다.
+	TArray<FString> QueueAssetObjectPaths;
+	FString DumpMessage;
+	if (!UADumpEditorApi::GetSelectedContentBrowserAssetPaths(QueueAssetObjectPaths, DumpMessage))
+	{
+		StatusMessage = DumpMessage;
+		RefreshRuntimeState();
+		return FReply::Handled();
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("%s StartDumpAssets Count=%d GraphFilter='%s' LinkKind='%s'"), DumpEditorTabLogPrefix, QueueAssetObjectPaths.Num(), *SavedGraphNameFilterText, *SavedLinkKindText);
+
+	if (UADumpEditorApi::StartDumpAssets(
+			QueueAssetObjectPaths,
+			bIncludeSummary,
+			bIncludeDetails,
+			bIncludeGraphs,
+			bIncludeReferences,
+			bCompileBeforeDump,
+			bSkipIfUpToDate,
+			SavedGraphNameFilterText,
+			bLinksOnly,
+			SavedLinkKindText,
+			DumpMessage))
+	{
+		bIsDumpRunning = true;
+	}
+
+	StatusMessage = DumpMessage;
+	RefreshRuntimeState();
+	return FReply::Handled();
+}
+
 FReply SADumpEditorTab::HandleCancelDumpClicked()
 {
 	UADumpEditorApi::CancelActiveDump();
@@ -803,6 +942,18 @@ ECheckBoxState SADumpEditorTab::GetLinksOnlyCheckState() const
 	return bLinksOnly ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
 }
 
+// HandleAutoRedumpCheckStateChanged는 자동 재덤프 opt-in을 바꾼다. 설정 저장은 자동 재덤프 쪽이 맡는다.
+void SADumpEditorTab::HandleAutoRedumpCheckStateChanged(ECheckBoxState InNewState)
+{
+	UADumpEditorApi::SetAutoRedumpOnSaveEnabled(InNewState == ECheckBoxState::Checked);
+}
+
+// GetAutoRedumpCheckState는 자동 재덤프 opt-in 체크 상태를 반환한다.
+ECheckBoxState SADumpEditorTab::GetAutoRedumpCheckState() const
+{
+	return UADumpEditorApi::IsAutoRedumpOnSaveEnabled() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
 FText SADumpEditorTab::GetSelectedAssetText() const
 {
 	if (SelectedAssetObjectPath.IsEmpty())
@@ -869,9 +1020,24 @@ FText SADumpEditorTab::GetLastExecutionMillisecondsText() const
 	return FText::FromString(FString::Printf(TEXT("마지막 실행 시간(ms): %lld"), LastExecutionMilliseconds));
 }
 
+FText SADumpEditorTab::GetQueueSummaryText() const
+{
+	return FText::FromString(QueueSummaryText);
+}
+
+EVisibility SADumpEditorTab::GetQueueSummaryVisibility() const
+{
+	return QueueSummaryText.IsEmpty() ? EVisibility::Collapsed : EVisibility::Visible;
+}
+
+FText SADumpEditorTab::GetAutoRedumpStatusText() const
+{
+	return FText::FromString(UADumpEditorApi::GetAutoRedumpStatusText());
+}
+
 FText SADumpEditorTab::GetLogText() const
 {
-	return FText::FromString(LogText.IsEmpty() ? FString(TEXT("아직 기록된 로그가 없습니다.")) : LogText);
+	return LogDisplayText;
 }
 
 bool SADumpEditorTab::IsDumpRunningEnabled() const
@@ -1,6 +1,8 @@
 // File: ADumpEntityEvidence.cpp
-// Version: v1.10.1
+// Version: v1.10.3
 // Changelog:
+// - v1.10.3: Entity/Relation kind registry 정의를 에디터 없이 빌드되는 AssetDumpQuery module의 ADumpEntityKinds로 옮김.
+// - v1.10.2: 결과에 미리 계산된 fingerprint가 있으면 재계산 없이 사용해 background thread 직렬화에서 UObject 접근을 없앰.
 // - v1.10.1: cross-process transient Niagara System asset_guid projection을 제거해 Entity repeat determinism을 복원.
 // - v1.10.0: AIRE Core Settings Coverage의 Niagara System/Emitter core settings를 기존 Entity facet data에 additive projection.
 // - v1.9.0: P5-MI v1 material_instance resource에 material_instance_detail_v1 auxiliary facet을 additive projection.
@@ -447,147 +449,17 @@ namespace
 
 namespace ADumpEntityEvidence
 {
-	const TArray<FString>& GetEntityKindRegistry()
-	{
-		static const TArray<FString> Registry = {
-			TEXT("asset"),
-			TEXT("blueprint_component"),
-			TEXT("blueprint_graph"),
-			TEXT("blueprint_graph_node"),
-			TEXT("blueprint_graph_pin")
-		};
-		return Registry;
-	}
-
-	const TArray<FString>& GetRelationKindRegistry()
-	{
-		static const TArray<FString> Registry = {
-			TEXT("owns"),
-			TEXT("contains"),
-			TEXT("attached_to"),
-			TEXT("executes_before"),
-			TEXT("data_flows_to")
-		};
-		return Registry;
-	}
-
-				const TArray<FString>& GetNiagaraEntityKindRegistry()
-	{
-		static const TArray<FString> Registry = {
-			TEXT("asset"),
-			TEXT("niagara_system"),
-			TEXT("niagara_emitter"),
-			TEXT("niagara_execution_group"),
-			TEXT("niagara_module"),
-			TEXT("niagara_module_input"),
-			TEXT("niagara_renderer"),
-			TEXT("niagara_parameter"),
-			TEXT("niagara_parameter_binding"),
-			TEXT("niagara_data_interface"),
-			TEXT("niagara_simulation_stage"),
-			TEXT("asset_reference")
-		};
-		return Registry;
-	}
-
-	const TArray<FString>& GetNiagaraRelationKindRegistry()
-	{
-		static const TArray<FString> Registry = {
-			TEXT("owns"),
-			TEXT("contains"),
-			TEXT("executes_before"),
-			TEXT("uses_script"),
-			TEXT("binds_to"),
-			TEXT("reads_attribute"),
-			TEXT("renders_with"),
-			TEXT("references"),
-			TEXT("inherits_from"),
-			TEXT("overrides")
-		};
-		return Registry;
-	}
-
-		const TArray<FString>& GetNiagaraDeepEntityKindRegistry()
-	{
-		static const TArray<FString> Registry = []
-		{
-			TArray<FString> Values = GetNiagaraEntityKindRegistry();
-			Values.Add(TEXT("niagara_dynamic_input"));
-			Values.Add(TEXT("niagara_static_switch"));
-			Values.Add(TEXT("niagara_rapid_iteration_value"));
-			Values.Add(TEXT("niagara_module_output"));
-			Values.Add(TEXT("niagara_parameter_read"));
-			Values.Add(TEXT("niagara_parameter_write"));
-			return Values;
-		}();
-		return Registry;
-	}
-
-	const TArray<FString>& GetNiagaraDeepRelationKindRegistry()
-	{
-		static const TArray<FString> Registry = []
-		{
-			TArray<FString> Values = GetNiagaraRelationKindRegistry();
-			Values.Add(TEXT("reads_parameter"));
-			Values.Add(TEXT("writes_parameter"));
-			return Values;
-		}();
-		return Registry;
-	}
-
-		const TArray<FString>& GetNiagaraMaterialEntityKindRegistry()
-	{
-		static const TArray<FString> Registry = []
-		{
-			TArray<FString> Values = GetNiagaraDeepEntityKindRegistry();
-			Values.Add(TEXT("niagara_renderer_resource"));
-			return Values;
-		}();
-		return Registry;
-	}
-
-	const TArray<FString>& GetNiagaraMaterialRelationKindRegistry()
-	{
-		return GetNiagaraDeepRelationKindRegistry();
-	}
-
-	const TArray<FString>& GetKnownEntityKindRegistry()
-	{
-		static const TArray<FString> Registry = []
-		{
-			TArray<FString> Values = GetEntityKindRegistry();
-						for (const FString& Kind : GetNiagaraMaterialEntityKindRegistry())
-			{
-				Values.AddUnique(Kind);
-			}
-			return Values;
-		}();
-		return Registry;
-	}
-
-		const TArray<FString>& GetKnownRelationKindRegistry()
-	{
-		static const TArray<FString> Registry = []
-		{
-			TArray<FString> Values = GetRelationKindRegistry();
-						for (const FString& Kind : GetNiagaraMaterialRelationKindRegistry())
-			{
-				Values.AddUnique(Kind);
-			}
-			return Values;
-		}();
-		return Registry;
-	}
-
 	TSharedRef<FJsonObject> BuildEntityEvidenceObject(const FADumpResult& InDumpResult)
 	{
 		const FString ObjectPath = InDumpResult.Asset.AssetObjectPath;
 		const FString SourceFile = FPaths::GetCleanFilename(InDumpResult.Request.OutputFilePath);
-		const FString Fingerprint = ADumpFingerprint::BuildAssetFingerprint(
-			ObjectPath,
-			InDumpResult.Request,
-			ADumpSchema::GetVersionText(),
-			ADumpSchema::GetExtractorVersionText());
+		const FString Fingerprint = !InDumpResult.PrecomputedFingerprint.IsEmpty()
+			? InDumpResult.PrecomputedFingerprint
+			: ADumpFingerprint::BuildAssetFingerprint(
+				ObjectPath,
+				InDumpResult.Request,
+				ADumpSchema::GetVersionText(),
+				ADumpSchema::GetExtractorVersionText());
 								const bool bBlueprintEvidenceSource = InDumpResult.Asset.AssetFamily.Contains(TEXT("Blueprint"), ESearchCase::IgnoreCase)
 			|| !InDumpResult.Graphs.IsEmpty()
 			|| !InDumpResult.ComponentTree.SchemaVersion.IsEmpty();
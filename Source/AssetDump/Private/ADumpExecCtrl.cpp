@@ -1,6 +1,14 @@
 // File: ADumpExecCtrl.cpp
-// Version: v0.3.3
+// Version: v0.9.1
 // Changelog:
+// - v0.9.1: 소멸자 대신 module 종료 때 부르는 Shutdown이 core ticker를 해제.
+// - v0.9.0: 탭 timer와 자동 재덤프 ticker 대신 전역 인스턴스의 core ticker 하나로 단계를 진행하고, 공개 TickDump는 호출마다 한 단계씩 진행.
+// - v0.8.1: queue 취소로 추출 전에 저장 없이 끝난 진행 중 자산을 실패가 아닌 취소로 집계.
+// - v0.8.0: ring buffer 구현을 FADumpLogRing으로 옮기고 컨트롤러는 위임만 하도록 정리.
+// - v0.7.0: 탭과 자동 재덤프 ticker가 함께 돌아도 frame budget이 한 번만 쓰이도록 같은 frame의 두 번째 TickDump를 건너뜀.
+// - v0.6.0: 다중 자산 queue 실행을 추가해 저장 중인 앞 자산 서비스를 분리하고 다음 자산 추출과 겹치며, 집계 진행률/ETA와 전체 취소를 스냅샷에 반영.
+// - v0.5.0: 스냅샷을 StartDump/TickDump/CancelDump 끝에서 한 번만 만들어 캐시하고, 로그를 고정 크기 ring buffer와 sequence delta 조회로 전환.
+// - v0.4.0: TickDump를 frame budget 단위 TickDumpSession으로 전환해 저장을 background task로 넘기고 스냅샷에 background 저장 여부를 채움.
 // - v0.3.3: 실제 세션 로그 저장 경로에서 writable default resolver를 사용해 read-only Plugin fallback을 유지.
 // - v0.3.2: 세션 로그 저장 경로를 Project Saved/BPDump/Logs에서 AssetDump 플러그인 Dumped/BPDump/logs로 변경.
 // - v0.3.1: 세션 로그 파일에 issue code/severity/phase를 함께 남겨 실패 원인 직접 검증 근거를 보강.
@@ -13,37 +21,150 @@
 #include "ADumpJson.h"
 
 #include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
 #include "Misc/DateTime.h"
 #include "Misc/FileHelper.h"
 #include "Misc/PackageName.h"
 #include "Misc/Paths.h"
 
+namespace
+{
+	// DumpFrameBudgetSeconds는 에디터 tick 한 번에 game thread 덤프 단계를 이어 실행할 최대 시간이다.
+	constexpr double DumpFrameBudgetSeconds = 0.008;
+
+	// MaxExecLogLineCount는 ring buffer가 보존할 최대 로그 줄 수다. 오래된 줄부터 밀려난다.
+	constexpr int32 MaxExecLogLineCount = 2000;
+
+	// MaxQueueOverlappedSaveCount는 queue에서 동시에 background 저장할 수 있는 앞 자산 수다. 결과 사본 메모리를 제한한다.
+	constexpr int32 MaxQueueOverlappedSaveCount = 2;
+
+	// IsQueueSuccessStatus는 queue 집계에서 성공으로 셀 dump 상태인지 판단한다.
+	bool IsQueueSuccessStatus(EADumpStatus InStatus)
+	{
+		return InStatus == EADumpStatus::Succeeded || InStatus == EADumpStatus::PartialSuccess;
+	}
+}
+
 FADumpExecCtrl& FADumpExecCtrl::Get()
 {
-	static FADumpExecCtrl Singleton;
+	static FADumpExecCtrl Singleton(true);
 	return Singleton;
 }
 
+FADumpExecCtrl::FADumpExecCtrl(bool bInTickOnCoreTicker)
+	: LogRing(MaxExecLogLineCount)
+	, bTickOnCoreTicker(bInTickOnCoreTicker)
+{
+	PublishSnapshot();
+}
+
+void FADumpExecCtrl::Shutdown()
+{
+	bTickOnCoreTicker = false;
+	if (CoreTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(CoreTickerHandle);
+		CoreTickerHandle.Reset();
+	}
+}
+
+void FADumpExecCtrl::RegisterCoreTicker()
+{
+	if (!bTickOnCoreTicker || CoreTickerHandle.IsValid())
+	{
+		return;
+	}
+
+	CoreTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FADumpExecCtrl::HandleCoreTick));
+}
+
+bool FADumpExecCtrl::HandleCoreTick(float InDeltaSeconds)
+{
+	if (bIsRunning)
+	{
+		FString TickMessage;
+		TickDump(TickMessage);
+	}
+
+	if (bIsRunning)
+	{
+		return true;
+	}
+
+	CoreTickerHandle.Reset();
+	return false;
+}
+
 bool FADumpExecCtrl::StartDump(const FADumpRunOpts& InRunOpts, FString& OutMessage)
 {
 	if (bIsRunning)
 	{
 		OutMessage = TEXT("이미 덤프가 실행 중입니다.");
 		AppendLogLine(OutMessage);
+		PublishSnapshot();
 		return false;
 	}
 
-	LogLines.Reset();
+	ResetLogRing();
+	bIsQueueRunning = false;
+	QueueRunOptsList.Reset();
 	if (!DumpService.BeginDumpSession(InRunOpts, OutMessage))
 	{
 		AppendLogLine(OutMessage);
+		PublishSnapshot();
 		return false;
 	}
 
 	ActiveRunOpts = InRunOpts;
 	bIsRunning = true;
+	RegisterCoreTicker();
 	AppendLogLine(TEXT("덤프 실행을 시작했습니다."));
 	AppendLogLine(OutMessage);
+	PublishSnapshot();
+	return true;
+}
+
+// StartDumpAssets는 여러 자산 실행 옵션을 queue로 받아 첫 자산 세션을 시작한다.
+bool FADumpExecCtrl::StartDumpAssets(const TArray<FADumpRunOpts>& InRunOptsList, FString& OutMessage)
+{
+	if (bIsRunning)
+	{
+		OutMessage = TEXT("이미 덤프가 실행 중입니다.");
+		AppendLogLine(OutMessage);
+		PublishSnapshot();
+		return false;
+	}
+
+	if (InRunOptsList.Num() <= 0)
+	{
+		OutMessage = TEXT("덤프할 자산이 없습니다.");
+		AppendLogLine(OutMessage);
+		PublishSnapshot();
+		return false;
+	}
+
+	ResetLogRing();
+	QueueRunOptsList = InRunOptsList;
+	QueueNextIndex = 0;
+	QueueCompletedCount = 0;
+	QueueSkippedCount = 0;
+	QueueFailedCount = 0;
+	QueueCanceledCount = 0;
+	QueueSavingServices.Reset();
+	QueueStartSeconds = FPlatformTime::Seconds();
+	bQueueCancelRequested = false;
+	bIsQueueRunning = true;
+	bIsRunning = true;
+	RegisterCoreTicker();
+	OutMessage = FString::Printf(TEXT("자산 %d개 덤프 queue를 시작했습니다."), QueueRunOptsList.Num());
+	AppendLogLine(OutMessage);
+
+	if (!StartNextQueuedAsset())
+	{
+		FinishQueue();
+	}
+
+	PublishSnapshot();
 	return true;
 }
 
@@ -55,7 +176,14 @@ bool FADumpExecCtrl::TickDump(FString& OutMessage)
 		return false;
 	}
 
-	const bool bStepSucceeded = DumpService.ExecuteNextStep(OutMessage);
+	if (bIsQueueRunning)
+	{
+		const bool bQueueStepSucceeded = TickQueue(OutMessage);
+		PublishSnapshot();
+		return bQueueStepSucceeded;
+	}
+
+	const bool bStepSucceeded = DumpService.TickDumpSession(DumpFrameBudgetSeconds, OutMessage);
 	if (!OutMessage.IsEmpty())
 	{
 		AppendLogLine(OutMessage);
@@ -91,6 +219,7 @@ bool FADumpExecCtrl::TickDump(FString& OutMessage)
 		AppendLogLine(LogFileMessage);
 	}
 
+	PublishSnapshot();
 	return bStepSucceeded;
 }
 
@@ -99,11 +228,167 @@ void FADumpExecCtrl::CancelDump()
 	if (!bIsRunning)
 	{
 		AppendLogLine(TEXT("취소할 실행 중 덤프가 없습니다."));
+		PublishSnapshot();
+		return;
+	}
+
+	if (bIsQueueRunning)
+	{
+		if (!bQueueCancelRequested)
+		{
+			bQueueCancelRequested = true;
+			QueueCanceledCount = QueueRunOptsList.Num() - QueueNextIndex;
+			QueueNextIndex = QueueRunOptsList.Num();
+			AppendLogLine(FString::Printf(TEXT("queue 전체 취소를 요청했습니다. 시작하지 않은 자산 %d개를 건너뜁니다."), QueueCanceledCount));
+		}
+
+		if (DumpService.IsSessionActive())
+		{
+			DumpService.CancelDump();
+		}
+		PublishSnapshot();
 		return;
 	}
 
 	DumpService.CancelDump();
 	AppendLogLine(TEXT("덤프 취소를 요청했습니다."));
+	PublishSnapshot();
+}
+
+bool FADumpExecCtrl::TickQueue(FString& OutMessage)
+{
+	OutMessage.Reset();
+	PollQueueSavingServices();
+
+	bool bStepSucceeded = true;
+	if (DumpService.IsSessionActive())
+	{
+		bStepSucceeded = DumpService.TickDumpSession(DumpFrameBudgetSeconds, OutMessage);
+		if (!OutMessage.IsEmpty())
+		{
+			AppendLogLine(OutMessage);
+		}
+
+		if (!DumpService.IsSessionActive())
+		{
+			RecordQueueOutcome(DumpService);
+		}
+		else if (DumpService.IsBackgroundSaveInFlight() && QueueSavingServices.Num() < MaxQueueOverlappedSaveCount)
+		{
+			// 저장만 남은 세션은 분리해 두고 다음 자산 추출을 같은 tick부터 시작한다.
+			QueueSavingServices.Add(MakeUnique<FADumpService>(MoveTemp(DumpService)));
+			DumpService = FADumpService();
+		}
+	}
+
+	if (!DumpService.IsSessionActive() && !bQueueCancelRequested)
+	{
+		StartNextQueuedAsset();
+	}
+
+	if (!DumpService.IsSessionActive() && QueueSavingServices.Num() <= 0 && QueueNextIndex >= QueueRunOptsList.Num())
+	{
+		FinishQueue();
+	}
+
+	return bStepSucceeded;
+}
+
+void FADumpExecCtrl::PollQueueSavingServices()
+{
+	for (int32 SavingIndex = QueueSavingServices.Num() - 1; SavingIndex >= 0; --SavingIndex)
+	{
+		FADumpService& SavingService = *QueueSavingServices[SavingIndex];
+		if (SavingService.IsBackgroundSaveInFlight())
+		{
+			continue;
+		}
+
+		FString SaveMessage;
+		SavingService.TickDumpSession(DumpFrameBudgetSeconds, SaveMessage);
+		RecordQueueOutcome(SavingService);
+		QueueSavingServices.RemoveAt(SavingIndex);
+	}
+}
+
+bool FADumpExecCtrl::StartNextQueuedAsset()
+{
+	while (QueueNextIndex < QueueRunOptsList.Num())
+	{
+		const int32 QueueIndex = QueueNextIndex++;
+		ActiveRunOpts = QueueRunOptsList[QueueIndex];
+
+		FString BeginMessage;
+		if (DumpService.BeginDumpSession(ActiveRunOpts, BeginMessage))
+		{
+			AppendLogLine(FString::Printf(TEXT("[%d/%d] %s 덤프를 시작했습니다."), QueueIndex + 1, QueueRunOptsList.Num(), *ActiveRunOpts.AssetObjectPath));
+			return true;
+		}
+
+		++QueueCompletedCount;
+		++QueueFailedCount;
+		AppendLogLine(FString::Printf(TEXT("[%d/%d] %s 덤프를 시작하지 못했습니다: %s"), QueueIndex + 1, QueueRunOptsList.Num(), *ActiveRunOpts.AssetObjectPath, *BeginMessage));
+	}
+
+	return false;
+}
+
+void FADumpExecCtrl::RecordQueueOutcome(const FADumpService& InFinishedService)
+{
+	// 취소 요청으로 아무것도 저장하지 못하고 끝난 세션은 실패가 아니라 시작하지 않은 자산과 같은 취소로 센다.
+	if (InFinishedService.IsCancelRequested() && !IsQueueSuccessStatus(InFinishedService.GetActiveResult().DumpStatus))
+	{
+		++QueueCanceledCount;
+		AppendLogLine(FString::Printf(
+			TEXT("[취소] %s: %s"),
+			*InFinishedService.GetActiveAssetObjectPath(),
+			*InFinishedService.GetStatusMessage()));
+		return;
+	}
+
+	++QueueCompletedCount;
+
+	// OutcomeLabel은 queue 로그에 남길 자산별 결과 구분이다.
+	const TCHAR* OutcomeLabel = TEXT("실패");
+	if (InFinishedService.WasSkippedUpToDate())
+	{
+		++QueueSkippedCount;
+		OutcomeLabel = TEXT("최신이라 건너뜀");
+	}
+	else if (IsQueueSuccessStatus(InFinishedService.GetActiveResult().DumpStatus))
+	{
+		OutcomeLabel = ToString(InFinishedService.GetActiveResult().DumpStatus);
+	}
+	else
+	{
+		++QueueFailedCount;
+	}
+
+	AppendLogLine(FString::Printf(
+		TEXT("[완료 %d/%d] %s: %s (%s)"),
+		QueueCompletedCount,
+		QueueRunOptsList.Num(),
+		*InFinishedService.GetActiveAssetObjectPath(),
+		OutcomeLabel,
+		*InFinishedService.GetStatusMessage()));
+}
+
+void FADumpExecCtrl::FinishQueue()
+{
+	LastExecutionMilliseconds = FMath::RoundToInt64((FPlatformTime::Seconds() - QueueStartSeconds) * 1000.0);
+	bIsRunning = false;
+	bIsQueueRunning = false;
+	AppendLogLine(FString::Printf(
+		TEXT("덤프 queue가 종료되었습니다. 전체 %d, 완료 %d, 건너뜀 %d, 실패 %d, 취소 %d"),
+		QueueRunOptsList.Num(),
+		QueueCompletedCount,
+		QueueSkippedCount,
+		QueueFailedCount,
+		QueueCanceledCount));
+
+	FString LogFileMessage;
+	WriteSessionLogFile(LogFileMessage);
+	AppendLogLine(LogFileMessage);
 }
 
 // RetryLastFailedDump는 마지막 failed 실행 옵션으로 새 덤프 세션을 다시 시작한다.
@@ -113,6 +398,7 @@ bool FADumpExecCtrl::RetryLastFailedDump(FString& OutMessage)
 	{
 		OutMessage = TEXT("이미 덤프가 실행 중이라 마지막 실패를 재시도할 수 없습니다.");
 		AppendLogLine(OutMessage);
+		PublishSnapshot();
 		return false;
 	}
 
@@ -120,6 +406,7 @@ bool FADumpExecCtrl::RetryLastFailedDump(FString& OutMessage)
 	{
 		OutMessage = TEXT("재시도할 마지막 실패 실행 정보가 없습니다.");
 		AppendLogLine(OutMessage);
+		PublishSnapshot();
 		return false;
 	}
 
@@ -131,19 +418,88 @@ bool FADumpExecCtrl::IsRunning() const
 	return bIsRunning;
 }
 
-FADumpExecSnapshot FADumpExecCtrl::GetSnapshot() const
+const FADumpExecSnapshot& FADumpExecCtrl::GetSnapshot() const
 {
-	return BuildSnapshot();
+	return CachedSnapshot;
 }
 
-void FADumpExecCtrl::AppendLogLine(const FString& InLine)
+FADumpLogRing::FADumpLogRing(int32 InCapacity)
+	: Capacity(FMath::Max(1, InCapacity))
+{
+}
+
+void FADumpLogRing::Append(const FString& InLine)
 {
 	if (InLine.IsEmpty())
 	{
 		return;
 	}
 
-	LogLines.Add(InLine);
+	if (Lines.Num() < Capacity)
+	{
+		Lines.Add(InLine);
+	}
+	else
+	{
+		Lines[static_cast<int32>((NextSequence - BaseSequence) % Capacity)] = InLine;
+		++FirstSequence;
+	}
+	++NextSequence;
+}
+
+void FADumpLogRing::Reset()
+{
+	// 세션 경계에서 sequence 하나를 건너뛰어 이전 세션 기준 delta 요청이 전체 다시 그리기로 이어지게 한다.
+	++NextSequence;
+	Lines.Reset();
+	BaseSequence = NextSequence;
+	FirstSequence = NextSequence;
+}
+
+bool FADumpLogRing::GetSince(int64 InSequence, TArray<FString>& OutLines, int64& OutNextSequence) const
+{
+	OutNextSequence = NextSequence;
+
+	// bContiguous는 요청 sequence부터 ring에 빠짐없이 남아 있는지 여부다. 아니면 보존된 줄 전체로 다시 그리게 한다.
+	const bool bContiguous = InSequence >= FirstSequence && InSequence <= NextSequence;
+	const int64 StartSequence = bContiguous ? InSequence : FirstSequence;
+	OutLines.Reserve(OutLines.Num() + static_cast<int32>(NextSequence - StartSequence));
+	for (int64 Sequence = StartSequence; Sequence < NextSequence; ++Sequence)
+	{
+		OutLines.Add(Lines[static_cast<int32>((Sequence - BaseSequence) % Capacity)]);
+	}
+
+	return bContiguous;
+}
+
+bool FADumpExecCtrl::GetLogSince(int64 InSequence, TArray<FString>& OutLines, int64& OutNextSequence) const
+{
+	return LogRing.GetSince(InSequence, OutLines, OutNextSequence);
+}
+
+FString FADumpExecCtrl::BuildLogText() const
+{
+	TArray<FString> RetainedLines;
+	int64 IgnoredNextSequence = 0;
+	LogRing.GetSince(LogRing.GetFirstSequence(), RetainedLines, IgnoredNextSequence);
+	return FString::Join(RetainedLines, TEXT("\n"));
+}
+
+void FADumpExecCtrl::AppendLogLine(const FString& InLine)
+{
+	LogRing.Append(InLine);
+}
+
+void FADumpExecCtrl::ResetLogRing()
+{
+	LogRing.Reset();
+}
+
+void FADumpExecCtrl::PublishSnapshot()
+{
+	const uint64 PreviousVersion = CachedSnapshot.SnapshotVersion;
+	CachedSnapshot = BuildSnapshot();
+	CachedSnapshot.SnapshotVersion = PreviousVersion + 1;
 }
 
 // BuildIssueLinesText는 현재 세션 결과의 issue 배열을 로그 파일용 문자열로 정리한다.
@@ -221,8 +577,11 @@ FString FADumpExecCtrl::BuildLogFileText() const
 	// IssueText는 issue code/severity/phase를 포함한 직접 검증용 문자열 블록이다.
 	const FString IssueText = BuildIssueLinesText(ResultSnapshot.Issues);
 
-	// LogBodyText는 UI 로그 패널 누적 줄을 파일용 본문 문자열로 합친 결과다.
-	const FString LogBodyText = FString::Join(LogLines, TEXT("\n"));
+	// LogBodyText는 ring에 남은 로그 줄을 파일용 본문 문자열로 합친 결과다. 밀려난 줄이 있으면 생략 수를 앞에 적는다.
+	const int64 DroppedLineCount = LogRing.GetDroppedLineCount();
+	const FString LogBodyText = DroppedLineCount > 0
+		? FString::Printf(TEXT("(앞선 로그 %lld줄 생략)\n%s"), DroppedLineCount, *BuildLogText())
+		: BuildLogText();
 	return FString::Printf(
 		TEXT("Status: %s\nOutput: %s\nWarnings: %d\nErrors: %d\nIssues:\n%s\n\n%s\n"),
 		*DumpService.GetStatusMessage(),
@@ -266,8 +625,41 @@ FADumpExecSnapshot FADumpExecCtrl::BuildSnapshot() const
 	Snapshot.ErrorCount = DumpService.GetErrorCount();
 	Snapshot.ResolvedOutputFilePath = DumpService.GetResolvedOutputFilePath();
 	Snapshot.StatusMessage = DumpService.GetStatusMessage();
-	Snapshot.LogText = FString::Join(LogLines, TEXT("\n"));
+	Snapshot.NextLogSequence = LogRing.GetNextSequence();
 	Snapshot.bHasLastFailedRun = bHasLastFailedRunOpts;
 	Snapshot.LastExecutionMilliseconds = LastExecutionMilliseconds;
+	Snapshot.bIsSavingInBackground = DumpService.IsBackgroundSaveInFlight() || QueueSavingServices.Num() > 0;
+	Snapshot.bIsQueueRunning = bIsQueueRunning;
+	if (bIsQueueRunning || QueueRunOptsList.Num() > 0)
+	{
+		Snapshot.QueueTotalCount = QueueRunOptsList.Num();
+		Snapshot.QueueCompletedCount = QueueCompletedCount;
+		Snapshot.QueueSkippedCount = QueueSkippedCount;
+		Snapshot.QueueFailedCount = QueueFailedCount;
+		Snapshot.QueueCanceledCount = QueueCanceledCount;
+		Snapshot.QueueSavingCount = QueueSavingServices.Num();
+
+		// InFlightUnits는 진행 중 자산의 단계 진행률과 저장 중 자산의 저장 단계 진행률을 더한 부분 완료량이다.
+		double InFlightUnits = DumpService.IsSessionActive() ? Snapshot.ProgressState.Percent01 : 0.0;
+		for (const TUniquePtr<FADumpService>& SavingService : QueueSavingServices)
+		{
+			InFlightUnits += SavingService->GetProgressSnapshot().Percent01;
+		}
+
+		// ActiveTotalCount는 취소로 시작하지 않은 자산을 뺀 실제 처리 대상 수다.
+		const int32 ActiveTotalCount = FMath::Max(1, Snapshot.QueueTotalCount - QueueCanceledCount);
+		Snapshot.QueueProgress01 = FMath::Clamp((QueueCompletedCount + InFlightUnits) / ActiveTotalCount, 0.0, 1.0);
+		Snapshot.bCanCancel = bIsQueueRunning && !bQueueCancelRequested;
+
+		const double ElapsedSeconds = FPlatformTime::Seconds() - QueueStartSeconds;
+		if (bIsQueueRunning && Snapshot.QueueProgress01 > 0.0)
+		{
+			Snapshot.QueueEtaSeconds = ElapsedSeconds * (1.0 - Snapshot.QueueProgress01) / Snapshot.QueueProgress01;
+		}
+		else if (!bIsQueueRunning)
+		{
+			Snapshot.QueueEtaSeconds = 0.0;
+		}
+	}
 	return Snapshot;
 }
@@ -1,6 +1,8 @@
 // File: ADumpFingerprint.cpp
-// Version: v0.10.0
+// Version: v0.10.2
 // Changelog:
+// - v0.10.2: manifest sidecar가 dump pack 안에만 있어도 기존 fingerprint를 읽도록 존재 검사를 변경.
+// - v0.10.1: gzip으로 저장된 manifest sidecar도 해제해 기존 fingerprint를 읽도록 수정.
 // - v0.10.0: bp_search_index_v1 schema와 symbol bounds를 fingerprint에 반영.
 // - v0.9.0: execution_path_preview_v1과 고정 bounds를 options fingerprint에 반영.
 // - v0.8.0: graph_node_role_v1 스키마 토큰을 options fingerprint에 반영.
@@ -16,6 +18,7 @@
 // - v0.1.0: 2차 개선 Phase 2 기준으로 options hash, asset fingerprint, manifest fingerprint 조회 helper를 추가.
 
 #include "ADumpFingerprint.h"
+#include "ADumpJson.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "Engine/Blueprint.h"
@@ -293,14 +296,14 @@ namespace ADumpFingerprint
 	{
 		OutFingerprint.Reset();
 		OutManifestFilePath = BuildManifestFilePath(InOutputFilePath);
-		if (!IFileManager::Get().FileExists(*OutManifestFilePath))
+		if (!ADumpJson::DoesJsonFileExist(OutManifestFilePath))
 		{
 			return false;
 		}
 
-		// ManifestJsonText는 기존 manifest.json 원문이다.
+		// ManifestJsonText는 기존 manifest.json 원문이다. gzip sidecar면 해제한 본문이다.
 		FString ManifestJsonText;
-		if (!FFileHelper::LoadFileToString(ManifestJsonText, *OutManifestFilePath))
+		if (!ADumpJson::LoadJsonTextFromFile(OutManifestFilePath, ManifestJsonText))
 		{
 			return false;
 		}
@@ -0,0 +1,859 @@
+// File: ADumpImpactGraph.cpp
+// Version: v1.0.2
+// Changelog:
+// - v1.0.2: 전용 static lock/map 대신 ADumpQueryIO::TStampedFileCache로 decode한 graph를 재사용.
+// - v1.0.1: decode한 impact_index_v1을 파일 stamp별로 process cache에 두어 query와 page마다 전체 index를 다시 읽고 CSR을 복원하지 않음.
+// - v1.0.0: iterative Tarjan SCC condensation, block bitset closure count, compact impact_index_v1과 -Mode=impact를 구현.
+// Migration:
+// - node ordinal은 dependency_index relation endpoint object_path의 case-sensitive 오름차순이다.
+// - closure count는 index 생성 시 확정되며 member 목록만 query 시 condensed DAG walk로 계산한다.
+
+#include "ADumpImpactGraph.h"
+
+#include "ADumpJson.h"
+
+#include "Algo/BinarySearch.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	// ImpactIndexFileName은 dump root 아래 전역 impact index 파일 이름이다.
+	const TCHAR* ImpactIndexFileName = TEXT("impact_index.json");
+
+	// ImpactClosureBlockWords는 closure 계산 한 block의 SCC row word 수다. 2048 node column을 한 번에 처리한다.
+	constexpr int32 ImpactClosureBlockWords = 32;
+
+	// FImpactTarjanFrame은 재귀 없는 Tarjan DFS의 호출 frame이다.
+	struct FImpactTarjanFrame
+	{
+		int32 Node = INDEX_NONE;
+		int32 EdgeCursor = 0;
+	};
+
+	// FLoadedImpactIndex는 decode된 impact_index_v1이다.
+	struct FLoadedImpactIndex
+	{
+		FString GeneratedTime;
+		TArray<FString> Nodes;
+		FADumpImpactGraph Graph;
+	};
+
+	// BuildImpactCsr는 (from, to) edge 목록에서 from 기준 CSR을 만든다.
+	void BuildImpactCsr(
+		int32 InVertexCount,
+		const TArray<TPair<int32, int32>>& InEdges,
+		bool bInReverse,
+		TArray<int32>& OutOffsets,
+		TArray<int32>& OutTargets)
+	{
+		OutOffsets.Init(0, InVertexCount + 1);
+		for (const TPair<int32, int32>& Edge : InEdges)
+		{
+			++OutOffsets[(bInReverse ? Edge.Value : Edge.Key) + 1];
+		}
+		for (int32 Vertex = 0; Vertex < InVertexCount; ++Vertex)
+		{
+			OutOffsets[Vertex + 1] += OutOffsets[Vertex];
+		}
+		OutTargets.SetNumUninitialized(InEdges.Num());
+		TArray<int32> Cursor(OutOffsets.GetData(), InVertexCount);
+		for (const TPair<int32, int32>& Edge : InEdges)
+		{
+			const int32 From = bInReverse ? Edge.Value : Edge.Key;
+			OutTargets[Cursor[From]++] = bInReverse ? Edge.Key : Edge.Value;
+		}
+	}
+
+	// ComputeTarjanScc는 iterative Tarjan으로 node별 SCC id를 완료 순서대로 부여한다.
+	int32 ComputeTarjanScc(
+		int32 InNodeCount,
+		const TArray<int32>& InOffsets,
+		const TArray<int32>& InTargets,
+		TArray<int32>& OutNodeScc)
+	{
+		OutNodeScc.Init(INDEX_NONE, InNodeCount);
+		TArray<int32> VisitIndex;
+		VisitIndex.Init(INDEX_NONE, InNodeCount);
+		TArray<int32> LowLink;
+		LowLink.SetNumZeroed(InNodeCount);
+		TBitArray<> OnStack(false, InNodeCount);
+		TArray<int32> SccStack;
+		TArray<FImpactTarjanFrame> CallStack;
+		int32 NextVisitIndex = 0;
+		int32 SccCount = 0;
+
+		auto PushNode = [&](int32 InNode)
+		{
+			VisitIndex[InNode] = NextVisitIndex;
+			LowLink[InNode] = NextVisitIndex;
+			++NextVisitIndex;
+			SccStack.Add(InNode);
+			OnStack[InNode] = true;
+			FImpactTarjanFrame& Frame = CallStack.AddDefaulted_GetRef();
+			Frame.Node = InNode;
+			Frame.EdgeCursor = InOffsets[InNode];
+		};
+
+		for (int32 StartNode = 0; StartNode < InNodeCount; ++StartNode)
+		{
+			if (VisitIndex[StartNode] != INDEX_NONE)
+			{
+				continue;
+			}
+			PushNode(StartNode);
+			while (!CallStack.IsEmpty())
+			{
+				const int32 FrameIndex = CallStack.Num() - 1;
+				const int32 Node = CallStack[FrameIndex].Node;
+				if (CallStack[FrameIndex].EdgeCursor < InOffsets[Node + 1])
+				{
+					const int32 Target = InTargets[CallStack[FrameIndex].EdgeCursor++];
+					if (VisitIndex[Target] == INDEX_NONE)
+					{
+						PushNode(Target);
+					}
+					else if (OnStack[Target])
+					{
+						LowLink[Node] = FMath::Min(LowLink[Node], VisitIndex[Target]);
+					}
+					continue;
+				}
+
+				if (LowLink[Node] == VisitIndex[Node])
+				{
+					int32 Member = INDEX_NONE;
+					do
+					{
+						Member = SccStack.Pop(EAllowShrinking::No);
+						OnStack[Member] = false;
+						OutNodeScc[Member] = SccCount;
+					}
+					while (Member != Node);
+					++SccCount;
+				}
+				CallStack.Pop(EAllowShrinking::No);
+				if (!CallStack.IsEmpty())
+				{
+					const int32 ParentNode = CallStack.Last().Node;
+					LowLink[ParentNode] = FMath::Min(LowLink[ParentNode], LowLink[Node]);
+				}
+			}
+		}
+		return SccCount;
+	}
+
+	// ComputeClosureCounts는 SCC 처리 순서대로 block bitset row를 OR 전파해 SCC별 도달 node 수를 누적한다.
+	void ComputeClosureCounts(
+		const FADumpImpactGraph& InGraph,
+		bool bInDependents,
+		TArray<int32>& OutCounts)
+	{
+		const int32 SccCount = InGraph.SccCount;
+		const TArray<int32>& Offsets = bInDependents ? InGraph.DagReverseOffsets : InGraph.DagForwardOffsets;
+		const TArray<int32>& Targets = bInDependents ? InGraph.DagReverseTargets : InGraph.DagForwardTargets;
+		constexpr int32 BlockBits = ImpactClosureBlockWords * 64;
+
+		OutCounts.Init(0, SccCount);
+		TArray<uint64> Rows;
+		Rows.SetNumUninitialized(SccCount * ImpactClosureBlockWords);
+		for (int32 BlockStart = 0; BlockStart < InGraph.NodeCount; BlockStart += BlockBits)
+		{
+			FMemory::Memzero(Rows.GetData(), Rows.Num() * sizeof(uint64));
+			for (int32 Step = 0; Step < SccCount; ++Step)
+			{
+				// dependency edge는 큰 SCC id에서 작은 id로 향하므로 dependencies는 오름차순, dependents는 내림차순으로 처리한다.
+				const int32 Scc = bInDependents ? SccCount - 1 - Step : Step;
+				uint64* Row = Rows.GetData() + Scc * ImpactClosureBlockWords;
+				for (int32 MemberIndex = InGraph.SccMemberOffsets[Scc]; MemberIndex < InGraph.SccMemberOffsets[Scc + 1]; ++MemberIndex)
+				{
+					const int32 Bit = InGraph.SccMembers[MemberIndex] - BlockStart;
+					if (Bit >= 0 && Bit < BlockBits)
+					{
+						Row[Bit >> 6] |= 1ull << (Bit & 63);
+					}
+				}
+				for (int32 EdgeIndex = Offsets[Scc]; EdgeIndex < Offsets[Scc + 1]; ++EdgeIndex)
+				{
+					const uint64* TargetRow = Rows.GetData() + Targets[EdgeIndex] * ImpactClosureBlockWords;
+					for (int32 Word = 0; Word < ImpactClosureBlockWords; ++Word)
+					{
+						Row[Word] |= TargetRow[Word];
+					}
+				}
+				int32 BlockCount = 0;
+				for (int32 Word = 0; Word < ImpactClosureBlockWords; ++Word)
+				{
+					BlockCount += static_cast<int32>(FMath::CountBits(Row[Word]));
+				}
+				OutCounts[Scc] += BlockCount;
+			}
+		}
+
+		// closure row는 자기 자신을 포함하므로 member 하나 기준 count로 보정한다.
+		for (int32& Count : OutCounts)
+		{
+			Count = FMath::Max(0, Count - 1);
+		}
+	}
+
+	// SerializeCondensedImpactJson은 on-disk 크기를 줄이기 위해 JSON object를 condensed text로 직렬화한다.
+	bool SerializeCondensedImpactJson(const TSharedRef<FJsonObject>& InRootObject, FString& OutJsonText)
+	{
+		OutJsonText.Reset();
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutJsonText);
+		return FJsonSerializer::Serialize(InRootObject, Writer);
+	}
+
+	// SerializeImpactResultJson은 JSON object를 stable pretty JSON text로 직렬화한다.
+	bool SerializeImpactResultJson(const TSharedRef<FJsonObject>& InRootObject, FString& OutJsonText)
+	{
+		OutJsonText.Reset();
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJsonText);
+		return FJsonSerializer::Serialize(InRootObject, Writer);
+	}
+
+	// LoadImpactJsonObject는 UTF-8 JSON 파일을 object로 읽는다.
+	bool LoadImpactJsonObject(const FString& InFilePath, TSharedPtr<FJsonObject>& OutRootObject)
+	{
+		OutRootObject.Reset();
+		FString JsonText;
+		if (!FFileHelper::LoadFileToString(JsonText, *InFilePath))
+		{
+			return false;
+		}
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
+		return FJsonSerializer::Deserialize(Reader, OutRootObject) && OutRootObject.IsValid();
+	}
+
+	// GetImpactStringField는 없거나 type이 다른 string field를 빈 문자열로 처리한다.
+	FString GetImpactStringField(const TSharedPtr<FJsonObject>& InObject, const TCHAR* InFieldName)
+	{
+		FString Value;
+		if (InObject.IsValid())
+		{
+			InObject->TryGetStringField(InFieldName, Value);
+		}
+		return Value;
+	}
+
+	// MakeImpactIntArrayValues는 정수 배열을 JSON number array로 변환한다.
+	TArray<TSharedPtr<FJsonValue>> MakeImpactIntArrayValues(const TArray<int32>& InValues)
+	{
+		TArray<TSharedPtr<FJsonValue>> JsonValues;
+		JsonValues.Reserve(InValues.Num());
+		for (const int32 Value : InValues)
+		{
+			JsonValues.Add(MakeShared<FJsonValueNumber>(Value));
+		}
+		return JsonValues;
+	}
+
+	// TryReadImpactIntArray는 JSON number array field를 정수 배열로 읽는다.
+	bool TryReadImpactIntArray(const TSharedPtr<FJsonObject>& InObject, const TCHAR* InFieldName, TArray<int32>& OutValues)
+	{
+		OutValues.Reset();
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		if (!InObject.IsValid() || !InObject->TryGetArrayField(InFieldName, Values) || !Values)
+		{
+			return false;
+		}
+		OutValues.Reserve(Values->Num());
+		for (const TSharedPtr<FJsonValue>& Value : *Values)
+		{
+			double Number = 0.0;
+			if (!Value.IsValid() || !Value->TryGetNumber(Number))
+			{
+				return false;
+			}
+			OutValues.Add(FMath::RoundToInt(Number));
+		}
+		return true;
+	}
+
+	// NormalizeImpactDumpRoot는 dump root를 절대 normalized directory로 변환한다.
+	FString NormalizeImpactDumpRoot(const FString& InDumpRootPath)
+	{
+		FString NormalizedPath = FPaths::ConvertRelativePathToFull(InDumpRootPath);
+		FPaths::NormalizeDirectoryName(NormalizedPath);
+		return NormalizedPath;
+	}
+
+	// GetImpactOptionValue는 -Key=Value command option을 읽는다.
+	FString GetImpactOptionValue(const FString& InCommandLine, const TCHAR* InKey)
+	{
+		FString Value;
+		FParse::Value(*InCommandLine, InKey, Value);
+		Value.TrimStartAndEndInline();
+		return Value;
+	}
+
+	// GetImpactIntegerOption은 정수 command option 또는 기본값을 반환한다.
+	int32 GetImpactIntegerOption(const FString& InCommandLine, const TCHAR* InKey, int32 InDefaultValue)
+	{
+		int32 Value = InDefaultValue;
+		FParse::Value(*InCommandLine, InKey, Value);
+		return Value;
+	}
+
+	// IsMonotonicCsr는 CSR offset 배열이 길이와 단조 증가 조건을 만족하는지 확인한다.
+	bool IsMonotonicCsr(const TArray<int32>& InOffsets, int32 InVertexCount, int32 InTargetCount)
+	{
+		if (InOffsets.Num() != InVertexCount + 1 || InOffsets[0] != 0 || InOffsets.Last() != InTargetCount)
+		{
+			return false;
+		}
+		for (int32 Index = 1; Index < InOffsets.Num(); ++Index)
+		{
+			if (InOffsets[Index] < InOffsets[Index - 1])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// TryDecodeImpactIndex는 impact_index_v1 root를 검증하고 query용 graph로 복원한다.
+	bool TryDecodeImpactIndex(const TSharedPtr<FJsonObject>& InRootObject, FLoadedImpactIndex& OutIndex)
+	{
+		OutIndex = FLoadedImpactIndex();
+		OutIndex.GeneratedTime = GetImpactStringField(InRootObject, TEXT("generated_time"));
+
+		const TArray<TSharedPtr<FJsonValue>>* NodeValues = nullptr;
+		if (!InRootObject->TryGetArrayField(TEXT("nodes"), NodeValues) || !NodeValues)
+		{
+			return false;
+		}
+		OutIndex.Nodes.Reserve(NodeValues->Num());
+		for (const TSharedPtr<FJsonValue>& NodeValue : *NodeValues)
+		{
+			FString ObjectPath;
+			if (!NodeValue.IsValid() || !NodeValue->TryGetString(ObjectPath))
+			{
+				return false;
+			}
+			if (!OutIndex.Nodes.IsEmpty() && OutIndex.Nodes.Last().Compare(ObjectPath, ESearchCase::CaseSensitive) >= 0)
+			{
+				return false;
+			}
+			OutIndex.Nodes.Add(MoveTemp(ObjectPath));
+		}
+
+		FADumpImpactGraph& Graph = OutIndex.Graph;
+		Graph.NodeCount = OutIndex.Nodes.Num();
+		if (!TryReadImpactIntArray(InRootObject, TEXT("node_scc"), Graph.NodeScc)
+			|| !TryReadImpactIntArray(InRootObject, TEXT("scc_dependency_counts"), Graph.DependencyCounts)
+			|| !TryReadImpactIntArray(InRootObject, TEXT("scc_dependent_counts"), Graph.DependentCounts)
+			|| !TryReadImpactIntArray(InRootObject, TEXT("dag_offsets"), Graph.DagForwardOffsets)
+			|| !TryReadImpactIntArray(InRootObject, TEXT("dag_targets"), Graph.DagForwardTargets))
+		{
+			return false;
+		}
+		Graph.SccCount = Graph.DependencyCounts.Num();
+		if (Graph.NodeScc.Num() != Graph.NodeCount
+			|| Graph.DependentCounts.Num() != Graph.SccCount
+			|| !IsMonotonicCsr(Graph.DagForwardOffsets, Graph.SccCount, Graph.DagForwardTargets.Num()))
+		{
+			return false;
+		}
+
+		TArray<TPair<int32, int32>> MemberPairs;
+		MemberPairs.Reserve(Graph.NodeCount);
+		for (int32 Node = 0; Node < Graph.NodeCount; ++Node)
+		{
+			if (Graph.NodeScc[Node] < 0 || Graph.NodeScc[Node] >= Graph.SccCount)
+			{
+				return false;
+			}
+			MemberPairs.Emplace(Graph.NodeScc[Node], Node);
+		}
+		BuildImpactCsr(Graph.SccCount, MemberPairs, false, Graph.SccMemberOffsets, Graph.SccMembers);
+
+		TArray<TPair<int32, int32>> DagEdges;
+		DagEdges.Reserve(Graph.DagForwardTargets.Num());
+		for (int32 Scc = 0; Scc < Graph.SccCount; ++Scc)
+		{
+			for (int32 EdgeIndex = Graph.DagForwardOffsets[Scc]; EdgeIndex < Graph.DagForwardOffsets[Scc + 1]; ++EdgeIndex)
+			{
+				const int32 TargetScc = Graph.DagForwardTargets[EdgeIndex];
+				if (TargetScc < 0 || TargetScc >= Scc)
+				{
+					return false;
+				}
+				DagEdges.Emplace(Scc, TargetScc);
+			}
+		}
+		BuildImpactCsr(Graph.SccCount, DagEdges, true, Graph.DagReverseOffsets, Graph.DagReverseTargets);
+		return true;
+	}
+
+	// LoadCachedImpactIndex는 impact_index.json을 검증하고 CSR graph로 decode하며, 파일 stamp가 같으면 이전 page가 만든 graph를 다시 쓴다.
+	bool LoadCachedImpactIndex(
+		const FString& InIndexPath,
+		TSharedPtr<const FLoadedImpactIndex>& OutIndex,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		static ADumpQueryIO::TStampedFileCache<TSharedPtr<const FLoadedImpactIndex>> IndexCache;
+
+		OutIndex.Reset();
+		return IndexCache.FindOrLoad(InIndexPath, OutIndex, [&](TSharedPtr<const FLoadedImpactIndex>& OutLoadedIndex)
+		{
+			TSharedPtr<FJsonObject> IndexRoot;
+			if (!LoadImpactJsonObject(InIndexPath, IndexRoot))
+			{
+				OutErrorCode = TEXT("ADUMP_IMPACT_INDEX_JSON_INVALID");
+				OutErrorDetail = TEXT("impact_index.json is not valid JSON.");
+				return false;
+			}
+			if (GetImpactStringField(IndexRoot, TEXT("schema_version")) != TEXT("impact_index_v1"))
+			{
+				OutErrorCode = TEXT("ADUMP_IMPACT_INDEX_SCHEMA_UNSUPPORTED");
+				OutErrorDetail = TEXT("impact requires impact_index_v1.");
+				return false;
+			}
+			TSharedRef<FLoadedImpactIndex> DecodedIndex = MakeShared<FLoadedImpactIndex>();
+			if (!TryDecodeImpactIndex(IndexRoot, *DecodedIndex))
+			{
+				OutErrorCode = TEXT("ADUMP_IMPACT_INDEX_JSON_INVALID");
+				OutErrorDetail = TEXT("impact_index.json tables are malformed.");
+				return false;
+			}
+			OutLoadedIndex = DecodedIndex;
+			return true;
+		});
+	}
+
+	// MakeImpactCursorHash는 index 생성 시각/schema/query/offset binding checksum을 만든다.
+	FString MakeImpactCursorHash(const FString& InGeneratedTime, const FString& InCanonicalQuery, int32 InOffset)
+	{
+		const FString BoundText = FString::Printf(
+			TEXT("%s|impact_query_result_v1|%s|%d"),
+			*InGeneratedTime,
+			*InCanonicalQuery,
+			InOffset);
+		return FString::Printf(TEXT("%08X"), FCrc::StrCrc32(*BoundText));
+	}
+
+	// BuildImpactCursor는 member offset에 결합된 opaque cursor를 만든다.
+	FString BuildImpactCursor(const FString& InGeneratedTime, const FString& InCanonicalQuery, int32 InOffset)
+	{
+		return FString::Printf(
+			TEXT("ic1.%d.%s"),
+			InOffset,
+			*MakeImpactCursorHash(InGeneratedTime, InCanonicalQuery, InOffset));
+	}
+
+	// ParseImpactCursor는 cursor format과 binding을 분리 검증한다.
+	bool ParseImpactCursor(
+		const FString& InCursor,
+		const FString& InGeneratedTime,
+		const FString& InCanonicalQuery,
+		int32& OutOffset,
+		bool& bOutStale)
+	{
+		OutOffset = 0;
+		bOutStale = false;
+		if (InCursor.IsEmpty())
+		{
+			return true;
+		}
+		TArray<FString> Parts;
+		InCursor.ParseIntoArray(Parts, TEXT("."), false);
+		if (Parts.Num() != 3 || Parts[0] != TEXT("ic1") || !Parts[1].IsNumeric() || Parts[2].Len() != 8)
+		{
+			return false;
+		}
+		OutOffset = FCString::Atoi(*Parts[1]);
+		if (OutOffset < 0)
+		{
+			return false;
+		}
+		if (!Parts[2].Equals(MakeImpactCursorHash(InGeneratedTime, InCanonicalQuery, OutOffset), ESearchCase::IgnoreCase))
+		{
+			bOutStale = true;
+			return false;
+		}
+		return true;
+	}
+}
+
+namespace ADumpImpactGraph
+{
+	void BuildImpactGraph(
+		int32 InNodeCount,
+		const TArray<TPair<int32, int32>>& InEdges,
+		FADumpImpactGraph& OutGraph)
+	{
+		OutGraph = FADumpImpactGraph();
+		OutGraph.NodeCount = FMath::Max(0, InNodeCount);
+
+		TArray<int32> NodeOffsets;
+		TArray<int32> NodeTargets;
+		BuildImpactCsr(OutGraph.NodeCount, InEdges, false, NodeOffsets, NodeTargets);
+		OutGraph.SccCount = ComputeTarjanScc(OutGraph.NodeCount, NodeOffsets, NodeTargets, OutGraph.NodeScc);
+
+		TArray<TPair<int32, int32>> MemberPairs;
+		MemberPairs.Reserve(OutGraph.NodeCount);
+		for (int32 Node = 0; Node < OutGraph.NodeCount; ++Node)
+		{
+			MemberPairs.Emplace(OutGraph.NodeScc[Node], Node);
+		}
+		BuildImpactCsr(OutGraph.SccCount, MemberPairs, false, OutGraph.SccMemberOffsets, OutGraph.SccMembers);
+
+		// DagEdges는 SCC 사이 edge만 남긴 정렬·중복 제거된 condensed DAG edge다.
+		TArray<TPair<int32, int32>> DagEdges;
+		DagEdges.Reserve(InEdges.Num());
+		for (const TPair<int32, int32>& Edge : InEdges)
+		{
+			const int32 FromScc = OutGraph.NodeScc[Edge.Key];
+			const int32 ToScc = OutGraph.NodeScc[Edge.Value];
+			if (FromScc != ToScc)
+			{
+				DagEdges.Emplace(FromScc, ToScc);
+			}
+		}
+		DagEdges.Sort([](const TPair<int32, int32>& Left, const TPair<int32, int32>& Right)
+		{
+			return Left.Key != Right.Key ? Left.Key < Right.Key : Left.Value < Right.Value;
+		});
+		int32 UniqueCount = 0;
+		for (int32 EdgeIndex = 0; EdgeIndex < DagEdges.Num(); ++EdgeIndex)
+		{
+			if (UniqueCount == 0 || DagEdges[UniqueCount - 1] != DagEdges[EdgeIndex])
+			{
+				DagEdges[UniqueCount++] = DagEdges[EdgeIndex];
+			}
+		}
+		DagEdges.SetNum(UniqueCount, EAllowShrinking::No);
+		BuildImpactCsr(OutGraph.SccCount, DagEdges, false, OutGraph.DagForwardOffsets, OutGraph.DagForwardTargets);
+		BuildImpactCsr(OutGraph.SccCount, DagEdges, true, OutGraph.DagReverseOffsets, OutGraph.DagReverseTargets);
+
+		ComputeClosureCounts(OutGraph, false, OutGraph.DependencyCounts);
+		ComputeClosureCounts(OutGraph, true, OutGraph.DependentCounts);
+	}
+
+	void CollectReachableNodes(
+		const FADumpImpactGraph& InGraph,
+		int32 InNode,
+		bool bInDependents,
+		TArray<int32>& OutNodes)
+	{
+		OutNodes.Reset();
+		if (InNode < 0 || InNode >= InGraph.NodeCount)
+		{
+			return;
+		}
+		const TArray<int32>& Offsets = bInDependents ? InGraph.DagReverseOffsets : InGraph.DagForwardOffsets;
+		const TArray<int32>& Targets = bInDependents ? InGraph.DagReverseTargets : InGraph.DagForwardTargets;
+		const int32 RootScc = InGraph.NodeScc[InNode];
+
+		TBitArray<> VisitedScc(false, InGraph.SccCount);
+		TArray<int32> SccQueue;
+		SccQueue.Add(RootScc);
+		VisitedScc[RootScc] = true;
+		for (int32 QueueIndex = 0; QueueIndex < SccQueue.Num(); ++QueueIndex)
+		{
+			const int32 Scc = SccQueue[QueueIndex];
+			for (int32 MemberIndex = InGraph.SccMemberOffsets[Scc]; MemberIndex < InGraph.SccMemberOffsets[Scc + 1]; ++MemberIndex)
+			{
+				if (InGraph.SccMembers[MemberIndex] != InNode)
+				{
+					OutNodes.Add(InGraph.SccMembers[MemberIndex]);
+				}
+			}
+			for (int32 EdgeIndex = Offsets[Scc]; EdgeIndex < Offsets[Scc + 1]; ++EdgeIndex)
+			{
+				const int32 TargetScc = Targets[EdgeIndex];
+				if (!VisitedScc[TargetScc])
+				{
+					VisitedScc[TargetScc] = true;
+					SccQueue.Add(TargetScc);
+				}
+			}
+		}
+		OutNodes.Sort();
+	}
+
+	bool BuildImpactIndex(
+		const FString& InDumpRootPath,
+		FString& OutImpactIndexFilePath,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutImpactIndexFilePath.Reset();
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+		auto Fail = [&](const TCHAR* InCode, const FString& InDetail)
+		{
+			OutErrorCode = InCode;
+			OutErrorDetail = InDetail;
+			return false;
+		};
+
+		const FString NormalizedDumpRoot = NormalizeImpactDumpRoot(InDumpRootPath);
+		const FString DependencyIndexPath = FPaths::Combine(NormalizedDumpRoot, TEXT("dependency_index.json"));
+		if (!IFileManager::Get().FileExists(*DependencyIndexPath))
+		{
+			return Fail(TEXT("ADUMP_IMPACT_DEPENDENCY_INDEX_NOT_FOUND"), TEXT("dependency_index.json must exist before impact_index_v1 is built."));
+		}
+		TSharedPtr<FJsonObject> DependencyIndexRoot;
+		if (!LoadImpactJsonObject(DependencyIndexPath, DependencyIndexRoot))
+		{
+			return Fail(TEXT("ADUMP_IMPACT_DEPENDENCY_INDEX_JSON_INVALID"), TEXT("dependency_index.json is not readable while building impact_index_v1."));
+		}
+		const TArray<TSharedPtr<FJsonValue>>* RelationValues = nullptr;
+		if (!DependencyIndexRoot->TryGetArrayField(TEXT("relations"), RelationValues) || !RelationValues)
+		{
+			return Fail(TEXT("ADUMP_IMPACT_DEPENDENCY_INDEX_JSON_INVALID"), TEXT("dependency_index.json has no relations array."));
+		}
+
+		// RelationPaths는 relation endpoint (from, to) object_path 쌍이다.
+		TArray<TPair<FString, FString>> RelationPaths;
+		RelationPaths.Reserve(RelationValues->Num());
+		TSet<FString> NodePathSet;
+		for (const TSharedPtr<FJsonValue>& RelationValue : *RelationValues)
+		{
+			const TSharedPtr<FJsonObject> RelationObject = RelationValue.IsValid() ? RelationValue->AsObject() : nullptr;
+			const FString FromPath = GetImpactStringField(RelationObject, TEXT("from"));
+			const FString ToPath = GetImpactStringField(RelationObject, TEXT("to"));
+			if (FromPath.IsEmpty() || ToPath.IsEmpty())
+			{
+				return Fail(TEXT("ADUMP_IMPACT_DEPENDENCY_INDEX_JSON_INVALID"), TEXT("dependency_index.json contains a relation without from/to."));
+			}
+			NodePathSet.Add(FromPath);
+			NodePathSet.Add(ToPath);
+			RelationPaths.Emplace(FromPath, ToPath);
+		}
+
+		TArray<FString> NodePaths = NodePathSet.Array();
+		NodePaths.Sort([](const FString& Left, const FString& Right)
+		{
+			return Left.Compare(Right, ESearchCase::CaseSensitive) < 0;
+		});
+		TMap<FString, int32> NodeOrdinalByPath;
+		NodeOrdinalByPath.Reserve(NodePaths.Num());
+		for (int32 Ordinal = 0; Ordinal < NodePaths.Num(); ++Ordinal)
+		{
+			NodeOrdinalByPath.Add(NodePaths[Ordinal], Ordinal);
+		}
+
+		TArray<TPair<int32, int32>> Edges;
+		Edges.Reserve(RelationPaths.Num());
+		for (const TPair<FString, FString>& RelationPath : RelationPaths)
+		{
+			const int32 FromOrdinal = NodeOrdinalByPath.FindChecked(RelationPath.Key);
+			const int32 ToOrdinal = NodeOrdinalByPath.FindChecked(RelationPath.Value);
+			if (FromOrdinal != ToOrdinal)
+			{
+				Edges.Emplace(FromOrdinal, ToOrdinal);
+			}
+		}
+
+		FADumpImpactGraph Graph;
+		BuildImpactGraph(NodePaths.Num(), Edges, Graph);
+
+		int32 CyclicSccCount = 0;
+		int32 LargestSccSize = 0;
+		for (int32 Scc = 0; Scc < Graph.SccCount; ++Scc)
+		{
+			const int32 SccSize = Graph.SccMemberOffsets[Scc + 1] - Graph.SccMemberOffsets[Scc];
+			CyclicSccCount += SccSize > 1 ? 1 : 0;
+			LargestSccSize = FMath::Max(LargestSccSize, SccSize);
+		}
+
+		TArray<TSharedPtr<FJsonValue>> NodeValues;
+		NodeValues.Reserve(NodePaths.Num());
+		for (const FString& NodePath : NodePaths)
+		{
+			NodeValues.Add(MakeShared<FJsonValueString>(NodePath));
+		}
+
+		TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+		RootObject->SetStringField(TEXT("schema_version"), TEXT("impact_index_v1"));
+		RootObject->SetStringField(TEXT("generated_time"), FDateTime::UtcNow().ToIso8601());
+		RootObject->SetStringField(TEXT("dependency_index_generated_time"), GetImpactStringField(DependencyIndexRoot, TEXT("generated_time")));
+		RootObject->SetStringField(TEXT("strength"), TEXT("all"));
+		RootObject->SetNumberField(TEXT("node_count"), Graph.NodeCount);
+		RootObject->SetNumberField(TEXT("edge_count"), Edges.Num());
+		RootObject->SetNumberField(TEXT("scc_count"), Graph.SccCount);
+		RootObject->SetNumberField(TEXT("cyclic_scc_count"), CyclicSccCount);
+		RootObject->SetNumberField(TEXT("largest_scc_size"), LargestSccSize);
+		RootObject->SetNumberField(TEXT("dag_edge_count"), Graph.DagForwardTargets.Num());
+		RootObject->SetArrayField(TEXT("nodes"), NodeValues);
+		RootObject->SetArrayField(TEXT("node_scc"), MakeImpactIntArrayValues(Graph.NodeScc));
+		RootObject->SetArrayField(TEXT("scc_dependency_counts"), MakeImpactIntArrayValues(Graph.DependencyCounts));
+		RootObject->SetArrayField(TEXT("scc_dependent_counts"), MakeImpactIntArrayValues(Graph.DependentCounts));
+		RootObject->SetArrayField(TEXT("dag_offsets"), MakeImpactIntArrayValues(Graph.DagForwardOffsets));
+		RootObject->SetArrayField(TEXT("dag_targets"), MakeImpactIntArrayValues(Graph.DagForwardTargets));
+
+		FString IndexJsonText;
+		if (!SerializeCondensedImpactJson(RootObject, IndexJsonText))
+		{
+			return Fail(TEXT("ADUMP_IMPACT_INDEX_WRITE_FAILED"), TEXT("Failed to serialize impact_index_v1."));
+		}
+		OutImpactIndexFilePath = FPaths::Combine(NormalizedDumpRoot, ImpactIndexFileName);
+		FString SaveError;
+		if (!ADumpJson::SaveJsonTextToFile(OutImpactIndexFilePath, IndexJsonText, SaveError))
+		{
+			OutImpactIndexFilePath.Reset();
+			return Fail(TEXT("ADUMP_IMPACT_INDEX_WRITE_FAILED"), FString::Printf(TEXT("Failed to atomically save impact_index_v1: %s"), *SaveError));
+		}
+		return true;
+	}
+
+	bool BuildImpactQueryJson(
+		const FString& InCommandLine,
+		FString& OutJsonText,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutJsonText.Reset();
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+		auto Fail = [&](const TCHAR* InCode, const FString& InDetail)
+		{
+			OutErrorCode = InCode;
+			OutErrorDetail = InDetail;
+			return false;
+		};
+
+		FString DumpRoot = GetImpactOptionValue(InCommandLine, TEXT("DumpRoot="));
+		if (DumpRoot.IsEmpty())
+		{
+			DumpRoot = FPaths::Combine(ADumpJson::BuildDefaultDumpRootDirectory(), TEXT("BPDump"));
+		}
+
+		const FString AssetPath = GetImpactOptionValue(InCommandLine, TEXT("Asset="));
+		if (AssetPath.IsEmpty())
+		{
+			return Fail(TEXT("ADUMP_IMPACT_ASSET_REQUIRED"), TEXT("impact requires -Asset=<object path>."));
+		}
+
+		FString Direction = GetImpactOptionValue(InCommandLine, TEXT("Direction="));
+		if (Direction.IsEmpty()) Direction = TEXT("dependents");
+		Direction.ToLowerInline();
+		if (Direction != TEXT("dependents") && Direction != TEXT("dependencies"))
+		{
+			return Fail(TEXT("ADUMP_IMPACT_DIRECTION_INVALID"), TEXT("impact Direction must be dependents or dependencies."));
+		}
+		const bool bDependents = Direction == TEXT("dependents");
+
+		// Limit=0은 member 목록 없이 precomputed count만 반환한다.
+		const int32 Limit = GetImpactIntegerOption(InCommandLine, TEXT("Limit="), 100);
+		if (Limit < 0 || Limit > 1000)
+		{
+			return Fail(TEXT("ADUMP_IMPACT_BOUNDS_INVALID"), TEXT("impact Limit must be between 0 and 1000."));
+		}
+
+		const double StartSeconds = FPlatformTime::Seconds();
+		const FString IndexPath = FPaths::Combine(NormalizeImpactDumpRoot(DumpRoot), ImpactIndexFileName);
+		if (!IFileManager::Get().FileExists(*IndexPath))
+		{
+			return Fail(TEXT("ADUMP_IMPACT_INDEX_NOT_FOUND"), TEXT("impact_index.json was not found. Run -Mode=index first."));
+		}
+		TSharedPtr<const FLoadedImpactIndex> IndexPtr;
+		if (!LoadCachedImpactIndex(IndexPath, IndexPtr, OutErrorCode, OutErrorDetail))
+		{
+			return false;
+		}
+		const FLoadedImpactIndex& Index = *IndexPtr;
+		const double LoadedSeconds = FPlatformTime::Seconds();
+
+		const int32 NodeOrdinal = Algo::BinarySearch(Index.Nodes, AssetPath, [](const FString& Left, const FString& Right)
+		{
+			return Left.Compare(Right, ESearchCase::CaseSensitive) < 0;
+		});
+		if (NodeOrdinal == INDEX_NONE)
+		{
+			return Fail(TEXT("ADUMP_IMPACT_ASSET_NOT_FOUND"), FString::Printf(TEXT("No dependency_index node matches asset: %s"), *AssetPath));
+		}
+
+		const FString CanonicalQuery = FString::Printf(TEXT("%s|%s|%d"), *AssetPath, *Direction, Limit);
+		const FString Cursor = GetImpactOptionValue(InCommandLine, TEXT("Cursor="));
+		int32 Offset = 0;
+		bool bCursorStale = false;
+		if (!ParseImpactCursor(Cursor, Index.GeneratedTime, CanonicalQuery, Offset, bCursorStale))
+		{
+			return bCursorStale
+				? Fail(TEXT("ADUMP_IMPACT_CURSOR_STALE"), TEXT("Cursor does not match the current impact_index_v1 or query."))
+				: Fail(TEXT("ADUMP_IMPACT_CURSOR_INVALID"), TEXT("Cursor format is invalid."));
+		}
+
+		const FADumpImpactGraph& Graph = Index.Graph;
+		const int32 RootScc = Graph.NodeScc[NodeOrdinal];
+		const int32 RootSccSize = Graph.SccMemberOffsets[RootScc + 1] - Graph.SccMemberOffsets[RootScc];
+		const int32 TotalMemberCount = bDependents ? Graph.DependentCounts[RootScc] : Graph.DependencyCounts[RootScc];
+		if (Offset > TotalMemberCount)
+		{
+			return Fail(TEXT("ADUMP_IMPACT_CURSOR_INVALID"), TEXT("Cursor offset is past the end of the member list."));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> MemberValues;
+		int32 EndOffset = Offset;
+		if (Limit > 0 && TotalMemberCount > 0)
+		{
+			TArray<int32> ReachableNodes;
+			CollectReachableNodes(Graph, NodeOrdinal, bDependents, ReachableNodes);
+			EndOffset = FMath::Min(Offset + Limit, ReachableNodes.Num());
+			MemberValues.Reserve(EndOffset - Offset);
+			for (int32 MemberIndex = Offset; MemberIndex < EndOffset; ++MemberIndex)
+			{
+				MemberValues.Add(MakeShared<FJsonValueString>(Index.Nodes[ReachableNodes[MemberIndex]]));
+			}
+		}
+		const bool bHasMore = Limit > 0 && EndOffset < TotalMemberCount;
+		const double QueriedSeconds = FPlatformTime::Seconds();
+
+		TSharedRef<FJsonObject> QueryObject = MakeShared<FJsonObject>();
+		QueryObject->SetStringField(TEXT("asset"), AssetPath);
+		QueryObject->SetStringField(TEXT("direction"), Direction);
+		QueryObject->SetNumberField(TEXT("limit"), Limit);
+		QueryObject->SetNumberField(TEXT("offset"), Offset);
+
+		TSharedRef<FJsonObject> IndexObject = MakeShared<FJsonObject>();
+		IndexObject->SetStringField(TEXT("schema_version"), TEXT("impact_index_v1"));
+		IndexObject->SetStringField(TEXT("generated_time"), Index.GeneratedTime);
+		IndexObject->SetNumberField(TEXT("node_count"), Graph.NodeCount);
+		IndexObject->SetNumberField(TEXT("scc_count"), Graph.SccCount);
+
+		TSharedRef<FJsonObject> RootNodeObject = MakeShared<FJsonObject>();
+		RootNodeObject->SetStringField(TEXT("object_path"), Index.Nodes[NodeOrdinal]);
+		RootNodeObject->SetNumberField(TEXT("scc_id"), RootScc);
+		RootNodeObject->SetNumberField(TEXT("scc_size"), RootSccSize);
+		RootNodeObject->SetBoolField(TEXT("in_cycle"), RootSccSize > 1);
+
+		TSharedRef<FJsonObject> PerfObject = MakeShared<FJsonObject>();
+		PerfObject->SetNumberField(TEXT("load_ms"), (LoadedSeconds - StartSeconds) * 1000.0);
+		PerfObject->SetNumberField(TEXT("query_ms"), (QueriedSeconds - LoadedSeconds) * 1000.0);
+
+		TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+		RootObject->SetStringField(TEXT("schema_version"), TEXT("impact_query_result_v1"));
+		RootObject->SetObjectField(TEXT("query"), QueryObject);
+		RootObject->SetObjectField(TEXT("index"), IndexObject);
+		RootObject->SetObjectField(TEXT("root"), RootNodeObject);
+		RootObject->SetNumberField(TEXT("dependencies_count"), Graph.DependencyCounts[RootScc]);
+		RootObject->SetNumberField(TEXT("dependents_count"), Graph.DependentCounts[RootScc]);
+		RootObject->SetNumberField(TEXT("total_member_count"), TotalMemberCount);
+		RootObject->SetNumberField(TEXT("returned_count"), MemberValues.Num());
+		RootObject->SetBoolField(TEXT("has_more"), bHasMore);
+		RootObject->SetStringField(TEXT("next_cursor"), bHasMore ? BuildImpactCursor(Index.GeneratedTime, CanonicalQuery, EndOffset) : FString());
+		RootObject->SetArrayField(TEXT("members"), MemberValues);
+		RootObject->SetObjectField(TEXT("perf"), PerfObject);
+
+		if (!SerializeImpactResultJson(RootObject, OutJsonText))
+		{
+			return Fail(TEXT("ADUMP_IMPACT_SERIALIZE_FAILED"), TEXT("Failed to serialize impact_query_result_v1."));
+		}
+		return true;
+	}
+}
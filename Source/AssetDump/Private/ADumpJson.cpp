@@ -1,6 +1,15 @@
 // File: ADumpJson.cpp
-// Version: v2.7.0
+// Version: v2.16.0
 // Changelog:
+// - v2.16.0: content store 저장 시 sidecar 복원 byte 수를 manifest content_sizes에 기록해 stat이 sidecar를 다시 만들지 않게 함.
+// - v2.15.0: 자동 재덤프와 watch 모드가 함께 쓰는 manifest asset.object_path 읽기 helper를 추가.
+// - v2.14.0: JSON 읽기/content store sidecar 복원/value span/비압축 원자 저장 구현을 AssetDumpQuery module의 ADumpQueryIO로 옮기고 gzip/pack 저장만 남김.
+// - v2.13.0: 결과에 미리 계산된 fingerprint가 있으면 manifest가 재계산 없이 사용해 background thread 저장을 허용.
+// - v2.12.0: output encoding ContentStorePath가 있으면 summary/details/graphs/references payload를 content store hash blob으로 저장하고 manifest content_refs로 참조하며, 읽기/존재/stat helper가 sidecar 파일이 없을 때 blob에서 복원.
+// - v2.11.0: output encoding PackFilePath가 있으면 dump.json/sidecar를 dump pack에 append하고, 읽기/존재/stat helper가 실제 파일이 없을 때 pack을 조회.
+// - v2.10.0: output encoding에 따라 dump.json/sidecar를 gzip 또는 compact JSON으로 저장하고 gzip magic 감지 읽기 helper를 추가.
+// - v2.9.0: DOM 없이 root member value byte span/CRC32를 찾는 scan과 검증된 file span value 읽기 helper를 추가.
+// - v2.8.0: batch diff용 data_asset_diff_v1 section object 공개 helper를 추가.
 // - v2.7.0: explicit section 선택에서 entity_evidence_v1 stored object를 additive 직렬화.
 // Migration:
 // - full-mode에는 entity_evidence를 자동 방출하지 않아 기존 accepted JSON 기본 surface를 보존한다.
@@ -48,16 +57,23 @@
 // - v0.1.0: dump.json 공통 직렬화, 기본 경로 계산, 안전 저장 로직 추가.
 
 #include "ADumpJson.h"
+#include "ADumpContentStore.h"
 #include "ADumpFingerprint.h"
+#include "ADumpPack.h"
 
+#include "HAL/CriticalSection.h"
 #include "HAL/FileManager.h"
 #include "HAL/PlatformMisc.h"
 #include "Interfaces/IPluginManager.h"
 #include "Math/UnrealMathUtility.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Guid.h"
 #include "Misc/PackageName.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 
@@ -1497,12 +1513,14 @@ namespace
 		// OptionsHashText는 실행 옵션만 반영한 대표 해시다.
 		const FString OptionsHashText = ADumpFingerprint::BuildOptionsHash(InDumpResult.Request);
 
-		// FingerprintText는 Phase 1 기준의 기본 fingerprint 해시다.
-		const FString FingerprintText = ADumpFingerprint::BuildAssetFingerprint(
-			InDumpResult.Asset.AssetObjectPath,
-			InDumpResult.Request,
-			InDumpResult.SchemaVersion,
-			InDumpResult.ExtractorVersion);
+		// FingerprintText는 Phase 1 기준의 기본 fingerprint 해시다. background 저장은 game thread에서 미리 계산한 값을 쓴다.
+		const FString FingerprintText = !InDumpResult.PrecomputedFingerprint.IsEmpty()
+			? InDumpResult.PrecomputedFingerprint
+			: ADumpFingerprint::BuildAssetFingerprint(
+				InDumpResult.Asset.AssetObjectPath,
+				InDumpResult.Request,
+				InDumpResult.SchemaVersion,
+				InDumpResult.ExtractorVersion);
 
 		// GeneratedFileArray는 이번 저장에서 생성되는 파일명 목록이다.
 		TArray<TSharedPtr<FJsonValue>> GeneratedFileArray;
@@ -1743,23 +1761,232 @@ namespace
 		return FJsonSerializer::Serialize(InRootObject, JsonWriter);
 	}
 
-	// SaveJsonObjectToFile은 object root를 직렬화 후 파일로 저장한다.
-	bool SaveJsonObjectToFile(const FString& FinalOutputFilePath, const TSharedRef<FJsonObject>& InRootObject, FString& OutErrorMessage)
+	// CompressJsonTextBytes는 JSON 본문을 UTF-8로 변환한 뒤 압축 강도에 맞는 gzip frame 하나로 압축한다.
+	bool CompressJsonTextBytes(const FString& InJsonText, EADumpOutputCompressionLevel InCompressionLevel, TArray<uint8>& OutCompressedBytes)
+	{
+		OutCompressedBytes.Reset();
+
+		// JsonUtf8은 BOM 없는 UTF-8 JSON 본문이다.
+		const FTCHARToUTF8 JsonUtf8(*InJsonText);
+
+		// CompressionFlags는 압축 강도를 FCompression bias flag로 옮긴 값이다.
+		ECompressionFlags CompressionFlags = COMPRESS_NoFlags;
+		if (InCompressionLevel == EADumpOutputCompressionLevel::Fast)
+		{
+			CompressionFlags = COMPRESS_BiasSpeed;
+		}
+		else if (InCompressionLevel == EADumpOutputCompressionLevel::Max)
+		{
+			CompressionFlags = COMPRESS_BiasSize;
+		}
+
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, JsonUtf8.Length(), CompressionFlags);
+		OutCompressedBytes.SetNumUninitialized(CompressedSize);
+		if (!FCompression::CompressMemory(NAME_Gzip, OutCompressedBytes.GetData(), CompressedSize, JsonUtf8.Get(), JsonUtf8.Length(), CompressionFlags))
+		{
+			OutCompressedBytes.Reset();
+			return false;
+		}
+
+		OutCompressedBytes.SetNum(CompressedSize);
+		return true;
+	}
+
+	// SaveJsonObjectToFile은 object root를 output encoding 형태로 직렬화 후 파일로 저장한다.
+	bool SaveJsonObjectToFile(const FString& FinalOutputFilePath, const TSharedRef<FJsonObject>& InRootObject, const FADumpOutputEncoding& InOutputEncoding, FString& OutErrorMessage)
 	{
 		// JsonText는 저장 전 직렬화된 JSON 본문이다.
 		FString JsonText;
-		if (!SerializeJsonObjectText(InRootObject, JsonText, true))
+		if (!SerializeJsonObjectText(InRootObject, JsonText, !InOutputEncoding.bCompactJson))
 		{
 			OutErrorMessage = FString::Printf(TEXT("Failed to serialize json object: %s"), *FinalOutputFilePath);
 			return false;
 		}
 
-		return ADumpJson::SaveJsonTextToFile(FinalOutputFilePath, JsonText, OutErrorMessage);
+		return ADumpJson::SaveJsonTextToFile(FinalOutputFilePath, JsonText, InOutputEncoding, OutErrorMessage);
+	}
+
+	// CountRestoredSidecarBytes는 읽기 쪽이 manifest 공통 필드와 payload를 다시 parse해 합친 condensed sidecar의 UTF-8 byte 수를 같은 방식으로 계산한다.
+	int64 CountRestoredSidecarBytes(const TSharedRef<FJsonObject>& InCommonObject, const FString& InPayloadText)
+	{
+		FString CommonText;
+		if (!SerializeJsonObjectText(InCommonObject, CommonText, false))
+		{
+			return -1;
+		}
+
+		TSharedPtr<FJsonObject> ParsedCommonObject;
+		TSharedPtr<FJsonObject> ParsedPayloadObject;
+		const TSharedRef<TJsonReader<>> CommonReader = TJsonReaderFactory<>::Create(CommonText);
+		const TSharedRef<TJsonReader<>> PayloadReader = TJsonReaderFactory<>::Create(InPayloadText);
+		if (!FJsonSerializer::Deserialize(CommonReader, ParsedCommonObject)
+			|| !ParsedCommonObject.IsValid()
+			|| !FJsonSerializer::Deserialize(PayloadReader, ParsedPayloadObject)
+			|| !ParsedPayloadObject.IsValid())
+		{
+			return -1;
+		}
+
+		TSharedRef<FJsonObject> RestoredObject = MakeShared<FJsonObject>();
+		RestoredObject->Values = ParsedCommonObject->Values;
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& PayloadPair : ParsedPayloadObject->Values)
+		{
+			RestoredObject->SetField(PayloadPair.Key, PayloadPair.Value);
+		}
+
+		FString RestoredText;
+		if (!SerializeJsonObjectText(RestoredObject, RestoredText, false))
+		{
+			return -1;
+		}
+		return FTCHARToUTF8(*RestoredText).Length();
+	}
+
+	// StoreContentSidecarPayload는 sidecar object에서 공통 필드를 뺀 payload를 content store blob으로 저장하고 hash와 복원 byte 수를 돌려준다.
+	bool StoreContentSidecarPayload(
+		const FString& InSidecarFilePath,
+		const TSharedRef<FJsonObject>& InSidecarObject,
+		const TSharedRef<FJsonObject>& InCommonObject,
+		const FADumpOutputEncoding& InOutputEncoding,
+		FString& OutContentHash,
+		int64& OutRestoredBytes,
+		FString& OutErrorMessage)
+	{
+		// 같은 section 내용이어도 asset/request/perf 공통 필드는 자산마다 다르므로 hash 대상에서 빼고 manifest에 한 번만 둔다.
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& CommonPair : InCommonObject->Values)
+		{
+			InSidecarObject->RemoveField(CommonPair.Key);
+		}
+
+		// PayloadText는 저장 형태와 무관하게 hash를 고정하는 condensed payload JSON이다.
+		FString PayloadText;
+		if (!SerializeJsonObjectText(InSidecarObject, PayloadText, false))
+		{
+			OutErrorMessage = FString::Printf(TEXT("Failed to serialize content payload: %s"), *InSidecarFilePath);
+			return false;
+		}
+
+		const FTCHARToUTF8 PayloadUtf8(*PayloadText);
+		TArray<uint8> PayloadBytes;
+		PayloadBytes.Append(reinterpret_cast<const uint8*>(PayloadUtf8.Get()), PayloadUtf8.Length());
+		OutContentHash = ADumpContentStore::BuildContentHash(PayloadBytes);
+		OutRestoredBytes = CountRestoredSidecarBytes(InCommonObject, PayloadText);
+
+		// StoredBytes는 output encoding codec을 적용한 blob byte다.
+		TArray<uint8> StoredBytes;
+		if (InOutputEncoding.Compression == EADumpOutputCompression::Gzip)
+		{
+			if (!CompressJsonTextBytes(PayloadText, InOutputEncoding.CompressionLevel, StoredBytes))
+			{
+				OutErrorMessage = FString::Printf(TEXT("Failed to compress content payload: %s"), *InSidecarFilePath);
+				return false;
+			}
+		}
+		else
+		{
+			StoredBytes = MoveTemp(PayloadBytes);
+		}
+
+		bool bReused = false;
+		FString StoreErrorCode;
+		FString StoreErrorDetail;
+		if (!ADumpContentStore::StoreContent(InOutputEncoding.ContentStorePath, OutContentHash, StoredBytes, bReused, StoreErrorCode, StoreErrorDetail))
+		{
+			OutErrorMessage = FString::Printf(TEXT("%s: %s"), *StoreErrorCode, *StoreErrorDetail);
+			return false;
+		}
+
+		// 이전 비-dedup 실행의 실제 sidecar 파일이 blob 참조보다 우선 읽히지 않도록 지운다.
+		if (IFileManager::Get().FileExists(*InSidecarFilePath))
+		{
+			IFileManager::Get().Delete(*InSidecarFilePath, false, true, true);
+		}
+		return true;
+	}
+
+	// SaveContentStoreSidecarFiles는 section sidecar payload를 content store에 먼저 저장한 뒤 hash 참조를 담은 manifest를 마지막에 저장한다.
+	bool SaveContentStoreSidecarFiles(const FString& FinalOutputFilePath, const FADumpResult& InDumpResult, const FADumpOutputEncoding& InOutputEncoding, FString& OutErrorMessage)
+	{
+		// ManifestFilePath는 manifest sidecar 최종 저장 경로다.
+		const FString ManifestFilePath = BuildSiblingOutputFilePath(FinalOutputFilePath, GetManifestFileName());
+
+		// digest는 object_path 등 자산 고유 필드가 본문에 섞여 있어 공유되지 않으므로 기존 sidecar 파일로 저장한다.
+		if (ShouldWriteDigestSidecar(InDumpResult)
+			&& !SaveJsonObjectToFile(BuildSiblingOutputFilePath(FinalOutputFilePath, GetDigestFileName()), MakeDigestObject(InDumpResult), InOutputEncoding, OutErrorMessage))
+		{
+			OutErrorMessage = FString::Printf(TEXT("Failed to save %s: %s"), GetDigestFileName(), *OutErrorMessage);
+			return false;
+		}
+
+		// CommonObject는 sidecar들이 공유하는 공통 결과 필드이며 manifest content_common으로 한 번만 저장된다.
+		TSharedRef<FJsonObject> CommonObject = MakeShared<FJsonObject>();
+		AddCommonResultFields(CommonObject, InDumpResult);
+
+		// ContentRefsObject는 sidecar 파일명별 content hash다.
+		TSharedRef<FJsonObject> ContentRefsObject = MakeShared<FJsonObject>();
+
+		// ContentSizesObject는 sidecar 파일명별 복원 byte 수다. stat 조회가 blob을 읽지 않고 크기를 얻는다.
+		TSharedRef<FJsonObject> ContentSizesObject = MakeShared<FJsonObject>();
+		auto StoreSidecar = [&](bool bShouldWrite, const TCHAR* SidecarFileName, const TSharedRef<FJsonObject>& SidecarObject)
+		{
+			if (!bShouldWrite)
+			{
+				return true;
+			}
+
+			const FString SidecarFilePath = BuildSiblingOutputFilePath(FinalOutputFilePath, SidecarFileName);
+			FString ContentHash;
+			int64 RestoredBytes = -1;
+			if (!StoreContentSidecarPayload(SidecarFilePath, SidecarObject, CommonObject, InOutputEncoding, ContentHash, RestoredBytes, OutErrorMessage))
+			{
+				OutErrorMessage = FString::Printf(TEXT("Failed to store %s: %s"), SidecarFileName, *OutErrorMessage);
+				return false;
+			}
+			ContentRefsObject->SetStringField(SidecarFileName, ContentHash);
+			if (RestoredBytes >= 0)
+			{
+				ContentSizesObject->SetNumberField(SidecarFileName, static_cast<double>(RestoredBytes));
+			}
+			return true;
+		};
+
+		if (!StoreSidecar(ShouldWriteSummarySidecar(InDumpResult), GetSummaryFileName(), MakeSummaryFileObject(InDumpResult))
+			|| !StoreSidecar(ShouldWriteDetailsSidecar(InDumpResult), GetDetailsFileName(), MakeDetailsFileObject(InDumpResult))
+			|| !StoreSidecar(ShouldWriteGraphsSidecar(InDumpResult), GetGraphsFileName(), MakeGraphsFileObject(InDumpResult))
+			|| !StoreSidecar(ShouldWriteReferencesSidecar(InDumpResult), GetReferencesFileName(), MakeReferencesFileObject(InDumpResult)))
+		{
+			return false;
+		}
+
+		// ContentStoreText는 dump root를 옮겨도 유지되도록 manifest 폴더 기준 상대 경로로 기록한 store root다.
+		FString ContentStoreText = FPaths::ConvertRelativePathToFull(InOutputEncoding.ContentStorePath);
+		if (!FPaths::MakePathRelativeTo(ContentStoreText, *(FPaths::GetPath(FPaths::ConvertRelativePathToFull(ManifestFilePath)) + TEXT("/"))))
+		{
+			ContentStoreText = FPaths::ConvertRelativePathToFull(InOutputEncoding.ContentStorePath);
+		}
+		ContentStoreText.ReplaceInline(TEXT("\\"), TEXT("/"));
+
+		TSharedRef<FJsonObject> ManifestObject = MakeManifestObject(FinalOutputFilePath, InDumpResult);
+		ManifestObject->SetStringField(TEXT("content_store"), ContentStoreText);
+		ManifestObject->SetObjectField(TEXT("content_common"), CommonObject);
+		ManifestObject->SetObjectField(TEXT("content_refs"), ContentRefsObject);
+		ManifestObject->SetObjectField(TEXT("content_sizes"), ContentSizesObject);
+		if (!SaveJsonObjectToFile(ManifestFilePath, ManifestObject, InOutputEncoding, OutErrorMessage))
+		{
+			OutErrorMessage = FString::Printf(TEXT("Failed to save %s: %s"), GetManifestFileName(), *OutErrorMessage);
+			return false;
+		}
+		return true;
 	}
 
 	// SavePhase1SidecarFiles는 manifest/digest/section sidecar들을 함께 저장한다.
-	bool SavePhase1SidecarFiles(const FString& FinalOutputFilePath, const FADumpResult& InDumpResult, FString& OutErrorMessage)
+	bool SavePhase1SidecarFiles(const FString& FinalOutputFilePath, const FADumpResult& InDumpResult, const FADumpOutputEncoding& InOutputEncoding, FString& OutErrorMessage)
 	{
+		if (!InOutputEncoding.ContentStorePath.IsEmpty())
+		{
+			return SaveContentStoreSidecarFiles(FinalOutputFilePath, InDumpResult, InOutputEncoding, OutErrorMessage);
+		}
+
 		// ManifestFilePath는 manifest sidecar 최종 저장 경로다.
 		const FString ManifestFilePath = BuildSiblingOutputFilePath(FinalOutputFilePath, GetManifestFileName());
 
@@ -1778,42 +2005,42 @@ namespace
 		// ReferencesFilePath는 references sidecar 최종 저장 경로다.
 		const FString ReferencesFilePath = BuildSiblingOutputFilePath(FinalOutputFilePath, GetReferencesFileName());
 
-		if (!SaveJsonObjectToFile(ManifestFilePath, MakeManifestObject(FinalOutputFilePath, InDumpResult), OutErrorMessage))
+		if (!SaveJsonObjectToFile(ManifestFilePath, MakeManifestObject(FinalOutputFilePath, InDumpResult), InOutputEncoding, OutErrorMessage))
 		{
 			OutErrorMessage = FString::Printf(TEXT("Failed to save %s: %s"), GetManifestFileName(), *OutErrorMessage);
 			return false;
 		}
 
 		if (ShouldWriteDigestSidecar(InDumpResult)
-			&& !SaveJsonObjectToFile(DigestFilePath, MakeDigestObject(InDumpResult), OutErrorMessage))
+			&& !SaveJsonObjectToFile(DigestFilePath, MakeDigestObject(InDumpResult), InOutputEncoding, OutErrorMessage))
 		{
 			OutErrorMessage = FString::Printf(TEXT("Failed to save %s: %s"), GetDigestFileName(), *OutErrorMessage);
 			return false;
 		}
 
 		if (ShouldWriteSummarySidecar(InDumpResult)
-			&& !SaveJsonObjectToFile(SummaryFilePath, MakeSummaryFileObject(InDumpResult), OutErrorMessage))
+			&& !SaveJsonObjectToFile(SummaryFilePath, MakeSummaryFileObject(InDumpResult), InOutputEncoding, OutErrorMessage))
 		{
 			OutErrorMessage = FString::Printf(TEXT("Failed to save %s: %s"), GetSummaryFileName(), *OutErrorMessage);
 			return false;
 		}
 
 		if (ShouldWriteDetailsSidecar(InDumpResult)
-			&& !SaveJsonObjectToFile(DetailsFilePath, MakeDetailsFileObject(InDumpResult), OutErrorMessage))
+			&& !SaveJsonObjectToFile(DetailsFilePath, MakeDetailsFileObject(InDumpResult), InOutputEncoding, OutErrorMessage))
 		{
 			OutErrorMessage = FString::Printf(TEXT("Failed to save %s: %s"), GetDetailsFileName(), *OutErrorMessage);
 			return false;
 		}
 
 		if (ShouldWriteGraphsSidecar(InDumpResult)
-			&& !SaveJsonObjectToFile(GraphsFilePath, MakeGraphsFileObject(InDumpResult), OutErrorMessage))
+			&& !SaveJsonObjectToFile(GraphsFilePath, MakeGraphsFileObject(InDumpResult), InOutputEncoding, OutErrorMessage))
 		{
 			OutErrorMessage = FString::Printf(TEXT("Failed to save %s: %s"), GetGraphsFileName(), *OutErrorMessage);
 			return false;
 		}
 
 		if (ShouldWriteReferencesSidecar(InDumpResult)
-			&& !SaveJsonObjectToFile(ReferencesFilePath, MakeReferencesFileObject(InDumpResult), OutErrorMessage))
+			&& !SaveJsonObjectToFile(ReferencesFilePath, MakeReferencesFileObject(InDumpResult), InOutputEncoding, OutErrorMessage))
 		{
 			OutErrorMessage = FString::Printf(TEXT("Failed to save %s: %s"), GetReferencesFileName(), *OutErrorMessage);
 			return false;
@@ -1964,13 +2191,28 @@ namespace ADumpJson
 		return ResolveOutputFilePathCandidate(UserOutputPath, AssetObjectPath);
 	}
 
-	FString BuildTempOutputFilePath(const FString& FinalOutputFilePath)
+	FString LoadManifestObjectPath(const FString& InManifestFilePath)
 	{
-		const FString DirectoryPath = FPaths::GetPath(FinalOutputFilePath);
-		const FString FinalFileName = FPaths::GetCleanFilename(FinalOutputFilePath);
-		const FString BaseFileName = FPaths::GetBaseFilename(FinalFileName, false);
-		const FString TempFileName = FString::Printf(TEXT("%s.tmp.json"), *BaseFileName);
-		return FPaths::Combine(DirectoryPath, TempFileName);
+		FString ManifestText;
+		if (!LoadJsonTextFromFile(InManifestFilePath, ManifestText))
+		{
+			return FString();
+		}
+
+		TSharedPtr<FJsonObject> ManifestRootObject;
+		const TSharedRef<TJsonReader<>> ManifestReader = TJsonReaderFactory<>::Create(ManifestText);
+		if (!FJsonSerializer::Deserialize(ManifestReader, ManifestRootObject) || !ManifestRootObject.IsValid())
+		{
+			return FString();
+		}
+
+		const TSharedPtr<FJsonObject>* AssetObject = nullptr;
+		FString ObjectPathText;
+		if (ManifestRootObject->TryGetObjectField(TEXT("asset"), AssetObject) && AssetObject && AssetObject->IsValid())
+		{
+			(*AssetObject)->TryGetStringField(TEXT("object_path"), ObjectPathText);
+		}
+		return ObjectPathText;
 	}
 
 	TSharedRef<FJsonObject> MakeResultObject(const FADumpResult& InDumpResult)
@@ -2077,15 +2319,53 @@ namespace ADumpJson
 		return RootObject;
 	}
 
+	TSharedRef<FJsonObject> MakeDataAssetDiffSectionObject(const FADumpDataAssetDiff& InDataAssetDiff)
+	{
+		return MakeDataAssetDiffObject(InDataAssetDiff);
+	}
+
 	bool SerializeResult(const FADumpResult& InDumpResult, FString& OutJsonText, bool bPrettyPrint)
 	{
 		return SerializeJsonObjectText(MakeResultObject(InDumpResult), OutJsonText, bPrettyPrint);
 	}
 
-	bool SaveJsonTextToFile(const FString& FinalOutputFilePath, const FString& JsonText, FString& OutErrorMessage)
+	bool SaveJsonTextToFile(const FString& FinalOutputFilePath, const FString& JsonText, const FADumpOutputEncoding& InOutputEncoding, FString& OutErrorMessage)
 	{
 		OutErrorMessage.Reset();
 
+		if (!InOutputEncoding.PackFilePath.IsEmpty())
+		{
+			// PackedBytes는 pack에 그대로 append할 UTF-8 또는 gzip 파일 byte다.
+			TArray<uint8> PackedBytes;
+			if (InOutputEncoding.Compression == EADumpOutputCompression::Gzip)
+			{
+				if (!CompressJsonTextBytes(JsonText, InOutputEncoding.CompressionLevel, PackedBytes))
+				{
+					OutErrorMessage = FString::Printf(TEXT("Failed to compress json text: %s"), *FinalOutputFilePath);
+					return false;
+				}
+			}
+			else
+			{
+				const FTCHARToUTF8 JsonUtf8(*JsonText);
+				PackedBytes.Append(reinterpret_cast<const uint8*>(JsonUtf8.Get()), JsonUtf8.Length());
+			}
+
+			FString PackErrorCode;
+			FString PackErrorDetail;
+			if (!ADumpPack::AppendPackedFile(InOutputEncoding.PackFilePath, FinalOutputFilePath, PackedBytes, PackErrorCode, PackErrorDetail))
+			{
+				OutErrorMessage = FString::Printf(TEXT("%s: %s"), *PackErrorCode, *PackErrorDetail);
+				return false;
+			}
+			return true;
+		}
+
+		if (InOutputEncoding.Compression != EADumpOutputCompression::Gzip)
+		{
+			return ADumpQueryIO::SaveJsonTextToFile(FinalOutputFilePath, JsonText, OutErrorMessage);
+		}
+
 		const FString OutputDirectory = FPaths::GetPath(FinalOutputFilePath);
 		if (!OutputDirectory.IsEmpty() && !IFileManager::Get().MakeDirectory(*OutputDirectory, true))
 		{
@@ -2093,8 +2373,16 @@ namespace ADumpJson
 			return false;
 		}
 
+		// CompressedBytes는 UTF-8 JSON 본문을 gzip frame 하나로 압축한 파일 byte다.
 		const FString TempOutputPath = BuildTempOutputFilePath(FinalOutputFilePath);
-		if (!FFileHelper::SaveStringToFile(JsonText, *TempOutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		TArray<uint8> CompressedBytes;
+		if (!CompressJsonTextBytes(JsonText, InOutputEncoding.CompressionLevel, CompressedBytes))
+		{
+			OutErrorMessage = FString::Printf(TEXT("Failed to compress json text: %s"), *FinalOutputFilePath);
+			return false;
+		}
+
+		if (!FFileHelper::SaveArrayToFile(CompressedBytes, *TempOutputPath))
 		{
 			OutErrorMessage = FString::Printf(TEXT("Failed to write temp json file: %s"), *TempOutputPath);
 			return false;
@@ -2115,20 +2403,25 @@ namespace ADumpJson
 	}
 
 	bool SaveResultToFile(const FString& FinalOutputFilePath, const FADumpResult& InDumpResult, FString& OutErrorMessage)
+	{
+		return SaveResultToFile(FinalOutputFilePath, InDumpResult, FADumpOutputEncoding(), OutErrorMessage);
+	}
+
+	bool SaveResultToFile(const FString& FinalOutputFilePath, const FADumpResult& InDumpResult, const FADumpOutputEncoding& InOutputEncoding, FString& OutErrorMessage)
 	{
 		// JsonText는 메인 dump 파일 직렬화 결과다.
 		FString JsonText;
-		if (!SerializeResult(InDumpResult, JsonText, true))
+		if (!SerializeResult(InDumpResult, JsonText, !InOutputEncoding.bCompactJson))
 		{
 			OutErrorMessage = TEXT("Failed to serialize dump result to json text.");
 			return false;
 		}
 
-		if (!SaveJsonTextToFile(FinalOutputFilePath, JsonText, OutErrorMessage))
+		if (!SaveJsonTextToFile(FinalOutputFilePath, JsonText, InOutputEncoding, OutErrorMessage))
 		{
 			return false;
 		}
 
-		return SavePhase1SidecarFiles(FinalOutputFilePath, InDumpResult, OutErrorMessage);
+		return SavePhase1SidecarFiles(FinalOutputFilePath, InDumpResult, InOutputEncoding, OutErrorMessage);
 	}
 }
@@ -0,0 +1,557 @@
+// File: ADumpRegistryCache.cpp
+// Version: v1.1.0
+// Changelog:
+// - v1.1.0: RemoveDeletedPackageFiles가 삭제 파일을 ScanModifiedAssetFiles로 registry에서 빼고 scan root 상태 cache를 다시 저장. cache 폴더 해석을 ResolveRegistryCacheDirectory로 모음.
+// - v1.0.0: root별 Asset Registry 상태를 binary cache + package 파일 stamp sidecar로 저장하고, 다음 실행에서 바뀐 파일만 prune/rescan하는 증분 적용과 process당 한 번 scan 기록을 구현.
+// Migration:
+// - sidecar(.json)를 상태 파일(.bin) 뒤에 원자 저장하므로 sidecar가 있으면 짝이 맞는 상태 파일이 완성돼 있다. 엔진 버전이나 root가 다르면 cache를 버리고 전체 scan한다.
+
+#include "ADumpRegistryCache.h"
+#include "ADumpJson.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/AssetRegistryState.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace
+{
+	// RegistryCacheSchemaVersion은 stamp sidecar 계약 이름이다.
+	const TCHAR* RegistryCacheSchemaVersion = TEXT("asset_registry_cache_v1");
+
+	// RegistryCacheMaxChangedRatio는 증분 적용을 포기하고 전체 scan할 변경 파일 비율이다. 대부분 바뀌었으면 prune/rescan이 전체 scan보다 느리다.
+	constexpr double RegistryCacheMaxChangedRatio = 0.5;
+
+	// ScannedRootPrefixes는 이 process에서 이미 scan한 root의 '/' 종료 prefix다. commandlet scan은 game thread에서만 일어난다.
+	TArray<FString> ScannedRootPrefixes;
+
+	// NormalizeRegistryRootPath는 long package root를 끝 '/' 없는 형태로 맞춘다.
+	FString NormalizeRegistryRootPath(const FString& InRootPath)
+	{
+		FString RootPath = InRootPath;
+		RootPath.TrimStartAndEndInline();
+		while (RootPath.Len() > 1 && RootPath.EndsWith(TEXT("/")))
+		{
+			RootPath.LeftChopInline(1, false);
+		}
+		return RootPath;
+	}
+
+	// IsRegistryRootScanned는 root가 이미 scan한 root와 같거나 그 아래인지 검사한다.
+	bool IsRegistryRootScanned(const FString& InRootPath)
+	{
+		const FString RootPrefix = InRootPath + TEXT("/");
+		for (const FString& ScannedRootPrefix : ScannedRootPrefixes)
+		{
+			if (RootPrefix.StartsWith(ScannedRootPrefix, ESearchCase::IgnoreCase))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	// BuildRegistryCacheKey는 root를 cache 파일 이름으로 쓸 수 있게 바꾼다.
+	FString BuildRegistryCacheKey(const FString& InRootPath)
+	{
+		FString CacheKey = InRootPath;
+		CacheKey.ReplaceInline(TEXT("/"), TEXT("_"));
+		CacheKey.ReplaceInline(TEXT("\\"), TEXT("_"));
+		CacheKey.RemoveFromStart(TEXT("_"));
+		return CacheKey.IsEmpty() ? TEXT("root") : CacheKey;
+	}
+
+	// CollectRegistryPackageFileStamps는 root 폴더 아래 package 파일의 상대 경로별 크기:수정 시각 stamp를 모은다.
+	void CollectRegistryPackageFileStamps(const FString& InRootDirectoryPath, TMap<FString, FString>& OutStampByFile)
+	{
+		OutStampByFile.Reset();
+		const FString RootDirectoryPrefix = InRootDirectoryPath.EndsWith(TEXT("/")) ? InRootDirectoryPath : InRootDirectoryPath + TEXT("/");
+		IFileManager::Get().IterateDirectoryStatRecursively(
+			*InRootDirectoryPath,
+			[&OutStampByFile, &RootDirectoryPrefix](const TCHAR* InVisitedPath, const FFileStatData& InStatData)
+			{
+				if (InStatData.bIsDirectory)
+				{
+					return true;
+				}
+
+				FString VisitedFilePath(InVisitedPath);
+				const FString ExtensionText = FPaths::GetExtension(VisitedFilePath, true);
+				if (!ExtensionText.Equals(FPackageName::GetAssetPackageExtension(), ESearchCase::IgnoreCase)
+					&& !ExtensionText.Equals(FPackageName::GetMapPackageExtension(), ESearchCase::IgnoreCase))
+				{
+					return true;
+				}
+
+				FPaths::NormalizeFilename(VisitedFilePath);
+				VisitedFilePath.RemoveFromStart(RootDirectoryPrefix);
+				OutStampByFile.Add(VisitedFilePath, FString::Printf(TEXT("%lld:%lld"), InStatData.FileSize, InStatData.ModificationTime.GetTicks()));
+				return true;
+			});
+	}
+
+	// ResolveRegistryCacheDirectory는 -RegistryCacheDir= 값, 없으면 기본 cache 폴더다.
+	FString ResolveRegistryCacheDirectory(const FString& InCommandLine)
+	{
+		FString CacheDirectory;
+		if (!FParse::Value(*InCommandLine, TEXT("RegistryCacheDir="), CacheDirectory))
+		{
+			CacheDirectory = ADumpRegistryCache::GetDefaultCacheDirectory();
+		}
+		return CacheDirectory;
+	}
+
+	// MakeRegistryCacheSerializationOptions는 editor 조회에 필요한 asset/dependency/package data를 모두 담는 직렬화 옵션이다.
+	FAssetRegistrySerializationOptions MakeRegistryCacheSerializationOptions()
+	{
+		FAssetRegistrySerializationOptions SerializationOptions;
+		SerializationOptions.bSerializeAssetRegistry = true;
+		SerializationOptions.bSerializeDependencies = true;
+		SerializationOptions.bSerializeSearchableNameDependencies = true;
+		SerializationOptions.bSerializeManageDependencies = true;
+		SerializationOptions.bSerializePackageData = true;
+		SerializationOptions.bFilterAssetDataWithNoTags = false;
+		return SerializationOptions;
+	}
+
+	// TryConvertRegistryFileToPackageName은 root 폴더 기준 상대 파일 경로를 long package 이름으로 바꾼다.
+	bool TryConvertRegistryFileToPackageName(const FString& InRootPath, const FString& InRelativeFilePath, FName& OutPackageName)
+	{
+		const FString PackageName = InRootPath / FPaths::GetBaseFilename(InRelativeFilePath, false);
+		if (!FPackageName::IsValidLongPackageName(PackageName))
+		{
+			return false;
+		}
+		OutPackageName = FName(*PackageName);
+		return true;
+	}
+
+	// LoadRegistryCacheStamps는 sidecar를 읽고 schema/엔진 버전/root가 맞을 때 상태 파일 크기와 package stamp를 돌려준다.
+	bool LoadRegistryCacheStamps(
+		const FString& InStampFilePath,
+		const FString& InRootPath,
+		int64& OutStateBytes,
+		TMap<FString, FString>& OutStampByFile,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		FString StampText;
+		if (!ADumpJson::LoadJsonTextFromFile(InStampFilePath, StampText))
+		{
+			return false;
+		}
+
+		TSharedPtr<FJsonObject> StampRootObject;
+		const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(StampText);
+		const TSharedPtr<FJsonObject>* PackageFilesObject = nullptr;
+		if (!FJsonSerializer::Deserialize(JsonReader, StampRootObject)
+			|| !StampRootObject.IsValid()
+			|| !StampRootObject->TryGetObjectField(TEXT("package_files"), PackageFilesObject)
+			|| PackageFilesObject == nullptr
+			|| !PackageFilesObject->IsValid())
+		{
+			OutErrorCode = TEXT("ADUMP_REGISTRY_CACHE_INVALID");
+			OutErrorDetail = FString::Printf(TEXT("Registry cache sidecar is not valid JSON: %s"), *InStampFilePath);
+			return false;
+		}
+
+		if (StampRootObject->GetStringField(TEXT("schema_version")) != RegistryCacheSchemaVersion
+			|| StampRootObject->GetStringField(TEXT("engine_version")) != FEngineVersion::Current().ToString()
+			|| !StampRootObject->GetStringField(TEXT("root_path")).Equals(InRootPath, ESearchCase::CaseSensitive))
+		{
+			OutErrorCode = TEXT("ADUMP_REGISTRY_CACHE_STALE");
+			OutErrorDetail = FString::Printf(TEXT("Registry cache schema, engine version or root differs: %s"), *InStampFilePath);
+			return false;
+		}
+
+		OutStateBytes = static_cast<int64>(StampRootObject->GetNumberField(TEXT("state_bytes")));
+		OutStampByFile.Reset();
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& StampPair : (*PackageFilesObject)->Values)
+		{
+			FString StampValueText;
+			if (StampPair.Value.IsValid() && StampPair.Value->TryGetString(StampValueText))
+			{
+				OutStampByFile.Add(StampPair.Key, StampValueText);
+			}
+		}
+		return true;
+	}
+
+	// SaveRegistryCache는 root package만 담은 현재 registry 상태를 임시 파일 + move로 저장한 뒤 stamp sidecar를 원자 저장한다.
+	bool SaveRegistryCache(
+		const FString& InRootPath,
+		const FString& InStateFilePath,
+		const FString& InStampFilePath,
+		const TMap<FString, FString>& InStampByFile,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		TSet<FName> RootPackageNames;
+		for (const TPair<FString, FString>& StampPair : InStampByFile)
+		{
+			FName RootPackageName;
+			if (TryConvertRegistryFileToPackageName(InRootPath, StampPair.Key, RootPackageName))
+			{
+				RootPackageNames.Add(RootPackageName);
+			}
+		}
+
+		const FAssetRegistrySerializationOptions SerializationOptions = MakeRegistryCacheSerializationOptions();
+		FAssetRegistryState RootState;
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		AssetRegistry.InitializeTemporaryAssetRegistryState(RootState, SerializationOptions, false, RootPackageNames);
+
+		TArray<uint8> StateBytes;
+		FMemoryWriter StateWriter(StateBytes, true);
+		if (!RootState.Save(StateWriter, SerializationOptions))
+		{
+			OutErrorCode = TEXT("ADUMP_REGISTRY_CACHE_WRITE_FAILED");
+			OutErrorDetail = FString::Printf(TEXT("Failed to serialize Asset Registry state for %s."), *InRootPath);
+			return false;
+		}
+
+		const FString TempFilePath = FString::Printf(TEXT("%s.%s.tmp"), *InStateFilePath, *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+		if (!IFileManager::Get().MakeDirectory(*FPaths::GetPath(InStateFilePath), true)
+			|| !FFileHelper::SaveArrayToFile(StateBytes, *TempFilePath)
+			|| !IFileManager::Get().Move(*InStateFilePath, *TempFilePath, true, true, false, true))
+		{
+			IFileManager::Get().Delete(*TempFilePath, false, true, true);
+			OutErrorCode = TEXT("ADUMP_REGISTRY_CACHE_WRITE_FAILED");
+			OutErrorDetail = FString::Printf(TEXT("Failed to write Asset Registry state cache: %s"), *InStateFilePath);
+			return false;
+		}
+
+		TSharedRef<FJsonObject> PackageFilesObject = MakeShared<FJsonObject>();
+		TArray<FString> SortedFiles;
+		InStampByFile.GetKeys(SortedFiles);
+		SortedFiles.Sort([](const FString& Left, const FString& Right)
+		{
+			return Left.Compare(Right, ESearchCase::CaseSensitive) < 0;
+		});
+		for (const FString& SortedFile : SortedFiles)
+		{
+			PackageFilesObject->SetStringField(SortedFile, InStampByFile.FindChecked(SortedFile));
+		}
+
+		TSharedRef<FJsonObject> StampRootObject = MakeShared<FJsonObject>();
+		StampRootObject->SetStringField(TEXT("schema_version"), RegistryCacheSchemaVersion);
+		StampRootObject->SetStringField(TEXT("generated_time"), FDateTime::UtcNow().ToIso8601());
+		StampRootObject->SetStringField(TEXT("engine_version"), FEngineVersion::Current().ToString());
+		StampRootObject->SetStringField(TEXT("root_path"), InRootPath);
+		StampRootObject->SetNumberField(TEXT("state_bytes"), static_cast<double>(StateBytes.Num()));
+		StampRootObject->SetNumberField(TEXT("package_count"), RootPackageNames.Num());
+		StampRootObject->SetObjectField(TEXT("package_files"), PackageFilesObject);
+
+		FString StampText;
+		const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&StampText);
+		FString SaveErrorMessage;
+		if (!FJsonSerializer::Serialize(StampRootObject, JsonWriter)
+			|| !ADumpJson::SaveJsonTextToFile(InStampFilePath, StampText, SaveErrorMessage))
+		{
+			OutErrorCode = TEXT("ADUMP_REGISTRY_CACHE_WRITE_FAILED");
+			OutErrorDetail = FString::Printf(TEXT("Failed to write Asset Registry cache sidecar: %s (%s)"), *InStampFilePath, *SaveErrorMessage);
+			return false;
+		}
+		return true;
+	}
+}
+
+namespace ADumpRegistryCache
+{
+	bool IsStateCacheRequested(const FString& InCommandLine)
+	{
+		bool bUseStateCache = false;
+		FParse::Bool(*InCommandLine, TEXT("RegistryCache="), bUseStateCache);
+		return bUseStateCache;
+	}
+
+	FString GetDefaultCacheDirectory()
+	{
+		return FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("AssetDump"), TEXT("RegistryCache")));
+	}
+
+	TArray<FADumpRegistryScanReport> ScanPathsOnce(const TArray<FString>& InPackagePaths, const FString& InCommandLine)
+	{
+		const bool bUseStateCache = IsStateCacheRequested(InCommandLine);
+		const FString CacheDirectory = ResolveRegistryCacheDirectory(InCommandLine);
+
+		TArray<FADumpRegistryScanReport> ScanReports;
+		for (const FString& PackagePath : InPackagePaths)
+		{
+			const FString RootPath = NormalizeRegistryRootPath(PackagePath);
+			FADumpRegistryScanReport ScanReport;
+			ScanReport.RootPath = RootPath;
+			if (RootPath.IsEmpty() || IsRegistryRootScanned(RootPath))
+			{
+				ScanReport.bSkippedInProcess = true;
+				ScanReports.Add(MoveTemp(ScanReport));
+				continue;
+			}
+
+			if (bUseStateCache)
+			{
+				ScanReport = ScanRootWithStateCache(RootPath, CacheDirectory);
+				if (!ScanReport.CacheErrorCode.IsEmpty())
+				{
+					UE_LOG(LogTemp, Warning, TEXT("%s: %s"), *ScanReport.CacheErrorCode, *ScanReport.CacheErrorDetail);
+				}
+			}
+			else
+			{
+				const double ScanStartSeconds = FPlatformTime::Seconds();
+				IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+				AssetRegistry.ScanPathsSynchronous({ RootPath }, true);
+				ScanReport.ScanMilliseconds = (FPlatformTime::Seconds() - ScanStartSeconds) * 1000.0;
+			}
+
+			ScannedRootPrefixes.Add(RootPath + TEXT("/"));
+			UE_LOG(LogTemp, Display, TEXT("Asset Registry scan %s - cache_loaded:%s, cache_saved:%s, package_files:%d, changed:%d, removed:%d, ms:%.1f"),
+				*RootPath,
+				ScanReport.bCacheLoaded ? TEXT("true") : TEXT("false"),
+				ScanReport.bCacheSaved ? TEXT("true") : TEXT("false"),
+				ScanReport.PackageFileCount,
+				ScanReport.ChangedFileCount,
+				ScanReport.RemovedFileCount,
+				ScanReport.ScanMilliseconds);
+			ScanReports.Add(MoveTemp(ScanReport));
+		}
+		return ScanReports;
+	}
+
+	FADumpRegistryScanReport ScanRootWithStateCache(const FString& InRootPath, const FString& InCacheDirectory)
+	{
+		const double ScanStartSeconds = FPlatformTime::Seconds();
+		FADumpRegistryScanReport ScanReport;
+		ScanReport.RootPath = NormalizeRegistryRootPath(InRootPath);
+
+		const FString CacheKey = BuildRegistryCacheKey(ScanReport.RootPath);
+		const FString StateFilePath = FPaths::Combine(InCacheDirectory, FString::Printf(TEXT("registry_state_%s.bin"), *CacheKey));
+		const FString StampFilePath = FPaths::Combine(InCacheDirectory, FString::Printf(TEXT("registry_state_%s.json"), *CacheKey));
+		ScanReport.CacheFilePath = StateFilePath;
+
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+
+		// RootDirectoryPath는 root package 경로의 content 폴더다. mount되지 않은 root는 cache 없이 registry scan에 맡긴다.
+		FString RootDirectoryPath;
+		if (!FPackageName::TryConvertLongPackageNameToFilename(ScanReport.RootPath + TEXT("/"), RootDirectoryPath))
+		{
+			AssetRegistry.ScanPathsSynchronous({ ScanReport.RootPath }, true);
+			ScanReport.CacheErrorCode = TEXT("ADUMP_REGISTRY_CACHE_ROOT_UNMOUNTED");
+			ScanReport.CacheErrorDetail = FString::Printf(TEXT("Root is not a mounted package path: %s"), *ScanReport.RootPath);
+			ScanReport.ScanMilliseconds = (FPlatformTime::Seconds() - ScanStartSeconds) * 1000.0;
+			return ScanReport;
+		}
+		RootDirectoryPath = FPaths::ConvertRelativePathToFull(RootDirectoryPath);
+		FPaths::NormalizeDirectoryName(RootDirectoryPath);
+
+		// 현재 package 파일 stat만 모으는 것은 package header를 읽는 registry scan보다 훨씬 싸므로 매 실행 검증한다.
+		TMap<FString, FString> CurrentStampByFile;
+		CollectRegistryPackageFileStamps(RootDirectoryPath, CurrentStampByFile);
+		ScanReport.PackageFileCount = CurrentStampByFile.Num();
+
+		int64 CachedStateBytes = 0;
+		TMap<FString, FString> CachedStampByFile;
+		TArray<FString> ChangedFiles;
+		TArray<FString> RemovedFiles;
+		bool bCacheApplied = false;
+		if (LoadRegistryCacheStamps(StampFilePath, ScanReport.RootPath, CachedStateBytes, CachedStampByFile, ScanReport.CacheErrorCode, ScanReport.CacheErrorDetail))
+		{
+			DiffPackageFileStamps(CachedStampByFile, CurrentStampByFile, ChangedFiles, RemovedFiles);
+			const int32 DirtyFileCount = ChangedFiles.Num() + RemovedFiles.Num();
+
+			TArray<uint8> StateBytes;
+			FAssetRegistryState CachedState;
+			if (DirtyFileCount > FMath::Max(1, CurrentStampByFile.Num()) * RegistryCacheMaxChangedRatio)
+			{
+				ScanReport.CacheErrorCode = TEXT("ADUMP_REGISTRY_CACHE_MOSTLY_CHANGED");
+				ScanReport.CacheErrorDetail = FString::Printf(TEXT("%d of %d package files changed; running a full scan."), DirtyFileCount, CurrentStampByFile.Num());
+			}
+			else if (!FFileHelper::LoadFileToArray(StateBytes, *StateFilePath) || StateBytes.Num() != CachedStateBytes)
+			{
+				ScanReport.CacheErrorCode = TEXT("ADUMP_REGISTRY_CACHE_INVALID");
+				ScanReport.CacheErrorDetail = FString::Printf(TEXT("Registry state cache is missing or truncated: %s"), *StateFilePath);
+			}
+			else
+			{
+				FMemoryReader StateReader(StateBytes, true);
+				if (!CachedState.Load(StateReader))
+				{
+					ScanReport.CacheErrorCode = TEXT("ADUMP_REGISTRY_CACHE_INVALID");
+					ScanReport.CacheErrorDetail = FString::Printf(TEXT("Failed to load Asset Registry state cache: %s"), *StateFilePath);
+				}
+				else
+				{
+					// 바뀌거나 사라진 package의 cache 항목은 버리고, 남은 상태를 합친 뒤 바뀐 파일만 다시 scan한다.
+					TSet<FName> DirtyPackageNames;
+					for (const FString& DirtyFile : ChangedFiles)
+					{
+						FName DirtyPackageName;
+						if (TryConvertRegistryFileToPackageName(ScanReport.RootPath, DirtyFile, DirtyPackageName))
+						{
+							DirtyPackageNames.Add(DirtyPackageName);
+						}
+					}
+					for (const FString& DirtyFile : RemovedFiles)
+					{
+						FName DirtyPackageName;
+						if (TryConvertRegistryFileToPackageName(ScanReport.RootPath, DirtyFile, DirtyPackageName))
+						{
+							DirtyPackageNames.Add(DirtyPackageName);
+						}
+					}
+					if (DirtyPackageNames.Num() > 0)
+					{
+						CachedState.PruneAssetData(TSet<FName>(), DirtyPackageNames, MakeRegistryCacheSerializationOptions());
+					}
+					AssetRegistry.AppendState(CachedState);
+
+					TArray<FString> ChangedFilePaths;
+					for (const FString& ChangedFile : ChangedFiles)
+					{
+						ChangedFilePaths.Add(FPaths::Combine(RootDirectoryPath, ChangedFile));
+					}
+					if (ChangedFilePaths.Num() > 0)
+					{
+						AssetRegistry.ScanFilesSynchronous(ChangedFilePaths, true);
+					}
+
+					ScanReport.bCacheLoaded = true;
+					ScanReport.ChangedFileCount = ChangedFiles.Num();
+					ScanReport.RemovedFileCount = RemovedFiles.Num();
+					ScanReport.CacheErrorCode.Reset();
+					ScanReport.CacheErrorDetail.Reset();
+					bCacheApplied = true;
+				}
+			}
+		}
+
+		if (!bCacheApplied)
+		{
+			AssetRegistry.ScanPathsSynchronous({ ScanReport.RootPath }, true);
+		}
+
+		// 전체 scan했거나 변경을 반영했으면 다음 실행이 이번 상태에서 시작하도록 cache를 갱신한다.
+		if (!bCacheApplied || ChangedFiles.Num() > 0 || RemovedFiles.Num() > 0)
+		{
+			FString SaveErrorCode;
+			FString SaveErrorDetail;
+			ScanReport.bCacheSaved = SaveRegistryCache(ScanReport.RootPath, StateFilePath, StampFilePath, CurrentStampByFile, SaveErrorCode, SaveErrorDetail);
+			if (!ScanReport.bCacheSaved && ScanReport.CacheErrorCode.IsEmpty())
+			{
+				ScanReport.CacheErrorCode = SaveErrorCode;
+				ScanReport.CacheErrorDetail = SaveErrorDetail;
+			}
+		}
+
+		ScanReport.ScanMilliseconds = (FPlatformTime::Seconds() - ScanStartSeconds) * 1000.0;
+		return ScanReport;
+	}
+
+	void RemoveDeletedPackageFiles(const TArray<FString>& InDeletedFilePaths, const FString& InCommandLine)
+	{
+		if (InDeletedFilePaths.Num() == 0)
+		{
+			return;
+		}
+
+		// ScanModifiedAssetFiles는 다시 scan한 파일에 없는 기존 자산을 registry에서 지운다. 파일이 없으면 그 package 자산이 모두 빠진다.
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		AssetRegistry.ScanModifiedAssetFiles(InDeletedFilePaths);
+		if (!IsStateCacheRequested(InCommandLine))
+		{
+			return;
+		}
+
+		// DirtyRootPaths는 삭제 package가 속한 이 process의 scan root다. 저장 상태는 현재 파일 stamp로 거르므로 삭제 package가 빠진다.
+		TSet<FString> DirtyRootPaths;
+		for (const FString& DeletedFilePath : InDeletedFilePaths)
+		{
+			FString DeletedPackageName;
+			if (!FPackageName::TryConvertFilenameToLongPackageName(DeletedFilePath, DeletedPackageName))
+			{
+				continue;
+			}
+			for (const FString& ScannedRootPrefix : ScannedRootPrefixes)
+			{
+				if (DeletedPackageName.StartsWith(ScannedRootPrefix, ESearchCase::IgnoreCase))
+				{
+					DirtyRootPaths.Add(ScannedRootPrefix.LeftChop(1));
+				}
+			}
+		}
+
+		const FString CacheDirectory = ResolveRegistryCacheDirectory(InCommandLine);
+		for (const FString& DirtyRootPath : DirtyRootPaths)
+		{
+			FString RootDirectoryPath;
+			if (!FPackageName::TryConvertLongPackageNameToFilename(DirtyRootPath + TEXT("/"), RootDirectoryPath))
+			{
+				continue;
+			}
+			RootDirectoryPath = FPaths::ConvertRelativePathToFull(RootDirectoryPath);
+			FPaths::NormalizeDirectoryName(RootDirectoryPath);
+
+			TMap<FString, FString> CurrentStampByFile;
+			CollectRegistryPackageFileStamps(RootDirectoryPath, CurrentStampByFile);
+
+			const FString CacheKey = BuildRegistryCacheKey(DirtyRootPath);
+			FString SaveErrorCode;
+			FString SaveErrorDetail;
+			if (!SaveRegistryCache(
+				DirtyRootPath,
+				FPaths::Combine(CacheDirectory, FString::Printf(TEXT("registry_state_%s.bin"), *CacheKey)),
+				FPaths::Combine(CacheDirectory, FString::Printf(TEXT("registry_state_%s.json"), *CacheKey)),
+				CurrentStampByFile,
+				SaveErrorCode,
+				SaveErrorDetail))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("%s: %s"), *SaveErrorCode, *SaveErrorDetail);
+			}
+		}
+	}
+
+	void DiffPackageFileStamps(
+		const TMap<FString, FString>& InCachedStampByFile,
+		const TMap<FString, FString>& InCurrentStampByFile,
+		TArray<FString>& OutChangedFiles,
+		TArray<FString>& OutRemovedFiles)
+	{
+		OutChangedFiles.Reset();
+		OutRemovedFiles.Reset();
+		for (const TPair<FString, FString>& CurrentPair : InCurrentStampByFile)
+		{
+			const FString* CachedStampText = InCachedStampByFile.Find(CurrentPair.Key);
+			if (CachedStampText == nullptr || !CachedStampText->Equals(CurrentPair.Value, ESearchCase::CaseSensitive))
+			{
+				OutChangedFiles.Add(CurrentPair.Key);
+			}
+		}
+		for (const TPair<FString, FString>& CachedPair : InCachedStampByFile)
+		{
+			if (!InCurrentStampByFile.Contains(CachedPair.Key))
+			{
+				OutRemovedFiles.Add(CachedPair.Key);
+			}
+		}
+
+		const auto CompareCaseSensitive = [](const FString& Left, const FString& Right)
+		{
+			return Left.Compare(Right, ESearchCase::CaseSensitive) < 0;
+		};
+		OutChangedFiles.Sort(CompareCaseSensitive);
+		OutRemovedFiles.Sort(CompareCaseSensitive);
+	}
+}
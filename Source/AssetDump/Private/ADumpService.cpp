@@ -1,6 +1,11 @@
 // File: ADumpService.cpp
-// Version: v0.15.1
+// Version: v0.20.0
 // Changelog:
+// - v0.20.0: background 저장 경로와 pack/content store 경로를 game thread에서 절대 경로로 확정해 task에는 완성된 문자열만 넘기고, 저장 대기 상태 조회(IsBackgroundSavePending)를 추가.
+// - v0.19.0: 최신 결과 skip 여부와 세션 대상 자산 경로를 다중 자산 queue가 조회할 수 있게 노출.
+// - v0.18.0: frame budget 단위 단계 실행(TickDumpSession)과 game thread에서 fingerprint를 미리 계산한 결과의 background 저장 경로를 추가하고 동기/비동기 저장 결과 반영을 ApplySaveOutcome으로 통합.
+// - v0.17.0: 저장 확인을 dump pack 항목까지 포함하는 ADumpJson::DoesJsonFileExist로 변경.
+// - v0.16.0: 실행 옵션의 output encoding(압축 codec, compact JSON)으로 dump.json과 sidecar를 저장.
 // - v0.15.1: 여러 섹션을 함께 요청할 때 자산 종류별 비지원 input_summary/component_tree가 전체 dump 저장을 중단하지 않도록 교정.
 // - v0.15.0: P5-N1 niagara_material_evidence exact profile activation을 추가하고 Material profile을 Deep superset extraction으로 연결.
 // - v0.14.0: P4-N1 Deep activation을 Profile=niagara_deep_evidence + section_source=profile + exact entity_evidence selection으로 제한.
@@ -46,10 +51,12 @@
 #include "ADumpRefExt.h"
 #include "ADumpSummaryExt.h"
 
+#include "Async/Async.h"
 #include "HAL/FileManager.h"
 #include "HAL/PlatformTime.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "Misc/PackageName.h"
+#include "Misc/Paths.h"
 
 namespace
 {
@@ -227,6 +234,29 @@ namespace
 	}
 }
 
+// FBackgroundSaveState는 background 저장 task에 넘기는 입력과 task가 채우는 결과다. task 완료 전에는 game thread가 읽지 않는다.
+struct FADumpService::FBackgroundSaveState
+{
+	// ResultToWrite는 최종 상태와 fingerprint가 반영된 저장용 결과다.
+	FADumpResult ResultToWrite;
+
+	// ResolvedOutputFilePath는 dump.json 저장 경로다.
+	FString ResolvedOutputFilePath;
+
+	// OutputEncoding은 dump.json/sidecar 저장 형식이다.
+	FADumpOutputEncoding OutputEncoding;
+
+	// bSaveSucceeded와 bOutputFileExists는 저장 호출 결과와 저장 후 파일 확인 결과다.
+	bool bSaveSucceeded = false;
+	bool bOutputFileExists = false;
+
+	// SaveErrorMessage는 저장 실패 사유다.
+	FString SaveErrorMessage;
+
+	// SaveSeconds는 background task 안에서 측정한 저장 시간이다.
+	double SaveSeconds = 0.0;
+};
+
 void FADumpService::ResetSessionState()
 {
 	ActiveRunOpts = FADumpRunOpts();
@@ -238,6 +268,7 @@ void FADumpService::ResetSessionState()
 	WarningCount = 0;
 	ErrorCount = 0;
 	bOutputFileSaved = false;
+	bSkippedUpToDate = false;
 	StatusMessage.Reset();
 	SessionStartSeconds = 0.0;
 }
@@ -457,6 +488,19 @@ void FADumpService::FinalizeStatus(FADumpResult& InOutResult, bool bTreatAsOutpu
 
 bool FADumpService::BeginDumpSession(const FADumpRunOpts& InRunOpts, FString& OutMessage)
 {
+	if (IsBackgroundSaveInFlight())
+	{
+		OutMessage = TEXT("이전 덤프 결과를 백그라운드에서 저장하고 있어 새 세션을 시작할 수 없습니다.");
+		return false;
+	}
+
+	if (BackgroundSaveState.IsValid())
+	{
+		// 완료됐지만 tick이 반영하지 못한 이전 저장 결과는 새 세션 시작 전에 정리한다.
+		FString PendingSaveMessage;
+		CompleteBackgroundSave(PendingSaveMessage);
+	}
+
 	ResetSessionState();
 	ActiveRunOpts = InRunOpts;
 	// 실제 세션은 시작 시점에 writable output을 한 번 확정하고 이후 request/save/skip에서 같은 경로를 재사용한다.
@@ -476,6 +520,13 @@ bool FADumpService::ExecuteNextStep(FString& OutMessage)
 {
 	OutMessage.Reset();
 
+	if (BackgroundSaveState.IsValid())
+	{
+		// 동기 호출자는 진행 중인 background 저장이 끝날 때까지 기다린 뒤 결과를 반영한다.
+		BackgroundSaveFuture.Wait();
+		return CompleteBackgroundSave(OutMessage);
+	}
+
 	if (!bSessionActive)
 	{
 		OutMessage = StatusMessage.IsEmpty() ? TEXT("진행 중인 덤프 세션이 없습니다.") : StatusMessage;
@@ -573,6 +624,7 @@ bool FADumpService::ExecuteNextStep(FString& OutMessage)
 		if (ActiveRunOpts.bSkipIfUpToDate && IsDumpOutputUpToDate(ActiveRunOpts.AssetObjectPath, RequestInfo, ResolvedOutputFilePath))
 		{
 			bOutputFileSaved = true;
+			bSkippedUpToDate = true;
 			ActiveResult.Progress.CurrentPhase = EADumpPhase::Complete;
 			ActiveResult.Progress.PhaseLabel = TEXT("완료");
 			ActiveResult.Progress.DetailLabel = TEXT("최신 dump.json이 이미 있어 이번 실행을 건너뛰었습니다.");
@@ -907,71 +959,228 @@ bool FADumpService::ExecuteNextStep(FString& OutMessage)
 
 	if (ActivePhase == EADumpPhase::Save)
 	{
-		UpdateProgress(
-			EADumpPhase::Save,
-			TEXT("저장"),
-			TEXT("dump.json 파일을 저장하고 있습니다."),
-			GetPhasePercent(EADumpPhase::Save));
-
 		const FString ResolvedOutputFilePath = ActiveRunOpts.ResolveOutputFilePath();
-		FADumpResult ResultToWrite = ActiveResult;
-		FinalizeStatus(ResultToWrite, true);
+		FADumpResult ResultToWrite = PrepareResultToWrite();
 		const double SaveStartSeconds = FPlatformTime::Seconds();
 		FString SaveErrorMessage;
-		if (!SaveDumpJson(ResolvedOutputFilePath, ResultToWrite, SaveErrorMessage))
+		const bool bSaveSucceeded = SaveDumpJson(ResolvedOutputFilePath, ResultToWrite, SaveErrorMessage);
+		const bool bOutputFileExists = bSaveSucceeded && ADumpJson::DoesJsonFileExist(ResolvedOutputFilePath);
+		return ApplySaveOutcome(
+			MoveTemp(ResultToWrite),
+			ResolvedOutputFilePath,
+			bSaveSucceeded,
+			bOutputFileExists,
+			SaveErrorMessage,
+			FPlatformTime::Seconds() - SaveStartSeconds,
+			OutMessage);
+	}
+
+	FinalizeStatus(ActiveResult, bOutputFileSaved);
+	bSessionActive = false;
+	OutMessage = StatusMessage;
+	return ActiveResult.DumpStatus == EADumpStatus::Succeeded
+		|| ActiveResult.DumpStatus == EADumpStatus::PartialSuccess;
+}
+
+FADumpResult FADumpService::PrepareResultToWrite()
+{
+	UpdateProgress(
+		EADumpPhase::Save,
+		TEXT("저장"),
+		TEXT("dump.json 파일을 저장하고 있습니다."),
+		GetPhasePercent(EADumpPhase::Save));
+
+	FADumpResult ResultToWrite = ActiveResult;
+	FinalizeStatus(ResultToWrite, true);
+	return ResultToWrite;
+}
+
+bool FADumpService::ApplySaveOutcome(
+	FADumpResult&& InResultToWrite,
+	const FString& InResolvedOutputFilePath,
+	bool bInSaveSucceeded,
+	bool bInOutputFileExists,
+	const FString& InSaveErrorMessage,
+	double InSaveSeconds,
+	FString& OutMessage)
+{
+	if (!bInSaveSucceeded)
+	{
+		bOutputFileSaved = false;
+		bAllRequestedSectionsSucceeded = false;
+		AddIssue(
+			ActiveResult,
+			TEXT("JSON_SAVE_FAIL"),
+			FString::Printf(TEXT("dump.json 저장에 실패했습니다: %s"), *InSaveErrorMessage),
+			EADumpIssueSeverity::Error,
+			EADumpPhase::Save,
+			InResolvedOutputFilePath);
+		ActiveResult.Perf.SaveSeconds += InSaveSeconds;
+		FinalizeStatus(ActiveResult, false);
+		OutMessage = StatusMessage;
+		bSessionActive = false;
+		return false;
+	}
+
+	bOutputFileSaved = bInOutputFileExists;
+	if (!bOutputFileSaved)
+	{
+		bAllRequestedSectionsSucceeded = false;
+		AddIssue(
+			ActiveResult,
+			TEXT("JSON_SAVE_FAIL"),
+			FString::Printf(TEXT("dump.json 저장 후 파일을 찾지 못했습니다: %s"), *InResolvedOutputFilePath),
+			EADumpIssueSeverity::Error,
+			EADumpPhase::Save,
+			InResolvedOutputFilePath);
+		ActiveResult.Perf.SaveSeconds += InSaveSeconds;
+		FinalizeStatus(ActiveResult, false);
+		OutMessage = StatusMessage;
+		bSessionActive = false;
+		return false;
+	}
+
+	InResultToWrite.Perf.SaveSeconds += InSaveSeconds;
+	if (SessionStartSeconds > 0.0)
+	{
+		InResultToWrite.Perf.TotalSeconds = FPlatformTime::Seconds() - SessionStartSeconds;
+	}
+	ActiveResult = MoveTemp(InResultToWrite);
+	ActivePhase = EADumpPhase::Complete;
+	bSessionActive = false;
+	OutMessage = StatusMessage;
+	return ActiveResult.DumpStatus == EADumpStatus::Succeeded
+		|| ActiveResult.DumpStatus == EADumpStatus::PartialSuccess;
+}
+
+bool FADumpService::TickDumpSession(double InFrameBudgetSeconds, FString& OutMessage)
+{
+	OutMessage.Reset();
+
+	if (BackgroundSaveState.IsValid())
+	{
+		if (!BackgroundSaveFuture.IsReady())
 		{
-			bOutputFileSaved = false;
-			bAllRequestedSectionsSucceeded = false;
-			AddIssue(
-				ActiveResult,
-				TEXT("JSON_SAVE_FAIL"),
-				FString::Printf(TEXT("dump.json 저장에 실패했습니다: %s"), *SaveErrorMessage),
-				EADumpIssueSeverity::Error,
-				EADumpPhase::Save,
-				ResolvedOutputFilePath);
-			ActiveResult.Perf.SaveSeconds += (FPlatformTime::Seconds() - SaveStartSeconds);
-			FinalizeStatus(ActiveResult, false);
-			OutMessage = StatusMessage;
-			bSessionActive = false;
-			return false;
+			return true;
 		}
 
-		bOutputFileSaved = IFileManager::Get().FileExists(*ResolvedOutputFilePath);
-		if (!bOutputFileSaved)
+		return CompleteBackgroundSave(OutMessage);
+	}
+
+	if (!bSessionActive)
+	{
+		return ExecuteNextStep(OutMessage);
+	}
+
+	// 추출 단계는 UObject/reflection을 읽으므로 game thread에서 단계 단위로 실행하고, 한 단계 이상 실행한 뒤 budget을 넘으면 다음 tick으로 넘긴다.
+	const double TickStartSeconds = FPlatformTime::Seconds();
+	TArray<FString> StepMessages;
+	bool bStepSucceeded = true;
+	do
+	{
+		if (ActivePhase == EADumpPhase::Save)
 		{
-			bAllRequestedSectionsSucceeded = false;
-			AddIssue(
-				ActiveResult,
-				TEXT("JSON_SAVE_FAIL"),
-				FString::Printf(TEXT("dump.json 저장 후 파일을 찾지 못했습니다: %s"), *ResolvedOutputFilePath),
-				EADumpIssueSeverity::Error,
-				EADumpPhase::Save,
-				ResolvedOutputFilePath);
-			ActiveResult.Perf.SaveSeconds += (FPlatformTime::Seconds() - SaveStartSeconds);
-			FinalizeStatus(ActiveResult, false);
-			OutMessage = StatusMessage;
-			bSessionActive = false;
-			return false;
+			FString SaveMessage;
+			BeginBackgroundSave(SaveMessage);
+			StepMessages.Add(SaveMessage);
+			break;
 		}
 
-		ResultToWrite.Perf.SaveSeconds += (FPlatformTime::Seconds() - SaveStartSeconds);
-		if (SessionStartSeconds > 0.0)
+		FString StepMessage;
+		bStepSucceeded = ExecuteNextStep(StepMessage);
+		if (!StepMessage.IsEmpty())
 		{
-			ResultToWrite.Perf.TotalSeconds = FPlatformTime::Seconds() - SessionStartSeconds;
+			StepMessages.Add(StepMessage);
 		}
-		ActiveResult = MoveTemp(ResultToWrite);
-		ActivePhase = EADumpPhase::Complete;
-		bSessionActive = false;
-		OutMessage = StatusMessage;
-		return ActiveResult.DumpStatus == EADumpStatus::Succeeded
-			|| ActiveResult.DumpStatus == EADumpStatus::PartialSuccess;
 	}
+	while (bSessionActive && (FPlatformTime::Seconds() - TickStartSeconds) < InFrameBudgetSeconds);
 
-	FinalizeStatus(ActiveResult, bOutputFileSaved);
-	bSessionActive = false;
+	OutMessage = FString::Join(StepMessages, TEXT("\n"));
+	return bStepSucceeded;
+}
+
+bool FADumpService::IsBackgroundSaveInFlight() const
+{
+	return BackgroundSaveState.IsValid() && !BackgroundSaveFuture.IsReady();
+}
+
+bool FADumpService::IsBackgroundSavePending() const
+{
+	return BackgroundSaveState.IsValid();
+}
+
+bool FADumpService::WasSkippedUpToDate() const
+{
+	return bSkippedUpToDate;
+}
+
+void FADumpService::BeginBackgroundSave(FString& OutMessage)
+{
+	TSharedPtr<FBackgroundSaveState, ESPMode::ThreadSafe> SaveState = MakeShared<FBackgroundSaveState, ESPMode::ThreadSafe>();
+
+	// 기본 출력 경로는 IPluginManager/FPaths 설치 경로 조회를 거치므로 game thread에서 절대 경로로 확정하고, task에는 완성된 경로 문자열만 넘긴다.
+	SaveState->ResolvedOutputFilePath = FPaths::ConvertRelativePathToFull(ActiveRunOpts.ResolveOutputFilePath());
+	SaveState->OutputEncoding = ActiveRunOpts.OutputEncoding;
+	if (!SaveState->OutputEncoding.PackFilePath.IsEmpty())
+	{
+		SaveState->OutputEncoding.PackFilePath = FPaths::ConvertRelativePathToFull(SaveState->OutputEncoding.PackFilePath);
+	}
+	if (!SaveState->OutputEncoding.ContentStorePath.IsEmpty())
+	{
+		SaveState->OutputEncoding.ContentStorePath = FPaths::ConvertRelativePathToFull(SaveState->OutputEncoding.ContentStorePath);
+	}
+	SaveState->ResultToWrite = PrepareResultToWrite();
+
+	// fingerprint는 asset/AssetRegistry를 읽으므로 game thread에서 미리 계산해 serializer가 background에서 UObject에 접근하지 않게 한다.
+	SaveState->ResultToWrite.PrecomputedFingerprint = ADumpFingerprint::BuildAssetFingerprint(
+		SaveState->ResultToWrite.Asset.AssetObjectPath,
+		SaveState->ResultToWrite.Request,
+		SaveState->ResultToWrite.SchemaVersion,
+		SaveState->ResultToWrite.ExtractorVersion);
+
+	// 저장은 파일 교체 도중 중단할 수 없으므로 background 저장 중에는 취소를 받지 않는다.
+	ActiveResult.Progress.DetailLabel = TEXT("dump.json 파일을 백그라운드에서 저장하고 있습니다.");
+	ActiveResult.Progress.bIsCancelable = false;
+
+	BackgroundSaveState = SaveState;
+	BackgroundSaveFuture = Async(EAsyncExecution::ThreadPool, [SaveState]()
+	{
+		const double SaveStartSeconds = FPlatformTime::Seconds();
+		SaveState->bSaveSucceeded = ADumpJson::SaveResultToFile(
+			SaveState->ResolvedOutputFilePath,
+			SaveState->ResultToWrite,
+			SaveState->OutputEncoding,
+			SaveState->SaveErrorMessage);
+		SaveState->bOutputFileExists = SaveState->bSaveSucceeded
+			&& ADumpJson::DoesJsonFileExist(SaveState->ResolvedOutputFilePath);
+		SaveState->SaveSeconds = FPlatformTime::Seconds() - SaveStartSeconds;
+	});
+
+	StatusMessage = TEXT("덤프 결과를 백그라운드에서 저장하고 있습니다.");
 	OutMessage = StatusMessage;
-	return ActiveResult.DumpStatus == EADumpStatus::Succeeded
-		|| ActiveResult.DumpStatus == EADumpStatus::PartialSuccess;
+}
+
+bool FADumpService::CompleteBackgroundSave(FString& OutMessage)
+{
+	TSharedPtr<FBackgroundSaveState, ESPMode::ThreadSafe> SaveState = MoveTemp(BackgroundSaveState);
+	BackgroundSaveState.Reset();
+	BackgroundSaveFuture.Reset();
+	if (!SaveState.IsValid())
+	{
+		OutMessage = StatusMessage;
+		return false;
+	}
+
+	// 저장용 결과의 fingerprint는 저장 시점 계산값이므로 세션 결과에는 남기지 않는다.
+	SaveState->ResultToWrite.PrecomputedFingerprint.Reset();
+	return ApplySaveOutcome(
+		MoveTemp(SaveState->ResultToWrite),
+		SaveState->ResolvedOutputFilePath,
+		SaveState->bSaveSucceeded,
+		SaveState->bOutputFileExists,
+		SaveState->SaveErrorMessage,
+		SaveState->SaveSeconds,
+		OutMessage);
 }
 
 bool FADumpService::DumpBlueprint(const FADumpRunOpts& InRunOpts, FADumpResult& OutResult)
@@ -989,7 +1198,7 @@ bool FADumpService::DumpBlueprint(const FADumpRunOpts& InRunOpts, FADumpResult&
 
 bool FADumpService::SaveDumpJson(const FString& InFilePath, const FADumpResult& InResult, FString& OutErrorMessage) const
 {
-	return ADumpJson::SaveResultToFile(InFilePath, InResult, OutErrorMessage);
+	return ADumpJson::SaveResultToFile(InFilePath, InResult, ActiveRunOpts.OutputEncoding, OutErrorMessage);
 }
 
 void FADumpService::CancelDump()
@@ -1029,6 +1238,11 @@ int32 FADumpService::GetErrorCount() const
 	return ErrorCount;
 }
 
+const FString& FADumpService::GetActiveAssetObjectPath() const
+{
+	return ActiveRunOpts.AssetObjectPath;
+}
+
 FString FADumpService::GetResolvedOutputFilePath() const
 {
 	return ActiveRunOpts.ResolveOutputFilePath();
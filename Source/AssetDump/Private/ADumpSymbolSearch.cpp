@@ -0,0 +1,934 @@
+// File: ADumpSymbolSearch.cpp
+// Version: v1.0.2
+// Changelog:
+// - v1.0.2: 전용 static lock/map 대신 ADumpQueryIO::TStampedFileCache로 decode한 index를 재사용.
+// - v1.0.1: decode한 symbol_search_index_v1을 파일 stamp별로 process cache에 두어 query마다 전체 index를 다시 읽지 않고, trigram 중복 제거를 TSet으로 바꿈.
+// - v1.0.0: section_index_v1 symbols에서 token/trigram posting list를 가진 compact symbol_search_index_v1과 -Mode=search를 구현.
+// Migration:
+// - posting list는 오름차순 symbol ordinal의 delta encoding이며 symbol ordinal은 section_index_v1 symbol_entry_id 순서와 같다.
+
+#include "ADumpSymbolSearch.h"
+
+#include "ADumpBPSearchIndex.h"
+#include "ADumpJson.h"
+
+#include "Algo/BinarySearch.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	// SymbolSearchIndexFileName은 dump root 아래 전역 symbol inverted index 파일 이름이다.
+	const TCHAR* SymbolSearchIndexFileName = TEXT("symbol_search_index.json");
+
+	// SymbolSearchTrigramLength는 substring 후보 축소에 쓰는 n-gram 길이다.
+	constexpr int32 SymbolSearchTrigramLength = 3;
+
+	// FSearchAssetRow는 index asset table의 한 행이다.
+	struct FSearchAssetRow
+	{
+		FString AssetId;
+		FString ObjectPath;
+		FString SourceFile;
+	};
+
+	// FSearchSymbolRow는 index symbol table의 한 행이며 AssetOrdinal로 asset table을 참조한다.
+	struct FSearchSymbolRow
+	{
+		FString SymbolEntryId;
+		int32 AssetOrdinal = INDEX_NONE;
+		FString Kind;
+		FString Name;
+		FString NormalizedName;
+		FString GraphName;
+		FString NodeId;
+		FString JsonPointer;
+	};
+
+	// FLoadedSymbolSearchIndex는 decode된 symbol_search_index_v1이다. Tokens/Trigrams는 case-sensitive 오름차순이다.
+	struct FLoadedSymbolSearchIndex
+	{
+		FString GeneratedTime;
+		TArray<FSearchAssetRow> Assets;
+		TArray<FSearchSymbolRow> Symbols;
+		TArray<FString> Tokens;
+		TArray<TArray<int32>> TokenPostings;
+		TArray<FString> Trigrams;
+		TArray<TArray<int32>> TrigramPostings;
+	};
+
+	// SerializeCondensedSearchJson는 on-disk 크기를 줄이기 위해 JSON object를 condensed text로 직렬화한다.
+	bool SerializeCondensedSearchJson(const TSharedRef<FJsonObject>& InRootObject, FString& OutJsonText)
+	{
+		OutJsonText.Reset();
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutJsonText);
+		return FJsonSerializer::Serialize(InRootObject, Writer);
+	}
+
+	// SerializeSearchResultJson는 JSON object를 stable pretty JSON text로 직렬화한다.
+	bool SerializeSearchResultJson(const TSharedRef<FJsonObject>& InRootObject, FString& OutJsonText)
+	{
+		OutJsonText.Reset();
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJsonText);
+		return FJsonSerializer::Serialize(InRootObject, Writer);
+	}
+
+	// LoadSearchJsonObject는 UTF-8 JSON 파일을 object로 읽는다.
+	bool LoadSearchJsonObject(const FString& InFilePath, TSharedPtr<FJsonObject>& OutRootObject)
+	{
+		OutRootObject.Reset();
+		FString JsonText;
+		if (!FFileHelper::LoadFileToString(JsonText, *InFilePath))
+		{
+			return false;
+		}
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
+		return FJsonSerializer::Deserialize(Reader, OutRootObject) && OutRootObject.IsValid();
+	}
+
+	// GetSearchStringField는 없거나 type이 다른 string field를 빈 문자열로 처리한다.
+	FString GetSearchStringField(const TSharedPtr<FJsonObject>& InObject, const TCHAR* InFieldName)
+	{
+		FString Value;
+		if (InObject.IsValid())
+		{
+			InObject->TryGetStringField(InFieldName, Value);
+		}
+		return Value;
+	}
+
+	// GetSearchArrayField는 JSON array field 포인터를 안전하게 읽는다.
+	const TArray<TSharedPtr<FJsonValue>>* GetSearchArrayField(const TSharedPtr<FJsonObject>& InObject, const TCHAR* InFieldName)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		if (!InObject.IsValid() || !InObject->TryGetArrayField(InFieldName, Values))
+		{
+			return nullptr;
+		}
+		return Values;
+	}
+
+	// GetSearchTupleArray는 JSON value가 기대 길이의 array인지 확인하고 포인터를 반환한다.
+	const TArray<TSharedPtr<FJsonValue>>* GetSearchTupleArray(const TSharedPtr<FJsonValue>& InValue, int32 InExpectedLength)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		if (!InValue.IsValid() || !InValue->TryGetArray(Values) || !Values || Values->Num() != InExpectedLength)
+		{
+			return nullptr;
+		}
+		return Values;
+	}
+
+	// GetSearchTupleString은 tuple 위치의 string 값을 읽는다.
+	bool GetSearchTupleString(const TArray<TSharedPtr<FJsonValue>>& InTuple, int32 InIndex, FString& OutValue)
+	{
+		return InTuple.IsValidIndex(InIndex) && InTuple[InIndex].IsValid() && InTuple[InIndex]->TryGetString(OutValue);
+	}
+
+	// NormalizeSearchDumpRoot는 dump root를 절대 normalized directory로 변환한다.
+	FString NormalizeSearchDumpRoot(const FString& InDumpRootPath)
+	{
+		FString NormalizedPath = FPaths::ConvertRelativePathToFull(InDumpRootPath);
+		FPaths::NormalizeDirectoryName(NormalizedPath);
+		return NormalizedPath;
+	}
+
+	// ParseSearchKindList는 comma-separated option을 trimmed lowercase canonical array로 만든다.
+	TArray<FString> ParseSearchKindList(const FString& InText)
+	{
+		TArray<FString> Values;
+		InText.ParseIntoArray(Values, TEXT(","), true);
+		for (FString& Value : Values)
+		{
+			Value.TrimStartAndEndInline();
+			Value.ToLowerInline();
+		}
+		Values.RemoveAll([](const FString& Value)
+		{
+			return Value.IsEmpty();
+		});
+		Values.Sort([](const FString& Left, const FString& Right)
+		{
+			return Left.Compare(Right, ESearchCase::CaseSensitive) < 0;
+		});
+		for (int32 Index = Values.Num() - 1; Index > 0; --Index)
+		{
+			if (Values[Index].Equals(Values[Index - 1], ESearchCase::CaseSensitive))
+			{
+				Values.RemoveAt(Index);
+			}
+		}
+		return Values;
+	}
+
+	// GetSearchOptionValue는 -Key=Value command option을 읽는다.
+	FString GetSearchOptionValue(const FString& InCommandLine, const TCHAR* InKey)
+	{
+		FString Value;
+		FParse::Value(*InCommandLine, InKey, Value);
+		Value.TrimStartAndEndInline();
+		return Value;
+	}
+
+	// GetSearchCommaListOptionValue는 comma separator를 value 일부로 유지해 list option 전체를 읽는다.
+	FString GetSearchCommaListOptionValue(const FString& InCommandLine, const TCHAR* InKey)
+	{
+		FString Value;
+		FParse::Value(*InCommandLine, InKey, Value, false);
+		Value.TrimStartAndEndInline();
+		return Value;
+	}
+
+	// GetSearchIntegerOption은 정수 command option 또는 기본값을 반환한다.
+	int32 GetSearchIntegerOption(const FString& InCommandLine, const TCHAR* InKey, int32 InDefaultValue)
+	{
+		int32 Value = InDefaultValue;
+		FParse::Value(*InCommandLine, InKey, Value);
+		return Value;
+	}
+
+	// SplitSearchTokens는 NormalizeSearchName 결과를 공백 단위 token으로 나눈다.
+	TArray<FString> SplitSearchTokens(const FString& InText)
+	{
+		TArray<FString> Tokens;
+		ADumpBPSearchIndex::NormalizeSearchName(InText).ParseIntoArray(Tokens, TEXT(" "), true);
+		return Tokens;
+	}
+
+	// CollectTrigrams는 normalized 문자열의 고유 trigram을 등장 순서로 모은다. 입력은 이미 소문자라 TSet의 기본 비교로 중복을 가린다.
+	TArray<FString> CollectTrigrams(const FString& InNormalizedText)
+	{
+		TArray<FString> Trigrams;
+		TSet<FString> SeenTrigrams;
+		for (int32 Offset = 0; Offset + SymbolSearchTrigramLength <= InNormalizedText.Len(); ++Offset)
+		{
+			FString Trigram = InNormalizedText.Mid(Offset, SymbolSearchTrigramLength);
+			bool bAlreadySeen = false;
+			SeenTrigrams.Add(Trigram, &bAlreadySeen);
+			if (!bAlreadySeen)
+			{
+				Trigrams.Add(MoveTemp(Trigram));
+			}
+		}
+		return Trigrams;
+	}
+
+	// AddPosting은 key별 posting list에 ordinal을 한 번만 추가한다. ordinal은 오름차순으로 들어온다.
+	void AddPosting(TMap<FString, TArray<int32>>& InOutPostingMap, const FString& InKey, int32 InOrdinal)
+	{
+		TArray<int32>& Postings = InOutPostingMap.FindOrAdd(InKey);
+		if (Postings.IsEmpty() || Postings.Last() != InOrdinal)
+		{
+			Postings.Add(InOrdinal);
+		}
+	}
+
+	// MakePostingTableValues는 posting map을 key 오름차순 [key, [delta...]] tuple 배열로 만든다.
+	TArray<TSharedPtr<FJsonValue>> MakePostingTableValues(const TMap<FString, TArray<int32>>& InPostingMap)
+	{
+		TArray<FString> Keys;
+		InPostingMap.GetKeys(Keys);
+		Keys.Sort([](const FString& Left, const FString& Right)
+		{
+			return Left.Compare(Right, ESearchCase::CaseSensitive) < 0;
+		});
+
+		TArray<TSharedPtr<FJsonValue>> TableValues;
+		TableValues.Reserve(Keys.Num());
+		for (const FString& Key : Keys)
+		{
+			const TArray<int32>& Postings = InPostingMap.FindChecked(Key);
+			TArray<TSharedPtr<FJsonValue>> DeltaValues;
+			DeltaValues.Reserve(Postings.Num());
+			int32 PreviousOrdinal = 0;
+			for (const int32 Ordinal : Postings)
+			{
+				DeltaValues.Add(MakeShared<FJsonValueNumber>(Ordinal - PreviousOrdinal));
+				PreviousOrdinal = Ordinal;
+			}
+			TArray<TSharedPtr<FJsonValue>> TupleValues;
+			TupleValues.Add(MakeShared<FJsonValueString>(Key));
+			TupleValues.Add(MakeShared<FJsonValueArray>(DeltaValues));
+			TableValues.Add(MakeShared<FJsonValueArray>(TupleValues));
+		}
+		return TableValues;
+	}
+
+	// TryDecodePostingTable은 [key, [delta...]] tuple 배열을 정렬 key와 절대 ordinal posting으로 복원한다.
+	bool TryDecodePostingTable(
+		const TArray<TSharedPtr<FJsonValue>>* InTableValues,
+		int32 InSymbolCount,
+		TArray<FString>& OutKeys,
+		TArray<TArray<int32>>& OutPostings)
+	{
+		OutKeys.Reset();
+		OutPostings.Reset();
+		if (!InTableValues)
+		{
+			return false;
+		}
+		OutKeys.Reserve(InTableValues->Num());
+		OutPostings.Reserve(InTableValues->Num());
+		for (const TSharedPtr<FJsonValue>& TupleValue : *InTableValues)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Tuple = GetSearchTupleArray(TupleValue, 2);
+			FString Key;
+			const TArray<TSharedPtr<FJsonValue>>* DeltaValues = nullptr;
+			if (!Tuple
+				|| !GetSearchTupleString(*Tuple, 0, Key)
+				|| Key.IsEmpty()
+				|| !(*Tuple)[1].IsValid()
+				|| !(*Tuple)[1]->TryGetArray(DeltaValues)
+				|| !DeltaValues
+				|| DeltaValues->IsEmpty())
+			{
+				return false;
+			}
+			if (!OutKeys.IsEmpty() && OutKeys.Last().Compare(Key, ESearchCase::CaseSensitive) >= 0)
+			{
+				return false;
+			}
+
+			TArray<int32>& Postings = OutPostings.AddDefaulted_GetRef();
+			Postings.Reserve(DeltaValues->Num());
+			int32 Ordinal = 0;
+			for (int32 DeltaIndex = 0; DeltaIndex < DeltaValues->Num(); ++DeltaIndex)
+			{
+				double DeltaNumber = 0.0;
+				if (!(*DeltaValues)[DeltaIndex].IsValid() || !(*DeltaValues)[DeltaIndex]->TryGetNumber(DeltaNumber))
+				{
+					return false;
+				}
+				const int32 Delta = FMath::RoundToInt(DeltaNumber);
+				if (Delta < 0 || (DeltaIndex > 0 && Delta == 0))
+				{
+					return false;
+				}
+				Ordinal += Delta;
+				if (Ordinal >= InSymbolCount)
+				{
+					return false;
+				}
+				Postings.Add(Ordinal);
+			}
+			OutKeys.Add(MoveTemp(Key));
+		}
+		return true;
+	}
+
+	// TryDecodeSymbolSearchIndex는 symbol_search_index_v1 root를 검증하고 decode한다.
+	bool TryDecodeSymbolSearchIndex(const TSharedPtr<FJsonObject>& InRootObject, FLoadedSymbolSearchIndex& OutIndex)
+	{
+		OutIndex = FLoadedSymbolSearchIndex();
+		OutIndex.GeneratedTime = GetSearchStringField(InRootObject, TEXT("generated_time"));
+
+		const TArray<TSharedPtr<FJsonValue>>* AssetValues = GetSearchArrayField(InRootObject, TEXT("assets"));
+		const TArray<TSharedPtr<FJsonValue>>* SymbolValues = GetSearchArrayField(InRootObject, TEXT("symbols"));
+		if (!AssetValues || !SymbolValues)
+		{
+			return false;
+		}
+
+		OutIndex.Assets.Reserve(AssetValues->Num());
+		for (const TSharedPtr<FJsonValue>& AssetValue : *AssetValues)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Tuple = GetSearchTupleArray(AssetValue, 3);
+			FSearchAssetRow& AssetRow = OutIndex.Assets.AddDefaulted_GetRef();
+			if (!Tuple
+				|| !GetSearchTupleString(*Tuple, 0, AssetRow.AssetId)
+				|| !GetSearchTupleString(*Tuple, 1, AssetRow.ObjectPath)
+				|| !GetSearchTupleString(*Tuple, 2, AssetRow.SourceFile))
+			{
+				return false;
+			}
+		}
+
+		OutIndex.Symbols.Reserve(SymbolValues->Num());
+		for (const TSharedPtr<FJsonValue>& SymbolValue : *SymbolValues)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Tuple = GetSearchTupleArray(SymbolValue, 8);
+			FSearchSymbolRow& SymbolRow = OutIndex.Symbols.AddDefaulted_GetRef();
+			double AssetOrdinalNumber = -1.0;
+			if (!Tuple
+				|| !GetSearchTupleString(*Tuple, 0, SymbolRow.SymbolEntryId)
+				|| !(*Tuple)[1].IsValid()
+				|| !(*Tuple)[1]->TryGetNumber(AssetOrdinalNumber)
+				|| !GetSearchTupleString(*Tuple, 2, SymbolRow.Kind)
+				|| !GetSearchTupleString(*Tuple, 3, SymbolRow.Name)
+				|| !GetSearchTupleString(*Tuple, 4, SymbolRow.NormalizedName)
+				|| !GetSearchTupleString(*Tuple, 5, SymbolRow.GraphName)
+				|| !GetSearchTupleString(*Tuple, 6, SymbolRow.NodeId)
+				|| !GetSearchTupleString(*Tuple, 7, SymbolRow.JsonPointer))
+			{
+				return false;
+			}
+			SymbolRow.AssetOrdinal = FMath::RoundToInt(AssetOrdinalNumber);
+			if (!OutIndex.Assets.IsValidIndex(SymbolRow.AssetOrdinal))
+			{
+				return false;
+			}
+		}
+
+		return TryDecodePostingTable(GetSearchArrayField(InRootObject, TEXT("tokens")), OutIndex.Symbols.Num(), OutIndex.Tokens, OutIndex.TokenPostings)
+			&& TryDecodePostingTable(GetSearchArrayField(InRootObject, TEXT("trigrams")), OutIndex.Symbols.Num(), OutIndex.Trigrams, OutIndex.TrigramPostings);
+	}
+
+	// LoadCachedSymbolSearchIndex는 symbol_search_index.json을 검증·decode하고, 파일 stamp가 같으면 이전 query의 decode 결과를 그대로 쓴다.
+	bool LoadCachedSymbolSearchIndex(
+		const FString& InIndexPath,
+		TSharedPtr<const FLoadedSymbolSearchIndex>& OutIndex,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		static ADumpQueryIO::TStampedFileCache<TSharedPtr<const FLoadedSymbolSearchIndex>> IndexCache;
+
+		OutIndex.Reset();
+		return IndexCache.FindOrLoad(InIndexPath, OutIndex, [&](TSharedPtr<const FLoadedSymbolSearchIndex>& OutLoadedIndex)
+		{
+			TSharedPtr<FJsonObject> IndexRoot;
+			if (!LoadSearchJsonObject(InIndexPath, IndexRoot))
+			{
+				OutErrorCode = TEXT("ADUMP_SEARCH_INDEX_JSON_INVALID");
+				OutErrorDetail = TEXT("symbol_search_index.json is not valid JSON.");
+				return false;
+			}
+			if (GetSearchStringField(IndexRoot, TEXT("schema_version")) != TEXT("symbol_search_index_v1"))
+			{
+				OutErrorCode = TEXT("ADUMP_SEARCH_INDEX_SCHEMA_UNSUPPORTED");
+				OutErrorDetail = TEXT("search requires symbol_search_index_v1.");
+				return false;
+			}
+			TSharedRef<FLoadedSymbolSearchIndex> DecodedIndex = MakeShared<FLoadedSymbolSearchIndex>();
+			if (!TryDecodeSymbolSearchIndex(IndexRoot, *DecodedIndex))
+			{
+				OutErrorCode = TEXT("ADUMP_SEARCH_INDEX_JSON_INVALID");
+				OutErrorDetail = TEXT("symbol_search_index.json tables are malformed.");
+				return false;
+			}
+			OutLoadedIndex = DecodedIndex;
+			return true;
+		});
+	}
+
+	// LowerBoundKey는 case-sensitive 오름차순 key 배열에서 InKey 이상인 첫 위치를 찾는다.
+	int32 LowerBoundKey(const TArray<FString>& InSortedKeys, const FString& InKey)
+	{
+		return Algo::LowerBound(InSortedKeys, InKey, [](const FString& Left, const FString& Right)
+		{
+			return Left.Compare(Right, ESearchCase::CaseSensitive) < 0;
+		});
+	}
+
+	// FindExactKey는 정렬 key 배열에서 정확히 일치하는 key 위치를 찾는다.
+	int32 FindExactKey(const TArray<FString>& InSortedKeys, const FString& InKey)
+	{
+		const int32 KeyIndex = LowerBoundKey(InSortedKeys, InKey);
+		return InSortedKeys.IsValidIndex(KeyIndex) && InSortedKeys[KeyIndex].Equals(InKey, ESearchCase::CaseSensitive)
+			? KeyIndex
+			: INDEX_NONE;
+	}
+
+	// IntersectPostings는 두 오름차순 posting list의 교집합을 만든다.
+	TArray<int32> IntersectPostings(const TArray<int32>& InLeft, const TArray<int32>& InRight)
+	{
+		TArray<int32> Result;
+		Result.Reserve(FMath::Min(InLeft.Num(), InRight.Num()));
+		int32 LeftIndex = 0;
+		int32 RightIndex = 0;
+		while (LeftIndex < InLeft.Num() && RightIndex < InRight.Num())
+		{
+			if (InLeft[LeftIndex] < InRight[RightIndex])
+			{
+				++LeftIndex;
+			}
+			else if (InRight[RightIndex] < InLeft[LeftIndex])
+			{
+				++RightIndex;
+			}
+			else
+			{
+				Result.Add(InLeft[LeftIndex]);
+				++LeftIndex;
+				++RightIndex;
+			}
+		}
+		return Result;
+	}
+
+	// CollectPrefixPostings는 InPrefix로 시작하는 모든 token posting의 합집합을 오름차순으로 만든다.
+	TArray<int32> CollectPrefixPostings(const FLoadedSymbolSearchIndex& InIndex, const FString& InPrefix)
+	{
+		TArray<int32> Result;
+		for (int32 TokenIndex = LowerBoundKey(InIndex.Tokens, InPrefix);
+			TokenIndex < InIndex.Tokens.Num() && InIndex.Tokens[TokenIndex].StartsWith(InPrefix, ESearchCase::CaseSensitive);
+			++TokenIndex)
+		{
+			Result.Append(InIndex.TokenPostings[TokenIndex]);
+		}
+		Result.Sort();
+		int32 UniqueCount = 0;
+		for (int32 Index = 0; Index < Result.Num(); ++Index)
+		{
+			if (UniqueCount == 0 || Result[UniqueCount - 1] != Result[Index])
+			{
+				Result[UniqueCount++] = Result[Index];
+			}
+		}
+		Result.SetNum(UniqueCount, EAllowShrinking::No);
+		return Result;
+	}
+
+	// MakeAllOrdinals는 posting 축소가 불가능한 짧은 substring query의 전체 후보를 만든다.
+	TArray<int32> MakeAllOrdinals(int32 InSymbolCount)
+	{
+		TArray<int32> Result;
+		Result.Reserve(InSymbolCount);
+		for (int32 Ordinal = 0; Ordinal < InSymbolCount; ++Ordinal)
+		{
+			Result.Add(Ordinal);
+		}
+		return Result;
+	}
+
+	// FindMatchingOrdinals는 match mode별 posting 교집합과 최종 검증으로 일치 symbol ordinal을 오름차순으로 반환한다.
+	TArray<int32> FindMatchingOrdinals(
+		const FLoadedSymbolSearchIndex& InIndex,
+		const FString& InNormalizedQuery,
+		const FString& InMatchMode)
+	{
+		TArray<FString> QueryTokens;
+		InNormalizedQuery.ParseIntoArray(QueryTokens, TEXT(" "), true);
+
+		TArray<int32> Candidates;
+		if (InMatchMode == TEXT("substring"))
+		{
+			const TArray<FString> QueryTrigrams = CollectTrigrams(InNormalizedQuery);
+			if (QueryTrigrams.IsEmpty())
+			{
+				Candidates = MakeAllOrdinals(InIndex.Symbols.Num());
+			}
+			for (int32 TrigramIndex = 0; TrigramIndex < QueryTrigrams.Num(); ++TrigramIndex)
+			{
+				const int32 KeyIndex = FindExactKey(InIndex.Trigrams, QueryTrigrams[TrigramIndex]);
+				if (KeyIndex == INDEX_NONE)
+				{
+					return TArray<int32>();
+				}
+				Candidates = TrigramIndex == 0
+					? InIndex.TrigramPostings[KeyIndex]
+					: IntersectPostings(Candidates, InIndex.TrigramPostings[KeyIndex]);
+			}
+			Candidates.RemoveAll([&InIndex, &InNormalizedQuery](int32 Ordinal)
+			{
+				return !InIndex.Symbols[Ordinal].NormalizedName.Contains(InNormalizedQuery, ESearchCase::CaseSensitive);
+			});
+			return Candidates;
+		}
+
+		const bool bExact = InMatchMode == TEXT("exact");
+		for (int32 TokenIndex = 0; TokenIndex < QueryTokens.Num(); ++TokenIndex)
+		{
+			TArray<int32> TokenPostings;
+			if (bExact)
+			{
+				const int32 KeyIndex = FindExactKey(InIndex.Tokens, QueryTokens[TokenIndex]);
+				if (KeyIndex == INDEX_NONE)
+				{
+					return TArray<int32>();
+				}
+				TokenPostings = InIndex.TokenPostings[KeyIndex];
+			}
+			else
+			{
+				TokenPostings = CollectPrefixPostings(InIndex, QueryTokens[TokenIndex]);
+			}
+			Candidates = TokenIndex == 0 ? MoveTemp(TokenPostings) : IntersectPostings(Candidates, TokenPostings);
+			if (Candidates.IsEmpty())
+			{
+				return Candidates;
+			}
+		}
+		if (bExact)
+		{
+			Candidates.RemoveAll([&InIndex, &InNormalizedQuery](int32 Ordinal)
+			{
+				return !InIndex.Symbols[Ordinal].NormalizedName.Equals(InNormalizedQuery, ESearchCase::CaseSensitive);
+			});
+		}
+		return Candidates;
+	}
+
+	// MakeSearchCursorHash는 index 생성 시각/schema/query/offset binding checksum을 만든다.
+	FString MakeSearchCursorHash(
+		const FString& InGeneratedTime,
+		const FString& InNormalizedQuery,
+		int32 InOffset)
+	{
+		const FString BoundText = FString::Printf(
+			TEXT("%s|symbol_search_result_v1|%s|%d"),
+			*InGeneratedTime,
+			*InNormalizedQuery,
+			InOffset);
+		return FString::Printf(TEXT("%08X"), FCrc::StrCrc32(*BoundText));
+	}
+
+	// BuildSearchCursor는 result offset에 결합된 opaque cursor를 만든다.
+	FString BuildSearchCursor(
+		const FString& InGeneratedTime,
+		const FString& InNormalizedQuery,
+		int32 InOffset)
+	{
+		return FString::Printf(
+			TEXT("sc1.%d.%s"),
+			InOffset,
+			*MakeSearchCursorHash(InGeneratedTime, InNormalizedQuery, InOffset));
+	}
+
+	// ParseSearchCursor는 cursor format과 binding을 분리 검증한다.
+	bool ParseSearchCursor(
+		const FString& InCursor,
+		const FString& InGeneratedTime,
+		const FString& InNormalizedQuery,
+		int32& OutOffset,
+		bool& bOutStale)
+	{
+		OutOffset = 0;
+		bOutStale = false;
+		if (InCursor.IsEmpty())
+		{
+			return true;
+		}
+		TArray<FString> Parts;
+		InCursor.ParseIntoArray(Parts, TEXT("."), false);
+		if (Parts.Num() != 3 || Parts[0] != TEXT("sc1") || !Parts[1].IsNumeric() || Parts[2].Len() != 8)
+		{
+			return false;
+		}
+		OutOffset = FCString::Atoi(*Parts[1]);
+		if (OutOffset < 0)
+		{
+			return false;
+		}
+		const FString ExpectedHash = MakeSearchCursorHash(InGeneratedTime, InNormalizedQuery, OutOffset);
+		if (!Parts[2].Equals(ExpectedHash, ESearchCase::IgnoreCase))
+		{
+			bOutStale = true;
+			return false;
+		}
+		return true;
+	}
+
+	// MakeSearchResultObject는 symbol row를 section_index_v1 위치 정보와 함께 result object로 만든다.
+	TSharedRef<FJsonObject> MakeSearchResultObject(const FLoadedSymbolSearchIndex& InIndex, int32 InOrdinal)
+	{
+		const FSearchSymbolRow& SymbolRow = InIndex.Symbols[InOrdinal];
+		const FSearchAssetRow& AssetRow = InIndex.Assets[SymbolRow.AssetOrdinal];
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetStringField(TEXT("symbol_entry_id"), SymbolRow.SymbolEntryId);
+		ResultObject->SetStringField(TEXT("kind"), SymbolRow.Kind);
+		ResultObject->SetStringField(TEXT("name"), SymbolRow.Name);
+		ResultObject->SetStringField(TEXT("normalized_name"), SymbolRow.NormalizedName);
+		ResultObject->SetStringField(TEXT("asset_id"), AssetRow.AssetId);
+		ResultObject->SetStringField(TEXT("object_path"), AssetRow.ObjectPath);
+		ResultObject->SetStringField(TEXT("graph_name"), SymbolRow.GraphName);
+		ResultObject->SetStringField(TEXT("node_id"), SymbolRow.NodeId);
+		ResultObject->SetStringField(TEXT("source_file"), AssetRow.SourceFile);
+		ResultObject->SetStringField(TEXT("json_pointer"), SymbolRow.JsonPointer);
+		return ResultObject;
+	}
+}
+
+namespace ADumpSymbolSearch
+{
+	bool BuildSymbolSearchIndex(
+		const FString& InDumpRootPath,
+		FString& OutSymbolSearchIndexFilePath,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutSymbolSearchIndexFilePath.Reset();
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+		auto Fail = [&](const TCHAR* InCode, const FString& InDetail)
+		{
+			OutErrorCode = InCode;
+			OutErrorDetail = InDetail;
+			return false;
+		};
+
+		const FString NormalizedDumpRoot = NormalizeSearchDumpRoot(InDumpRootPath);
+		const FString SectionIndexPath = FPaths::Combine(NormalizedDumpRoot, TEXT("section_index.json"));
+		if (!IFileManager::Get().FileExists(*SectionIndexPath))
+		{
+			return Fail(TEXT("ADUMP_SEARCH_SECTION_INDEX_NOT_FOUND"), TEXT("section_index.json must exist before symbol_search_index_v1 is built."));
+		}
+		TSharedPtr<FJsonObject> SectionIndexRoot;
+		if (!LoadSearchJsonObject(SectionIndexPath, SectionIndexRoot))
+		{
+			return Fail(TEXT("ADUMP_SEARCH_SECTION_INDEX_JSON_INVALID"), TEXT("section_index.json is not readable while building symbol_search_index_v1."));
+		}
+		if (GetSearchStringField(SectionIndexRoot, TEXT("schema_version")) != TEXT("section_index_v1"))
+		{
+			return Fail(TEXT("ADUMP_SEARCH_SECTION_INDEX_SCHEMA_UNSUPPORTED"), TEXT("symbol_search_index_v1 requires section_index_v1."));
+		}
+		const TArray<TSharedPtr<FJsonValue>>* SectionSymbolValues = GetSearchArrayField(SectionIndexRoot, TEXT("symbols"));
+		if (!SectionSymbolValues)
+		{
+			return Fail(TEXT("ADUMP_SEARCH_SECTION_INDEX_JSON_INVALID"), TEXT("section_index.json has no symbols array."));
+		}
+
+		// AssetOrdinalByObjectPath는 symbol row가 공유하는 asset table 위치다.
+		TMap<FString, int32> AssetOrdinalByObjectPath;
+		TArray<TSharedPtr<FJsonValue>> AssetTableValues;
+		TArray<TSharedPtr<FJsonValue>> SymbolTableValues;
+		SymbolTableValues.Reserve(SectionSymbolValues->Num());
+		TMap<FString, TArray<int32>> TokenPostingMap;
+		TMap<FString, TArray<int32>> TrigramPostingMap;
+
+		for (int32 Ordinal = 0; Ordinal < SectionSymbolValues->Num(); ++Ordinal)
+		{
+			const TSharedPtr<FJsonObject> SymbolObject = (*SectionSymbolValues)[Ordinal].IsValid()
+				? (*SectionSymbolValues)[Ordinal]->AsObject()
+				: nullptr;
+			const FString ObjectPath = GetSearchStringField(SymbolObject, TEXT("object_path"));
+			if (!SymbolObject.IsValid() || ObjectPath.IsEmpty())
+			{
+				return Fail(TEXT("ADUMP_SEARCH_SECTION_INDEX_JSON_INVALID"), FString::Printf(TEXT("section_index.json symbol %d has no object_path."), Ordinal));
+			}
+
+			int32 AssetOrdinal = INDEX_NONE;
+			if (const int32* ExistingOrdinal = AssetOrdinalByObjectPath.Find(ObjectPath))
+			{
+				AssetOrdinal = *ExistingOrdinal;
+			}
+			else
+			{
+				AssetOrdinal = AssetTableValues.Num();
+				AssetOrdinalByObjectPath.Add(ObjectPath, AssetOrdinal);
+				TArray<TSharedPtr<FJsonValue>> AssetTuple;
+				AssetTuple.Add(MakeShared<FJsonValueString>(GetSearchStringField(SymbolObject, TEXT("asset_id"))));
+				AssetTuple.Add(MakeShared<FJsonValueString>(ObjectPath));
+				AssetTuple.Add(MakeShared<FJsonValueString>(GetSearchStringField(SymbolObject, TEXT("source_file"))));
+				AssetTableValues.Add(MakeShared<FJsonValueArray>(AssetTuple));
+			}
+
+			const FString NormalizedName = ADumpBPSearchIndex::NormalizeSearchName(GetSearchStringField(SymbolObject, TEXT("normalized_name")));
+			TArray<TSharedPtr<FJsonValue>> SymbolTuple;
+			SymbolTuple.Add(MakeShared<FJsonValueString>(GetSearchStringField(SymbolObject, TEXT("symbol_entry_id"))));
+			SymbolTuple.Add(MakeShared<FJsonValueNumber>(AssetOrdinal));
+			SymbolTuple.Add(MakeShared<FJsonValueString>(GetSearchStringField(SymbolObject, TEXT("kind"))));
+			SymbolTuple.Add(MakeShared<FJsonValueString>(GetSearchStringField(SymbolObject, TEXT("name"))));
+			SymbolTuple.Add(MakeShared<FJsonValueString>(NormalizedName));
+			SymbolTuple.Add(MakeShared<FJsonValueString>(GetSearchStringField(SymbolObject, TEXT("graph_name"))));
+			SymbolTuple.Add(MakeShared<FJsonValueString>(GetSearchStringField(SymbolObject, TEXT("node_id"))));
+			SymbolTuple.Add(MakeShared<FJsonValueString>(GetSearchStringField(SymbolObject, TEXT("json_pointer"))));
+			SymbolTableValues.Add(MakeShared<FJsonValueArray>(SymbolTuple));
+
+			// TermTexts는 token posting 입력이며 normalized_name과 bp_search_index search_terms를 함께 색인한다.
+			TArray<FString> TermTexts;
+			TermTexts.Add(NormalizedName);
+			if (const TArray<TSharedPtr<FJsonValue>>* SearchTermValues = GetSearchArrayField(SymbolObject, TEXT("search_terms")))
+			{
+				for (const TSharedPtr<FJsonValue>& SearchTermValue : *SearchTermValues)
+				{
+					FString SearchTerm;
+					if (SearchTermValue.IsValid() && SearchTermValue->TryGetString(SearchTerm))
+					{
+						TermTexts.Add(SearchTerm);
+					}
+				}
+			}
+			for (const FString& TermText : TermTexts)
+			{
+				for (const FString& Token : SplitSearchTokens(TermText))
+				{
+					AddPosting(TokenPostingMap, Token, Ordinal);
+				}
+			}
+			for (const FString& Trigram : CollectTrigrams(NormalizedName))
+			{
+				AddPosting(TrigramPostingMap, Trigram, Ordinal);
+			}
+		}
+
+		TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+		RootObject->SetStringField(TEXT("schema_version"), TEXT("symbol_search_index_v1"));
+		RootObject->SetStringField(TEXT("generated_time"), FDateTime::UtcNow().ToIso8601());
+		RootObject->SetStringField(TEXT("section_index_schema_version"), TEXT("section_index_v1"));
+		RootObject->SetStringField(TEXT("section_index_generated_time"), GetSearchStringField(SectionIndexRoot, TEXT("generated_time")));
+		RootObject->SetStringField(TEXT("posting_encoding"), TEXT("delta_ordinal_v1"));
+		RootObject->SetNumberField(TEXT("trigram_length"), SymbolSearchTrigramLength);
+		RootObject->SetNumberField(TEXT("asset_count"), AssetTableValues.Num());
+		RootObject->SetNumberField(TEXT("symbol_count"), SymbolTableValues.Num());
+		RootObject->SetNumberField(TEXT("token_count"), TokenPostingMap.Num());
+		RootObject->SetNumberField(TEXT("trigram_count"), TrigramPostingMap.Num());
+		RootObject->SetArrayField(TEXT("assets"), AssetTableValues);
+		RootObject->SetArrayField(TEXT("symbols"), SymbolTableValues);
+		RootObject->SetArrayField(TEXT("tokens"), MakePostingTableValues(TokenPostingMap));
+		RootObject->SetArrayField(TEXT("trigrams"), MakePostingTableValues(TrigramPostingMap));
+
+		FString IndexJsonText;
+		if (!SerializeCondensedSearchJson(RootObject, IndexJsonText))
+		{
+			return Fail(TEXT("ADUMP_SEARCH_INDEX_WRITE_FAILED"), TEXT("Failed to serialize symbol_search_index_v1."));
+		}
+		OutSymbolSearchIndexFilePath = FPaths::Combine(NormalizedDumpRoot, SymbolSearchIndexFileName);
+		FString SaveError;
+		if (!ADumpJson::SaveJsonTextToFile(OutSymbolSearchIndexFilePath, IndexJsonText, SaveError))
+		{
+			OutSymbolSearchIndexFilePath.Reset();
+			return Fail(TEXT("ADUMP_SEARCH_INDEX_WRITE_FAILED"), FString::Printf(TEXT("Failed to atomically save symbol_search_index_v1: %s"), *SaveError));
+		}
+		return true;
+	}
+
+	bool BuildSymbolSearchJson(
+		const FString& InCommandLine,
+		FString& OutJsonText,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutJsonText.Reset();
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+		auto Fail = [&](const TCHAR* InCode, const FString& InDetail)
+		{
+			OutErrorCode = InCode;
+			OutErrorDetail = InDetail;
+			return false;
+		};
+
+		FString DumpRoot = GetSearchOptionValue(InCommandLine, TEXT("DumpRoot="));
+		if (DumpRoot.IsEmpty())
+		{
+			DumpRoot = FPaths::Combine(ADumpJson::BuildDefaultDumpRootDirectory(), TEXT("BPDump"));
+		}
+
+		const FString QueryText = GetSearchOptionValue(InCommandLine, TEXT("Query="));
+		const FString NormalizedQuery = ADumpBPSearchIndex::NormalizeSearchName(QueryText);
+		if (NormalizedQuery.IsEmpty())
+		{
+			return Fail(TEXT("ADUMP_SEARCH_QUERY_REQUIRED"), TEXT("search requires a non-empty -Query=."));
+		}
+
+		FString MatchMode = GetSearchOptionValue(InCommandLine, TEXT("Match="));
+		if (MatchMode.IsEmpty()) MatchMode = TEXT("prefix");
+		MatchMode.ToLowerInline();
+		if (MatchMode != TEXT("prefix") && MatchMode != TEXT("substring") && MatchMode != TEXT("exact"))
+		{
+			return Fail(TEXT("ADUMP_SEARCH_MATCH_UNSUPPORTED"), TEXT("search match must be prefix, substring or exact."));
+		}
+
+		FString KindsText = GetSearchCommaListOptionValue(InCommandLine, TEXT("Kinds="));
+		if (KindsText.IsEmpty()) KindsText = GetSearchCommaListOptionValue(InCommandLine, TEXT("Kind="));
+		const TArray<FString> Kinds = ParseSearchKindList(KindsText);
+
+		const int32 Limit = GetSearchIntegerOption(InCommandLine, TEXT("Limit="), 50);
+		if (Limit < 1 || Limit > 200)
+		{
+			return Fail(TEXT("ADUMP_SEARCH_BOUNDS_INVALID"), TEXT("search Limit must be between 1 and 200."));
+		}
+
+		const double StartSeconds = FPlatformTime::Seconds();
+		const FString IndexPath = FPaths::Combine(NormalizeSearchDumpRoot(DumpRoot), SymbolSearchIndexFileName);
+		if (!IFileManager::Get().FileExists(*IndexPath))
+		{
+			return Fail(TEXT("ADUMP_SEARCH_INDEX_NOT_FOUND"), TEXT("symbol_search_index.json was not found. Run -Mode=index first."));
+		}
+		TSharedPtr<const FLoadedSymbolSearchIndex> IndexPtr;
+		if (!LoadCachedSymbolSearchIndex(IndexPath, IndexPtr, OutErrorCode, OutErrorDetail))
+		{
+			return false;
+		}
+		const FLoadedSymbolSearchIndex& Index = *IndexPtr;
+		const double LoadedSeconds = FPlatformTime::Seconds();
+
+		// CanonicalQuery는 cursor binding에 쓰는 정규화 query 문자열이다.
+		const FString CanonicalQuery = FString::Printf(
+			TEXT("%s|%s|%s|%d"),
+			*NormalizedQuery,
+			*MatchMode,
+			*FString::Join(Kinds, TEXT(",")),
+			Limit);
+		const FString Cursor = GetSearchOptionValue(InCommandLine, TEXT("Cursor="));
+		int32 Offset = 0;
+		bool bCursorStale = false;
+		if (!ParseSearchCursor(Cursor, Index.GeneratedTime, CanonicalQuery, Offset, bCursorStale))
+		{
+			return bCursorStale
+				? Fail(TEXT("ADUMP_SEARCH_CURSOR_STALE"), TEXT("Cursor does not match the current symbol_search_index_v1 or query."))
+				: Fail(TEXT("ADUMP_SEARCH_CURSOR_INVALID"), TEXT("Cursor format is invalid."));
+		}
+
+		TArray<int32> MatchOrdinals = FindMatchingOrdinals(Index, NormalizedQuery, MatchMode);
+		if (!Kinds.IsEmpty())
+		{
+			MatchOrdinals.RemoveAll([&Index, &Kinds](int32 Ordinal)
+			{
+				return !Kinds.Contains(Index.Symbols[Ordinal].Kind.ToLower());
+			});
+		}
+		if (Offset > MatchOrdinals.Num())
+		{
+			return Fail(TEXT("ADUMP_SEARCH_CURSOR_INVALID"), TEXT("Cursor offset is past the end of the result set."));
+		}
+
+		const int32 EndOffset = FMath::Min(Offset + Limit, MatchOrdinals.Num());
+		TArray<TSharedPtr<FJsonValue>> ResultValues;
+		ResultValues.Reserve(EndOffset - Offset);
+		for (int32 ResultIndex = Offset; ResultIndex < EndOffset; ++ResultIndex)
+		{
+			ResultValues.Add(MakeShared<FJsonValueObject>(MakeSearchResultObject(Index, MatchOrdinals[ResultIndex])));
+		}
+		const bool bHasMore = EndOffset < MatchOrdinals.Num();
+		const double QueriedSeconds = FPlatformTime::Seconds();
+
+		TSharedRef<FJsonObject> QueryObject = MakeShared<FJsonObject>();
+		QueryObject->SetStringField(TEXT("text"), QueryText);
+		QueryObject->SetStringField(TEXT("normalized"), NormalizedQuery);
+		QueryObject->SetStringField(TEXT("match"), MatchMode);
+		TArray<TSharedPtr<FJsonValue>> KindValues;
+		for (const FString& Kind : Kinds)
+		{
+			KindValues.Add(MakeShared<FJsonValueString>(Kind));
+		}
+		QueryObject->SetArrayField(TEXT("kinds"), KindValues);
+		QueryObject->SetNumberField(TEXT("limit"), Limit);
+		QueryObject->SetNumberField(TEXT("offset"), Offset);
+
+		TSharedRef<FJsonObject> IndexObject = MakeShared<FJsonObject>();
+		IndexObject->SetStringField(TEXT("schema_version"), TEXT("symbol_search_index_v1"));
+		IndexObject->SetStringField(TEXT("generated_time"), Index.GeneratedTime);
+		IndexObject->SetNumberField(TEXT("symbol_count"), Index.Symbols.Num());
+
+		TSharedRef<FJsonObject> PerfObject = MakeShared<FJsonObject>();
+		PerfObject->SetNumberField(TEXT("load_ms"), (LoadedSeconds - StartSeconds) * 1000.0);
+		PerfObject->SetNumberField(TEXT("query_ms"), (QueriedSeconds - LoadedSeconds) * 1000.0);
+
+		TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+		RootObject->SetStringField(TEXT("schema_version"), TEXT("symbol_search_result_v1"));
+		RootObject->SetObjectField(TEXT("query"), QueryObject);
+		RootObject->SetObjectField(TEXT("index"), IndexObject);
+		RootObject->SetNumberField(TEXT("total_match_count"), MatchOrdinals.Num());
+		RootObject->SetNumberField(TEXT("returned_count"), ResultValues.Num());
+		RootObject->SetBoolField(TEXT("has_more"), bHasMore);
+		RootObject->SetStringField(TEXT("next_cursor"), bHasMore ? BuildSearchCursor(Index.GeneratedTime, CanonicalQuery, EndOffset) : FString());
+		RootObject->SetArrayField(TEXT("results"), ResultValues);
+		RootObject->SetObjectField(TEXT("perf"), PerfObject);
+
+		if (!SerializeSearchResultJson(RootObject, OutJsonText))
+		{
+			return Fail(TEXT("ADUMP_SEARCH_SERIALIZE_FAILED"), TEXT("Failed to serialize symbol_search_result_v1."));
+		}
+		return true;
+	}
+}
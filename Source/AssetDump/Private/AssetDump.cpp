@@ -1,13 +1,20 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 // File: AssetDump.cpp
-// Version: v0.1.1
+// Version: v0.3.1
 // Changelog:
+// - v0.3.1: module 종료 시 자동 재덤프 다음에 전역 실행 컨트롤러의 core ticker를 해제.
+// - v0.3.0: module 시작 시 플러그인 Dumped 기본 dump root를 AssetDumpQuery module에 등록.
+// - v0.2.0: module 시작/종료에 opt-in 자동 재덤프(FADumpAutoRedump) 설정 복원과 해제를 연결.
 // - v0.1.1: UE 5.7 호환성을 위해 UToolMenus::IsToolMenusAvailable 호출을 TryGet 기반 검사로 교체.
 
 #include "AssetDump.h"
 
+#include "ADumpAutoRedump.h"
+#include "ADumpExecCtrl.h"
 #include "ADumpEditorTab.h"
+#include "ADumpJson.h"
+#include "ADumpQueryIO.h"
 
 #include "ToolMenus.h"
 #include "Widgets/Docking/SDockTab.h"
@@ -24,6 +31,9 @@ namespace
 
 void FAssetDumpModule::StartupModule()
 {
+	// 에디터 없이 빌드되는 query module은 플러그인 경로를 모르므로 에디터가 계산한 기본 dump root를 넘겨 둔다.
+	ADumpQueryIO::SetDefaultDumpRootDirectory(ADumpJson::BuildDefaultDumpRootDirectory());
+
 	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(
 		AssetDumpTabName,
 		FOnSpawnTab::CreateRaw(this, &FAssetDumpModule::HandleSpawnAssetDumpTab))
@@ -32,10 +42,16 @@ void FAssetDumpModule::StartupModule()
 
 	UToolMenus::RegisterStartupCallback(
 		FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FAssetDumpModule::RegisterMenus));
+
+	FADumpAutoRedump::Get().Startup();
 }
 
 void FAssetDumpModule::ShutdownModule()
 {
+	FADumpAutoRedump::Get().Shutdown();
+	// 자동 재덤프가 맡긴 queue도 전역 컨트롤러 ticker로 진행하므로 그 다음에 해제한다.
+	FADumpExecCtrl::Get().Shutdown();
+
 	// ToolMenusSubsystem은 엔진 종료 순서상 이미 정리되었을 수 있으므로 TryGet으로 안전하게 확인한다.
 	if (UToolMenus::TryGet())
 	{
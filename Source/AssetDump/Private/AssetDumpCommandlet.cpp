@@ -1,6 +1,48 @@
 // File: AssetDumpCommandlet.cpp
-// Version: v0.24.2
+// Version: v0.39.24
 // Changelog:
+// - v0.39.24: 전체 batchdump도 pack commit 성공 뒤 batch_file_state_v1 cache를 갱신하고, closure 판정이 skip 전에 디스크 manifest 옵션 키를 cache 옵션 키와 비교. batch_file_state_refresh 스모크 검사를 추가.
+// - v0.39.23: watch 삭제가 -Pack=true dump의 pack 항목을 다음 commit TOC에서 빼고, 삭제 package를 registry와 상태 cache에서 지움. watch_pack_deletion 스모크 검사를 추가.
+// - v0.39.22: sectiondump 위임 전에 -Sections=/-Intent=/-Profile= 이름, -Output=, -Sections= 필수, 선택 source 순서로 인자를 검사해 기존 오류 코드를 유지하고 section_dump_argument_order 스모크 검사를 추가.
+// - v0.39.21: smoke check fixture root 생성/초기화/정리를 FCommandletSmokeFixtureRoot 하나로 모으고 check별 root 사용 이유 주석을 따로 적음.
+// - v0.39.20: batch_file_state_v1 cache tuple 원소를 TryGetString으로 읽고 형식이 다르면 읽던 cache를 모두 버림.
+// - v0.39.19: selector_section_sources 검사에 gzip source가 span_less_sources에 compressed로 표시되고 sectiondump가 전체 DOM 경로로 읽는지를 추가.
+// - v0.39.18: content_store_dedup 검사에 pack에 남은 이전 sidecar보다 content store 참조가 먼저 읽히는지와 GC가 오래된 임시 파일만 회수하는지를 추가.
+// - v0.39.17: ADumpEntityQuery 호출이 ADumpTypes.h forward 선언 대신 AssetDumpQuery module의 export 헤더를 include.
+// - v0.39.16: watch 모드 삭제 package 처리에서 자산 출력 폴더 manifest object_path가 삭제 자산과 같을 때만 폴더를 지움.
+// - v0.39.15: index build를 static으로 바꿔 RebuildDumpIndexFiles가 CDO 없이 동작하고, manifest entry cache는 모든 index 파일 저장 성공 뒤에만 교체. exec_queue_outcomes 검사는 GFrameCounter를 직접 올리지 않음.
+// - v0.39.14: validate에 /Engine/BasicShapes 목록으로 만든 fixture state 기준 SSOT -incremental added/modified/removed delta, 변경 없는 package row 재사용과 무변경 재실행 빈 delta(ssot_asset_delta) 스모크 검사를 추가.
+// - v0.39.13: validate에 SSOT commandlet stage 이름 순 meta, task graph/game thread 실행 위치, registry_snapshot→assets와 cfg_rules→cfg 순서, -notime 시간 필드 생략(ssot_stage_meta) 스모크 검사를 추가.
+// - v0.39.12: validate에 실행 컨트롤러 queue의 최신 skip, 실패, 앞 자산 저장 중 전체 취소 집계와 진행률/ETA(exec_queue_outcomes) 스모크 검사를 추가.
+// - v0.39.11: validate에 실행 로그 ring의 delta 조회, wraparound로 밀려난 sequence와 세션 Reset 뒤 빈 ring 조회(exec_log_ring_sequence) 스모크 검사를 추가.
+// - v0.39.10: validate에 엔진 Cube 자산의 frame budget tick 단계 실행, background 저장 반영과 저장 중/추출 중 취소(background_save_state_machine) 스모크 검사를 추가.
+// - v0.39.9: validate에 entityquery CSR expand cursor page와 entity_adjacency를 지운 relation 선형 walk page 비교(entity_adjacency_expand) 스모크 검사를 추가.
+// - v0.39.8: validate에 entityquery kind table list cursor page와 kind table을 지운 선형 scan page 비교(entity_kind_table_paging) 스모크 검사를 추가.
+// - v0.39.7: validate에 entity_index_v1 병렬 source 읽기와 단일 thread build 결과 비교(entity_index_parallel) 스모크 검사를 추가.
+// - v0.39.6: fixture selector_index의 section_sources span/CRC32가 같은 크기·크기 변경 source 수정을 거부하고 sectiondump가 새 값을 읽는지 확인하는 selector_section_sources validation smoke check를 추가.
+// - v0.39.5: fixture dump root에서 query ResultSchema=ai_context_bundle_v1 단일 실행과 query_result_v1 -> contextbundle 두 단계 출력을 MaxItems/MaxBytes 한도별로 비교하는 fused_context_bundle validation smoke check를 추가.
+// - v0.39.4: BuildBatchChangePlan의 closure/사유 판정을 ResolveBatchChangePlan으로 분리하고, batchdump가 ChangedOnly일 때만 옵션 키·계획 계산과 file-state cache 저장을 하도록 바꾸고 batch_change_closure validation smoke check를 추가. options key의 TCHAR 인자 역참조를 수정.
+// - v0.39.3: fixture symbols로 token prefix, search_terms, trigram substring, exact와 kind 필터 결과를 확인하는 symbol_search_index validation smoke check를 추가.
+// - v0.39.2: data_asset_diff_hash_merge_10k가 대소문자만 다른 문자열 값을 unchanged로 판정하는지도 확인.
+// - v0.39.1: fixture root 쌍으로 batchdiff 상태 분류와 이전 data_asset_diff section 정리를 확인하는 data_asset_batch_diff validation smoke check를 추가.
+// - v0.39.0: index mode가 input_summary section에서 전역 input_binding_index_v1을 만들고 input_binding_index validation smoke check와 inputquery read-only mode 판정을 추가.
+// - v0.38.0: sectiondump/dependencyquery/query/contextbundle/entityquery/entitycontext와 selector_index_v1 helper를 AssetDumpQuery module(ADumpReadQuery)로 옮겨 위임하고 read_query_module validation smoke check를 추가.
+// - v0.37.0: batchdump root scan을 ADumpRegistryCache 경유(process당 한 번, -RegistryCache=true 상태 cache 재사용)로 바꾸고 run_report에 registry scan 결과와 registry_scan_cache validation smoke check를 추가.
+// - v0.36.0: 최초 ChangedOnly batchdump 뒤 content 폴더를 directory watcher(또는 poll)로 감시해 변경 package만 registry 재scan, 작은 batch 재덤프와 index 갱신을 반복하는 -Mode=watch, queue 깊이/lag를 담은 watch_status_v1 heartbeat와 validation smoke check를 추가.
+// - v0.35.0: index build가 같은 process 직전 build의 manifest별 asset/section/relation entry를 dump 폴더 입력 stamp가 같으면 재사용하고, asset_index에 reused/parsed_manifest_count를 추가. 에디터용 RebuildDumpIndexFiles를 공개.
+// - v0.34.0: batchdump -DedupSections=true content-addressed section 저장과 dedup 보고, asset/section index content hash 참조, -Mode=contentgc 참조 수 GC와 validation smoke check를 추가.
+// - v0.33.0: batchdump -Pack=true 단일 pack 저장(주기적 TOC commit), index/section/query의 pack 항목 조회와 -Mode=packexport directory 복원을 추가.
+// - v0.32.0: -OutputCompression/-CompressionLevel/-CompactJson 저장 옵션, gzip dump 투명 읽기와 codec별 크기/처리량 validation smoke check를 추가.
+// - v0.31.1: source value span scan과 CRC32 검증 span 해석을 ADumpJson 공용 helper로 이동(동작 변화 없음).
+// - v0.31.0: selector_index_v1에 section별 source value byte span/CRC32(section_sources)를 추가하고 sectiondump/query가 해당 구간만 읽어 검증·해석하도록 전환(불일치 시 전체 source DOM 경로).
+// - v0.30.0: index 모드에 object_path/asset_id/(asset ordinal, section) hash table과 entry byte span을 담은 selector_index_v1을 추가하고 sectiondump/query/dependencyquery selector 해석을 O(1) probe와 span 읽기로 전환(불일치 시 기존 선형 경로).
+// - v0.29.0: query 모드에 ResultSchema=ai_context_bundle_v1 단일 실행 경로를 추가해 중간 query_result_v1 파일 없이 bundle을 만들고 한도 밖 section source 읽기를 생략.
+// - v0.28.1: contextbundle MaxBytes 절단을 item별 1회 직렬화 크기 prefix sum으로 바꾸고 기준 loop byte 일치 validation smoke check를 추가.
+// - v0.28.0: batchdump ChangedOnly를 scope별 batch_file_state_v1 package 상태 cache와 reverse dependency closure로 판정하고 자산별 redump_reason을 report에 추가.
+// - v0.27.0: index 모드에 SCC 기반 impact_index_v1 생성, impact 모드와 100k node impact graph validation smoke check를 추가.
+// - v0.26.0: index 모드에 전역 symbol_search_index_v1 생성과 token/trigram 기반 search 모드를 추가.
+// - v0.25.1: data_asset_diff hash merge 비교의 10k field 분류/소요 시간 validation smoke check를 추가.
+// - v0.25.0: asset_index_v1 기반 dump root 간 DataAsset batch diff 모드(batchdiff)를 추가.
 // - v0.24.2: section_index_v1의 section/symbol deterministic ordering과 validator를 accepted ordinal case-sensitive key 비교로 교정.
 // - v0.24.1: asset_index_v1의 accepted case-sensitive object_path 정렬 계약을 명시적 FString::Compare(CaseSensitive)로 교정하고 validator도 같은 비교 의미로 정렬.
 // - v0.24.0: P5-N1 niagara_material_evidence Profile과 Renderer Resource 기반 additive dependency_index hard-edge bridge를 추가.
@@ -80,16 +122,29 @@
 #include "ADumpBPSearchIndex.h"
 #include "ADumpDataDiff.h"
 #include "ADumpComponentTree.h"
+#include "ADumpEntityQuery.h"
 #include "ADumpInput.h"
+#include "ADumpInputIndex.h"
 #include "ADumpValidRow.h"
 #include "ADumpFingerprint.h"
+#include "ADumpImpactGraph.h"
 #include "ADumpGraphExt.h"
 #include "ADumpJson.h"
+#include "ADumpContentStore.h"
+#include "ADumpPack.h"
+#include "ADumpReadQuery.h"
+#include "ADumpRegistryCache.h"
 #include "ADumpRunOpts.h"
+#include "ADumpExecCtrl.h"
+#include "SSOTDumpCmdlet.h"
 #include "ADumpService.h"
+#include "ADumpSymbolSearch.h"
 
 #include "Algo/Sort.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "CoreGlobals.h"
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
 #include "Animation/AnimBlueprint.h"
 #include "Blueprint/UserWidget.h"
 #include "Blueprint/WidgetBlueprintGeneratedClass.h"
@@ -135,6 +190,9 @@
 #include "Misc/FileHelper.h"
 #include "Misc/PackageName.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "PackageTools.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
 #include "UObject/Package.h"
@@ -147,6 +205,9 @@ namespace
 	// AssetDumpValidationRootPath는 공용 검증 fixture를 보관할 플러그인 Content 루트 경로다.
 	constexpr const TCHAR* AssetDumpValidationRootPath = TEXT("/AssetDump/Validation");
 
+	// BatchPackCommitInterval은 -Pack=true batchdump가 pack TOC를 중간 commit하는 자산 수 간격이다.
+	constexpr int32 BatchPackCommitInterval = 256;
+
 	// AssetDumpActorFixtureName은 일반 Actor Blueprint fixture 자산명이다.
 	constexpr const TCHAR* AssetDumpActorFixtureName = TEXT("BP_ADumpActorFixture");
 
@@ -208,14 +269,21 @@ namespace
 		return FJsonSerializer::Serialize(InRootObject, JsonWriter);
 	}
 
-	// LoadCommandletJsonObjectFromFile는 UTF-8 JSON 파일을 읽어 JsonObject로 역직렬화한다.
+	// GetCommandletUtf8ByteLength는 저장할 JSON 문자열의 BOM 없는 UTF-8 byte 수를 반환한다.
+	int32 GetCommandletUtf8ByteLength(const FString& InText)
+	{
+		FTCHARToUTF8 Utf8Text(*InText);
+		return Utf8Text.Length();
+	}
+
+	// LoadCommandletJsonObjectFromFile는 UTF-8 또는 gzip JSON 파일을 읽어 JsonObject로 역직렬화한다.
 	bool LoadCommandletJsonObjectFromFile(const FString& InFilePath, TSharedPtr<FJsonObject>& OutRootObject)
 	{
 		OutRootObject.Reset();
 
-		// JsonText는 파일에서 읽어온 원문 JSON 문자열이다.
+		// JsonText는 파일에서 읽어 필요하면 gzip 해제한 원문 JSON 문자열이다.
 		FString JsonText;
-		if (!FFileHelper::LoadFileToString(JsonText, *InFilePath))
+		if (!ADumpJson::LoadJsonTextFromFile(InFilePath, JsonText))
 		{
 			return false;
 		}
@@ -523,6 +591,7 @@ namespace
 		const TArray<FString> AvailableSectionArray = GetCommandletStringArrayField(InAssetIndexEntryObject, TEXT("available_sections"));
 		const TSharedPtr<FJsonObject> SectionSchemaObject = GetCommandletNestedObjectField(InAssetIndexEntryObject, TEXT("section_schema_versions"));
 		const TSharedPtr<FJsonObject> OutputFilesObject = GetCommandletNestedObjectField(InAssetIndexEntryObject, TEXT("output_files"));
+		const TSharedPtr<FJsonObject> ContentRefsObject = GetCommandletNestedObjectField(InAssetIndexEntryObject, TEXT("content_refs"));
 		if (ObjectPathText.IsEmpty() || !OutputFilesObject.IsValid())
 		{
 			return false;
@@ -561,6 +630,15 @@ namespace
 			SectionEntryObject->SetStringField(TEXT("source_file"), SourceFileText);
 			SectionEntryObject->SetStringField(TEXT("json_pointer"), JsonPointerText);
 			SectionEntryObject->SetStringField(TEXT("storage_kind"), StorageKindText);
+
+			// content_hash는 같은 payload를 공유하는 section끼리 같은 content store blob을 가리킨다.
+			FString ContentHashText;
+			if (StorageKindText == TEXT("sidecar")
+				&& ContentRefsObject.IsValid()
+				&& ContentRefsObject->TryGetStringField(FPaths::GetCleanFilename(SourceFileText), ContentHashText))
+			{
+				SectionEntryObject->SetStringField(TEXT("content_hash"), ContentHashText);
+			}
 			OutSectionEntryObjectArray.Add(SectionEntryObject);
 		}
 
@@ -683,7 +761,7 @@ namespace
 		const FString MainDumpFilePath = MainDumpFileName.IsEmpty()
 			? FString()
 			: FPaths::Combine(DumpDirectoryPath, MainDumpFileName);
-		const bool bMainDumpExists = !MainDumpFilePath.IsEmpty() && IFileManager::Get().FileExists(*MainDumpFilePath);
+		const bool bMainDumpExists = !MainDumpFilePath.IsEmpty() && ADumpJson::DoesJsonFileExist(MainDumpFilePath);
 
 		TSharedPtr<FJsonObject> MainDumpRootObject;
 		const bool bMainDumpParsed = bMainDumpExists && LoadCommandletJsonObjectFromFile(MainDumpFilePath, MainDumpRootObject);
@@ -698,11 +776,11 @@ namespace
 		const FString GraphsFilePath = FPaths::Combine(DumpDirectoryPath, TEXT("graphs.json"));
 		const FString ReferencesFilePath = FPaths::Combine(DumpDirectoryPath, TEXT("references.json"));
 
-		const bool bDigestFileExists = IFileManager::Get().FileExists(*DigestFilePath);
-		const bool bSummaryFileExists = IFileManager::Get().FileExists(*SummaryFilePath);
-		const bool bDetailsFileExists = IFileManager::Get().FileExists(*DetailsFilePath);
-		const bool bGraphsFileExists = IFileManager::Get().FileExists(*GraphsFilePath);
-		const bool bReferencesFileExists = IFileManager::Get().FileExists(*ReferencesFilePath);
+		const bool bDigestFileExists = ADumpJson::DoesJsonFileExist(DigestFilePath);
+		const bool bSummaryFileExists = ADumpJson::DoesJsonFileExist(SummaryFilePath);
+		const bool bDetailsFileExists = ADumpJson::DoesJsonFileExist(DetailsFilePath);
+		const bool bGraphsFileExists = ADumpJson::DoesJsonFileExist(GraphsFilePath);
+		const bool bReferencesFileExists = ADumpJson::DoesJsonFileExist(ReferencesFilePath);
 
 		TArray<FString> AvailableSectionArray;
 		TSharedRef<FJsonObject> SectionSchemaObject = MakeShared<FJsonObject>();
@@ -803,7 +881,7 @@ namespace
 		for (const FString& GeneratedFileName : GeneratedFileArray)
 		{
 			const FString GeneratedFilePath = FPaths::Combine(DumpDirectoryPath, GeneratedFileName);
-			if (!IFileManager::Get().FileExists(*GeneratedFilePath))
+			if (!ADumpJson::DoesJsonFileExist(GeneratedFilePath))
 			{
 				MissingFileArray.Add(GeneratedFileName);
 			}
@@ -818,7 +896,7 @@ namespace
 		{
 			const bool bDeclared = bAlwaysDeclare
 				|| (!DeclaredFileName.IsEmpty() && GeneratedFileLowerSet.Contains(DeclaredFileName.ToLower()))
-				|| (!OutputFilePath.IsEmpty() && IFileManager::Get().FileExists(*OutputFilePath));
+				|| (!OutputFilePath.IsEmpty() && ADumpJson::DoesJsonFileExist(OutputFilePath));
 			if (!bDeclared)
 			{
 				return;
@@ -886,6 +964,13 @@ namespace
 		AddCommandletStringArrayField(EntryObject, TEXT("missing_files"), MissingFileArray);
 		EntryObject->SetObjectField(TEXT("output_files"), OutputFilesObject);
 
+		// ContentRefsObject는 content store에 저장된 sidecar 파일명별 hash이며 dedup 저장 manifest에만 있다.
+		const TSharedPtr<FJsonObject> ContentRefsObject = GetCommandletNestedObjectField(ManifestRootObject, TEXT("content_refs"));
+		if (ContentRefsObject.IsValid())
+		{
+			EntryObject->SetObjectField(TEXT("content_refs"), ContentRefsObject);
+		}
+
 		OutEntryObject = EntryObject;
 		return true;
 	}
@@ -1446,3034 +1531,5761 @@ namespace
 		return true;
 	}
 
-		// BuildCommandletLazySectionDumpJson은 accepted index에서 요청 section만 읽어 compact response를 만든다.
-	bool BuildCommandletLazySectionDumpJson(
-		const FString& InDumpRootPath,
-		const FString& InAssetObjectPathSelector,
-		const FString& InAssetIdSelector,
-		const FADumpSectionSelection& InSectionSelection,
-		FString& OutJsonText,
-		FString& OutErrorCode,
-		FString& OutErrorDetail)
+	// ResolveCommandletReferenceSourceKindText는 references source를 dependency_index source_kind로 정규화한다.
+	FString ResolveCommandletReferenceSourceKindText(const FString& InSourceText)
+	{
+		if (InSourceText == TEXT("property_ref") || InSourceText == TEXT("component_ref"))
+		{
+			return TEXT("details");
+		}
+
+		return TEXT("graph");
+	}
+
+	// FCommandletIndexRelationEntry는 manifest 하나에서 모은 dependency_index relation과 중복 판정 키다.
+	struct FCommandletIndexRelationEntry
+	{
+		FString UniqueKey;
+		TSharedPtr<FJsonObject> RelationObject;
+	};
+
+	// FCommandletIndexManifestEntry는 selected manifest 하나가 index 파일들에 기여하는 entry 묶음이다.
+	struct FCommandletIndexManifestEntry
+	{
+		// InputStamp는 entry를 만들 때 읽은 manifest와 dump 폴더 파일들의 크기/stamp 조합이다.
+		FString InputStamp;
+
+		// LegacyAssetEntryObject는 index.json assets 항목이다.
+		TSharedPtr<FJsonObject> LegacyAssetEntryObject;
+
+		// AssetIndexEntryObject는 asset_index.json assets 항목이다. manifest에서 만들 수 없으면 비어 있다.
+		TSharedPtr<FJsonObject> AssetIndexEntryObject;
+		bool bAssetIndexEntryReady = false;
+
+		// SectionEntryObjects와 SymbolEntryObjects는 section_index.json sections/symbols 항목이다.
+		TArray<TSharedPtr<FJsonObject>> SectionEntryObjects;
+		TArray<TSharedPtr<FJsonObject>> SymbolEntryObjects;
+
+		// RelationEntries는 dependency_index.json relations 후보다. 전역 중복 제거 전 값이다.
+		TArray<FCommandletIndexRelationEntry> RelationEntries;
+	};
+
+	// FCommandletIndexManifestCache는 같은 process의 직전 index build entry를 manifest 경로별로 보관한다. dump root는 하나만 유지한다.
+	struct FCommandletIndexManifestCache
+	{
+		FString DumpRootPath;
+		TMap<FString, FCommandletIndexManifestEntry> EntryByManifestPath;
+
+		// BuildLock은 에디터 background build와 다른 호출이 cache를 동시에 고치지 않게 한다.
+		FCriticalSection BuildLock;
+	};
+
+	// GetCommandletIndexManifestCache는 process 전역 index entry cache를 반환한다.
+	FCommandletIndexManifestCache& GetCommandletIndexManifestCache()
 	{
-		OutJsonText.Reset();
-		OutErrorCode.Reset();
-		OutErrorDetail.Reset();
+		static FCommandletIndexManifestCache IndexManifestCache;
+		return IndexManifestCache;
+	}
 
-		auto Fail = [&OutErrorCode, &OutErrorDetail](const TCHAR* InCode, const FString& InDetail)
+	// BuildCommandletIndexManifestInputStamp는 manifest generated_time과 manifest, generated_files, 고정 sidecar, dump 폴더 실제 파일의 크기/stamp를 이름순으로 묶는다.
+	// 같은 초 안에 같은 크기로 다시 쓴 dump도 manifest generated_time(ms)이 달라 stamp가 바뀐다.
+	FString BuildCommandletIndexManifestInputStamp(const FString& InManifestFilePath, const TSharedPtr<FJsonObject>& InManifestRootObject)
+	{
+		const FString DumpDirectoryPath = FPaths::GetPath(InManifestFilePath);
+		TArray<FString> InputFileNames = {
+			FPaths::GetCleanFilename(InManifestFilePath),
+			TEXT("digest.json"),
+			TEXT("summary.json"),
+			TEXT("details.json"),
+			TEXT("graphs.json"),
+			TEXT("references.json") };
+		for (const FString& GeneratedFileName : GetCommandletStringArrayField(InManifestRootObject, TEXT("generated_files")))
 		{
-			OutErrorCode = InCode;
-			OutErrorDetail = InDetail;
-			return false;
-		};
+			InputFileNames.Add(FPaths::GetCleanFilename(GeneratedFileName));
+		}
 
-		const FString AssetIndexFilePath = FPaths::Combine(InDumpRootPath, TEXT("asset_index.json"));
-		const FString SectionIndexFilePath = FPaths::Combine(InDumpRootPath, TEXT("section_index.json"));
-		if (!IFileManager::Get().FileExists(*AssetIndexFilePath)
-			|| !IFileManager::Get().FileExists(*SectionIndexFilePath))
+		TArray<FString> DirectoryFileNames;
+		IFileManager::Get().FindFiles(DirectoryFileNames, *FPaths::Combine(DumpDirectoryPath, TEXT("*")), true, false);
+		InputFileNames.Append(DirectoryFileNames);
+
+		TSet<FString> SeenFileNames;
+		TArray<FString> UniqueFileNames;
+		for (const FString& InputFileName : InputFileNames)
 		{
-			return Fail(
-				TEXT("ADUMP_LAZY_DUMP_INDEX_NOT_FOUND"),
-				FString::Printf(TEXT("Required indexes are missing under dump root: %s"), *InDumpRootPath));
+			if (!InputFileName.IsEmpty() && !SeenFileNames.Contains(InputFileName))
+			{
+				SeenFileNames.Add(InputFileName);
+				UniqueFileNames.Add(InputFileName);
+			}
 		}
+		UniqueFileNames.Sort();
 
-		TSharedPtr<FJsonObject> AssetIndexRootObject;
-		TSharedPtr<FJsonObject> SectionIndexRootObject;
-		if (!LoadCommandletJsonObjectFromFile(AssetIndexFilePath, AssetIndexRootObject)
-			|| !LoadCommandletJsonObjectFromFile(SectionIndexFilePath, SectionIndexRootObject))
+		FString StampText = GetCommandletStringFieldOrEmpty(InManifestRootObject, TEXT("generated_time")) + TEXT(";");
+		for (const FString& InputFileName : UniqueFileNames)
 		{
-			return Fail(
-				TEXT("ADUMP_LAZY_DUMP_INDEX_JSON_INVALID"),
-				TEXT("asset_index.json or section_index.json is not a readable JSON object."));
+			int64 FileBytes = 0;
+			FString FileStampText;
+			StampText += ADumpJson::GetJsonFileStat(FPaths::Combine(DumpDirectoryPath, InputFileName), FileBytes, FileStampText)
+				? FString::Printf(TEXT("%s:%lld:%s;"), *InputFileName, FileBytes, *FileStampText)
+				: FString::Printf(TEXT("%s:-;"), *InputFileName);
 		}
+		return StampText;
+	}
 
-		if (GetCommandletStringFieldOrEmpty(AssetIndexRootObject, TEXT("schema_version")) != TEXT("asset_index_v1")
-			|| GetCommandletStringFieldOrEmpty(SectionIndexRootObject, TEXT("schema_version")) != TEXT("section_index_v1")
-			|| GetCommandletStringFieldOrEmpty(SectionIndexRootObject, TEXT("asset_index_schema_version")) != TEXT("asset_index_v1"))
+	// AppendCommandletEntityEvidenceRelations는 Material profile main dump의 typed Renderer Resource를 dependency_index relation 후보로 추가한다.
+	void AppendCommandletEntityEvidenceRelations(
+		const FString& InObjectPathText,
+		const FString& InMainDumpFilePath,
+		const FString& InDumpRootPath,
+		TArray<FCommandletIndexRelationEntry>& OutRelationEntries)
+	{
+		TSharedPtr<FJsonObject> MainDumpRootObject;
+		if (InMainDumpFilePath.IsEmpty()
+			|| !ADumpJson::DoesJsonFileExist(InMainDumpFilePath)
+			|| !LoadCommandletJsonObjectFromFile(InMainDumpFilePath, MainDumpRootObject))
 		{
-			return Fail(
-				TEXT("ADUMP_LAZY_DUMP_INDEX_SCHEMA_UNSUPPORTED"),
-				TEXT("The selected indexes do not satisfy asset_index_v1 + section_index_v1."));
+			return;
 		}
 
-		const TArray<TSharedPtr<FJsonValue>>* AssetValueArray = nullptr;
-		const TArray<TSharedPtr<FJsonValue>>* SectionValueArray = nullptr;
-		if (!AssetIndexRootObject->TryGetArrayField(TEXT("assets"), AssetValueArray) || !AssetValueArray
-			|| !SectionIndexRootObject->TryGetArrayField(TEXT("sections"), SectionValueArray) || !SectionValueArray)
+		const TSharedPtr<FJsonObject> EntityEvidenceObject = GetCommandletNestedObjectField(MainDumpRootObject, TEXT("entity_evidence"));
+		if (GetCommandletStringFieldOrEmpty(EntityEvidenceObject, TEXT("adapter_profile")) != TEXT("niagara_material_v1"))
+		{
+			return;
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* EntityValueArray = nullptr;
+		if (!EntityEvidenceObject.IsValid()
+			|| !EntityEvidenceObject->TryGetArrayField(TEXT("entities"), EntityValueArray)
+			|| !EntityValueArray)
 		{
-			return Fail(
-				TEXT("ADUMP_LAZY_DUMP_INDEX_SCHEMA_UNSUPPORTED"),
-				TEXT("Required assets or sections array is missing from the selected indexes."));
+			return;
 		}
 
-		TSharedPtr<FJsonObject> ResolvedAssetObject;
-		int32 AssetMatchCount = 0;
-		for (const TSharedPtr<FJsonValue>& AssetValue : *AssetValueArray)
+		const FString SourceFileText = MakeCommandletDumpRootRelativePath(InMainDumpFilePath, InDumpRootPath);
+		for (int32 EntityIndex = 0; EntityIndex < EntityValueArray->Num(); ++EntityIndex)
 		{
-			const TSharedPtr<FJsonObject> AssetObject = AssetValue.IsValid() ? AssetValue->AsObject() : nullptr;
-			if (!AssetObject.IsValid())
+			const TSharedPtr<FJsonValue>& EntityValue = (*EntityValueArray)[EntityIndex];
+			const TSharedPtr<FJsonObject> EntityObject = EntityValue.IsValid() ? EntityValue->AsObject() : nullptr;
+			if (GetCommandletStringFieldOrEmpty(EntityObject, TEXT("entity_kind")) != TEXT("niagara_renderer_resource"))
 			{
-				return Fail(
-					TEXT("ADUMP_LAZY_DUMP_INDEX_SCHEMA_UNSUPPORTED"),
-					TEXT("asset_index_v1 contains a non-object asset entry."));
+				continue;
 			}
 
-			const bool bMatchesObjectPath = !InAssetObjectPathSelector.IsEmpty()
-				&& GetCommandletStringFieldOrEmpty(AssetObject, TEXT("object_path")) == InAssetObjectPathSelector;
-			const bool bMatchesAssetId = !InAssetIdSelector.IsEmpty()
-				&& GetCommandletStringFieldOrEmpty(AssetObject, TEXT("asset_id")) == InAssetIdSelector;
-			if (bMatchesObjectPath || bMatchesAssetId)
+			const TSharedPtr<FJsonObject> FacetsObject = GetCommandletNestedObjectField(EntityObject, TEXT("facets"));
+			const TSharedPtr<FJsonObject> ResourceFacetObject = GetCommandletNestedObjectField(FacetsObject, TEXT("niagara_renderer_resource"));
+			const TSharedPtr<FJsonObject> ResourceDataObject = GetCommandletNestedObjectField(ResourceFacetObject, TEXT("data"));
+			const FString TargetPathText = GetCommandletStringFieldOrEmpty(ResourceDataObject, TEXT("object_path"));
+			const FString ReasonText = GetCommandletStringFieldOrEmpty(ResourceDataObject, TEXT("reference_role"));
+			if (!TargetPathText.StartsWith(TEXT("/"))
+				|| (ReasonText != TEXT("renderer_material") && ReasonText != TEXT("renderer_mesh")))
 			{
-				ResolvedAssetObject = AssetObject;
-				++AssetMatchCount;
+				continue;
 			}
-		}
 
-		if (AssetMatchCount != 1 || !ResolvedAssetObject.IsValid())
-		{
-			const FString SelectorText = !InAssetObjectPathSelector.IsEmpty()
-				? InAssetObjectPathSelector
-				: InAssetIdSelector;
-			return Fail(
-				TEXT("ADUMP_LAZY_DUMP_ASSET_NOT_FOUND"),
-				FString::Printf(TEXT("Expected one indexed asset match for selector: %s"), *SelectorText));
+			const FString SourcePathText = SourceFileText + FString::Printf(TEXT("#/entity_evidence/entities/%d"), EntityIndex);
+			TSharedRef<FJsonObject> RelationEntryObject = MakeShared<FJsonObject>();
+			RelationEntryObject->SetStringField(TEXT("from"), InObjectPathText);
+			RelationEntryObject->SetStringField(TEXT("to"), TargetPathText);
+			RelationEntryObject->SetStringField(TEXT("reason"), ReasonText);
+			RelationEntryObject->SetStringField(TEXT("strength"), TEXT("hard"));
+			RelationEntryObject->SetStringField(TEXT("source_kind"), TEXT("entity_evidence"));
+			RelationEntryObject->SetStringField(TEXT("source_path"), SourcePathText);
+
+			FCommandletIndexRelationEntry& RelationEntry = OutRelationEntries.AddDefaulted_GetRef();
+			RelationEntry.UniqueKey = FString::Printf(
+				TEXT("%s|%s|%s|hard|%s"),
+				*InObjectPathText,
+				*TargetPathText,
+				*ReasonText,
+				*SourcePathText);
+			RelationEntry.RelationObject = RelationEntryObject;
 		}
+	}
 
-		const FString ResolvedObjectPath = GetCommandletStringFieldOrEmpty(ResolvedAssetObject, TEXT("object_path"));
-		const TArray<FString> RequestedSectionArray = InSectionSelection.GetEnabledNames();
-		if (RequestedSectionArray.Num() == 0)
+	// AppendCommandletReferenceRelations는 references.json hard/soft 배열을 dependency_index relation 후보로 추가한다.
+	void AppendCommandletReferenceRelations(
+		const FString& InObjectPathText,
+		const FString& InReferencesFilePath,
+		TArray<FCommandletIndexRelationEntry>& OutRelationEntries)
+	{
+		// ReferencesRootObject는 references.json 역직렬화 결과다.
+		TSharedPtr<FJsonObject> ReferencesRootObject;
+		if (!ADumpJson::DoesJsonFileExist(InReferencesFilePath)
+			|| !LoadCommandletJsonObjectFromFile(InReferencesFilePath, ReferencesRootObject))
 		{
-			return Fail(
-				TEXT("ADUMP_LAZY_DUMP_SECTIONS_REQUIRED"),
-				TEXT("sectiondump requires at least one explicit canonical section."));
+			return;
 		}
 
-		TMap<FString, TSharedPtr<FJsonObject>> SourceObjectByRelativePath;
-		TSet<FString> UniqueSourceFileSet;
-		TArray<TSharedPtr<FJsonValue>> SectionResultValueArray;
-		SectionResultValueArray.Reserve(RequestedSectionArray.Num());
-
-		FString NormalizedDumpRootPath = FPaths::ConvertRelativePathToFull(InDumpRootPath);
-		FPaths::NormalizeDirectoryName(NormalizedDumpRootPath);
-		FString DumpRootPrefix = NormalizedDumpRootPath;
-		if (!DumpRootPrefix.EndsWith(TEXT("/")))
+		// ReferencesObject는 references 섹션 object다.
+		const TSharedPtr<FJsonObject> ReferencesObject = GetCommandletNestedObjectField(ReferencesRootObject, TEXT("references"));
+		if (!ReferencesObject.IsValid())
 		{
-			DumpRootPrefix += TEXT("/");
+			return;
 		}
 
-		for (const FString& RequestedSectionName : RequestedSectionArray)
+		for (const bool bIsHardReference : { true, false })
 		{
-			TSharedPtr<FJsonObject> ResolvedSectionEntryObject;
-			int32 SectionMatchCount = 0;
-			for (const TSharedPtr<FJsonValue>& SectionValue : *SectionValueArray)
-			{
-				const TSharedPtr<FJsonObject> SectionObject = SectionValue.IsValid() ? SectionValue->AsObject() : nullptr;
-				if (!SectionObject.IsValid())
-				{
-					return Fail(
-						TEXT("ADUMP_LAZY_DUMP_INDEX_SCHEMA_UNSUPPORTED"),
-						TEXT("section_index_v1 contains a non-object section entry."));
-				}
-
-				if (GetCommandletStringFieldOrEmpty(SectionObject, TEXT("object_path")) == ResolvedObjectPath
-					&& GetCommandletStringFieldOrEmpty(SectionObject, TEXT("section_name")) == RequestedSectionName)
-				{
-					ResolvedSectionEntryObject = SectionObject;
-					++SectionMatchCount;
-				}
-			}
-
-			if (SectionMatchCount == 0)
-			{
-				return Fail(
-					TEXT("ADUMP_LAZY_DUMP_SECTION_NOT_AVAILABLE"),
-					FString::Printf(TEXT("Section '%s' is not indexed for asset: %s"), *RequestedSectionName, *ResolvedObjectPath));
-			}
-			if (SectionMatchCount != 1 || !ResolvedSectionEntryObject.IsValid())
-			{
-				return Fail(
-					TEXT("ADUMP_LAZY_DUMP_SECTION_DUPLICATE"),
-					FString::Printf(TEXT("Section '%s' has %d matching index entries for asset: %s"), *RequestedSectionName, SectionMatchCount, *ResolvedObjectPath));
-			}
-
-			const FString SourceFileText = GetCommandletStringFieldOrEmpty(ResolvedSectionEntryObject, TEXT("source_file"));
-			const FString JsonPointerText = GetCommandletStringFieldOrEmpty(ResolvedSectionEntryObject, TEXT("json_pointer"));
-			if (SourceFileText.IsEmpty()
-				|| !FPaths::IsRelative(SourceFileText)
-				|| SourceFileText.Contains(TEXT("\\"))
-				|| SourceFileText.StartsWith(TEXT("../")))
-			{
-				return Fail(
-					TEXT("ADUMP_LAZY_DUMP_INDEX_SCHEMA_UNSUPPORTED"),
-					FString::Printf(TEXT("Invalid indexed source path for section '%s': %s"), *RequestedSectionName, *SourceFileText));
-			}
+			// ArrayFieldName은 hard/soft 중 현재 읽을 references 배열 이름이다.
+			const TCHAR* ArrayFieldName = bIsHardReference ? TEXT("hard") : TEXT("soft");
 
-			FString SourceFilePath = FPaths::ConvertRelativePathToFull(FPaths::Combine(NormalizedDumpRootPath, SourceFileText));
-			FPaths::NormalizeFilename(SourceFilePath);
-			if (!SourceFilePath.StartsWith(DumpRootPrefix, ESearchCase::IgnoreCase))
-			{
-				return Fail(
-					TEXT("ADUMP_LAZY_DUMP_INDEX_SCHEMA_UNSUPPORTED"),
-					FString::Printf(TEXT("Indexed source escapes dump root for section '%s': %s"), *RequestedSectionName, *SourceFileText));
-			}
-			if (!IFileManager::Get().FileExists(*SourceFilePath))
+			// ReferenceValueArray는 현재 강도에 해당하는 references 배열이다.
+			const TArray<TSharedPtr<FJsonValue>>* ReferenceValueArray = nullptr;
+			if (!ReferencesObject->TryGetArrayField(ArrayFieldName, ReferenceValueArray) || !ReferenceValueArray)
 			{
-				return Fail(
-					TEXT("ADUMP_LAZY_DUMP_SOURCE_FILE_NOT_FOUND"),
-					FString::Printf(TEXT("Indexed source file does not exist for section '%s': %s"), *RequestedSectionName, *SourceFileText));
+				continue;
 			}
 
-			TSharedPtr<FJsonObject> SourceRootObject = SourceObjectByRelativePath.FindRef(SourceFileText);
-			if (!SourceRootObject.IsValid())
+			for (const TSharedPtr<FJsonValue>& ReferenceValue : *ReferenceValueArray)
 			{
-				if (!LoadCommandletJsonObjectFromFile(SourceFilePath, SourceRootObject))
+				// ReferenceObject는 reference 한 건의 object다.
+				const TSharedPtr<FJsonObject> ReferenceObject = ReferenceValue.IsValid() ? ReferenceValue->AsObject() : nullptr;
+				if (!ReferenceObject.IsValid())
 				{
-					return Fail(
-						TEXT("ADUMP_LAZY_DUMP_SOURCE_JSON_INVALID"),
-						FString::Printf(TEXT("Indexed source is not a readable JSON object: %s"), *SourceFileText));
+					continue;
 				}
-				SourceObjectByRelativePath.Add(SourceFileText, SourceRootObject);
-			}
 
-			TSharedPtr<FJsonValue> ResolvedDataValue;
-			if (JsonPointerText == TEXT("/"))
-			{
-				ResolvedDataValue = MakeShared<FJsonValueObject>(SourceRootObject.ToSharedRef());
-			}
-			else if (JsonPointerText.StartsWith(TEXT("/"))
-				&& JsonPointerText.Len() > 1
-				&& !JsonPointerText.Mid(1).Contains(TEXT("/")))
-			{
-								const FString TopLevelFieldName = JsonPointerText.Mid(1);
-				const TSharedPtr<FJsonValue> IndexedValue = SourceRootObject->TryGetField(*TopLevelFieldName);
-				if (!IndexedValue.IsValid())
+				// TargetPathText는 relation 의 도착 자산 경로다.
+				const FString TargetPathText = GetCommandletStringFieldOrEmpty(ReferenceObject, TEXT("path"));
+				if (!TargetPathText.StartsWith(TEXT("/")))
 				{
-					return Fail(
-						TEXT("ADUMP_LAZY_DUMP_POINTER_NOT_FOUND"),
-						FString::Printf(TEXT("Indexed pointer does not resolve for section '%s': %s"), *RequestedSectionName, *JsonPointerText));
+					continue;
 				}
-				ResolvedDataValue = IndexedValue;
-			}
-			else
-			{
-				return Fail(
-					TEXT("ADUMP_LAZY_DUMP_POINTER_UNSUPPORTED"),
-					FString::Printf(TEXT("Nested or malformed pointer is outside v0.9.2 scope for section '%s': %s"), *RequestedSectionName, *JsonPointerText));
-			}
 
-			TSharedRef<FJsonObject> SectionResultObject = MakeShared<FJsonObject>();
-			SectionResultObject->SetStringField(TEXT("section_name"), RequestedSectionName);
-			SectionResultObject->SetStringField(TEXT("section_schema_version"), GetCommandletStringFieldOrEmpty(ResolvedSectionEntryObject, TEXT("section_schema_version")));
-			SectionResultObject->SetStringField(TEXT("source_file"), SourceFileText);
-			SectionResultObject->SetStringField(TEXT("json_pointer"), JsonPointerText);
-			SectionResultObject->SetStringField(TEXT("storage_kind"), GetCommandletStringFieldOrEmpty(ResolvedSectionEntryObject, TEXT("storage_kind")));
-			SectionResultObject->SetField(TEXT("data"), ResolvedDataValue);
-			SectionResultValueArray.Add(MakeShared<FJsonValueObject>(SectionResultObject));
-			UniqueSourceFileSet.Add(SourceFileText);
-		}
+				// ReasonText는 reference source를 그대로 relation reason으로 사용한다.
+				const FString ReasonText = GetCommandletStringFieldOrEmpty(ReferenceObject, TEXT("source"));
 
-		TArray<FString> SourceFileArray = UniqueSourceFileSet.Array();
-		SourceFileArray.Sort([](const FString& InLeft, const FString& InRight)
-		{
-			return InLeft < InRight;
-		});
+				// SourcePathText는 관계를 찾은 세부 위치 설명이다.
+				const FString SourcePathText = GetCommandletStringFieldOrEmpty(ReferenceObject, TEXT("source_path"));
+
+				// StrengthText는 hard/soft 강도 문자열이다.
+				const FString StrengthText = bIsHardReference ? TEXT("hard") : TEXT("soft");
+
+				// RelationEntryObject는 dependency_index.json 에 추가할 relation object다.
+				TSharedRef<FJsonObject> RelationEntryObject = MakeShared<FJsonObject>();
+				RelationEntryObject->SetStringField(TEXT("from"), InObjectPathText);
+				RelationEntryObject->SetStringField(TEXT("to"), TargetPathText);
+				RelationEntryObject->SetStringField(TEXT("reason"), ReasonText);
+				RelationEntryObject->SetStringField(TEXT("strength"), StrengthText);
+				RelationEntryObject->SetStringField(TEXT("source_kind"), ResolveCommandletReferenceSourceKindText(ReasonText));
+				RelationEntryObject->SetStringField(TEXT("source_path"), SourcePathText);
 
-		TSharedRef<FJsonObject> AssetEnvelopeObject = MakeShared<FJsonObject>();
-		AssetEnvelopeObject->SetStringField(TEXT("asset_id"), GetCommandletStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_id")));
-		AssetEnvelopeObject->SetStringField(TEXT("asset_key"), GetCommandletStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_key")));
-		AssetEnvelopeObject->SetStringField(TEXT("object_path"), ResolvedObjectPath);
-		AssetEnvelopeObject->SetStringField(TEXT("asset_class"), GetCommandletStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_class")));
-		AssetEnvelopeObject->SetStringField(TEXT("asset_family"), GetCommandletStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_family")));
-		AssetEnvelopeObject->SetStringField(TEXT("fingerprint"), GetCommandletStringFieldOrEmpty(ResolvedAssetObject, TEXT("fingerprint")));
-
-		TSharedRef<FJsonObject> ResponseRootObject = MakeShared<FJsonObject>();
-		ResponseRootObject->SetStringField(TEXT("schema_version"), TEXT("lazy_section_dump_v1"));
-		ResponseRootObject->SetStringField(TEXT("generated_time"), FDateTime::UtcNow().ToIso8601());
-		ResponseRootObject->SetStringField(TEXT("source_contract"), TEXT("indexed_stored_evidence"));
-		ResponseRootObject->SetStringField(TEXT("asset_index_schema_version"), TEXT("asset_index_v1"));
-		ResponseRootObject->SetStringField(TEXT("section_index_schema_version"), TEXT("section_index_v1"));
-		ResponseRootObject->SetObjectField(TEXT("asset"), AssetEnvelopeObject);
-		AddCommandletStringArrayField(ResponseRootObject, TEXT("requested_sections"), RequestedSectionArray);
-		ResponseRootObject->SetNumberField(TEXT("section_count"), SectionResultValueArray.Num());
-		ResponseRootObject->SetNumberField(TEXT("source_file_count"), SourceFileArray.Num());
-		AddCommandletStringArrayField(ResponseRootObject, TEXT("source_files"), SourceFileArray);
-		ResponseRootObject->SetArrayField(TEXT("sections"), SectionResultValueArray);
-		ResponseRootObject->SetBoolField(TEXT("all_resolved"), true);
-
-		if (!SerializeJsonObjectText(ResponseRootObject, OutJsonText))
-		{
-			return Fail(
-				TEXT("ADUMP_LAZY_DUMP_SOURCE_JSON_INVALID"),
-				TEXT("Failed to serialize lazy_section_dump_v1 response."));
+				// RelationEntry.UniqueKey는 중복 relation 누적을 막기 위한 고정 키다.
+				FCommandletIndexRelationEntry& RelationEntry = OutRelationEntries.AddDefaulted_GetRef();
+				RelationEntry.UniqueKey = FString::Printf(
+					TEXT("%s|%s|%s|%s|%s"),
+					*InObjectPathText,
+					*TargetPathText,
+					*ReasonText,
+					*StrengthText,
+					*SourcePathText);
+				RelationEntry.RelationObject = RelationEntryObject;
+			}
 		}
-		return true;
 	}
 
-		struct FCommandletDependencyQueryRelation
-	{
-		FString From;
-		FString To;
-		FString Reason;
-		FString Strength;
-		FString SourceKind;
-		FString SourcePath;
-	};
-
-	struct FCommandletDependencyQueryCandidate
+	// GetValidSectionNamesText는 -Sections=에서 허용하는 정식 섹션 이름 목록을 반환한다.
+	FString GetValidSectionNamesText()
 	{
-		int32 RelationIndex = INDEX_NONE;
-		FString TraversalDirection;
-		FString TraversalFrom;
-		FString TraversalTo;
-	};
+		return TEXT("summary,digest,details,data_asset_values,data_asset_diff,input_summary,component_tree,bp_search_index,graphs,references,widget_designer,entity_evidence");
+	}
 
-	struct FCommandletDependencyQueryNode
+	// GetValidIntentNamesText는 -Intent=에서 허용하는 정식 분석 목적 이름 목록을 반환한다.
+	FString GetValidIntentNamesText()
 	{
-		FString ObjectPath;
-		FString AssetId;
-		FString AssetKey;
-		FString AssetClass;
-		FString AssetFamily;
-		bool bIndexed = false;
-		int32 MinDepth = 0;
-		bool bRootRole = false;
-		bool bDependencyRole = false;
-		bool bReferencerRole = false;
-	};
-
-	struct FCommandletDependencyQueryEdge
-	{
-		FString RelationFrom;
-		FString RelationTo;
-		FString TraversalFrom;
-		FString TraversalTo;
-		FString TraversalDirection;
-		int32 Depth = 0;
-		FString Reason;
-		FString Strength;
-		FString SourceKind;
-		FString SourcePath;
-		bool bClosesCycle = false;
-	};
+		return TEXT("quick_overview,widget_layout,blueprint_logic,dependency_trace");
+	}
 
-	int32 GetCommandletDependencyDirectionRank(const FString& InDirection)
+	// GetValidProfileNamesText는 -Profile=에서 허용하는 정식 출력 프리셋 이름 목록을 반환한다.
+		FString GetValidProfileNamesText()
 	{
-		return InDirection == TEXT("dependencies") ? 0 : 1;
+				return TEXT("full,summary_only,digest_only,ai_context,niagara_deep_evidence,niagara_material_evidence");
 	}
 
-	// BuildCommandletDependencyTraceQueryJson은 accepted stored indexes 위에서 bounded dependency traversal을 수행한다.
-	bool BuildCommandletDependencyTraceQueryJson(
-		const FString& InDumpRootPath,
-		const FString& InAssetObjectPathSelector,
-		const FString& InAssetIdSelector,
-		const FString& InDirection,
-		const FString& InStrength,
-		int32 InMaxDepth,
-		int32 InMaxNodes,
-		int32 InMaxEdges,
-		FString& OutJsonText,
-		FString& OutErrorCode,
-		FString& OutErrorDetail)
-	{
-		OutJsonText.Reset();
-		OutErrorCode.Reset();
-		OutErrorDetail.Reset();
-
-		auto Fail = [&OutErrorCode, &OutErrorDetail](const TCHAR* InCode, const FString& InDetail)
-		{
-			OutErrorCode = InCode;
-			OutErrorDetail = InDetail;
-			return false;
-		};
-
-		const FString AssetIndexFilePath = FPaths::Combine(InDumpRootPath, TEXT("asset_index.json"));
-		const FString DependencyIndexFilePath = FPaths::Combine(InDumpRootPath, TEXT("dependency_index.json"));
-		if (!IFileManager::Get().FileExists(*AssetIndexFilePath)
-			|| !IFileManager::Get().FileExists(*DependencyIndexFilePath))
+	// TryResolveDumpSection은 정규화한 이름을 주요 JSON 섹션 값으로 변환한다.
+	bool TryResolveDumpSection(const FString& InSectionName, EADumpSection& OutSection)
+	{
+		if (InSectionName == TEXT("summary"))
 		{
-			return Fail(
-				TEXT("ADUMP_DEP_QUERY_INDEX_NOT_FOUND"),
-				FString::Printf(TEXT("Required asset/dependency indexes are missing under dump root: %s"), *InDumpRootPath));
+			OutSection = EADumpSection::Summary;
+			return true;
 		}
-
-		TSharedPtr<FJsonObject> AssetIndexRootObject;
-		TSharedPtr<FJsonObject> DependencyIndexRootObject;
-		if (!LoadCommandletJsonObjectFromFile(AssetIndexFilePath, AssetIndexRootObject)
-			|| !LoadCommandletJsonObjectFromFile(DependencyIndexFilePath, DependencyIndexRootObject))
+		if (InSectionName == TEXT("digest"))
 		{
-			return Fail(
-				TEXT("ADUMP_DEP_QUERY_INDEX_JSON_INVALID"),
-				TEXT("asset_index.json or dependency_index.json is not a readable JSON object."));
+			OutSection = EADumpSection::Digest;
+			return true;
 		}
-
-		if (GetCommandletStringFieldOrEmpty(AssetIndexRootObject, TEXT("schema_version")) != TEXT("asset_index_v1"))
+		if (InSectionName == TEXT("details"))
 		{
-			return Fail(
-				TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
-				TEXT("The selected asset index is not asset_index_v1."));
+			OutSection = EADumpSection::Details;
+			return true;
 		}
-
-		const TArray<TSharedPtr<FJsonValue>>* AssetValueArray = nullptr;
-		if (!AssetIndexRootObject->TryGetArrayField(TEXT("assets"), AssetValueArray) || !AssetValueArray)
+		if (InSectionName == TEXT("data_asset_values"))
 		{
-			return Fail(
-				TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
-				TEXT("asset_index_v1 assets array is missing."));
+			OutSection = EADumpSection::DataAssetValues;
+			return true;
 		}
-
-		double AssetCountValue = -1.0;
-		if (!AssetIndexRootObject->TryGetNumberField(TEXT("asset_count"), AssetCountValue)
-			|| !FMath::IsNearlyEqual(AssetCountValue, static_cast<double>(AssetValueArray->Num())))
+		if (InSectionName == TEXT("data_asset_diff"))
 		{
-			return Fail(
-				TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
-				TEXT("asset_index_v1 asset_count does not agree with assets[]."));
+			OutSection = EADumpSection::DataAssetDiff;
+			return true;
 		}
-
-		TMap<FString, TSharedPtr<FJsonObject>> AssetObjectByPath;
-		TMap<FString, TSharedPtr<FJsonObject>> AssetObjectById;
-		for (const TSharedPtr<FJsonValue>& AssetValue : *AssetValueArray)
+		if (InSectionName == TEXT("input_summary"))
 		{
-			if (!AssetValue.IsValid() || AssetValue->Type != EJson::Object)
-			{
-				return Fail(
-					TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
-					TEXT("asset_index_v1 contains a non-object asset entry."));
-			}
-
-			const TSharedPtr<FJsonObject> AssetObject = AssetValue->AsObject();
-			const FString AssetIdText = GetCommandletStringFieldOrEmpty(AssetObject, TEXT("asset_id"));
-			const FString ObjectPathText = GetCommandletStringFieldOrEmpty(AssetObject, TEXT("object_path"));
-			if (AssetIdText.IsEmpty()
-				|| ObjectPathText.IsEmpty()
-				|| !ObjectPathText.StartsWith(TEXT("/"))
-				|| AssetObjectById.Contains(AssetIdText)
-				|| AssetObjectByPath.Contains(ObjectPathText))
-			{
-				return Fail(
-					TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
-					TEXT("asset_index_v1 contains an invalid or duplicate asset identity."));
-			}
-			AssetObjectById.Add(AssetIdText, AssetObject);
-			AssetObjectByPath.Add(ObjectPathText, AssetObject);
+			OutSection = EADumpSection::InputSummary;
+			return true;
 		}
-
-		TSharedPtr<FJsonObject> ResolvedAssetObject;
-		if (!InAssetObjectPathSelector.IsEmpty())
+		if (InSectionName == TEXT("component_tree"))
+		{
+			OutSection = EADumpSection::ComponentTree;
+			return true;
+		}
+		if (InSectionName == TEXT("bp_search_index"))
+	{
+		OutSection = EADumpSection::BPSearchIndex;
+		return true;
+	}
+	if (InSectionName == TEXT("graphs"))
 		{
-			ResolvedAssetObject = AssetObjectByPath.FindRef(InAssetObjectPathSelector);
+			OutSection = EADumpSection::Graphs;
+			return true;
 		}
-		else if (!InAssetIdSelector.IsEmpty())
+		if (InSectionName == TEXT("references"))
 		{
-			ResolvedAssetObject = AssetObjectById.FindRef(InAssetIdSelector);
+			OutSection = EADumpSection::References;
+			return true;
 		}
-		if (!ResolvedAssetObject.IsValid())
+				if (InSectionName == TEXT("widget_designer"))
 		{
-			const FString SelectorText = !InAssetObjectPathSelector.IsEmpty()
-				? InAssetObjectPathSelector
-				: InAssetIdSelector;
-			return Fail(
-				TEXT("ADUMP_DEP_QUERY_ASSET_NOT_FOUND"),
-				FString::Printf(TEXT("No indexed asset matches selector: %s"), *SelectorText));
+			OutSection = EADumpSection::WidgetDesigner;
+			return true;
 		}
+		if (InSectionName == TEXT("entity_evidence"))
+		{
+			OutSection = EADumpSection::EntityEvidence;
+			return true;
+		}
+		return false;
+	}
 
-		FString DependencyGeneratedTime;
-		const TArray<TSharedPtr<FJsonValue>>* RelationValueArray = nullptr;
-		double RelationCountValue = -1.0;
-		if (!DependencyIndexRootObject->TryGetStringField(TEXT("generated_time"), DependencyGeneratedTime)
-			|| DependencyGeneratedTime.IsEmpty()
-			|| !DependencyIndexRootObject->TryGetArrayField(TEXT("relations"), RelationValueArray)
-			|| !RelationValueArray
-			|| !DependencyIndexRootObject->TryGetNumberField(TEXT("relation_count"), RelationCountValue)
-			|| !FMath::IsNearlyEqual(RelationCountValue, static_cast<double>(RelationValueArray ? RelationValueArray->Num() : 0)))
-		{
-			return Fail(
-				TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
-				TEXT("dependency_index.json root contract is unsupported."));
-		}
-
-		TArray<FCommandletDependencyQueryRelation> RelationArray;
-		RelationArray.Reserve(RelationValueArray->Num());
-		for (const TSharedPtr<FJsonValue>& RelationValue : *RelationValueArray)
-		{
-			if (!RelationValue.IsValid() || RelationValue->Type != EJson::Object)
-			{
-				return Fail(
-					TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
-					TEXT("dependency_index.json contains a non-object relation."));
-			}
-
-			const TSharedPtr<FJsonObject> RelationObject = RelationValue->AsObject();
-			FCommandletDependencyQueryRelation Relation;
-			if (!RelationObject->TryGetStringField(TEXT("from"), Relation.From)
-				|| !RelationObject->TryGetStringField(TEXT("to"), Relation.To)
-				|| !RelationObject->TryGetStringField(TEXT("reason"), Relation.Reason)
-				|| !RelationObject->TryGetStringField(TEXT("strength"), Relation.Strength)
-				|| !RelationObject->TryGetStringField(TEXT("source_kind"), Relation.SourceKind)
-				|| !RelationObject->TryGetStringField(TEXT("source_path"), Relation.SourcePath)
-				|| Relation.From.IsEmpty()
-				|| Relation.To.IsEmpty()
-				|| !Relation.From.StartsWith(TEXT("/"))
-				|| !Relation.To.StartsWith(TEXT("/"))
-				|| (Relation.Strength != TEXT("hard") && Relation.Strength != TEXT("soft")))
-			{
-				return Fail(
-					TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
-					TEXT("dependency_index.json contains an invalid relation contract."));
-			}
-			RelationArray.Add(MoveTemp(Relation));
-		}
-
-		const FString RootObjectPath = GetCommandletStringFieldOrEmpty(ResolvedAssetObject, TEXT("object_path"));
-		TArray<FCommandletDependencyQueryNode> NodeArray;
-		TMap<FString, int32> NodeIndexByPath;
-		TMap<FString, FString> ParentPathByPath;
-		TArray<FString> QueuePathArray;
-		int32 QueueReadIndex = 0;
-
-		auto MakeNode = [&AssetObjectByPath](const FString& InObjectPath, int32 InDepth)
-		{
-			FCommandletDependencyQueryNode Node;
-			Node.ObjectPath = InObjectPath;
-			Node.MinDepth = InDepth;
-			const TSharedPtr<FJsonObject> IndexedAssetObject = AssetObjectByPath.FindRef(InObjectPath);
-			if (IndexedAssetObject.IsValid())
-			{
-				Node.bIndexed = true;
-				Node.AssetId = GetCommandletStringFieldOrEmpty(IndexedAssetObject, TEXT("asset_id"));
-				Node.AssetKey = GetCommandletStringFieldOrEmpty(IndexedAssetObject, TEXT("asset_key"));
-				Node.AssetClass = GetCommandletStringFieldOrEmpty(IndexedAssetObject, TEXT("asset_class"));
-				Node.AssetFamily = GetCommandletStringFieldOrEmpty(IndexedAssetObject, TEXT("asset_family"));
-			}
-			return Node;
-		};
-
-		FCommandletDependencyQueryNode RootNode = MakeNode(RootObjectPath, 0);
-		RootNode.bRootRole = true;
-		NodeIndexByPath.Add(RootObjectPath, NodeArray.Add(MoveTemp(RootNode)));
-		ParentPathByPath.Add(RootObjectPath, FString());
-		QueuePathArray.Add(RootObjectPath);
+	// TryGetSectionListText는 쉼표를 보존한 채 -Sections= 옵션 토큰 전체를 읽는다.
+	bool TryGetSectionListText(const FString& InCommandLine, FString& OutSectionListText)
+	{
+		OutSectionListText.Reset();
 
-		TArray<FCommandletDependencyQueryEdge> EdgeArray;
-		TSet<FString> TruncationReasonSet;
-		bool bStopForEdgeLimit = false;
+		// CommandLineCursor는 FParse::Token으로 순회할 현재 commandlet 문자열 위치다.
+		const TCHAR* CommandLineCursor = *InCommandLine;
 
-		while (QueueReadIndex < QueuePathArray.Num() && !bStopForEdgeLimit)
+		// CommandToken은 현재 순회에서 읽은 공백 구분 commandlet 토큰이다.
+		FString CommandToken;
+		while (FParse::Token(CommandLineCursor, CommandToken, true))
 		{
-			const FString CurrentPath = QueuePathArray[QueueReadIndex++];
-			const int32* CurrentNodeIndexPtr = NodeIndexByPath.Find(CurrentPath);
-			if (!CurrentNodeIndexPtr)
-			{
-				continue;
-			}
-			const int32 CurrentDepth = NodeArray[*CurrentNodeIndexPtr].MinDepth;
-			if (CurrentDepth >= InMaxDepth)
-			{
-				continue;
-			}
-
-			TArray<FCommandletDependencyQueryCandidate> CandidateArray;
-			for (int32 RelationIndex = 0; RelationIndex < RelationArray.Num(); ++RelationIndex)
-			{
-				const FCommandletDependencyQueryRelation& Relation = RelationArray[RelationIndex];
-				if (InStrength != TEXT("all") && Relation.Strength != InStrength)
-				{
-					continue;
-				}
-
-				if ((InDirection == TEXT("dependencies") || InDirection == TEXT("both"))
-					&& Relation.From == CurrentPath)
-				{
-					FCommandletDependencyQueryCandidate Candidate;
-					Candidate.RelationIndex = RelationIndex;
-					Candidate.TraversalDirection = TEXT("dependencies");
-					Candidate.TraversalFrom = CurrentPath;
-					Candidate.TraversalTo = Relation.To;
-					CandidateArray.Add(MoveTemp(Candidate));
-				}
-
-				if ((InDirection == TEXT("referencers") || InDirection == TEXT("both"))
-					&& Relation.To == CurrentPath
-					&& !(InDirection == TEXT("both") && Relation.From == Relation.To))
-				{
-					FCommandletDependencyQueryCandidate Candidate;
-					Candidate.RelationIndex = RelationIndex;
-					Candidate.TraversalDirection = TEXT("referencers");
-					Candidate.TraversalFrom = CurrentPath;
-					Candidate.TraversalTo = Relation.From;
-					CandidateArray.Add(MoveTemp(Candidate));
-				}
-			}
-
-			CandidateArray.Sort([&RelationArray](const FCommandletDependencyQueryCandidate& InLeft, const FCommandletDependencyQueryCandidate& InRight)
-			{
-				const int32 LeftDirectionRank = GetCommandletDependencyDirectionRank(InLeft.TraversalDirection);
-				const int32 RightDirectionRank = GetCommandletDependencyDirectionRank(InRight.TraversalDirection);
-				if (LeftDirectionRank != RightDirectionRank)
-				{
-					return LeftDirectionRank < RightDirectionRank;
-				}
-
-								auto CompareText = [](const FString& InA, const FString& InB)
-				{
-					return InA.Compare(InB, ESearchCase::CaseSensitive);
-				};
-
-				int32 CompareResult = CompareText(InLeft.TraversalTo, InRight.TraversalTo);
-				if (CompareResult != 0) return CompareResult < 0;
-				const FCommandletDependencyQueryRelation& LeftRelation = RelationArray[InLeft.RelationIndex];
-				const FCommandletDependencyQueryRelation& RightRelation = RelationArray[InRight.RelationIndex];
-				CompareResult = CompareText(LeftRelation.From, RightRelation.From);
-				if (CompareResult != 0) return CompareResult < 0;
-				CompareResult = CompareText(LeftRelation.To, RightRelation.To);
-				if (CompareResult != 0) return CompareResult < 0;
-				CompareResult = CompareText(LeftRelation.Strength, RightRelation.Strength);
-				if (CompareResult != 0) return CompareResult < 0;
-				CompareResult = CompareText(LeftRelation.Reason, RightRelation.Reason);
-				if (CompareResult != 0) return CompareResult < 0;
-				CompareResult = CompareText(LeftRelation.SourceKind, RightRelation.SourceKind);
-				if (CompareResult != 0) return CompareResult < 0;
-				return CompareText(LeftRelation.SourcePath, RightRelation.SourcePath) < 0;
-			});
-
-			for (const FCommandletDependencyQueryCandidate& Candidate : CandidateArray)
+			// NormalizedToken은 선택적인 선행 하이픈을 제거한 옵션 토큰이다.
+			FString NormalizedToken = CommandToken;
+			NormalizedToken.RemoveFromStart(TEXT("-"));
+			if (NormalizedToken.StartsWith(TEXT("Sections="), ESearchCase::IgnoreCase))
 			{
-				if (EdgeArray.Num() >= InMaxEdges)
-				{
-					TruncationReasonSet.Add(TEXT("max_edges"));
-					bStopForEdgeLimit = true;
-					break;
-				}
-
-				const bool bNodeAlreadyExists = NodeIndexByPath.Contains(Candidate.TraversalTo);
-				if (!bNodeAlreadyExists && NodeArray.Num() >= InMaxNodes)
-				{
-					TruncationReasonSet.Add(TEXT("max_nodes"));
-					continue;
-				}
-
-				bool bClosesCycle = false;
-				FString AncestorPath = CurrentPath;
-				while (!AncestorPath.IsEmpty())
-				{
-					if (Candidate.TraversalTo == AncestorPath)
-					{
-						bClosesCycle = true;
-						break;
-					}
-					const FString* ParentPath = ParentPathByPath.Find(AncestorPath);
-					if (!ParentPath)
-					{
-						break;
-					}
-					AncestorPath = *ParentPath;
-				}
-
-				int32 TargetNodeIndex = INDEX_NONE;
-				if (const int32* ExistingNodeIndex = NodeIndexByPath.Find(Candidate.TraversalTo))
-				{
-					TargetNodeIndex = *ExistingNodeIndex;
-				}
-				else
-				{
-					FCommandletDependencyQueryNode NewNode = MakeNode(Candidate.TraversalTo, CurrentDepth + 1);
-					TargetNodeIndex = NodeArray.Add(MoveTemp(NewNode));
-					NodeIndexByPath.Add(Candidate.TraversalTo, TargetNodeIndex);
-					ParentPathByPath.Add(Candidate.TraversalTo, CurrentPath);
-					QueuePathArray.Add(Candidate.TraversalTo);
-				}
-
-				if (Candidate.TraversalDirection == TEXT("dependencies"))
-				{
-					NodeArray[TargetNodeIndex].bDependencyRole = true;
-				}
-				else
-				{
-					NodeArray[TargetNodeIndex].bReferencerRole = true;
-				}
-
-				const FCommandletDependencyQueryRelation& Relation = RelationArray[Candidate.RelationIndex];
-				FCommandletDependencyQueryEdge Edge;
-				Edge.RelationFrom = Relation.From;
-				Edge.RelationTo = Relation.To;
-				Edge.TraversalFrom = Candidate.TraversalFrom;
-				Edge.TraversalTo = Candidate.TraversalTo;
-				Edge.TraversalDirection = Candidate.TraversalDirection;
-				Edge.Depth = CurrentDepth + 1;
-				Edge.Reason = Relation.Reason;
-				Edge.Strength = Relation.Strength;
-				Edge.SourceKind = Relation.SourceKind;
-				Edge.SourcePath = Relation.SourcePath;
-				Edge.bClosesCycle = bClosesCycle;
-				EdgeArray.Add(MoveTemp(Edge));
+				OutSectionListText = NormalizedToken.Mid(9);
+				return true;
 			}
 		}
+		return false;
+	}
 
-		NodeArray.Sort([](const FCommandletDependencyQueryNode& InLeft, const FCommandletDependencyQueryNode& InRight)
-		{
-			if (InLeft.MinDepth != InRight.MinDepth)
-			{
-				return InLeft.MinDepth < InRight.MinDepth;
-			}
-						return InLeft.ObjectPath.Compare(InRight.ObjectPath, ESearchCase::CaseSensitive) < 0;
-		});
+	// TryParseSectionSelection은 Intent 검증 helper가 재사용할 -Sections= 파서 선언이다.
+	bool TryParseSectionSelection(
+		const FString& InCommandLine,
+		FADumpSectionSelection& OutSectionSelection,
+		FString& OutErrorMessage);
 
-		EdgeArray.Sort([](const FCommandletDependencyQueryEdge& InLeft, const FCommandletDependencyQueryEdge& InRight)
+	// TryResolveIntentSelection은 정규화한 Intent 이름을 정식 섹션 선택으로 변환한다.
+	bool TryResolveIntentSelection(const FString& InIntentName, FADumpSectionSelection& OutSectionSelection)
+	{
+		OutSectionSelection.ResetToExplicitMode();
+		if (InIntentName == TEXT("quick_overview"))
 		{
-			if (InLeft.Depth != InRight.Depth) return InLeft.Depth < InRight.Depth;
-			const int32 LeftDirectionRank = GetCommandletDependencyDirectionRank(InLeft.TraversalDirection);
-			const int32 RightDirectionRank = GetCommandletDependencyDirectionRank(InRight.TraversalDirection);
-			if (LeftDirectionRank != RightDirectionRank) return LeftDirectionRank < RightDirectionRank;
-
-						auto CompareText = [](const FString& InA, const FString& InB)
-			{
-				return InA.Compare(InB, ESearchCase::CaseSensitive);
-			};
-			int32 CompareResult = CompareText(InLeft.TraversalFrom, InRight.TraversalFrom);
-			if (CompareResult != 0) return CompareResult < 0;
-			CompareResult = CompareText(InLeft.TraversalTo, InRight.TraversalTo);
-			if (CompareResult != 0) return CompareResult < 0;
-			CompareResult = CompareText(InLeft.RelationFrom, InRight.RelationFrom);
-			if (CompareResult != 0) return CompareResult < 0;
-			CompareResult = CompareText(InLeft.RelationTo, InRight.RelationTo);
-			if (CompareResult != 0) return CompareResult < 0;
-			CompareResult = CompareText(InLeft.Strength, InRight.Strength);
-			if (CompareResult != 0) return CompareResult < 0;
-			CompareResult = CompareText(InLeft.Reason, InRight.Reason);
-			if (CompareResult != 0) return CompareResult < 0;
-			CompareResult = CompareText(InLeft.SourceKind, InRight.SourceKind);
-			if (CompareResult != 0) return CompareResult < 0;
-			return CompareText(InLeft.SourcePath, InRight.SourcePath) < 0;
-		});
-
-		TArray<TSharedPtr<FJsonValue>> NodeValueArray;
-		NodeValueArray.Reserve(NodeArray.Num());
-		int32 MaxObservedDepth = 0;
-		for (int32 NodeIndex = 0; NodeIndex < NodeArray.Num(); ++NodeIndex)
+			OutSectionSelection.Enable(EADumpSection::Summary);
+			OutSectionSelection.Enable(EADumpSection::Digest);
+			return true;
+		}
+		if (InIntentName == TEXT("widget_layout"))
 		{
-			const FCommandletDependencyQueryNode& Node = NodeArray[NodeIndex];
-			MaxObservedDepth = FMath::Max(MaxObservedDepth, Node.MinDepth);
-			TSharedRef<FJsonObject> NodeObject = MakeShared<FJsonObject>();
-			NodeObject->SetStringField(TEXT("node_id"), FString::Printf(TEXT("node_%04d"), NodeIndex));
-			NodeObject->SetStringField(TEXT("object_path"), Node.ObjectPath);
-			NodeObject->SetStringField(TEXT("asset_id"), Node.AssetId);
-			NodeObject->SetStringField(TEXT("asset_key"), Node.AssetKey);
-			NodeObject->SetStringField(TEXT("asset_class"), Node.AssetClass);
-			NodeObject->SetStringField(TEXT("asset_family"), Node.AssetFamily);
-			NodeObject->SetBoolField(TEXT("indexed"), Node.bIndexed);
-			NodeObject->SetNumberField(TEXT("min_depth"), Node.MinDepth);
-			TArray<FString> RoleArray;
-			if (Node.bRootRole) RoleArray.Add(TEXT("root"));
-			if (Node.bDependencyRole) RoleArray.Add(TEXT("dependency"));
-			if (Node.bReferencerRole) RoleArray.Add(TEXT("referencer"));
-			AddCommandletStringArrayField(NodeObject, TEXT("roles"), RoleArray);
-			NodeValueArray.Add(MakeShared<FJsonValueObject>(NodeObject));
+			OutSectionSelection.Enable(EADumpSection::Summary);
+			OutSectionSelection.Enable(EADumpSection::Digest);
+			OutSectionSelection.Enable(EADumpSection::WidgetDesigner);
+			return true;
 		}
-
-		TArray<TSharedPtr<FJsonValue>> EdgeValueArray;
-		EdgeValueArray.Reserve(EdgeArray.Num());
-		int32 CycleEdgeCount = 0;
-		for (int32 EdgeIndex = 0; EdgeIndex < EdgeArray.Num(); ++EdgeIndex)
-		{
-			const FCommandletDependencyQueryEdge& Edge = EdgeArray[EdgeIndex];
-			if (Edge.bClosesCycle) ++CycleEdgeCount;
-			TSharedRef<FJsonObject> EdgeObject = MakeShared<FJsonObject>();
-			EdgeObject->SetStringField(TEXT("edge_id"), FString::Printf(TEXT("edge_%06d"), EdgeIndex));
-			EdgeObject->SetStringField(TEXT("relation_from"), Edge.RelationFrom);
-			EdgeObject->SetStringField(TEXT("relation_to"), Edge.RelationTo);
-			EdgeObject->SetStringField(TEXT("traversal_from"), Edge.TraversalFrom);
-			EdgeObject->SetStringField(TEXT("traversal_to"), Edge.TraversalTo);
-			EdgeObject->SetStringField(TEXT("traversal_direction"), Edge.TraversalDirection);
-			EdgeObject->SetNumberField(TEXT("depth"), Edge.Depth);
-			EdgeObject->SetStringField(TEXT("reason"), Edge.Reason);
-			EdgeObject->SetStringField(TEXT("strength"), Edge.Strength);
-			EdgeObject->SetStringField(TEXT("source_kind"), Edge.SourceKind);
-			EdgeObject->SetStringField(TEXT("source_path"), Edge.SourcePath);
-			EdgeObject->SetBoolField(TEXT("closes_cycle"), Edge.bClosesCycle);
-			EdgeValueArray.Add(MakeShared<FJsonValueObject>(EdgeObject));
-		}
-
-		TArray<FString> TruncationReasonArray;
-		if (TruncationReasonSet.Contains(TEXT("max_nodes"))) TruncationReasonArray.Add(TEXT("max_nodes"));
-		if (TruncationReasonSet.Contains(TEXT("max_edges"))) TruncationReasonArray.Add(TEXT("max_edges"));
-
-		TSharedRef<FJsonObject> QueryObject = MakeShared<FJsonObject>();
-		QueryObject->SetStringField(TEXT("selector_kind"), !InAssetObjectPathSelector.IsEmpty() ? TEXT("object_path") : TEXT("asset_id"));
-		QueryObject->SetStringField(TEXT("root_object_path"), RootObjectPath);
-		QueryObject->SetStringField(TEXT("direction"), InDirection);
-		QueryObject->SetStringField(TEXT("strength"), InStrength);
-		QueryObject->SetNumberField(TEXT("max_depth"), InMaxDepth);
-		QueryObject->SetNumberField(TEXT("max_nodes"), InMaxNodes);
-		QueryObject->SetNumberField(TEXT("max_edges"), InMaxEdges);
-
-		TSharedRef<FJsonObject> RootAssetObject = MakeShared<FJsonObject>();
-		RootAssetObject->SetStringField(TEXT("asset_id"), GetCommandletStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_id")));
-		RootAssetObject->SetStringField(TEXT("asset_key"), GetCommandletStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_key")));
-		RootAssetObject->SetStringField(TEXT("object_path"), RootObjectPath);
-		RootAssetObject->SetStringField(TEXT("asset_class"), GetCommandletStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_class")));
-		RootAssetObject->SetStringField(TEXT("asset_family"), GetCommandletStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_family")));
-		RootAssetObject->SetStringField(TEXT("fingerprint"), GetCommandletStringFieldOrEmpty(ResolvedAssetObject, TEXT("fingerprint")));
-
-		TSharedRef<FJsonObject> ResponseRootObject = MakeShared<FJsonObject>();
-		ResponseRootObject->SetStringField(TEXT("schema_version"), TEXT("dependency_trace_query_v1"));
-		ResponseRootObject->SetStringField(TEXT("generated_time"), FDateTime::UtcNow().ToIso8601());
-		ResponseRootObject->SetStringField(TEXT("source_contract"), TEXT("indexed_dependency_evidence"));
-		ResponseRootObject->SetStringField(TEXT("asset_index_schema_version"), TEXT("asset_index_v1"));
-		ResponseRootObject->SetStringField(TEXT("dependency_index_contract_version"), TEXT("legacy_dependency_index_v1"));
-		ResponseRootObject->SetObjectField(TEXT("query"), QueryObject);
-		ResponseRootObject->SetObjectField(TEXT("root_asset"), RootAssetObject);
-		ResponseRootObject->SetNumberField(TEXT("node_count"), NodeValueArray.Num());
-		ResponseRootObject->SetNumberField(TEXT("edge_count"), EdgeValueArray.Num());
-		ResponseRootObject->SetNumberField(TEXT("max_observed_depth"), MaxObservedDepth);
-		ResponseRootObject->SetNumberField(TEXT("cycle_edge_count"), CycleEdgeCount);
-		ResponseRootObject->SetBoolField(TEXT("truncated"), TruncationReasonArray.Num() > 0);
-		AddCommandletStringArrayField(ResponseRootObject, TEXT("truncation_reasons"), TruncationReasonArray);
-		ResponseRootObject->SetArrayField(TEXT("nodes"), NodeValueArray);
-		ResponseRootObject->SetArrayField(TEXT("edges"), EdgeValueArray);
-		ResponseRootObject->SetBoolField(TEXT("all_resolved"), true);
-
-		if (!SerializeJsonObjectText(ResponseRootObject, OutJsonText))
-		{
-			return Fail(
-				TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
-				TEXT("Failed to serialize dependency_trace_query_v1 response."));
+		if (InIntentName == TEXT("blueprint_logic"))
+		{
+			OutSectionSelection.Enable(EADumpSection::Summary);
+			OutSectionSelection.Enable(EADumpSection::Digest);
+			OutSectionSelection.Enable(EADumpSection::Graphs);
+			OutSectionSelection.Enable(EADumpSection::References);
+			return true;
 		}
-		return true;
+		if (InIntentName == TEXT("dependency_trace"))
+		{
+			OutSectionSelection.Enable(EADumpSection::Summary);
+			OutSectionSelection.Enable(EADumpSection::Digest);
+			OutSectionSelection.Enable(EADumpSection::References);
+			return true;
+		}
+		OutSectionSelection.ResetToFullMode();
+		return false;
 	}
 
-		// BuildCommandletQueryResultJson은 accepted native query response를 query_result_v1 success envelope으로 감싼다.
-	bool BuildCommandletQueryResultJson(
-		const FString& InQueryKind,
-		const FString& InSelectorKind,
-		const FString& InNativeJsonText,
-		FString& OutJsonText,
-		FString& OutErrorDetail)
+	// TryResolveProfileSelection은 정규화한 Profile 이름을 전체 모드 또는 정식 섹션 선택으로 변환한다.
+	bool TryResolveProfileSelection(const FString& InProfileName, FADumpSectionSelection& OutSectionSelection)
 	{
-		OutJsonText.Reset();
-		OutErrorDetail.Reset();
-
-		TSharedPtr<FJsonObject> NativeRootObject;
-		TSharedRef<TJsonReader<>> NativeReader = TJsonReaderFactory<>::Create(InNativeJsonText);
-		if (!FJsonSerializer::Deserialize(NativeReader, NativeRootObject) || !NativeRootObject.IsValid())
+		if (InProfileName == TEXT("full"))
 		{
-			OutErrorDetail = TEXT("Native query response is not a readable JSON object.");
-			return false;
+			OutSectionSelection.ResetToFullMode();
+			return true;
 		}
 
-		const FString ExpectedNativeSchema = InQueryKind == TEXT("section")
-			? TEXT("lazy_section_dump_v1")
-			: TEXT("dependency_trace_query_v1");
-		const FString ExpectedSourceContract = InQueryKind == TEXT("section")
-			? TEXT("indexed_stored_evidence")
-			: TEXT("indexed_dependency_evidence");
-		const FString NativeSchema = GetCommandletStringFieldOrEmpty(NativeRootObject, TEXT("schema_version"));
-		const FString NativeSourceContract = GetCommandletStringFieldOrEmpty(NativeRootObject, TEXT("source_contract"));
-		const FString GeneratedTime = GetCommandletStringFieldOrEmpty(NativeRootObject, TEXT("generated_time"));
-		if (NativeSchema != ExpectedNativeSchema
-			|| NativeSourceContract != ExpectedSourceContract
-			|| GeneratedTime.IsEmpty()
-			|| !GetCommandletBoolFieldOrDefault(NativeRootObject, TEXT("all_resolved"), false))
-		{
-			OutErrorDetail = FString::Printf(
-				TEXT("Native response contract mismatch: kind=%s schema=%s source_contract=%s"),
-				*InQueryKind,
-				*NativeSchema,
-				*NativeSourceContract);
-			return false;
+		OutSectionSelection.ResetToExplicitMode();
+		if (InProfileName == TEXT("summary_only"))
+		{
+			OutSectionSelection.Enable(EADumpSection::Summary);
+			return true;
 		}
-
-		const TSharedPtr<FJsonObject> NativeAssetObject = InQueryKind == TEXT("section")
-			? GetCommandletNestedObjectField(NativeRootObject, TEXT("asset"))
-			: GetCommandletNestedObjectField(NativeRootObject, TEXT("root_asset"));
-		const FString RootObjectPath = GetCommandletStringFieldOrEmpty(NativeAssetObject, TEXT("object_path"));
-		if (RootObjectPath.IsEmpty() || !RootObjectPath.StartsWith(TEXT("/")))
+				if (InProfileName == TEXT("digest_only") || InProfileName == TEXT("ai_context"))
 		{
-			OutErrorDetail = TEXT("Native response does not contain a valid resolved root object path.");
-			return false;
+			OutSectionSelection.Enable(EADumpSection::Summary);
+			OutSectionSelection.Enable(EADumpSection::Digest);
+			return true;
+		}
+				if (InProfileName == TEXT("niagara_deep_evidence") || InProfileName == TEXT("niagara_material_evidence"))
+		{
+			OutSectionSelection.Enable(EADumpSection::EntityEvidence);
+			return true;
 		}
 
-		TSharedRef<FJsonObject> QueryObject = MakeShared<FJsonObject>();
-		QueryObject->SetStringField(TEXT("mode"), TEXT("query"));
-		QueryObject->SetStringField(TEXT("query_kind"), InQueryKind);
-		QueryObject->SetStringField(TEXT("selector_kind"), InSelectorKind);
-		QueryObject->SetStringField(TEXT("root_object_path"), RootObjectPath);
-		QueryObject->SetStringField(TEXT("result_schema"), TEXT("query_result_v1"));
+		OutSectionSelection.ResetToFullMode();
+		return false;
+	}
 
-		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
-		ResultObject->SetStringField(TEXT("native_schema_version"), NativeSchema);
-		ResultObject->SetStringField(TEXT("native_source_contract"), NativeSourceContract);
-		ResultObject->SetObjectField(TEXT("payload"), NativeRootObject.ToSharedRef());
+	// TryParseIntentSelection은 단일 -Intent= 값을 검증하고 정식 섹션 선택으로 변환한다.
+	bool TryParseIntentSelection(
+		const FString& InCommandLine,
+		FString& OutIntentName,
+		FADumpSectionSelection& OutSectionSelection,
+		FString& OutErrorMessage)
+	{
+		OutIntentName.Reset();
+		OutSectionSelection.ResetToFullMode();
+		OutErrorMessage.Reset();
 
-		TSharedRef<FJsonObject> WrapperRootObject = MakeShared<FJsonObject>();
-		WrapperRootObject->SetStringField(TEXT("schema_version"), TEXT("query_result_v1"));
-		WrapperRootObject->SetStringField(TEXT("generated_time"), GeneratedTime);
-		WrapperRootObject->SetStringField(TEXT("status"), TEXT("succeeded"));
-		WrapperRootObject->SetObjectField(TEXT("query"), QueryObject);
-		WrapperRootObject->SetObjectField(TEXT("result"), ResultObject);
-		WrapperRootObject->SetBoolField(TEXT("all_resolved"), true);
+		// CommandLineCursor는 FParse::Token으로 순회할 현재 commandlet 문자열 위치다.
+		const TCHAR* CommandLineCursor = *InCommandLine;
 
-		if (!SerializeJsonObjectText(WrapperRootObject, OutJsonText))
+		// CommandToken은 현재 순회에서 읽은 공백 구분 commandlet 토큰이다.
+		FString CommandToken;
+		while (FParse::Token(CommandLineCursor, CommandToken, true))
 		{
-			OutErrorDetail = TEXT("Failed to serialize query_result_v1 response.");
-			return false;
+			// NormalizedToken은 선택적인 선행 하이픈을 제거한 옵션 토큰이다.
+			FString NormalizedToken = CommandToken;
+			NormalizedToken.RemoveFromStart(TEXT("-"));
+			if (!NormalizedToken.StartsWith(TEXT("Intent="), ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+			if (!OutIntentName.IsEmpty())
+			{
+				OutErrorMessage = FString::Printf(TEXT("-Intent= accepts exactly one value. Valid intents: %s"), *GetValidIntentNamesText());
+				return false;
+			}
+			OutIntentName = NormalizedToken.Mid(7);
+			OutIntentName.TrimStartAndEndInline();
+			OutIntentName.ToLowerInline();
+			if (OutIntentName.IsEmpty())
+			{
+				OutErrorMessage = FString::Printf(TEXT("-Intent= requires one value. Valid intents: %s"), *GetValidIntentNamesText());
+				return false;
+			}
 		}
-		return true;
-	}
 
-		// CopyCommandletJsonField는 기존 JSON field를 의미 변경 없이 새 object에 복사한다.
-	bool CopyCommandletJsonField(
-		const TSharedPtr<FJsonObject>& InSourceObject,
-		const TCHAR* InFieldName,
-		const TSharedRef<FJsonObject>& InTargetObject)
-	{
-		if (!InSourceObject.IsValid())
+		if (OutIntentName.IsEmpty())
 		{
-			return false;
+			return true;
 		}
-
-		const TSharedPtr<FJsonValue> SourceValue = InSourceObject->TryGetField(InFieldName);
-		if (!SourceValue.IsValid())
+		if (!TryResolveIntentSelection(OutIntentName, OutSectionSelection))
 		{
+			OutErrorMessage = FString::Printf(TEXT("Unknown intent '%s' in -Intent=. Valid intents: %s"), *OutIntentName, *GetValidIntentNamesText());
 			return false;
 		}
-
-		InTargetObject->SetField(InFieldName, SourceValue);
 		return true;
 	}
 
-	// GetCommandletUtf8ByteLength는 저장할 JSON 문자열의 BOM 없는 UTF-8 byte 수를 반환한다.
-	int32 GetCommandletUtf8ByteLength(const FString& InText)
-	{
-		FTCHARToUTF8 Utf8Text(*InText);
-		return Utf8Text.Length();
-	}
-
-	// BuildCommandletAIContextBundleJson은 accepted query_result_v1을 bounded ai_context_bundle_v1로 변환한다.
-	bool BuildCommandletAIContextBundleJson(
-		const TSharedPtr<FJsonObject>& InQueryResultObject,
-		int32 InMaxItems,
-		int32 InMaxBytes,
-		FString& OutJsonText,
-		FString& OutErrorCode,
-		FString& OutErrorDetail)
+	// TryParseProfileSelection은 단일 -Profile= 값을 검증하고 정식 섹션 선택으로 변환한다.
+	bool TryParseProfileSelection(
+		const FString& InCommandLine,
+		FString& OutProfileName,
+		FADumpSectionSelection& OutSectionSelection,
+		FString& OutErrorMessage)
 	{
-		OutJsonText.Reset();
-		OutErrorCode.Reset();
-		OutErrorDetail.Reset();
+		OutProfileName.Reset();
+		OutSectionSelection.ResetToFullMode();
+		OutErrorMessage.Reset();
 
-		auto Fail = [&](const TCHAR* InCode, const FString& InDetail)
-		{
-			OutErrorCode = InCode;
-			OutErrorDetail = InDetail;
-			return false;
-		};
+		// CommandLineCursor는 FParse::Token으로 순회할 현재 commandlet 문자열 위치다.
+		const TCHAR* CommandLineCursor = *InCommandLine;
 
-		if (!InQueryResultObject.IsValid()
-			|| GetCommandletStringFieldOrEmpty(InQueryResultObject, TEXT("schema_version")) != TEXT("query_result_v1"))
+		// CommandToken은 현재 순회에서 읽은 공백 구분 commandlet 토큰이다.
+		FString CommandToken;
+		while (FParse::Token(CommandLineCursor, CommandToken, true))
 		{
-			return Fail(TEXT("ADUMP_CONTEXT_INPUT_SCHEMA_UNSUPPORTED"), TEXT("Input schema_version must be query_result_v1."));
+			// NormalizedToken은 선택적인 선행 하이픈을 제거한 옵션 토큰이다.
+			FString NormalizedToken = CommandToken;
+			NormalizedToken.RemoveFromStart(TEXT("-"));
+			if (!NormalizedToken.StartsWith(TEXT("Profile="), ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+			if (!OutProfileName.IsEmpty())
+			{
+				OutErrorMessage = FString::Printf(TEXT("-Profile= accepts exactly one value. Valid profiles: %s"), *GetValidProfileNamesText());
+				return false;
+			}
+			OutProfileName = NormalizedToken.Mid(8);
+			OutProfileName.TrimStartAndEndInline();
+			OutProfileName.ToLowerInline();
+			if (OutProfileName.IsEmpty())
+			{
+				OutErrorMessage = FString::Printf(TEXT("-Profile= requires one value. Valid profiles: %s"), *GetValidProfileNamesText());
+				return false;
+			}
 		}
 
-		const FString StatusText = GetCommandletStringFieldOrEmpty(InQueryResultObject, TEXT("status"));
-		const FString GeneratedTimeText = GetCommandletStringFieldOrEmpty(InQueryResultObject, TEXT("generated_time"));
-		if (StatusText != TEXT("succeeded")
-			|| GeneratedTimeText.IsEmpty()
-			|| !GetCommandletBoolFieldOrDefault(InQueryResultObject, TEXT("all_resolved"), false))
+		if (OutProfileName.IsEmpty())
 		{
-			return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Input query_result_v1 must be succeeded, resolved, and contain generated_time."));
+			return true;
 		}
-
-		const TSharedPtr<FJsonObject> QueryObject = GetCommandletNestedObjectField(InQueryResultObject, TEXT("query"));
-		const TSharedPtr<FJsonObject> ResultObject = GetCommandletNestedObjectField(InQueryResultObject, TEXT("result"));
-		const TSharedPtr<FJsonObject> PayloadObject = GetCommandletNestedObjectField(ResultObject, TEXT("payload"));
-		if (!QueryObject.IsValid() || !ResultObject.IsValid() || !PayloadObject.IsValid())
+		if (!TryResolveProfileSelection(OutProfileName, OutSectionSelection))
 		{
-			return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Input query_result_v1 requires query, result, and result.payload objects."));
+			OutErrorMessage = FString::Printf(TEXT("Unknown profile '%s' in -Profile=. Valid profiles: %s"), *OutProfileName, *GetValidProfileNamesText());
+			return false;
 		}
+		return true;
+	}
 
-		const FString QueryModeText = GetCommandletStringFieldOrEmpty(QueryObject, TEXT("mode"));
-		const FString QueryKindText = GetCommandletStringFieldOrEmpty(QueryObject, TEXT("query_kind"));
-		const FString SelectorKindText = GetCommandletStringFieldOrEmpty(QueryObject, TEXT("selector_kind"));
-		const FString RootObjectPath = GetCommandletStringFieldOrEmpty(QueryObject, TEXT("root_object_path"));
-		const FString ResultSchemaText = GetCommandletStringFieldOrEmpty(QueryObject, TEXT("result_schema"));
-		if (QueryModeText != TEXT("query")
-			|| (QueryKindText != TEXT("section") && QueryKindText != TEXT("dependency"))
-			|| (SelectorKindText != TEXT("object_path") && SelectorKindText != TEXT("asset_id"))
-			|| RootObjectPath.IsEmpty()
-			|| !RootObjectPath.StartsWith(TEXT("/"))
-			|| ResultSchemaText != TEXT("query_result_v1"))
+	// ResolveEffectiveSelection은 Sections > Intent > Profile > implicit full 우선순위로 최종 선택값과 출처를 결정한다.
+	void ResolveEffectiveSelection(
+		const FADumpSectionSelection& InExplicitSelection,
+		const FString& InIntentName,
+		const FADumpSectionSelection& InIntentSelection,
+		const FString& InProfileName,
+		const FADumpSectionSelection& InProfileSelection,
+		FADumpSectionSelection& OutSelection,
+		FString& OutSectionSource)
+	{
+		OutSelection.ResetToFullMode();
+		OutSectionSource = TEXT("full");
+		if (!InProfileName.IsEmpty())
 		{
-			return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Input query metadata is outside the accepted query_result_v1 contract."));
+			OutSelection = InProfileSelection;
+			OutSectionSource = TEXT("profile");
 		}
-
-		const FString NativeSchemaText = GetCommandletStringFieldOrEmpty(ResultObject, TEXT("native_schema_version"));
-		const FString NativeSourceContractText = GetCommandletStringFieldOrEmpty(ResultObject, TEXT("native_source_contract"));
-		const FString PayloadSchemaText = GetCommandletStringFieldOrEmpty(PayloadObject, TEXT("schema_version"));
-		const FString PayloadSourceContractText = GetCommandletStringFieldOrEmpty(PayloadObject, TEXT("source_contract"));
-		const FString PayloadGeneratedTimeText = GetCommandletStringFieldOrEmpty(PayloadObject, TEXT("generated_time"));
-		if (PayloadGeneratedTimeText != GeneratedTimeText
-			|| !GetCommandletBoolFieldOrDefault(PayloadObject, TEXT("all_resolved"), false))
+		if (!InIntentName.IsEmpty())
 		{
-			return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Input wrapper and native payload generated_time/all_resolved values do not agree."));
+			OutSelection = InIntentSelection;
+			OutSectionSource = TEXT("intent");
 		}
-
-		const FString ExpectedNativeSchema = QueryKindText == TEXT("section")
-			? TEXT("lazy_section_dump_v1")
-			: TEXT("dependency_trace_query_v1");
-		const FString ExpectedNativeSourceContract = QueryKindText == TEXT("section")
-			? TEXT("indexed_stored_evidence")
-			: TEXT("indexed_dependency_evidence");
-		if (NativeSchemaText != ExpectedNativeSchema
-			|| NativeSourceContractText != ExpectedNativeSourceContract
-			|| PayloadSchemaText != ExpectedNativeSchema
-			|| PayloadSourceContractText != ExpectedNativeSourceContract)
+		if (InExplicitSelection.bIsExplicit)
 		{
-			return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Input native schema/source pair does not match query_kind."));
+			OutSelection = InExplicitSelection;
+			OutSectionSource = TEXT("sections");
 		}
+	}
 
-		const TSharedPtr<FJsonObject> NativeRootAssetObject = QueryKindText == TEXT("section")
-			? GetCommandletNestedObjectField(PayloadObject, TEXT("asset"))
-			: GetCommandletNestedObjectField(PayloadObject, TEXT("root_asset"));
-		if (!NativeRootAssetObject.IsValid()
-			|| GetCommandletStringFieldOrEmpty(NativeRootAssetObject, TEXT("object_path")) != RootObjectPath)
-		{
-			return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Input native root object path does not match wrapper query.root_object_path."));
-		}
+	// VerifyIntentResolution은 Intent 매핑과 -Sections= 우선순위의 request/builder 결과를 검증한다.
+	bool VerifyIntentResolution(
+		const FString& InCommandLine,
+		const FString& InExpectedIntentName,
+		const FString& InExpectedProfileName,
+		const FString& InExpectedSectionSource,
+		const FString& InExpectedSectionsText,
+		const FString& InExpectedBuilderSectionsText,
+		FString& OutDetailText)
+	{
+		// ExplicitSelection은 -Sections=에서 파싱한 명시적 선택값이다.
+		FADumpSectionSelection ExplicitSelection;
 
-		TArray<TSharedPtr<FJsonValue>> CandidateItemArray;
-		bool bSourceTruncated = false;
-		TArray<FString> SourceTruncationReasonArray;
+		// IntentSelection은 -Intent= 매핑에서 파생한 선택값이다.
+		FADumpSectionSelection IntentSelection;
 
-		if (QueryKindText == TEXT("section"))
-		{
-			const TArray<TSharedPtr<FJsonValue>>* SectionValueArray = nullptr;
-			const int32 SectionCount = GetCommandletIntegerFieldOrDefault(PayloadObject, TEXT("section_count"), -1);
-			if (!PayloadObject->TryGetArrayField(TEXT("sections"), SectionValueArray)
-				|| !SectionValueArray
-				|| SectionCount != SectionValueArray->Num())
-			{
-				return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Section payload section_count/sections contract is invalid."));
-			}
+		// ProfileSelection은 -Profile= 매핑에서 파생된 선택값이다.
+		FADumpSectionSelection ProfileSelection;
 
-			CandidateItemArray.Reserve(SectionValueArray->Num());
-			for (int32 SectionIndex = 0; SectionIndex < SectionValueArray->Num(); ++SectionIndex)
-			{
-				const TSharedPtr<FJsonValue>& SectionValue = (*SectionValueArray)[SectionIndex];
-				if (!SectionValue.IsValid() || SectionValue->Type != EJson::Object)
-				{
-					return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Section payload contains a non-object section item."));
-				}
+		// IntentName은 -Intent=에서 정규화한 이름이다.
+		FString IntentName;
 
-				const TSharedPtr<FJsonObject> SectionObject = SectionValue->AsObject();
-				const FString SectionNameText = GetCommandletStringFieldOrEmpty(SectionObject, TEXT("section_name"));
-				const FString SectionSchemaText = GetCommandletStringFieldOrEmpty(SectionObject, TEXT("section_schema_version"));
-				const FString SourceFileText = GetCommandletStringFieldOrEmpty(SectionObject, TEXT("source_file"));
-				const FString JsonPointerText = GetCommandletStringFieldOrEmpty(SectionObject, TEXT("json_pointer"));
-				const FString StorageKindText = GetCommandletStringFieldOrEmpty(SectionObject, TEXT("storage_kind"));
-				const TSharedPtr<FJsonValue> DataValue = SectionObject.IsValid() ? SectionObject->TryGetField(TEXT("data")) : nullptr;
-								if (SectionNameText.IsEmpty()
-					|| !SectionObject->HasField(TEXT("section_schema_version"))
-					|| SourceFileText.IsEmpty()
-					|| !FPaths::IsRelative(SourceFileText)
-					|| SourceFileText.Contains(TEXT("\\"))
-					|| SourceFileText.StartsWith(TEXT("../"))
-					|| !JsonPointerText.StartsWith(TEXT("/"))
-					|| StorageKindText.IsEmpty()
-					|| !DataValue.IsValid())
-				{
-					return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Section payload item is missing required evidence fields."));
-				}
+		// ProfileName은 -Profile=에서 정규화한 이름이다.
+		FString ProfileName;
 
-				TSharedRef<FJsonObject> ItemObject = MakeShared<FJsonObject>();
-				ItemObject->SetStringField(TEXT("item_id"), FString::Printf(TEXT("item_%04d"), SectionIndex));
-				ItemObject->SetStringField(TEXT("item_kind"), TEXT("section"));
-				ItemObject->SetNumberField(TEXT("source_index"), SectionIndex);
-				ItemObject->SetStringField(TEXT("object_path"), RootObjectPath);
-				ItemObject->SetStringField(TEXT("section_name"), SectionNameText);
-				ItemObject->SetStringField(TEXT("section_schema_version"), SectionSchemaText);
-				ItemObject->SetStringField(TEXT("source_file"), SourceFileText);
-				ItemObject->SetStringField(TEXT("json_pointer"), JsonPointerText);
-				ItemObject->SetStringField(TEXT("storage_kind"), StorageKindText);
-				ItemObject->SetField(TEXT("data"), DataValue);
-				CandidateItemArray.Add(MakeShared<FJsonValueObject>(ItemObject));
-			}
-		}
-		else
+		// ParseError는 섹션 또는 Intent 파싱 실패 이유다.
+		FString ParseError;
+		if (!TryParseSectionSelection(InCommandLine, ExplicitSelection, ParseError)
+			|| !TryParseIntentSelection(InCommandLine, IntentName, IntentSelection, ParseError)
+			|| !TryParseProfileSelection(InCommandLine, ProfileName, ProfileSelection, ParseError))
 		{
-			const TArray<TSharedPtr<FJsonValue>>* NodeValueArray = nullptr;
-			const TArray<TSharedPtr<FJsonValue>>* EdgeValueArray = nullptr;
-			const int32 NodeCount = GetCommandletIntegerFieldOrDefault(PayloadObject, TEXT("node_count"), -1);
-			const int32 EdgeCount = GetCommandletIntegerFieldOrDefault(PayloadObject, TEXT("edge_count"), -1);
-			if (!PayloadObject->TryGetArrayField(TEXT("nodes"), NodeValueArray)
-				|| !PayloadObject->TryGetArrayField(TEXT("edges"), EdgeValueArray)
-				|| !NodeValueArray
-				|| !EdgeValueArray
-				|| NodeCount != NodeValueArray->Num()
-				|| EdgeCount != EdgeValueArray->Num())
-			{
-				return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency payload node/edge counts do not match their arrays."));
-			}
-
-			bool bNativeTruncated = false;
-			if (!PayloadObject->TryGetBoolField(TEXT("truncated"), bNativeTruncated))
-			{
-				return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency payload is missing truncated."));
-			}
-			bSourceTruncated = bNativeTruncated;
+			OutDetailText = ParseError;
+			return false;
+		}
 
-			const TArray<TSharedPtr<FJsonValue>>* NativeReasonValueArray = nullptr;
-			if (!PayloadObject->TryGetArrayField(TEXT("truncation_reasons"), NativeReasonValueArray) || !NativeReasonValueArray)
-			{
-				return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency payload is missing truncation_reasons."));
-			}
-			for (const TSharedPtr<FJsonValue>& ReasonValue : *NativeReasonValueArray)
-			{
-				FString ReasonText;
-				if (!ReasonValue.IsValid() || !ReasonValue->TryGetString(ReasonText)
-					|| (ReasonText != TEXT("max_nodes") && ReasonText != TEXT("max_edges"))
-					|| SourceTruncationReasonArray.Contains(ReasonText))
-				{
-					return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency source truncation reasons are invalid."));
-				}
-				SourceTruncationReasonArray.Add(ReasonText);
-			}
-			TArray<FString> CanonicalSourceReasonArray;
-			if (SourceTruncationReasonArray.Contains(TEXT("max_nodes"))) CanonicalSourceReasonArray.Add(TEXT("max_nodes"));
-			if (SourceTruncationReasonArray.Contains(TEXT("max_edges"))) CanonicalSourceReasonArray.Add(TEXT("max_edges"));
-			if (SourceTruncationReasonArray != CanonicalSourceReasonArray
-				|| bSourceTruncated != (SourceTruncationReasonArray.Num() > 0))
-			{
-				return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency source truncation flag/reason ordering is invalid."));
-			}
+		// EffectiveSelection은 명시 Sections 우선순위가 적용된 최종 선택값이다.
+		FADumpSectionSelection EffectiveSelection;
 
-			CandidateItemArray.Reserve(NodeValueArray->Num() + EdgeValueArray->Num());
-			for (int32 NodeIndex = 0; NodeIndex < NodeValueArray->Num(); ++NodeIndex)
-			{
-				const TSharedPtr<FJsonValue>& NodeValue = (*NodeValueArray)[NodeIndex];
-				if (!NodeValue.IsValid() || NodeValue->Type != EJson::Object)
-				{
-					return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency payload contains a non-object node."));
-				}
+		// SectionSource는 우선순위가 적용된 최종 선택값의 출처다.
+		FString SectionSource;
+		ResolveEffectiveSelection(ExplicitSelection, IntentName, IntentSelection, ProfileName, ProfileSelection, EffectiveSelection, SectionSource);
 
-				const TSharedPtr<FJsonObject> NodeObject = NodeValue->AsObject();
-				FString NodeIdText;
-				FString NodeObjectPath;
-				FString AssetIdText;
-				FString AssetKeyText;
-				FString AssetClassText;
-				FString AssetFamilyText;
-				bool bIndexed = false;
-				double MinDepth = -1.0;
-				const TArray<TSharedPtr<FJsonValue>>* RoleValueArray = nullptr;
-				if (!NodeObject.IsValid()
-					|| !NodeObject->TryGetStringField(TEXT("node_id"), NodeIdText)
-					|| !NodeObject->TryGetStringField(TEXT("object_path"), NodeObjectPath)
-					|| !NodeObject->TryGetStringField(TEXT("asset_id"), AssetIdText)
-					|| !NodeObject->TryGetStringField(TEXT("asset_key"), AssetKeyText)
-					|| !NodeObject->TryGetStringField(TEXT("asset_class"), AssetClassText)
-					|| !NodeObject->TryGetStringField(TEXT("asset_family"), AssetFamilyText)
-					|| !NodeObject->TryGetBoolField(TEXT("indexed"), bIndexed)
-					|| !NodeObject->TryGetNumberField(TEXT("min_depth"), MinDepth)
-					|| !NodeObject->TryGetArrayField(TEXT("roles"), RoleValueArray)
-					|| !RoleValueArray
-					|| NodeIdText.IsEmpty()
-					|| NodeObjectPath.IsEmpty()
-					|| !NodeObjectPath.StartsWith(TEXT("/"))
-					|| MinDepth < 0.0)
-				{
-					return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency node contract is invalid."));
-				}
+		// RunOpts는 선택값이 실제 builder 계획으로 연결되는지 검증할 실행 옵션이다.
+		FADumpRunOpts RunOpts;
+		RunOpts.AssetObjectPath = TEXT("/Game/AssetDumpValidation/BP_ADumpFixture.BP_ADumpFixture");
+		RunOpts.SectionSelection = EffectiveSelection;
+		RunOpts.Intent = IntentName;
+		RunOpts.Profile = ProfileName;
+		RunOpts.SectionSource = SectionSource;
 
-				for (const TSharedPtr<FJsonValue>& RoleValue : *RoleValueArray)
-				{
-					FString RoleText;
-					if (!RoleValue.IsValid() || !RoleValue->TryGetString(RoleText)
-						|| (RoleText != TEXT("root") && RoleText != TEXT("dependency") && RoleText != TEXT("referencer")))
-					{
-						return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency node roles contract is invalid."));
-					}
-				}
+		// RequestInfo는 JSON 및 fingerprint가 사용할 최종 요청 스냅샷이다.
+		const FADumpRequestInfo RequestInfo = RunOpts.BuildRequestInfo();
 
-				const int32 CandidateIndex = CandidateItemArray.Num();
-				TSharedRef<FJsonObject> ItemObject = MakeShared<FJsonObject>();
-				ItemObject->SetStringField(TEXT("item_id"), FString::Printf(TEXT("item_%04d"), CandidateIndex));
-				ItemObject->SetStringField(TEXT("item_kind"), TEXT("asset"));
-				ItemObject->SetNumberField(TEXT("source_index"), CandidateIndex);
-				for (const TCHAR* FieldName : { TEXT("node_id"), TEXT("object_path"), TEXT("asset_id"), TEXT("asset_key"), TEXT("asset_class"), TEXT("asset_family"), TEXT("indexed"), TEXT("min_depth"), TEXT("roles") })
-				{
-					if (!CopyCommandletJsonField(NodeObject, FieldName, ItemObject))
-					{
-						return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency node field copy failed."));
-					}
-				}
-				CandidateItemArray.Add(MakeShared<FJsonValueObject>(ItemObject));
-			}
+		// ActualSectionsText는 레지스트리 순서로 연결한 실제 출력 섹션 목록이다.
+		const FString ActualSectionsText = FString::Join(RequestInfo.SectionSelection.GetEnabledNames(), TEXT(","));
 
-			for (int32 EdgeIndex = 0; EdgeIndex < EdgeValueArray->Num(); ++EdgeIndex)
-			{
-				const TSharedPtr<FJsonValue>& EdgeValue = (*EdgeValueArray)[EdgeIndex];
-				if (!EdgeValue.IsValid() || EdgeValue->Type != EJson::Object)
-				{
-					return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency payload contains a non-object edge."));
-				}
+		// ActualBuilderSectionsText는 실제 실행 예정 builder 목록이다.
+		const FString ActualBuilderSectionsText = FString::Join(RequestInfo.BuilderSections, TEXT(","));
 
-				const TSharedPtr<FJsonObject> EdgeObject = EdgeValue->AsObject();
-				FString EdgeIdText;
-				FString TraversalDirectionText;
-				FString TraversalFromText;
-				FString TraversalToText;
-				FString RelationFromText;
-				FString RelationToText;
-				FString StrengthText;
-				FString ReasonText;
-				FString SourceKindText;
-				FString SourcePathText;
-				double Depth = -1.0;
-				bool bClosesCycle = false;
-				if (!EdgeObject.IsValid()
-					|| !EdgeObject->TryGetStringField(TEXT("edge_id"), EdgeIdText)
-					|| !EdgeObject->TryGetStringField(TEXT("traversal_direction"), TraversalDirectionText)
-					|| !EdgeObject->TryGetStringField(TEXT("traversal_from"), TraversalFromText)
-					|| !EdgeObject->TryGetStringField(TEXT("traversal_to"), TraversalToText)
-					|| !EdgeObject->TryGetStringField(TEXT("relation_from"), RelationFromText)
-					|| !EdgeObject->TryGetStringField(TEXT("relation_to"), RelationToText)
-					|| !EdgeObject->TryGetStringField(TEXT("strength"), StrengthText)
-					|| !EdgeObject->TryGetStringField(TEXT("reason"), ReasonText)
-					|| !EdgeObject->TryGetStringField(TEXT("source_kind"), SourceKindText)
-					|| !EdgeObject->TryGetStringField(TEXT("source_path"), SourcePathText)
-					|| !EdgeObject->TryGetNumberField(TEXT("depth"), Depth)
-					|| !EdgeObject->TryGetBoolField(TEXT("closes_cycle"), bClosesCycle)
-					|| EdgeIdText.IsEmpty()
-					|| TraversalFromText.IsEmpty()
-					|| TraversalToText.IsEmpty()
-					|| RelationFromText.IsEmpty()
-					|| RelationToText.IsEmpty()
-					|| Depth < 0.0)
-				{
-					return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency edge contract is invalid."));
-				}
+		// bPassed는 Intent, 출처, 출력 섹션, builder 계획이 모두 기대값과 같은지 나타낸다.
+		const bool bPassed = RequestInfo.Intent == InExpectedIntentName
+			&& RequestInfo.Profile == InExpectedProfileName
+			&& RequestInfo.SectionSource == InExpectedSectionSource
+			&& ActualSectionsText == InExpectedSectionsText
+			&& ActualBuilderSectionsText == InExpectedBuilderSectionsText;
+		OutDetailText = FString::Printf(
+			TEXT("intent=%s profile=%s source=%s sections=%s builder_sections=%s"),
+			*RequestInfo.Intent,
+			*RequestInfo.Profile,
+			*RequestInfo.SectionSource,
+			*ActualSectionsText,
+			*ActualBuilderSectionsText);
+		return bPassed;
+	}
 
-				const int32 CandidateIndex = CandidateItemArray.Num();
-				TSharedRef<FJsonObject> ItemObject = MakeShared<FJsonObject>();
-				ItemObject->SetStringField(TEXT("item_id"), FString::Printf(TEXT("item_%04d"), CandidateIndex));
-				ItemObject->SetStringField(TEXT("item_kind"), TEXT("relation"));
-				ItemObject->SetNumberField(TEXT("source_index"), CandidateIndex);
-				for (const TCHAR* FieldName : { TEXT("edge_id"), TEXT("depth"), TEXT("traversal_direction"), TEXT("traversal_from"), TEXT("traversal_to"), TEXT("relation_from"), TEXT("relation_to"), TEXT("strength"), TEXT("reason"), TEXT("source_kind"), TEXT("source_path"), TEXT("closes_cycle") })
-				{
-					if (!CopyCommandletJsonField(EdgeObject, FieldName, ItemObject))
-					{
-						return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency edge field copy failed."));
-					}
-				}
-				CandidateItemArray.Add(MakeShared<FJsonValueObject>(ItemObject));
-			}
-		}
-
-		const bool bMaxItemsTruncated = CandidateItemArray.Num() > InMaxItems;
-		TArray<TSharedPtr<FJsonValue>> IncludedItemArray;
-		const int32 InitialIncludedCount = FMath::Min(CandidateItemArray.Num(), InMaxItems);
-		IncludedItemArray.Reserve(InitialIncludedCount);
-		for (int32 ItemIndex = 0; ItemIndex < InitialIncludedCount; ++ItemIndex)
-		{
-			IncludedItemArray.Add(CandidateItemArray[ItemIndex]);
-		}
-
-		bool bMaxBytesTruncated = false;
-		auto BuildBundleRootObject = [&]()
-		{
-			TSharedRef<FJsonObject> SourceObject = MakeShared<FJsonObject>();
-			SourceObject->SetStringField(TEXT("query_result_schema_version"), TEXT("query_result_v1"));
-			SourceObject->SetStringField(TEXT("query_kind"), QueryKindText);
-			SourceObject->SetStringField(TEXT("selector_kind"), SelectorKindText);
-			SourceObject->SetStringField(TEXT("root_object_path"), RootObjectPath);
-			SourceObject->SetStringField(TEXT("native_schema_version"), NativeSchemaText);
-			SourceObject->SetStringField(TEXT("native_source_contract"), NativeSourceContractText);
-			SourceObject->SetBoolField(TEXT("source_truncated"), bSourceTruncated);
-			AddCommandletStringArrayField(SourceObject, TEXT("source_truncation_reasons"), SourceTruncationReasonArray);
-
-			TSharedRef<FJsonObject> LimitsObject = MakeShared<FJsonObject>();
-			LimitsObject->SetNumberField(TEXT("max_items"), InMaxItems);
-			LimitsObject->SetNumberField(TEXT("max_bytes"), InMaxBytes);
-
-			TSharedRef<FJsonObject> CountsObject = MakeShared<FJsonObject>();
-			CountsObject->SetNumberField(TEXT("available_item_count"), CandidateItemArray.Num());
-			CountsObject->SetNumberField(TEXT("included_item_count"), IncludedItemArray.Num());
-			CountsObject->SetNumberField(TEXT("omitted_item_count"), CandidateItemArray.Num() - IncludedItemArray.Num());
-
-			TArray<FString> BundleTruncationReasonArray;
-			if (bSourceTruncated) BundleTruncationReasonArray.Add(TEXT("source_truncated"));
-			if (bMaxItemsTruncated) BundleTruncationReasonArray.Add(TEXT("max_items"));
-			if (bMaxBytesTruncated) BundleTruncationReasonArray.Add(TEXT("max_bytes"));
-
-			TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
-			RootObject->SetStringField(TEXT("schema_version"), TEXT("ai_context_bundle_v1"));
-			RootObject->SetStringField(TEXT("generated_time"), GeneratedTimeText);
-			RootObject->SetStringField(TEXT("status"), TEXT("succeeded"));
-			RootObject->SetObjectField(TEXT("source"), SourceObject);
-			RootObject->SetObjectField(TEXT("limits"), LimitsObject);
-			RootObject->SetObjectField(TEXT("counts"), CountsObject);
-			RootObject->SetBoolField(TEXT("truncated"), BundleTruncationReasonArray.Num() > 0);
-			AddCommandletStringArrayField(RootObject, TEXT("truncation_reasons"), BundleTruncationReasonArray);
-			RootObject->SetArrayField(TEXT("items"), IncludedItemArray);
-			RootObject->SetBoolField(TEXT("all_resolved"), true);
-			return RootObject;
-		};
+	// TryParseSectionSelection은 -Sections= 목록을 검증하고 선택 구조로 변환한다.
+	bool TryParseSectionSelection(
+		const FString& InCommandLine,
+		FADumpSectionSelection& OutSectionSelection,
+		FString& OutErrorMessage)
+	{
+		OutSectionSelection.ResetToFullMode();
+		OutErrorMessage.Reset();
 
-		while (true)
+		// SectionListText는 -Sections=에서 읽은 쉼표 구분 원문이다.
+		FString SectionListText;
+		if (!TryGetSectionListText(InCommandLine, SectionListText))
 		{
-			const TSharedRef<FJsonObject> BundleRootObject = BuildBundleRootObject();
-			FString CandidateJsonText;
-			if (!SerializeJsonObjectText(BundleRootObject, CandidateJsonText))
-			{
-				return Fail(TEXT("ADUMP_CONTEXT_BUNDLE_BUILD_FAILED"), TEXT("Failed to serialize ai_context_bundle_v1."));
-			}
+			return true;
+		}
+
+		OutSectionSelection.ResetToExplicitMode();
 
-			if (GetCommandletUtf8ByteLength(CandidateJsonText) <= InMaxBytes)
+		// SectionNameArray는 사용자가 전달한 섹션 이름 토큰 목록이다.
+		TArray<FString> SectionNameArray;
+		SectionListText.ParseIntoArray(SectionNameArray, TEXT(","), false);
+		// SectionName은 공백 제거와 소문자 정규화를 적용할 현재 입력 토큰이다.
+		for (FString& SectionName : SectionNameArray)
+		{
+			SectionName.TrimStartAndEndInline();
+			SectionName.ToLowerInline();
+			if (SectionName.IsEmpty())
 			{
-				OutJsonText = MoveTemp(CandidateJsonText);
-				return true;
+				OutErrorMessage = FString::Printf(
+					TEXT("Invalid empty section name in -Sections=. Valid sections: %s"),
+					*GetValidSectionNamesText());
+				return false;
 			}
 
-			bMaxBytesTruncated = true;
-			if (IncludedItemArray.Num() == 0)
+			// ResolvedSection은 현재 이름에 대응하는 정식 주요 JSON 섹션이다.
+			EADumpSection ResolvedSection = EADumpSection::Summary;
+			if (!TryResolveDumpSection(SectionName, ResolvedSection))
 			{
-				return Fail(TEXT("ADUMP_CONTEXT_BUNDLE_LIMIT_TOO_SMALL"), TEXT("MaxBytes cannot fit the zero-item ai_context_bundle_v1 envelope."));
+				OutErrorMessage = FString::Printf(
+					TEXT("Unknown section '%s' in -Sections=. Valid sections: %s"),
+					*SectionName,
+					*GetValidSectionNamesText());
+				return false;
 			}
-			IncludedItemArray.RemoveAt(IncludedItemArray.Num() - 1, 1, EAllowShrinking::No);
+			OutSectionSelection.Enable(ResolvedSection);
 		}
-	}
 
-	// ResolveCommandletReferenceSourceKindText는 references source를 dependency_index source_kind로 정규화한다.
-	FString ResolveCommandletReferenceSourceKindText(const FString& InSourceText)
-	{
-		if (InSourceText == TEXT("property_ref") || InSourceText == TEXT("component_ref"))
+		if (OutSectionSelection.EnabledSections.IsEmpty())
 		{
-			return TEXT("details");
+			OutErrorMessage = FString::Printf(
+				TEXT("-Sections= requires at least one section. Valid sections: %s"),
+				*GetValidSectionNamesText());
+			return false;
 		}
-
-		return TEXT("graph");
-	}
-
-	// GetValidSectionNamesText는 -Sections=에서 허용하는 정식 섹션 이름 목록을 반환한다.
-	FString GetValidSectionNamesText()
-	{
-		return TEXT("summary,digest,details,data_asset_values,data_asset_diff,input_summary,component_tree,bp_search_index,graphs,references,widget_designer,entity_evidence");
+		return true;
 	}
 
-	// GetValidIntentNamesText는 -Intent=에서 허용하는 정식 분석 목적 이름 목록을 반환한다.
-	FString GetValidIntentNamesText()
+	// ConfigureDumpRunOptsFromCommandLine는 commandlet 공통 인자와 섹션 선택을 FADumpRunOpts로 채운다.
+	void ConfigureDumpRunOptsFromCommandLine(
+		const FString& InCommandLine,
+		const FString& InAssetPath,
+		const FString& InOutputPath,
+		const FADumpSectionSelection& InSectionSelection,
+		const FString& InIntentName,
+		const FString& InProfileName,
+		const FString& InSectionSource,
+		FADumpRunOpts& OutDumpRunOpts)
 	{
-		return TEXT("quick_overview,widget_layout,blueprint_logic,dependency_trace");
-	}
+		OutDumpRunOpts.AssetObjectPath = InAssetPath;
+		OutDumpRunOpts.SourceKind = EADumpSourceKind::Commandlet;
+		OutDumpRunOpts.OutputFilePath = InOutputPath;
+		OutDumpRunOpts.SectionSelection = InSectionSelection;
+		OutDumpRunOpts.Intent = InIntentName;
+		OutDumpRunOpts.Profile = InProfileName;
+		OutDumpRunOpts.SectionSource = InSectionSource;
+		OutDumpRunOpts.bIncludeSummary = true;
+		OutDumpRunOpts.bIncludeDetails = false;
+		OutDumpRunOpts.bIncludeGraphs = false;
+		OutDumpRunOpts.bIncludeReferences = false;
 
-	// GetValidProfileNamesText는 -Profile=에서 허용하는 정식 출력 프리셋 이름 목록을 반환한다.
-		FString GetValidProfileNamesText()
-	{
-				return TEXT("full,summary_only,digest_only,ai_context,niagara_deep_evidence,niagara_material_evidence");
-	}
+		FParse::Bool(*InCommandLine, TEXT("IncludeSummary="), OutDumpRunOpts.bIncludeSummary);
+		FParse::Bool(*InCommandLine, TEXT("IncludeDetails="), OutDumpRunOpts.bIncludeDetails);
+		FParse::Bool(*InCommandLine, TEXT("IncludeGraphs="), OutDumpRunOpts.bIncludeGraphs);
+		FParse::Bool(*InCommandLine, TEXT("IncludeReferences="), OutDumpRunOpts.bIncludeReferences);
+		FParse::Bool(*InCommandLine, TEXT("CompileBeforeDump="), OutDumpRunOpts.bCompileBeforeDump);
+		FParse::Bool(*InCommandLine, TEXT("SkipIfUpToDate="), OutDumpRunOpts.bSkipIfUpToDate);
+		FParse::Bool(*InCommandLine, TEXT("LinksOnly="), OutDumpRunOpts.bLinksOnly);
+		FParse::Value(*InCommandLine, TEXT("GraphName="), OutDumpRunOpts.GraphNameFilter);
+		FParse::Value(*InCommandLine, TEXT("DataAssetDiffBase="), OutDumpRunOpts.DataAssetDiffBasePath);
 
-	// TryResolveDumpSection은 정규화한 이름을 주요 JSON 섹션 값으로 변환한다.
-	bool TryResolveDumpSection(const FString& InSectionName, EADumpSection& OutSection)
-	{
-		if (InSectionName == TEXT("summary"))
+		// LinkKindText는 링크 필터 문자열 입력값이다.
+		FString LinkKindText;
+		FParse::Value(*InCommandLine, TEXT("LinkKind="), LinkKindText);
+		if (LinkKindText.Equals(TEXT("exec"), ESearchCase::IgnoreCase))
 		{
-			OutSection = EADumpSection::Summary;
-			return true;
+			OutDumpRunOpts.LinkKind = EADumpLinkKind::Exec;
 		}
-		if (InSectionName == TEXT("digest"))
+		else if (LinkKindText.Equals(TEXT("data"), ESearchCase::IgnoreCase))
 		{
-			OutSection = EADumpSection::Digest;
-			return true;
+			OutDumpRunOpts.LinkKind = EADumpLinkKind::Data;
 		}
-		if (InSectionName == TEXT("details"))
+		else
 		{
-			OutSection = EADumpSection::Details;
-			return true;
+			OutDumpRunOpts.LinkKind = EADumpLinkKind::All;
 		}
-		if (InSectionName == TEXT("data_asset_values"))
+
+		// LinksMetaText는 links_only 메타 수준 문자열 입력값이다.
+		FString LinksMetaText;
+		FParse::Value(*InCommandLine, TEXT("LinksMeta="), LinksMetaText);
+		if (LinksMetaText.Equals(TEXT("min"), ESearchCase::IgnoreCase))
 		{
-			OutSection = EADumpSection::DataAssetValues;
-			return true;
+			OutDumpRunOpts.LinksMeta = EADumpLinksMeta::Min;
 		}
-		if (InSectionName == TEXT("data_asset_diff"))
+		else
 		{
-			OutSection = EADumpSection::DataAssetDiff;
-			return true;
+			OutDumpRunOpts.LinksMeta = EADumpLinksMeta::None;
 		}
-		if (InSectionName == TEXT("input_summary"))
-		{
-			OutSection = EADumpSection::InputSummary;
-			return true;
-		}
-		if (InSectionName == TEXT("component_tree"))
-		{
-			OutSection = EADumpSection::ComponentTree;
-			return true;
-		}
-		if (InSectionName == TEXT("bp_search_index"))
-	{
-		OutSection = EADumpSection::BPSearchIndex;
-		return true;
-	}
-	if (InSectionName == TEXT("graphs"))
+
+		// OutputCompressionText는 dump.json/sidecar 저장 codec 문자열 입력값이다.
+		FString OutputCompressionText;
+		FParse::Value(*InCommandLine, TEXT("OutputCompression="), OutputCompressionText);
+		OutDumpRunOpts.OutputEncoding.Compression = OutputCompressionText.Equals(TEXT("gzip"), ESearchCase::IgnoreCase)
+			? EADumpOutputCompression::Gzip
+			: EADumpOutputCompression::None;
+
+		// CompressionLevelText는 codec 압축 강도 문자열 입력값이다.
+		FString CompressionLevelText;
+		FParse::Value(*InCommandLine, TEXT("CompressionLevel="), CompressionLevelText);
+		if (CompressionLevelText.Equals(TEXT("fast"), ESearchCase::IgnoreCase))
 		{
-			OutSection = EADumpSection::Graphs;
-			return true;
+			OutDumpRunOpts.OutputEncoding.CompressionLevel = EADumpOutputCompressionLevel::Fast;
 		}
-		if (InSectionName == TEXT("references"))
+		else if (CompressionLevelText.Equals(TEXT("max"), ESearchCase::IgnoreCase))
 		{
-			OutSection = EADumpSection::References;
-			return true;
+			OutDumpRunOpts.OutputEncoding.CompressionLevel = EADumpOutputCompressionLevel::Max;
 		}
-				if (InSectionName == TEXT("widget_designer"))
+		else
 		{
-			OutSection = EADumpSection::WidgetDesigner;
-			return true;
+			OutDumpRunOpts.OutputEncoding.CompressionLevel = EADumpOutputCompressionLevel::Default;
 		}
-		if (InSectionName == TEXT("entity_evidence"))
+		FParse::Bool(*InCommandLine, TEXT("CompactJson="), OutDumpRunOpts.OutputEncoding.bCompactJson);
+
+		if (!FParse::Param(*InCommandLine, TEXT("UseDefaults")))
 		{
-			OutSection = EADumpSection::EntityEvidence;
-			return true;
+			OutDumpRunOpts.bIncludeSummary = true;
 		}
-		return false;
 	}
 
-	// TryGetSectionListText는 쉼표를 보존한 채 -Sections= 옵션 토큰 전체를 읽는다.
-	bool TryGetSectionListText(const FString& InCommandLine, FString& OutSectionListText)
+	// BuildBatchResultEntryObject는 배치 실행 결과 한 건을 report용 JSON object로 변환한다.
+	TSharedRef<FJsonObject> BuildBatchResultEntryObject(
+		const FAssetData& InAssetData,
+		const FString& InResultStatus,
+		const FString& InOutputFilePath,
+		const FADumpResult& InDumpResult,
+		const FString& InFailureMessage)
 	{
-		OutSectionListText.Reset();
-
-		// CommandLineCursor는 FParse::Token으로 순회할 현재 commandlet 문자열 위치다.
-		const TCHAR* CommandLineCursor = *InCommandLine;
-
-		// CommandToken은 현재 순회에서 읽은 공백 구분 commandlet 토큰이다.
-		FString CommandToken;
-		while (FParse::Token(CommandLineCursor, CommandToken, true))
+		// CountIssuesBySeverity는 배치 report에서 severity별 issue 개수를 센다.
+		auto CountIssuesBySeverity = [](const TArray<FADumpIssue>& InIssues, EADumpIssueSeverity InSeverity)
 		{
-			// NormalizedToken은 선택적인 선행 하이픈을 제거한 옵션 토큰이다.
-			FString NormalizedToken = CommandToken;
-			NormalizedToken.RemoveFromStart(TEXT("-"));
-			if (NormalizedToken.StartsWith(TEXT("Sections="), ESearchCase::IgnoreCase))
+			// IssueCount는 지정 severity와 일치한 issue 개수 누적값이다.
+			int32 IssueCount = 0;
+			for (const FADumpIssue& IssueItem : InIssues)
 			{
-				OutSectionListText = NormalizedToken.Mid(9);
-				return true;
+				if (IssueItem.Severity == InSeverity)
+				{
+					++IssueCount;
+				}
 			}
-		}
-		return false;
+
+			return IssueCount;
+		};
+
+		// ResultEntryObject는 run_report results 배열에 추가할 결과 object다.
+		TSharedRef<FJsonObject> ResultEntryObject = MakeShared<FJsonObject>();
+		ResultEntryObject->SetStringField(TEXT("object_path"), InAssetData.GetObjectPathString());
+		ResultEntryObject->SetStringField(TEXT("asset_name"), InAssetData.AssetName.ToString());
+		ResultEntryObject->SetStringField(TEXT("asset_class"), InAssetData.AssetClassPath.GetAssetName().ToString());
+		ResultEntryObject->SetStringField(TEXT("result_status"), InResultStatus);
+		ResultEntryObject->SetStringField(TEXT("dump_status"), ToString(InDumpResult.DumpStatus));
+		ResultEntryObject->SetStringField(TEXT("asset_family"), InDumpResult.Asset.AssetFamily);
+		ResultEntryObject->SetStringField(TEXT("output_file_path"), InOutputFilePath);
+		ResultEntryObject->SetNumberField(TEXT("warning_count"), CountIssuesBySeverity(InDumpResult.Issues, EADumpIssueSeverity::Warning));
+		ResultEntryObject->SetNumberField(TEXT("error_count"), CountIssuesBySeverity(InDumpResult.Issues, EADumpIssueSeverity::Error));
+		ResultEntryObject->SetStringField(TEXT("failure_message"), InFailureMessage);
+		return ResultEntryObject;
 	}
 
-	// TryParseSectionSelection은 Intent 검증 helper가 재사용할 -Sections= 파서 선언이다.
-	bool TryParseSectionSelection(
-		const FString& InCommandLine,
-		FADumpSectionSelection& OutSectionSelection,
-		FString& OutErrorMessage);
+	// BuildBatchAssetOutputDirectoryPath는 배치 덤프용 자산별 출력 폴더 경로를 만든다.
+	FString BuildBatchAssetOutputDirectoryPath(const FString& InDumpRootPath, const FString& InAssetObjectPath)
+	{
+		// SanitizedAssetKeyText는 폴더명 충돌을 줄이기 위한 자산 경로 기반 안전 키다.
+		FString SanitizedAssetKeyText = InAssetObjectPath;
+		SanitizedAssetKeyText.ReplaceInline(TEXT("."), TEXT("_"));
+		SanitizedAssetKeyText.ReplaceInline(TEXT("/"), TEXT("_"));
+		SanitizedAssetKeyText.ReplaceInline(TEXT("\\"), TEXT("_"));
+		return FPaths::Combine(InDumpRootPath, SanitizedAssetKeyText);
+	}
 
-	// TryResolveIntentSelection은 정규화한 Intent 이름을 정식 섹션 선택으로 변환한다.
-	bool TryResolveIntentSelection(const FString& InIntentName, FADumpSectionSelection& OutSectionSelection)
+	// ParseCommandletListValue는 쉼표/세미콜론 구분 문자열을 공백 제거 배열로 정리한다.
+	TArray<FString> ParseCommandletListValue(const FString& InValueText)
 	{
-		OutSectionSelection.ResetToExplicitMode();
-		if (InIntentName == TEXT("quick_overview"))
-		{
-			OutSectionSelection.Enable(EADumpSection::Summary);
-			OutSectionSelection.Enable(EADumpSection::Digest);
-			return true;
-		}
-		if (InIntentName == TEXT("widget_layout"))
-		{
-			OutSectionSelection.Enable(EADumpSection::Summary);
-			OutSectionSelection.Enable(EADumpSection::Digest);
-			OutSectionSelection.Enable(EADumpSection::WidgetDesigner);
-			return true;
-		}
-		if (InIntentName == TEXT("blueprint_logic"))
+		// NormalizedValueText는 구분자를 통일한 원본 문자열이다.
+		FString NormalizedValueText = InValueText;
+		NormalizedValueText.ReplaceInline(TEXT(";"), TEXT(","));
+
+		// ParsedValueArray는 빈 항목 제거와 trim이 끝난 결과 배열이다.
+		TArray<FString> ParsedValueArray;
+		NormalizedValueText.ParseIntoArray(ParsedValueArray, TEXT(","), true);
+		for (FString& ParsedValueItem : ParsedValueArray)
 		{
-			OutSectionSelection.Enable(EADumpSection::Summary);
-			OutSectionSelection.Enable(EADumpSection::Digest);
-			OutSectionSelection.Enable(EADumpSection::Graphs);
-			OutSectionSelection.Enable(EADumpSection::References);
-			return true;
+			ParsedValueItem.TrimStartAndEndInline();
 		}
-		if (InIntentName == TEXT("dependency_trace"))
+
+		ParsedValueArray.RemoveAll([](const FString& ParsedValueItem)
 		{
-			OutSectionSelection.Enable(EADumpSection::Summary);
-			OutSectionSelection.Enable(EADumpSection::Digest);
-			OutSectionSelection.Enable(EADumpSection::References);
-			return true;
-		}
-		OutSectionSelection.ResetToFullMode();
-		return false;
+			return ParsedValueItem.IsEmpty();
+		});
+		return ParsedValueArray;
 	}
 
-	// TryResolveProfileSelection은 정규화한 Profile 이름을 전체 모드 또는 정식 섹션 선택으로 변환한다.
-	bool TryResolveProfileSelection(const FString& InProfileName, FADumpSectionSelection& OutSectionSelection)
+	// DoesAssetMatchClassFilter는 AssetRegistry 자산이 batch ClassFilter 목록과 맞는지 검사한다.
+	bool DoesAssetMatchClassFilter(const FAssetData& InAssetData, const TArray<FString>& InClassFilterArray)
 	{
-		if (InProfileName == TEXT("full"))
+		if (InClassFilterArray.Num() == 0)
 		{
-			OutSectionSelection.ResetToFullMode();
 			return true;
 		}
 
-		OutSectionSelection.ResetToExplicitMode();
-		if (InProfileName == TEXT("summary_only"))
-		{
-			OutSectionSelection.Enable(EADumpSection::Summary);
-			return true;
-		}
-				if (InProfileName == TEXT("digest_only") || InProfileName == TEXT("ai_context"))
-		{
-			OutSectionSelection.Enable(EADumpSection::Summary);
-			OutSectionSelection.Enable(EADumpSection::Digest);
-			return true;
-		}
-				if (InProfileName == TEXT("niagara_deep_evidence") || InProfileName == TEXT("niagara_material_evidence"))
+		// AssetClassNameText는 현재 자산의 AssetRegistry 클래스 이름이다.
+		const FString AssetClassNameText = InAssetData.AssetClassPath.GetAssetName().ToString();
+		for (const FString& ClassFilterItem : InClassFilterArray)
 		{
-			OutSectionSelection.Enable(EADumpSection::EntityEvidence);
-			return true;
+			if (AssetClassNameText.Equals(ClassFilterItem, ESearchCase::IgnoreCase))
+			{
+				return true;
+			}
 		}
 
-		OutSectionSelection.ResetToFullMode();
 		return false;
 	}
 
-	// TryParseIntentSelection은 단일 -Intent= 값을 검증하고 정식 섹션 선택으로 변환한다.
-	bool TryParseIntentSelection(
-		const FString& InCommandLine,
-		FString& OutIntentName,
-		FADumpSectionSelection& OutSectionSelection,
-		FString& OutErrorMessage)
+	// AppendBatchDependencyAssets는 현재 배치 자산들의 package dependency를 추가 자산 목록에 합친다.
+	void AppendBatchDependencyAssets(
+		FAssetRegistryModule& InAssetRegistryModule,
+		const TArray<FAssetData>& InSeedAssetArray,
+		const TArray<FString>& InClassFilterArray,
+		TArray<FAssetData>& InOutAssetArray)
 	{
-		OutIntentName.Reset();
-		OutSectionSelection.ResetToFullMode();
-		OutErrorMessage.Reset();
-
-		// CommandLineCursor는 FParse::Token으로 순회할 현재 commandlet 문자열 위치다.
-		const TCHAR* CommandLineCursor = *InCommandLine;
+		// AddedObjectPathSet는 중복 자산 추가를 방지하는 object path 집합이다.
+		TSet<FString> AddedObjectPathSet;
+		for (const FAssetData& ExistingAssetData : InOutAssetArray)
+		{
+			AddedObjectPathSet.Add(ExistingAssetData.GetObjectPathString());
+		}
 
-		// CommandToken은 현재 순회에서 읽은 공백 구분 commandlet 토큰이다.
-		FString CommandToken;
-		while (FParse::Token(CommandLineCursor, CommandToken, true))
+		// PendingAssetArray는 아직 dependency 확장을 처리하지 않은 자산 큐다.
+		TArray<FAssetData> PendingAssetArray = InSeedAssetArray;
+		for (int32 PendingIndex = 0; PendingIndex < PendingAssetArray.Num(); ++PendingIndex)
 		{
-			// NormalizedToken은 선택적인 선행 하이픈을 제거한 옵션 토큰이다.
-			FString NormalizedToken = CommandToken;
-			NormalizedToken.RemoveFromStart(TEXT("-"));
-			if (!NormalizedToken.StartsWith(TEXT("Intent="), ESearchCase::IgnoreCase))
+			// PendingAssetData는 현재 dependency를 조회할 기준 자산이다.
+			const FAssetData& PendingAssetData = PendingAssetArray[PendingIndex];
+
+			// PendingPackageNameText는 현재 자산의 long package name이다.
+			const FString PendingPackageNameText = FPackageName::ObjectPathToPackageName(PendingAssetData.GetObjectPathString());
+			if (PendingPackageNameText.IsEmpty())
 			{
 				continue;
 			}
-			if (!OutIntentName.IsEmpty())
-			{
-				OutErrorMessage = FString::Printf(TEXT("-Intent= accepts exactly one value. Valid intents: %s"), *GetValidIntentNamesText());
-				return false;
-			}
-			OutIntentName = NormalizedToken.Mid(7);
-			OutIntentName.TrimStartAndEndInline();
-			OutIntentName.ToLowerInline();
-			if (OutIntentName.IsEmpty())
-			{
-				OutErrorMessage = FString::Printf(TEXT("-Intent= requires one value. Valid intents: %s"), *GetValidIntentNamesText());
-				return false;
-			}
-		}
-
-		if (OutIntentName.IsEmpty())
-		{
-			return true;
-		}
-		if (!TryResolveIntentSelection(OutIntentName, OutSectionSelection))
-		{
-			OutErrorMessage = FString::Printf(TEXT("Unknown intent '%s' in -Intent=. Valid intents: %s"), *OutIntentName, *GetValidIntentNamesText());
-			return false;
-		}
-		return true;
-	}
 
-	// TryParseProfileSelection은 단일 -Profile= 값을 검증하고 정식 섹션 선택으로 변환한다.
-	bool TryParseProfileSelection(
-		const FString& InCommandLine,
-		FString& OutProfileName,
-		FADumpSectionSelection& OutSectionSelection,
-		FString& OutErrorMessage)
-	{
-		OutProfileName.Reset();
-		OutSectionSelection.ResetToFullMode();
-		OutErrorMessage.Reset();
+			// DependencyPackageNameArray는 현재 자산이 직접 참조하는 package 목록이다.
+			TArray<FName> DependencyPackageNameArray;
+			InAssetRegistryModule.Get().GetDependencies(FName(*PendingPackageNameText), DependencyPackageNameArray);
 
-		// CommandLineCursor는 FParse::Token으로 순회할 현재 commandlet 문자열 위치다.
-		const TCHAR* CommandLineCursor = *InCommandLine;
-
-		// CommandToken은 현재 순회에서 읽은 공백 구분 commandlet 토큰이다.
-		FString CommandToken;
-		while (FParse::Token(CommandLineCursor, CommandToken, true))
-		{
-			// NormalizedToken은 선택적인 선행 하이픈을 제거한 옵션 토큰이다.
-			FString NormalizedToken = CommandToken;
-			NormalizedToken.RemoveFromStart(TEXT("-"));
-			if (!NormalizedToken.StartsWith(TEXT("Profile="), ESearchCase::IgnoreCase))
-			{
-				continue;
-			}
-			if (!OutProfileName.IsEmpty())
-			{
-				OutErrorMessage = FString::Printf(TEXT("-Profile= accepts exactly one value. Valid profiles: %s"), *GetValidProfileNamesText());
-				return false;
-			}
-			OutProfileName = NormalizedToken.Mid(8);
-			OutProfileName.TrimStartAndEndInline();
-			OutProfileName.ToLowerInline();
-			if (OutProfileName.IsEmpty())
+			for (const FName& DependencyPackageName : DependencyPackageNameArray)
 			{
-				OutErrorMessage = FString::Printf(TEXT("-Profile= requires one value. Valid profiles: %s"), *GetValidProfileNamesText());
-				return false;
+				// DependencyPackageNameText는 dependency package 문자열이다.
+				const FString DependencyPackageNameText = DependencyPackageName.ToString();
+				if (DependencyPackageNameText.IsEmpty() || DependencyPackageNameText.StartsWith(TEXT("/Script/")))
+				{
+					continue;
+				}
+
+				// DependencyObjectPathText는 dependency package에서 대표 자산 object path 추정값이다.
+				const FString DependencyObjectPathText = FString::Printf(
+					TEXT("%s.%s"),
+					*DependencyPackageNameText,
+					*FPackageName::GetShortName(DependencyPackageNameText));
+
+				// DependencyAssetData는 dependency package에서 대표 자산을 찾은 결과다.
+				const FAssetData DependencyAssetData = InAssetRegistryModule.Get().GetAssetByObjectPath(FSoftObjectPath(DependencyObjectPathText));
+				if (!DependencyAssetData.IsValid())
+				{
+					continue;
+				}
+
+				if (!DoesAssetMatchClassFilter(DependencyAssetData, InClassFilterArray))
+				{
+					continue;
+				}
+
+				if (AddedObjectPathSet.Contains(DependencyObjectPathText))
+				{
+					continue;
+				}
+
+				AddedObjectPathSet.Add(DependencyObjectPathText);
+				InOutAssetArray.Add(DependencyAssetData);
+				PendingAssetArray.Add(DependencyAssetData);
 			}
 		}
+	}
 
-		if (OutProfileName.IsEmpty())
-		{
-			return true;
-		}
-		if (!TryResolveProfileSelection(OutProfileName, OutSectionSelection))
+	// IsBatchDumpOutputUpToDate는 batchdump 전용으로 manifest fingerprint를 비교해 skip 가능 여부를 판단한다.
+	bool IsBatchDumpOutputUpToDate(const FADumpRunOpts& InDumpRunOpts, const FString& InOutputFilePath)
+	{
+		if (InOutputFilePath.IsEmpty() || !ADumpJson::DoesJsonFileExist(InOutputFilePath))
 		{
-			OutErrorMessage = FString::Printf(TEXT("Unknown profile '%s' in -Profile=. Valid profiles: %s"), *OutProfileName, *GetValidProfileNamesText());
 			return false;
 		}
-		return true;
-	}
 
-	// ResolveEffectiveSelection은 Sections > Intent > Profile > implicit full 우선순위로 최종 선택값과 출처를 결정한다.
-	void ResolveEffectiveSelection(
-		const FADumpSectionSelection& InExplicitSelection,
-		const FString& InIntentName,
-		const FADumpSectionSelection& InIntentSelection,
-		const FString& InProfileName,
-		const FADumpSectionSelection& InProfileSelection,
-		FADumpSectionSelection& OutSelection,
-		FString& OutSectionSource)
-	{
-		OutSelection.ResetToFullMode();
-		OutSectionSource = TEXT("full");
-		if (!InProfileName.IsEmpty())
+		// ManifestFilePath는 현재 dump.json 옆의 manifest.json 경로다.
+		const FString ManifestFilePath = FPaths::Combine(FPaths::GetPath(InOutputFilePath), TEXT("manifest.json"));
+		if (!ADumpJson::DoesJsonFileExist(ManifestFilePath))
 		{
-			OutSelection = InProfileSelection;
-			OutSectionSource = TEXT("profile");
+			return false;
 		}
-		if (!InIntentName.IsEmpty())
+
+		// ManifestRootObject는 manifest.json 역직렬화 결과다.
+		TSharedPtr<FJsonObject> ManifestRootObject;
+		if (!LoadCommandletJsonObjectFromFile(ManifestFilePath, ManifestRootObject))
 		{
-			OutSelection = InIntentSelection;
-			OutSectionSource = TEXT("intent");
+			return false;
 		}
-		if (InExplicitSelection.bIsExplicit)
+
+		// RunObject는 manifest.run object다.
+		const TSharedPtr<FJsonObject> RunObject = GetCommandletNestedObjectField(ManifestRootObject, TEXT("run"));
+
+		// ExistingFingerprintText는 기존 manifest에 기록된 실행 fingerprint다.
+		const FString ExistingFingerprintText = GetCommandletStringFieldOrEmpty(RunObject, TEXT("fingerprint"));
+		if (ExistingFingerprintText.IsEmpty())
 		{
-			OutSelection = InExplicitSelection;
-			OutSectionSource = TEXT("sections");
+			return false;
 		}
+
+		// CurrentFingerprintText는 현재 실행 조건으로 다시 계산한 fingerprint 값이다.
+		const FString CurrentFingerprintText = ADumpFingerprint::BuildAssetFingerprint(
+			InDumpRunOpts.AssetObjectPath,
+			InDumpRunOpts.BuildRequestInfo(),
+			ADumpSchema::GetVersionText(),
+			ADumpSchema::GetExtractorVersionText());
+		return !CurrentFingerprintText.IsEmpty() && CurrentFingerprintText == ExistingFingerprintText;
 	}
 
-	// VerifyIntentResolution은 Intent 매핑과 -Sections= 우선순위의 request/builder 결과를 검증한다.
-	bool VerifyIntentResolution(
-		const FString& InCommandLine,
-		const FString& InExpectedIntentName,
-		const FString& InExpectedProfileName,
-		const FString& InExpectedSectionSource,
-		const FString& InExpectedSectionsText,
-		const FString& InExpectedBuilderSectionsText,
-		FString& OutDetailText)
+	// FCommandletBatchChangePlan은 batchdump file-state cache와 reverse dependency closure로 계산한 재덤프 계획이다.
+	struct FCommandletBatchChangePlan
 	{
-		// ExplicitSelection은 -Sections=에서 파싱한 명시적 선택값이다.
-		FADumpSectionSelection ExplicitSelection;
+		// bCacheLoaded는 이전 실행 batch_file_state_v1 cache를 읽어 closure 판정을 쓸 수 있는지 여부다.
+		bool bCacheLoaded = false;
 
-		// IntentSelection은 -Intent= 매핑에서 파생한 선택값이다.
-		FADumpSectionSelection IntentSelection;
+		// bDependencyIndexLoaded는 dependency_index.json relation을 graph에 반영했는지 여부다.
+		bool bDependencyIndexLoaded = false;
 
-		// ProfileSelection은 -Profile= 매핑에서 파생된 선택값이다.
-		FADumpSectionSelection ProfileSelection;
+		// CacheFilePath는 현재 batch scope의 file-state cache 경로다.
+		FString CacheFilePath;
 
-		// IntentName은 -Intent=에서 정규화한 이름이다.
-		FString IntentName;
+		// ScopeText는 cache를 분리하는 batch 입력 scope 문자열이다.
+		FString ScopeText;
 
-		// ProfileName은 -Profile=에서 정규화한 이름이다.
-		FString ProfileName;
+		// PackageStateByName은 이번 실행에서 추적한 package별 현재 파일 상태다.
+		TMap<FString, FString> PackageStateByName;
 
-		// ParseError는 섹션 또는 Intent 파싱 실패 이유다.
-		FString ParseError;
-		if (!TryParseSectionSelection(InCommandLine, ExplicitSelection, ParseError)
-			|| !TryParseIntentSelection(InCommandLine, IntentName, IntentSelection, ParseError)
-			|| !TryParseProfileSelection(InCommandLine, ProfileName, ProfileSelection, ParseError))
-		{
-			OutDetailText = ParseError;
-			return false;
-		}
+		// PreviousAssetRecordByPath는 이전 cache의 asset별 (options_key, status) 기록이다.
+		TMap<FString, TPair<FString, FString>> PreviousAssetRecordByPath;
 
-		// EffectiveSelection은 명시 Sections 우선순위가 적용된 최종 선택값이다.
-		FADumpSectionSelection EffectiveSelection;
+		// RedumpReasonByObjectPath는 재덤프 대상 자산별 사유다. 없는 자산은 unchanged다.
+		TMap<FString, FString> RedumpReasonByObjectPath;
 
-		// SectionSource는 우선순위가 적용된 최종 선택값의 출처다.
-		FString SectionSource;
-		ResolveEffectiveSelection(ExplicitSelection, IntentName, IntentSelection, ProfileName, ProfileSelection, EffectiveSelection, SectionSource);
+		// RedumpViaByObjectPath는 dependency_changed 자산이 도달한 변경 package다.
+		TMap<FString, FString> RedumpViaByObjectPath;
 
-		// RunOpts는 선택값이 실제 builder 계획으로 연결되는지 검증할 실행 옵션이다.
-		FADumpRunOpts RunOpts;
-		RunOpts.AssetObjectPath = TEXT("/Game/AssetDumpValidation/BP_ADumpFixture.BP_ADumpFixture");
-		RunOpts.SectionSelection = EffectiveSelection;
-		RunOpts.Intent = IntentName;
-		RunOpts.Profile = ProfileName;
-		RunOpts.SectionSource = SectionSource;
+		// ChangedPackageCount는 이전 cache와 상태가 다른 추적 package 수다.
+		int32 ChangedPackageCount = 0;
 
-		// RequestInfo는 JSON 및 fingerprint가 사용할 최종 요청 스냅샷이다.
-		const FADumpRequestInfo RequestInfo = RunOpts.BuildRequestInfo();
+		// VisitedEdgeCount는 reverse closure 전파 중 확인한 edge 수다.
+		int32 VisitedEdgeCount = 0;
 
-		// ActualSectionsText는 레지스트리 순서로 연결한 실제 출력 섹션 목록이다.
-		const FString ActualSectionsText = FString::Join(RequestInfo.SectionSelection.GetEnabledNames(), TEXT(","));
+		// PlanMilliseconds는 계획 계산 소요 시간이다.
+		double PlanMilliseconds = 0.0;
+	};
 
-		// ActualBuilderSectionsText는 실제 실행 예정 builder 목록이다.
-		const FString ActualBuilderSectionsText = FString::Join(RequestInfo.BuilderSections, TEXT(","));
+	// BuildBatchFileStateScopeText는 같은 batch 입력끼리만 file-state cache를 공유하도록 scope 문자열을 만든다.
+	FString BuildBatchFileStateScopeText(
+		const FString& InFilterPath,
+		const FString& InClassFilterText,
+		bool bInWithDependencies,
+		int32 InMaxAssets)
+	{
+		return FString::Printf(
+			TEXT("root=%s|class_filter=%s|with_dependencies=%s|max_assets=%d"),
+			*InFilterPath,
+			*InClassFilterText,
+			bInWithDependencies ? TEXT("true") : TEXT("false"),
+			InMaxAssets);
+	}
 
-		// bPassed는 Intent, 출처, 출력 섹션, builder 계획이 모두 기대값과 같은지 나타낸다.
-		const bool bPassed = RequestInfo.Intent == InExpectedIntentName
-			&& RequestInfo.Profile == InExpectedProfileName
-			&& RequestInfo.SectionSource == InExpectedSectionSource
-			&& ActualSectionsText == InExpectedSectionsText
-			&& ActualBuilderSectionsText == InExpectedBuilderSectionsText;
-		OutDetailText = FString::Printf(
-			TEXT("intent=%s profile=%s source=%s sections=%s builder_sections=%s"),
-			*RequestInfo.Intent,
-			*RequestInfo.Profile,
-			*RequestInfo.SectionSource,
-			*ActualSectionsText,
-			*ActualBuilderSectionsText);
-		return bPassed;
+	// BuildBatchFileStateCacheFilePath는 scope hash별 batch_file_state cache 파일 경로를 만든다.
+	FString BuildBatchFileStateCacheFilePath(const FString& InDumpRootPath, const FString& InScopeText)
+	{
+		return FPaths::Combine(
+			FPaths::ConvertRelativePathToFull(InDumpRootPath),
+			FString::Printf(TEXT("batch_file_state_%08x.json"), FCrc::StrCrc32(*InScopeText)));
 	}
 
-	// TryParseSectionSelection은 -Sections= 목록을 검증하고 선택 구조로 변환한다.
-	bool TryParseSectionSelection(
-		const FString& InCommandLine,
-		FADumpSectionSelection& OutSectionSelection,
-		FString& OutErrorMessage)
+	// BuildBatchOptionsKeyText는 asset 실행 옵션과 schema/extractor 버전을 하나의 비교 키로 만든다.
+	FString BuildBatchOptionsKeyText(const FADumpRunOpts& InDumpRunOpts)
 	{
-		OutSectionSelection.ResetToFullMode();
-		OutErrorMessage.Reset();
+		return FString::Printf(
+			TEXT("%s|%s|%s"),
+			ADumpSchema::GetVersionText(),
+			ADumpSchema::GetExtractorVersionText(),
+			*ADumpFingerprint::BuildOptionsHash(InDumpRunOpts.BuildRequestInfo()));
+	}
 
-		// SectionListText는 -Sections=에서 읽은 쉼표 구분 원문이다.
-		FString SectionListText;
-		if (!TryGetSectionListText(InCommandLine, SectionListText))
+	// LoadBatchManifestOptionsKeyText는 dump.json 옆 manifest의 schema/extractor 버전과 run.options_hash를 BuildBatchOptionsKeyText 형식으로 읽는다. 없으면 빈 문자열이다.
+	FString LoadBatchManifestOptionsKeyText(const FString& InOutputFilePath)
+	{
+		TSharedPtr<FJsonObject> ManifestRootObject;
+		if (!LoadCommandletJsonObjectFromFile(FPaths::Combine(FPaths::GetPath(InOutputFilePath), TEXT("manifest.json")), ManifestRootObject))
 		{
-			return true;
+			return FString();
 		}
 
-		OutSectionSelection.ResetToExplicitMode();
-
-		// SectionNameArray는 사용자가 전달한 섹션 이름 토큰 목록이다.
-		TArray<FString> SectionNameArray;
-		SectionListText.ParseIntoArray(SectionNameArray, TEXT(","), false);
-		// SectionName은 공백 제거와 소문자 정규화를 적용할 현재 입력 토큰이다.
-		for (FString& SectionName : SectionNameArray)
+		// OptionsHashText는 manifest를 쓴 실행의 옵션 해시다.
+		const FString OptionsHashText = GetCommandletStringFieldOrEmpty(GetCommandletNestedObjectField(ManifestRootObject, TEXT("run")), TEXT("options_hash"));
+		if (OptionsHashText.IsEmpty())
 		{
-			SectionName.TrimStartAndEndInline();
-			SectionName.ToLowerInline();
-			if (SectionName.IsEmpty())
-			{
-				OutErrorMessage = FString::Printf(
-					TEXT("Invalid empty section name in -Sections=. Valid sections: %s"),
-					*GetValidSectionNamesText());
-				return false;
-			}
+			return FString();
+		}
 
-			// ResolvedSection은 현재 이름에 대응하는 정식 주요 JSON 섹션이다.
-			EADumpSection ResolvedSection = EADumpSection::Summary;
-			if (!TryResolveDumpSection(SectionName, ResolvedSection))
-			{
-				OutErrorMessage = FString::Printf(
-					TEXT("Unknown section '%s' in -Sections=. Valid sections: %s"),
-					*SectionName,
-					*GetValidSectionNamesText());
-				return false;
-			}
-			OutSectionSelection.Enable(ResolvedSection);
+		return FString::Printf(
+			TEXT("%s|%s|%s"),
+			*GetCommandletStringFieldOrEmpty(ManifestRootObject, TEXT("schema_version")),
+			*GetCommandletStringFieldOrEmpty(ManifestRootObject, TEXT("extractor_version")),
+			*OptionsHashText);
+	}
+
+	// BuildBatchPackageStateText는 package 파일 하나를 stat 한 번으로 timestamp|size 상태 문자열로 만든다.
+	FString BuildBatchPackageStateText(const FString& InPackageName)
+	{
+		// PackageFilePath는 long package name에 대응하는 실제 .uasset/.umap 경로다.
+		FString PackageFilePath;
+		if (!FPackageName::DoesPackageExist(InPackageName, &PackageFilePath))
+		{
+			return TEXT("missing");
 		}
 
-		if (OutSectionSelection.EnabledSections.IsEmpty())
+		// PackageStatData는 timestamp와 size를 한 번에 읽은 파일 상태다.
+		const FFileStatData PackageStatData = IFileManager::Get().GetStatData(*PackageFilePath);
+		if (!PackageStatData.bIsValid)
 		{
-			OutErrorMessage = FString::Printf(
-				TEXT("-Sections= requires at least one section. Valid sections: %s"),
-				*GetValidSectionNamesText());
-			return false;
+			return TEXT("missing");
 		}
-		return true;
+
+		return FString::Printf(TEXT("%s|%lld"), *PackageStatData.ModificationTime.ToIso8601(), PackageStatData.FileSize);
 	}
 
-	// ConfigureDumpRunOptsFromCommandLine는 commandlet 공통 인자와 섹션 선택을 FADumpRunOpts로 채운다.
-	void ConfigureDumpRunOptsFromCommandLine(
-		const FString& InCommandLine,
-		const FString& InAssetPath,
-		const FString& InOutputPath,
-		const FADumpSectionSelection& InSectionSelection,
-		const FString& InIntentName,
-		const FString& InProfileName,
-		const FString& InSectionSource,
-		FADumpRunOpts& OutDumpRunOpts)
+	// LoadBatchFileStateCache는 scope가 일치하는 batch_file_state_v1 cache를 plan에 읽어 들인다.
+	bool LoadBatchFileStateCache(
+		const FString& InCacheFilePath,
+		const FString& InScopeText,
+		TMap<FString, FString>& OutPreviousPackageStateByName,
+		TMap<FString, TPair<FString, FString>>& OutPreviousAssetRecordByPath)
 	{
-		OutDumpRunOpts.AssetObjectPath = InAssetPath;
-		OutDumpRunOpts.SourceKind = EADumpSourceKind::Commandlet;
-		OutDumpRunOpts.OutputFilePath = InOutputPath;
-		OutDumpRunOpts.SectionSelection = InSectionSelection;
-		OutDumpRunOpts.Intent = InIntentName;
-		OutDumpRunOpts.Profile = InProfileName;
-		OutDumpRunOpts.SectionSource = InSectionSource;
-		OutDumpRunOpts.bIncludeSummary = true;
-		OutDumpRunOpts.bIncludeDetails = false;
-		OutDumpRunOpts.bIncludeGraphs = false;
-		OutDumpRunOpts.bIncludeReferences = false;
+		OutPreviousPackageStateByName.Reset();
+		OutPreviousAssetRecordByPath.Reset();
+
+		// CacheRootObject는 이전 실행 cache 역직렬화 결과다.
+		TSharedPtr<FJsonObject> CacheRootObject;
+		if (!IFileManager::Get().FileExists(*InCacheFilePath) || !LoadCommandletJsonObjectFromFile(InCacheFilePath, CacheRootObject))
+		{
+			return false;
+		}
+
+		if (GetCommandletStringFieldOrEmpty(CacheRootObject, TEXT("schema_version")) != TEXT("batch_file_state_v1")
+			|| GetCommandletStringFieldOrEmpty(CacheRootObject, TEXT("scope")) != InScopeText)
+		{
+			return false;
+		}
+
+		// PackageValueArray는 [package, state] tuple 배열이다.
+		const TArray<TSharedPtr<FJsonValue>>* PackageValueArray = nullptr;
+
+		// AssetValueArray는 [object_path, options_key, status] tuple 배열이다.
+		const TArray<TSharedPtr<FJsonValue>>* AssetValueArray = nullptr;
+		if (!CacheRootObject->TryGetArrayField(TEXT("packages"), PackageValueArray)
+			|| !CacheRootObject->TryGetArrayField(TEXT("assets"), AssetValueArray))
+		{
+			return false;
+		}
+
+		// DiscardCache는 tuple 하나라도 형식이 다르면 절반만 읽은 cache를 버리고 전체 재판정으로 돌린다.
+		auto DiscardCache = [&OutPreviousPackageStateByName, &OutPreviousAssetRecordByPath]()
+		{
+			OutPreviousPackageStateByName.Reset();
+			OutPreviousAssetRecordByPath.Reset();
+			return false;
+		};
+
+		OutPreviousPackageStateByName.Reserve(PackageValueArray->Num());
+		for (const TSharedPtr<FJsonValue>& PackageValue : *PackageValueArray)
+		{
+			// PackageTupleArray는 package 상태 tuple이다.
+			const TArray<TSharedPtr<FJsonValue>>* PackageTupleArray = nullptr;
+			FString PackageNameText;
+			FString PackageStateText;
+			if (!PackageValue.IsValid()
+				|| !PackageValue->TryGetArray(PackageTupleArray)
+				|| PackageTupleArray->Num() != 2
+				|| !(*PackageTupleArray)[0].IsValid() || !(*PackageTupleArray)[0]->TryGetString(PackageNameText)
+				|| !(*PackageTupleArray)[1].IsValid() || !(*PackageTupleArray)[1]->TryGetString(PackageStateText))
+			{
+				return DiscardCache();
+			}
+
+			OutPreviousPackageStateByName.Add(MoveTemp(PackageNameText), MoveTemp(PackageStateText));
+		}
+
+		OutPreviousAssetRecordByPath.Reserve(AssetValueArray->Num());
+		for (const TSharedPtr<FJsonValue>& AssetValue : *AssetValueArray)
+		{
+			// AssetTupleArray는 asset 실행 기록 tuple이다.
+			const TArray<TSharedPtr<FJsonValue>>* AssetTupleArray = nullptr;
+			FString ObjectPathText;
+			FString OptionsKeyText;
+			FString StatusText;
+			if (!AssetValue.IsValid()
+				|| !AssetValue->TryGetArray(AssetTupleArray)
+				|| AssetTupleArray->Num() != 3
+				|| !(*AssetTupleArray)[0].IsValid() || !(*AssetTupleArray)[0]->TryGetString(ObjectPathText)
+				|| !(*AssetTupleArray)[1].IsValid() || !(*AssetTupleArray)[1]->TryGetString(OptionsKeyText)
+				|| !(*AssetTupleArray)[2].IsValid() || !(*AssetTupleArray)[2]->TryGetString(StatusText))
+			{
+				return DiscardCache();
+			}
+
+			OutPreviousAssetRecordByPath.Add(MoveTemp(ObjectPathText), TPair<FString, FString>(MoveTemp(OptionsKeyText), MoveTemp(StatusText)));
+		}
+
+		return true;
+	}
+
+	// FCommandletBatchPackageGraph는 batch 자산 package와 dependency package를 잇는 변경 판정용 graph다.
+	struct FCommandletBatchPackageGraph
+	{
+		// PackageOrdinalByName은 package graph node ordinal 조회표다.
+		TMap<FString, int32> PackageOrdinalByName;
+
+		// PackageNameArray는 ordinal별 package 이름이다.
+		TArray<FString> PackageNameArray;
+
+		// ForwardEdgeArray와 ReverseEdgeArray는 package 단위 dependency/dependent 인접 목록이다.
+		TArray<TArray<int32>> ForwardEdgeArray;
+		TArray<TArray<int32>> ReverseEdgeArray;
+
+		// BatchAssetPathsByPackageOrdinal은 package node별 이번 batch 자산 object path 목록이다.
+		TMap<int32, TArray<FString>> BatchAssetPathsByPackageOrdinal;
+	};
+
+	// FindOrAddBatchGraphPackage는 package 이름을 graph node ordinal로 바꾼다.
+	int32 FindOrAddBatchGraphPackage(FCommandletBatchPackageGraph& InOutGraph, const FString& InPackageName)
+	{
+		if (const int32* ExistingOrdinal = InOutGraph.PackageOrdinalByName.Find(InPackageName))
+		{
+			return *ExistingOrdinal;
+		}
+
+		// NewOrdinal은 새 package node ordinal이다.
+		const int32 NewOrdinal = InOutGraph.PackageNameArray.Add(InPackageName);
+		InOutGraph.PackageOrdinalByName.Add(InPackageName, NewOrdinal);
+		InOutGraph.ForwardEdgeArray.AddDefaulted();
+		InOutGraph.ReverseEdgeArray.AddDefaulted();
+		return NewOrdinal;
+	}
+
+	// AddBatchGraphEdge는 dependent -> dependency package edge를 양방향 인접 목록에 추가한다.
+	void AddBatchGraphEdge(FCommandletBatchPackageGraph& InOutGraph, const FString& InFromPackageName, const FString& InToPackageName)
+	{
+		if (InFromPackageName.IsEmpty() || InToPackageName.IsEmpty()
+			|| InToPackageName.StartsWith(TEXT("/Script/"))
+			|| InFromPackageName.Equals(InToPackageName, ESearchCase::CaseSensitive))
+		{
+			return;
+		}
+
+		// FromOrdinal과 ToOrdinal은 edge 양 끝 package node ordinal이다.
+		const int32 FromOrdinal = FindOrAddBatchGraphPackage(InOutGraph, InFromPackageName);
+		const int32 ToOrdinal = FindOrAddBatchGraphPackage(InOutGraph, InToPackageName);
+		InOutGraph.ForwardEdgeArray[FromOrdinal].AddUnique(ToOrdinal);
+		InOutGraph.ReverseEdgeArray[ToOrdinal].AddUnique(FromOrdinal);
+	}
+
+	// AddBatchGraphAsset은 batch 자산 object path를 package node에 등록하고 package 이름을 돌려준다.
+	FString AddBatchGraphAsset(FCommandletBatchPackageGraph& InOutGraph, const FString& InObjectPath)
+	{
+		// AssetPackageNameText는 batch 자산 package 이름이다.
+		const FString AssetPackageNameText = FPackageName::ObjectPathToPackageName(InObjectPath);
+		InOutGraph.BatchAssetPathsByPackageOrdinal.FindOrAdd(FindOrAddBatchGraphPackage(InOutGraph, AssetPackageNameText)).Add(InObjectPath);
+		return AssetPackageNameText;
+	}
+
+	// ResolveBatchChangePlan은 graph에서 추적 package 상태를 이전 cache와 비교하고 reverse closure로 자산별 redump_reason을 채운다.
+	// InPackageStateProvider는 추적 package마다 한 번 호출되며, batchdump는 파일 stat을, validate fixture는 고정 상태를 넘긴다.
+	// InManifestOptionsKeyProvider는 skip 후보 자산의 dump.json 경로마다 호출되어 디스크 manifest가 기록한 옵션 키를 돌려준다.
+	void ResolveBatchChangePlan(
+		const FCommandletBatchPackageGraph& InGraph,
+		const TMap<FString, FString>& InPreviousPackageStateByName,
+		TFunctionRef<FString(const FString&)> InPackageStateProvider,
+		TFunctionRef<FString(const FString&)> InManifestOptionsKeyProvider,
+		const TMap<FString, FString>& InOptionsKeyByObjectPath,
+		const TMap<FString, FString>& InOutputFilePathByObjectPath,
+		FCommandletBatchChangePlan& InOutPlan)
+	{
+		// PackageNameArray는 graph ordinal별 package 이름이다.
+		const TArray<FString>& PackageNameArray = InGraph.PackageNameArray;
+
+		// bTrackedPackageArray는 batch 자산에서 forward closure로 도달한 package 표시다. 이 package만 stat한다.
+		TArray<bool> bTrackedPackageArray;
+		bTrackedPackageArray.Init(false, PackageNameArray.Num());
+
+		// PendingOrdinalArray는 forward/reverse BFS 공용 queue다.
+		TArray<int32> PendingOrdinalArray;
+		for (const TPair<int32, TArray<FString>>& BatchPackagePair : InGraph.BatchAssetPathsByPackageOrdinal)
+		{
+			bTrackedPackageArray[BatchPackagePair.Key] = true;
+			PendingOrdinalArray.Add(BatchPackagePair.Key);
+		}
+
+		for (int32 PendingIndex = 0; PendingIndex < PendingOrdinalArray.Num(); ++PendingIndex)
+		{
+			for (const int32 DependencyOrdinal : InGraph.ForwardEdgeArray[PendingOrdinalArray[PendingIndex]])
+			{
+				if (!bTrackedPackageArray[DependencyOrdinal])
+				{
+					bTrackedPackageArray[DependencyOrdinal] = true;
+					PendingOrdinalArray.Add(DependencyOrdinal);
+				}
+			}
+		}
+
+		// ChangedOriginByOrdinal은 변경 전파를 받은 package별 최초 변경 package ordinal이다. INDEX_NONE은 미도달이다.
+		TArray<int32> ChangedOriginByOrdinal;
+		ChangedOriginByOrdinal.Init(INDEX_NONE, PackageNameArray.Num());
+
+		// ChangedOrdinalArray는 파일 상태가 이전 cache와 다른 package ordinal이다.
+		TArray<int32> ChangedOrdinalArray;
+		InOutPlan.PackageStateByName.Reserve(PendingOrdinalArray.Num());
+		for (const int32 TrackedOrdinal : PendingOrdinalArray)
+		{
+			// TrackedPackageNameText는 상태를 계산할 추적 package 이름이다.
+			const FString& TrackedPackageNameText = PackageNameArray[TrackedOrdinal];
+
+			// CurrentStateText는 package 파일의 현재 상태다.
+			const FString CurrentStateText = InPackageStateProvider(TrackedPackageNameText);
+			InOutPlan.PackageStateByName.Add(TrackedPackageNameText, CurrentStateText);
+
+			// PreviousStateText는 이전 cache의 같은 package 상태다.
+			const FString* PreviousStateText = InPreviousPackageStateByName.Find(TrackedPackageNameText);
+			if (PreviousStateText == nullptr || *PreviousStateText != CurrentStateText)
+			{
+				ChangedOriginByOrdinal[TrackedOrdinal] = TrackedOrdinal;
+				ChangedOrdinalArray.Add(TrackedOrdinal);
+			}
+		}
+
+		InOutPlan.ChangedPackageCount = ChangedOrdinalArray.Num();
+
+		// ChangedOrdinalArray를 queue로 reverse edge를 따라 dependent package까지 dirty를 전파한다.
+		for (int32 ChangedIndex = 0; ChangedIndex < ChangedOrdinalArray.Num(); ++ChangedIndex)
+		{
+			// CurrentOrdinal은 현재 전파 중인 dirty package ordinal이다.
+			const int32 CurrentOrdinal = ChangedOrdinalArray[ChangedIndex];
+			for (const int32 DependentOrdinal : InGraph.ReverseEdgeArray[CurrentOrdinal])
+			{
+				++InOutPlan.VisitedEdgeCount;
+				if (bTrackedPackageArray[DependentOrdinal] && ChangedOriginByOrdinal[DependentOrdinal] == INDEX_NONE)
+				{
+					ChangedOriginByOrdinal[DependentOrdinal] = ChangedOriginByOrdinal[CurrentOrdinal];
+					ChangedOrdinalArray.Add(DependentOrdinal);
+				}
+			}
+		}
+
+		for (const TPair<int32, TArray<FString>>& BatchPackagePair : InGraph.BatchAssetPathsByPackageOrdinal)
+		{
+			// OriginOrdinal은 batch 자산 package에 도달한 변경 package ordinal이다.
+			const int32 OriginOrdinal = ChangedOriginByOrdinal[BatchPackagePair.Key];
+			for (const FString& AssetObjectPathText : BatchPackagePair.Value)
+			{
+				// PreviousAssetRecord는 이전 실행의 (options_key, status) 기록이다.
+				const TPair<FString, FString>* PreviousAssetRecord = InOutPlan.PreviousAssetRecordByPath.Find(AssetObjectPathText);
+
+				// OutputFilePathText는 현재 자산 dump.json 경로다.
+				const FString* OutputFilePathText = InOutputFilePathByObjectPath.Find(AssetObjectPathText);
+
+				// OptionsKeyText는 현재 자산 실행 옵션 키다.
+				const FString* OptionsKeyText = InOptionsKeyByObjectPath.Find(AssetObjectPathText);
+				if (PreviousAssetRecord == nullptr
+					|| OutputFilePathText == nullptr
+					|| !ADumpJson::DoesJsonFileExist(*OutputFilePathText))
+				{
+					InOutPlan.RedumpReasonByObjectPath.Add(AssetObjectPathText, TEXT("no_previous_dump"));
+				}
+				else if (PreviousAssetRecord->Value != TEXT("dumped"))
+				{
+					InOutPlan.RedumpReasonByObjectPath.Add(AssetObjectPathText, TEXT("previous_failure"));
+				}
+				else if (OptionsKeyText == nullptr || PreviousAssetRecord->Key != *OptionsKeyText)
+				{
+					InOutPlan.RedumpReasonByObjectPath.Add(AssetObjectPathText, TEXT("options_changed"));
+				}
+				else if (OriginOrdinal == BatchPackagePair.Key)
+				{
+					InOutPlan.RedumpReasonByObjectPath.Add(AssetObjectPathText, TEXT("package_changed"));
+				}
+				else if (OriginOrdinal != INDEX_NONE)
+				{
+					InOutPlan.RedumpReasonByObjectPath.Add(AssetObjectPathText, TEXT("dependency_changed"));
+					InOutPlan.RedumpViaByObjectPath.Add(AssetObjectPathText, PackageNameArray[OriginOrdinal]);
+				}
+				else if (InManifestOptionsKeyProvider(*OutputFilePathText) != *OptionsKeyText)
+				{
+					// cache 저장 뒤 watch나 단일 dump가 다른 옵션으로 덮어쓴 dump는 cache 기록만 믿고 skip하지 않는다.
+					InOutPlan.RedumpReasonByObjectPath.Add(AssetObjectPathText, TEXT("options_changed"));
+				}
+			}
+		}
+	}
+
+	// BuildBatchChangePlan은 변경 package 집합을 계산하고 reverse dependency closure로 재덤프 자산과 사유를 정한다.
+	// bInLoadPreviousCache가 false인 전체 실행은 이전 cache를 읽지 않고 저장할 package 상태만 계산한다.
+	void BuildBatchChangePlan(
+		FAssetRegistryModule& InAssetRegistryModule,
+		const FString& InDumpRootPath,
+		const FString& InScopeText,
+		bool bInLoadPreviousCache,
+		const TArray<FAssetData>& InAssetArray,
+		const TMap<FString, FString>& InOptionsKeyByObjectPath,
+		const TMap<FString, FString>& InOutputFilePathByObjectPath,
+		FCommandletBatchChangePlan& OutPlan)
+	{
+		// PlanStartSeconds는 계획 계산 시작 시각이다.
+		const double PlanStartSeconds = FPlatformTime::Seconds();
+
+		OutPlan = FCommandletBatchChangePlan();
+		OutPlan.ScopeText = InScopeText;
+		OutPlan.CacheFilePath = BuildBatchFileStateCacheFilePath(InDumpRootPath, InScopeText);
+
+		// PreviousPackageStateByName은 이전 실행에서 기록한 package 상태다.
+		TMap<FString, FString> PreviousPackageStateByName;
+		OutPlan.bCacheLoaded = bInLoadPreviousCache && LoadBatchFileStateCache(
+			OutPlan.CacheFilePath,
+			InScopeText,
+			PreviousPackageStateByName,
+			OutPlan.PreviousAssetRecordByPath);
+
+		// PackageGraph는 batch 자산과 dependency package graph다.
+		FCommandletBatchPackageGraph PackageGraph;
+		for (const FAssetData& AssetDataItem : InAssetArray)
+		{
+			// AssetPackageNameText는 batch 자산 package 이름이다.
+			const FString AssetPackageNameText = AddBatchGraphAsset(PackageGraph, AssetDataItem.GetObjectPathString());
+
+			// DependencyPackageNameArray는 fingerprint와 같은 AssetRegistry 직접 dependency 목록이다. 메모리 조회라 파일 stat이 없다.
+			TArray<FName> DependencyPackageNameArray;
+			InAssetRegistryModule.Get().GetDependencies(FName(*AssetPackageNameText), DependencyPackageNameArray);
+			for (const FName& DependencyPackageName : DependencyPackageNameArray)
+			{
+				AddBatchGraphEdge(PackageGraph, AssetPackageNameText, DependencyPackageName.ToString());
+			}
+		}
+
+		// DependencyIndexRootObject는 이전 index 단계가 저장한 dependency_index.json이다.
+		TSharedPtr<FJsonObject> DependencyIndexRootObject;
+
+		// DependencyIndexFilePath는 dump root dependency_index.json 경로다.
+		const FString DependencyIndexFilePath = FPaths::Combine(FPaths::ConvertRelativePathToFull(InDumpRootPath), TEXT("dependency_index.json"));
+
+		// RelationValueArray는 dependency_index relations 배열이다.
+		const TArray<TSharedPtr<FJsonValue>>* RelationValueArray = nullptr;
+		if (IFileManager::Get().FileExists(*DependencyIndexFilePath)
+			&& LoadCommandletJsonObjectFromFile(DependencyIndexFilePath, DependencyIndexRootObject)
+			&& DependencyIndexRootObject->TryGetArrayField(TEXT("relations"), RelationValueArray)
+			&& RelationValueArray)
+		{
+			OutPlan.bDependencyIndexLoaded = true;
+			for (const TSharedPtr<FJsonValue>& RelationValue : *RelationValueArray)
+			{
+				// RelationObject는 from/to object path relation 한 건이다.
+				const TSharedPtr<FJsonObject> RelationObject = RelationValue.IsValid() ? RelationValue->AsObject() : nullptr;
+				AddBatchGraphEdge(
+					PackageGraph,
+					FPackageName::ObjectPathToPackageName(GetCommandletStringFieldOrEmpty(RelationObject, TEXT("from"))),
+					FPackageName::ObjectPathToPackageName(GetCommandletStringFieldOrEmpty(RelationObject, TEXT("to"))));
+			}
+		}
+
+		ResolveBatchChangePlan(
+			PackageGraph,
+			PreviousPackageStateByName,
+			[](const FString& InPackageName) { return BuildBatchPackageStateText(InPackageName); },
+			[](const FString& InOutputFilePath) { return LoadBatchManifestOptionsKeyText(InOutputFilePath); },
+			InOptionsKeyByObjectPath,
+			InOutputFilePathByObjectPath,
+			OutPlan);
+
+		OutPlan.PlanMilliseconds = (FPlatformTime::Seconds() - PlanStartSeconds) * 1000.0;
+	}
+
+	// SaveBatchFileStateCache는 이번 실행 package 상태와 asset 결과를 다음 batch의 변경 기준으로 저장한다.
+	bool SaveBatchFileStateCache(
+		const FCommandletBatchChangePlan& InPlan,
+		const TMap<FString, TPair<FString, FString>>& InAssetRecordByPath,
+		FString& OutErrorMessage)
+	{
+		// SortedPackageNameArray는 deterministic 출력을 위한 package 이름 정렬 결과다.
+		TArray<FString> SortedPackageNameArray;
+		InPlan.PackageStateByName.GetKeys(SortedPackageNameArray);
+		SortedPackageNameArray.Sort([](const FString& InLeft, const FString& InRight)
+		{
+			return InLeft.Compare(InRight, ESearchCase::CaseSensitive) < 0;
+		});
+
+		// PackageValueArray는 [package, state] tuple 배열이다.
+		TArray<TSharedPtr<FJsonValue>> PackageValueArray;
+		PackageValueArray.Reserve(SortedPackageNameArray.Num());
+		for (const FString& PackageNameText : SortedPackageNameArray)
+		{
+			TArray<TSharedPtr<FJsonValue>> PackageTupleArray;
+			PackageTupleArray.Add(MakeShared<FJsonValueString>(PackageNameText));
+			PackageTupleArray.Add(MakeShared<FJsonValueString>(InPlan.PackageStateByName.FindChecked(PackageNameText)));
+			PackageValueArray.Add(MakeShared<FJsonValueArray>(PackageTupleArray));
+		}
+
+		// SortedAssetPathArray는 deterministic 출력을 위한 asset object path 정렬 결과다.
+		TArray<FString> SortedAssetPathArray;
+		InAssetRecordByPath.GetKeys(SortedAssetPathArray);
+		SortedAssetPathArray.Sort([](const FString& InLeft, const FString& InRight)
+		{
+			return InLeft.Compare(InRight, ESearchCase::CaseSensitive) < 0;
+		});
+
+		// AssetValueArray는 [object_path, options_key, status] tuple 배열이다.
+		TArray<TSharedPtr<FJsonValue>> AssetValueArray;
+		AssetValueArray.Reserve(SortedAssetPathArray.Num());
+		for (const FString& AssetPathText : SortedAssetPathArray)
+		{
+			// AssetRecord는 asset별 (options_key, status) 기록이다.
+			const TPair<FString, FString>& AssetRecord = InAssetRecordByPath.FindChecked(AssetPathText);
+			TArray<TSharedPtr<FJsonValue>> AssetTupleArray;
+			AssetTupleArray.Add(MakeShared<FJsonValueString>(AssetPathText));
+			AssetTupleArray.Add(MakeShared<FJsonValueString>(AssetRecord.Key));
+			AssetTupleArray.Add(MakeShared<FJsonValueString>(AssetRecord.Value));
+			AssetValueArray.Add(MakeShared<FJsonValueArray>(AssetTupleArray));
+		}
+
+		// CacheRootObject는 batch_file_state_v1 최상위 object다.
+		TSharedRef<FJsonObject> CacheRootObject = MakeShared<FJsonObject>();
+		CacheRootObject->SetStringField(TEXT("schema_version"), TEXT("batch_file_state_v1"));
+		CacheRootObject->SetStringField(TEXT("generated_time"), FDateTime::UtcNow().ToIso8601());
+		CacheRootObject->SetStringField(TEXT("scope"), InPlan.ScopeText);
+		CacheRootObject->SetArrayField(TEXT("packages"), PackageValueArray);
+		CacheRootObject->SetArrayField(TEXT("assets"), AssetValueArray);
+
+		// CacheJsonText는 compact 직렬화한 cache 문자열이다.
+		FString CacheJsonText;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> CacheJsonWriter =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&CacheJsonText);
+		if (!FJsonSerializer::Serialize(CacheRootObject, CacheJsonWriter))
+		{
+			OutErrorMessage = TEXT("Failed to serialize batch_file_state_v1.");
+			return false;
+		}
+
+		return ADumpJson::SaveJsonTextToFile(InPlan.CacheFilePath, CacheJsonText, OutErrorMessage);
+	}
+
+	// FValidationCaseDefinition은 validate 모드에서 한 건의 대표 샘플 정의를 담는다.
+	struct FValidationCaseDefinition
+	{
+		// CaseName은 report에서 식별할 케이스 이름이다.
+		FString CaseName;
+
+		// ExpectedAssetFamily는 dump 결과에서 기대하는 asset_family 문자열이다.
+		FString ExpectedAssetFamily;
+
+		// ExpectedAssetClass는 dump 결과에서 기대하는 자산 클래스 문자열이다.
+		FString ExpectedAssetClass;
+
+		// CandidateObjectPathArray는 우선 시도할 자산 오브젝트 경로 후보 목록이다.
+		TArray<FString> CandidateObjectPathArray;
+
+		// DiscoveryClassName은 후보가 없을 때 AssetRegistry에서 탐색할 클래스 이름이다.
+		FString DiscoveryClassName;
+		FString DiscoveryAssetFamily;
+
+		// bIsOptionalSample는 샘플이 없어도 전체 실패로 보지 않을지 여부다.
+		bool bIsOptionalSample = false;
+
+		// MinGraphCount는 그래프 최소 기대 개수다.
+		int32 MinGraphCount = 0;
+
+		// MinPropertyCount는 details 최소 기대 프로퍼티 개수다.
+		int32 MinPropertyCount = 0;
+
+		// MinReferenceCount는 hard+soft 참조 최소 기대 개수다.
+		int32 MinReferenceCount = 0;
+
+		// MinWidgetBindingCount는 widget binding 최소 기대 개수다.
+		int32 MinWidgetBindingCount = 0;
+
+		// MinWidgetDesignerNodeCount는 Widget Designer hierarchy 최소 노드 개수다.
+		int32 MinWidgetDesignerNodeCount = 0;
+
+		// MinWidgetDesignerMaxDepth는 Widget Designer hierarchy 최소 최대 깊이다.
+		int32 MinWidgetDesignerMaxDepth = 0;
+
+		// MinInputMappingCount는 input mapping 최소 기대 개수다.
+		int32 MinInputMappingCount = 0;
+
+		// MinCurveKeyCount는 curve key 최소 기대 개수다.
+		int32 MinCurveKeyCount = 0;
+
+		// MinWorldActorCount는 world actor 최소 기대 개수다.
+		int32 MinWorldActorCount = 0;
+
+		// MinWorldStaticMeshSocketTransformCount는 world 배치 StaticMeshComponent socket Transform 최소 기대 개수다.
+		int32 MinWorldStaticMeshSocketTransformCount = 0;
+
+		// bRequireWorldComponentTransformNonIdentity는 world socket fixture가 비-identity component world Transform을 가져야 하는지 여부다.
+		bool bRequireWorldComponentTransformNonIdentity = false;
+
+		// MinDataTableRowCount는 DataTable row 최소 기대 개수다.
+		int32 MinDataTableRowCount = 0;
+
+		// MinStaticMeshSocketCount는 StaticMesh socket 최소 기대 개수다.
+		int32 MinStaticMeshSocketCount = 0;
+
+		// MinComponentStaticMeshSocketCount는 StaticMeshComponent 참조 StaticMesh socket 최소 기대 개수다.
+		int32 MinComponentStaticMeshSocketCount = 0;
+
+		// MinComponentStaticMeshSocketTransformCount는 StaticMeshComponent 참조 socket Transform 최소 기대 개수다.
+		int32 MinComponentStaticMeshSocketTransformCount = 0;
+	};
+
+	// TryResolveValidationAssetPath는 후보 경로 또는 클래스 탐색으로 validate 샘플 자산 경로를 찾는다.
+	// ResolveValidationAssetFamilyText는 validate 탐색 중 UObject 자산을 asset family 문자열로 분류한다.
+	FString ResolveValidationAssetFamilyText(UObject* InAssetObject)
+	{
+		if (!InAssetObject)
+		{
+			return TEXT("object_asset");
+		}
+
+		if (UBlueprint* BlueprintAsset = Cast<UBlueprint>(InAssetObject))
+		{
+			if (BlueprintAsset->GetClass()->GetName().Equals(TEXT("WidgetBlueprint"), ESearchCase::CaseSensitive))
+			{
+				return TEXT("widget_blueprint");
+			}
+
+			if (Cast<UAnimBlueprint>(BlueprintAsset))
+			{
+				return TEXT("anim_blueprint");
+			}
+
+			UClass* ParentClassObject = BlueprintAsset->ParentClass;
+			if (ParentClassObject && ParentClassObject->IsChildOf(AActor::StaticClass()))
+			{
+				return TEXT("actor_blueprint");
+			}
+
+			if (ParentClassObject && ParentClassObject->IsChildOf(UActorComponent::StaticClass()))
+			{
+				return TEXT("component_blueprint");
+			}
+
+			return TEXT("object_blueprint");
+		}
+
+		if (Cast<UPrimaryDataAsset>(InAssetObject))
+		{
+			return TEXT("primary_data_asset");
+		}
+
+		if (Cast<UInputAction>(InAssetObject))
+		{
+			return TEXT("input_action");
+		}
+
+		if (Cast<UInputMappingContext>(InAssetObject))
+		{
+			return TEXT("input_mapping_context");
+		}
+
+		if (Cast<UDataAsset>(InAssetObject))
+		{
+			return TEXT("data_asset");
+		}
+
+		if (Cast<UDataTable>(InAssetObject))
+		{
+			return TEXT("data_table");
+		}
+
+		if (Cast<UStaticMesh>(InAssetObject))
+		{
+			return TEXT("static_mesh");
+		}
+
+		if (Cast<UCurveFloat>(InAssetObject))
+		{
+			return TEXT("curve_float");
+		}
+
+		if (Cast<UWorld>(InAssetObject))
+		{
+			return TEXT("world_map");
+		}
+
+		return TEXT("object_asset");
+	}
+
+	// DoesLoadedAssetMatchValidationCase는 로드한 자산이 validate 케이스 조건과 맞는지 확인한다.
+	bool DoesLoadedAssetMatchValidationCase(
+		UObject* InLoadedAssetObject,
+		const FValidationCaseDefinition& InCaseDefinition)
+	{
+		if (!InLoadedAssetObject)
+		{
+			return false;
+		}
+
+		if (!InCaseDefinition.ExpectedAssetClass.IsEmpty())
+		{
+			const FString LoadedAssetClassName = InLoadedAssetObject->GetClass()->GetName();
+			if (!LoadedAssetClassName.Equals(InCaseDefinition.ExpectedAssetClass, ESearchCase::CaseSensitive))
+			{
+				return false;
+			}
+		}
+
+		if (!InCaseDefinition.ExpectedAssetFamily.IsEmpty())
+		{
+			const FString LoadedAssetFamilyText = ResolveValidationAssetFamilyText(InLoadedAssetObject);
+			if (!LoadedAssetFamilyText.Equals(InCaseDefinition.ExpectedAssetFamily, ESearchCase::CaseSensitive))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool TryResolveValidationAssetPath(
+		FAssetRegistryModule& InAssetRegistryModule,
+		const FValidationCaseDefinition& InCaseDefinition,
+		FString& OutResolvedObjectPath)
+	{
+		OutResolvedObjectPath.Reset();
+
+		for (const FString& CandidateObjectPath : InCaseDefinition.CandidateObjectPathArray)
+		{
+			// CandidateAssetData는 현재 후보 경로에 대응하는 AssetRegistry 항목이다.
+			const FAssetData CandidateAssetData = InAssetRegistryModule.Get().GetAssetByObjectPath(FSoftObjectPath(CandidateObjectPath));
+			if (CandidateAssetData.IsValid())
+			{
+				UObject* CandidateLoadedObject = CandidateAssetData.GetAsset();
+				if (DoesLoadedAssetMatchValidationCase(CandidateLoadedObject, InCaseDefinition))
+				{
+					OutResolvedObjectPath = CandidateAssetData.GetObjectPathString();
+					return true;
+				}
+			}
+
+			// CandidateSoftObjectPath는 AssetRegistry에 안 잡히는 플러그인 Content 후보를 직접 로드해 확인한다.
+			const FSoftObjectPath CandidateSoftObjectPath(CandidateObjectPath);
+
+			// CandidateLoadedObject는 후보 경로가 실제 로드 가능한 자산인지 직접 확인한 결과다.
+			UObject* CandidateLoadedObject = CandidateSoftObjectPath.TryLoad();
+			if (DoesLoadedAssetMatchValidationCase(CandidateLoadedObject, InCaseDefinition))
+			{
+				OutResolvedObjectPath = CandidateSoftObjectPath.ToString();
+				return true;
+			}
+		}
+
+		if (InCaseDefinition.DiscoveryClassName.IsEmpty() && InCaseDefinition.DiscoveryAssetFamily.IsEmpty())
+		{
+			return false;
+		}
+
+		// SearchRootPathArray는 자동 탐색 시 검사할 대표 루트 경로 목록이다.
+		const TArray<FString> SearchRootPathArray = { TEXT("/AssetDump"), TEXT("/Game"), TEXT("/Engine") };
+		for (const FString& SearchRootPath : SearchRootPathArray)
+		{
+			// SearchFilter는 현재 루트 경로에서 재귀적으로 자산을 찾는 필터다.
+			FARFilter SearchFilter;
+			SearchFilter.bRecursivePaths = true;
+			SearchFilter.PackagePaths.Add(*SearchRootPath);
+
+			// DiscoveredAssetArray는 현재 루트 경로에서 찾은 자산 목록이다.
+			TArray<FAssetData> DiscoveredAssetArray;
+			InAssetRegistryModule.Get().GetAssets(SearchFilter, DiscoveredAssetArray);
+
+			for (const FAssetData& DiscoveredAssetData : DiscoveredAssetArray)
+			{
+				// DiscoveredClassName는 현재 자산의 AssetRegistry 클래스 이름이다.
+				if (!InCaseDefinition.DiscoveryClassName.IsEmpty())
+				{
+					const FString DiscoveredClassName = DiscoveredAssetData.AssetClassPath.GetAssetName().ToString();
+					if (!DiscoveredClassName.Equals(InCaseDefinition.DiscoveryClassName, ESearchCase::CaseSensitive))
+					{
+						continue;
+					}
+				}
+
+				UObject* DiscoveredLoadedObject = DiscoveredAssetData.GetAsset();
+				if (!DoesLoadedAssetMatchValidationCase(DiscoveredLoadedObject, InCaseDefinition))
+				{
+					continue;
+				}
+
+				OutResolvedObjectPath = DiscoveredAssetData.GetObjectPathString();
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// AddValidationCheck는 validate 케이스 report에 검사 한 건을 추가하고 필수 실패를 누적한다.
+	void AddValidationCheck(
+		TArray<TSharedPtr<FJsonValue>>& InOutCheckArray,
+		bool& InOutCasePassed,
+		const FString& InCheckName,
+		bool bInPassed,
+		const FString& InExpectedText,
+		const FString& InActualText,
+		bool bInRequired)
+	{
+		// CheckObject는 검사 한 건을 report에 기록할 JSON object다.
+		TSharedRef<FJsonObject> CheckObject = MakeShared<FJsonObject>();
+		CheckObject->SetStringField(TEXT("name"), InCheckName);
+		CheckObject->SetBoolField(TEXT("passed"), bInPassed);
+		CheckObject->SetBoolField(TEXT("required"), bInRequired);
+		CheckObject->SetStringField(TEXT("expected"), InExpectedText);
+		CheckObject->SetStringField(TEXT("actual"), InActualText);
+		InOutCheckArray.Add(MakeShared<FJsonValueObject>(CheckObject));
+
+		if (bInRequired && !bInPassed)
+		{
+			InOutCasePassed = false;
+		}
+	}
+
+	// ResolveExpectedGraphNodeRoleFamily는 primary role의 canonical family를 반환한다.
+	FString ResolveExpectedGraphNodeRoleFamily(const FString& InPrimaryRole)
+	{
+		if (InPrimaryRole == TEXT("event") || InPrimaryRole == TEXT("execution_entry")) return TEXT("entry");
+		if (InPrimaryRole == TEXT("function_call") || InPrimaryRole == TEXT("interface_call")) return TEXT("call");
+		if (InPrimaryRole == TEXT("variable_get") || InPrimaryRole == TEXT("variable_set")) return TEXT("variable");
+		if (InPrimaryRole == TEXT("dynamic_cast")) return TEXT("conversion");
+		if (InPrimaryRole == TEXT("branch") || InPrimaryRole == TEXT("sequence") || InPrimaryRole == TEXT("switch") || InPrimaryRole == TEXT("flow_control")) return TEXT("control_flow");
+		if (InPrimaryRole == TEXT("select") || InPrimaryRole == TEXT("pure_expression")) return TEXT("data_flow");
+		if (InPrimaryRole == TEXT("timeline")) return TEXT("timing");
+		if (InPrimaryRole == TEXT("execution_sink") || InPrimaryRole == TEXT("impure_operation")) return TEXT("operation");
+		return TEXT("unknown");
+	}
+
+	// GetGraphNodeRoleTagRank는 deterministic tag registry 순서를 반환한다.
+	int32 GetGraphNodeRoleTagRank(const FString& InTag)
+	{
+		if (InTag == TEXT("pure")) return 0;
+		if (InTag == TEXT("impure")) return 1;
+		if (InTag == TEXT("latent")) return 2;
+		if (InTag == TEXT("has_exec_input")) return 3;
+		if (InTag == TEXT("has_exec_output")) return 4;
+		if (InTag == TEXT("interface")) return 5;
+		if (InTag == TEXT("member_access")) return 6;
+		if (InTag == TEXT("conditional")) return 7;
+		if (InTag == TEXT("multi_output")) return 8;
+		return INDEX_NONE;
+	}
+
+	// TestGraphNodeRoleContract는 role schema, canonical 값, pin 구조, tag와 legacy semantic 일치를 검사한다.
+	bool TestGraphNodeRoleContract(const FADumpGraphNode& InNode, FString& OutFailureReason)
+	{
+		OutFailureReason.Reset();
+
+		const TArray<FString> CanonicalPrimaryRoles = {
+			TEXT("event"), TEXT("function_call"), TEXT("interface_call"), TEXT("variable_get"), TEXT("variable_set"),
+			TEXT("dynamic_cast"), TEXT("branch"), TEXT("sequence"), TEXT("select"), TEXT("switch"), TEXT("timeline"),
+			TEXT("execution_entry"), TEXT("execution_sink"), TEXT("flow_control"), TEXT("pure_expression"),
+			TEXT("impure_operation"), TEXT("unknown") };
+		const TArray<FString> CanonicalSources = { TEXT("exact_class"), TEXT("function_metadata"), TEXT("structural_inference"), TEXT("fallback") };
+		const TArray<FString> CanonicalConfidence = { TEXT("exact"), TEXT("inferred"), TEXT("fallback") };
+
+		if (InNode.Role.SchemaVersion != TEXT("graph_node_role_v1"))
+		{
+			OutFailureReason = FString::Printf(TEXT("schema=%s"), *InNode.Role.SchemaVersion);
+			return false;
+		}
+		if (!CanonicalPrimaryRoles.Contains(InNode.Role.Primary))
+		{
+			OutFailureReason = FString::Printf(TEXT("primary=%s"), *InNode.Role.Primary);
+			return false;
+		}
+		const FString ExpectedFamily = ResolveExpectedGraphNodeRoleFamily(InNode.Role.Primary);
+		if (InNode.Role.Family != ExpectedFamily)
+		{
+			OutFailureReason = FString::Printf(TEXT("family=%s expected=%s"), *InNode.Role.Family, *ExpectedFamily);
+			return false;
+		}
+		if (!CanonicalSources.Contains(InNode.Role.Source) || !CanonicalConfidence.Contains(InNode.Role.Confidence))
+		{
+			OutFailureReason = FString::Printf(TEXT("source=%s confidence=%s"), *InNode.Role.Source, *InNode.Role.Confidence);
+			return false;
+		}
+
+		bool bHasExecInput = false;
+		bool bHasExecOutput = false;
+		for (const FADumpGraphPin& Pin : InNode.Pins)
+		{
+			if (!Pin.bIsExec)
+			{
+				continue;
+			}
+			bHasExecInput |= Pin.Direction == TEXT("input");
+			bHasExecOutput |= Pin.Direction == TEXT("output");
+		}
+		if (InNode.Role.bHasExecInput != bHasExecInput || InNode.Role.bHasExecOutput != bHasExecOutput)
+		{
+			OutFailureReason = TEXT("exec_pin_trait_mismatch");
+			return false;
+		}
+		if (InNode.Role.bIsPure && (bHasExecInput || bHasExecOutput))
+		{
+			OutFailureReason = TEXT("pure_node_has_exec_pin");
+			return false;
+		}
+
+		TSet<FString> UniqueTags;
+		int32 PreviousTagRank = INDEX_NONE;
+		for (const FString& Tag : InNode.Role.Tags)
+		{
+			const int32 TagRank = GetGraphNodeRoleTagRank(Tag);
+			if (TagRank == INDEX_NONE || UniqueTags.Contains(Tag) || (PreviousTagRank != INDEX_NONE && TagRank <= PreviousTagRank))
+			{
+				OutFailureReason = FString::Printf(TEXT("invalid_tag=%s"), *Tag);
+				return false;
+			}
+			UniqueTags.Add(Tag);
+			PreviousTagRank = TagRank;
+		}
+		if (!InNode.Role.Tags.Contains(InNode.Role.bIsPure ? TEXT("pure") : TEXT("impure")))
+		{
+			OutFailureReason = TEXT("purity_tag_missing");
+			return false;
+		}
+
+		FString LegacySemantic;
+		if (InNode.Extra.IsValid() && InNode.Extra->TryGetStringField(TEXT("node_semantic"), LegacySemantic) && !LegacySemantic.IsEmpty() && LegacySemantic != InNode.Role.Primary)
+		{
+			OutFailureReason = FString::Printf(TEXT("legacy_semantic=%s role=%s"), *LegacySemantic, *InNode.Role.Primary);
+			return false;
+		}
+
+		return true;
+	}
+
+	// VerifyGraphNodeRoleClassifierRegistry는 exact semantic 11종과 structural fallback 4종을 공용 trait classifier로 검증한다.
+	bool VerifyGraphNodeRoleClassifierRegistry(FString& OutDetailText)
+	{
+		struct FRoleClassifierCase
+		{
+			FString Name;
+			FString Semantic;
+			bool bHasExecInput = false;
+			bool bHasExecOutput = false;
+			int32 ExecOutputCount = 0;
+			bool bPurityResolved = false;
+			bool bMetadataIsPure = false;
+			bool bIsLatent = false;
+			FString ExpectedPrimary;
+			FString ExpectedFamily;
+			FString ExpectedSource;
+			FString ExpectedConfidence;
+			FString RequiredTagA;
+			FString RequiredTagB;
+		};
+
+		const TArray<FRoleClassifierCase> Cases = {
+			{ TEXT("event"), TEXT("event"), false, true, 1, false, false, false, TEXT("event"), TEXT("entry"), TEXT("exact_class"), TEXT("exact"), TEXT("has_exec_output"), FString() },
+			{ TEXT("function_call"), TEXT("function_call"), false, false, 0, true, true, false, TEXT("function_call"), TEXT("call"), TEXT("function_metadata"), TEXT("exact"), TEXT("pure"), FString() },
+			{ TEXT("interface_call"), TEXT("interface_call"), true, true, 1, true, false, false, TEXT("interface_call"), TEXT("call"), TEXT("function_metadata"), TEXT("exact"), TEXT("interface"), FString() },
+			{ TEXT("variable_get"), TEXT("variable_get"), false, false, 0, false, false, false, TEXT("variable_get"), TEXT("variable"), TEXT("exact_class"), TEXT("exact"), TEXT("member_access"), TEXT("pure") },
+			{ TEXT("variable_set"), TEXT("variable_set"), true, true, 1, false, false, false, TEXT("variable_set"), TEXT("variable"), TEXT("exact_class"), TEXT("exact"), TEXT("member_access"), TEXT("impure") },
+			{ TEXT("dynamic_cast"), TEXT("dynamic_cast"), true, true, 2, false, false, false, TEXT("dynamic_cast"), TEXT("conversion"), TEXT("exact_class"), TEXT("exact"), TEXT("multi_output"), FString() },
+			{ TEXT("branch"), TEXT("branch"), true, true, 2, false, false, false, TEXT("branch"), TEXT("control_flow"), TEXT("exact_class"), TEXT("exact"), TEXT("conditional"), TEXT("multi_output") },
+			{ TEXT("sequence"), TEXT("sequence"), true, true, 3, false, false, false, TEXT("sequence"), TEXT("control_flow"), TEXT("exact_class"), TEXT("exact"), TEXT("multi_output"), FString() },
+			{ TEXT("select"), TEXT("select"), false, false, 0, false, false, false, TEXT("select"), TEXT("data_flow"), TEXT("exact_class"), TEXT("exact"), TEXT("conditional"), TEXT("pure") },
+			{ TEXT("switch"), TEXT("switch"), true, true, 3, false, false, false, TEXT("switch"), TEXT("control_flow"), TEXT("exact_class"), TEXT("exact"), TEXT("conditional"), TEXT("multi_output") },
+			{ TEXT("timeline"), TEXT("timeline"), true, true, 2, false, false, false, TEXT("timeline"), TEXT("timing"), TEXT("exact_class"), TEXT("exact"), TEXT("latent"), TEXT("multi_output") },
+			{ TEXT("pure_expression"), FString(), false, false, 0, false, false, false, TEXT("pure_expression"), TEXT("data_flow"), TEXT("structural_inference"), TEXT("inferred"), TEXT("pure"), FString() },
+			{ TEXT("execution_entry"), FString(), false, true, 1, false, false, false, TEXT("execution_entry"), TEXT("entry"), TEXT("structural_inference"), TEXT("inferred"), TEXT("has_exec_output"), FString() },
+			{ TEXT("execution_sink"), FString(), true, false, 0, false, false, false, TEXT("execution_sink"), TEXT("operation"), TEXT("structural_inference"), TEXT("inferred"), TEXT("has_exec_input"), FString() },
+			{ TEXT("flow_control"), FString(), true, true, 1, false, false, false, TEXT("flow_control"), TEXT("control_flow"), TEXT("structural_inference"), TEXT("inferred"), TEXT("has_exec_input"), TEXT("has_exec_output") }
+		};
+
+		int32 PassedCount = 0;
+		for (const FRoleClassifierCase& TestCase : Cases)
+		{
+			FADumpGraphNode SyntheticNode;
+			SyntheticNode.NodeClass = TestCase.Name;
+			SyntheticNode.Role = ADumpGraphExt::BuildGraphNodeRoleFromTraits(
+				TestCase.Semantic,
+				TestCase.bHasExecInput,
+				TestCase.bHasExecOutput,
+				TestCase.ExecOutputCount,
+				TestCase.bPurityResolved,
+				TestCase.bMetadataIsPure,
+				TestCase.bIsLatent);
+
+			if (!TestCase.Semantic.IsEmpty())
+			{
+				SyntheticNode.Extra = MakeShared<FJsonObject>();
+				SyntheticNode.Extra->SetStringField(TEXT("node_semantic"), TestCase.Semantic);
+			}
+			if (TestCase.bHasExecInput)
+			{
+				FADumpGraphPin InputPin;
+				InputPin.Direction = TEXT("input");
+				InputPin.bIsExec = true;
+				SyntheticNode.Pins.Add(InputPin);
+			}
+			for (int32 OutputIndex = 0; OutputIndex < TestCase.ExecOutputCount; ++OutputIndex)
+			{
+				FADumpGraphPin OutputPin;
+				OutputPin.Direction = TEXT("output");
+				OutputPin.bIsExec = true;
+				SyntheticNode.Pins.Add(OutputPin);
+			}
+
+			FString ContractFailure;
+			const bool bRoleMatches = SyntheticNode.Role.Primary == TestCase.ExpectedPrimary
+				&& SyntheticNode.Role.Family == TestCase.ExpectedFamily
+				&& SyntheticNode.Role.Source == TestCase.ExpectedSource
+				&& SyntheticNode.Role.Confidence == TestCase.ExpectedConfidence
+				&& (TestCase.RequiredTagA.IsEmpty() || SyntheticNode.Role.Tags.Contains(TestCase.RequiredTagA))
+				&& (TestCase.RequiredTagB.IsEmpty() || SyntheticNode.Role.Tags.Contains(TestCase.RequiredTagB))
+				&& TestGraphNodeRoleContract(SyntheticNode, ContractFailure);
+			if (!bRoleMatches)
+			{
+				OutDetailText = FString::Printf(
+					TEXT("failed=%s primary=%s family=%s source=%s confidence=%s contract=%s"),
+					*TestCase.Name,
+					*SyntheticNode.Role.Primary,
+					*SyntheticNode.Role.Family,
+					*SyntheticNode.Role.Source,
+					*SyntheticNode.Role.Confidence,
+					*ContractFailure);
+				return false;
+			}
+			++PassedCount;
+		}
+
+		OutDetailText = FString::Printf(TEXT("passed=%d total=%d"), PassedCount, Cases.Num());
+		return PassedCount == Cases.Num();
+	}
+
+	// TestExecutionPathPreviewContract는 graph preview count, path, step, link와 termination 무결성을 검사한다.
+	bool TestExecutionPathPreviewContract(const FADumpGraph& InGraph, FString& OutFailureReason)
+	{
+		OutFailureReason.Reset();
+		const FADumpExecutionPathPreview& Preview = InGraph.ExecutionPreview;
+		if (Preview.SchemaVersion != TEXT("execution_path_preview_v1"))
+		{
+			OutFailureReason = FString::Printf(TEXT("schema=%s"), *Preview.SchemaVersion);
+			return false;
+		}
+		if (!Preview.bSupported)
+		{
+			const bool bReasonValid = Preview.UnsupportedReason == TEXT("links_only") || Preview.UnsupportedReason == TEXT("exec_links_not_requested");
+			const bool bCountsEmpty = Preview.EntryCount == 0 && Preview.PathCount == 0 && Preview.Paths.Num() == 0
+				&& Preview.TerminalPathCount == 0 && Preview.CyclePathCount == 0 && Preview.DepthLimitedPathCount == 0;
+			if (!bReasonValid || !bCountsEmpty)
+			{
+				OutFailureReason = FString::Printf(TEXT("unsupported_reason=%s path_count=%d"), *Preview.UnsupportedReason, Preview.PathCount);
+				return false;
+			}
+			return true;
+		}
+		if (!Preview.UnsupportedReason.IsEmpty() || Preview.MaxPaths <= 0 || Preview.MaxDepth <= 0)
+		{
+			OutFailureReason = TEXT("supported_header_invalid");
+			return false;
+		}
+
+		TMap<FString, const FADumpGraphNode*> NodeById;
+		int32 ExpectedEntryCount = 0;
+		for (const FADumpGraphNode& Node : InGraph.Nodes)
+		{
+			NodeById.Add(Node.NodeId, &Node);
+			if (Node.Role.Primary == TEXT("event") || Node.Role.Primary == TEXT("execution_entry") || (!Node.Role.bHasExecInput && Node.Role.bHasExecOutput))
+			{
+				++ExpectedEntryCount;
+			}
+		}
+		if (Preview.EntryCount != ExpectedEntryCount || Preview.PathCount != Preview.Paths.Num())
+		{
+			OutFailureReason = FString::Printf(TEXT("entry=%d/%d paths=%d/%d"), Preview.EntryCount, ExpectedEntryCount, Preview.PathCount, Preview.Paths.Num());
+			return false;
+		}
+
+		auto HasOutgoingExecLink = [&InGraph](const FString& InNodeId)
+		{
+			for (const FADumpGraphLink& Link : InGraph.Links)
+			{
+				if (Link.LinkKind == EADumpLinkKind::Exec && Link.FromNodeId == InNodeId) return true;
+			}
+			return false;
+		};
+
+		int32 TerminalCount = 0;
+		int32 CycleCount = 0;
+		int32 DepthCount = 0;
+		int32 ObservedMaxDepth = 0;
+		TSet<FString> UniquePathIds;
+		for (int32 PathIndex = 0; PathIndex < Preview.Paths.Num(); ++PathIndex)
+		{
+			const FADumpExecutionPath& Path = Preview.Paths[PathIndex];
+			const FString ExpectedPathId = FString::Printf(TEXT("path_%03d"), PathIndex);
+			if (Path.PathId != ExpectedPathId || UniquePathIds.Contains(Path.PathId) || Path.StepCount != Path.Steps.Num() || Path.Steps.Num() <= 0)
+			{
+				OutFailureReason = FString::Printf(TEXT("path_header=%s"), *Path.PathId);
+				return false;
+			}
+			UniquePathIds.Add(Path.PathId);
+			if (Path.EntryNodeId != Path.Steps[0].NodeId || Path.TerminalNodeId != Path.Steps.Last().NodeId)
+			{
+				OutFailureReason = FString::Printf(TEXT("path_endpoints=%s"), *Path.PathId);
+				return false;
+			}
+
+			const FADumpGraphNode* EntryNode = NodeById.FindRef(Path.EntryNodeId);
+			if (!EntryNode || !(EntryNode->Role.Primary == TEXT("event") || EntryNode->Role.Primary == TEXT("execution_entry") || (!EntryNode->Role.bHasExecInput && EntryNode->Role.bHasExecOutput)))
+			{
+				OutFailureReason = FString::Printf(TEXT("invalid_entry=%s"), *Path.EntryNodeId);
+				return false;
+			}
+
+			for (int32 StepIndex = 0; StepIndex < Path.Steps.Num(); ++StepIndex)
+			{
+				const FADumpExecutionPathStep& Step = Path.Steps[StepIndex];
+				const FADumpGraphNode* Node = NodeById.FindRef(Step.NodeId);
+				if (!Node || Step.Depth != StepIndex || Step.PrimaryRole != Node->Role.Primary)
+				{
+					OutFailureReason = FString::Printf(TEXT("step=%s:%d"), *Path.PathId, StepIndex);
+					return false;
+				}
+				ObservedMaxDepth = FMath::Max(ObservedMaxDepth, Step.Depth);
+				if (StepIndex == 0)
+				{
+					if (!Step.ViaPinId.IsEmpty() || !Step.ViaPinName.IsEmpty())
+					{
+						OutFailureReason = FString::Printf(TEXT("entry_via_pin=%s"), *Path.PathId);
+						return false;
+					}
+					continue;
+				}
+
+				const FADumpExecutionPathStep& PreviousStep = Path.Steps[StepIndex - 1];
+				const FADumpGraphNode* PreviousNode = NodeById.FindRef(PreviousStep.NodeId);
+				bool bPinMatched = false;
+				if (PreviousNode)
+				{
+					for (const FADumpGraphPin& Pin : PreviousNode->Pins)
+					{
+						if (Pin.PinId == Step.ViaPinId && Pin.PinName == Step.ViaPinName && Pin.bIsExec && Pin.Direction == TEXT("output"))
+						{
+							bPinMatched = true;
+							break;
+						}
+					}
+				}
+				bool bLinkMatched = false;
+				for (const FADumpGraphLink& Link : InGraph.Links)
+				{
+					if (Link.LinkKind == EADumpLinkKind::Exec && Link.FromNodeId == PreviousStep.NodeId
+						&& Link.FromPinId == Step.ViaPinId && Link.ToNodeId == Step.NodeId)
+					{
+						bLinkMatched = true;
+						break;
+					}
+				}
+				if (!bPinMatched || !bLinkMatched)
+				{
+					OutFailureReason = FString::Printf(TEXT("step_link=%s:%d"), *Path.PathId, StepIndex);
+					return false;
+				}
+			}
+
+			if (Path.Termination == TEXT("terminal"))
+			{
+				++TerminalCount;
+				if (HasOutgoingExecLink(Path.TerminalNodeId))
+				{
+					OutFailureReason = FString::Printf(TEXT("terminal_has_output=%s"), *Path.PathId);
+					return false;
+				}
+			}
+			else if (Path.Termination == TEXT("cycle"))
+			{
+				++CycleCount;
+				bool bRepeated = false;
+				for (int32 EarlierIndex = 0; EarlierIndex < Path.Steps.Num() - 1; ++EarlierIndex)
+				{
+					bRepeated |= Path.Steps[EarlierIndex].NodeId == Path.TerminalNodeId;
+				}
+				if (!bRepeated)
+				{
+					OutFailureReason = FString::Printf(TEXT("cycle_not_repeated=%s"), *Path.PathId);
+					return false;
+				}
+			}
+			else if (Path.Termination == TEXT("depth_limit"))
+			{
+				++DepthCount;
+				if (Path.Steps.Last().Depth != Preview.MaxDepth || !HasOutgoingExecLink(Path.TerminalNodeId))
+				{
+					OutFailureReason = FString::Printf(TEXT("depth_limit=%s"), *Path.PathId);
+					return false;
+				}
+			}
+			else
+			{
+				OutFailureReason = FString::Printf(TEXT("termination=%s"), *Path.Termination);
+				return false;
+			}
+		}
+
+		if (Preview.TerminalPathCount != TerminalCount || Preview.CyclePathCount != CycleCount || Preview.DepthLimitedPathCount != DepthCount
+			|| Preview.ObservedMaxDepth != ObservedMaxDepth || Preview.bTruncated != (DepthCount > 0 || Preview.OmittedPathCount > 0))
+		{
+			OutFailureReason = TEXT("summary_count_mismatch");
+			return false;
+		}
+		if ((CycleCount > 0) != Preview.Warnings.Contains(TEXT("cycle_detected"))
+			|| (DepthCount > 0) != Preview.Warnings.Contains(TEXT("depth_limit_reached"))
+			|| (Preview.OmittedPathCount > 0) != Preview.Warnings.Contains(TEXT("path_limit_reached")))
+		{
+			OutFailureReason = TEXT("warning_mismatch");
+			return false;
+		}
+		if (ExpectedEntryCount == 0 && InGraph.Nodes.Num() > 0 && !Preview.Warnings.Contains(TEXT("no_entry_nodes")))
+		{
+			OutFailureReason = TEXT("no_entry_warning_missing");
+			return false;
+		}
+		return true;
+	}
+
+	// MakeExecutionPreviewTestNode는 production preview registry용 synthetic node를 만든다.
+	FADumpGraphNode MakeExecutionPreviewTestNode(
+		const FString& InNodeId,
+		const FString& InPrimaryRole,
+		bool bInHasExecInput,
+		const TArray<FString>& InOutputPinNames)
+	{
+		FADumpGraphNode Node;
+		Node.NodeId = InNodeId;
+		Node.NodeClass = InPrimaryRole;
+		Node.Role.Primary = InPrimaryRole;
+		Node.Role.bHasExecInput = bInHasExecInput;
+		Node.Role.bHasExecOutput = InOutputPinNames.Num() > 0;
+		if (bInHasExecInput)
+		{
+			FADumpGraphPin InputPin;
+			InputPin.PinId = InNodeId + TEXT("_in");
+			InputPin.PinName = TEXT("execute");
+			InputPin.Direction = TEXT("input");
+			InputPin.bIsExec = true;
+			Node.Pins.Add(MoveTemp(InputPin));
+		}
+		for (int32 OutputIndex = 0; OutputIndex < InOutputPinNames.Num(); ++OutputIndex)
+		{
+			FADumpGraphPin OutputPin;
+			OutputPin.PinId = FString::Printf(TEXT("%s_out_%02d"), *InNodeId, OutputIndex);
+			OutputPin.PinName = InOutputPinNames[OutputIndex];
+			OutputPin.Direction = TEXT("output");
+			OutputPin.bIsExec = true;
+			Node.Pins.Add(MoveTemp(OutputPin));
+		}
+		return Node;
+	}
+
+	// AddExecutionPreviewTestLink는 synthetic graph에 deterministic exec/data link를 추가한다.
+	void AddExecutionPreviewTestLink(FADumpGraph& InOutGraph, const FString& InFromNodeId, int32 InOutputIndex, const FString& InToNodeId, EADumpLinkKind InLinkKind = EADumpLinkKind::Exec)
+	{
+		FADumpGraphLink Link;
+		Link.FromNodeId = InFromNodeId;
+		Link.FromPinId = FString::Printf(TEXT("%s_out_%02d"), *InFromNodeId, InOutputIndex);
+		Link.ToNodeId = InToNodeId;
+		Link.ToPinId = InToNodeId + TEXT("_in");
+		Link.LinkKind = InLinkKind;
+		InOutGraph.Links.Add(MoveTemp(Link));
+	}
+
+	// VerifyExecutionPathPreviewRegistry는 production builder로 13개 bounded traversal 계약을 검증한다.
+	bool VerifyExecutionPathPreviewRegistry(FString& OutDetailText)
+	{
+		int32 PassedCount = 0;
+		auto Require = [&OutDetailText, &PassedCount](bool bCondition, const FString& InCaseName, const FString& InDetail)
+		{
+			if (!bCondition)
+			{
+				OutDetailText = FString::Printf(TEXT("failed=%s detail=%s"), *InCaseName, *InDetail);
+				return false;
+			}
+			++PassedCount;
+			return true;
+		};
 
-		FParse::Bool(*InCommandLine, TEXT("IncludeSummary="), OutDumpRunOpts.bIncludeSummary);
-		FParse::Bool(*InCommandLine, TEXT("IncludeDetails="), OutDumpRunOpts.bIncludeDetails);
-		FParse::Bool(*InCommandLine, TEXT("IncludeGraphs="), OutDumpRunOpts.bIncludeGraphs);
-		FParse::Bool(*InCommandLine, TEXT("IncludeReferences="), OutDumpRunOpts.bIncludeReferences);
-		FParse::Bool(*InCommandLine, TEXT("CompileBeforeDump="), OutDumpRunOpts.bCompileBeforeDump);
-		FParse::Bool(*InCommandLine, TEXT("SkipIfUpToDate="), OutDumpRunOpts.bSkipIfUpToDate);
-		FParse::Bool(*InCommandLine, TEXT("LinksOnly="), OutDumpRunOpts.bLinksOnly);
-		FParse::Value(*InCommandLine, TEXT("GraphName="), OutDumpRunOpts.GraphNameFilter);
-		FParse::Value(*InCommandLine, TEXT("DataAssetDiffBase="), OutDumpRunOpts.DataAssetDiffBasePath);
+		{
+			FADumpGraph Graph;
+			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
+			if (!Require(Preview.bSupported && Preview.EntryCount == 0 && Preview.PathCount == 0 && Preview.Warnings.Num() == 0, TEXT("empty_graph"), TEXT("non_empty_result"))) return false;
+		}
+		{
+			FADumpGraph Graph;
+			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, false, true);
+			if (!Require(!Preview.bSupported && Preview.UnsupportedReason == TEXT("links_only") && Preview.Paths.Num() == 0, TEXT("links_only"), Preview.UnsupportedReason)) return false;
+		}
+		{
+			FADumpGraph Graph;
+			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, false);
+			if (!Require(!Preview.bSupported && Preview.UnsupportedReason == TEXT("exec_links_not_requested") && Preview.Paths.Num() == 0, TEXT("data_only_selection"), Preview.UnsupportedReason)) return false;
+		}
+		{
+			FADumpGraph Graph;
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("then") }));
+			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
+			if (!Require(Preview.PathCount == 1 && Preview.Paths[0].Termination == TEXT("terminal") && Preview.Paths[0].StepCount == 1, TEXT("single_terminal_entry"), TEXT("path_mismatch"))) return false;
+		}
+		{
+			FADumpGraph Graph;
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("then") }));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("O"), TEXT("flow_control"), true, { TEXT("then") }));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("T"), TEXT("execution_sink"), true, {}));
+			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("O"));
+			AddExecutionPreviewTestLink(Graph, TEXT("O"), 0, TEXT("T"));
+			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
+			const bool bPassed = Preview.PathCount == 1 && Preview.Paths[0].StepCount == 3 && Preview.Paths[0].Steps[1].NodeId == TEXT("O") && Preview.Paths[0].TerminalNodeId == TEXT("T");
+			if (!Require(bPassed, TEXT("linear"), TEXT("path_mismatch"))) return false;
+		}
+		{
+			FADumpGraph Graph;
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("first"), TEXT("second") }));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("A"), TEXT("execution_sink"), true, {}));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("B"), TEXT("execution_sink"), true, {}));
+			AddExecutionPreviewTestLink(Graph, TEXT("E"), 1, TEXT("B"));
+			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("A"));
+			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
+			const bool bPassed = Preview.PathCount == 2 && Preview.Paths[0].Steps[1].ViaPinName == TEXT("first") && Preview.Paths[1].Steps[1].ViaPinName == TEXT("second");
+			if (!Require(bPassed, TEXT("branch_order"), TEXT("pin_order_mismatch"))) return false;
+		}
+		{
+			FADumpGraph Graph;
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("a"), TEXT("b") }));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("A"), TEXT("flow_control"), true, { TEXT("then") }));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("B"), TEXT("flow_control"), true, { TEXT("then") }));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("M"), TEXT("execution_sink"), true, {}));
+			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("A"));
+			AddExecutionPreviewTestLink(Graph, TEXT("E"), 1, TEXT("B"));
+			AddExecutionPreviewTestLink(Graph, TEXT("A"), 0, TEXT("M"));
+			AddExecutionPreviewTestLink(Graph, TEXT("B"), 0, TEXT("M"));
+			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
+			const bool bPassed = Preview.PathCount == 2 && Preview.Paths[0].TerminalNodeId == TEXT("M") && Preview.Paths[1].TerminalNodeId == TEXT("M");
+			if (!Require(bPassed, TEXT("merge"), TEXT("merge_mismatch"))) return false;
+		}
+		{
+			FADumpGraph Graph;
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), true, { TEXT("loop") }));
+			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("E"));
+			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
+			if (!Require(Preview.PathCount == 1 && Preview.CyclePathCount == 1 && Preview.Paths[0].StepCount == 2, TEXT("self_cycle"), TEXT("cycle_mismatch"))) return false;
+		}
+		{
+			FADumpGraph Graph;
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("then") }));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("A"), TEXT("flow_control"), true, { TEXT("then") }));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("B"), TEXT("flow_control"), true, { TEXT("then") }));
+			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("A"));
+			AddExecutionPreviewTestLink(Graph, TEXT("A"), 0, TEXT("B"));
+			AddExecutionPreviewTestLink(Graph, TEXT("B"), 0, TEXT("A"));
+			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
+			if (!Require(Preview.PathCount == 1 && Preview.CyclePathCount == 1 && Preview.Paths[0].TerminalNodeId == TEXT("A"), TEXT("multi_cycle"), TEXT("cycle_mismatch"))) return false;
+		}
+		{
+			FADumpGraph Graph;
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("then") }));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("A"), TEXT("flow_control"), true, { TEXT("then") }));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("B"), TEXT("flow_control"), true, { TEXT("then") }));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("C"), TEXT("execution_sink"), true, {}));
+			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("A"));
+			AddExecutionPreviewTestLink(Graph, TEXT("A"), 0, TEXT("B"));
+			AddExecutionPreviewTestLink(Graph, TEXT("B"), 0, TEXT("C"));
+			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true, 64, 2);
+			if (!Require(Preview.PathCount == 1 && Preview.DepthLimitedPathCount == 1 && Preview.Paths[0].TerminalNodeId == TEXT("B") && Preview.bTruncated, TEXT("depth_limit"), TEXT("depth_mismatch"))) return false;
+		}
+		{
+			FADumpGraph Graph;
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("one"), TEXT("two"), TEXT("three") }));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("A"), TEXT("execution_sink"), true, {}));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("B"), TEXT("execution_sink"), true, {}));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("C"), TEXT("execution_sink"), true, {}));
+			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("A"));
+			AddExecutionPreviewTestLink(Graph, TEXT("E"), 1, TEXT("B"));
+			AddExecutionPreviewTestLink(Graph, TEXT("E"), 2, TEXT("C"));
+			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true, 2, 32);
+			if (!Require(Preview.PathCount == 2 && Preview.OmittedPathCount == 1 && Preview.bTruncated && Preview.Warnings.Contains(TEXT("path_limit_reached")), TEXT("path_limit"), TEXT("limit_mismatch"))) return false;
+		}
+		{
+			FADumpGraph Graph;
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("A"), TEXT("flow_control"), true, { TEXT("then") }));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("B"), TEXT("flow_control"), true, { TEXT("then") }));
+			AddExecutionPreviewTestLink(Graph, TEXT("A"), 0, TEXT("B"));
+			AddExecutionPreviewTestLink(Graph, TEXT("B"), 0, TEXT("A"));
+			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
+			if (!Require(Preview.EntryCount == 0 && Preview.PathCount == 0 && Preview.Warnings.Contains(TEXT("no_entry_nodes")), TEXT("no_entry"), TEXT("warning_missing"))) return false;
+		}
+		{
+			FADumpGraph Graph;
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("then") }));
+			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("D"), TEXT("execution_sink"), true, {}));
+			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("D"), EADumpLinkKind::Data);
+			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
+			if (!Require(Preview.PathCount == 1 && Preview.Paths[0].Termination == TEXT("terminal") && Preview.Paths[0].TerminalNodeId == TEXT("E"), TEXT("data_link_exclusion"), TEXT("data_link_traversed"))) return false;
+		}
 
-		// LinkKindText는 링크 필터 문자열 입력값이다.
-		FString LinkKindText;
-		FParse::Value(*InCommandLine, TEXT("LinkKind="), LinkKindText);
-		if (LinkKindText.Equals(TEXT("exec"), ESearchCase::IgnoreCase))
+		OutDetailText = FString::Printf(TEXT("passed=%d total=13"), PassedCount);
+		return PassedCount == 13;
+	}
+
+	// ResolveBPSearchKindCount는 index summary에서 kind별 count를 반환한다.
+	int32 ResolveBPSearchKindCount(const FADumpBPSearchIndex& InIndex, const FString& InKind)
+	{
+		if (InKind == TEXT("graph")) return InIndex.GraphSymbolCount;
+		if (InKind == TEXT("event")) return InIndex.EventSymbolCount;
+		if (InKind == TEXT("function_call")) return InIndex.FunctionCallSymbolCount;
+		if (InKind == TEXT("interface_call")) return InIndex.InterfaceCallSymbolCount;
+		if (InKind == TEXT("variable_read")) return InIndex.VariableReadSymbolCount;
+		if (InKind == TEXT("variable_write")) return InIndex.VariableWriteSymbolCount;
+		if (InKind == TEXT("class_reference")) return InIndex.ClassReferenceSymbolCount;
+		return INDEX_NONE;
+	}
+
+	// TestBPSearchIndexContract는 schema/count/order/source와 term 계약을 검사한다.
+	bool TestBPSearchIndexContract(const FADumpResult& InResult, FString& OutFailureReason)
+	{
+		OutFailureReason.Reset();
+		const FADumpBPSearchIndex& Index = InResult.BPSearchIndex;
+		if (Index.SchemaVersion != TEXT("bp_search_index_v1") || !Index.bSupported || !Index.UnsupportedReason.IsEmpty())
 		{
-			OutDumpRunOpts.LinkKind = EADumpLinkKind::Exec;
+			OutFailureReason = FString::Printf(TEXT("header=%s supported=%d reason=%s"), *Index.SchemaVersion, Index.bSupported ? 1 : 0, *Index.UnsupportedReason);
+			return false;
 		}
-		else if (LinkKindText.Equals(TEXT("data"), ESearchCase::IgnoreCase))
+		if (Index.MaxSymbols != 512 || Index.SymbolCount != Index.Symbols.Num() || Index.SymbolCount > Index.MaxSymbols
+			|| Index.bTruncated != (Index.OmittedSymbolCount > 0))
 		{
-			OutDumpRunOpts.LinkKind = EADumpLinkKind::Data;
+			OutFailureReason = TEXT("summary_count_mismatch");
+			return false;
 		}
-		else
+
+		TMap<FString, int32> ActualKindCounts;
+		TSet<FString> ClassPaths;
+		TSet<FString> SymbolIds;
+		TMap<FString, const FADumpGraph*> GraphByName;
+		for (const FADumpGraph& Graph : InResult.Graphs)
 		{
-			OutDumpRunOpts.LinkKind = EADumpLinkKind::All;
+			GraphByName.Add(Graph.GraphName, &Graph);
+		}
+
+		for (int32 SymbolIndex = 0; SymbolIndex < Index.Symbols.Num(); ++SymbolIndex)
+		{
+			const FADumpBPSearchSymbol& Symbol = Index.Symbols[SymbolIndex];
+			const FString ExpectedId = FString::Printf(TEXT("symbol_%03d"), SymbolIndex);
+			if (Symbol.SymbolId != ExpectedId || SymbolIds.Contains(Symbol.SymbolId))
+			{
+				OutFailureReason = FString::Printf(TEXT("symbol_id=%s expected=%s"), *Symbol.SymbolId, *ExpectedId);
+				return false;
+			}
+			SymbolIds.Add(Symbol.SymbolId);
+			if (Symbol.Name.IsEmpty() || Symbol.NormalizedName != ADumpBPSearchIndex::NormalizeSearchName(Symbol.Name)
+				|| Symbol.SearchTerms.IsEmpty() || Symbol.SearchTerms.Num() > 8)
+			{
+				OutFailureReason = FString::Printf(TEXT("symbol_shape=%s"), *Symbol.SymbolId);
+				return false;
+			}
+			TSet<FString> UniqueTerms;
+			for (const FString& Term : Symbol.SearchTerms)
+			{
+				const FString Key = Term.ToLower();
+				if (Term.IsEmpty() || UniqueTerms.Contains(Key))
+				{
+					OutFailureReason = FString::Printf(TEXT("term=%s symbol=%s"), *Term, *Symbol.SymbolId);
+					return false;
+				}
+				UniqueTerms.Add(Key);
+			}
+			ActualKindCounts.FindOrAdd(Symbol.Kind)++;
+
+			if (Symbol.Kind == TEXT("graph"))
+			{
+				if (!GraphByName.Contains(Symbol.GraphName) || !Symbol.NodeId.IsEmpty())
+				{
+					OutFailureReason = FString::Printf(TEXT("graph_symbol=%s"), *Symbol.SymbolId);
+					return false;
+				}
+			}
+			else if (Symbol.Kind == TEXT("class_reference"))
+			{
+				if (Symbol.MemberParent.IsEmpty() || ClassPaths.Contains(Symbol.MemberParent))
+				{
+					OutFailureReason = FString::Printf(TEXT("class_symbol=%s"), *Symbol.SymbolId);
+					return false;
+				}
+				ClassPaths.Add(Symbol.MemberParent);
+			}
+			else
+			{
+				const FADumpGraph* const* GraphPtr = GraphByName.Find(Symbol.GraphName);
+				if (!GraphPtr || !*GraphPtr)
+				{
+					OutFailureReason = FString::Printf(TEXT("node_graph=%s"), *Symbol.SymbolId);
+					return false;
+				}
+				const FADumpGraphNode* Node = (*GraphPtr)->Nodes.FindByPredicate([&Symbol](const FADumpGraphNode& Item){ return Item.NodeId == Symbol.NodeId; });
+				if (!Node)
+				{
+					OutFailureReason = FString::Printf(TEXT("node_missing=%s"), *Symbol.SymbolId);
+					return false;
+				}
+				FString ExpectedKind;
+				if (Node->Role.Primary == TEXT("event")) ExpectedKind = TEXT("event");
+				else if (Node->Role.Primary == TEXT("function_call")) ExpectedKind = TEXT("function_call");
+				else if (Node->Role.Primary == TEXT("interface_call")) ExpectedKind = TEXT("interface_call");
+				else if (Node->Role.Primary == TEXT("variable_get")) ExpectedKind = TEXT("variable_read");
+				else if (Node->Role.Primary == TEXT("variable_set")) ExpectedKind = TEXT("variable_write");
+				if (ExpectedKind != Symbol.Kind || Symbol.PrimaryRole != Node->Role.Primary)
+				{
+					OutFailureReason = FString::Printf(TEXT("node_kind=%s expected=%s"), *Symbol.Kind, *ExpectedKind);
+					return false;
+				}
+			}
 		}
 
-		// LinksMetaText는 links_only 메타 수준 문자열 입력값이다.
-		FString LinksMetaText;
-		FParse::Value(*InCommandLine, TEXT("LinksMeta="), LinksMetaText);
-		if (LinksMetaText.Equals(TEXT("min"), ESearchCase::IgnoreCase))
-		{
-			OutDumpRunOpts.LinksMeta = EADumpLinksMeta::Min;
-		}
-		else
+		for (const FString Kind : { TEXT("graph"), TEXT("event"), TEXT("function_call"), TEXT("interface_call"), TEXT("variable_read"), TEXT("variable_write"), TEXT("class_reference") })
 		{
-			OutDumpRunOpts.LinksMeta = EADumpLinksMeta::None;
+			if (ResolveBPSearchKindCount(Index, Kind) != ActualKindCounts.FindRef(Kind))
+			{
+				OutFailureReason = FString::Printf(TEXT("kind_count=%s"), *Kind);
+				return false;
+			}
 		}
+		return true;
+	}
 
-		if (!FParse::Param(*InCommandLine, TEXT("UseDefaults")))
-		{
-			OutDumpRunOpts.bIncludeSummary = true;
-		}
+	// MakeBPSearchTestNode는 production search registry용 synthetic graph node를 만든다.
+	FADumpGraphNode MakeBPSearchTestNode(const FString& InId, const FString& InRole, const FString& InMemberName, const FString& InMemberParent)
+	{
+		FADumpGraphNode Node;
+		Node.NodeId = InId;
+		Node.NodeClass = InRole + TEXT("_class");
+		Node.Role.Primary = InRole;
+		Node.MemberName = InMemberName;
+		Node.MemberParent = InMemberParent;
+		return Node;
 	}
 
-	// BuildBatchResultEntryObject는 배치 실행 결과 한 건을 report용 JSON object로 변환한다.
-	TSharedRef<FJsonObject> BuildBatchResultEntryObject(
-		const FAssetData& InAssetData,
-		const FString& InResultStatus,
-		const FString& InOutputFilePath,
-		const FADumpResult& InDumpResult,
-		const FString& InFailureMessage)
+	// VerifyAIContextBundleByteFitBenchmark는 256개 대형 section bundle에서 prefix-sum MaxBytes 절단이 기준 loop와 byte 단위로 같은지와 소요 시간을 검증한다.
+	bool VerifyAIContextBundleByteFitBenchmark(FString& OutDetail)
 	{
-		// CountIssuesBySeverity는 배치 report에서 severity별 issue 개수를 센다.
-		auto CountIssuesBySeverity = [](const TArray<FADumpIssue>& InIssues, EADumpIssueSeverity InSeverity)
+		constexpr int32 BenchmarkSectionCount = 256;
+		constexpr int32 BenchmarkPayloadLength = 2048;
+
+		// BenchmarkGeneratedTime은 wrapper와 payload가 공유하는 고정 generated_time이다.
+		const FString BenchmarkGeneratedTime = TEXT("2026-01-01T00:00:00.000Z");
+		const FString BenchmarkObjectPath = TEXT("/AssetDump/Benchmark/BP_ContextBundle.BP_ContextBundle");
+
+		TArray<TSharedPtr<FJsonValue>> SectionValueArray;
+		SectionValueArray.Reserve(BenchmarkSectionCount);
+		for (int32 SectionIndex = 0; SectionIndex < BenchmarkSectionCount; ++SectionIndex)
 		{
-			// IssueCount는 지정 severity와 일치한 issue 개수 누적값이다.
-			int32 IssueCount = 0;
-			for (const FADumpIssue& IssueItem : InIssues)
+			// PayloadText는 item마다 길이와 비ASCII 비율이 다른 section data다.
+			FString PayloadText;
+			const int32 PayloadLength = BenchmarkPayloadLength + (SectionIndex * 37) % 512;
+			PayloadText.Reserve(PayloadLength);
+			for (int32 CharIndex = 0; CharIndex < PayloadLength; ++CharIndex)
 			{
-				if (IssueItem.Severity == InSeverity)
-				{
-					++IssueCount;
-				}
+				PayloadText.AppendChar((CharIndex + SectionIndex) % 29 == 0 ? TCHAR(0xD55C) : TCHAR(TEXT('a') + (CharIndex + SectionIndex) % 26));
 			}
 
-			return IssueCount;
-		};
+			TSharedRef<FJsonObject> DataObject = MakeShared<FJsonObject>();
+			DataObject->SetNumberField(TEXT("ordinal"), SectionIndex);
+			DataObject->SetStringField(TEXT("text"), PayloadText);
 
-		// ResultEntryObject는 run_report results 배열에 추가할 결과 object다.
-		TSharedRef<FJsonObject> ResultEntryObject = MakeShared<FJsonObject>();
-		ResultEntryObject->SetStringField(TEXT("object_path"), InAssetData.GetObjectPathString());
-		ResultEntryObject->SetStringField(TEXT("asset_name"), InAssetData.AssetName.ToString());
-		ResultEntryObject->SetStringField(TEXT("asset_class"), InAssetData.AssetClassPath.GetAssetName().ToString());
-		ResultEntryObject->SetStringField(TEXT("result_status"), InResultStatus);
-		ResultEntryObject->SetStringField(TEXT("dump_status"), ToString(InDumpResult.DumpStatus));
-		ResultEntryObject->SetStringField(TEXT("asset_family"), InDumpResult.Asset.AssetFamily);
-		ResultEntryObject->SetStringField(TEXT("output_file_path"), InOutputFilePath);
-		ResultEntryObject->SetNumberField(TEXT("warning_count"), CountIssuesBySeverity(InDumpResult.Issues, EADumpIssueSeverity::Warning));
-		ResultEntryObject->SetNumberField(TEXT("error_count"), CountIssuesBySeverity(InDumpResult.Issues, EADumpIssueSeverity::Error));
-		ResultEntryObject->SetStringField(TEXT("failure_message"), InFailureMessage);
-		return ResultEntryObject;
-	}
+			TSharedRef<FJsonObject> SectionObject = MakeShared<FJsonObject>();
+			SectionObject->SetStringField(TEXT("section_name"), FString::Printf(TEXT("section_%03d"), SectionIndex));
+			SectionObject->SetStringField(TEXT("section_schema_version"), TEXT("benchmark_v1"));
+			SectionObject->SetStringField(TEXT("source_file"), TEXT("dump.json"));
+			SectionObject->SetStringField(TEXT("json_pointer"), FString::Printf(TEXT("/benchmark/%d"), SectionIndex));
+			SectionObject->SetStringField(TEXT("storage_kind"), TEXT("inline"));
+			SectionObject->SetObjectField(TEXT("data"), DataObject);
+			SectionValueArray.Add(MakeShared<FJsonValueObject>(SectionObject));
+		}
 
-	// BuildBatchAssetOutputDirectoryPath는 배치 덤프용 자산별 출력 폴더 경로를 만든다.
-	FString BuildBatchAssetOutputDirectoryPath(const FString& InDumpRootPath, const FString& InAssetObjectPath)
-	{
-		// SanitizedAssetKeyText는 폴더명 충돌을 줄이기 위한 자산 경로 기반 안전 키다.
-		FString SanitizedAssetKeyText = InAssetObjectPath;
-		SanitizedAssetKeyText.ReplaceInline(TEXT("."), TEXT("_"));
-		SanitizedAssetKeyText.ReplaceInline(TEXT("/"), TEXT("_"));
-		SanitizedAssetKeyText.ReplaceInline(TEXT("\\"), TEXT("_"));
-		return FPaths::Combine(InDumpRootPath, SanitizedAssetKeyText);
-	}
+		TSharedRef<FJsonObject> AssetObject = MakeShared<FJsonObject>();
+		AssetObject->SetStringField(TEXT("object_path"), BenchmarkObjectPath);
 
-	// ParseCommandletListValue는 쉼표/세미콜론 구분 문자열을 공백 제거 배열로 정리한다.
-	TArray<FString> ParseCommandletListValue(const FString& InValueText)
-	{
-		// NormalizedValueText는 구분자를 통일한 원본 문자열이다.
-		FString NormalizedValueText = InValueText;
-		NormalizedValueText.ReplaceInline(TEXT(";"), TEXT(","));
+		TSharedRef<FJsonObject> PayloadObject = MakeShared<FJsonObject>();
+		PayloadObject->SetStringField(TEXT("schema_version"), TEXT("lazy_section_dump_v1"));
+		PayloadObject->SetStringField(TEXT("source_contract"), TEXT("indexed_stored_evidence"));
+		PayloadObject->SetStringField(TEXT("generated_time"), BenchmarkGeneratedTime);
+		PayloadObject->SetObjectField(TEXT("asset"), AssetObject);
+		PayloadObject->SetNumberField(TEXT("section_count"), SectionValueArray.Num());
+		PayloadObject->SetArrayField(TEXT("sections"), SectionValueArray);
+		PayloadObject->SetBoolField(TEXT("all_resolved"), true);
 
-		// ParsedValueArray는 빈 항목 제거와 trim이 끝난 결과 배열이다.
-		TArray<FString> ParsedValueArray;
-		NormalizedValueText.ParseIntoArray(ParsedValueArray, TEXT(","), true);
-		for (FString& ParsedValueItem : ParsedValueArray)
-		{
-			ParsedValueItem.TrimStartAndEndInline();
+		TSharedRef<FJsonObject> QueryObject = MakeShared<FJsonObject>();
+		QueryObject->SetStringField(TEXT("mode"), TEXT("query"));
+		QueryObject->SetStringField(TEXT("query_kind"), TEXT("section"));
+		QueryObject->SetStringField(TEXT("selector_kind"), TEXT("object_path"));
+		QueryObject->SetStringField(TEXT("root_object_path"), BenchmarkObjectPath);
+		QueryObject->SetStringField(TEXT("result_schema"), TEXT("query_result_v1"));
+
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetStringField(TEXT("native_schema_version"), TEXT("lazy_section_dump_v1"));
+		ResultObject->SetStringField(TEXT("native_source_contract"), TEXT("indexed_stored_evidence"));
+		ResultObject->SetObjectField(TEXT("payload"), PayloadObject);
+
+		TSharedRef<FJsonObject> QueryResultObject = MakeShared<FJsonObject>();
+		QueryResultObject->SetStringField(TEXT("schema_version"), TEXT("query_result_v1"));
+		QueryResultObject->SetStringField(TEXT("generated_time"), BenchmarkGeneratedTime);
+		QueryResultObject->SetStringField(TEXT("status"), TEXT("succeeded"));
+		QueryResultObject->SetObjectField(TEXT("query"), QueryObject);
+		QueryResultObject->SetObjectField(TEXT("result"), ResultObject);
+		QueryResultObject->SetBoolField(TEXT("all_resolved"), true);
+
+		// FullBundleText는 MaxBytes 제한 없이 만든 전체 bundle로, 절단 지점 기준 크기를 정한다.
+		FString FullBundleText;
+		FString ErrorCode;
+		FString ErrorDetail;
+		if (!ADumpReadQuery::BuildAIContextBundleJson(QueryResultObject, BenchmarkSectionCount, MAX_int32, FullBundleText, ErrorCode, ErrorDetail))
+		{
+			OutDetail = FString::Printf(TEXT("full_bundle_failed=%s"), *ErrorCode);
+			return false;
 		}
+		const int32 FullBundleBytes = GetCommandletUtf8ByteLength(FullBundleText);
 
-		ParsedValueArray.RemoveAll([](const FString& ParsedValueItem)
+		// CaseMaxBytesArray는 앞쪽 절단(기준 loop 최악), 중간 절단, 전체 포함, envelope 미만 실패 경계다.
+		const int32 CaseMaxBytesArray[] = { FullBundleBytes / 16, FullBundleBytes / 2, FullBundleBytes, 64 };
+		double LinearSeconds = 0.0;
+		double ReferenceSeconds = 0.0;
+		int32 MatchedCaseCount = 0;
+		for (const int32 CaseMaxBytes : CaseMaxBytesArray)
 		{
-			return ParsedValueItem.IsEmpty();
-		});
-		return ParsedValueArray;
-	}
+			FString LinearText;
+			FString LinearErrorCode;
+			FString LinearErrorDetail;
+			const double LinearStartSeconds = FPlatformTime::Seconds();
+			const bool bLinearBuilt = ADumpReadQuery::BuildAIContextBundleJson(QueryResultObject, BenchmarkSectionCount, CaseMaxBytes, LinearText, LinearErrorCode, LinearErrorDetail);
+			LinearSeconds += FPlatformTime::Seconds() - LinearStartSeconds;
 
-	// DoesAssetMatchClassFilter는 AssetRegistry 자산이 batch ClassFilter 목록과 맞는지 검사한다.
-	bool DoesAssetMatchClassFilter(const FAssetData& InAssetData, const TArray<FString>& InClassFilterArray)
-	{
-		if (InClassFilterArray.Num() == 0)
-		{
-			return true;
-		}
+			FString ReferenceText;
+			FString ReferenceErrorCode;
+			FString ReferenceErrorDetail;
+			const double ReferenceStartSeconds = FPlatformTime::Seconds();
+			const bool bReferenceBuilt = ADumpReadQuery::BuildAIContextBundleJson(QueryResultObject, BenchmarkSectionCount, CaseMaxBytes, ReferenceText, ReferenceErrorCode, ReferenceErrorDetail, true);
+			ReferenceSeconds += FPlatformTime::Seconds() - ReferenceStartSeconds;
 
-		// AssetClassNameText는 현재 자산의 AssetRegistry 클래스 이름이다.
-		const FString AssetClassNameText = InAssetData.AssetClassPath.GetAssetName().ToString();
-		for (const FString& ClassFilterItem : InClassFilterArray)
-		{
-			if (AssetClassNameText.Equals(ClassFilterItem, ESearchCase::IgnoreCase))
+			if (bLinearBuilt == bReferenceBuilt
+				&& LinearText.Equals(ReferenceText, ESearchCase::CaseSensitive)
+				&& LinearErrorCode == ReferenceErrorCode)
 			{
-				return true;
+				++MatchedCaseCount;
 			}
 		}
 
-		return false;
+		OutDetail = FString::Printf(
+			TEXT("sections=%d full_bytes=%d matched_cases=%d/%d linear_ms=%.2f reference_ms=%.2f"),
+			BenchmarkSectionCount,
+			FullBundleBytes,
+			MatchedCaseCount,
+			UE_ARRAY_COUNT(CaseMaxBytesArray),
+			LinearSeconds * 1000.0,
+			ReferenceSeconds * 1000.0);
+		return MatchedCaseCount == UE_ARRAY_COUNT(CaseMaxBytesArray);
 	}
 
-	// AppendBatchDependencyAssets는 현재 배치 자산들의 package dependency를 추가 자산 목록에 합친다.
-	void AppendBatchDependencyAssets(
-		FAssetRegistryModule& InAssetRegistryModule,
-		const TArray<FAssetData>& InSeedAssetArray,
-		const TArray<FString>& InClassFilterArray,
-		TArray<FAssetData>& InOutAssetArray)
+	// FCommandletSmokeFixtureRoot는 ProjectIntermediateDir()/AssetDump/<Name> 아래 smoke check 전용 절대 경로 root다.
+	// 생성할 때 이전 실행이 남긴 내용을 지우고, scope를 벗어날 때 다시 지워 어느 return 경로에서도 fixture가 남지 않는다.
+	struct FCommandletSmokeFixtureRoot
 	{
-		// AddedObjectPathSet는 중복 자산 추가를 방지하는 object path 집합이다.
-		TSet<FString> AddedObjectPathSet;
-		for (const FAssetData& ExistingAssetData : InOutAssetArray)
+		explicit FCommandletSmokeFixtureRoot(const TCHAR* InName)
+			: Path(FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectIntermediateDir(), TEXT("AssetDump"), InName)))
 		{
-			AddedObjectPathSet.Add(ExistingAssetData.GetObjectPathString());
+			Reset();
 		}
 
-		// PendingAssetArray는 아직 dependency 확장을 처리하지 않은 자산 큐다.
-		TArray<FAssetData> PendingAssetArray = InSeedAssetArray;
-		for (int32 PendingIndex = 0; PendingIndex < PendingAssetArray.Num(); ++PendingIndex)
+		~FCommandletSmokeFixtureRoot()
 		{
-			// PendingAssetData는 현재 dependency를 조회할 기준 자산이다.
-			const FAssetData& PendingAssetData = PendingAssetArray[PendingIndex];
-
-			// PendingPackageNameText는 현재 자산의 long package name이다.
-			const FString PendingPackageNameText = FPackageName::ObjectPathToPackageName(PendingAssetData.GetObjectPathString());
-			if (PendingPackageNameText.IsEmpty())
-			{
-				continue;
-			}
+			Reset();
+		}
 
-			// DependencyPackageNameArray는 현재 자산이 직접 참조하는 package 목록이다.
-			TArray<FName> DependencyPackageNameArray;
-			InAssetRegistryModule.Get().GetDependencies(FName(*PendingPackageNameText), DependencyPackageNameArray);
+		FCommandletSmokeFixtureRoot(const FCommandletSmokeFixtureRoot&) = delete;
+		FCommandletSmokeFixtureRoot& operator=(const FCommandletSmokeFixtureRoot&) = delete;
 
-			for (const FName& DependencyPackageName : DependencyPackageNameArray)
-			{
-				// DependencyPackageNameText는 dependency package 문자열이다.
-				const FString DependencyPackageNameText = DependencyPackageName.ToString();
-				if (DependencyPackageNameText.IsEmpty() || DependencyPackageNameText.StartsWith(TEXT("/Script/")))
-				{
-					continue;
-				}
+		// Reset은 root 아래를 모두 지운다.
+		void Reset() const
+		{
+			IFileManager::Get().DeleteDirectory(*Path, false, true);
+		}
 
-				// DependencyObjectPathText는 dependency package에서 대표 자산 object path 추정값이다.
-				const FString DependencyObjectPathText = FString::Printf(
-					TEXT("%s.%s"),
-					*DependencyPackageNameText,
-					*FPackageName::GetShortName(DependencyPackageNameText));
+		FString Path;
+	};
 
-				// DependencyAssetData는 dependency package에서 대표 자산을 찾은 결과다.
-				const FAssetData DependencyAssetData = InAssetRegistryModule.Get().GetAssetByObjectPath(FSoftObjectPath(DependencyObjectPathText));
-				if (!DependencyAssetData.IsValid())
-				{
-					continue;
-				}
+	// VerifyOutputCompressionBenchmark는 합성 dump JSON을 codec/압축 강도별로 저장·재읽기해 원문 일치, 디스크 크기와 write/read 시간을 검증한다.
+	bool VerifyOutputCompressionBenchmark(FString& OutDetail)
+	{
+		constexpr int32 BenchmarkNodeCount = 4096;
 
-				if (!DoesAssetMatchClassFilter(DependencyAssetData, InClassFilterArray))
-				{
-					continue;
-				}
+		// NodeValueArray는 graph node 목록을 흉내 낸 반복 구조 payload다.
+		TArray<TSharedPtr<FJsonValue>> NodeValueArray;
+		NodeValueArray.Reserve(BenchmarkNodeCount);
+		for (int32 NodeIndex = 0; NodeIndex < BenchmarkNodeCount; ++NodeIndex)
+		{
+			TSharedRef<FJsonObject> NodeObject = MakeShared<FJsonObject>();
+			NodeObject->SetStringField(TEXT("node_id"), FString::Printf(TEXT("K2Node_CallFunction_%d"), NodeIndex));
+			NodeObject->SetStringField(TEXT("node_class"), NodeIndex % 3 == 0 ? TEXT("K2Node_VariableGet") : TEXT("K2Node_CallFunction"));
+			NodeObject->SetStringField(TEXT("member_name"), FString::Printf(TEXT("Member_%d"), NodeIndex % 97));
+			NodeObject->SetStringField(TEXT("title"), FString::Printf(TEXT("노드 %d"), NodeIndex));
+			NodeObject->SetNumberField(TEXT("pos_x"), (NodeIndex * 37) % 4000 - 2000);
+			NodeObject->SetNumberField(TEXT("pos_y"), (NodeIndex * 53) % 3000 - 1500);
+			NodeObject->SetBoolField(TEXT("pure"), NodeIndex % 5 == 0);
+			NodeValueArray.Add(MakeShared<FJsonValueObject>(NodeObject));
+		}
 
-				if (AddedObjectPathSet.Contains(DependencyObjectPathText))
-				{
-					continue;
-				}
+		TSharedRef<FJsonObject> GraphObject = MakeShared<FJsonObject>();
+		GraphObject->SetStringField(TEXT("graph_name"), TEXT("EventGraph"));
+		GraphObject->SetArrayField(TEXT("nodes"), NodeValueArray);
 
-				AddedObjectPathSet.Add(DependencyObjectPathText);
-				InOutAssetArray.Add(DependencyAssetData);
-				PendingAssetArray.Add(DependencyAssetData);
-			}
-		}
-	}
+		TSharedRef<FJsonObject> DumpObject = MakeShared<FJsonObject>();
+		DumpObject->SetStringField(TEXT("schema_version"), TEXT("benchmark_v1"));
+		DumpObject->SetStringField(TEXT("object_path"), TEXT("/AssetDump/Benchmark/BP_OutputCompression.BP_OutputCompression"));
+		DumpObject->SetObjectField(TEXT("graph"), GraphObject);
 
-	// IsBatchDumpOutputUpToDate는 batchdump 전용으로 manifest fingerprint를 비교해 skip 가능 여부를 판단한다.
-	bool IsBatchDumpOutputUpToDate(const FADumpRunOpts& InDumpRunOpts, const FString& InOutputFilePath)
-	{
-		if (InOutputFilePath.IsEmpty() || !IFileManager::Get().FileExists(*InOutputFilePath))
+		FString PrettyText;
+		FString CompactText;
+		TSharedRef<TJsonWriter<>> PrettyWriter = TJsonWriterFactory<>::Create(&PrettyText);
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> CompactWriter =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&CompactText);
+		if (!FJsonSerializer::Serialize(DumpObject, PrettyWriter) || !FJsonSerializer::Serialize(DumpObject, CompactWriter))
 		{
+			OutDetail = TEXT("serialize_failed");
 			return false;
 		}
 
-		// ManifestFilePath는 현재 dump.json 옆의 manifest.json 경로다.
-		const FString ManifestFilePath = FPaths::Combine(FPaths::GetPath(InOutputFilePath), TEXT("manifest.json"));
-		if (!IFileManager::Get().FileExists(*ManifestFilePath))
+		// FOutputCompressionCase는 benchmark 한 줄의 이름과 output encoding이다.
+		struct FOutputCompressionCase
 		{
-			return false;
+			const TCHAR* Name;
+			EADumpOutputCompression Compression;
+			EADumpOutputCompressionLevel CompressionLevel;
+			bool bCompactJson;
+		};
+		const FOutputCompressionCase BenchmarkCases[] =
+		{
+			{ TEXT("none_pretty"), EADumpOutputCompression::None, EADumpOutputCompressionLevel::Default, false },
+			{ TEXT("none_compact"), EADumpOutputCompression::None, EADumpOutputCompressionLevel::Default, true },
+			{ TEXT("gzip_pretty"), EADumpOutputCompression::Gzip, EADumpOutputCompressionLevel::Default, false },
+			{ TEXT("gzip_fast"), EADumpOutputCompression::Gzip, EADumpOutputCompressionLevel::Fast, true },
+			{ TEXT("gzip_default"), EADumpOutputCompression::Gzip, EADumpOutputCompressionLevel::Default, true },
+			{ TEXT("gzip_max"), EADumpOutputCompression::Gzip, EADumpOutputCompressionLevel::Max, true }
+		};
+
+		// BenchmarkRoot는 codec/level별 저장 크기를 같은 조건에서 재도록 이전 실행 산출물이 없는 폴더에서 시작한다.
+		const FCommandletSmokeFixtureRoot BenchmarkRoot(TEXT("OutputCompressionBenchmark"));
+		const FString& BenchmarkDirectoryPath = BenchmarkRoot.Path;
+
+		const int64 RawPrettyBytes = GetCommandletUtf8ByteLength(PrettyText);
+		TArray<FString> CaseDetails;
+		bool bAllPassed = true;
+		for (const FOutputCompressionCase& BenchmarkCase : BenchmarkCases)
+		{
+			FADumpOutputEncoding OutputEncoding;
+			OutputEncoding.Compression = BenchmarkCase.Compression;
+			OutputEncoding.CompressionLevel = BenchmarkCase.CompressionLevel;
+			OutputEncoding.bCompactJson = BenchmarkCase.bCompactJson;
+			const FString& SourceText = BenchmarkCase.bCompactJson ? CompactText : PrettyText;
+			const FString CaseFilePath = FPaths::Combine(BenchmarkDirectoryPath, BenchmarkCase.Name, TEXT("dump.json"));
+
+			FString SaveErrorMessage;
+			const double WriteStartSeconds = FPlatformTime::Seconds();
+			const bool bSaved = ADumpJson::SaveJsonTextToFile(CaseFilePath, SourceText, OutputEncoding, SaveErrorMessage);
+			const double WriteSeconds = FPlatformTime::Seconds() - WriteStartSeconds;
+
+			FString LoadedText;
+			const double ReadStartSeconds = FPlatformTime::Seconds();
+			const bool bLoaded = bSaved && ADumpJson::LoadJsonTextFromFile(CaseFilePath, LoadedText);
+			const double ReadSeconds = FPlatformTime::Seconds() - ReadStartSeconds;
+
+			// 압축 case는 원문 일치와 함께 pretty 원본보다 작아야 통과한다.
+			const int64 DiskBytes = IFileManager::Get().FileSize(*CaseFilePath);
+			const bool bRoundTripped = bLoaded && LoadedText.Equals(SourceText, ESearchCase::CaseSensitive);
+			const bool bSizeExpected = BenchmarkCase.Compression == EADumpOutputCompression::None || (DiskBytes > 0 && DiskBytes < RawPrettyBytes);
+			bAllPassed = bAllPassed && bRoundTripped && bSizeExpected;
+			CaseDetails.Add(FString::Printf(
+				TEXT("%s:bytes=%lld,write_ms=%.2f,read_ms=%.2f,ok=%d"),
+				BenchmarkCase.Name,
+				DiskBytes,
+				WriteSeconds * 1000.0,
+				ReadSeconds * 1000.0,
+				bRoundTripped && bSizeExpected ? 1 : 0));
+		}
+
+		OutDetail = FString::Printf(TEXT("nodes=%d raw_pretty_bytes=%lld %s"), BenchmarkNodeCount, RawPrettyBytes, *FString::Join(CaseDetails, TEXT(" ")));
+		return bAllPassed;
+	}
+
+	// VerifyDumpPackRoundTrip은 pack append/commit, 잘린 꼬리 뒤 직전 TOC 복구, pack 항목 열거와 directory export 왕복을 검증한다.
+	bool VerifyDumpPackRoundTrip(FString& OutDetail)
+	{
+		constexpr int32 PackAssetCount = 64;
+
+		// PackRoot는 이전 실행의 dump_pack.adpk가 FindPackForFile 조회에 잡히지 않도록 빈 dump root에서 pack을 새로 쓴다.
+		const FCommandletSmokeFixtureRoot PackRoot(TEXT("DumpPackRoundTrip"));
+		const FString& PackRootPath = PackRoot.Path;
+		const FString PackFilePath = FPaths::Combine(PackRootPath, ADumpPack::GetPackFileName());
+		const FString ExportRootPath = FPaths::Combine(PackRootPath, TEXT("Exported"));
+
+		FADumpOutputEncoding PackEncoding;
+		PackEncoding.PackFilePath = PackFilePath;
+		PackEncoding.bCompactJson = true;
+
+		const double WriteStartSeconds = FPlatformTime::Seconds();
+		TArray<FString> ExpectedTexts;
+		for (int32 AssetIndex = 0; AssetIndex < PackAssetCount; ++AssetIndex)
+		{
+			const FString AssetDirectoryPath = FPaths::Combine(PackRootPath, FString::Printf(TEXT("_Game_Pack_BP_%02d"), AssetIndex));
+			ExpectedTexts.Add(FString::Printf(TEXT("{\"object_path\":\"/Game/Pack/BP_%02d.BP_%02d\",\"ordinal\":%d}"), AssetIndex, AssetIndex, AssetIndex));
+			PackEncoding.Compression = AssetIndex % 2 == 0 ? EADumpOutputCompression::None : EADumpOutputCompression::Gzip;
+			FString SaveErrorMessage;
+			if (!ADumpJson::SaveJsonTextToFile(FPaths::Combine(AssetDirectoryPath, TEXT("manifest.json")), ExpectedTexts.Last(), PackEncoding, SaveErrorMessage))
+			{
+				OutDetail = FString::Printf(TEXT("append_failed=%s"), *SaveErrorMessage);
+				return false;
+			}
 		}
 
-		// ManifestRootObject는 manifest.json 역직렬화 결과다.
-		TSharedPtr<FJsonObject> ManifestRootObject;
-		if (!LoadCommandletJsonObjectFromFile(ManifestFilePath, ManifestRootObject))
+		FString PackErrorCode;
+		FString PackErrorDetail;
+		if (!ADumpPack::ClosePack(PackFilePath, PackErrorCode, PackErrorDetail))
 		{
+			OutDetail = FString::Printf(TEXT("commit_failed=%s"), *PackErrorCode);
 			return false;
 		}
+		const double WriteSeconds = FPlatformTime::Seconds() - WriteStartSeconds;
 
-		// RunObject는 manifest.run object다.
-		const TSharedPtr<FJsonObject> RunObject = GetCommandletNestedObjectField(ManifestRootObject, TEXT("run"));
+		// 다음 commit 도중 끊긴 상황을 흉내 내도록 footer 없는 payload 꼬리를 붙인다.
+		{
+			TUniquePtr<FArchive> TailWriter(IFileManager::Get().CreateFileWriter(*PackFilePath, FILEWRITE_Append));
+			uint8 TornTailBytes[97];
+			FMemory::Memset(TornTailBytes, 0x5A, sizeof(TornTailBytes));
+			if (TailWriter.IsValid())
+			{
+				TailWriter->Serialize(TornTailBytes, sizeof(TornTailBytes));
+				TailWriter->Close();
+			}
+		}
 
-		// ExistingFingerprintText는 기존 manifest에 기록된 실행 fingerprint다.
-		const FString ExistingFingerprintText = GetCommandletStringFieldOrEmpty(RunObject, TEXT("fingerprint"));
-		if (ExistingFingerprintText.IsEmpty())
+		const double ReadStartSeconds = FPlatformTime::Seconds();
+		TArray<FString> PackedManifestPaths;
+		ADumpPack::FindPackedFiles(PackRootPath, TEXT("manifest.json"), PackedManifestPaths);
+		PackedManifestPaths.Sort();
+		int32 MatchedReadCount = 0;
+		for (int32 AssetIndex = 0; AssetIndex < PackedManifestPaths.Num() && AssetIndex < ExpectedTexts.Num(); ++AssetIndex)
 		{
-			return false;
+			FString LoadedText;
+			if (ADumpJson::LoadJsonTextFromFile(PackedManifestPaths[AssetIndex], LoadedText)
+				&& LoadedText.Equals(ExpectedTexts[AssetIndex], ESearchCase::CaseSensitive))
+			{
+				++MatchedReadCount;
+			}
 		}
+		const double ReadSeconds = FPlatformTime::Seconds() - ReadStartSeconds;
 
-		// CurrentFingerprintText는 현재 실행 조건으로 다시 계산한 fingerprint 값이다.
-		const FString CurrentFingerprintText = ADumpFingerprint::BuildAssetFingerprint(
-			InDumpRunOpts.AssetObjectPath,
-			InDumpRunOpts.BuildRequestInfo(),
-			ADumpSchema::GetVersionText(),
-			ADumpSchema::GetExtractorVersionText());
-		return !CurrentFingerprintText.IsEmpty() && CurrentFingerprintText == ExistingFingerprintText;
+		int32 ExportedFileCount = 0;
+		const bool bExported = ADumpPack::ExportPackToDirectory(PackFilePath, ExportRootPath, ExportedFileCount, PackErrorCode, PackErrorDetail);
+		FString ExportedText;
+		const bool bExportMatched = bExported
+			&& ADumpJson::LoadJsonTextFromFile(FPaths::Combine(ExportRootPath, TEXT("_Game_Pack_BP_01"), TEXT("manifest.json")), ExportedText)
+			&& ExportedText.Equals(ExpectedTexts[1], ESearchCase::CaseSensitive);
+
+		OutDetail = FString::Printf(
+			TEXT("files=%d listed=%d matched=%d exported=%d export_matched=%d write_ms=%.2f read_ms=%.2f"),
+			PackAssetCount,
+			PackedManifestPaths.Num(),
+			MatchedReadCount,
+			ExportedFileCount,
+			bExportMatched ? 1 : 0,
+			WriteSeconds * 1000.0,
+			ReadSeconds * 1000.0);
+		return PackedManifestPaths.Num() == PackAssetCount
+			&& MatchedReadCount == PackAssetCount
+			&& ExportedFileCount == PackAssetCount
+			&& bExportMatched;
 	}
 
-	// FValidationCaseDefinition은 validate 모드에서 한 건의 대표 샘플 정의를 담는다.
-	struct FValidationCaseDefinition
+	// VerifyContentStoreDedup은 같은 section payload의 blob 공유, pack에 남은 이전 sidecar보다 우선하는 manifest 참조 복원 읽기, 참조 수 0 blob과 오래된 임시 파일 GC(dry run 포함)를 검증한다.
+	bool VerifyContentStoreDedup(FString& OutDetail)
 	{
-		// CaseName은 report에서 식별할 케이스 이름이다.
-		FString CaseName;
+		constexpr int32 DedupAssetCount = 32;
+		constexpr int32 DedupVariantCount = 4;
 
-		// ExpectedAssetFamily는 dump 결과에서 기대하는 asset_family 문자열이다.
-		FString ExpectedAssetFamily;
+		// DedupRoot는 blob 재사용 수와 GC 회수 수를 세므로 이전 실행의 content_store blob이 남아 있으면 안 된다.
+		const FCommandletSmokeFixtureRoot DedupRoot(TEXT("ContentStoreDedup"));
+		const FString& DedupRootPath = DedupRoot.Path;
+		const FString StoreRootPath = FPaths::Combine(DedupRootPath, ADumpContentStore::GetContentStoreDirectoryName());
 
-		// ExpectedAssetClass는 dump 결과에서 기대하는 자산 클래스 문자열이다.
-		FString ExpectedAssetClass;
+		// VariantHashes는 payload 변형별 content hash다. 같은 변형을 쓰는 자산은 blob 하나를 공유한다.
+		TArray<FString> VariantHashes;
+		int32 ReusedCount = 0;
+		TArray<FString> ManifestFilePaths;
+		for (int32 AssetIndex = 0; AssetIndex < DedupAssetCount; ++AssetIndex)
+		{
+			const int32 VariantIndex = AssetIndex % DedupVariantCount;
+			FString PayloadText = FString::Printf(TEXT("{\"details\":{\"variant\":%d,\"rows\":["), VariantIndex);
+			for (int32 RowIndex = 0; RowIndex < 64; ++RowIndex)
+			{
+				PayloadText += FString::Printf(TEXT("%s{\"name\":\"Row_%02d\",\"value\":%d}"), RowIndex > 0 ? TEXT(",") : TEXT(""), RowIndex, RowIndex * (VariantIndex + 1));
+			}
+			PayloadText += TEXT("]}}");
 
-		// CandidateObjectPathArray는 우선 시도할 자산 오브젝트 경로 후보 목록이다.
-		TArray<FString> CandidateObjectPathArray;
+			const FTCHARToUTF8 PayloadUtf8(*PayloadText);
+			TArray<uint8> PayloadBytes;
+			PayloadBytes.Append(reinterpret_cast<const uint8*>(PayloadUtf8.Get()), PayloadUtf8.Length());
+			const FString ContentHash = ADumpContentStore::BuildContentHash(PayloadBytes);
+			if (VariantHashes.Num() <= VariantIndex)
+			{
+				VariantHashes.Add(ContentHash);
+			}
 
-		// DiscoveryClassName은 후보가 없을 때 AssetRegistry에서 탐색할 클래스 이름이다.
-		FString DiscoveryClassName;
-		FString DiscoveryAssetFamily;
+			bool bReused = false;
+			FString StoreErrorCode;
+			FString StoreErrorDetail;
+			if (!ADumpContentStore::StoreContent(StoreRootPath, ContentHash, PayloadBytes, bReused, StoreErrorCode, StoreErrorDetail))
+			{
+				OutDetail = FString::Printf(TEXT("store_failed=%s"), *StoreErrorCode);
+				return false;
+			}
+			ReusedCount += bReused ? 1 : 0;
+
+			const FString ObjectPathText = FString::Printf(TEXT("/Game/Cas/BP_%02d.BP_%02d"), AssetIndex, AssetIndex);
+			const FString ManifestText = FString::Printf(
+				TEXT("{\"schema_version\":\"smoke\",\"content_store\":\"../%s\",\"content_common\":{\"asset\":{\"object_path\":\"%s\"}},\"content_refs\":{\"details.json\":\"%s\"}}"),
+				ADumpContentStore::GetContentStoreDirectoryName(),
+				*ObjectPathText,
+				*ContentHash);
+			ManifestFilePaths.Add(FPaths::Combine(DedupRootPath, FString::Printf(TEXT("_Game_Cas_BP_%02d"), AssetIndex), TEXT("manifest.json")));
+			FString SaveErrorMessage;
+			if (!ADumpJson::SaveJsonTextToFile(ManifestFilePaths.Last(), ManifestText, SaveErrorMessage))
+			{
+				OutDetail = FString::Printf(TEXT("manifest_save_failed=%s"), *SaveErrorMessage);
+				return false;
+			}
+		}
+
+		// 복원 읽기는 manifest 공통 필드와 공유 blob payload를 합친 details.json이어야 한다.
+		int32 RestoredCount = 0;
+		for (int32 AssetIndex = 0; AssetIndex < DedupAssetCount; ++AssetIndex)
+		{
+			const FString DetailsFilePath = FPaths::Combine(FPaths::GetPath(ManifestFilePaths[AssetIndex]), TEXT("details.json"));
+			TSharedPtr<FJsonObject> DetailsRootObject;
+			if (!ADumpJson::DoesJsonFileExist(DetailsFilePath) || !LoadCommandletJsonObjectFromFile(DetailsFilePath, DetailsRootObject))
+			{
+				continue;
+			}
+			const TSharedPtr<FJsonObject> AssetObject = GetCommandletNestedObjectField(DetailsRootObject, TEXT("asset"));
+			const TSharedPtr<FJsonObject> DetailsObject = GetCommandletNestedObjectField(DetailsRootObject, TEXT("details"));
+			if (GetCommandletStringFieldOrEmpty(AssetObject, TEXT("object_path")) == FString::Printf(TEXT("/Game/Cas/BP_%02d.BP_%02d"), AssetIndex, AssetIndex)
+				&& GetCommandletIntegerFieldOrDefault(DetailsObject, TEXT("variant"), -1) == AssetIndex % DedupVariantCount)
+			{
+				++RestoredCount;
+			}
+		}
+
+		// 이전 비-dedup 실행이 pack에 남긴 details.json은 manifest가 content store를 참조하는 동안 읽히면 안 된다.
+		const FString StalePackFilePath = FPaths::Combine(DedupRootPath, ADumpPack::GetPackFileName());
+		const FString ShadowedDetailsFilePath = FPaths::Combine(FPaths::GetPath(ManifestFilePaths[0]), TEXT("details.json"));
+		const FTCHARToUTF8 StaleDetailsUtf8(TEXT("{\"details\":{\"variant\":-1}}"));
+		TArray<uint8> StaleDetailsBytes;
+		StaleDetailsBytes.Append(reinterpret_cast<const uint8*>(StaleDetailsUtf8.Get()), StaleDetailsUtf8.Length());
+		FString PackErrorCode;
+		FString PackErrorDetail;
+		TSharedPtr<FJsonObject> ShadowedDetailsRootObject;
+		const bool bStorePrecedesPack = ADumpPack::AppendPackedFile(StalePackFilePath, ShadowedDetailsFilePath, StaleDetailsBytes, PackErrorCode, PackErrorDetail)
+			&& ADumpPack::ClosePack(StalePackFilePath, PackErrorCode, PackErrorDetail)
+			&& LoadCommandletJsonObjectFromFile(ShadowedDetailsFilePath, ShadowedDetailsRootObject)
+			&& GetCommandletIntegerFieldOrDefault(GetCommandletNestedObjectField(ShadowedDetailsRootObject, TEXT("details")), TEXT("variant"), -1) == 0;
+		IFileManager::Get().Delete(*StalePackFilePath, false, true, true);
+
+		// 마지막 변형을 참조하던 manifest를 지우고, 한 시간 넘게 남은 중단 writer 임시 파일과 지금 쓰는 중인 임시 파일을 둔다. GC는 앞의 것만 회수해야 한다.
+		for (int32 AssetIndex = DedupVariantCount - 1; AssetIndex < DedupAssetCount; AssetIndex += DedupVariantCount)
+		{
+			IFileManager::Get().Delete(*ManifestFilePaths[AssetIndex], false, true, true);
+		}
+		const FString OrphanBlobFilePath = ADumpContentStore::BuildContentBlobPath(StoreRootPath, VariantHashes.Last());
+		const FString InterruptedTempFilePath = OrphanBlobFilePath + TEXT(".interrupted.tmp");
+		const FString InFlightTempFilePath = ADumpContentStore::BuildContentBlobPath(StoreRootPath, VariantHashes[0]) + TEXT(".inflight.tmp");
+		FFileHelper::SaveStringToFile(TEXT("{}"), *InterruptedTempFilePath);
+		IFileManager::Get().SetTimeStamp(*InterruptedTempFilePath, FDateTime::UtcNow() - FTimespan::FromHours(2.0));
+		FFileHelper::SaveStringToFile(TEXT("{}"), *InFlightTempFilePath);
+
+		FADumpContentStoreReport DryRunReport;
+		FADumpContentStoreReport SweepReport;
+		FString ReportFilePath;
+		FString GcErrorCode;
+		FString GcErrorDetail;
+		const bool bDryRunCollected = ADumpContentStore::CollectGarbage(DedupRootPath, true, DryRunReport, ReportFilePath, GcErrorCode, GcErrorDetail);
+		const bool bOrphanKeptByDryRun = IFileManager::Get().FileExists(*OrphanBlobFilePath);
+		const double SweepStartSeconds = FPlatformTime::Seconds();
+		const bool bSweepCollected = ADumpContentStore::CollectGarbage(DedupRootPath, false, SweepReport, ReportFilePath, GcErrorCode, GcErrorDetail);
+		const double SweepSeconds = FPlatformTime::Seconds() - SweepStartSeconds;
+		const bool bOrphanDeleted = !IFileManager::Get().FileExists(*OrphanBlobFilePath);
+		const bool bTempFilesSwept = !IFileManager::Get().FileExists(*InterruptedTempFilePath) && IFileManager::Get().FileExists(*InFlightTempFilePath);
+		const bool bReportSaved = ADumpJson::DoesJsonFileExist(ReportFilePath);
+
+		const int32 ExpectedReferenceCount = DedupAssetCount - DedupAssetCount / DedupVariantCount;
+		OutDetail = FString::Printf(
+			TEXT("assets=%d blobs=%d reused=%d restored=%d store_over_pack=%d refs=%d live=%d deleted=%d dry_run_kept=%d temp_swept=%d dedup_ratio=%.2f reclaimed_bytes=%lld gc_ms=%.2f"),
+			DedupAssetCount,
+			VariantHashes.Num(),
+			ReusedCount,
+			RestoredCount,
+			bStorePrecedesPack ? 1 : 0,
+			SweepReport.ReferenceCount,
+			SweepReport.LiveBlobCount,
+			SweepReport.DeletedBlobCount,
+			bOrphanKeptByDryRun ? 1 : 0,
+			bTempFilesSwept ? 1 : 0,
+			SweepReport.DedupRatio,
+			SweepReport.ReclaimedBytes,
+			SweepSeconds * 1000.0);
+		return ReusedCount == DedupAssetCount - DedupVariantCount
+			&& RestoredCount == DedupAssetCount
+			&& bStorePrecedesPack
+			&& bTempFilesSwept
+			&& bDryRunCollected
+			&& DryRunReport.DeletedBlobCount == 1
+			&& bOrphanKeptByDryRun
+			&& bSweepCollected
+			&& bOrphanDeleted
+			&& bReportSaved
+			&& SweepReport.ReferenceCount == ExpectedReferenceCount
+			&& SweepReport.LiveBlobCount == DedupVariantCount - 1
+			&& SweepReport.MissingBlobCount == 0
+			&& SweepReport.DeletedBlobCount == 1
+			&& SweepReport.DedupRatio > static_cast<double>(DedupAssetCount / DedupVariantCount) - 0.5;
+	}
+
+	// VerifyIncrementalIndexReuse는 두 번째 index build가 바뀌지 않은 manifest entry를 모두 재사용하고, sidecar 하나를 고치면 그 manifest만 다시 읽는지 검증한다.
+	bool VerifyIncrementalIndexReuse(FString& OutDetail)
+	{
+		constexpr int32 ReuseAssetCount = 24;
+
+		// ReuseRoot는 첫 build가 모든 source를 새로 읽는지 세므로 이전 index 재사용 기록이 없는 root에서 시작한다.
+		const FCommandletSmokeFixtureRoot ReuseRoot(TEXT("IncrementalIndex"));
+		const FString& ReuseRootPath = ReuseRoot.Path;
+
+		auto BuildReferencesText = [](int32 InReferenceCount)
+		{
+			FString ReferencesText = TEXT("{\"references\":{\"hard\":[");
+			for (int32 ReferenceIndex = 0; ReferenceIndex < InReferenceCount; ++ReferenceIndex)
+			{
+				ReferencesText += FString::Printf(
+					TEXT("%s{\"path\":\"/Game/Reuse/Target_%02d.Target_%02d\",\"source\":\"property_ref\",\"source_path\":\"Prop_%02d\"}"),
+					ReferenceIndex > 0 ? TEXT(",") : TEXT(""),
+					ReferenceIndex,
+					ReferenceIndex,
+					ReferenceIndex);
+			}
+			return ReferencesText + TEXT("],\"soft\":[]}}");
+		};
+
+		TArray<FString> ReferencesFilePaths;
+		for (int32 AssetIndex = 0; AssetIndex < ReuseAssetCount; ++AssetIndex)
+		{
+			const FString AssetDirectoryPath = FPaths::Combine(ReuseRootPath, FString::Printf(TEXT("_Game_Reuse_BP_%02d"), AssetIndex));
+			const FString ManifestText = FString::Printf(
+				TEXT("{\"generated_time\":\"2026-01-01T00:00:00.000Z\",\"dump_status\":\"succeeded\",\"asset\":{\"asset_key\":\"reuse_%02d\",\"object_path\":\"/Game/Reuse/BP_%02d.BP_%02d\",\"asset_class\":\"Blueprint\"},\"run\":{},\"generated_files\":[\"references.json\"]}"),
+				AssetIndex,
+				AssetIndex,
+				AssetIndex);
+			ReferencesFilePaths.Add(FPaths::Combine(AssetDirectoryPath, TEXT("references.json")));
+			FString SaveErrorMessage;
+			if (!ADumpJson::SaveJsonTextToFile(FPaths::Combine(AssetDirectoryPath, TEXT("manifest.json")), ManifestText, SaveErrorMessage)
+				|| !ADumpJson::SaveJsonTextToFile(ReferencesFilePaths.Last(), BuildReferencesText(2), SaveErrorMessage))
+			{
+				OutDetail = FString::Printf(TEXT("fixture_save_failed=%s"), *SaveErrorMessage);
+				return false;
+			}
+		}
 
-		// bIsOptionalSample는 샘플이 없어도 전체 실패로 보지 않을지 여부다.
-		bool bIsOptionalSample = false;
+		// ReadBuildCounts는 방금 만든 asset_index 재사용/재파싱 수와 dependency_index relation 수를 읽는다.
+		auto ReadBuildCounts = [&ReuseRootPath](int32& OutReusedCount, int32& OutParsedCount, int32& OutRelationCount)
+		{
+			TSharedPtr<FJsonObject> AssetIndexRootObject;
+			TSharedPtr<FJsonObject> DependencyRootObject;
+			const bool bLoaded = LoadCommandletJsonObjectFromFile(FPaths::Combine(ReuseRootPath, TEXT("asset_index.json")), AssetIndexRootObject)
+				&& LoadCommandletJsonObjectFromFile(FPaths::Combine(ReuseRootPath, TEXT("dependency_index.json")), DependencyRootObject);
+			OutReusedCount = GetCommandletIntegerFieldOrDefault(AssetIndexRootObject, TEXT("reused_manifest_count"), -1);
+			OutParsedCount = GetCommandletIntegerFieldOrDefault(AssetIndexRootObject, TEXT("parsed_manifest_count"), -1);
+			OutRelationCount = GetCommandletIntegerFieldOrDefault(DependencyRootObject, TEXT("relation_count"), -1);
+			return bLoaded;
+		};
 
-		// MinGraphCount는 그래프 최소 기대 개수다.
-		int32 MinGraphCount = 0;
+		FString AssetIndexFilePath;
+		int32 FirstReusedCount = 0;
+		int32 FirstParsedCount = 0;
+		int32 FirstRelationCount = 0;
+		const bool bFirstBuilt = UAssetDumpCommandlet::RebuildDumpIndexFiles(ReuseRootPath, AssetIndexFilePath)
+			&& ReadBuildCounts(FirstReusedCount, FirstParsedCount, FirstRelationCount);
+
+		int32 SecondReusedCount = 0;
+		int32 SecondParsedCount = 0;
+		int32 SecondRelationCount = 0;
+		const double SecondStartSeconds = FPlatformTime::Seconds();
+		const bool bSecondBuilt = UAssetDumpCommandlet::RebuildDumpIndexFiles(ReuseRootPath, AssetIndexFilePath)
+			&& ReadBuildCounts(SecondReusedCount, SecondParsedCount, SecondRelationCount);
+		const double SecondSeconds = FPlatformTime::Seconds() - SecondStartSeconds;
+
+		// 자산 하나의 references.json에 reference 한 건을 더해 그 manifest만 다시 읽혀야 한다.
+		FString ChangeErrorMessage;
+		const bool bChanged = ADumpJson::SaveJsonTextToFile(ReferencesFilePaths[0], BuildReferencesText(3), ChangeErrorMessage);
+		int32 ThirdReusedCount = 0;
+		int32 ThirdParsedCount = 0;
+		int32 ThirdRelationCount = 0;
+		const bool bThirdBuilt = bChanged
+			&& UAssetDumpCommandlet::RebuildDumpIndexFiles(ReuseRootPath, AssetIndexFilePath)
+			&& ReadBuildCounts(ThirdReusedCount, ThirdParsedCount, ThirdRelationCount);
 
-		// MinPropertyCount는 details 최소 기대 프로퍼티 개수다.
-		int32 MinPropertyCount = 0;
+		OutDetail = FString::Printf(
+			TEXT("assets=%d first_parsed=%d second_reused=%d second_parsed=%d third_reused=%d third_parsed=%d relations=%d->%d second_ms=%.2f"),
+			ReuseAssetCount,
+			FirstParsedCount,
+			SecondReusedCount,
+			SecondParsedCount,
+			ThirdReusedCount,
+			ThirdParsedCount,
+			SecondRelationCount,
+			ThirdRelationCount,
+			SecondSeconds * 1000.0);
+		return bFirstBuilt
+			&& bSecondBuilt
+			&& bThirdBuilt
+			&& FirstParsedCount == ReuseAssetCount
+			&& SecondReusedCount == ReuseAssetCount
+			&& SecondParsedCount == 0
+			&& SecondRelationCount == FirstRelationCount
+			&& ThirdReusedCount == ReuseAssetCount - 1
+			&& ThirdParsedCount == 1
+			&& ThirdRelationCount == SecondRelationCount + 1;
+	}
+
+	// FCommandletWatchPendingPackage는 watch 모드에서 debounce 중인 변경 package 한 건이다.
+	struct FCommandletWatchPendingPackage
+	{
+		// PackageName은 변경 파일에서 변환한 long package 이름이다.
+		FString PackageName;
+
+		// FilePath는 마지막 event의 .uasset/.umap 절대 경로다. 처리 시점에 파일이 없으면 삭제로 본다.
+		FString FilePath;
+
+		// FirstEventSeconds는 처리되지 않은 첫 event 시각이고 lag 기준이다.
+		double FirstEventSeconds = 0.0;
+
+		// LastEventSeconds는 마지막 event 시각이다. 이 시각부터 debounce 시간이 지나야 batch에 들어간다.
+		double LastEventSeconds = 0.0;
+	};
 
-		// MinReferenceCount는 hard+soft 참조 최소 기대 개수다.
-		int32 MinReferenceCount = 0;
+	// FCommandletWatchQueue는 package 이름별 대기 변경을 모은다. 같은 package의 연속 저장은 한 항목으로 합친다.
+	struct FCommandletWatchQueue
+	{
+		// PendingByPackageName은 package 이름별 대기 항목이다.
+		TMap<FString, FCommandletWatchPendingPackage> PendingByPackageName;
 
-		// MinWidgetBindingCount는 widget binding 최소 기대 개수다.
-		int32 MinWidgetBindingCount = 0;
+		// EventCount는 받아들인 package 파일 event 총수이고, IgnoredEventCount는 package가 아니거나 root 밖이라 버린 event 수다.
+		int32 EventCount = 0;
+		int32 IgnoredEventCount = 0;
+	};
 
-		// MinWidgetDesignerNodeCount는 Widget Designer hierarchy 최소 노드 개수다.
-		int32 MinWidgetDesignerNodeCount = 0;
+	// FCommandletWatchStatus는 watch_status.json heartbeat에 기록할 진행 상태와 누적 집계다.
+	struct FCommandletWatchStatus
+	{
+		// StateText는 initial_batch, watching, dumping, indexing, stopped 중 하나다.
+		FString StateText = TEXT("initial_batch");
 
-		// MinWidgetDesignerMaxDepth는 Widget Designer hierarchy 최소 최대 깊이다.
-		int32 MinWidgetDesignerMaxDepth = 0;
+		// DumpRootPath, RootPath, WatcherKind는 감시 대상과 변경 감지 방식(directory_watcher 또는 poll)이다.
+		FString DumpRootPath;
+		FString RootPath;
+		FString WatcherKind;
 
-		// MinInputMappingCount는 input mapping 최소 기대 개수다.
-		int32 MinInputMappingCount = 0;
+		// WatchedDirectoryArray는 감시 중인 content 폴더 절대 경로다.
+		TArray<FString> WatchedDirectoryArray;
 
-		// MinCurveKeyCount는 curve key 최소 기대 개수다.
-		int32 MinCurveKeyCount = 0;
+		// StartedTimeText는 watch 시작 시각이다.
+		FString StartedTimeText;
 
-		// MinWorldActorCount는 world actor 최소 기대 개수다.
-		int32 MinWorldActorCount = 0;
+		// HeartbeatSequence는 status 기록 횟수다. CI가 process 정지 여부를 판정하는 데 쓴다.
+		int64 HeartbeatSequence = 0;
 
-		// MinWorldStaticMeshSocketTransformCount는 world 배치 StaticMeshComponent socket Transform 최소 기대 개수다.
-		int32 MinWorldStaticMeshSocketTransformCount = 0;
+		// bInitialBatchDone과 InitialBatchExitCode는 최초 batchdump 완료 여부와 종료 코드다.
+		bool bInitialBatchDone = false;
+		int32 InitialBatchExitCode = -1;
 
-		// bRequireWorldComponentTransformNonIdentity는 world socket fixture가 비-identity component world Transform을 가져야 하는지 여부다.
-		bool bRequireWorldComponentTransformNonIdentity = false;
+		// InFlightPackageCount와 InFlightFirstEventSeconds는 처리 중 batch의 package 수와 가장 오래된 event 시각이다.
+		int32 InFlightPackageCount = 0;
+		double InFlightFirstEventSeconds = 0.0;
 
-		// MinDataTableRowCount는 DataTable row 최소 기대 개수다.
-		int32 MinDataTableRowCount = 0;
+		// bIndexDirty는 dump가 바뀌었지만 index를 아직 다시 만들지 않았는지 나타낸다.
+		bool bIndexDirty = false;
 
-		// MinStaticMeshSocketCount는 StaticMesh socket 최소 기대 개수다.
-		int32 MinStaticMeshSocketCount = 0;
+		// BatchCount부터 RemovedCount까지는 watch 시작 뒤 누적 batch/자산 결과 수다.
+		int32 BatchCount = 0;
+		int32 DumpedCount = 0;
+		int32 SkippedCount = 0;
+		int32 FailedCount = 0;
+		int32 RemovedCount = 0;
 
-		// MinComponentStaticMeshSocketCount는 StaticMeshComponent 참조 StaticMesh socket 최소 기대 개수다.
-		int32 MinComponentStaticMeshSocketCount = 0;
+		// LastBatchPackageCount, LastBatchAssetCount, LastBatchMilliseconds, LastIndexMilliseconds는 마지막 batch 규모와 소요 시간이다.
+		int32 LastBatchPackageCount = 0;
+		int32 LastBatchAssetCount = 0;
+		double LastBatchMilliseconds = 0.0;
+		double LastIndexMilliseconds = 0.0;
 
-		// MinComponentStaticMeshSocketTransformCount는 StaticMeshComponent 참조 socket Transform 최소 기대 개수다.
-		int32 MinComponentStaticMeshSocketTransformCount = 0;
+		// bLastIndexBuilt는 마지막 index 갱신 성공 여부다.
+		bool bLastIndexBuilt = true;
+
+		// LastChangeTimeText와 LastCaughtUpTimeText는 마지막 변경 event 시각과 마지막으로 따라잡은 시각이다.
+		FString LastChangeTimeText;
+		FString LastCaughtUpTimeText;
 	};
 
-	// TryResolveValidationAssetPath는 후보 경로 또는 클래스 탐색으로 validate 샘플 자산 경로를 찾는다.
-	// ResolveValidationAssetFamilyText는 validate 탐색 중 UObject 자산을 asset family 문자열로 분류한다.
-	FString ResolveValidationAssetFamilyText(UObject* InAssetObject)
+	// EnqueueCommandletWatchChange는 변경 package를 대기 목록에 넣는다. 이미 있으면 첫 event 시각은 유지하고 마지막 시각만 늦춘다.
+	void EnqueueCommandletWatchChange(FCommandletWatchQueue& InOutQueue, const FString& InPackageName, const FString& InFilePath, double InNowSeconds)
 	{
-		if (!InAssetObject)
+		FCommandletWatchPendingPackage& PendingPackage = InOutQueue.PendingByPackageName.FindOrAdd(InPackageName);
+		if (PendingPackage.PackageName.IsEmpty())
 		{
-			return TEXT("object_asset");
+			PendingPackage.PackageName = InPackageName;
+			PendingPackage.FirstEventSeconds = InNowSeconds;
 		}
+		PendingPackage.FilePath = InFilePath;
+		PendingPackage.LastEventSeconds = InNowSeconds;
+		++InOutQueue.EventCount;
+	}
 
-		if (UBlueprint* BlueprintAsset = Cast<UBlueprint>(InAssetObject))
+	// DequeueCommandletWatchBatch는 debounce가 끝난 항목을 오래된 event 순으로 최대 InMaxBatchSize개 꺼낸다.
+	int32 DequeueCommandletWatchBatch(
+		FCommandletWatchQueue& InOutQueue,
+		double InNowSeconds,
+		double InDebounceSeconds,
+		int32 InMaxBatchSize,
+		TArray<FCommandletWatchPendingPackage>& OutBatch)
+	{
+		OutBatch.Reset();
+		for (const TPair<FString, FCommandletWatchPendingPackage>& PendingPair : InOutQueue.PendingByPackageName)
 		{
-			if (BlueprintAsset->GetClass()->GetName().Equals(TEXT("WidgetBlueprint"), ESearchCase::CaseSensitive))
-			{
-				return TEXT("widget_blueprint");
-			}
-
-			if (Cast<UAnimBlueprint>(BlueprintAsset))
-			{
-				return TEXT("anim_blueprint");
-			}
-
-			UClass* ParentClassObject = BlueprintAsset->ParentClass;
-			if (ParentClassObject && ParentClassObject->IsChildOf(AActor::StaticClass()))
+			if (InNowSeconds - PendingPair.Value.LastEventSeconds >= InDebounceSeconds)
 			{
-				return TEXT("actor_blueprint");
+				OutBatch.Add(PendingPair.Value);
 			}
+		}
 
-			if (ParentClassObject && ParentClassObject->IsChildOf(UActorComponent::StaticClass()))
+		OutBatch.Sort([](const FCommandletWatchPendingPackage& Left, const FCommandletWatchPendingPackage& Right)
+		{
+			if (Left.FirstEventSeconds != Right.FirstEventSeconds)
 			{
-				return TEXT("component_blueprint");
+				return Left.FirstEventSeconds < Right.FirstEventSeconds;
 			}
-
-			return TEXT("object_blueprint");
+			return Left.PackageName.Compare(Right.PackageName, ESearchCase::CaseSensitive) < 0;
+		});
+		if (InMaxBatchSize > 0 && OutBatch.Num() > InMaxBatchSize)
+		{
+			OutBatch.SetNum(InMaxBatchSize);
 		}
 
-		if (Cast<UPrimaryDataAsset>(InAssetObject))
+		for (const FCommandletWatchPendingPackage& BatchPackage : OutBatch)
 		{
-			return TEXT("primary_data_asset");
+			InOutQueue.PendingByPackageName.Remove(BatchPackage.PackageName);
 		}
+		return OutBatch.Num();
+	}
 
-		if (Cast<UInputAction>(InAssetObject))
+	// GetCommandletWatchLagSeconds는 대기 중이거나 처리 중인 변경 중 가장 오래된 event부터 지난 시간이다. 모두 반영됐으면 0이다.
+	double GetCommandletWatchLagSeconds(const FCommandletWatchQueue& InQueue, const FCommandletWatchStatus& InStatus, double InNowSeconds)
+	{
+		double OldestEventSeconds = InStatus.InFlightPackageCount > 0 ? InStatus.InFlightFirstEventSeconds : TNumericLimits<double>::Max();
+		for (const TPair<FString, FCommandletWatchPendingPackage>& PendingPair : InQueue.PendingByPackageName)
 		{
-			return TEXT("input_action");
+			OldestEventSeconds = FMath::Min(OldestEventSeconds, PendingPair.Value.FirstEventSeconds);
 		}
+		return OldestEventSeconds == TNumericLimits<double>::Max() ? 0.0 : FMath::Max(0.0, InNowSeconds - OldestEventSeconds);
+	}
 
-		if (Cast<UInputMappingContext>(InAssetObject))
+	// IsCommandletWatchCaughtUp는 최초 batch가 끝났고 대기/처리 중 변경과 미반영 index가 없는지 판정한다.
+	bool IsCommandletWatchCaughtUp(const FCommandletWatchQueue& InQueue, const FCommandletWatchStatus& InStatus)
+	{
+		return InStatus.bInitialBatchDone
+			&& InQueue.PendingByPackageName.Num() == 0
+			&& InStatus.InFlightPackageCount == 0
+			&& !InStatus.bIndexDirty;
+	}
+
+	// BuildCommandletWatchStatusObject는 watch_status_v1 heartbeat object를 만든다.
+	TSharedRef<FJsonObject> BuildCommandletWatchStatusObject(const FCommandletWatchQueue& InQueue, const FCommandletWatchStatus& InStatus, double InNowSeconds)
+	{
+		TArray<TSharedPtr<FJsonValue>> WatchedDirectoryValues;
+		for (const FString& WatchedDirectoryPath : InStatus.WatchedDirectoryArray)
 		{
-			return TEXT("input_mapping_context");
+			WatchedDirectoryValues.Add(MakeShared<FJsonValueString>(WatchedDirectoryPath));
 		}
 
-		if (Cast<UDataAsset>(InAssetObject))
+		TSharedRef<FJsonObject> StatusObject = MakeShared<FJsonObject>();
+		StatusObject->SetStringField(TEXT("schema_version"), TEXT("watch_status_v1"));
+		StatusObject->SetStringField(TEXT("heartbeat_time"), FDateTime::UtcNow().ToIso8601());
+		StatusObject->SetNumberField(TEXT("heartbeat_sequence"), static_cast<double>(InStatus.HeartbeatSequence));
+		StatusObject->SetNumberField(TEXT("process_id"), FPlatformProcess::GetCurrentProcessId());
+		StatusObject->SetStringField(TEXT("started_time"), InStatus.StartedTimeText);
+		StatusObject->SetStringField(TEXT("state"), InStatus.StateText);
+		StatusObject->SetBoolField(TEXT("caught_up"), IsCommandletWatchCaughtUp(InQueue, InStatus));
+		StatusObject->SetNumberField(TEXT("queue_depth"), InQueue.PendingByPackageName.Num());
+		StatusObject->SetNumberField(TEXT("in_flight_package_count"), InStatus.InFlightPackageCount);
+		StatusObject->SetNumberField(TEXT("lag_seconds"), GetCommandletWatchLagSeconds(InQueue, InStatus, InNowSeconds));
+		StatusObject->SetBoolField(TEXT("index_dirty"), InStatus.bIndexDirty);
+		StatusObject->SetBoolField(TEXT("last_index_built"), InStatus.bLastIndexBuilt);
+		StatusObject->SetBoolField(TEXT("initial_batch_done"), InStatus.bInitialBatchDone);
+		StatusObject->SetNumberField(TEXT("initial_batch_exit_code"), InStatus.InitialBatchExitCode);
+		StatusObject->SetStringField(TEXT("last_change_time"), InStatus.LastChangeTimeText);
+		StatusObject->SetStringField(TEXT("last_caught_up_time"), InStatus.LastCaughtUpTimeText);
+		StatusObject->SetStringField(TEXT("dump_root_path"), InStatus.DumpRootPath);
+		StatusObject->SetStringField(TEXT("root_path"), InStatus.RootPath);
+		StatusObject->SetStringField(TEXT("watcher_kind"), InStatus.WatcherKind);
+		StatusObject->SetArrayField(TEXT("watched_directories"), WatchedDirectoryValues);
+		StatusObject->SetNumberField(TEXT("event_count"), InQueue.EventCount);
+		StatusObject->SetNumberField(TEXT("ignored_event_count"), InQueue.IgnoredEventCount);
+		StatusObject->SetNumberField(TEXT("batch_count"), InStatus.BatchCount);
+		StatusObject->SetNumberField(TEXT("dumped_count"), InStatus.DumpedCount);
+		StatusObject->SetNumberField(TEXT("skipped_count"), InStatus.SkippedCount);
+		StatusObject->SetNumberField(TEXT("failed_count"), InStatus.FailedCount);
+		StatusObject->SetNumberField(TEXT("removed_count"), InStatus.RemovedCount);
+		StatusObject->SetNumberField(TEXT("last_batch_package_count"), InStatus.LastBatchPackageCount);
+		StatusObject->SetNumberField(TEXT("last_batch_asset_count"), InStatus.LastBatchAssetCount);
+		StatusObject->SetNumberField(TEXT("last_batch_ms"), InStatus.LastBatchMilliseconds);
+		StatusObject->SetNumberField(TEXT("last_index_ms"), InStatus.LastIndexMilliseconds);
+		return StatusObject;
+	}
+
+	// SaveCommandletWatchStatus는 heartbeat 순번을 올리고 watch_status.json을 임시 파일 + move로 원자 저장한다.
+	bool SaveCommandletWatchStatus(const FString& InStatusFilePath, const FCommandletWatchQueue& InQueue, FCommandletWatchStatus& InOutStatus)
+	{
+		++InOutStatus.HeartbeatSequence;
+		FString StatusJsonText;
+		FString SaveErrorMessage;
+		if (!SerializeJsonObjectText(BuildCommandletWatchStatusObject(InQueue, InOutStatus, FPlatformTime::Seconds()), StatusJsonText)
+			|| !ADumpJson::SaveJsonTextToFile(InStatusFilePath, StatusJsonText, SaveErrorMessage))
 		{
-			return TEXT("data_asset");
+			UE_LOG(LogTemp, Warning, TEXT("ADUMP_WATCH_STATUS_SAVE_FAILED: %s (%s)"), *InStatusFilePath, *SaveErrorMessage);
+			return false;
 		}
+		return true;
+	}
 
-		if (Cast<UDataTable>(InAssetObject))
+	// BuildWatchInitialBatchCommandLine은 watch 인자를 그대로 쓰는 최초 batchdump 명령줄이다. ChangedOnly를 지정하지 않았으면 켠다.
+	FString BuildWatchInitialBatchCommandLine(const FString& InCommandLine)
+	{
+		FString ModeText;
+		FParse::Value(*InCommandLine, TEXT("Mode="), ModeText);
+
+		FString BatchCommandLine = InCommandLine;
+		const int32 ModeTokenIndex = BatchCommandLine.Find(FString::Printf(TEXT("Mode=%s"), *ModeText), ESearchCase::IgnoreCase);
+		if (ModeTokenIndex != INDEX_NONE)
 		{
-			return TEXT("data_table");
+			BatchCommandLine.RemoveAt(ModeTokenIndex, 5 + ModeText.Len());
+			BatchCommandLine.InsertAt(ModeTokenIndex, TEXT("Mode=batchdump"));
 		}
 
-		if (Cast<UStaticMesh>(InAssetObject))
+		bool bChangedOnlyValue = false;
+		if (!FParse::Bool(*BatchCommandLine, TEXT("ChangedOnly="), bChangedOnlyValue))
 		{
-			return TEXT("static_mesh");
+			BatchCommandLine += TEXT(" -ChangedOnly=true");
 		}
+		return BatchCommandLine;
+	}
 
-		if (Cast<UCurveFloat>(InAssetObject))
+	// TryConvertWatchFileToPackageName은 감시 root 아래 .uasset/.umap 파일만 long package 이름으로 바꾼다.
+	bool TryConvertWatchFileToPackageName(const FString& InFilePath, const FString& InRootPath, FString& OutPackageName)
+	{
+		const FString ExtensionText = FPaths::GetExtension(InFilePath, true);
+		if (!ExtensionText.Equals(FPackageName::GetAssetPackageExtension(), ESearchCase::IgnoreCase)
+			&& !ExtensionText.Equals(FPackageName::GetMapPackageExtension(), ESearchCase::IgnoreCase))
 		{
-			return TEXT("curve_float");
+			return false;
 		}
 
-		if (Cast<UWorld>(InAssetObject))
+		if (!FPackageName::TryConvertFilenameToLongPackageName(InFilePath, OutPackageName))
 		{
-			return TEXT("world_map");
+			return false;
 		}
 
-		return TEXT("object_asset");
+		const FString RootPrefixText = InRootPath.EndsWith(TEXT("/")) ? InRootPath : InRootPath + TEXT("/");
+		return OutPackageName.StartsWith(RootPrefixText, ESearchCase::IgnoreCase);
 	}
 
-	// DoesLoadedAssetMatchValidationCase는 로드한 자산이 validate 케이스 조건과 맞는지 확인한다.
-	bool DoesLoadedAssetMatchValidationCase(
-		UObject* InLoadedAssetObject,
-		const FValidationCaseDefinition& InCaseDefinition)
+	// CollectWatchPackageFileStamps는 poll 감시용으로 폴더 아래 package 파일의 수정 시각과 크기를 모은다.
+	void CollectWatchPackageFileStamps(const FString& InDirectoryPath, TMap<FString, FString>& OutStampByFilePath)
 	{
-		if (!InLoadedAssetObject)
+		IFileManager::Get().IterateDirectoryStatRecursively(
+			*InDirectoryPath,
+			[&OutStampByFilePath](const TCHAR* InVisitedPath, const FFileStatData& InStatData)
+			{
+				if (!InStatData.bIsDirectory)
+				{
+					const FString VisitedFilePath(InVisitedPath);
+					const FString ExtensionText = FPaths::GetExtension(VisitedFilePath, true);
+					if (ExtensionText.Equals(FPackageName::GetAssetPackageExtension(), ESearchCase::IgnoreCase)
+						|| ExtensionText.Equals(FPackageName::GetMapPackageExtension(), ESearchCase::IgnoreCase))
+					{
+						OutStampByFilePath.Add(VisitedFilePath, FString::Printf(TEXT("%lld:%lld"), InStatData.FileSize, InStatData.ModificationTime.GetTicks()));
+					}
+				}
+				return true;
+			});
+	}
+
+	// RemoveWatchAssetDump는 삭제 자산의 dump 폴더와, pack을 쓰면 그 폴더 아래 pack 항목을 지운다. pack 항목은 다음 CommitPack의 TOC부터 빠진다.
+	bool RemoveWatchAssetDump(const FString& InDumpDirectoryPath, const FString& InPackFilePath)
+	{
+		bool bRemoved = false;
+		if (IFileManager::Get().DirectoryExists(*InDumpDirectoryPath))
 		{
-			return false;
+			bRemoved = IFileManager::Get().DeleteDirectory(*InDumpDirectoryPath, false, true);
 		}
 
-		if (!InCaseDefinition.ExpectedAssetClass.IsEmpty())
+		// -Pack=true dump는 실제 폴더가 없으므로 TOC에서 빼지 않으면 index rebuild가 pack 항목으로 삭제 자산을 다시 찾는다.
+		if (!InPackFilePath.IsEmpty())
 		{
-			const FString LoadedAssetClassName = InLoadedAssetObject->GetClass()->GetName();
-			if (!LoadedAssetClassName.Equals(InCaseDefinition.ExpectedAssetClass, ESearchCase::CaseSensitive))
+			int32 RemovedPackedFileCount = 0;
+			FString PackErrorCode;
+			FString PackErrorDetail;
+			if (ADumpPack::RemovePackedDirectory(InPackFilePath, InDumpDirectoryPath, RemovedPackedFileCount, PackErrorCode, PackErrorDetail))
 			{
-				return false;
+				bRemoved = bRemoved || RemovedPackedFileCount > 0;
 			}
-		}
-
-		if (!InCaseDefinition.ExpectedAssetFamily.IsEmpty())
-		{
-			const FString LoadedAssetFamilyText = ResolveValidationAssetFamilyText(InLoadedAssetObject);
-			if (!LoadedAssetFamilyText.Equals(InCaseDefinition.ExpectedAssetFamily, ESearchCase::CaseSensitive))
+			else
 			{
-				return false;
+				UE_LOG(LogTemp, Warning, TEXT("%s: %s"), *PackErrorCode, *PackErrorDetail);
 			}
 		}
-
-		return true;
+		return bRemoved;
 	}
 
-	bool TryResolveValidationAssetPath(
-		FAssetRegistryModule& InAssetRegistryModule,
-		const FValidationCaseDefinition& InCaseDefinition,
-		FString& OutResolvedObjectPath)
+	// VerifyWatchQueueStatus는 watch queue debounce/순서/batch 크기, lag 계산, caught_up 판정과 최초 batch 명령줄 변환을 검증한다.
+	bool VerifyWatchQueueStatus(FString& OutDetail)
 	{
-		OutResolvedObjectPath.Reset();
+		FCommandletWatchQueue WatchQueue;
+		FCommandletWatchStatus WatchStatus;
+		WatchStatus.bInitialBatchDone = true;
 
-		for (const FString& CandidateObjectPath : InCaseDefinition.CandidateObjectPathArray)
-		{
-			// CandidateAssetData는 현재 후보 경로에 대응하는 AssetRegistry 항목이다.
-			const FAssetData CandidateAssetData = InAssetRegistryModule.Get().GetAssetByObjectPath(FSoftObjectPath(CandidateObjectPath));
-			if (CandidateAssetData.IsValid())
-			{
-				UObject* CandidateLoadedObject = CandidateAssetData.GetAsset();
-				if (DoesLoadedAssetMatchValidationCase(CandidateLoadedObject, InCaseDefinition))
-				{
-					OutResolvedObjectPath = CandidateAssetData.GetObjectPathString();
-					return true;
-				}
-			}
+		EnqueueCommandletWatchChange(WatchQueue, TEXT("/Game/Watch/A"), TEXT("A.uasset"), 0.0);
+		EnqueueCommandletWatchChange(WatchQueue, TEXT("/Game/Watch/B"), TEXT("B.uasset"), 1.0);
+		EnqueueCommandletWatchChange(WatchQueue, TEXT("/Game/Watch/C"), TEXT("C.uasset"), 1.0);
+		EnqueueCommandletWatchChange(WatchQueue, TEXT("/Game/Watch/A"), TEXT("A.uasset"), 1.5);
 
-			// CandidateSoftObjectPath는 AssetRegistry에 안 잡히는 플러그인 Content 후보를 직접 로드해 확인한다.
-			const FSoftObjectPath CandidateSoftObjectPath(CandidateObjectPath);
+		// t=2.0에서 A는 아직 debounce 중이고 B, C 중 이름 순 첫 항목 하나만 나와야 한다.
+		TArray<FCommandletWatchPendingPackage> FirstBatch;
+		const int32 FirstCount = DequeueCommandletWatchBatch(WatchQueue, 2.0, 1.0, 1, FirstBatch);
+		const bool bFirstOrdered = FirstCount == 1 && FirstBatch[0].PackageName == TEXT("/Game/Watch/B");
+		const double PendingLagSeconds = GetCommandletWatchLagSeconds(WatchQueue, WatchStatus, 2.0);
+		const bool bPendingCaughtUp = IsCommandletWatchCaughtUp(WatchQueue, WatchStatus);
 
-			// CandidateLoadedObject는 후보 경로가 실제 로드 가능한 자산인지 직접 확인한 결과다.
-			UObject* CandidateLoadedObject = CandidateSoftObjectPath.TryLoad();
-			if (DoesLoadedAssetMatchValidationCase(CandidateLoadedObject, InCaseDefinition))
-			{
-				OutResolvedObjectPath = CandidateSoftObjectPath.ToString();
-				return true;
-			}
-		}
+		// t=3.0에서는 A(첫 event 0.0)가 C보다 먼저 나오고, 처리 중 A가 lag 기준으로 남아야 한다.
+		TArray<FCommandletWatchPendingPackage> SecondBatch;
+		const int32 SecondCount = DequeueCommandletWatchBatch(WatchQueue, 3.0, 1.0, 8, SecondBatch);
+		const bool bSecondOrdered = SecondCount == 2
+			&& SecondBatch[0].PackageName == TEXT("/Game/Watch/A")
+			&& SecondBatch[1].PackageName == TEXT("/Game/Watch/C");
+		WatchStatus.InFlightPackageCount = SecondCount;
+		WatchStatus.InFlightFirstEventSeconds = SecondCount > 0 ? SecondBatch[0].FirstEventSeconds : 0.0;
+		const double InFlightLagSeconds = GetCommandletWatchLagSeconds(WatchQueue, WatchStatus, 3.0);
+		WatchStatus.InFlightPackageCount = 0;
 
-		if (InCaseDefinition.DiscoveryClassName.IsEmpty() && InCaseDefinition.DiscoveryAssetFamily.IsEmpty())
-		{
+		const TSharedRef<FJsonObject> StatusObject = BuildCommandletWatchStatusObject(WatchQueue, WatchStatus, 3.0);
+		const bool bStatusCaughtUp = StatusObject->GetStringField(TEXT("schema_version")) == TEXT("watch_status_v1")
+			&& StatusObject->GetBoolField(TEXT("caught_up"))
+			&& StatusObject->GetIntegerField(TEXT("queue_depth")) == 0
+			&& StatusObject->GetNumberField(TEXT("lag_seconds")) == 0.0
+			&& StatusObject->GetIntegerField(TEXT("event_count")) == 4;
+
+		const FString InitialBatchCommandLine = BuildWatchInitialBatchCommandLine(TEXT("-Mode=Watch -Root=/Game/Watch"));
+		const FString ExplicitBatchCommandLine = BuildWatchInitialBatchCommandLine(TEXT("-Mode=watch -ChangedOnly=false"));
+		const bool bCommandLineConverted = InitialBatchCommandLine == TEXT("-Mode=batchdump -Root=/Game/Watch -ChangedOnly=true")
+			&& ExplicitBatchCommandLine == TEXT("-Mode=batchdump -ChangedOnly=false");
+
+		FString WatchPackageName;
+		const bool bRootFiltered = !TryConvertWatchFileToPackageName(TEXT("Notes.txt"), TEXT("/Game"), WatchPackageName);
+
+		OutDetail = FString::Printf(
+			TEXT("first=%d second=%d pending_lag=%.2f in_flight_lag=%.2f pending_caught_up=%s status_caught_up=%s command_line=%s"),
+			FirstCount,
+			SecondCount,
+			PendingLagSeconds,
+			InFlightLagSeconds,
+			bPendingCaughtUp ? TEXT("true") : TEXT("false"),
+			bStatusCaughtUp ? TEXT("true") : TEXT("false"),
+			*InitialBatchCommandLine);
+		return bFirstOrdered
+			&& FMath::IsNearlyEqual(PendingLagSeconds, 2.0)
+			&& !bPendingCaughtUp
+			&& bSecondOrdered
+			&& FMath::IsNearlyEqual(InFlightLagSeconds, 3.0)
+			&& bStatusCaughtUp
+			&& bCommandLineConverted
+			&& bRootFiltered;
+	}
+
+	// VerifyWatchPackDeletion은 -Pack=true watch 삭제가 pack 항목만 있는 자산 dump를 commit TOC에서 빼고, 이름이 겹치는 형제 폴더 항목은 남기는지 검증한다.
+	bool VerifyWatchPackDeletion(FString& OutDetail)
+	{
+		// PackRoot는 남은 pack 항목 수를 세므로 이전 실행의 dump_pack.adpk가 없는 빈 dump root에서 시작한다.
+		const FCommandletSmokeFixtureRoot PackRoot(TEXT("WatchPackDeletion"));
+		const FString& PackRootPath = PackRoot.Path;
+		const FString PackFilePath = FPaths::Combine(PackRootPath, ADumpPack::GetPackFileName());
+		const FString RemovedDirectoryPath = FPaths::Combine(PackRootPath, TEXT("_Game_Watch_BP_A"));
+		const FString SiblingDirectoryPath = FPaths::Combine(PackRootPath, TEXT("_Game_Watch_BP_AB"));
+		const FString RemovedManifestFilePath = FPaths::Combine(RemovedDirectoryPath, TEXT("manifest.json"));
+		const FString SiblingManifestFilePath = FPaths::Combine(SiblingDirectoryPath, TEXT("manifest.json"));
+
+		FADumpOutputEncoding PackEncoding;
+		PackEncoding.PackFilePath = PackFilePath;
+		PackEncoding.bCompactJson = true;
+
+		FString SaveErrorMessage;
+		FString PackErrorCode;
+		FString PackErrorDetail;
+		if (!ADumpJson::SaveJsonTextToFile(RemovedManifestFilePath, TEXT("{\"asset\":{\"object_path\":\"/Game/Watch/BP_A.BP_A\"}}"), PackEncoding, SaveErrorMessage)
+			|| !ADumpJson::SaveJsonTextToFile(FPaths::Combine(RemovedDirectoryPath, TEXT("summary.json")), TEXT("{}"), PackEncoding, SaveErrorMessage)
+			|| !ADumpJson::SaveJsonTextToFile(SiblingManifestFilePath, TEXT("{\"asset\":{\"object_path\":\"/Game/Watch/BP_AB.BP_AB\"}}"), PackEncoding, SaveErrorMessage)
+			|| !ADumpPack::ClosePack(PackFilePath, PackErrorCode, PackErrorDetail))
+		{
+			OutDetail = FString::Printf(TEXT("fixture_failed=%s%s"), *SaveErrorMessage, *PackErrorCode);
 			return false;
 		}
 
-		// SearchRootPathArray는 자동 탐색 시 검사할 대표 루트 경로 목록이다.
-		const TArray<FString> SearchRootPathArray = { TEXT("/AssetDump"), TEXT("/Game"), TEXT("/Engine") };
-		for (const FString& SearchRootPath : SearchRootPathArray)
-		{
-			// SearchFilter는 현재 루트 경로에서 재귀적으로 자산을 찾는 필터다.
-			FARFilter SearchFilter;
-			SearchFilter.bRecursivePaths = true;
-			SearchFilter.PackagePaths.Add(*SearchRootPath);
+		// watch 삭제 경로처럼 pack 안 manifest로 object_path를 확인한 뒤 지우고, batch 끝 commit으로 공개한다.
+		const bool bManifestResolved = !IFileManager::Get().DirectoryExists(*RemovedDirectoryPath)
+			&& ADumpJson::LoadManifestObjectPath(RemovedManifestFilePath) == TEXT("/Game/Watch/BP_A.BP_A");
+		const bool bRemoved = RemoveWatchAssetDump(RemovedDirectoryPath, PackFilePath);
+		const bool bCommitted = ADumpPack::ClosePack(PackFilePath, PackErrorCode, PackErrorDetail);
 
-			// DiscoveredAssetArray는 현재 루트 경로에서 찾은 자산 목록이다.
-			TArray<FAssetData> DiscoveredAssetArray;
-			InAssetRegistryModule.Get().GetAssets(SearchFilter, DiscoveredAssetArray);
+		TArray<FString> PackedFilePaths;
+		ADumpPack::FindPackedFiles(PackRootPath, TEXT("*.json"), PackedFilePaths);
+		const bool bRemovedHidden = !ADumpJson::DoesJsonFileExist(RemovedManifestFilePath)
+			&& ADumpJson::LoadManifestObjectPath(RemovedManifestFilePath).IsEmpty();
+		const bool bSiblingKept = ADumpJson::LoadManifestObjectPath(SiblingManifestFilePath) == TEXT("/Game/Watch/BP_AB.BP_AB");
 
-			for (const FAssetData& DiscoveredAssetData : DiscoveredAssetArray)
-			{
-				// DiscoveredClassName는 현재 자산의 AssetRegistry 클래스 이름이다.
-				if (!InCaseDefinition.DiscoveryClassName.IsEmpty())
-				{
-					const FString DiscoveredClassName = DiscoveredAssetData.AssetClassPath.GetAssetName().ToString();
-					if (!DiscoveredClassName.Equals(InCaseDefinition.DiscoveryClassName, ESearchCase::CaseSensitive))
-					{
-						continue;
-					}
-				}
+		// 이미 빠진 자산을 다시 지우면 아무것도 지우지 않았다고 보고해야 RemovedCount가 두 번 오르지 않는다.
+		const bool bRepeatRemoved = RemoveWatchAssetDump(RemovedDirectoryPath, PackFilePath);
+		ADumpPack::ClosePack(PackFilePath, PackErrorCode, PackErrorDetail);
 
-				UObject* DiscoveredLoadedObject = DiscoveredAssetData.GetAsset();
-				if (!DoesLoadedAssetMatchValidationCase(DiscoveredLoadedObject, InCaseDefinition))
-				{
-					continue;
-				}
+		OutDetail = FString::Printf(
+			TEXT("resolved=%s removed=%s committed=%s packed_files=%d removed_hidden=%s sibling_kept=%s repeat_removed=%s"),
+			bManifestResolved ? TEXT("true") : TEXT("false"),
+			bRemoved ? TEXT("true") : TEXT("false"),
+			bCommitted ? TEXT("true") : TEXT("false"),
+			PackedFilePaths.Num(),
+			bRemovedHidden ? TEXT("true") : TEXT("false"),
+			bSiblingKept ? TEXT("true") : TEXT("false"),
+			bRepeatRemoved ? TEXT("true") : TEXT("false"));
+		return bManifestResolved
+			&& bRemoved
+			&& bCommitted
+			&& PackedFilePaths.Num() == 1
+			&& bRemovedHidden
+			&& bSiblingKept
+			&& !bRepeatRemoved;
+	}
+
+	// VerifyRegistryScanCache는 plugin root 상태 cache의 저장 후 재사용, stamp 비교와 process 내 중복 scan 생략을 검증한다.
+	bool VerifyRegistryScanCache(FString& OutDetail)
+	{
+		// RegistryCacheRoot는 첫 scan이 저장된 cache 없이 시작해야 두 번째 scan의 재사용을 구분할 수 있다.
+		const FCommandletSmokeFixtureRoot RegistryCacheRoot(TEXT("RegistryCacheCheck"));
+		const FString& RegistryCacheTestDirectory = RegistryCacheRoot.Path;
+
+		const FADumpRegistryScanReport FirstReport = ADumpRegistryCache::ScanRootWithStateCache(TEXT("/AssetDump"), RegistryCacheTestDirectory);
+		const FADumpRegistryScanReport SecondReport = ADumpRegistryCache::ScanRootWithStateCache(TEXT("/AssetDump"), RegistryCacheTestDirectory);
+
+		TMap<FString, FString> CachedStampByFile;
+		CachedStampByFile.Add(TEXT("A.uasset"), TEXT("10:1"));
+		CachedStampByFile.Add(TEXT("B.uasset"), TEXT("10:1"));
+		CachedStampByFile.Add(TEXT("Maps/C.umap"), TEXT("20:1"));
+		TMap<FString, FString> CurrentStampByFile;
+		CurrentStampByFile.Add(TEXT("A.uasset"), TEXT("10:1"));
+		CurrentStampByFile.Add(TEXT("B.uasset"), TEXT("11:2"));
+		CurrentStampByFile.Add(TEXT("D.uasset"), TEXT("5:3"));
+		TArray<FString> ChangedFiles;
+		TArray<FString> RemovedFiles;
+		ADumpRegistryCache::DiffPackageFileStamps(CachedStampByFile, CurrentStampByFile, ChangedFiles, RemovedFiles);
+		const bool bStampDiffPassed = ChangedFiles == TArray<FString>({ TEXT("B.uasset"), TEXT("D.uasset") })
+			&& RemovedFiles == TArray<FString>({ TEXT("Maps/C.umap") });
+
+		const TArray<FString> RepeatedScanPaths = { TEXT("/AssetDump") };
+		ADumpRegistryCache::ScanPathsOnce(RepeatedScanPaths, FString());
+		const TArray<FADumpRegistryScanReport> RepeatedReports = ADumpRegistryCache::ScanPathsOnce(RepeatedScanPaths, FString());
+		const bool bRepeatedSkipped = RepeatedReports.Num() == 1 && RepeatedReports[0].bSkippedInProcess;
 
-				OutResolvedObjectPath = DiscoveredAssetData.GetObjectPathString();
-				return true;
-			}
+		OutDetail = FString::Printf(
+			TEXT("first_saved=%s second_loaded=%s package_files=%d second_changed=%d first_ms=%.1f second_ms=%.1f stamp_diff=%s repeated_skipped=%s error=%s"),
+			FirstReport.bCacheSaved ? TEXT("true") : TEXT("false"),
+			SecondReport.bCacheLoaded ? TEXT("true") : TEXT("false"),
+			SecondReport.PackageFileCount,
+			SecondReport.ChangedFileCount + SecondReport.RemovedFileCount,
+			FirstReport.ScanMilliseconds,
+			SecondReport.ScanMilliseconds,
+			bStampDiffPassed ? TEXT("true") : TEXT("false"),
+			bRepeatedSkipped ? TEXT("true") : TEXT("false"),
+			*(FirstReport.CacheErrorCode + SecondReport.CacheErrorCode));
+		return FirstReport.bCacheSaved
+			&& !FirstReport.bCacheLoaded
+			&& SecondReport.bCacheLoaded
+			&& !SecondReport.bCacheSaved
+			&& SecondReport.ChangedFileCount == 0
+			&& SecondReport.RemovedFileCount == 0
+			&& SecondReport.PackageFileCount == FirstReport.PackageFileCount
+			&& bStampDiffPassed
+			&& bRepeatedSkipped;
+	}
+
+	// ValidateDelegatedSectionDumpArguments는 sectiondump를 query module에 넘기기 전에 기존 commandlet 순서대로 인자를 검사한다.
+	// -Sections=/-Intent=/-Profile= 이름 오류가 먼저이고, 그다음 -Output=, -Sections= 필수, 선택 source, selector 순이다.
+	bool ValidateDelegatedSectionDumpArguments(const FString& InCommandLine, FString& OutErrorMessage)
+	{
+		FADumpSectionSelection SectionSelection;
+		FString IntentName;
+		FADumpSectionSelection IntentSectionSelection;
+		FString ProfileName;
+		FADumpSectionSelection ProfileSectionSelection;
+		if (!TryParseSectionSelection(InCommandLine, SectionSelection, OutErrorMessage)
+			|| !TryParseIntentSelection(InCommandLine, IntentName, IntentSectionSelection, OutErrorMessage)
+			|| !TryParseProfileSelection(InCommandLine, ProfileName, ProfileSectionSelection, OutErrorMessage))
+		{
+			return false;
 		}
-
-		return false;
+		return ADumpReadQuery::ValidateSectionDumpArguments(InCommandLine, OutErrorMessage);
 	}
 
-	// AddValidationCheck는 validate 케이스 report에 검사 한 건을 추가하고 필수 실패를 누적한다.
-	void AddValidationCheck(
-		TArray<TSharedPtr<FJsonValue>>& InOutCheckArray,
-		bool& InOutCasePassed,
-		const FString& InCheckName,
-		bool bInPassed,
-		const FString& InExpectedText,
-		const FString& InActualText,
-		bool bInRequired)
+	// VerifyReadQueryModule은 AssetDumpQuery module의 section registry와 -Sections= 파싱이 commandlet 선택 규칙과 같고 read-only mode 판정이 맞는지 검사한다.
+	bool VerifyReadQueryModule(FString& OutDetail)
 	{
-		// CheckObject는 검사 한 건을 report에 기록할 JSON object다.
-		TSharedRef<FJsonObject> CheckObject = MakeShared<FJsonObject>();
-		CheckObject->SetStringField(TEXT("name"), InCheckName);
-		CheckObject->SetBoolField(TEXT("passed"), bInPassed);
-		CheckObject->SetBoolField(TEXT("required"), bInRequired);
-		CheckObject->SetStringField(TEXT("expected"), InExpectedText);
-		CheckObject->SetStringField(TEXT("actual"), InActualText);
-		InOutCheckArray.Add(MakeShared<FJsonValueObject>(CheckObject));
+		FADumpSectionSelection AllSectionSelection;
+		AllSectionSelection.ResetToExplicitMode();
+		for (const FString& SectionName : ADumpReadQuery::GetSectionNameRegistry())
+		{
+			EADumpSection ResolvedSection = EADumpSection::Summary;
+			if (TryResolveDumpSection(SectionName, ResolvedSection))
+			{
+				AllSectionSelection.Enable(ResolvedSection);
+			}
+		}
+		const bool bRegistryMatched = AllSectionSelection.GetEnabledNames() == ADumpReadQuery::GetSectionNameRegistry()
+			&& FString::Join(ADumpReadQuery::GetSectionNameRegistry(), TEXT(",")) == GetValidSectionNamesText();
 
-		if (bInRequired && !bInPassed)
+		// SectionCommandLines는 정상/중복/빈 이름/알 수 없는 이름/생략 입력이다. 두 parser의 성공 여부, 이름 순서와 오류 문구가 같아야 한다.
+		const TCHAR* SectionCommandLines[] = {
+			TEXT("-Mode=sectiondump -Sections=graphs,Summary,graphs"),
+			TEXT("-Mode=sectiondump -Sections=summary,,digest"),
+			TEXT("-Mode=sectiondump -Sections=summary,unknown_section"),
+			TEXT("-Mode=sectiondump -Asset=/Game/A.A")
+		};
+		int32 SectionParseMismatchCount = 0;
+		for (const TCHAR* SectionCommandLine : SectionCommandLines)
 		{
-			InOutCasePassed = false;
+			FADumpSectionSelection CommandletSelection;
+			FString CommandletError;
+			const bool bCommandletParsed = TryParseSectionSelection(SectionCommandLine, CommandletSelection, CommandletError);
+			TArray<FString> ReadQuerySectionNames;
+			FString ReadQueryError;
+			const bool bReadQueryParsed = ADumpReadQuery::TryParseSectionNames(SectionCommandLine, ReadQuerySectionNames, ReadQueryError);
+			if (bCommandletParsed != bReadQueryParsed
+				|| CommandletError != ReadQueryError
+				|| (bCommandletParsed && CommandletSelection.GetEnabledNames() != ReadQuerySectionNames))
+			{
+				++SectionParseMismatchCount;
+			}
 		}
-	}
 
-	// ResolveExpectedGraphNodeRoleFamily는 primary role의 canonical family를 반환한다.
-	FString ResolveExpectedGraphNodeRoleFamily(const FString& InPrimaryRole)
-	{
-		if (InPrimaryRole == TEXT("event") || InPrimaryRole == TEXT("execution_entry")) return TEXT("entry");
-		if (InPrimaryRole == TEXT("function_call") || InPrimaryRole == TEXT("interface_call")) return TEXT("call");
-		if (InPrimaryRole == TEXT("variable_get") || InPrimaryRole == TEXT("variable_set")) return TEXT("variable");
-		if (InPrimaryRole == TEXT("dynamic_cast")) return TEXT("conversion");
-		if (InPrimaryRole == TEXT("branch") || InPrimaryRole == TEXT("sequence") || InPrimaryRole == TEXT("switch") || InPrimaryRole == TEXT("flow_control")) return TEXT("control_flow");
-		if (InPrimaryRole == TEXT("select") || InPrimaryRole == TEXT("pure_expression")) return TEXT("data_flow");
-		if (InPrimaryRole == TEXT("timeline")) return TEXT("timing");
-		if (InPrimaryRole == TEXT("execution_sink") || InPrimaryRole == TEXT("impure_operation")) return TEXT("operation");
-		return TEXT("unknown");
-	}
+		const TCHAR* ReadQueryModes[] = {
+			TEXT("entityquery"), TEXT("entitycontext"), TEXT("sectiondump"),
+			TEXT("dependencyquery"), TEXT("Query"), TEXT("contextbundle"), TEXT("inputquery")
+		};
+		const int32 ExpectedReadQueryModeCount = UE_ARRAY_COUNT(ReadQueryModes);
+		int32 ReadQueryModeCount = 0;
+		for (const TCHAR* ReadQueryMode : ReadQueryModes)
+		{
+			ReadQueryModeCount += ADumpReadQuery::IsReadQueryMode(ReadQueryMode) ? 1 : 0;
+		}
+		const bool bEditorModesExcluded = !ADumpReadQuery::IsReadQueryMode(TEXT("bpdump"))
+			&& !ADumpReadQuery::IsReadQueryMode(TEXT("index"))
+			&& !ADumpReadQuery::IsReadQueryMode(TEXT("search"));
 
-	// GetGraphNodeRoleTagRank는 deterministic tag registry 순서를 반환한다.
-	int32 GetGraphNodeRoleTagRank(const FString& InTag)
-	{
-		if (InTag == TEXT("pure")) return 0;
-		if (InTag == TEXT("impure")) return 1;
-		if (InTag == TEXT("latent")) return 2;
-		if (InTag == TEXT("has_exec_input")) return 3;
-		if (InTag == TEXT("has_exec_output")) return 4;
-		if (InTag == TEXT("interface")) return 5;
-		if (InTag == TEXT("member_access")) return 6;
-		if (InTag == TEXT("conditional")) return 7;
-		if (InTag == TEXT("multi_output")) return 8;
-		return INDEX_NONE;
+		OutDetail = FString::Printf(
+			TEXT("registry_matched=%s section_parse_mismatches=%d read_query_modes=%d/%d editor_modes_excluded=%s"),
+			bRegistryMatched ? TEXT("true") : TEXT("false"),
+			SectionParseMismatchCount,
+			ReadQueryModeCount,
+			ExpectedReadQueryModeCount,
+			bEditorModesExcluded ? TEXT("true") : TEXT("false"));
+		return bRegistryMatched
+			&& SectionParseMismatchCount == 0
+			&& ReadQueryModeCount == ExpectedReadQueryModeCount
+			&& bEditorModesExcluded;
 	}
 
-	// TestGraphNodeRoleContract는 role schema, canonical 값, pin 구조, tag와 legacy semantic 일치를 검사한다.
-	bool TestGraphNodeRoleContract(const FADumpGraphNode& InNode, FString& OutFailureReason)
+	// VerifySectionDumpArgumentOrder는 query module로 옮긴 sectiondump가 commandlet 위임 경로에서 기존 오류 순서와 코드를 그대로 내는지 검사한다.
+	bool VerifySectionDumpArgumentOrder(FString& OutDetail)
 	{
-		OutFailureReason.Reset();
+		struct FSectionDumpArgumentCase
+		{
+			const TCHAR* CommandLine;
+			const TCHAR* ExpectedErrorPrefix;
+		};
 
-		const TArray<FString> CanonicalPrimaryRoles = {
-			TEXT("event"), TEXT("function_call"), TEXT("interface_call"), TEXT("variable_get"), TEXT("variable_set"),
-			TEXT("dynamic_cast"), TEXT("branch"), TEXT("sequence"), TEXT("select"), TEXT("switch"), TEXT("timeline"),
-			TEXT("execution_entry"), TEXT("execution_sink"), TEXT("flow_control"), TEXT("pure_expression"),
-			TEXT("impure_operation"), TEXT("unknown") };
-		const TArray<FString> CanonicalSources = { TEXT("exact_class"), TEXT("function_metadata"), TEXT("structural_inference"), TEXT("fallback") };
-		const TArray<FString> CanonicalConfidence = { TEXT("exact"), TEXT("inferred"), TEXT("fallback") };
+		// ArgumentCases는 오류가 둘 이상 겹친 입력에서 먼저 보고되어야 하는 오류다. 빈 prefix는 인자 검사 통과를 뜻한다.
+		const FSectionDumpArgumentCase ArgumentCases[] = {
+			{ TEXT("-Mode=sectiondump -Asset=/Game/A.A"), TEXT("ADUMP_LAZY_DUMP_OUTPUT_REQUIRED:") },
+			{ TEXT("-Mode=sectiondump -Sections=summary -Intent=quick_overview -Asset=/Game/A.A"), TEXT("ADUMP_LAZY_DUMP_OUTPUT_REQUIRED:") },
+			{ TEXT("-Mode=sectiondump -Sections=summary,unknown_section -Asset=/Game/A.A"), TEXT("Unknown section 'unknown_section' in -Sections=.") },
+			{ TEXT("-Mode=sectiondump -Sections=summary -Intent=unknown_intent -Asset=/Game/A.A"), TEXT("Unknown intent 'unknown_intent' in -Intent=.") },
+			{ TEXT("-Mode=sectiondump -Sections=summary -Profile=unknown_profile -Output=C:/Temp/out.json -Asset=/Game/A.A"), TEXT("Unknown profile 'unknown_profile' in -Profile=.") },
+			{ TEXT("-Mode=sectiondump -Intent=quick_overview -Output=C:/Temp/out.json -Asset=/Game/A.A"), TEXT("ADUMP_LAZY_DUMP_SECTIONS_REQUIRED:") },
+			{ TEXT("-Mode=sectiondump -Sections=summary -Profile=summary_only -Output=C:/Temp/out.json"), TEXT("ADUMP_LAZY_DUMP_SELECTION_SOURCE_UNSUPPORTED:") },
+			{ TEXT("-Mode=sectiondump -Sections=summary -Output=C:/Temp/out.json"), TEXT("ADUMP_LAZY_DUMP_SELECTOR_REQUIRED:") },
+			{ TEXT("-Mode=sectiondump -Sections=summary -Output=C:/Temp/out.json -Asset=/Game/A.A"), TEXT("") }
+		};
 
-		if (InNode.Role.SchemaVersion != TEXT("graph_node_role_v1"))
+		int32 MismatchCount = 0;
+		FString FirstMismatch;
+		for (const FSectionDumpArgumentCase& ArgumentCase : ArgumentCases)
 		{
-			OutFailureReason = FString::Printf(TEXT("schema=%s"), *InNode.Role.SchemaVersion);
-			return false;
+			FString ErrorMessage;
+			const bool bValidated = ValidateDelegatedSectionDumpArguments(ArgumentCase.CommandLine, ErrorMessage);
+			const bool bExpectedValid = FCString::Strlen(ArgumentCase.ExpectedErrorPrefix) == 0;
+			if (bValidated != bExpectedValid || (!bExpectedValid && !ErrorMessage.StartsWith(ArgumentCase.ExpectedErrorPrefix, ESearchCase::CaseSensitive)))
+			{
+				if (MismatchCount == 0)
+				{
+					FirstMismatch = FString::Printf(TEXT("%s -> %s"), ArgumentCase.CommandLine, *ErrorMessage);
+				}
+				++MismatchCount;
+			}
 		}
-		if (!CanonicalPrimaryRoles.Contains(InNode.Role.Primary))
-		{
-			OutFailureReason = FString::Printf(TEXT("primary=%s"), *InNode.Role.Primary);
+
+		OutDetail = FString::Printf(
+			TEXT("cases=%d mismatches=%d first_mismatch=%s"),
+			UE_ARRAY_COUNT(ArgumentCases),
+			MismatchCount,
+			FirstMismatch.IsEmpty() ? TEXT("none") : *FirstMismatch);
+		return MismatchCount == 0;
+	}
+
+	// MakeInputIndexFixtureMapping은 input_summary mappings 항목 fixture JSON 한 건을 만든다.
+	FString MakeInputIndexFixtureMapping(int32 InSourceIndex, const TCHAR* InActionName, const TCHAR* InKeyName, const TCHAR* InTriggerName)
+	{
+		const FString ActionPath = FCString::Strlen(InActionName) > 0
+			? FString::Printf(TEXT("/Game/Input/%s.%s"), InActionName, InActionName)
+			: FString();
+		return FString::Printf(
+			TEXT("{\"source_index\":%d,\"action_path\":\"%s\",\"action_name\":\"%s\",\"key_name\":\"%s\",\"key_display_name\":\"%s\",\"key_valid\":true,\"modifiers\":[],\"triggers\":[{\"class_name\":\"%s\"}]}"),
+			InSourceIndex,
+			*ActionPath,
+			InActionName,
+			InKeyName,
+			InKeyName,
+			InTriggerName);
+	}
+
+	// VerifyInputBindingIndex는 fixture input_summary section에서 전역 input index를 만들고 key/action 질의와 세 충돌 종류를 검증한다.
+	bool VerifyInputBindingIndex(FString& OutDetail)
+	{
+		// InputIndexRoot는 fixture input_summary만 색인되도록 다른 dump가 섞이지 않은 root다.
+		const FCommandletSmokeFixtureRoot InputIndexRoot(TEXT("InputBindingIndex"));
+		const FString& InputIndexRootPath = InputIndexRoot.Path;
+
+		// Default는 SpaceBar를 Jump/Interact에 묶고 E를 Interact에 두 번 묶는다. Vehicle은 SpaceBar를 Brake에 묶고 action 없는 mapping을 하나 가진다.
+		const FString DefaultContextText = FString::Printf(
+			TEXT("{\"input_summary\":{\"supported\":true,\"asset_kind\":\"input_mapping_context\",\"mapping_count\":4,\"mapping_truncated\":false,\"mappings\":[%s,%s,%s,%s]}}"),
+			*MakeInputIndexFixtureMapping(0, TEXT("IA_Jump"), TEXT("SpaceBar"), TEXT("InputTriggerPressed")),
+			*MakeInputIndexFixtureMapping(1, TEXT("IA_Interact"), TEXT("SpaceBar"), TEXT("InputTriggerHold")),
+			*MakeInputIndexFixtureMapping(2, TEXT("IA_Interact"), TEXT("E"), TEXT("InputTriggerPressed")),
+			*MakeInputIndexFixtureMapping(3, TEXT("IA_Interact"), TEXT("E"), TEXT("InputTriggerPressed")));
+		const FString VehicleContextText = FString::Printf(
+			TEXT("{\"supported\":true,\"asset_kind\":\"input_mapping_context\",\"mapping_count\":2,\"mapping_truncated\":false,\"mappings\":[%s,%s]}"),
+			*MakeInputIndexFixtureMapping(0, TEXT("IA_Brake"), TEXT("SpaceBar"), TEXT("InputTriggerDown")),
+			*MakeInputIndexFixtureMapping(1, TEXT(""), TEXT("F"), TEXT("InputTriggerDown")));
+		const FString JumpActionText = TEXT("{\"supported\":true,\"asset_kind\":\"input_action\",\"value_type\":\"Boolean\",\"modifiers\":[],\"triggers\":[{\"class_name\":\"InputTriggerPressed\"}],\"mapping_count\":0,\"mappings\":[]}");
+		const FString SectionIndexText = TEXT("{\"schema_version\":\"section_index_v1\",\"sections\":[")
+			TEXT("{\"section_name\":\"input_summary\",\"object_path\":\"/Game/Input/IMC_Vehicle.IMC_Vehicle\",\"source_file\":\"IMC_Vehicle/input_summary.json\",\"json_pointer\":\"/\"},")
+			TEXT("{\"section_name\":\"input_summary\",\"object_path\":\"/Game/Input/IMC_Default.IMC_Default\",\"source_file\":\"IMC_Default/manifest.json\",\"json_pointer\":\"/input_summary\"},")
+			TEXT("{\"section_name\":\"input_summary\",\"object_path\":\"/Game/Input/IA_Jump.IA_Jump\",\"source_file\":\"IA_Jump/input_summary.json\",\"json_pointer\":\"/\"},")
+			TEXT("{\"section_name\":\"summary\",\"object_path\":\"/Game/Input/IA_Jump.IA_Jump\",\"source_file\":\"IA_Jump/summary.json\",\"json_pointer\":\"/\"}]}");
+
+		const bool bFixtureWritten = FFileHelper::SaveStringToFile(DefaultContextText, *FPaths::Combine(InputIndexRootPath, TEXT("IMC_Default"), TEXT("manifest.json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+			&& FFileHelper::SaveStringToFile(VehicleContextText, *FPaths::Combine(InputIndexRootPath, TEXT("IMC_Vehicle"), TEXT("input_summary.json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+			&& FFileHelper::SaveStringToFile(JumpActionText, *FPaths::Combine(InputIndexRootPath, TEXT("IA_Jump"), TEXT("input_summary.json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+			&& FFileHelper::SaveStringToFile(SectionIndexText, *FPaths::Combine(InputIndexRootPath, TEXT("section_index.json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+		if (!bFixtureWritten)
+		{
+			OutDetail = TEXT("fixture_write_failed");
 			return false;
 		}
-		const FString ExpectedFamily = ResolveExpectedGraphNodeRoleFamily(InNode.Role.Primary);
-		if (InNode.Role.Family != ExpectedFamily)
+
+		FString InputIndexFilePath;
+		FString InputErrorCode;
+		FString InputErrorDetail;
+		if (!ADumpInputIndex::BuildInputBindingIndex(InputIndexRootPath, InputIndexFilePath, InputErrorCode, InputErrorDetail))
 		{
-			OutFailureReason = FString::Printf(TEXT("family=%s expected=%s"), *InNode.Role.Family, *ExpectedFamily);
+			OutDetail = FString::Printf(TEXT("build_failed=%s %s"), *InputErrorCode, *InputErrorDetail);
 			return false;
 		}
-		if (!CanonicalSources.Contains(InNode.Role.Source) || !CanonicalConfidence.Contains(InNode.Role.Confidence))
+
+		// RunInputQuery는 inputquery 결과를 JSON object로 읽는다. 실패하면 오류 코드를 남기고 null을 반환한다.
+		auto RunInputQuery = [&InputIndexRootPath](const FString& InSelector, FString& OutQueryErrorCode)
 		{
-			OutFailureReason = FString::Printf(TEXT("source=%s confidence=%s"), *InNode.Role.Source, *InNode.Role.Confidence);
-			return false;
-		}
+			FString QueryJsonText;
+			FString QueryErrorDetail;
+			TSharedPtr<FJsonObject> QueryRootObject;
+			const FString QueryCommandLine = FString::Printf(TEXT("-Mode=inputquery -DumpRoot=\"%s\" %s"), *InputIndexRootPath, *InSelector);
+			if (ADumpInputIndex::BuildInputQueryJson(QueryCommandLine, QueryJsonText, OutQueryErrorCode, QueryErrorDetail))
+			{
+				TSharedRef<TJsonReader<>> QueryReader = TJsonReaderFactory<>::Create(QueryJsonText);
+				FJsonSerializer::Deserialize(QueryReader, QueryRootObject);
+			}
+			return QueryRootObject;
+		};
 
-		bool bHasExecInput = false;
-		bool bHasExecOutput = false;
-		for (const FADumpGraphPin& Pin : InNode.Pins)
+		FString KeyQueryErrorCode;
+		const TSharedPtr<FJsonObject> KeyQueryObject = RunInputQuery(TEXT("-Key=spacebar"), KeyQueryErrorCode);
+		int32 KeyBindingCount = INDEX_NONE;
+		TArray<FString> KeyConflictKinds;
+		bool bSameContextTriggerDistinct = false;
+		if (KeyQueryObject.IsValid())
 		{
-			if (!Pin.bIsExec)
+			KeyQueryObject->TryGetNumberField(TEXT("total_binding_count"), KeyBindingCount);
+			const TArray<TSharedPtr<FJsonValue>>* ConflictValues = nullptr;
+			if (KeyQueryObject->TryGetArrayField(TEXT("conflicts"), ConflictValues))
 			{
-				continue;
+				for (const TSharedPtr<FJsonValue>& ConflictValue : *ConflictValues)
+				{
+					const TSharedPtr<FJsonObject> ConflictObject = ConflictValue.IsValid() ? ConflictValue->AsObject() : nullptr;
+					FString ConflictKind;
+					if (ConflictObject.IsValid() && ConflictObject->TryGetStringField(TEXT("kind"), ConflictKind))
+					{
+						KeyConflictKinds.Add(ConflictKind);
+						if (ConflictKind == TEXT("same_context"))
+						{
+							ConflictObject->TryGetBoolField(TEXT("trigger_distinct"), bSameContextTriggerDistinct);
+						}
+					}
+				}
 			}
-			bHasExecInput |= Pin.Direction == TEXT("input");
-			bHasExecOutput |= Pin.Direction == TEXT("output");
 		}
-		if (InNode.Role.bHasExecInput != bHasExecInput || InNode.Role.bHasExecOutput != bHasExecOutput)
+		KeyConflictKinds.Sort();
+
+		FString ActionQueryErrorCode;
+		const TSharedPtr<FJsonObject> ActionQueryObject = RunInputQuery(TEXT("-Action=ia_interact"), ActionQueryErrorCode);
+		int32 ActionBindingCount = INDEX_NONE;
+		if (ActionQueryObject.IsValid())
 		{
-			OutFailureReason = TEXT("exec_pin_trait_mismatch");
-			return false;
+			ActionQueryObject->TryGetNumberField(TEXT("total_binding_count"), ActionBindingCount);
 		}
-		if (InNode.Role.bIsPure && (bHasExecInput || bHasExecOutput))
+
+		FString ConflictQueryErrorCode;
+		const TSharedPtr<FJsonObject> ConflictQueryObject = RunInputQuery(TEXT("-Conflicts=true"), ConflictQueryErrorCode);
+		int32 ConflictCount = INDEX_NONE;
+		if (ConflictQueryObject.IsValid())
 		{
-			OutFailureReason = TEXT("pure_node_has_exec_pin");
+			ConflictQueryObject->TryGetNumberField(TEXT("total_conflict_count"), ConflictCount);
+		}
+
+		FString MissingSelectorErrorCode;
+		const bool bMissingSelectorRejected = !RunInputQuery(TEXT(""), MissingSelectorErrorCode).IsValid()
+			&& MissingSelectorErrorCode == TEXT("ADUMP_INPUT_QUERY_SELECTOR_REQUIRED");
+
+		const FString KeyConflictKindsText = FString::Join(KeyConflictKinds, TEXT(","));
+		OutDetail = FString::Printf(
+			TEXT("key_bindings=%d key_conflicts=%s trigger_distinct=%s action_bindings=%d conflicts=%d selector_required=%s"),
+			KeyBindingCount,
+			*KeyConflictKindsText,
+			bSameContextTriggerDistinct ? TEXT("true") : TEXT("false"),
+			ActionBindingCount,
+			ConflictCount,
+			bMissingSelectorRejected ? TEXT("true") : TEXT("false"));
+		return KeyBindingCount == 3
+			&& KeyConflictKindsText == TEXT("cross_context,same_context")
+			&& bSameContextTriggerDistinct
+			&& ActionBindingCount == 3
+			&& ConflictCount == 3
+			&& bMissingSelectorRejected;
+	}
+
+	// MakeSymbolSearchFixtureSymbol은 section_index symbols 항목 fixture JSON 한 건을 만든다.
+	FString MakeSymbolSearchFixtureSymbol(const TCHAR* InAssetName, int32 InEntryIndex, const TCHAR* InKind, const TCHAR* InName, const TCHAR* InSearchTerm)
+	{
+		return FString::Printf(
+			TEXT("{\"object_path\":\"/Game/BP/%s.%s\",\"asset_id\":\"%s\",\"source_file\":\"%s/dump.json\",\"symbol_entry_id\":\"%s:%d\",\"kind\":\"%s\",\"name\":\"%s\",\"normalized_name\":\"%s\",\"graph_name\":\"EventGraph\",\"node_id\":\"N%d\",\"json_pointer\":\"/graphs/0/nodes/%d\",\"search_terms\":[\"%s\"]}"),
+			InAssetName,
+			InAssetName,
+			InAssetName,
+			InAssetName,
+			InAssetName,
+			InEntryIndex,
+			InKind,
+			InName,
+			*ADumpBPSearchIndex::NormalizeSearchName(InName),
+			InEntryIndex,
+			InEntryIndex,
+			InSearchTerm);
+	}
+
+	// VerifySymbolSearchIndex는 fixture symbols로 symbol_search_index_v1을 만들고 token prefix, trigram substring, exact와 kind 필터 결과 수를 검증한다.
+	bool VerifySymbolSearchIndex(FString& OutDetail)
+	{
+		// SearchRoot는 match 수를 정확히 비교하므로 fixture symbols 외의 section이 색인되면 안 된다.
+		const FCommandletSmokeFixtureRoot SearchRoot(TEXT("SymbolSearchIndex"));
+		const FString& SearchRootPath = SearchRoot.Path;
+
+		// BP_Player는 Apply_Damage 함수와 Max_Health 변수를, BP_Enemy는 Take_Damage 함수를 가진다.
+		const FString SectionIndexText = FString::Printf(
+			TEXT("{\"schema_version\":\"section_index_v1\",\"sections\":[],\"symbols\":[%s,%s,%s]}"),
+			*MakeSymbolSearchFixtureSymbol(TEXT("BP_Player"), 0, TEXT("function"), TEXT("Apply_Damage"), TEXT("ApplyDamage")),
+			*MakeSymbolSearchFixtureSymbol(TEXT("BP_Player"), 1, TEXT("variable"), TEXT("Max_Health"), TEXT("MaxHealth")),
+			*MakeSymbolSearchFixtureSymbol(TEXT("BP_Enemy"), 0, TEXT("function"), TEXT("Take_Damage"), TEXT("TakeDamage")));
+		FString SearchIndexFilePath;
+		FString SearchErrorCode;
+		FString SearchErrorDetail;
+		if (!FFileHelper::SaveStringToFile(SectionIndexText, *FPaths::Combine(SearchRootPath, TEXT("section_index.json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+			|| !ADumpSymbolSearch::BuildSymbolSearchIndex(SearchRootPath, SearchIndexFilePath, SearchErrorCode, SearchErrorDetail))
+		{
+			OutDetail = FString::Printf(TEXT("build_failed=%s %s"), *SearchErrorCode, *SearchErrorDetail);
 			return false;
 		}
 
-		TSet<FString> UniqueTags;
-		int32 PreviousTagRank = INDEX_NONE;
-		for (const FString& Tag : InNode.Role.Tags)
+		// CountMatches는 search 결과의 total_match_count를 읽는다. 실패하면 오류 코드를 남기고 -1이다.
+		auto CountMatches = [&SearchRootPath](const TCHAR* InArguments, FString& OutQueryErrorCode)
 		{
-			const int32 TagRank = GetGraphNodeRoleTagRank(Tag);
-			if (TagRank == INDEX_NONE || UniqueTags.Contains(Tag) || (PreviousTagRank != INDEX_NONE && TagRank <= PreviousTagRank))
+			FString ResultText;
+			FString ResultErrorDetail;
+			int32 MatchCount = INDEX_NONE;
+			const FString SearchCommandLine = FString::Printf(TEXT("-Mode=search -DumpRoot=\"%s\" %s"), *SearchRootPath, InArguments);
+			if (ADumpSymbolSearch::BuildSymbolSearchJson(SearchCommandLine, ResultText, OutQueryErrorCode, ResultErrorDetail))
 			{
-				OutFailureReason = FString::Printf(TEXT("invalid_tag=%s"), *Tag);
-				return false;
+				TSharedPtr<FJsonObject> ResultObject;
+				TSharedRef<TJsonReader<>> ResultReader = TJsonReaderFactory<>::Create(ResultText);
+				if (FJsonSerializer::Deserialize(ResultReader, ResultObject) && ResultObject.IsValid())
+				{
+					ResultObject->TryGetNumberField(TEXT("total_match_count"), MatchCount);
+				}
 			}
-			UniqueTags.Add(Tag);
-			PreviousTagRank = TagRank;
-		}
-		if (!InNode.Role.Tags.Contains(InNode.Role.bIsPure ? TEXT("pure") : TEXT("impure")))
-		{
-			OutFailureReason = TEXT("purity_tag_missing");
+			return MatchCount;
+		};
+
+		FString QueryErrorCode;
+		const int32 PrefixCount = CountMatches(TEXT("-Query=dam -Match=prefix"), QueryErrorCode);
+		const int32 SearchTermPrefixCount = CountMatches(TEXT("-Query=applyd -Match=prefix"), QueryErrorCode);
+		const int32 TrigramCount = CountMatches(TEXT("-Query=\"ly dam\" -Match=substring"), QueryErrorCode);
+		const int32 SubstringCount = CountMatches(TEXT("-Query=age -Match=substring"), QueryErrorCode);
+		const int32 KindFilteredCount = CountMatches(TEXT("-Query=age -Match=substring -Kinds=variable"), QueryErrorCode);
+		const int32 ExactCount = CountMatches(TEXT("-Query=Max_Health -Match=exact"), QueryErrorCode);
+		const int32 PartialExactCount = CountMatches(TEXT("-Query=max -Match=exact"), QueryErrorCode);
+		FString EmptyQueryErrorCode;
+		const bool bEmptyQueryRejected = CountMatches(TEXT("-Query="), EmptyQueryErrorCode) == INDEX_NONE
+			&& EmptyQueryErrorCode == TEXT("ADUMP_SEARCH_QUERY_REQUIRED");
+
+		OutDetail = FString::Printf(
+			TEXT("prefix=%d search_term_prefix=%d trigram=%d substring=%d kind_filtered=%d exact=%d partial_exact=%d empty_rejected=%s"),
+			PrefixCount,
+			SearchTermPrefixCount,
+			TrigramCount,
+			SubstringCount,
+			KindFilteredCount,
+			ExactCount,
+			PartialExactCount,
+			bEmptyQueryRejected ? TEXT("true") : TEXT("false"));
+		return PrefixCount == 2
+			&& SearchTermPrefixCount == 1
+			&& TrigramCount == 1
+			&& SubstringCount == 2
+			&& KindFilteredCount == 0
+			&& ExactCount == 1
+			&& PartialExactCount == 0
+			&& bEmptyQueryRejected;
+	}
+
+	// VerifyBatchChangeClosure는 fixture package graph에 ResolveBatchChangePlan을 적용해 reverse dependency closure와 자산별 redump_reason을 검증한다.
+	bool VerifyBatchChangeClosure(FString& OutDetail)
+	{
+		// ClosureRoot에는 fixture dump만 두어 이전 실행 dump의 dependency가 package graph에 섞이지 않게 한다.
+		const FCommandletSmokeFixtureRoot ClosureRoot(TEXT("BatchChangeClosure"));
+		const FString& ClosureRootPath = ClosureRoot.Path;
+
+		// A -> Lib -> Leaf, B -> A 체인과 batch 밖 Other -> Leaf edge를 둔다. Leaf와 C만 파일 상태가 바뀌었다.
+		FCommandletBatchPackageGraph FixtureGraph;
+		const TArray<FString> AssetNameArray = { TEXT("A"), TEXT("B"), TEXT("C"), TEXT("D"), TEXT("E"), TEXT("F"), TEXT("G") };
+		TMap<FString, FString> OptionsKeyByObjectPath;
+		TMap<FString, FString> OutputFilePathByObjectPath;
+		FCommandletBatchChangePlan FixturePlan;
+		bool bDumpsWritten = true;
+		for (const FString& AssetNameText : AssetNameArray)
+		{
+			const FString ObjectPathText = FString::Printf(TEXT("/Game/Closure/%s.%s"), *AssetNameText, *AssetNameText);
+			AddBatchGraphAsset(FixtureGraph, ObjectPathText);
+			OptionsKeyByObjectPath.Add(ObjectPathText, TEXT("opts_v1"));
+
+			// F는 이전 dump 파일이 없는 자산이라 출력 파일을 만들지 않는다.
+			const FString OutputFilePathText = FPaths::Combine(ClosureRootPath, AssetNameText, TEXT("dump.json"));
+			OutputFilePathByObjectPath.Add(ObjectPathText, OutputFilePathText);
+			if (AssetNameText != TEXT("F"))
+			{
+				bDumpsWritten &= FFileHelper::SaveStringToFile(TEXT("{}"), *OutputFilePathText, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+				FixturePlan.PreviousAssetRecordByPath.Add(
+					ObjectPathText,
+					TPair<FString, FString>(
+						AssetNameText == TEXT("E") ? TEXT("opts_v0") : TEXT("opts_v1"),
+						AssetNameText == TEXT("D") ? TEXT("failed") : TEXT("dumped")));
+			}
+		}
+		if (!bDumpsWritten)
+		{
+			OutDetail = TEXT("fixture_write_failed");
 			return false;
 		}
 
-		FString LegacySemantic;
-		if (InNode.Extra.IsValid() && InNode.Extra->TryGetStringField(TEXT("node_semantic"), LegacySemantic) && !LegacySemantic.IsEmpty() && LegacySemantic != InNode.Role.Primary)
+		AddBatchGraphEdge(FixtureGraph, TEXT("/Game/Closure/A"), TEXT("/Game/Closure/Lib"));
+		AddBatchGraphEdge(FixtureGraph, TEXT("/Game/Closure/Lib"), TEXT("/Game/Closure/Leaf"));
+		AddBatchGraphEdge(FixtureGraph, TEXT("/Game/Closure/B"), TEXT("/Game/Closure/A"));
+		AddBatchGraphEdge(FixtureGraph, TEXT("/Game/Closure/Other"), TEXT("/Game/Closure/Leaf"));
+		AddBatchGraphEdge(FixtureGraph, TEXT("/Game/Closure/G"), TEXT("/Script/Engine"));
+
+		// PreviousPackageStateByName은 모든 fixture package를 s1으로 기록한 이전 cache다.
+		TMap<FString, FString> PreviousPackageStateByName;
+		for (const FString& PackageNameText : FixtureGraph.PackageNameArray)
 		{
-			OutFailureReason = FString::Printf(TEXT("legacy_semantic=%s role=%s"), *LegacySemantic, *InNode.Role.Primary);
-			return false;
+			PreviousPackageStateByName.Add(PackageNameText, TEXT("s1"));
 		}
 
-		return true;
-	}
+		// StatCount는 상태 provider 호출 수다. batch forward closure 밖 Other는 stat하지 않아야 한다.
+		int32 StatCount = 0;
+		ResolveBatchChangePlan(
+			FixtureGraph,
+			PreviousPackageStateByName,
+			[&StatCount](const FString& InPackageName)
+			{
+				++StatCount;
+				return (InPackageName == TEXT("/Game/Closure/Leaf") || InPackageName == TEXT("/Game/Closure/C")) ? FString(TEXT("s2")) : FString(TEXT("s1"));
+			},
+			[](const FString&) { return FString(TEXT("opts_v1")); },
+			OptionsKeyByObjectPath,
+			OutputFilePathByObjectPath,
+			FixturePlan);
 
-	// VerifyGraphNodeRoleClassifierRegistry는 exact semantic 11종과 structural fallback 4종을 공용 trait classifier로 검증한다.
-	bool VerifyGraphNodeRoleClassifierRegistry(FString& OutDetailText)
-	{
-		struct FRoleClassifierCase
+		// ReasonOf는 fixture 자산의 redump_reason이다. 계획에 없으면 unchanged다.
+		auto ReasonOf = [&FixturePlan](const TCHAR* InAssetName)
 		{
-			FString Name;
-			FString Semantic;
-			bool bHasExecInput = false;
-			bool bHasExecOutput = false;
-			int32 ExecOutputCount = 0;
-			bool bPurityResolved = false;
-			bool bMetadataIsPure = false;
-			bool bIsLatent = false;
-			FString ExpectedPrimary;
-			FString ExpectedFamily;
-			FString ExpectedSource;
-			FString ExpectedConfidence;
-			FString RequiredTagA;
-			FString RequiredTagB;
+			const FString* ReasonText = FixturePlan.RedumpReasonByObjectPath.Find(FString::Printf(TEXT("/Game/Closure/%s.%s"), InAssetName, InAssetName));
+			return ReasonText != nullptr ? *ReasonText : FString(TEXT("unchanged"));
+		};
+		auto ViaOf = [&FixturePlan](const TCHAR* InAssetName)
+		{
+			return FixturePlan.RedumpViaByObjectPath.FindRef(FString::Printf(TEXT("/Game/Closure/%s.%s"), InAssetName, InAssetName));
 		};
 
-		const TArray<FRoleClassifierCase> Cases = {
-			{ TEXT("event"), TEXT("event"), false, true, 1, false, false, false, TEXT("event"), TEXT("entry"), TEXT("exact_class"), TEXT("exact"), TEXT("has_exec_output"), FString() },
-			{ TEXT("function_call"), TEXT("function_call"), false, false, 0, true, true, false, TEXT("function_call"), TEXT("call"), TEXT("function_metadata"), TEXT("exact"), TEXT("pure"), FString() },
-			{ TEXT("interface_call"), TEXT("interface_call"), true, true, 1, true, false, false, TEXT("interface_call"), TEXT("call"), TEXT("function_metadata"), TEXT("exact"), TEXT("interface"), FString() },
-			{ TEXT("variable_get"), TEXT("variable_get"), false, false, 0, false, false, false, TEXT("variable_get"), TEXT("variable"), TEXT("exact_class"), TEXT("exact"), TEXT("member_access"), TEXT("pure") },
-			{ TEXT("variable_set"), TEXT("variable_set"), true, true, 1, false, false, false, TEXT("variable_set"), TEXT("variable"), TEXT("exact_class"), TEXT("exact"), TEXT("member_access"), TEXT("impure") },
-			{ TEXT("dynamic_cast"), TEXT("dynamic_cast"), true, true, 2, false, false, false, TEXT("dynamic_cast"), TEXT("conversion"), TEXT("exact_class"), TEXT("exact"), TEXT("multi_output"), FString() },
-			{ TEXT("branch"), TEXT("branch"), true, true, 2, false, false, false, TEXT("branch"), TEXT("control_flow"), TEXT("exact_class"), TEXT("exact"), TEXT("conditional"), TEXT("multi_output") },
-			{ TEXT("sequence"), TEXT("sequence"), true, true, 3, false, false, false, TEXT("sequence"), TEXT("control_flow"), TEXT("exact_class"), TEXT("exact"), TEXT("multi_output"), FString() },
-			{ TEXT("select"), TEXT("select"), false, false, 0, false, false, false, TEXT("select"), TEXT("data_flow"), TEXT("exact_class"), TEXT("exact"), TEXT("conditional"), TEXT("pure") },
-			{ TEXT("switch"), TEXT("switch"), true, true, 3, false, false, false, TEXT("switch"), TEXT("control_flow"), TEXT("exact_class"), TEXT("exact"), TEXT("conditional"), TEXT("multi_output") },
-			{ TEXT("timeline"), TEXT("timeline"), true, true, 2, false, false, false, TEXT("timeline"), TEXT("timing"), TEXT("exact_class"), TEXT("exact"), TEXT("latent"), TEXT("multi_output") },
-			{ TEXT("pure_expression"), FString(), false, false, 0, false, false, false, TEXT("pure_expression"), TEXT("data_flow"), TEXT("structural_inference"), TEXT("inferred"), TEXT("pure"), FString() },
-			{ TEXT("execution_entry"), FString(), false, true, 1, false, false, false, TEXT("execution_entry"), TEXT("entry"), TEXT("structural_inference"), TEXT("inferred"), TEXT("has_exec_output"), FString() },
-			{ TEXT("execution_sink"), FString(), true, false, 0, false, false, false, TEXT("execution_sink"), TEXT("operation"), TEXT("structural_inference"), TEXT("inferred"), TEXT("has_exec_input"), FString() },
-			{ TEXT("flow_control"), FString(), true, true, 1, false, false, false, TEXT("flow_control"), TEXT("control_flow"), TEXT("structural_inference"), TEXT("inferred"), TEXT("has_exec_input"), TEXT("has_exec_output") }
+		OutDetail = FString::Printf(
+			TEXT("a=%s(%s) b=%s(%s) c=%s d=%s e=%s f=%s g=%s tracked=%d changed=%d stat=%d"),
+			*ReasonOf(TEXT("A")),
+			*ViaOf(TEXT("A")),
+			*ReasonOf(TEXT("B")),
+			*ViaOf(TEXT("B")),
+			*ReasonOf(TEXT("C")),
+			*ReasonOf(TEXT("D")),
+			*ReasonOf(TEXT("E")),
+			*ReasonOf(TEXT("F")),
+			*ReasonOf(TEXT("G")),
+			FixturePlan.PackageStateByName.Num(),
+			FixturePlan.ChangedPackageCount,
+			StatCount);
+
+		// 추적 package는 batch 자산 7개와 Lib, Leaf다. Other와 /Script package는 graph closure 밖이다.
+		return ReasonOf(TEXT("A")) == TEXT("dependency_changed")
+			&& ViaOf(TEXT("A")) == TEXT("/Game/Closure/Leaf")
+			&& ReasonOf(TEXT("B")) == TEXT("dependency_changed")
+			&& ViaOf(TEXT("B")) == TEXT("/Game/Closure/Leaf")
+			&& ReasonOf(TEXT("C")) == TEXT("package_changed")
+			&& ReasonOf(TEXT("D")) == TEXT("previous_failure")
+			&& ReasonOf(TEXT("E")) == TEXT("options_changed")
+			&& ReasonOf(TEXT("F")) == TEXT("no_previous_dump")
+			&& ReasonOf(TEXT("G")) == TEXT("unchanged")
+			&& FixturePlan.PackageStateByName.Num() == 9
+			&& !FixturePlan.PackageStateByName.Contains(TEXT("/Game/Closure/Other"))
+			&& FixturePlan.ChangedPackageCount == 2
+			&& StatCount == 9;
+	}
+
+	// VerifyBatchFileStateRefresh는 전체 실행이 저장한 file-state cache 뒤 다른 옵션의 ChangedOnly 실행과, cache 뒤 다른 옵션으로 덮어쓴 manifest가 재덤프되는지 검증한다.
+	bool VerifyBatchFileStateRefresh(FString& OutDetail)
+	{
+		// RefreshRoot는 이전 실행 batch_file_state cache가 읽히지 않도록 fixture cache만 둔다.
+		const FCommandletSmokeFixtureRoot RefreshRoot(TEXT("BatchFileStateRefresh"));
+		const FString& RefreshRootPath = RefreshRoot.Path;
+		const FString ScopeText = BuildBatchFileStateScopeText(TEXT("/Game/Refresh"), FString(), false, 0);
+		const FString ObjectPathText = TEXT("/Game/Refresh/BP_Refresh.BP_Refresh");
+		const FString OutputFilePathText = FPaths::Combine(RefreshRootPath, TEXT("BP_Refresh"), TEXT("dump.json"));
+		const FString ManifestFilePathText = FPaths::Combine(RefreshRootPath, TEXT("BP_Refresh"), TEXT("manifest.json"));
+
+		// SaveManifest는 dump를 쓴 실행의 옵션 해시를 manifest에 남긴다. 옵션 키는 "s1|x1|<hash>"가 된다.
+		auto SaveManifest = [&ManifestFilePathText](const TCHAR* InOptionsHash)
+		{
+			return FFileHelper::SaveStringToFile(
+				FString::Printf(TEXT("{\"schema_version\":\"s1\",\"extractor_version\":\"x1\",\"run\":{\"options_hash\":\"%s\"}}"), InOptionsHash),
+				*ManifestFilePathText,
+				FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
 		};
 
-		int32 PassedCount = 0;
-		for (const FRoleClassifierCase& TestCase : Cases)
+		// PlanWithOptions는 batchdump처럼 fixture graph를 만들고 bInChangedOnly일 때만 이전 cache를 읽어 자산 사유를 계산한다.
+		auto PlanWithOptions = [&ScopeText, &RefreshRootPath, &ObjectPathText, &OutputFilePathText](const FString& InOptionsKeyText, bool bInChangedOnly, FCommandletBatchChangePlan& OutPlan)
+		{
+			OutPlan = FCommandletBatchChangePlan();
+			OutPlan.ScopeText = ScopeText;
+			OutPlan.CacheFilePath = BuildBatchFileStateCacheFilePath(RefreshRootPath, ScopeText);
+
+			TMap<FString, FString> PreviousPackageStateByName;
+			OutPlan.bCacheLoaded = bInChangedOnly
+				&& LoadBatchFileStateCache(OutPlan.CacheFilePath, ScopeText, PreviousPackageStateByName, OutPlan.PreviousAssetRecordByPath);
+
+			FCommandletBatchPackageGraph FixtureGraph;
+			AddBatchGraphAsset(FixtureGraph, ObjectPathText);
+			TMap<FString, FString> OptionsKeyByObjectPath;
+			OptionsKeyByObjectPath.Add(ObjectPathText, InOptionsKeyText);
+			TMap<FString, FString> OutputFilePathByObjectPath;
+			OutputFilePathByObjectPath.Add(ObjectPathText, OutputFilePathText);
+			ResolveBatchChangePlan(
+				FixtureGraph,
+				PreviousPackageStateByName,
+				[](const FString&) { return FString(TEXT("stable")); },
+				[](const FString& InOutputFilePath) { return LoadBatchManifestOptionsKeyText(InOutputFilePath); },
+				OptionsKeyByObjectPath,
+				OutputFilePathByObjectPath,
+				OutPlan);
+
+			const FString* ReasonText = OutPlan.RedumpReasonByObjectPath.Find(ObjectPathText);
+			return ReasonText != nullptr ? *ReasonText : FString(TEXT("unchanged"));
+		};
+
+		// 전체 실행은 opts_a로 dump와 manifest를 쓰고 cache를 저장한다.
+		FCommandletBatchChangePlan FullPlan;
+		PlanWithOptions(TEXT("s1|x1|opts_a"), false, FullPlan);
+		TMap<FString, TPair<FString, FString>> FullAssetRecordByPath;
+		FullAssetRecordByPath.Add(ObjectPathText, TPair<FString, FString>(TEXT("s1|x1|opts_a"), TEXT("dumped")));
+		FString SaveErrorMessage;
+		const bool bFullRunSaved = FFileHelper::SaveStringToFile(TEXT("{}"), *OutputFilePathText, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+			&& SaveManifest(TEXT("opts_a"))
+			&& SaveBatchFileStateCache(FullPlan, FullAssetRecordByPath, SaveErrorMessage);
+		if (!bFullRunSaved)
 		{
-			FADumpGraphNode SyntheticNode;
-			SyntheticNode.NodeClass = TestCase.Name;
-			SyntheticNode.Role = ADumpGraphExt::BuildGraphNodeRoleFromTraits(
-				TestCase.Semantic,
-				TestCase.bHasExecInput,
-				TestCase.bHasExecOutput,
-				TestCase.ExecOutputCount,
-				TestCase.bPurityResolved,
-				TestCase.bMetadataIsPure,
-				TestCase.bIsLatent);
+			OutDetail = FString::Printf(TEXT("fixture_write_failed=%s"), *SaveErrorMessage);
+			return false;
+		}
 
-			if (!TestCase.Semantic.IsEmpty())
-			{
-				SyntheticNode.Extra = MakeShared<FJsonObject>();
-				SyntheticNode.Extra->SetStringField(TEXT("node_semantic"), TestCase.Semantic);
-			}
-			if (TestCase.bHasExecInput)
-			{
-				FADumpGraphPin InputPin;
-				InputPin.Direction = TEXT("input");
-				InputPin.bIsExec = true;
-				SyntheticNode.Pins.Add(InputPin);
-			}
-			for (int32 OutputIndex = 0; OutputIndex < TestCase.ExecOutputCount; ++OutputIndex)
+		// 같은 옵션 ChangedOnly는 skip하고, 다른 옵션 ChangedOnly는 전체 실행 cache 기준 options_changed로 재덤프한다.
+		FCommandletBatchChangePlan SamePlan;
+		const FString SameReasonText = PlanWithOptions(TEXT("s1|x1|opts_a"), true, SamePlan);
+		FCommandletBatchChangePlan ChangedPlan;
+		const FString ChangedReasonText = PlanWithOptions(TEXT("s1|x1|opts_b"), true, ChangedPlan);
+
+		// cache는 opts_a인데 다른 실행이 opts_b로 dump를 덮어썼으면 cache 기록과 옵션이 같아도 재덤프한다.
+		const bool bManifestRewritten = SaveManifest(TEXT("opts_b"));
+		FCommandletBatchChangePlan RewrittenPlan;
+		const FString RewrittenReasonText = PlanWithOptions(TEXT("s1|x1|opts_a"), true, RewrittenPlan);
+
+		OutDetail = FString::Printf(
+			TEXT("cache_loaded=%s same=%s changed=%s manifest_rewritten=%s"),
+			SamePlan.bCacheLoaded ? TEXT("true") : TEXT("false"),
+			*SameReasonText,
+			*ChangedReasonText,
+			*RewrittenReasonText);
+		return SamePlan.bCacheLoaded
+			&& ChangedPlan.bCacheLoaded
+			&& SameReasonText == TEXT("unchanged")
+			&& ChangedReasonText == TEXT("options_changed")
+			&& bManifestRewritten
+			&& RewrittenReasonText == TEXT("options_changed");
+	}
+
+	// VerifyFusedContextBundle은 fixture dump root에서 query ResultSchema=ai_context_bundle_v1 단일 실행과 query_result_v1 -> contextbundle 두 단계 출력이 generated_time 외에 같은지 검증한다.
+	bool VerifyFusedContextBundle(FString& OutDetail)
+	{
+		// BundleRoot는 단일 실행과 두 단계 실행이 같은 index와 dump만 보도록 fixture 외 파일이 없는 root다.
+		const FCommandletSmokeFixtureRoot BundleRoot(TEXT("FusedContextBundle"));
+		const FString& BundleRootPath = BundleRoot.Path;
+
+		// SectionNames는 fixture asset에 색인된 section이다. 각 section data는 약 3000 byte라 MaxBytes=4096이면 두 번째 section부터 잘린다.
+		const TCHAR* SectionNames[] = { TEXT("summary"), TEXT("digest"), TEXT("graphs") };
+		const FString ObjectPath = TEXT("/Game/Bundle/BP_Bundle.BP_Bundle");
+		TArray<FString> DumpFieldTexts;
+		TArray<FString> SectionEntryTexts;
+		for (const TCHAR* SectionName : SectionNames)
+		{
+			DumpFieldTexts.Add(FString::Printf(TEXT("\"%s\":{\"text\":\"%s\"}"), SectionName, *FString::ChrN(3000, static_cast<TCHAR>(TEXT('a') + DumpFieldTexts.Num()))));
+			SectionEntryTexts.Add(FString::Printf(
+				TEXT("{\"object_path\":\"%s\",\"section_name\":\"%s\",\"section_schema_version\":\"fixture_v1\",\"source_file\":\"BP_Bundle/dump.json\",\"json_pointer\":\"/%s\",\"storage_kind\":\"inline\"}"),
+				*ObjectPath,
+				SectionName,
+				SectionName));
+		}
+		const bool bFixtureWritten = FFileHelper::SaveStringToFile(
+				FString::Printf(TEXT("{%s}"), *FString::Join(DumpFieldTexts, TEXT(","))),
+				*FPaths::Combine(BundleRootPath, TEXT("BP_Bundle"), TEXT("dump.json")),
+				FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+			&& FFileHelper::SaveStringToFile(
+				FString::Printf(
+					TEXT("{\"schema_version\":\"asset_index_v1\",\"assets\":[{\"asset_id\":\"bundle_0001\",\"asset_key\":\"bp_bundle\",\"object_path\":\"%s\",\"asset_class\":\"Blueprint\",\"asset_family\":\"blueprint\",\"fingerprint\":\"fp_bundle\"}]}"),
+					*ObjectPath),
+				*FPaths::Combine(BundleRootPath, TEXT("asset_index.json")),
+				FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+			&& FFileHelper::SaveStringToFile(
+				FString::Printf(
+					TEXT("{\"schema_version\":\"section_index_v1\",\"asset_index_schema_version\":\"asset_index_v1\",\"sections\":[%s]}"),
+					*FString::Join(SectionEntryTexts, TEXT(","))),
+				*FPaths::Combine(BundleRootPath, TEXT("section_index.json")),
+				FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+		if (!bFixtureWritten)
+		{
+			OutDetail = TEXT("fixture_write_failed");
+			return false;
+		}
+
+		// LoadBundleCompareText는 bundle 파일에서 실행마다 달라지는 generated_time을 비우고 compact 직렬화한다.
+		auto LoadBundleCompareText = [](const FString& InFilePath)
+		{
+			TSharedPtr<FJsonObject> BundleRootObject;
+			FString CompareText;
+			if (LoadCommandletJsonObjectFromFile(InFilePath, BundleRootObject) && BundleRootObject.IsValid())
 			{
-				FADumpGraphPin OutputPin;
-				OutputPin.Direction = TEXT("output");
-				OutputPin.bIsExec = true;
-				SyntheticNode.Pins.Add(OutputPin);
+				BundleRootObject->SetStringField(TEXT("generated_time"), FString());
+				TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> CompareWriter =
+					TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&CompareText);
+				FJsonSerializer::Serialize(BundleRootObject.ToSharedRef(), CompareWriter);
 			}
+			return CompareText;
+		};
 
-			FString ContractFailure;
-			const bool bRoleMatches = SyntheticNode.Role.Primary == TestCase.ExpectedPrimary
-				&& SyntheticNode.Role.Family == TestCase.ExpectedFamily
-				&& SyntheticNode.Role.Source == TestCase.ExpectedSource
-				&& SyntheticNode.Role.Confidence == TestCase.ExpectedConfidence
-				&& (TestCase.RequiredTagA.IsEmpty() || SyntheticNode.Role.Tags.Contains(TestCase.RequiredTagA))
-				&& (TestCase.RequiredTagB.IsEmpty() || SyntheticNode.Role.Tags.Contains(TestCase.RequiredTagB))
-				&& TestGraphNodeRoleContract(SyntheticNode, ContractFailure);
-			if (!bRoleMatches)
-			{
-				OutDetailText = FString::Printf(
-					TEXT("failed=%s primary=%s family=%s source=%s confidence=%s contract=%s"),
-					*TestCase.Name,
-					*SyntheticNode.Role.Primary,
-					*SyntheticNode.Role.Family,
-					*SyntheticNode.Role.Source,
-					*SyntheticNode.Role.Confidence,
-					*ContractFailure);
-				return false;
+		// BoundCases는 item 한도와 byte 한도로 fused 경로가 뒤쪽 section source 읽기를 생략하는 두 경우다.
+		const TCHAR* BoundCases[] = { TEXT("-MaxItems=2"), TEXT("-MaxBytes=4096") };
+		const int32 BoundCaseCount = UE_ARRAY_COUNT(BoundCases);
+		const FString QueryArgsText = FString::Printf(
+			TEXT("-DumpRoot=\"%s\" -Asset=%s -QueryKind=section -Sections=summary,digest,graphs"),
+			*BundleRootPath,
+			*ObjectPath);
+		const FString QueryResultPath = FPaths::Combine(BundleRootPath, TEXT("query_result.json"));
+		const int32 QueryExitCode = ADumpReadQuery::RunReadQueryMode(
+			TEXT("query"),
+			FString::Printf(TEXT("-Mode=Query %s -ResultSchema=query_result_v1 -Output=\"%s\""), *QueryArgsText, *QueryResultPath));
+		int32 MatchedCaseCount = 0;
+		int32 FailedRunCount = QueryExitCode == 0 ? 0 : 1;
+		for (int32 CaseIndex = 0; QueryExitCode == 0 && CaseIndex < BoundCaseCount; ++CaseIndex)
+		{
+			const FString TwoStepPath = FPaths::Combine(BundleRootPath, FString::Printf(TEXT("two_step_%d.json"), CaseIndex));
+			const FString FusedPath = FPaths::Combine(BundleRootPath, FString::Printf(TEXT("fused_%d.json"), CaseIndex));
+			const int32 TwoStepExitCode = ADumpReadQuery::RunReadQueryMode(
+				TEXT("contextbundle"),
+				FString::Printf(TEXT("-Mode=contextbundle -Input=\"%s\" -Output=\"%s\" %s"), *QueryResultPath, *TwoStepPath, BoundCases[CaseIndex]));
+			const int32 FusedExitCode = ADumpReadQuery::RunReadQueryMode(
+				TEXT("query"),
+				FString::Printf(TEXT("-Mode=Query %s -ResultSchema=ai_context_bundle_v1 -Output=\"%s\" %s"), *QueryArgsText, *FusedPath, BoundCases[CaseIndex]));
+			if (TwoStepExitCode != 0 || FusedExitCode != 0)
+			{
+				++FailedRunCount;
+				continue;
 			}
-			++PassedCount;
+
+			const FString TwoStepCompareText = LoadBundleCompareText(TwoStepPath);
+			MatchedCaseCount += (!TwoStepCompareText.IsEmpty() && TwoStepCompareText == LoadBundleCompareText(FusedPath)) ? 1 : 0;
 		}
 
-		OutDetailText = FString::Printf(TEXT("passed=%d total=%d"), PassedCount, Cases.Num());
-		return PassedCount == Cases.Num();
-	}
+		OutDetail = FString::Printf(
+			TEXT("matched_cases=%d/%d failed_runs=%d"),
+			MatchedCaseCount,
+			BoundCaseCount,
+			FailedRunCount);
+		return FailedRunCount == 0 && MatchedCaseCount == BoundCaseCount;
+	}
+
+	// VerifySelectorSectionSources는 fixture selector_index의 section_sources span/CRC가 원본 source에서는 통하고, 같은 크기 수정과 크기 변경 수정에서는 거부되며 sectiondump가 전체 DOM 경로로 새 값을 읽는지 검증한다.
+	// gzip으로 다시 쓴 source는 span 없이 span_less_sources에 compressed로 표시되어야 한다.
+	bool VerifySelectorSectionSources(FString& OutDetail)
+	{
+		// SpanRoot는 source를 여러 번 고쳐 쓰며 span 거부를 확인하므로 매 실행 원본 fixture에서 다시 시작한다.
+		const FCommandletSmokeFixtureRoot SpanRoot(TEXT("SelectorSectionSources"));
+		const FString& SpanRootPath = SpanRoot.Path;
+
+		const FString ObjectPath = TEXT("/Game/Span/BP_Span.BP_Span");
+		const FString SourceFilePath = FPaths::Combine(SpanRootPath, TEXT("BP_Span"), TEXT("dump.json"));
+		const FString AssetIndexJsonText = FString::Printf(
+			TEXT("{\"schema_version\":\"asset_index_v1\",\"assets\":[{\"asset_id\":\"span_0001\",\"asset_key\":\"bp_span\",\"object_path\":\"%s\",\"asset_class\":\"Blueprint\",\"asset_family\":\"blueprint\",\"fingerprint\":\"fp_span\"}]}"),
+			*ObjectPath);
+		const FString SectionIndexJsonText = FString::Printf(
+			TEXT("{\"schema_version\":\"section_index_v1\",\"asset_index_schema_version\":\"asset_index_v1\",\"sections\":[")
+			TEXT("{\"object_path\":\"%s\",\"section_name\":\"summary\",\"section_schema_version\":\"fixture_v1\",\"source_file\":\"BP_Span/dump.json\",\"json_pointer\":\"/summary\",\"storage_kind\":\"inline\"},")
+			TEXT("{\"object_path\":\"%s\",\"section_name\":\"digest\",\"section_schema_version\":\"fixture_v1\",\"source_file\":\"BP_Span/dump.json\",\"json_pointer\":\"/digest\",\"storage_kind\":\"inline\"}]}"),
+			*ObjectPath,
+			*ObjectPath);
+
+		// EntryObjectsOf는 index 문자열의 배열 원소 object를 selector index 입력 순서대로 꺼낸다.
+		auto EntryObjectsOf = [](const FString& InIndexJsonText, const TCHAR* InArrayFieldName)
+		{
+			TArray<TSharedPtr<FJsonObject>> EntryObjectArray;
+			TSharedPtr<FJsonObject> IndexRootObject;
+			TSharedRef<TJsonReader<>> IndexReader = TJsonReaderFactory<>::Create(InIndexJsonText);
+			const TArray<TSharedPtr<FJsonValue>>* EntryValueArray = nullptr;
+			if (FJsonSerializer::Deserialize(IndexReader, IndexRootObject)
+				&& IndexRootObject.IsValid()
+				&& IndexRootObject->TryGetArrayField(InArrayFieldName, EntryValueArray))
+			{
+				for (const TSharedPtr<FJsonValue>& EntryValue : *EntryValueArray)
+				{
+					EntryObjectArray.Add(EntryValue->AsObject());
+				}
+			}
+			return EntryObjectArray;
+		};
 
-	// TestExecutionPathPreviewContract는 graph preview count, path, step, link와 termination 무결성을 검사한다.
-	bool TestExecutionPathPreviewContract(const FADumpGraph& InGraph, FString& OutFailureReason)
-	{
-		OutFailureReason.Reset();
-		const FADumpExecutionPathPreview& Preview = InGraph.ExecutionPreview;
-		if (Preview.SchemaVersion != TEXT("execution_path_preview_v1"))
-		{
-			OutFailureReason = FString::Printf(TEXT("schema=%s"), *Preview.SchemaVersion);
+		FString SelectorIndexJsonText;
+		const bool bFixtureWritten = FFileHelper::SaveStringToFile(
+				TEXT("{\"summary\":{\"value\":\"alpha\"},\"digest\":{\"value\":\"bravo\"}}"),
+				*SourceFilePath,
+				FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+			&& FFileHelper::SaveStringToFile(AssetIndexJsonText, *FPaths::Combine(SpanRootPath, TEXT("asset_index.json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+			&& FFileHelper::SaveStringToFile(SectionIndexJsonText, *FPaths::Combine(SpanRootPath, TEXT("section_index.json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+			&& ADumpReadQuery::BuildSelectorIndexJson(
+				SpanRootPath,
+				AssetIndexJsonText,
+				SectionIndexJsonText,
+				EntryObjectsOf(AssetIndexJsonText, TEXT("assets")),
+				EntryObjectsOf(SectionIndexJsonText, TEXT("sections")),
+				TEXT("2026-01-01T00:00:00.000Z"),
+				SelectorIndexJsonText)
+			&& FFileHelper::SaveStringToFile(SelectorIndexJsonText, *FPaths::Combine(SpanRootPath, TEXT("selector_index.json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+
+		// DigestSourceRow는 selector_index section_sources의 digest 행 [file_bytes, offset, length, crc]이다.
+		TSharedPtr<FJsonObject> SelectorRootObject;
+		TSharedRef<TJsonReader<>> SelectorReader = TJsonReaderFactory<>::Create(SelectorIndexJsonText);
+		const TArray<TSharedPtr<FJsonValue>>* SectionSourceRowArray = nullptr;
+		const TArray<TSharedPtr<FJsonValue>>* DigestSourceRow = nullptr;
+		if (!bFixtureWritten
+			|| !FJsonSerializer::Deserialize(SelectorReader, SelectorRootObject)
+			|| !SelectorRootObject.IsValid()
+			|| !SelectorRootObject->TryGetArrayField(TEXT("section_sources"), SectionSourceRowArray)
+			|| SectionSourceRowArray->Num() != 2
+			|| !(*SectionSourceRowArray)[1]->TryGetArray(DigestSourceRow)
+			|| DigestSourceRow->Num() != 4)
+		{
+			OutDetail = TEXT("fixture_write_failed");
 			return false;
 		}
-		if (!Preview.bSupported)
+		const int64 DigestFileBytes = static_cast<int64>((*DigestSourceRow)[0]->AsNumber());
+		FADumpJsonValueSpan DigestSpan;
+		DigestSpan.Offset = static_cast<int64>((*DigestSourceRow)[1]->AsNumber());
+		DigestSpan.Length = static_cast<int64>((*DigestSourceRow)[2]->AsNumber());
+		DigestSpan.Crc = static_cast<uint32>((*DigestSourceRow)[3]->AsNumber());
+
+		// DigestValueOf는 span 값 또는 sectiondump 결과의 digest data.value 문자열이다.
+		auto DigestValueOf = [](const TSharedPtr<FJsonValue>& InDataValue)
 		{
-			const bool bReasonValid = Preview.UnsupportedReason == TEXT("links_only") || Preview.UnsupportedReason == TEXT("exec_links_not_requested");
-			const bool bCountsEmpty = Preview.EntryCount == 0 && Preview.PathCount == 0 && Preview.Paths.Num() == 0
-				&& Preview.TerminalPathCount == 0 && Preview.CyclePathCount == 0 && Preview.DepthLimitedPathCount == 0;
-			if (!bReasonValid || !bCountsEmpty)
+			const TSharedPtr<FJsonObject> DataObject = InDataValue.IsValid() ? InDataValue->AsObject() : nullptr;
+			return DataObject.IsValid() ? DataObject->GetStringField(TEXT("value")) : FString();
+		};
+
+		// RunSectionDump는 현재 source로 sectiondump를 실행해 digest data.value를 돌려준다.
+		auto RunSectionDump = [&SpanRootPath, &ObjectPath, &DigestValueOf]()
+		{
+			const FString OutputFilePath = FPaths::Combine(SpanRootPath, TEXT("sectiondump.json"));
+			TSharedPtr<FJsonObject> ResponseRootObject;
+			const TArray<TSharedPtr<FJsonValue>>* SectionValueArray = nullptr;
+			if (ADumpReadQuery::RunReadQueryMode(
+					TEXT("sectiondump"),
+					FString::Printf(TEXT("-Mode=sectiondump -DumpRoot=\"%s\" -Asset=%s -Sections=summary,digest -Output=\"%s\""), *SpanRootPath, *ObjectPath, *OutputFilePath)) != 0
+				|| !LoadCommandletJsonObjectFromFile(OutputFilePath, ResponseRootObject)
+				|| !ResponseRootObject->TryGetArrayField(TEXT("sections"), SectionValueArray))
+			{
+				return FString();
+			}
+			for (const TSharedPtr<FJsonValue>& SectionValue : *SectionValueArray)
+			{
+				const TSharedPtr<FJsonObject> SectionObject = SectionValue->AsObject();
+				if (SectionObject.IsValid() && SectionObject->GetStringField(TEXT("section_name")) == TEXT("digest"))
+				{
+					return DigestValueOf(SectionObject->TryGetField(TEXT("data")));
+				}
+			}
+			return FString();
+		};
+
+		// 원본 source에서는 span만 읽어도 digest 값이 나와야 한다.
+		TSharedPtr<FJsonValue> SpanValue;
+		const bool bOriginalSpanLoaded = ADumpJson::LoadJsonValueFromFileSpan(SourceFilePath, DigestFileBytes, DigestSpan, SpanValue)
+			&& DigestValueOf(SpanValue) == TEXT("bravo");
+		const FString OriginalQueryValue = RunSectionDump();
+
+		// 같은 크기로 digest 값만 바꾸면 파일 크기는 맞아도 CRC32가 달라 span을 거부해야 한다.
+		SpanValue.Reset();
+		const bool bSameSizeWritten = FFileHelper::SaveStringToFile(
+			TEXT("{\"summary\":{\"value\":\"alpha\"},\"digest\":{\"value\":\"BRAVO\"}}"),
+			*SourceFilePath,
+			FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+		const bool bCrcRejected = bSameSizeWritten && !ADumpJson::LoadJsonValueFromFileSpan(SourceFilePath, DigestFileBytes, DigestSpan, SpanValue);
+		const FString SameSizeQueryValue = RunSectionDump();
+
+		// summary 길이를 바꾸면 digest offset이 밀리므로 파일 크기 검사에서 span을 거부해야 한다.
+		SpanValue.Reset();
+		const bool bResizedWritten = FFileHelper::SaveStringToFile(
+			TEXT("{\"summary\":{\"value\":\"alpha-longer\"},\"digest\":{\"value\":\"charlie\"}}"),
+			*SourceFilePath,
+			FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+		const bool bSizeRejected = bResizedWritten && !ADumpJson::LoadJsonValueFromFileSpan(SourceFilePath, DigestFileBytes, DigestSpan, SpanValue);
+		const FString ResizedQueryValue = RunSectionDump();
+
+		// gzip source는 span을 만들 수 없으므로 section_sources를 null로 두고 span_less_sources에 compressed로 남겨야 한다.
+		FADumpOutputEncoding GzipEncoding;
+		GzipEncoding.Compression = EADumpOutputCompression::Gzip;
+		FString GzipSaveErrorMessage;
+		FString GzipSelectorIndexJsonText;
+		TSharedPtr<FJsonObject> GzipSelectorRootObject;
+		const TArray<TSharedPtr<FJsonValue>>* GzipSectionSourceRowArray = nullptr;
+		const TArray<TSharedPtr<FJsonValue>>* SpanlessSourceRowArray = nullptr;
+		const TArray<TSharedPtr<FJsonValue>>* SpanlessSourceRow = nullptr;
+		bool bCompressedMarked = ADumpJson::SaveJsonTextToFile(
+				SourceFilePath,
+				TEXT("{\"summary\":{\"value\":\"alpha\"},\"digest\":{\"value\":\"delta\"}}"),
+				GzipEncoding,
+				GzipSaveErrorMessage)
+			&& ADumpReadQuery::BuildSelectorIndexJson(
+				SpanRootPath,
+				AssetIndexJsonText,
+				SectionIndexJsonText,
+				EntryObjectsOf(AssetIndexJsonText, TEXT("assets")),
+				EntryObjectsOf(SectionIndexJsonText, TEXT("sections")),
+				TEXT("2026-01-01T00:00:00.000Z"),
+				GzipSelectorIndexJsonText)
+			&& FFileHelper::SaveStringToFile(GzipSelectorIndexJsonText, *FPaths::Combine(SpanRootPath, TEXT("selector_index.json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+			&& FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(GzipSelectorIndexJsonText), GzipSelectorRootObject)
+			&& GzipSelectorRootObject.IsValid()
+			&& GzipSelectorRootObject->TryGetArrayField(TEXT("section_sources"), GzipSectionSourceRowArray)
+			&& GzipSelectorRootObject->TryGetArrayField(TEXT("span_less_sources"), SpanlessSourceRowArray)
+			&& GzipSectionSourceRowArray->Num() == 2
+			&& SpanlessSourceRowArray->Num() == 1
+			&& (*SpanlessSourceRowArray)[0]->TryGetArray(SpanlessSourceRow)
+			&& SpanlessSourceRow->Num() == 2
+			&& (*SpanlessSourceRow)[0]->AsString() == TEXT("BP_Span/dump.json")
+			&& (*SpanlessSourceRow)[1]->AsString() == TEXT("compressed");
+		for (int32 SourceRowIndex = 0; bCompressedMarked && SourceRowIndex < GzipSectionSourceRowArray->Num(); ++SourceRowIndex)
+		{
+			bCompressedMarked = (*GzipSectionSourceRowArray)[SourceRowIndex]->IsNull();
+		}
+		const FString CompressedQueryValue = RunSectionDump();
+
+		OutDetail = FString::Printf(
+			TEXT("span_loaded=%s crc_rejected=%s size_rejected=%s compressed_marked=%s query=%s/%s/%s/%s"),
+			bOriginalSpanLoaded ? TEXT("true") : TEXT("false"),
+			bCrcRejected ? TEXT("true") : TEXT("false"),
+			bSizeRejected ? TEXT("true") : TEXT("false"),
+			bCompressedMarked ? TEXT("true") : TEXT("false"),
+			*OriginalQueryValue,
+			*SameSizeQueryValue,
+			*ResizedQueryValue,
+			*CompressedQueryValue);
+		return bOriginalSpanLoaded
+			&& bCrcRejected
+			&& bSizeRejected
+			&& bCompressedMarked
+			&& OriginalQueryValue == TEXT("bravo")
+			&& SameSizeQueryValue == TEXT("BRAVO")
+			&& ResizedQueryValue == TEXT("charlie")
+			&& CompressedQueryValue == TEXT("delta");
+	}
+
+	// WriteEntityQueryFixture는 entity index/query 검증이 공유하는 asset_index_v1과 entity_evidence_v1 dump fixture를 InRootPath에 쓴다.
+	// asset마다 graph 아래 node와 component를 번갈아 두어 kind별 ordinal이 연속하지 않고, exec 사슬·data fan-in·attach 사슬 relation을 갖는다.
+	bool WriteEntityQueryFixture(const FString& InRootPath, int32 InAssetCount, int32 InNodeCount)
+	{
+		TArray<FString> AssetEntryTexts;
+		for (int32 AssetIndex = 0; AssetIndex < InAssetCount; ++AssetIndex)
+		{
+			const FString AssetName = FString::Printf(TEXT("BP_Entity%02d"), AssetIndex);
+			const FString ObjectPath = FString::Printf(TEXT("/Game/Entity/%s.%s"), *AssetName, *AssetName);
+			const FString Fingerprint = FString::Printf(TEXT("fp_entity_%02d"), AssetIndex);
+			AssetEntryTexts.Add(FString::Printf(
+				TEXT("{\"asset_id\":\"entity_%04d\",\"asset_key\":\"bp_entity%02d\",\"object_path\":\"%s\",\"asset_class\":\"Blueprint\",\"asset_family\":\"blueprint\",\"fingerprint\":\"%s\"}"),
+				AssetIndex,
+				AssetIndex,
+				*ObjectPath,
+				*Fingerprint));
+
+			// EntityIdOf는 fixture asset 안에서 고유한 entity id이며 stable_key로도 쓴다.
+			auto EntityIdOf = [&AssetName](const TCHAR* InLocalName, int32 InLocalIndex)
+			{
+				return InLocalIndex < 0
+					? FString::Printf(TEXT("%s:%s"), *AssetName, InLocalName)
+					: FString::Printf(TEXT("%s:%s_%03d"), *AssetName, InLocalName, InLocalIndex);
+			};
+			TArray<FString> EntityTexts;
+			auto AddEntity = [&EntityTexts](const FString& InEntityId, const TCHAR* InEntityKind, const FString& InOwnerEntityId)
+			{
+				EntityTexts.Add(FString::Printf(
+					TEXT("{\"entity_id\":\"%s\",\"entity_kind\":\"%s\",\"stable_identity\":{\"stable_key\":\"%s\",\"quality\":\"exact\"},\"canonical_order\":%d,\"owner_entity_id\":%s,\"state\":\"complete\",\"facets\":{}}"),
+					*InEntityId,
+					InEntityKind,
+					*InEntityId,
+					EntityTexts.Num(),
+					InOwnerEntityId.IsEmpty() ? TEXT("null") : *FString::Printf(TEXT("\"%s\""), *InOwnerEntityId)));
+			};
+			TArray<FString> RelationTexts;
+			auto AddRelation = [&RelationTexts, &AssetName](const TCHAR* InRelationKind, const FString& InFromEntityId, const FString& InToEntityId)
+			{
+				RelationTexts.Add(FString::Printf(
+					TEXT("{\"relation_id\":\"%s:rel_%04d\",\"relation_kind\":\"%s\",\"from_entity_id\":\"%s\",\"to_entity_id\":\"%s\",\"state\":\"complete\"}"),
+					*AssetName,
+					RelationTexts.Num(),
+					InRelationKind,
+					*InFromEntityId,
+					*InToEntityId));
+			};
+
+			const FString AssetEntityId = EntityIdOf(TEXT("asset"), INDEX_NONE);
+			const FString GraphEntityId = EntityIdOf(TEXT("graph"), INDEX_NONE);
+			AddEntity(AssetEntityId, TEXT("asset"), FString());
+			AddEntity(GraphEntityId, TEXT("blueprint_graph"), AssetEntityId);
+			AddRelation(TEXT("owns"), AssetEntityId, GraphEntityId);
+			for (int32 NodeIndex = 0; NodeIndex < InNodeCount; ++NodeIndex)
+			{
+				AddEntity(EntityIdOf(TEXT("node"), NodeIndex), TEXT("blueprint_graph_node"), GraphEntityId);
+				AddEntity(EntityIdOf(TEXT("component"), NodeIndex), TEXT("blueprint_component"), AssetEntityId);
+				AddRelation(TEXT("contains"), GraphEntityId, EntityIdOf(TEXT("node"), NodeIndex));
+				AddRelation(TEXT("owns"), AssetEntityId, EntityIdOf(TEXT("component"), NodeIndex));
+				if (NodeIndex > 0)
+				{
+					AddRelation(TEXT("executes_before"), EntityIdOf(TEXT("node"), NodeIndex - 1), EntityIdOf(TEXT("node"), NodeIndex));
+					AddRelation(TEXT("data_flows_to"), EntityIdOf(TEXT("node"), NodeIndex), EntityIdOf(TEXT("node"), NodeIndex / 2));
+					AddRelation(TEXT("attached_to"), EntityIdOf(TEXT("component"), NodeIndex), EntityIdOf(TEXT("component"), NodeIndex - 1));
+				}
+			}
+
+			if (!FFileHelper::SaveStringToFile(
+					FString::Printf(
+						TEXT("{\"schema_version\":\"fixture_v1\",\"entity_evidence\":{\"schema_version\":\"entity_evidence_v1\",\"adapter_profile\":\"blueprint_core_v1\",\"asset\":{\"object_path\":\"%s\",\"fingerprint\":\"%s\"},\"entities\":[%s],\"relations\":[%s]}}"),
+						*ObjectPath,
+						*Fingerprint,
+						*FString::Join(EntityTexts, TEXT(",")),
+						*FString::Join(RelationTexts, TEXT(","))),
+					*FPaths::Combine(InRootPath, AssetName, AssetName + TEXT(".dump.json")),
+					FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
 			{
-				OutFailureReason = FString::Printf(TEXT("unsupported_reason=%s path_count=%d"), *Preview.UnsupportedReason, Preview.PathCount);
 				return false;
 			}
-			return true;
 		}
-		if (!Preview.UnsupportedReason.IsEmpty() || Preview.MaxPaths <= 0 || Preview.MaxDepth <= 0)
+
+		// BP_Plain은 entity_evidence가 없는 dump라 scanned_source_files에만 기록된다.
+		return FFileHelper::SaveStringToFile(
+				TEXT("{\"schema_version\":\"fixture_v1\"}"),
+				*FPaths::Combine(InRootPath, TEXT("BP_Plain.dump.json")),
+				FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM)
+			&& FFileHelper::SaveStringToFile(
+				FString::Printf(TEXT("{\"schema_version\":\"asset_index_v1\",\"assets\":[%s]}"), *FString::Join(AssetEntryTexts, TEXT(","))),
+				*FPaths::Combine(InRootPath, TEXT("asset_index.json")),
+				FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	// VerifyEntityIndexParallelMatch는 fixture dump root의 entity_index_v1을 병렬 source 읽기와 단일 thread 읽기로 각각 새로 만들어 generated_time 외에 같은지 검증한다.
+	bool VerifyEntityIndexParallelMatch(FString& OutDetail)
+	{
+		// EntityRoot는 병렬/직렬 build가 모두 source를 새로 읽어야 하므로 재사용할 이전 entity_index가 없는 root다.
+		const FCommandletSmokeFixtureRoot EntityRoot(TEXT("EntityIndexParallel"));
+		const FString& EntityRootPath = EntityRoot.Path;
+		constexpr int32 FixtureAssetCount = 12;
+		if (!WriteEntityQueryFixture(EntityRootPath, FixtureAssetCount, 48))
 		{
-			OutFailureReason = TEXT("supported_header_invalid");
+			OutDetail = TEXT("fixture_write_failed");
 			return false;
 		}
 
-		TMap<FString, const FADumpGraphNode*> NodeById;
-		int32 ExpectedEntryCount = 0;
-		for (const FADumpGraphNode& Node : InGraph.Nodes)
+		// BuildIndexCompareText는 직전 index를 지워 모든 source를 다시 읽게 한 뒤 build 결과를 generated_time 없이 compact 직렬화한다.
+		auto BuildIndexCompareText = [&EntityRootPath](bool bInForceSingleThread, int32& OutParsedSourceCount)
 		{
-			NodeById.Add(Node.NodeId, &Node);
-			if (Node.Role.Primary == TEXT("event") || Node.Role.Primary == TEXT("execution_entry") || (!Node.Role.bHasExecInput && Node.Role.bHasExecOutput))
+			IFileManager::Get().Delete(*FPaths::Combine(EntityRootPath, TEXT("entity_index.json")), false, true, true);
+			OutParsedSourceCount = 0;
+			FString IndexFilePath;
+			FString ErrorCode;
+			FString ErrorDetail;
+			TSharedPtr<FJsonObject> IndexRootObject;
+			FString CompareText;
+			if (ADumpEntityQuery::BuildEntityIndex(EntityRootPath, IndexFilePath, ErrorCode, ErrorDetail, bInForceSingleThread)
+				&& LoadCommandletJsonObjectFromFile(IndexFilePath, IndexRootObject))
 			{
-				++ExpectedEntryCount;
+				OutParsedSourceCount = static_cast<int32>(IndexRootObject->GetNumberField(TEXT("parsed_source_count")));
+				IndexRootObject->SetStringField(TEXT("generated_time"), FString());
+				TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> CompareWriter =
+					TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&CompareText);
+				FJsonSerializer::Serialize(IndexRootObject.ToSharedRef(), CompareWriter);
 			}
-		}
-		if (Preview.EntryCount != ExpectedEntryCount || Preview.PathCount != Preview.Paths.Num())
+			return CompareText;
+		};
+
+		int32 ParallelParsedCount = 0;
+		int32 SerialParsedCount = 0;
+		const FString ParallelCompareText = BuildIndexCompareText(false, ParallelParsedCount);
+		const FString SerialCompareText = BuildIndexCompareText(true, SerialParsedCount);
+
+		// 두 build 모두 plain dump까지 포함한 모든 source를 새로 읽어야 재사용 경로가 비교를 가리지 않는다.
+		const int32 ExpectedParsedCount = FixtureAssetCount + 1;
+		const bool bMatched = !ParallelCompareText.IsEmpty() && ParallelCompareText == SerialCompareText;
+		OutDetail = FString::Printf(
+			TEXT("matched=%s parsed=%d/%d expected_parsed=%d bytes=%d"),
+			bMatched ? TEXT("true") : TEXT("false"),
+			ParallelParsedCount,
+			SerialParsedCount,
+			ExpectedParsedCount,
+			ParallelCompareText.Len());
+		return bMatched && ParallelParsedCount == ExpectedParsedCount && SerialParsedCount == ExpectedParsedCount;
+	}
+
+	// StripEntityIndexAssetField는 entity_index.json의 모든 asset entry에서 InFieldName을 지워 entityquery가 색인 없는 대체 경로를 타게 한다.
+	bool StripEntityIndexAssetField(const FString& InDumpRootPath, const TCHAR* InFieldName)
+	{
+		const FString IndexFilePath = FPaths::Combine(InDumpRootPath, TEXT("entity_index.json"));
+		TSharedPtr<FJsonObject> IndexRootObject;
+		const TArray<TSharedPtr<FJsonValue>>* AssetValueArray = nullptr;
+		if (!LoadCommandletJsonObjectFromFile(IndexFilePath, IndexRootObject)
+			|| !IndexRootObject->TryGetArrayField(TEXT("assets"), AssetValueArray))
 		{
-			OutFailureReason = FString::Printf(TEXT("entry=%d/%d paths=%d/%d"), Preview.EntryCount, ExpectedEntryCount, Preview.PathCount, Preview.Paths.Num());
 			return false;
 		}
-
-		auto HasOutgoingExecLink = [&InGraph](const FString& InNodeId)
+		int32 StrippedAssetCount = 0;
+		for (const TSharedPtr<FJsonValue>& AssetValue : *AssetValueArray)
 		{
-			for (const FADumpGraphLink& Link : InGraph.Links)
+			const TSharedPtr<FJsonObject> AssetObject = AssetValue.IsValid() ? AssetValue->AsObject() : nullptr;
+			if (AssetObject.IsValid() && AssetObject->HasField(InFieldName))
 			{
-				if (Link.LinkKind == EADumpLinkKind::Exec && Link.FromNodeId == InNodeId) return true;
+				AssetObject->RemoveField(InFieldName);
+				++StrippedAssetCount;
 			}
-			return false;
-		};
+		}
 
-		int32 TerminalCount = 0;
-		int32 CycleCount = 0;
-		int32 DepthCount = 0;
-		int32 ObservedMaxDepth = 0;
-		TSet<FString> UniquePathIds;
-		for (int32 PathIndex = 0; PathIndex < Preview.Paths.Num(); ++PathIndex)
+		FString IndexJsonText;
+		TSharedRef<TJsonWriter<>> IndexWriter = TJsonWriterFactory<>::Create(&IndexJsonText);
+		return StrippedAssetCount > 0
+			&& StrippedAssetCount == AssetValueArray->Num()
+			&& FJsonSerializer::Serialize(IndexRootObject.ToSharedRef(), IndexWriter)
+			&& FFileHelper::SaveStringToFile(IndexJsonText, *IndexFilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+	}
+
+	// CollectEntityQueryPages는 entityquery를 continuation cursor가 끝날 때까지 이어 실행하고 page마다 entity id와 relation id를 한 줄로 모은다.
+	bool CollectEntityQueryPages(const FString& InCommandLine, TArray<FString>& OutPageTexts)
+	{
+		OutPageTexts.Reset();
+		FString Cursor;
+		for (int32 PageIndex = 0; PageIndex < 256; ++PageIndex)
 		{
-			const FADumpExecutionPath& Path = Preview.Paths[PathIndex];
-			const FString ExpectedPathId = FString::Printf(TEXT("path_%03d"), PathIndex);
-			if (Path.PathId != ExpectedPathId || UniquePathIds.Contains(Path.PathId) || Path.StepCount != Path.Steps.Num() || Path.Steps.Num() <= 0)
+			FString ResultJsonText;
+			FString ErrorCode;
+			FString ErrorDetail;
+			const FString PageCommandLine = Cursor.IsEmpty() ? InCommandLine : FString::Printf(TEXT("%s -Cursor=%s"), *InCommandLine, *Cursor);
+			if (!ADumpEntityQuery::BuildEntityQueryJson(PageCommandLine, ResultJsonText, ErrorCode, ErrorDetail))
 			{
-				OutFailureReason = FString::Printf(TEXT("path_header=%s"), *Path.PathId);
 				return false;
 			}
-			UniquePathIds.Add(Path.PathId);
-			if (Path.EntryNodeId != Path.Steps[0].NodeId || Path.TerminalNodeId != Path.Steps.Last().NodeId)
+
+			TSharedPtr<FJsonObject> ResultRootObject;
+			TSharedRef<TJsonReader<>> ResultReader = TJsonReaderFactory<>::Create(ResultJsonText);
+			const TArray<TSharedPtr<FJsonValue>>* EntityValueArray = nullptr;
+			const TArray<TSharedPtr<FJsonValue>>* RelationValueArray = nullptr;
+			const TSharedPtr<FJsonObject>* ContinuationObject = nullptr;
+			if (!FJsonSerializer::Deserialize(ResultReader, ResultRootObject)
+				|| !ResultRootObject.IsValid()
+				|| !ResultRootObject->TryGetArrayField(TEXT("entities"), EntityValueArray)
+				|| !ResultRootObject->TryGetArrayField(TEXT("relations"), RelationValueArray)
+				|| !ResultRootObject->TryGetObjectField(TEXT("continuation"), ContinuationObject))
 			{
-				OutFailureReason = FString::Printf(TEXT("path_endpoints=%s"), *Path.PathId);
 				return false;
 			}
 
-			const FADumpGraphNode* EntryNode = NodeById.FindRef(Path.EntryNodeId);
-			if (!EntryNode || !(EntryNode->Role.Primary == TEXT("event") || EntryNode->Role.Primary == TEXT("execution_entry") || (!EntryNode->Role.bHasExecInput && EntryNode->Role.bHasExecOutput)))
+			TArray<FString> PageIds;
+			for (const TSharedPtr<FJsonValue>& EntityValue : *EntityValueArray)
 			{
-				OutFailureReason = FString::Printf(TEXT("invalid_entry=%s"), *Path.EntryNodeId);
-				return false;
+				PageIds.Add(EntityValue->AsObject()->GetStringField(TEXT("entity_id")));
+			}
+			for (const TSharedPtr<FJsonValue>& RelationValue : *RelationValueArray)
+			{
+				PageIds.Add(RelationValue->AsObject()->GetStringField(TEXT("relation_id")));
+			}
+			OutPageTexts.Add(FString::Join(PageIds, TEXT(",")));
+			if (!(*ContinuationObject)->GetBoolField(TEXT("has_more")))
+			{
+				return true;
 			}
+			Cursor = (*ContinuationObject)->GetStringField(TEXT("cursor"));
+		}
+		return false;
+	}
 
-			for (int32 StepIndex = 0; StepIndex < Path.Steps.Num(); ++StepIndex)
+	// VerifyEntityKindTablePaging은 entity_kind_ordinals kind table로 자른 list cursor page가 kind table을 지운 index의 선형 scan page와 page 경계까지 같은지 검증한다.
+	bool VerifyEntityKindTablePaging(FString& OutDetail)
+	{
+		// PagingRoot 아래 IndexedRootPath와 FallbackRootPath는 같은 fixture를 담고 FallbackRootPath에서만 kind table을 지운다. session cache key가 dump root별이라 두 경로가 섞이지 않는다.
+		const FCommandletSmokeFixtureRoot PagingRoot(TEXT("EntityKindTablePaging"));
+		const FString& PagingRootPath = PagingRoot.Path;
+		const FString IndexedRootPath = FPaths::Combine(PagingRootPath, TEXT("Indexed"));
+		const FString FallbackRootPath = FPaths::Combine(PagingRootPath, TEXT("Fallback"));
+		constexpr int32 FixtureNodeCount = 20;
+		FString IndexFilePath;
+		FString ErrorCode;
+		FString ErrorDetail;
+		const bool bFixtureWritten = WriteEntityQueryFixture(IndexedRootPath, 3, FixtureNodeCount)
+			&& WriteEntityQueryFixture(FallbackRootPath, 3, FixtureNodeCount)
+			&& ADumpEntityQuery::BuildEntityIndex(IndexedRootPath, IndexFilePath, ErrorCode, ErrorDetail)
+			&& ADumpEntityQuery::BuildEntityIndex(FallbackRootPath, IndexFilePath, ErrorCode, ErrorDetail)
+			&& StripEntityIndexAssetField(FallbackRootPath, TEXT("entity_kind_ordinals"));
+		if (!bFixtureWritten)
+		{
+			OutDetail = TEXT("fixture_write_failed");
+			return false;
+		}
+
+		// PagingCases는 섞인 두 kind, 한 kind, page당 1개 경계를 각각 작은 MaxEntities로 잘라 여러 cursor page를 만든다.
+		struct FKindPagingCase
+		{
+			const TCHAR* EntityKinds;
+			int32 MaxEntities;
+			int32 ExpectedEntityCount;
+		};
+		const FKindPagingCase PagingCases[] = {
+			{ TEXT("blueprint_graph_node,blueprint_component"), 7, FixtureNodeCount * 2 },
+			{ TEXT("blueprint_component"), 6, FixtureNodeCount },
+			{ TEXT("asset,blueprint_graph"), 1, 2 }
+		};
+		const int32 PagingCaseCount = UE_ARRAY_COUNT(PagingCases);
+		int32 MatchedCaseCount = 0;
+		int32 IndexedPageCount = 0;
+		for (const FKindPagingCase& PagingCase : PagingCases)
+		{
+			const FString QueryArgsText = FString::Printf(
+				TEXT("-Asset=/Game/Entity/BP_Entity01.BP_Entity01 -Operation=list -EntityKinds=%s -MaxEntities=%d"),
+				PagingCase.EntityKinds,
+				PagingCase.MaxEntities);
+			TArray<FString> IndexedPageTexts;
+			TArray<FString> FallbackPageTexts;
+			if (!CollectEntityQueryPages(FString::Printf(TEXT("-DumpRoot=\"%s\" %s"), *IndexedRootPath, *QueryArgsText), IndexedPageTexts)
+				|| !CollectEntityQueryPages(FString::Printf(TEXT("-DumpRoot=\"%s\" %s"), *FallbackRootPath, *QueryArgsText), FallbackPageTexts))
 			{
-				const FADumpExecutionPathStep& Step = Path.Steps[StepIndex];
-				const FADumpGraphNode* Node = NodeById.FindRef(Step.NodeId);
-				if (!Node || Step.Depth != StepIndex || Step.PrimaryRole != Node->Role.Primary)
-				{
-					OutFailureReason = FString::Printf(TEXT("step=%s:%d"), *Path.PathId, StepIndex);
-					return false;
-				}
-				ObservedMaxDepth = FMath::Max(ObservedMaxDepth, Step.Depth);
-				if (StepIndex == 0)
-				{
-					if (!Step.ViaPinId.IsEmpty() || !Step.ViaPinName.IsEmpty())
-					{
-						OutFailureReason = FString::Printf(TEXT("entry_via_pin=%s"), *Path.PathId);
-						return false;
-					}
-					continue;
-				}
+				continue;
+			}
+			IndexedPageCount += IndexedPageTexts.Num();
 
-				const FADumpExecutionPathStep& PreviousStep = Path.Steps[StepIndex - 1];
-				const FADumpGraphNode* PreviousNode = NodeById.FindRef(PreviousStep.NodeId);
-				bool bPinMatched = false;
-				if (PreviousNode)
-				{
-					for (const FADumpGraphPin& Pin : PreviousNode->Pins)
-					{
-						if (Pin.PinId == Step.ViaPinId && Pin.PinName == Step.ViaPinName && Pin.bIsExec && Pin.Direction == TEXT("output"))
-						{
-							bPinMatched = true;
-							break;
-						}
-					}
-				}
-				bool bLinkMatched = false;
-				for (const FADumpGraphLink& Link : InGraph.Links)
-				{
-					if (Link.LinkKind == EADumpLinkKind::Exec && Link.FromNodeId == PreviousStep.NodeId
-						&& Link.FromPinId == Step.ViaPinId && Link.ToNodeId == Step.NodeId)
-					{
-						bLinkMatched = true;
-						break;
-					}
-				}
-				if (!bPinMatched || !bLinkMatched)
-				{
-					OutFailureReason = FString::Printf(TEXT("step_link=%s:%d"), *Path.PathId, StepIndex);
-					return false;
-				}
+			// 모든 page의 id를 이어 붙인 수가 kind별 entity 수와 같고 page 경계가 max_entities 단위여야 한다.
+			TArray<FString> IndexedEntityIds;
+			FString::Join(IndexedPageTexts, TEXT(",")).ParseIntoArray(IndexedEntityIds, TEXT(","));
+			const int32 ExpectedPageCount = FMath::DivideAndRoundUp(PagingCase.ExpectedEntityCount, PagingCase.MaxEntities);
+			MatchedCaseCount += (IndexedPageTexts == FallbackPageTexts
+				&& IndexedEntityIds.Num() == PagingCase.ExpectedEntityCount
+				&& IndexedPageTexts.Num() == ExpectedPageCount) ? 1 : 0;
+		}
+
+		OutDetail = FString::Printf(
+			TEXT("matched_cases=%d/%d indexed_pages=%d"),
+			MatchedCaseCount,
+			PagingCaseCount,
+			IndexedPageCount);
+		return MatchedCaseCount == PagingCaseCount;
+	}
+
+	// VerifyEntityAdjacencyExpand는 entity_adjacency CSR bitset BFS로 만든 expand cursor page가 CSR을 지운 index의 relation 선형 walk page와 같은지 검증한다.
+	bool VerifyEntityAdjacencyExpand(FString& OutDetail)
+	{
+		// ExpandRoot 아래 IndexedRootPath와 FallbackRootPath는 같은 fixture를 담고 FallbackRootPath에서만 entity_adjacency를 지운다.
+		const FCommandletSmokeFixtureRoot ExpandRoot(TEXT("EntityAdjacencyExpand"));
+		const FString& ExpandRootPath = ExpandRoot.Path;
+		const FString IndexedRootPath = FPaths::Combine(ExpandRootPath, TEXT("Indexed"));
+		const FString FallbackRootPath = FPaths::Combine(ExpandRootPath, TEXT("Fallback"));
+		FString IndexFilePath;
+		FString ErrorCode;
+		FString ErrorDetail;
+		const bool bFixtureWritten = WriteEntityQueryFixture(IndexedRootPath, 3, 24)
+			&& WriteEntityQueryFixture(FallbackRootPath, 3, 24)
+			&& ADumpEntityQuery::BuildEntityIndex(IndexedRootPath, IndexFilePath, ErrorCode, ErrorDetail)
+			&& ADumpEntityQuery::BuildEntityIndex(FallbackRootPath, IndexFilePath, ErrorCode, ErrorDetail)
+			&& StripEntityIndexAssetField(FallbackRootPath, TEXT("entity_adjacency"));
+		if (!bFixtureWritten)
+		{
+			OutDetail = TEXT("fixture_write_failed");
+			return false;
+		}
+
+		// ExpandCases는 방향, 깊이, relation/entity kind filter와 작은 page 한도를 섞어 BFS frontier와 relation endpoint 조건을 모두 거친다.
+		const TCHAR* ExpandCases[] = {
+			TEXT("-EntityId=BP_Entity01:node_005 -Direction=both -MaxDepth=3 -MaxEntities=8 -MaxRelations=16"),
+			TEXT("-EntityId=BP_Entity01:graph -Direction=out -MaxDepth=4"),
+			TEXT("-EntityId=BP_Entity01:node_010 -Direction=in -MaxDepth=2 -RelationKinds=data_flows_to"),
+			TEXT("-EntityId=BP_Entity01:asset -Direction=both -MaxDepth=2 -EntityKinds=asset,blueprint_graph,blueprint_graph_node -MaxRelations=5"),
+			TEXT("-EntityId=BP_Entity01:component_020 -Direction=out -MaxDepth=16 -RelationKinds=attached_to -MaxEntities=4")
+		};
+		const int32 ExpandCaseCount = UE_ARRAY_COUNT(ExpandCases);
+		int32 MatchedCaseCount = 0;
+		int32 IndexedIdCount = 0;
+		for (const TCHAR* ExpandCase : ExpandCases)
+		{
+			const FString QueryArgsText = FString::Printf(TEXT("-Asset=/Game/Entity/BP_Entity01.BP_Entity01 -Operation=expand %s"), ExpandCase);
+			TArray<FString> IndexedPageTexts;
+			TArray<FString> FallbackPageTexts;
+			if (!CollectEntityQueryPages(FString::Printf(TEXT("-DumpRoot=\"%s\" %s"), *IndexedRootPath, *QueryArgsText), IndexedPageTexts)
+				|| !CollectEntityQueryPages(FString::Printf(TEXT("-DumpRoot=\"%s\" %s"), *FallbackRootPath, *QueryArgsText), FallbackPageTexts))
+			{
+				continue;
 			}
 
-			if (Path.Termination == TEXT("terminal"))
+			// root만 돌려주는 빈 확장은 두 경로가 우연히 같아도 비교 의미가 없으므로 root 외 id가 있어야 한다.
+			TArray<FString> IndexedIds;
+			FString::Join(IndexedPageTexts, TEXT(",")).ParseIntoArray(IndexedIds, TEXT(","));
+			IndexedIdCount += IndexedIds.Num();
+			MatchedCaseCount += (IndexedPageTexts == FallbackPageTexts && IndexedIds.Num() > 2) ? 1 : 0;
+		}
+
+		OutDetail = FString::Printf(
+			TEXT("matched_cases=%d/%d indexed_ids=%d"),
+			MatchedCaseCount,
+			ExpandCaseCount,
+			IndexedIdCount);
+		return MatchedCaseCount == ExpandCaseCount;
+	}
+
+	// VerifyBackgroundSaveStateMachine은 엔진 Cube 자산 dump를 frame budget 0 tick으로 돌려 단계가 tick마다 나뉘고 저장이 background task로 넘어갔다가 반영되는지,
+	// 그리고 저장 중 취소는 진행 중인 저장 결과를 바꾸지 않고 추출 중 취소는 partial_success로 저장되는지 검증한다.
+	bool VerifyBackgroundSaveStateMachine(FString& OutDetail)
+	{
+		// SaveRoot는 세션 이름별 하위 폴더에 dump.json을 쓰므로 이전 실행 출력이 남아 취소 세션의 저장 결과로 읽히지 않게 비우고 시작한다.
+		const FCommandletSmokeFixtureRoot SaveRoot(TEXT("BackgroundSaveStateMachine"));
+		const FString& SaveRootPath = SaveRoot.Path;
+
+		// FTickSessionOutcome은 tick 세션 한 번에서 관찰한 단계 수, 저장 대기 상태와 최종 결과다.
+		struct FTickSessionOutcome
+		{
+			int32 StepTickCount = 0;
+			int32 SavePollTickCount = 0;
+			bool bSawSavePending = false;
+			bool bCancelableWhileSaving = false;
+			bool bSessionEnded = false;
+			bool bOutputSaved = false;
+			bool bFingerprintCleared = false;
+			EADumpStatus DumpStatus = EADumpStatus::None;
+		};
+
+		// RunTickSession은 budget 0으로 tick마다 단계 하나만 실행해 세션을 끝낸다. InCancelAfterStepTicks가 0 이상이면 그 수만큼 단계 tick 뒤에 취소하고, bInCancelDuringSave면 저장 대기를 처음 본 직후 취소한다.
+		auto RunTickSession = [&SaveRootPath](const TCHAR* InRunName, int32 InCancelAfterStepTicks, bool bInCancelDuringSave)
+		{
+			FTickSessionOutcome Outcome;
+			FADumpRunOpts RunOpts;
+			RunOpts.AssetObjectPath = AssetDumpStaticMeshSourcePath;
+			RunOpts.OutputFilePath = FPaths::Combine(SaveRootPath, InRunName, TEXT("dump.json"));
+			RunOpts.bSkipIfUpToDate = false;
+
+			FADumpService DumpService;
+			FString StepMessage;
+			if (!DumpService.BeginDumpSession(RunOpts, StepMessage))
 			{
-				++TerminalCount;
-				if (HasOutgoingExecLink(Path.TerminalNodeId))
-				{
-					OutFailureReason = FString::Printf(TEXT("terminal_has_output=%s"), *Path.PathId);
-					return false;
-				}
+				return Outcome;
 			}
-			else if (Path.Termination == TEXT("cycle"))
+			for (int32 TickIndex = 0; TickIndex < 20000 && DumpService.IsSessionActive(); ++TickIndex)
 			{
-				++CycleCount;
-				bool bRepeated = false;
-				for (int32 EarlierIndex = 0; EarlierIndex < Path.Steps.Num() - 1; ++EarlierIndex)
+				const bool bWasSavePending = DumpService.IsBackgroundSavePending();
+				DumpService.TickDumpSession(0.0, StepMessage);
+				Outcome.SavePollTickCount += bWasSavePending ? 1 : 0;
+				Outcome.StepTickCount += bWasSavePending ? 0 : 1;
+				if (!bWasSavePending && DumpService.IsBackgroundSavePending())
 				{
-					bRepeated |= Path.Steps[EarlierIndex].NodeId == Path.TerminalNodeId;
+					Outcome.bSawSavePending = true;
+					Outcome.bCancelableWhileSaving = DumpService.GetProgressSnapshot().bIsCancelable;
+					if (bInCancelDuringSave)
+					{
+						DumpService.CancelDump();
+					}
 				}
-				if (!bRepeated)
+				if (Outcome.StepTickCount == InCancelAfterStepTicks && !DumpService.IsCancelRequested())
 				{
-					OutFailureReason = FString::Printf(TEXT("cycle_not_repeated=%s"), *Path.PathId);
-					return false;
+					DumpService.CancelDump();
 				}
-			}
-			else if (Path.Termination == TEXT("depth_limit"))
-			{
-				++DepthCount;
-				if (Path.Steps.Last().Depth != Preview.MaxDepth || !HasOutgoingExecLink(Path.TerminalNodeId))
+				if (DumpService.IsBackgroundSaveInFlight())
 				{
-					OutFailureReason = FString::Printf(TEXT("depth_limit=%s"), *Path.PathId);
-					return false;
+					FPlatformProcess::Sleep(0.001f);
 				}
 			}
-			else
-			{
-				OutFailureReason = FString::Printf(TEXT("termination=%s"), *Path.Termination);
-				return false;
-			}
-		}
 
-		if (Preview.TerminalPathCount != TerminalCount || Preview.CyclePathCount != CycleCount || Preview.DepthLimitedPathCount != DepthCount
-			|| Preview.ObservedMaxDepth != ObservedMaxDepth || Preview.bTruncated != (DepthCount > 0 || Preview.OmittedPathCount > 0))
-		{
-			OutFailureReason = TEXT("summary_count_mismatch");
-			return false;
-		}
-		if ((CycleCount > 0) != Preview.Warnings.Contains(TEXT("cycle_detected"))
-			|| (DepthCount > 0) != Preview.Warnings.Contains(TEXT("depth_limit_reached"))
-			|| (Preview.OmittedPathCount > 0) != Preview.Warnings.Contains(TEXT("path_limit_reached")))
-		{
-			OutFailureReason = TEXT("warning_mismatch");
-			return false;
-		}
-		if (ExpectedEntryCount == 0 && InGraph.Nodes.Num() > 0 && !Preview.Warnings.Contains(TEXT("no_entry_nodes")))
-		{
-			OutFailureReason = TEXT("no_entry_warning_missing");
-			return false;
-		}
-		return true;
-	}
+			Outcome.bSessionEnded = !DumpService.IsSessionActive() && !DumpService.IsBackgroundSavePending();
+			Outcome.bOutputSaved = ADumpJson::DoesJsonFileExist(DumpService.GetResolvedOutputFilePath());
+			Outcome.bFingerprintCleared = DumpService.GetActiveResult().PrecomputedFingerprint.IsEmpty();
+			Outcome.DumpStatus = DumpService.GetActiveResult().DumpStatus;
+			return Outcome;
+		};
 
-	// MakeExecutionPreviewTestNode는 production preview registry용 synthetic node를 만든다.
-	FADumpGraphNode MakeExecutionPreviewTestNode(
-		const FString& InNodeId,
-		const FString& InPrimaryRole,
-		bool bInHasExecInput,
-		const TArray<FString>& InOutputPinNames)
-	{
-		FADumpGraphNode Node;
-		Node.NodeId = InNodeId;
-		Node.NodeClass = InPrimaryRole;
-		Node.Role.Primary = InPrimaryRole;
-		Node.Role.bHasExecInput = bInHasExecInput;
-		Node.Role.bHasExecOutput = InOutputPinNames.Num() > 0;
-		if (bInHasExecInput)
-		{
-			FADumpGraphPin InputPin;
-			InputPin.PinId = InNodeId + TEXT("_in");
-			InputPin.PinName = TEXT("execute");
-			InputPin.Direction = TEXT("input");
-			InputPin.bIsExec = true;
-			Node.Pins.Add(MoveTemp(InputPin));
-		}
-		for (int32 OutputIndex = 0; OutputIndex < InOutputPinNames.Num(); ++OutputIndex)
+		const FTickSessionOutcome PlainOutcome = RunTickSession(TEXT("Plain"), INDEX_NONE, false);
+		const FTickSessionOutcome SaveCancelOutcome = RunTickSession(TEXT("CancelDuringSave"), INDEX_NONE, true);
+		const FTickSessionOutcome StepCancelOutcome = RunTickSession(TEXT("CancelDuringSteps"), 2, false);
+
+		// 정상 세션은 준비/자산 확인/추출/저장 시작이 서로 다른 tick에 나뉘고, 저장 대기 중에는 취소를 받지 않으며, 반영 후 fingerprint를 남기지 않아야 한다.
+		const bool bPlainPassed = PlainOutcome.StepTickCount >= 4
+			&& PlainOutcome.SavePollTickCount >= 1
+			&& PlainOutcome.bSawSavePending
+			&& !PlainOutcome.bCancelableWhileSaving
+			&& PlainOutcome.bSessionEnded
+			&& PlainOutcome.bOutputSaved
+			&& PlainOutcome.bFingerprintCleared
+			&& (PlainOutcome.DumpStatus == EADumpStatus::Succeeded || PlainOutcome.DumpStatus == EADumpStatus::PartialSuccess);
+
+		// 저장 중 취소는 이미 확정한 저장용 결과를 그대로 반영하므로 정상 세션과 같은 상태로 파일을 남겨야 한다.
+		const bool bSaveCancelPassed = SaveCancelOutcome.bSawSavePending
+			&& SaveCancelOutcome.bSessionEnded
+			&& SaveCancelOutcome.bOutputSaved
+			&& SaveCancelOutcome.DumpStatus == PlainOutcome.DumpStatus;
+
+		// 추출 중 취소는 남은 추출 단계를 건너뛰고 현재까지의 결과를 partial_success로 background 저장해야 한다.
+		const bool bStepCancelPassed = StepCancelOutcome.bSawSavePending
+			&& StepCancelOutcome.StepTickCount < PlainOutcome.StepTickCount
+			&& StepCancelOutcome.bSessionEnded
+			&& StepCancelOutcome.bOutputSaved
+			&& StepCancelOutcome.DumpStatus == EADumpStatus::PartialSuccess;
+
+		OutDetail = FString::Printf(
+			TEXT("plain=%s(step_ticks=%d poll_ticks=%d status=%d) cancel_during_save=%s(status=%d) cancel_during_steps=%s(step_ticks=%d status=%d)"),
+			bPlainPassed ? TEXT("pass") : TEXT("fail"),
+			PlainOutcome.StepTickCount,
+			PlainOutcome.SavePollTickCount,
+			static_cast<int32>(PlainOutcome.DumpStatus),
+			bSaveCancelPassed ? TEXT("pass") : TEXT("fail"),
+			static_cast<int32>(SaveCancelOutcome.DumpStatus),
+			bStepCancelPassed ? TEXT("pass") : TEXT("fail"),
+			StepCancelOutcome.StepTickCount,
+			static_cast<int32>(StepCancelOutcome.DumpStatus));
+		return bPlainPassed && bSaveCancelPassed && bStepCancelPassed;
+	}
+
+	// VerifyExecLogRingSequence는 작은 용량의 실행 로그 ring으로 delta 조회, wraparound로 밀려난 sequence 요청과
+	// 새 세션 Reset 뒤 이전 sequence 요청이 끊김(false)으로 판정되고 보존 줄만 순서대로 돌려주는지 검증한다.
+	bool VerifyExecLogRingSequence(FString& OutDetail)
+	{
+		constexpr int32 RingCapacity = 4;
+		FADumpLogRing LogRing(RingCapacity);
+
+		// MakeLine은 sequence 추적이 가능한 고유 로그 줄을 만든다.
+		auto MakeLine = [](int32 InLineIndex)
+		{
+			return FString::Printf(TEXT("line_%02d"), InLineIndex);
+		};
+
+		// ReadSince는 InSequence 이후 줄과 연속 여부, 다음 sequence를 한 번에 읽는다.
+		auto ReadSince = [&LogRing](int64 InSequence, TArray<FString>& OutLines, int64& OutNextSequence)
 		{
-			FADumpGraphPin OutputPin;
-			OutputPin.PinId = FString::Printf(TEXT("%s_out_%02d"), *InNodeId, OutputIndex);
-			OutputPin.PinName = InOutputPinNames[OutputIndex];
-			OutputPin.Direction = TEXT("output");
-			OutputPin.bIsExec = true;
-			Node.Pins.Add(MoveTemp(OutputPin));
-		}
-		return Node;
-	}
+			OutLines.Reset();
+			return LogRing.GetSince(InSequence, OutLines, OutNextSequence);
+		};
 
-	// AddExecutionPreviewTestLink는 synthetic graph에 deterministic exec/data link를 추가한다.
-	void AddExecutionPreviewTestLink(FADumpGraph& InOutGraph, const FString& InFromNodeId, int32 InOutputIndex, const FString& InToNodeId, EADumpLinkKind InLinkKind = EADumpLinkKind::Exec)
-	{
-		FADumpGraphLink Link;
-		Link.FromNodeId = InFromNodeId;
-		Link.FromPinId = FString::Printf(TEXT("%s_out_%02d"), *InFromNodeId, InOutputIndex);
-		Link.ToNodeId = InToNodeId;
-		Link.ToPinId = InToNodeId + TEXT("_in");
-		Link.LinkKind = InLinkKind;
-		InOutGraph.Links.Add(MoveTemp(Link));
-	}
+		TArray<FString> Lines;
+		int64 NextSequence = 0;
+
+		// 용량 안에서는 중간 sequence부터의 delta가 연속으로 이어지고, 끝 sequence 요청은 빈 연속 결과여야 한다.
+		LogRing.Append(MakeLine(0));
+		LogRing.Append(MakeLine(1));
+		LogRing.Append(FString());
+		LogRing.Append(MakeLine(2));
+		const int64 StartSequence = LogRing.GetFirstSequence();
+		const bool bDeltaContiguous = ReadSince(StartSequence + 1, Lines, NextSequence);
+		const bool bDeltaPassed = bDeltaContiguous
+			&& NextSequence == StartSequence + 3
+			&& Lines == TArray<FString>({ MakeLine(1), MakeLine(2) });
+		const bool bTailContiguous = ReadSince(NextSequence, Lines, NextSequence);
+		const bool bTailPassed = bTailContiguous && Lines.Num() == 0 && NextSequence == StartSequence + 3;
+
+		// 용량을 넘겨 쓰면 가장 오래된 줄부터 밀려나고, 밀려난 sequence 요청은 false와 함께 보존 줄 전체를 오래된 순으로 돌려줘야 한다.
+		for (int32 LineIndex = 3; LineIndex < 10; ++LineIndex)
+		{
+			LogRing.Append(MakeLine(LineIndex));
+		}
+		const bool bEvictedContiguous = ReadSince(StartSequence + 1, Lines, NextSequence);
+		const bool bWrapPassed = !bEvictedContiguous
+			&& NextSequence == StartSequence + 10
+			&& LogRing.GetFirstSequence() == StartSequence + 6
+			&& LogRing.GetDroppedLineCount() == 6
+			&& Lines == TArray<FString>({ MakeLine(6), MakeLine(7), MakeLine(8), MakeLine(9) });
+		const bool bWrapDeltaContiguous = ReadSince(StartSequence + 8, Lines, NextSequence);
+		const bool bWrapDeltaPassed = bWrapDeltaContiguous && Lines == TArray<FString>({ MakeLine(8), MakeLine(9) });
+
+		// Reset은 sequence 하나를 건너뛰므로 이전 세션의 다음 sequence 요청도 끊김이고, 비어 있는 ring은 빈 결과를 줘야 한다.
+		const int64 SequenceBeforeReset = LogRing.GetNextSequence();
+		LogRing.Reset();
+		const bool bResetContiguous = ReadSince(SequenceBeforeReset, Lines, NextSequence);
+		const bool bResetEmptyPassed = !bResetContiguous
+			&& Lines.Num() == 0
+			&& NextSequence == SequenceBeforeReset + 1
+			&& LogRing.GetDroppedLineCount() == 0;
+		LogRing.Append(MakeLine(10));
+		const bool bAfterResetContiguous = ReadSince(SequenceBeforeReset, Lines, NextSequence);
+		const bool bAfterResetPassed = !bAfterResetContiguous
+			&& NextSequence == SequenceBeforeReset + 2
+			&& Lines == TArray<FString>({ MakeLine(10) });
 
-	// VerifyExecutionPathPreviewRegistry는 production builder로 13개 bounded traversal 계약을 검증한다.
-	bool VerifyExecutionPathPreviewRegistry(FString& OutDetailText)
-	{
-		int32 PassedCount = 0;
-		auto Require = [&OutDetailText, &PassedCount](bool bCondition, const FString& InCaseName, const FString& InDetail)
+		OutDetail = FString::Printf(
+			TEXT("delta=%s tail=%s wrap=%s wrap_delta=%s reset_empty=%s after_reset=%s"),
+			bDeltaPassed ? TEXT("pass") : TEXT("fail"),
+			bTailPassed ? TEXT("pass") : TEXT("fail"),
+			bWrapPassed ? TEXT("pass") : TEXT("fail"),
+			bWrapDeltaPassed ? TEXT("pass") : TEXT("fail"),
+			bResetEmptyPassed ? TEXT("pass") : TEXT("fail"),
+			bAfterResetPassed ? TEXT("pass") : TEXT("fail"));
+		return bDeltaPassed && bTailPassed && bWrapPassed && bWrapDeltaPassed && bResetEmptyPassed && bAfterResetPassed;
+	}
+
+	// VerifyExecQueueOutcomes는 실행 컨트롤러 queue를 엔진 Cube 자산으로 돌려 최신 skip, 실패, 앞 자산 저장 중 전체 취소가
+	// 완료/건너뜀/실패/취소 집계와 진행률/ETA에 맞게 반영되고 저장 중이던 앞 자산 결과는 그대로 남는지 검증한다.
+	bool VerifyExecQueueOutcomes(FString& OutDetail)
+	{
+		// QueueRoot는 끝에 남은 dump.json 수를 성공 집계와 맞춰 보므로 이전 queue 출력이 없어야 한다.
+		const FCommandletSmokeFixtureRoot QueueRoot(TEXT("ExecQueueOutcomes"));
+		const FString& QueueRootPath = QueueRoot.Path;
+
+		// MakeCubeRunOpts는 InRunName 하위 dump.json으로 저장하는 Cube 실행 옵션을 만든다.
+		auto MakeCubeRunOpts = [&QueueRootPath](const TCHAR* InRunName, bool bInSkipIfUpToDate)
+		{
+			FADumpRunOpts RunOpts;
+			RunOpts.AssetObjectPath = AssetDumpStaticMeshSourcePath;
+			RunOpts.OutputFilePath = FPaths::Combine(QueueRootPath, InRunName, TEXT("dump.json"));
+			RunOpts.bSkipIfUpToDate = bInSkipIfUpToDate;
+			return RunOpts;
+		};
+
+		// SkipRunOpts는 queue 전에 한 번 저장해 두어 최신 판정으로 건너뛸 자산이다.
+		const FADumpRunOpts SkipRunOpts = MakeCubeRunOpts(TEXT("Skip"), true);
 		{
-			if (!bCondition)
+			FADumpService PreDumpService;
+			FADumpResult PreDumpResult;
+			FADumpRunOpts PreDumpRunOpts = SkipRunOpts;
+			PreDumpRunOpts.bSkipIfUpToDate = false;
+			if (!PreDumpService.DumpBlueprint(PreDumpRunOpts, PreDumpResult))
 			{
-				OutDetailText = FString::Printf(TEXT("failed=%s detail=%s"), *InCaseName, *InDetail);
+				OutDetail = TEXT("fixture_write_failed");
 				return false;
 			}
-			++PassedCount;
-			return true;
-		};
+		}
+
+		// InvalidRunOpts는 모든 섹션을 끈 실행 옵션이라 실패로 끝날 자산이다.
+		FADumpRunOpts InvalidRunOpts = MakeCubeRunOpts(TEXT("Invalid"), false);
+		InvalidRunOpts.bIncludeSummary = false;
+		InvalidRunOpts.bIncludeDetails = false;
+		InvalidRunOpts.bIncludeGraphs = false;
+		InvalidRunOpts.bIncludeReferences = false;
 
+		TArray<FADumpRunOpts> QueueRunOptsList;
+		QueueRunOptsList.Add(MakeCubeRunOpts(TEXT("Q0"), false));
+		QueueRunOptsList.Add(SkipRunOpts);
+		QueueRunOptsList.Add(InvalidRunOpts);
+		for (int32 RunIndex = 1; RunIndex <= 5; ++RunIndex)
 		{
-			FADumpGraph Graph;
-			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
-			if (!Require(Preview.bSupported && Preview.EntryCount == 0 && Preview.PathCount == 0 && Preview.Warnings.Num() == 0, TEXT("empty_graph"), TEXT("non_empty_result"))) return false;
+			QueueRunOptsList.Add(MakeCubeRunOpts(*FString::Printf(TEXT("Q%d"), RunIndex), false));
 		}
+
+		FADumpExecCtrl ExecCtrl;
+		FString QueueMessage;
+		if (!ExecCtrl.StartDumpAssets(QueueRunOptsList, QueueMessage))
 		{
-			FADumpGraph Graph;
-			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, false, true);
-			if (!Require(!Preview.bSupported && Preview.UnsupportedReason == TEXT("links_only") && Preview.Paths.Num() == 0, TEXT("links_only"), Preview.UnsupportedReason)) return false;
+			OutDetail = FString::Printf(TEXT("start_failed=%s"), *QueueMessage);
+			return false;
 		}
+
+		// 앞 세 자산(저장, skip, 실패)이 끝난 뒤 앞 자산이 저장 중이고 아직 시작하지 않은 자산이 남았을 때 queue 전체를 취소한다.
+		bool bCanceledWhileSaving = false;
+		bool bEtaValidWhileRunning = true;
+		int32 SavingCountAtCancel = 0;
+		for (int32 TickIndex = 0; TickIndex < 20000 && ExecCtrl.IsRunning(); ++TickIndex)
 		{
-			FADumpGraph Graph;
-			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, false);
-			if (!Require(!Preview.bSupported && Preview.UnsupportedReason == TEXT("exec_links_not_requested") && Preview.Paths.Num() == 0, TEXT("data_only_selection"), Preview.UnsupportedReason)) return false;
+			ExecCtrl.TickDump(QueueMessage);
+
+			const FADumpExecSnapshot& Snapshot = ExecCtrl.GetSnapshot();
+			if (Snapshot.bIsQueueRunning && Snapshot.QueueProgress01 > 0.0 && Snapshot.QueueEtaSeconds < 0.0)
+			{
+				bEtaValidWhileRunning = false;
+			}
+			if (!bCanceledWhileSaving
+				&& Snapshot.bIsQueueRunning
+				&& Snapshot.QueueSavingCount > 0
+				&& Snapshot.QueueCompletedCount >= 3
+				&& Snapshot.QueueCompletedCount + Snapshot.QueueSavingCount + 1 < Snapshot.QueueTotalCount)
+			{
+				bCanceledWhileSaving = true;
+				SavingCountAtCancel = Snapshot.QueueSavingCount;
+				ExecCtrl.CancelDump();
+			}
+			if (Snapshot.bIsSavingInBackground)
+			{
+				FPlatformProcess::Sleep(0.001f);
+			}
 		}
-		{
-			FADumpGraph Graph;
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("then") }));
-			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
-			if (!Require(Preview.PathCount == 1 && Preview.Paths[0].Termination == TEXT("terminal") && Preview.Paths[0].StepCount == 1, TEXT("single_terminal_entry"), TEXT("path_mismatch"))) return false;
+
+		const FADumpExecSnapshot FinalSnapshot = ExecCtrl.GetSnapshot();
+
+		// SavedOutputFiles는 queue 뒤 남은 dump.json 목록이다. 성공 자산 수에 미리 저장한 skip 자산 1개를 더한 수와 같아야 한다.
+		TArray<FString> SavedOutputFiles;
+		IFileManager::Get().FindFilesRecursive(SavedOutputFiles, *QueueRootPath, TEXT("dump.json"), true, false);
+
+		const int32 SucceededCount = FinalSnapshot.QueueCompletedCount - FinalSnapshot.QueueSkippedCount - FinalSnapshot.QueueFailedCount;
+		const bool bFinishedPassed = !FinalSnapshot.bIsRunning
+			&& !FinalSnapshot.bIsQueueRunning
+			&& FinalSnapshot.QueueSavingCount == 0
+			&& !FinalSnapshot.bIsSavingInBackground;
+		const bool bCountsPassed = FinalSnapshot.QueueTotalCount == QueueRunOptsList.Num()
+			&& FinalSnapshot.QueueCompletedCount + FinalSnapshot.QueueCanceledCount == FinalSnapshot.QueueTotalCount
+			&& FinalSnapshot.QueueSkippedCount == 1
+			&& FinalSnapshot.QueueFailedCount == 1
+			&& FinalSnapshot.QueueCanceledCount >= 1
+			&& SucceededCount >= 2;
+		const bool bCancelPassed = bCanceledWhileSaving && SavingCountAtCancel > 0;
+		const bool bOutputsPassed = SavedOutputFiles.Num() == SucceededCount + 1;
+		const bool bProgressPassed = bEtaValidWhileRunning
+			&& FMath::IsNearlyEqual(FinalSnapshot.QueueProgress01, 1.0)
+			&& FinalSnapshot.QueueEtaSeconds == 0.0;
+
+		OutDetail = FString::Printf(
+			TEXT("total=%d completed=%d skipped=%d failed=%d canceled=%d saved_files=%d cancel_while_saving=%s(saving=%d) progress=%.3f eta=%.3f finished=%s"),
+			FinalSnapshot.QueueTotalCount,
+			FinalSnapshot.QueueCompletedCount,
+			FinalSnapshot.QueueSkippedCount,
+			FinalSnapshot.QueueFailedCount,
+			FinalSnapshot.QueueCanceledCount,
+			SavedOutputFiles.Num(),
+			bCancelPassed ? TEXT("pass") : TEXT("fail"),
+			SavingCountAtCancel,
+			FinalSnapshot.QueueProgress01,
+			FinalSnapshot.QueueEtaSeconds,
+			bFinishedPassed ? TEXT("pass") : TEXT("fail"));
+		return bFinishedPassed && bCountsPassed && bCancelPassed && bOutputsPassed && bProgressPassed;
+	}
+
+	// VerifySSOTStageMeta는 SSOT commandlet을 전체 target으로 실행해 ssot_meta.json stages가 이름 순이고 stage별 실행 위치가 맞으며,
+	// start_ms/end_ms 기준으로 registry_snapshot→assets, cfg_rules→cfg 의존 순서와 game thread stage 직렬 순서를 지키는지, -notime이면 시간 필드가 빠지는지 검증한다.
+	bool VerifySSOTStageMeta(FString& OutDetail)
+	{
+		// SSOTStageRoot는 시간 기록 실행과 -notime 실행의 stage meta를 각각 새로 읽도록 이전 meta가 없는 출력 root다.
+		const FCommandletSmokeFixtureRoot SSOTStageRoot(TEXT("SSOTStageMeta"));
+		const FString& SSOTRootPath = SSOTStageRoot.Path;
+		if (!FFileHelper::SaveStringToFile(
+				FString(TEXT("DefaultEngine.ini|/Script/EngineSettings.GeneralProjectSettings|ProjectID\n")),
+				*FPaths::Combine(SSOTRootPath, TEXT("ssot_cfg.lst")),
+				FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			OutDetail = TEXT("fixture_write_failed");
+			return false;
 		}
+
+		// FMetaStage는 ssot_meta.json stages 항목 하나다.
+		struct FMetaStage
 		{
-			FADumpGraph Graph;
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("then") }));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("O"), TEXT("flow_control"), true, { TEXT("then") }));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("T"), TEXT("execution_sink"), true, {}));
-			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("O"));
-			AddExecutionPreviewTestLink(Graph, TEXT("O"), 0, TEXT("T"));
-			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
-			const bool bPassed = Preview.PathCount == 1 && Preview.Paths[0].StepCount == 3 && Preview.Paths[0].Steps[1].NodeId == TEXT("O") && Preview.Paths[0].TerminalNodeId == TEXT("T");
-			if (!Require(bPassed, TEXT("linear"), TEXT("path_mismatch"))) return false;
-		}
+			FString Name;
+			FString Thread;
+			bool bOk = false;
+			double StartMs = -1.0;
+			double EndMs = -1.0;
+			bool bHasTimeFields = false;
+		};
+
+		// RunAndReadMeta는 SSOT commandlet을 InArgs로 실행하고 ssot_meta.json stages를 파일 순서대로 읽는다.
+		auto RunAndReadMeta = [&SSOTRootPath](const TCHAR* InArgs, TArray<FMetaStage>& OutStages, bool& bOutHasDumpTime)
 		{
-			FADumpGraph Graph;
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("first"), TEXT("second") }));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("A"), TEXT("execution_sink"), true, {}));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("B"), TEXT("execution_sink"), true, {}));
-			AddExecutionPreviewTestLink(Graph, TEXT("E"), 1, TEXT("B"));
-			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("A"));
-			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
-			const bool bPassed = Preview.PathCount == 2 && Preview.Paths[0].Steps[1].ViaPinName == TEXT("first") && Preview.Paths[1].Steps[1].ViaPinName == TEXT("second");
-			if (!Require(bPassed, TEXT("branch_order"), TEXT("pin_order_mismatch"))) return false;
+			OutStages.Reset();
+			USSOTDumpCmdlet* SSOTCmdlet = NewObject<USSOTDumpCmdlet>(GetTransientPackage());
+			SSOTCmdlet->Main(FString::Printf(TEXT("-out=\"%s\" %s"), *SSOTRootPath, InArgs));
+
+			TSharedPtr<FJsonObject> MetaObject;
+			const TArray<TSharedPtr<FJsonValue>>* StageValues = nullptr;
+			if (!LoadCommandletJsonObjectFromFile(FPaths::Combine(SSOTRootPath, TEXT("ssot_meta.json")), MetaObject)
+				|| !MetaObject->TryGetArrayField(TEXT("stages"), StageValues))
+			{
+				return false;
+			}
+			bOutHasDumpTime = MetaObject->HasField(TEXT("dump_time_utc")) || MetaObject->HasField(TEXT("total_ms"));
+			for (const TSharedPtr<FJsonValue>& StageValue : *StageValues)
+			{
+				const TSharedPtr<FJsonObject> StageObject = StageValue.IsValid() ? StageValue->AsObject() : nullptr;
+				if (!StageObject.IsValid())
+				{
+					return false;
+				}
+				FMetaStage& Stage = OutStages.AddDefaulted_GetRef();
+				StageObject->TryGetStringField(TEXT("name"), Stage.Name);
+				StageObject->TryGetStringField(TEXT("thread"), Stage.Thread);
+				StageObject->TryGetBoolField(TEXT("ok"), Stage.bOk);
+				Stage.bHasTimeFields = StageObject->TryGetNumberField(TEXT("start_ms"), Stage.StartMs)
+					&& StageObject->TryGetNumberField(TEXT("end_ms"), Stage.EndMs)
+					&& StageObject->HasField(TEXT("ms"));
+			}
+			return true;
+		};
+
+		TArray<FMetaStage> TimedStages;
+		TArray<FMetaStage> NoTimeStages;
+		bool bTimedHasDumpTime = false;
+		bool bNoTimeHasDumpTime = true;
+		const bool bTimedRead = RunAndReadMeta(TEXT("-target=all -incremental"), TimedStages, bTimedHasDumpTime);
+		const bool bNoTimeRead = RunAndReadMeta(TEXT("-target=tags -notime"), NoTimeStages, bNoTimeHasDumpTime);
+		if (!bTimedRead || !bNoTimeRead)
+		{
+			OutDetail = FString::Printf(TEXT("meta_read_failed timed=%d notime=%d"), bTimedRead ? 1 : 0, bNoTimeRead ? 1 : 0);
+			return false;
 		}
+
+		// 전체 target의 stages는 이름 순으로 정확히 이 목록이어야 한다. assets와 cfg_rules만 task graph에서 돈다.
+		const TCHAR* ExpectedStageNames[] = {
+			TEXT("asset_stamps"), TEXT("assets"), TEXT("cfg"), TEXT("cfg_rules"), TEXT("input"), TEXT("registry_snapshot"), TEXT("tags"), TEXT("wheel")
+		};
+		TArray<FString> StageNames;
+		TMap<FString, const FMetaStage*> StageByName;
+		bool bThreadsPassed = true;
+		bool bTimeFieldsPassed = bTimedHasDumpTime;
+		for (const FMetaStage& Stage : TimedStages)
 		{
-			FADumpGraph Graph;
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("a"), TEXT("b") }));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("A"), TEXT("flow_control"), true, { TEXT("then") }));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("B"), TEXT("flow_control"), true, { TEXT("then") }));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("M"), TEXT("execution_sink"), true, {}));
-			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("A"));
-			AddExecutionPreviewTestLink(Graph, TEXT("E"), 1, TEXT("B"));
-			AddExecutionPreviewTestLink(Graph, TEXT("A"), 0, TEXT("M"));
-			AddExecutionPreviewTestLink(Graph, TEXT("B"), 0, TEXT("M"));
-			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
-			const bool bPassed = Preview.PathCount == 2 && Preview.Paths[0].TerminalNodeId == TEXT("M") && Preview.Paths[1].TerminalNodeId == TEXT("M");
-			if (!Require(bPassed, TEXT("merge"), TEXT("merge_mismatch"))) return false;
+			StageNames.Add(Stage.Name);
+			StageByName.Add(Stage.Name, &Stage);
+			const bool bTaskGraphStage = Stage.Name == TEXT("assets") || Stage.Name == TEXT("cfg_rules");
+			bThreadsPassed &= Stage.Thread == (bTaskGraphStage ? TEXT("task_graph") : TEXT("game_thread"));
+			bTimeFieldsPassed &= Stage.bHasTimeFields && Stage.StartMs >= 0.0 && Stage.EndMs >= Stage.StartMs;
 		}
+		bool bNamesPassed = StageNames.Num() == UE_ARRAY_COUNT(ExpectedStageNames);
+		for (int32 NameIndex = 0; bNamesPassed && NameIndex < StageNames.Num(); ++NameIndex)
 		{
-			FADumpGraph Graph;
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), true, { TEXT("loop") }));
-			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("E"));
-			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
-			if (!Require(Preview.PathCount == 1 && Preview.CyclePathCount == 1 && Preview.Paths[0].StepCount == 2, TEXT("self_cycle"), TEXT("cycle_mismatch"))) return false;
+			bNamesPassed = StageNames[NameIndex].Equals(ExpectedStageNames[NameIndex], ESearchCase::CaseSensitive);
 		}
+		if (!bNamesPassed || !bTimeFieldsPassed)
 		{
-			FADumpGraph Graph;
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("then") }));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("A"), TEXT("flow_control"), true, { TEXT("then") }));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("B"), TEXT("flow_control"), true, { TEXT("then") }));
-			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("A"));
-			AddExecutionPreviewTestLink(Graph, TEXT("A"), 0, TEXT("B"));
-			AddExecutionPreviewTestLink(Graph, TEXT("B"), 0, TEXT("A"));
-			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
-			if (!Require(Preview.PathCount == 1 && Preview.CyclePathCount == 1 && Preview.Paths[0].TerminalNodeId == TEXT("A"), TEXT("multi_cycle"), TEXT("cycle_mismatch"))) return false;
+			OutDetail = FString::Printf(TEXT("stages=%s names=%s time_fields=%s"),
+				*FString::Join(StageNames, TEXT(",")),
+				bNamesPassed ? TEXT("pass") : TEXT("fail"),
+				bTimeFieldsPassed ? TEXT("pass") : TEXT("fail"));
+			return false;
 		}
+
+		// IsBefore는 InFirst stage가 InSecond stage 시작 전에 끝났는지 본다.
+		auto IsBefore = [&StageByName](const TCHAR* InFirst, const TCHAR* InSecond)
 		{
-			FADumpGraph Graph;
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("then") }));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("A"), TEXT("flow_control"), true, { TEXT("then") }));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("B"), TEXT("flow_control"), true, { TEXT("then") }));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("C"), TEXT("execution_sink"), true, {}));
-			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("A"));
-			AddExecutionPreviewTestLink(Graph, TEXT("A"), 0, TEXT("B"));
-			AddExecutionPreviewTestLink(Graph, TEXT("B"), 0, TEXT("C"));
-			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true, 64, 2);
-			if (!Require(Preview.PathCount == 1 && Preview.DepthLimitedPathCount == 1 && Preview.Paths[0].TerminalNodeId == TEXT("B") && Preview.bTruncated, TEXT("depth_limit"), TEXT("depth_mismatch"))) return false;
+			return StageByName[InFirst]->EndMs <= StageByName[InSecond]->StartMs;
+		};
+
+		// 의존 순서: stamp 비교 → registry snapshot → assets, cfg 규칙 파싱 → GConfig 조회. game thread stage는 Main 순서대로 직렬이다.
+		const bool bDependencyPassed = IsBefore(TEXT("asset_stamps"), TEXT("registry_snapshot"))
+			&& IsBefore(TEXT("registry_snapshot"), TEXT("assets"))
+			&& IsBefore(TEXT("cfg_rules"), TEXT("cfg"));
+		const bool bGameThreadOrderPassed = IsBefore(TEXT("registry_snapshot"), TEXT("tags"))
+			&& IsBefore(TEXT("tags"), TEXT("input"))
+			&& IsBefore(TEXT("input"), TEXT("wheel"))
+			&& IsBefore(TEXT("wheel"), TEXT("cfg"));
+
+		// registry/assets/stamp/cfg 규칙/tags는 fixture만으로 성공해야 한다. input/wheel/cfg 값은 프로젝트 자산과 설정에 따라 달라 ok를 보지 않는다.
+		const bool bStageOkPassed = StageByName[TEXT("asset_stamps")]->bOk
+			&& StageByName[TEXT("registry_snapshot")]->bOk
+			&& StageByName[TEXT("assets")]->bOk
+			&& StageByName[TEXT("cfg_rules")]->bOk
+			&& StageByName[TEXT("tags")]->bOk;
+
+		// -notime은 단일 target이라 tags stage 하나만 남고 시간 필드가 모두 빠져야 한다.
+		const bool bNoTimePassed = !bNoTimeHasDumpTime
+			&& NoTimeStages.Num() == 1
+			&& NoTimeStages[0].Name == TEXT("tags")
+			&& !NoTimeStages[0].bHasTimeFields
+			&& NoTimeStages[0].StartMs < 0.0;
+
+		OutDetail = FString::Printf(
+			TEXT("stages=%d threads=%s dependency=%s game_thread_order=%s stage_ok=%s notime=%s"),
+			TimedStages.Num(),
+			bThreadsPassed ? TEXT("pass") : TEXT("fail"),
+			bDependencyPassed ? TEXT("pass") : TEXT("fail"),
+			bGameThreadOrderPassed ? TEXT("pass") : TEXT("fail"),
+			bStageOkPassed ? TEXT("pass") : TEXT("fail"),
+			bNoTimePassed ? TEXT("pass") : TEXT("fail"));
+		return bThreadsPassed && bDependencyPassed && bGameThreadOrderPassed && bStageOkPassed && bNoTimePassed;
+	}
+
+	// VerifySSOTAssetDelta는 /Engine/BasicShapes 자산 목록으로 만든 이전 state를 fixture로 고쳐 -incremental 실행이
+	// 빠진 package는 added, stamp가 다른 package는 modified, 디스크에 없는 package는 removed로 내고, 그대로인 package는 이전 row를 재사용하며,
+	// 바뀐 것이 없는 다음 실행은 빈 delta를 내는지 검증한다.
+	bool VerifySSOTAssetDelta(FString& OutDetail)
+	{
+		// SSOTDeltaRoot는 delta가 이번 check의 첫 실행이 만든 state만 기준으로 삼도록 이전 실행의 state와 delta 파일이 없는 출력 root에서 시작한다.
+		const FCommandletSmokeFixtureRoot SSOTDeltaRoot(TEXT("SSOTAssetDelta"));
+		const FString& SSOTRootPath = SSOTDeltaRoot.Path;
+		const FString StateFilePath = FPaths::Combine(SSOTRootPath, TEXT("ssot_assets_state.json"));
+		const FString DeltaFilePath = FPaths::Combine(SSOTRootPath, TEXT("ssot_assets_delta.json"));
+		const FString ListingFilePath = FPaths::Combine(SSOTRootPath, TEXT("ssot_assets.json"));
+		const FString DeltaRoot = TEXT("/Engine/BasicShapes");
+		const FString RemovedPackageName = DeltaRoot + TEXT("/ADumpSSOTDeltaRemoved");
+		const FString ReusedClassPath = TEXT("/Script/AssetDump.ADumpSSOTDeltaReused");
+
+		// RunIncrementalAssets는 DeltaRoot만 대상으로 -incremental 자산 목록을 한 번 실행한다.
+		auto RunIncrementalAssets = [&SSOTRootPath, &DeltaRoot]()
+		{
+			USSOTDumpCmdlet* SSOTCmdlet = NewObject<USSOTDumpCmdlet>(GetTransientPackage());
+			return SSOTCmdlet->Main(FString::Printf(TEXT("-out=\"%s\" -target=assets -incremental -asset_roots=%s -notime"), *SSOTRootPath, *DeltaRoot)) == 0;
+		};
+
+		// ReadDeltaPackages는 delta 파일의 InFieldName 배열에서 package 이름을 순서대로 읽는다.
+		auto ReadDeltaPackages = [](const TSharedPtr<FJsonObject>& InDeltaObject, const TCHAR* InFieldName)
+		{
+			TArray<FString> PackageNames;
+			const TArray<TSharedPtr<FJsonValue>>* PackageValues = nullptr;
+			if (InDeltaObject.IsValid() && InDeltaObject->TryGetArrayField(InFieldName, PackageValues))
+			{
+				for (const TSharedPtr<FJsonValue>& PackageValue : *PackageValues)
+				{
+					const TSharedPtr<FJsonObject> PackageObject = PackageValue.IsValid() ? PackageValue->AsObject() : nullptr;
+					PackageNames.Add(PackageObject.IsValid() ? PackageObject->GetStringField(TEXT("package")) : FString());
+				}
+			}
+			return PackageNames;
+		};
+
+		// 첫 실행은 이전 state가 없어 모든 package가 added이고 다음 실행 기준 state를 남긴다.
+		TSharedPtr<FJsonObject> BaseStateObject;
+		const TArray<TSharedPtr<FJsonValue>>* BasePackageValues = nullptr;
+		if (!RunIncrementalAssets()
+			|| !LoadCommandletJsonObjectFromFile(StateFilePath, BaseStateObject)
+			|| !BaseStateObject->TryGetArrayField(TEXT("packages"), BasePackageValues)
+			|| BasePackageValues->Num() < 3)
+		{
+			OutDetail = FString::Printf(TEXT("base_state_failed packages=%d"), BasePackageValues ? BasePackageValues->Num() : 0);
+			return false;
 		}
+
+		// fixture state: 첫 package는 빼서 added, 둘째는 stamp를 바꿔 modified, 셋째는 row class를 바꿔 재사용 확인, 없는 package를 더해 removed로 만든다.
+		TArray<TSharedPtr<FJsonValue>> FixturePackageValues;
+		FString AddedPackageName;
+		FString ModifiedPackageName;
+		FString ReusedPackageName;
+		for (int32 PackageIndex = 0; PackageIndex < BasePackageValues->Num(); ++PackageIndex)
 		{
-			FADumpGraph Graph;
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("one"), TEXT("two"), TEXT("three") }));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("A"), TEXT("execution_sink"), true, {}));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("B"), TEXT("execution_sink"), true, {}));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("C"), TEXT("execution_sink"), true, {}));
-			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("A"));
-			AddExecutionPreviewTestLink(Graph, TEXT("E"), 1, TEXT("B"));
-			AddExecutionPreviewTestLink(Graph, TEXT("E"), 2, TEXT("C"));
-			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true, 2, 32);
-			if (!Require(Preview.PathCount == 2 && Preview.OmittedPathCount == 1 && Preview.bTruncated && Preview.Warnings.Contains(TEXT("path_limit_reached")), TEXT("path_limit"), TEXT("limit_mismatch"))) return false;
+			const TSharedPtr<FJsonObject> BasePackageObject = (*BasePackageValues)[PackageIndex]->AsObject();
+			const FString PackageName = BasePackageObject->GetStringField(TEXT("package"));
+			if (PackageIndex == 0)
+			{
+				AddedPackageName = PackageName;
+				continue;
+			}
+
+			TSharedRef<FJsonObject> FixturePackageObject = MakeShared<FJsonObject>(*BasePackageObject);
+			if (PackageIndex == 1)
+			{
+				ModifiedPackageName = PackageName;
+				FixturePackageObject->SetStringField(TEXT("stamp"), TEXT("0:0"));
+			}
+			else if (PackageIndex == 2)
+			{
+				ReusedPackageName = PackageName;
+				TArray<TSharedPtr<FJsonValue>> ReusedAssetValues;
+				for (const TSharedPtr<FJsonValue>& AssetValue : BasePackageObject->GetArrayField(TEXT("assets")))
+				{
+					TSharedRef<FJsonObject> ReusedAssetObject = MakeShared<FJsonObject>(*AssetValue->AsObject());
+					ReusedAssetObject->SetStringField(TEXT("class"), ReusedClassPath);
+					ReusedAssetValues.Add(MakeShared<FJsonValueObject>(ReusedAssetObject));
+				}
+				FixturePackageObject->SetArrayField(TEXT("assets"), ReusedAssetValues);
+			}
+			FixturePackageValues.Add(MakeShared<FJsonValueObject>(FixturePackageObject));
 		}
 		{
-			FADumpGraph Graph;
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("A"), TEXT("flow_control"), true, { TEXT("then") }));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("B"), TEXT("flow_control"), true, { TEXT("then") }));
-			AddExecutionPreviewTestLink(Graph, TEXT("A"), 0, TEXT("B"));
-			AddExecutionPreviewTestLink(Graph, TEXT("B"), 0, TEXT("A"));
-			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
-			if (!Require(Preview.EntryCount == 0 && Preview.PathCount == 0 && Preview.Warnings.Contains(TEXT("no_entry_nodes")), TEXT("no_entry"), TEXT("warning_missing"))) return false;
+			TSharedRef<FJsonObject> RemovedAssetObject = MakeShared<FJsonObject>();
+			RemovedAssetObject->SetStringField(TEXT("object_path"), RemovedPackageName + TEXT(".ADumpSSOTDeltaRemoved"));
+			RemovedAssetObject->SetStringField(TEXT("class"), TEXT("/Script/Engine.StaticMesh"));
+			RemovedAssetObject->SetStringField(TEXT("package_path"), DeltaRoot);
+			TSharedRef<FJsonObject> RemovedPackageObject = MakeShared<FJsonObject>();
+			RemovedPackageObject->SetStringField(TEXT("package"), RemovedPackageName);
+			RemovedPackageObject->SetStringField(TEXT("stamp"), TEXT("1:1"));
+			TArray<TSharedPtr<FJsonValue>> RemovedAssetValues;
+			RemovedAssetValues.Add(MakeShared<FJsonValueObject>(RemovedAssetObject));
+			RemovedPackageObject->SetArrayField(TEXT("assets"), RemovedAssetValues);
+			FixturePackageValues.Add(MakeShared<FJsonValueObject>(RemovedPackageObject));
 		}
+
+		TSharedRef<FJsonObject> FixtureStateObject = MakeShared<FJsonObject>(*BaseStateObject);
+		FixtureStateObject->SetArrayField(TEXT("packages"), FixturePackageValues);
+		FString FixtureStateText;
+		if (!SerializeJsonObjectText(FixtureStateObject, FixtureStateText)
+			|| !FFileHelper::SaveStringToFile(FixtureStateText, *StateFilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
 		{
-			FADumpGraph Graph;
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("E"), TEXT("event"), false, { TEXT("then") }));
-			Graph.Nodes.Add(MakeExecutionPreviewTestNode(TEXT("D"), TEXT("execution_sink"), true, {}));
-			AddExecutionPreviewTestLink(Graph, TEXT("E"), 0, TEXT("D"), EADumpLinkKind::Data);
-			const FADumpExecutionPathPreview Preview = ADumpGraphExt::BuildExecutionPathPreview(Graph, true, true);
-			if (!Require(Preview.PathCount == 1 && Preview.Paths[0].Termination == TEXT("terminal") && Preview.Paths[0].TerminalNodeId == TEXT("E"), TEXT("data_link_exclusion"), TEXT("data_link_traversed"))) return false;
+			OutDetail = TEXT("fixture_write_failed");
+			return false;
 		}
 
-		OutDetailText = FString::Printf(TEXT("passed=%d total=13"), PassedCount);
-		return PassedCount == 13;
-	}
+		// 둘째 실행은 fixture state 기준 delta를 내야 한다.
+		TSharedPtr<FJsonObject> DeltaObject;
+		TSharedPtr<FJsonObject> ListingObject;
+		TSharedPtr<FJsonObject> NextStateObject;
+		const bool bDeltaRunPassed = RunIncrementalAssets()
+			&& LoadCommandletJsonObjectFromFile(DeltaFilePath, DeltaObject)
+			&& LoadCommandletJsonObjectFromFile(ListingFilePath, ListingObject)
+			&& LoadCommandletJsonObjectFromFile(StateFilePath, NextStateObject);
+		const TArray<FString> AddedPackages = ReadDeltaPackages(DeltaObject, TEXT("added"));
+		const TArray<FString> ModifiedPackages = ReadDeltaPackages(DeltaObject, TEXT("modified"));
+		const TArray<FString> RemovedPackages = ReadDeltaPackages(DeltaObject, TEXT("removed"));
+
+		// 목록은 재사용 package row의 바꾼 class를 그대로 담고, 다시 읽은 package와 삭제 package row는 실제 registry 기준이어야 한다.
+		int32 ReusedRowCount = 0;
+		int32 RemovedRowCount = 0;
+		int32 ListingRowCount = 0;
+		if (ListingObject.IsValid())
+		{
+			for (const TSharedPtr<FJsonValue>& AssetValue : ListingObject->GetArrayField(TEXT("assets")))
+			{
+				const TSharedPtr<FJsonObject> AssetObject = AssetValue->AsObject();
+				const FString ObjectPath = AssetObject->GetStringField(TEXT("object_path"));
+				ReusedRowCount += AssetObject->GetStringField(TEXT("class")) == ReusedClassPath ? 1 : 0;
+				RemovedRowCount += ObjectPath.StartsWith(RemovedPackageName + TEXT(".")) ? 1 : 0;
+				++ListingRowCount;
+			}
+		}
+		const bool bDeltaPassed = bDeltaRunPassed
+			&& DeltaObject->GetStringField(TEXT("base")) == TEXT("previous")
+			&& AddedPackages == TArray<FString>({ AddedPackageName })
+			&& ModifiedPackages == TArray<FString>({ ModifiedPackageName })
+			&& RemovedPackages == TArray<FString>({ RemovedPackageName });
+		const bool bListingPassed = ReusedRowCount > 0 && RemovedRowCount == 0 && ListingRowCount > ReusedRowCount;
+
+		// 새 state는 수정 package의 실제 stamp를 담고 삭제 package는 빠져야 한다.
+		bool bNextStatePassed = NextStateObject.IsValid();
+		int32 NextStatePackageCount = 0;
+		if (bNextStatePassed)
+		{
+			for (const TSharedPtr<FJsonValue>& PackageValue : NextStateObject->GetArrayField(TEXT("packages")))
+			{
+				const TSharedPtr<FJsonObject> PackageObject = PackageValue->AsObject();
+				const FString PackageName = PackageObject->GetStringField(TEXT("package"));
+				bNextStatePassed &= PackageName != RemovedPackageName;
+				bNextStatePassed &= PackageName != ModifiedPackageName || PackageObject->GetStringField(TEXT("stamp")) != TEXT("0:0");
+				++NextStatePackageCount;
+			}
+			bNextStatePassed &= NextStatePackageCount == BasePackageValues->Num();
+		}
+
+		// 셋째 실행은 바뀐 package가 없으므로 세 배열이 모두 비어야 한다.
+		TSharedPtr<FJsonObject> StableDeltaObject;
+		const bool bStablePassed = RunIncrementalAssets()
+			&& LoadCommandletJsonObjectFromFile(DeltaFilePath, StableDeltaObject)
+			&& ReadDeltaPackages(StableDeltaObject, TEXT("added")).Num() == 0
+			&& ReadDeltaPackages(StableDeltaObject, TEXT("modified")).Num() == 0
+			&& ReadDeltaPackages(StableDeltaObject, TEXT("removed")).Num() == 0;
 
-	// ResolveBPSearchKindCount는 index summary에서 kind별 count를 반환한다.
-	int32 ResolveBPSearchKindCount(const FADumpBPSearchIndex& InIndex, const FString& InKind)
-	{
-		if (InKind == TEXT("graph")) return InIndex.GraphSymbolCount;
-		if (InKind == TEXT("event")) return InIndex.EventSymbolCount;
-		if (InKind == TEXT("function_call")) return InIndex.FunctionCallSymbolCount;
-		if (InKind == TEXT("interface_call")) return InIndex.InterfaceCallSymbolCount;
-		if (InKind == TEXT("variable_read")) return InIndex.VariableReadSymbolCount;
-		if (InKind == TEXT("variable_write")) return InIndex.VariableWriteSymbolCount;
-		if (InKind == TEXT("class_reference")) return InIndex.ClassReferenceSymbolCount;
-		return INDEX_NONE;
+		OutDetail = FString::Printf(
+			TEXT("packages=%d added=%d modified=%d removed=%d delta=%s listing=%s(reused_rows=%d) next_state=%s stable=%s"),
+			BasePackageValues->Num(),
+			AddedPackages.Num(),
+			ModifiedPackages.Num(),
+			RemovedPackages.Num(),
+			bDeltaPassed ? TEXT("pass") : TEXT("fail"),
+			bListingPassed ? TEXT("pass") : TEXT("fail"),
+			ReusedRowCount,
+			bNextStatePassed ? TEXT("pass") : TEXT("fail"),
+			bStablePassed ? TEXT("pass") : TEXT("fail"));
+		return bDeltaPassed && bListingPassed && bNextStatePassed && bStablePassed;
 	}
 
-	// TestBPSearchIndexContract는 schema/count/order/source와 term 계약을 검사한다.
-	bool TestBPSearchIndexContract(const FADumpResult& InResult, FString& OutFailureReason)
+	// VerifyImpactGraphBenchmark는 100k node 합성 graph의 SCC 압축, closure count와 member walk 결과와 소요 시간을 검증한다.
+	bool VerifyImpactGraphBenchmark(FString& OutDetail)
 	{
-		OutFailureReason.Reset();
-		const FADumpBPSearchIndex& Index = InResult.BPSearchIndex;
-		if (Index.SchemaVersion != TEXT("bp_search_index_v1") || !Index.bSupported || !Index.UnsupportedReason.IsEmpty())
-		{
-			OutFailureReason = FString::Printf(TEXT("header=%s supported=%d reason=%s"), *Index.SchemaVersion, Index.bSupported ? 1 : 0, *Index.UnsupportedReason);
-			return false;
-		}
-		if (Index.MaxSymbols != 512 || Index.SymbolCount != Index.Symbols.Num() || Index.SymbolCount > Index.MaxSymbols
-			|| Index.bTruncated != (Index.OmittedSymbolCount > 0))
-		{
-			OutFailureReason = TEXT("summary_count_mismatch");
-			return false;
-		}
+		constexpr int32 BenchmarkNodeCount = 100000;
+		constexpr int32 BenchmarkCycleSize = 4;
+		constexpr int32 BenchmarkGroupCount = BenchmarkNodeCount / BenchmarkCycleSize;
 
-		TMap<FString, int32> ActualKindCounts;
-		TSet<FString> ClassPaths;
-		TSet<FString> SymbolIds;
-		TMap<FString, const FADumpGraph*> GraphByName;
-		for (const FADumpGraph& Graph : InResult.Graphs)
+		// BenchmarkEdges는 4-node cycle group 사슬과 앞쪽 group으로의 결정적 shortcut edge다.
+		TArray<TPair<int32, int32>> BenchmarkEdges;
+		BenchmarkEdges.Reserve(BenchmarkNodeCount + BenchmarkGroupCount * 2);
+		for (int32 GroupIndex = 0; GroupIndex < BenchmarkGroupCount; ++GroupIndex)
 		{
-			GraphByName.Add(Graph.GraphName, &Graph);
+			const int32 FirstNode = GroupIndex * BenchmarkCycleSize;
+			for (int32 MemberIndex = 0; MemberIndex < BenchmarkCycleSize; ++MemberIndex)
+			{
+				BenchmarkEdges.Emplace(FirstNode + MemberIndex, FirstNode + (MemberIndex + 1) % BenchmarkCycleSize);
+			}
+			if (GroupIndex + 1 < BenchmarkGroupCount)
+			{
+				BenchmarkEdges.Emplace(FirstNode + 3, FirstNode + BenchmarkCycleSize);
+			}
+			const int32 ShortcutGroup = GroupIndex + 2 + (GroupIndex * 7) % 13;
+			if (ShortcutGroup < BenchmarkGroupCount)
+			{
+				BenchmarkEdges.Emplace(FirstNode + 1, ShortcutGroup * BenchmarkCycleSize + 2);
+			}
 		}
 
-		for (int32 SymbolIndex = 0; SymbolIndex < Index.Symbols.Num(); ++SymbolIndex)
-		{
-			const FADumpBPSearchSymbol& Symbol = Index.Symbols[SymbolIndex];
-			const FString ExpectedId = FString::Printf(TEXT("symbol_%03d"), SymbolIndex);
-			if (Symbol.SymbolId != ExpectedId || SymbolIds.Contains(Symbol.SymbolId))
+		FADumpImpactGraph BenchmarkGraph;
+		const double StartSeconds = FPlatformTime::Seconds();
+		ADumpImpactGraph::BuildImpactGraph(BenchmarkNodeCount, BenchmarkEdges, BenchmarkGraph);
+		const double BuiltSeconds = FPlatformTime::Seconds();
+
+		// MiddleNode는 양방향 closure가 모두 절반 정도인 기준 node다.
+		const int32 MiddleNode = (BenchmarkGroupCount / 2) * BenchmarkCycleSize;
+		const int32 MiddleScc = BenchmarkGraph.NodeScc.IsValidIndex(MiddleNode) ? BenchmarkGraph.NodeScc[MiddleNode] : INDEX_NONE;
+		TArray<int32> MiddleDependents;
+		const double WalkStartSeconds = FPlatformTime::Seconds();
+		ADumpImpactGraph::CollectReachableNodes(BenchmarkGraph, MiddleNode, true, MiddleDependents);
+		const double WalkedSeconds = FPlatformTime::Seconds();
+
+		const int32 FirstScc = BenchmarkGraph.NodeScc.IsValidIndex(0) ? BenchmarkGraph.NodeScc[0] : INDEX_NONE;
+		const int32 LastScc = BenchmarkGraph.NodeScc.IsValidIndex(BenchmarkNodeCount - 1) ? BenchmarkGraph.NodeScc[BenchmarkNodeCount - 1] : INDEX_NONE;
+		const bool bSccValid = BenchmarkGraph.SccCount == BenchmarkGroupCount
+			&& FirstScc != INDEX_NONE
+			&& MiddleScc != INDEX_NONE
+			&& LastScc != INDEX_NONE;
+		OutDetail = FString::Printf(
+			TEXT("nodes=%d edges=%d scc=%d dag_edges=%d middle_dependencies=%d middle_dependents=%d walked=%d build_ms=%.2f walk_ms=%.3f"),
+			BenchmarkNodeCount,
+			BenchmarkEdges.Num(),
+			BenchmarkGraph.SccCount,
+			BenchmarkGraph.DagForwardTargets.Num(),
+			bSccValid ? BenchmarkGraph.DependencyCounts[MiddleScc] : -1,
+			bSccValid ? BenchmarkGraph.DependentCounts[MiddleScc] : -1,
+			MiddleDependents.Num(),
+			(BuiltSeconds - StartSeconds) * 1000.0,
+			(WalkedSeconds - WalkStartSeconds) * 1000.0);
+		return bSccValid
+			&& BenchmarkGraph.DependencyCounts[FirstScc] == BenchmarkNodeCount - 1
+			&& BenchmarkGraph.DependentCounts[FirstScc] == BenchmarkCycleSize - 1
+			&& BenchmarkGraph.DependencyCounts[LastScc] == BenchmarkCycleSize - 1
+			&& BenchmarkGraph.DependentCounts[LastScc] == BenchmarkNodeCount - 1
+			&& BenchmarkGraph.DependencyCounts[MiddleScc] == BenchmarkNodeCount - MiddleNode - 1
+			&& BenchmarkGraph.DependentCounts[MiddleScc] == MiddleNode + BenchmarkCycleSize - 1
+			&& MiddleDependents.Num() == BenchmarkGraph.DependentCounts[MiddleScc]
+			&& MiddleDependents[0] == 0
+			&& !MiddleDependents.Contains(MiddleNode);
+	}
+
+	// VerifyDataAssetDiffHashMergeBenchmark는 10k field DataAsset 값으로 hash merge diff 결과와 소요 시간을 검증한다.
+	bool VerifyDataAssetDiffHashMergeBenchmark(FString& OutDetail)
+	{
+		constexpr int32 BenchmarkFieldCount = 10000;
+		constexpr int32 BenchmarkAddedCount = 30;
+
+		// MakeBenchmarkRow는 key 삽입 순서를 뒤집을 수 있는 struct 값 하나를 만든다.
+		auto MakeBenchmarkRow = [](int32 InRowIndex, bool bReverseKeys, const FString& InNameText)
+		{
+			TArray<TSharedPtr<FJsonValue>> TagArray;
+			for (int32 TagIndex = 0; TagIndex < 8; ++TagIndex)
+			{
+				TagArray.Add(MakeShared<FJsonValueNumber>(InRowIndex * 8 + TagIndex));
+			}
+			TSharedRef<FJsonObject> RowObject = MakeShared<FJsonObject>();
+			if (bReverseKeys)
+			{
+				RowObject->SetArrayField(TEXT("tags"), TagArray);
+				RowObject->SetStringField(TEXT("name"), InNameText);
+				RowObject->SetNumberField(TEXT("id"), InRowIndex);
+			}
+			else
 			{
-				OutFailureReason = FString::Printf(TEXT("symbol_id=%s expected=%s"), *Symbol.SymbolId, *ExpectedId);
-				return false;
+				RowObject->SetNumberField(TEXT("id"), InRowIndex);
+				RowObject->SetStringField(TEXT("name"), InNameText);
+				RowObject->SetArrayField(TEXT("tags"), TagArray);
 			}
-			SymbolIds.Add(Symbol.SymbolId);
-			if (Symbol.Name.IsEmpty() || Symbol.NormalizedName != ADumpBPSearchIndex::NormalizeSearchName(Symbol.Name)
-				|| Symbol.SearchTerms.IsEmpty() || Symbol.SearchTerms.Num() > 8)
+			return MakeShared<FJsonValueObject>(RowObject);
+		};
+
+		// MakeBenchmarkField는 벤치마크용 data_asset_values field 한 건을 만든다.
+		auto MakeBenchmarkField = [](const FString& InPropertyName, const TCHAR* InCppType, EADumpValueKind InValueKind, const TSharedPtr<FJsonValue>& InValueJson)
+		{
+			FADumpDataAssetField Field;
+			Field.PropertyName = InPropertyName;
+			Field.DisplayName = InPropertyName;
+			Field.Category = TEXT("Benchmark");
+			Field.CppType = InCppType;
+			Field.ValueKind = InValueKind;
+			Field.ValueJson = InValueJson;
+			return Field;
+		};
+
+		FADumpDataAssetValues BaselineValues;
+		BaselineValues.SchemaVersion = ADumpDataAsset::GetSchemaVersionText();
+		FADumpDataAssetValues CurrentValues;
+		CurrentValues.SchemaVersion = ADumpDataAsset::GetSchemaVersionText();
+		for (int32 RowIndex = 0; RowIndex < BenchmarkFieldCount; ++RowIndex)
+		{
+			const FString PropertyName = FString::Printf(TEXT("Field_%05d"), RowIndex);
+			const FString NameText = FString::Printf(TEXT("Row %d"), RowIndex);
+			BaselineValues.Fields.Add(MakeBenchmarkField(PropertyName, TEXT("FADumpBenchRow"), EADumpValueKind::Struct, MakeBenchmarkRow(RowIndex, false, NameText)));
+			if (RowIndex % 500 == 3)
 			{
-				OutFailureReason = FString::Printf(TEXT("symbol_shape=%s"), *Symbol.SymbolId);
-				return false;
+				continue;
 			}
-			TSet<FString> UniqueTerms;
-			for (const FString& Term : Symbol.SearchTerms)
+			if (RowIndex % 250 == 2)
 			{
-				const FString Key = Term.ToLower();
-				if (Term.IsEmpty() || UniqueTerms.Contains(Key))
-				{
-					OutFailureReason = FString::Printf(TEXT("term=%s symbol=%s"), *Term, *Symbol.SymbolId);
-					return false;
-				}
-				UniqueTerms.Add(Key);
+				CurrentValues.Fields.Add(MakeBenchmarkField(PropertyName, TEXT("int32"), EADumpValueKind::Int, MakeShared<FJsonValueNumber>(RowIndex)));
+				continue;
 			}
-			ActualKindCounts.FindOrAdd(Symbol.Kind)++;
+			const FString CurrentNameText = RowIndex % 100 == 1 ? NameText + TEXT(" (edited)") : NameText;
+			CurrentValues.Fields.Add(MakeBenchmarkField(PropertyName, TEXT("FADumpBenchRow"), EADumpValueKind::Struct, MakeBenchmarkRow(RowIndex, true, CurrentNameText)));
+		}
+		for (int32 AddedIndex = 0; AddedIndex < BenchmarkAddedCount; ++AddedIndex)
+		{
+			CurrentValues.Fields.Add(MakeBenchmarkField(FString::Printf(TEXT("Field_Added_%02d"), AddedIndex), TEXT("bool"), EADumpValueKind::Bool, MakeShared<FJsonValueBoolean>(true)));
+		}
+
+		FADumpDataAssetDiff BenchmarkDiff;
+		TArray<FADumpIssue> BenchmarkIssues;
+		const double StartSeconds = FPlatformTime::Seconds();
+		const bool bBuilt = ADumpDataDiff::BuildDataAssetDiffFromValues(
+			BaselineValues,
+			CurrentValues,
+			TEXT("/AssetDump/Benchmark/DA_Benchmark.DA_Benchmark"),
+			BenchmarkDiff,
+			BenchmarkIssues);
+		const double ElapsedMilliseconds = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+
+		// 대소문자만 다른 문자열 값은 canonical 문자열 비교 시절처럼 unchanged여야 한다.
+		FADumpDataAssetValues CaseBaselineValues;
+		CaseBaselineValues.SchemaVersion = ADumpDataAsset::GetSchemaVersionText();
+		CaseBaselineValues.Fields.Add(MakeBenchmarkField(TEXT("Label"), TEXT("FString"), EADumpValueKind::String, MakeShared<FJsonValueString>(TEXT("Row"))));
+		FADumpDataAssetValues CaseCurrentValues = CaseBaselineValues;
+		CaseCurrentValues.Fields[0].ValueJson = MakeShared<FJsonValueString>(TEXT("ROW"));
+		FADumpDataAssetDiff CaseDiff;
+		TArray<FADumpIssue> CaseIssues;
+		const bool bCaseInsensitive = ADumpDataDiff::BuildDataAssetDiffFromValues(
+			CaseBaselineValues,
+			CaseCurrentValues,
+			TEXT("/AssetDump/Benchmark/DA_Case.DA_Case"),
+			CaseDiff,
+			CaseIssues)
+			&& CaseDiff.UnchangedCount == 1
+			&& CaseDiff.Changes.IsEmpty();
 
-			if (Symbol.Kind == TEXT("graph"))
+		OutDetail = FString::Printf(
+			TEXT("fields=%d added=%d removed=%d changed=%d type_changed=%d unchanged=%d case_insensitive=%s elapsed_ms=%.2f"),
+			BenchmarkFieldCount,
+			BenchmarkDiff.AddedCount,
+			BenchmarkDiff.RemovedCount,
+			BenchmarkDiff.ChangedCount,
+			BenchmarkDiff.TypeChangedCount,
+			BenchmarkDiff.UnchangedCount,
+			bCaseInsensitive ? TEXT("true") : TEXT("false"),
+			ElapsedMilliseconds);
+		return bBuilt
+			&& bCaseInsensitive
+			&& BenchmarkDiff.AddedCount == BenchmarkAddedCount
+			&& BenchmarkDiff.RemovedCount == 20
+			&& BenchmarkDiff.ChangedCount == 100
+			&& BenchmarkDiff.TypeChangedCount == 40
+			&& BenchmarkDiff.UnchangedCount == 9840
+			&& BenchmarkDiff.Changes.Num() == 190
+			&& BenchmarkDiff.Changes[0].PropertyName == TEXT("Field_00001");
+	}
+
+	// VerifyBatchDataAssetDiff는 fixture dump root 쌍으로 batchdiff 상태 분류, per-asset section 저장과 이전 section 정리를 검증한다.
+	bool VerifyBatchDataAssetDiff(FString& OutDetail)
+	{
+		// BatchDiffRoot 아래에 baseline 두 개와 current root를 둔다. 이전 실행의 per-asset section이 남으면 정리 검증이 통과한 것처럼 보이므로 비우고 시작한다.
+		const FCommandletSmokeFixtureRoot BatchDiffRoot(TEXT("BatchDataAssetDiff"));
+		const FString& BatchDiffRootPath = BatchDiffRoot.Path;
+		const FString FirstBaselineRootPath = FPaths::Combine(BatchDiffRootPath, TEXT("BaselineA"));
+		const FString SecondBaselineRootPath = FPaths::Combine(BatchDiffRootPath, TEXT("BaselineB"));
+		const FString CurrentRootPath = FPaths::Combine(BatchDiffRootPath, TEXT("Current"));
+
+		// WriteFixtureAsset는 data_asset_values_v1 Damage field 하나를 가진 dump 파일을 쓰고 asset_index 항목 JSON을 반환한다.
+		bool bDumpsWritten = true;
+		auto WriteFixtureAsset = [&bDumpsWritten](const FString& InRootPath, const TCHAR* InAssetName, const TCHAR* InFingerprint, int32 InDamage)
+		{
+			const FString ObjectPath = FString::Printf(TEXT("/Game/Diff/%s.%s"), InAssetName, InAssetName);
+			const FString DumpText = FString::Printf(
+				TEXT("{\"asset\":{\"object_path\":\"%s\"},\"data_asset_values\":{\"schema_version\":\"%s\",\"fields\":[{\"property_name\":\"Damage\",\"display_name\":\"Damage\",\"category\":\"Stats\",\"cpp_type\":\"int32\",\"value_kind\":\"number\",\"value_json\":%d,\"value_text\":\"%d\"}]}}"),
+				*ObjectPath,
+				ADumpDataAsset::GetSchemaVersionText(),
+				InDamage,
+				InDamage);
+			bDumpsWritten &= FFileHelper::SaveStringToFile(DumpText, *FPaths::Combine(InRootPath, InAssetName, TEXT("dump.json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+			return FString::Printf(
+				TEXT("{\"object_path\":\"%s\",\"index_status\":\"ready\",\"available_sections\":[\"data_asset_values\"],\"fingerprint\":\"%s\",\"output_files\":{\"dump\":\"%s/dump.json\"}}"),
+				*ObjectPath,
+				InFingerprint,
+				InAssetName);
+		};
+		auto WriteFixtureIndex = [](const FString& InRootPath, const TArray<FString>& InEntryTexts)
+		{
+			const FString IndexText = FString::Printf(TEXT("{\"schema_version\":\"asset_index_v1\",\"assets\":[%s]}"), *FString::Join(InEntryTexts, TEXT(",")));
+			return FFileHelper::SaveStringToFile(IndexText, *FPaths::Combine(InRootPath, TEXT("asset_index.json")), FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+		};
+
+		// BaselineA와 Current는 DA_Same fingerprint가 같고 DA_Changed 값이 다르며 DA_Added는 current에만 있다. BaselineB는 DA_Changed도 같다.
+		const bool bIndexesWritten = WriteFixtureIndex(FirstBaselineRootPath, {
+				WriteFixtureAsset(FirstBaselineRootPath, TEXT("DA_Same"), TEXT("fp_same"), 5),
+				WriteFixtureAsset(FirstBaselineRootPath, TEXT("DA_Changed"), TEXT("fp_changed_old"), 10) })
+			&& WriteFixtureIndex(SecondBaselineRootPath, {
+				WriteFixtureAsset(SecondBaselineRootPath, TEXT("DA_Same"), TEXT("fp_same"), 5),
+				WriteFixtureAsset(SecondBaselineRootPath, TEXT("DA_Changed"), TEXT("fp_changed_new"), 20) })
+			&& WriteFixtureIndex(CurrentRootPath, {
+				WriteFixtureAsset(CurrentRootPath, TEXT("DA_Same"), TEXT("fp_same"), 5),
+				WriteFixtureAsset(CurrentRootPath, TEXT("DA_Changed"), TEXT("fp_changed_new"), 20),
+				WriteFixtureAsset(CurrentRootPath, TEXT("DA_Added"), TEXT("fp_added"), 1) });
+
+		// DA_Same 폴더에는 이전 실행이 남긴 것처럼 다른 baseline 기준 section을 미리 둔다.
+		const FString SameSectionPath = FPaths::Combine(CurrentRootPath, TEXT("DA_Same"), TEXT("data_asset_diff.json"));
+		const FString ChangedSectionPath = FPaths::Combine(CurrentRootPath, TEXT("DA_Changed"), TEXT("data_asset_diff.json"));
+		const bool bStaleSectionWritten = FFileHelper::SaveStringToFile(TEXT("{\"baseline_root\":\"stale\"}"), *SameSectionPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+		if (!bDumpsWritten || !bIndexesWritten || !bStaleSectionWritten)
+		{
+			OutDetail = TEXT("fixture_write_failed");
+			return false;
+		}
+
+		// RunBatchDiff는 batchdiff 보고서를 읽어 object path별 status와 이전 section 정리 수를 돌려준다.
+		auto RunBatchDiff = [&CurrentRootPath](const FString& InBaselineRootPath, TMap<FString, FString>& OutStatusByPath, int32& OutStaleRemovedCount)
+		{
+			OutStatusByPath.Reset();
+			OutStaleRemovedCount = INDEX_NONE;
+			FString ReportText;
+			FString ErrorCode;
+			FString ErrorDetail;
+			if (!ADumpDataDiff::BuildBatchDataAssetDiffJson(InBaselineRootPath, CurrentRootPath, ReportText, ErrorCode, ErrorDetail))
 			{
-				if (!GraphByName.Contains(Symbol.GraphName) || !Symbol.NodeId.IsEmpty())
-				{
-					OutFailureReason = FString::Printf(TEXT("graph_symbol=%s"), *Symbol.SymbolId);
-					return false;
-				}
+				return false;
 			}
-			else if (Symbol.Kind == TEXT("class_reference"))
+			TSharedPtr<FJsonObject> ReportObject;
+			const TArray<TSharedPtr<FJsonValue>>* AssetValues = nullptr;
+			TSharedRef<TJsonReader<>> ReportReader = TJsonReaderFactory<>::Create(ReportText);
+			if (!FJsonSerializer::Deserialize(ReportReader, ReportObject)
+				|| !ReportObject.IsValid()
+				|| !ReportObject->TryGetArrayField(TEXT("assets"), AssetValues))
 			{
-				if (Symbol.MemberParent.IsEmpty() || ClassPaths.Contains(Symbol.MemberParent))
-				{
-					OutFailureReason = FString::Printf(TEXT("class_symbol=%s"), *Symbol.SymbolId);
-					return false;
-				}
-				ClassPaths.Add(Symbol.MemberParent);
+				return false;
 			}
-			else
+			ReportObject->TryGetNumberField(TEXT("stale_section_removed_count"), OutStaleRemovedCount);
+			for (const TSharedPtr<FJsonValue>& AssetValue : *AssetValues)
 			{
-				const FADumpGraph* const* GraphPtr = GraphByName.Find(Symbol.GraphName);
-				if (!GraphPtr || !*GraphPtr)
-				{
-					OutFailureReason = FString::Printf(TEXT("node_graph=%s"), *Symbol.SymbolId);
-					return false;
-				}
-				const FADumpGraphNode* Node = (*GraphPtr)->Nodes.FindByPredicate([&Symbol](const FADumpGraphNode& Item){ return Item.NodeId == Symbol.NodeId; });
-				if (!Node)
-				{
-					OutFailureReason = FString::Printf(TEXT("node_missing=%s"), *Symbol.SymbolId);
-					return false;
-				}
-				FString ExpectedKind;
-				if (Node->Role.Primary == TEXT("event")) ExpectedKind = TEXT("event");
-				else if (Node->Role.Primary == TEXT("function_call")) ExpectedKind = TEXT("function_call");
-				else if (Node->Role.Primary == TEXT("interface_call")) ExpectedKind = TEXT("interface_call");
-				else if (Node->Role.Primary == TEXT("variable_get")) ExpectedKind = TEXT("variable_read");
-				else if (Node->Role.Primary == TEXT("variable_set")) ExpectedKind = TEXT("variable_write");
-				if (ExpectedKind != Symbol.Kind || Symbol.PrimaryRole != Node->Role.Primary)
+				const TSharedPtr<FJsonObject> AssetObject = AssetValue.IsValid() ? AssetValue->AsObject() : nullptr;
+				if (AssetObject.IsValid())
 				{
-					OutFailureReason = FString::Printf(TEXT("node_kind=%s expected=%s"), *Symbol.Kind, *ExpectedKind);
-					return false;
+					OutStatusByPath.Add(AssetObject->GetStringField(TEXT("object_path")), AssetObject->GetStringField(TEXT("status")));
 				}
 			}
-		}
-
-		for (const FString Kind : { TEXT("graph"), TEXT("event"), TEXT("function_call"), TEXT("interface_call"), TEXT("variable_read"), TEXT("variable_write"), TEXT("class_reference") })
+			return true;
+		};
+		auto GetStatus = [](const TMap<FString, FString>& InStatusByPath, const TCHAR* InAssetName)
 		{
-			if (ResolveBPSearchKindCount(Index, Kind) != ActualKindCounts.FindRef(Kind))
-			{
-				OutFailureReason = FString::Printf(TEXT("kind_count=%s"), *Kind);
-				return false;
-			}
-		}
-		return true;
-	}
+			const FString* Status = InStatusByPath.Find(FString::Printf(TEXT("/Game/Diff/%s.%s"), InAssetName, InAssetName));
+			return Status ? *Status : FString(TEXT("missing"));
+		};
 
-	// MakeBPSearchTestNode는 production search registry용 synthetic graph node를 만든다.
-	FADumpGraphNode MakeBPSearchTestNode(const FString& InId, const FString& InRole, const FString& InMemberName, const FString& InMemberParent)
-	{
-		FADumpGraphNode Node;
-		Node.NodeId = InId;
-		Node.NodeClass = InRole + TEXT("_class");
-		Node.Role.Primary = InRole;
-		Node.MemberName = InMemberName;
-		Node.MemberParent = InMemberParent;
-		return Node;
+		TMap<FString, FString> FirstStatusByPath;
+		int32 FirstStaleRemovedCount = INDEX_NONE;
+		const bool bFirstRun = RunBatchDiff(FirstBaselineRootPath, FirstStatusByPath, FirstStaleRemovedCount);
+		FString ChangedSectionText;
+		FFileHelper::LoadFileToString(ChangedSectionText, *ChangedSectionPath);
+		const bool bChangedSectionWritten = ChangedSectionText.Contains(TEXT("BaselineA"));
+		const bool bSameSectionRemoved = !IFileManager::Get().FileExists(*SameSectionPath);
+
+		// 두 번째 실행은 baseline root만 바꾼다. DA_Changed는 fingerprint가 같아 건너뛰므로 BaselineA 기준 section이 남으면 안 된다.
+		TMap<FString, FString> SecondStatusByPath;
+		int32 SecondStaleRemovedCount = INDEX_NONE;
+		const bool bSecondRun = RunBatchDiff(SecondBaselineRootPath, SecondStatusByPath, SecondStaleRemovedCount);
+		const bool bChangedSectionRemoved = !IFileManager::Get().FileExists(*ChangedSectionPath);
+
+		const FString FirstStatusText = FString::Printf(TEXT("%s,%s,%s"), *GetStatus(FirstStatusByPath, TEXT("DA_Same")), *GetStatus(FirstStatusByPath, TEXT("DA_Changed")), *GetStatus(FirstStatusByPath, TEXT("DA_Added")));
+		const FString SecondStatusText = FString::Printf(TEXT("%s,%s,%s"), *GetStatus(SecondStatusByPath, TEXT("DA_Same")), *GetStatus(SecondStatusByPath, TEXT("DA_Changed")), *GetStatus(SecondStatusByPath, TEXT("DA_Added")));
+		OutDetail = FString::Printf(
+			TEXT("first=%s stale_removed=%d section_written=%s second=%s stale_removed=%d section_cleared=%s"),
+			*FirstStatusText,
+			FirstStaleRemovedCount,
+			bChangedSectionWritten && bSameSectionRemoved ? TEXT("true") : TEXT("false"),
+			*SecondStatusText,
+			SecondStaleRemovedCount,
+			bChangedSectionRemoved ? TEXT("true") : TEXT("false"));
+		return bFirstRun
+			&& bSecondRun
+			&& FirstStatusText == TEXT("unchanged_fingerprint,changed,added_asset")
+			&& SecondStatusText == TEXT("unchanged_fingerprint,unchanged_fingerprint,added_asset")
+			&& FirstStaleRemovedCount == 1
+			&& SecondStaleRemovedCount == 1
+			&& bChangedSectionWritten
+			&& bSameSectionRemoved
+			&& bChangedSectionRemoved;
 	}
 
 	// VerifyBPSearchIndexRegistry는 production builder로 13개 search index 계약을 검증한다.
@@ -6450,13 +9262,13 @@ namespace
 
 		// ResolvedOutputFilePath는 이미 존재하는 최신 dump 파일인지 확인할 최종 출력 경로다.
 		const FString ResolvedOutputFilePath = InDumpRunOpts.ResolveOutputFilePath();
-		return IFileManager::Get().FileExists(*ResolvedOutputFilePath);
+		return ADumpJson::DoesJsonFileExist(ResolvedOutputFilePath);
 	}
 
 	// DidCommandletProduceOutputFile는 공통 서비스 실행 후 최종 output file 존재 여부를 확인한다.
 	bool DidCommandletProduceOutputFile(const FString& InOutputFilePath)
 	{
-		return !InOutputFilePath.IsEmpty() && IFileManager::Get().FileExists(*InOutputFilePath);
+		return !InOutputFilePath.IsEmpty() && ADumpJson::DoesJsonFileExist(InOutputFilePath);
 	}
 
 	// LogCommandletIssues는 실패 반환 전에 구조화된 issue code를 실제 프로세스 로그에 남긴다.
@@ -7412,6 +10224,16 @@ namespace
 				&& MissingDiffIssues.Num() == 1
 				&& MissingDiffIssues[0].Code == TEXT("ADUMP_DIFF_BASE_MISSING");
 			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("data_asset_diff_missing_baseline"), bMissingBaselinePassed, MissingDiffIssues.Num() > 0 ? MissingDiffIssues[0].Code : TEXT("no_issue"));
+
+			// DiffBenchmarkDetail은 10k field hash merge diff의 분류 결과와 소요 시간이다.
+			FString DiffBenchmarkDetail;
+			const bool bDiffBenchmarkPassed = VerifyDataAssetDiffHashMergeBenchmark(DiffBenchmarkDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("data_asset_diff_hash_merge_10k"), bDiffBenchmarkPassed, DiffBenchmarkDetail);
+
+			// BatchDiffDetail은 fixture root 쌍 batchdiff의 상태 분류와 이전 section 정리 요약이다.
+			FString BatchDiffDetail;
+			const bool bBatchDiffPassed = VerifyBatchDataAssetDiff(BatchDiffDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("data_asset_batch_diff"), bBatchDiffPassed, BatchDiffDetail);
 		}
 
 		{
@@ -7576,794 +10398,591 @@ namespace
 				&& ExplicitUnsupportedIssues.Num() == 1
 				&& ExplicitUnsupportedIssues[0].Code == TEXT("ADUMP_INPUT_UNSUPPORTED_ASSET");
 			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("input_summary_explicit_unsupported"), bExplicitUnsupportedPassed, ExplicitUnsupportedIssues.Num() > 0 ? ExplicitUnsupportedIssues[0].Code : TEXT("no_issue"));
-			LogInputSummaryCheck(TEXT("input_summary explicit unsupported check"), bExplicitUnsupportedPassed);
-		}
-
-		// ValidationObject는 validate report에 포함할 섹션 스모크 검사 묶음이다.
-		TSharedRef<FJsonObject> ValidationObject = MakeShared<FJsonObject>();
-		ValidationObject->SetNumberField(TEXT("check_count"), CheckArray.Num());
-		ValidationObject->SetNumberField(TEXT("failure_count"), OutFailureCount);
-		ValidationObject->SetArrayField(TEXT("checks"), CheckArray);
-		return ValidationObject;
-	}
-}
-
-int32 UAssetDumpCommandlet::Main(const FString& OriginalCommandLine)
-{
-		// CommandLine은 기존 parser와 전용 Entity command가 함께 읽는 원본 실행 문자열이다.
-	const FString& CommandLine = OriginalCommandLine;
-
-	// RequestedMode는 기존 parser보다 먼저 분리하는 additive Phase 1 command mode다.
-	FString RequestedMode;
-	FParse::Value(*CommandLine, TEXT("Mode="), RequestedMode);
-	RequestedMode.ToLowerInline();
-
-		if (RequestedMode == TEXT("entityquery"))
-	{
-		// EntityErrorCode와 EntityErrorDetail은 기존 entity_index_v1을 읽는 read-only query 실패를 전달한다.
-		FString EntityErrorCode;
-		FString EntityErrorDetail;
-
-		// EntityQueryJsonText는 entity_query_result_v1 success output이다.
-		FString EntityQueryJsonText;
-		if (!ADumpEntityQuery::BuildEntityQueryJson(CommandLine, EntityQueryJsonText, EntityErrorCode, EntityErrorDetail))
-		{
-			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *EntityErrorCode, *EntityErrorDetail);
-			return 1;
-		}
-
-		// EntityOutputPath는 선택적인 atomic output 경로다. 생략하면 JSON을 로그에 출력한다.
-		FString EntityOutputPath;
-		FParse::Value(*CommandLine, TEXT("Output="), EntityOutputPath);
-		if (!EntityOutputPath.IsEmpty())
-		{
-			FString SaveError;
-			if (!ADumpJson::SaveJsonTextToFile(EntityOutputPath, EntityQueryJsonText, SaveError))
-			{
-				UE_LOG(LogTemp, Error, TEXT("JSON_SAVE_FAIL: %s"), *SaveError);
-				return 1;
-			}
-		}
-		else
-		{
-			UE_LOG(LogTemp, Display, TEXT("%s"), *EntityQueryJsonText);
-		}
-		return 0;
-	}
-
-	if (RequestedMode == TEXT("entitycontext"))
-	{
-		// EntityContextJsonText는 native Entity/Relation object를 data field에 그대로 유지하는 bounded context output이다.
-		FString EntityContextJsonText;
-		FString EntityErrorCode;
-		FString EntityErrorDetail;
-		if (!ADumpEntityQuery::BuildEntityContextJson(CommandLine, EntityContextJsonText, EntityErrorCode, EntityErrorDetail))
-		{
-			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *EntityErrorCode, *EntityErrorDetail);
-			return 1;
-		}
-
-		// EntityOutputPath는 entity_context_bundle_v1의 필수 atomic output 경로다.
-		FString EntityOutputPath;
-		FParse::Value(*CommandLine, TEXT("Output="), EntityOutputPath);
-		FString SaveError;
-		if (!ADumpJson::SaveJsonTextToFile(EntityOutputPath, EntityContextJsonText, SaveError))
-		{
-			UE_LOG(LogTemp, Error, TEXT("JSON_SAVE_FAIL: %s"), *SaveError);
-			return 1;
-		}
-		return 0;
-	}
-				// ModeValue는 list / asset / asset_details / map / bpgraph / bpdump / batchdump / index / sectiondump / dependencyquery / query / validate / makefixtures 중 실행 모드를 고른다.
-	FString ModeValue;
-	// OutputFilePath는 저장할 JSON 파일 경로다.
-	FString OutputFilePath;
-	// FilterPath는 list 모드에서 사용할 검색 경로다. 예: /Game/Prototype
-	FString FilterPath;
-	// AssetPath는 asset / asset_details / bpgraph / bpdump 모드에서 사용할 에셋 경로다.
-	FString AssetPath;
-	// MapAssetPath는 map 모드에서 사용할 맵 경로다.
-	FString MapAssetPath;
-
-	if (!GetCmdValue(CommandLine, TEXT("Mode="), ModeValue))
-	{
-								UE_LOG(LogTemp, Error, TEXT("Missing -Mode=. Use -Mode=list|asset|asset_details|bpgraph|bpdump|batchdump|map|index|sectiondump|dependencyquery|query|contextbundle|entityquery|entitycontext|validate|makefixtures"));
-		return 1;
-	}
-
-	// SectionSelection은 Sections > Intent > Profile 우선순위가 적용된 최종 주요 JSON 섹션 선택값이다.
-	FADumpSectionSelection SectionSelection;
-
-	// SectionSelectionError는 알 수 없거나 비어 있는 섹션/Intent 이름의 명확한 실패 메시지다.
-	FString SectionSelectionError;
-
-	// IntentName은 -Intent=에서 받은 정규화된 분석 목적 이름이다.
-	FString IntentName;
-
-	// IntentSectionSelection은 Intent 매핑에서 파생된 정식 섹션 선택값이다.
-	FADumpSectionSelection IntentSectionSelection;
-
-	// ProfileName은 -Profile=에서 받은 정규화된 출력 프리셋 이름이다.
-	FString ProfileName;
-
-	// ProfileSectionSelection은 Profile 매핑에서 파생된 정식 섹션 선택값이다.
-	FADumpSectionSelection ProfileSectionSelection;
-
-	// SectionSource는 최종 섹션 선택 출처(full, profile, intent, sections)다.
-	FString SectionSource = TEXT("full");
-
-	// bUsesSectionSerialization은 주요 dump.json 직렬화를 사용하는 commandlet 모드인지 나타낸다.
-		const bool bUsesSectionSerialization = ModeValue.Equals(TEXT("bpdump"), ESearchCase::IgnoreCase)
-		|| ModeValue.Equals(TEXT("batchdump"), ESearchCase::IgnoreCase)
-		|| ModeValue.Equals(TEXT("sectiondump"), ESearchCase::IgnoreCase);
-	if (bUsesSectionSerialization
-		&& (!TryParseSectionSelection(CommandLine, SectionSelection, SectionSelectionError)
-			|| !TryParseIntentSelection(CommandLine, IntentName, IntentSectionSelection, SectionSelectionError)
-			|| !TryParseProfileSelection(CommandLine, ProfileName, ProfileSectionSelection, SectionSelectionError)))
-	{
-		UE_LOG(LogTemp, Error, TEXT("%s"), *SectionSelectionError);
-		return 1;
-	}
-	if (bUsesSectionSerialization)
-	{
-		// ExplicitSectionSelection은 우선순위 계산 전에 보존한 -Sections= 직접 선택값이다.
-		FADumpSectionSelection ExplicitSectionSelection = SectionSelection;
-		ResolveEffectiveSelection(ExplicitSectionSelection, IntentName, IntentSectionSelection, ProfileName, ProfileSectionSelection, SectionSelection, SectionSource);
-	}
-
-	if (ModeValue.Equals(TEXT("index"), ESearchCase::IgnoreCase))
-	{
-		// DumpRootPath는 index 생성 대상 BPDump 루트 폴더다.
-		FString DumpRootPath;
-		if (!GetCmdValue(CommandLine, TEXT("DumpRoot="), DumpRootPath))
-		{
-			DumpRootPath = FPaths::Combine(ADumpJson::ResolveWritableDefaultDumpRootDirectory(), TEXT("BPDump"));
-		}
-
-		// IndexFilePath는 저장할 index.json 최종 경로다.
-		FString IndexFilePath;
-
-				// DependencyIndexFilePath는 저장할 dependency_index.json 최종 경로다.
-		FString DependencyIndexFilePath;
-
-				// AssetIndexFilePath는 저장할 additive asset_index.json 최종 경로다.
-		FString AssetIndexFilePath;
-
-		// SectionIndexFilePath는 저장할 additive section_index.json 최종 경로다.
-		FString SectionIndexFilePath;
-		if (!BuildDumpIndexFiles(DumpRootPath, IndexFilePath, DependencyIndexFilePath, AssetIndexFilePath, SectionIndexFilePath))
-		{
-			UE_LOG(LogTemp, Error, TEXT("Failed to build dump index files under: %s"), *DumpRootPath);
-			return 2;
-		}
-
-						int32 AssetIndexAssetCount = 0;
-		FString AssetIndexContractDetail;
-				if (!ValidateCommandletAssetIndexContract(AssetIndexFilePath, AssetIndexAssetCount, AssetIndexContractDetail))
-		{
-			UE_LOG(LogTemp, Error, TEXT("Generated asset index contract failed: %s"), *AssetIndexContractDetail);
-			return 2;
-		}
-
-		int32 SectionIndexSectionCount = 0;
-		int32 SectionIndexSymbolCount = 0;
-		FString SectionIndexContractDetail;
-		if (!ValidateCommandletSectionIndexContract(
-			SectionIndexFilePath,
-			AssetIndexFilePath,
-			DumpRootPath,
-			SectionIndexSectionCount,
-			SectionIndexSymbolCount,
-			SectionIndexContractDetail))
-		{
-			UE_LOG(LogTemp, Error, TEXT("Generated section index contract failed: %s"), *SectionIndexContractDetail);
-			return 2;
-		}
-
-		UE_LOG(LogTemp, Display, TEXT("Saved dump index JSON: %s"), *IndexFilePath);
-		UE_LOG(LogTemp, Display, TEXT("Saved dump dependency index JSON: %s"), *DependencyIndexFilePath);
-				UE_LOG(LogTemp, Display, TEXT("Saved dump asset index JSON: %s (%s)"), *AssetIndexFilePath, *AssetIndexContractDetail);
-		UE_LOG(LogTemp, Display, TEXT("Saved dump section index JSON: %s (%s)"), *SectionIndexFilePath, *SectionIndexContractDetail);
-		return 0;
-	}
-
-	// bRequireExplicitOutputPath는 레거시 JSON 변환 모드에서 명시 출력 경로를 요구하는지 여부다.
-	const bool bRequireExplicitOutputPath = !ModeValue.Equals(TEXT("bpdump"), ESearchCase::IgnoreCase)
-		&& !ModeValue.Equals(TEXT("batchdump"), ESearchCase::IgnoreCase)
-		&& !ModeValue.Equals(TEXT("validate"), ESearchCase::IgnoreCase)
-		&& !ModeValue.Equals(TEXT("makefixtures"), ESearchCase::IgnoreCase);
-		if (bRequireExplicitOutputPath && !GetCmdValue(CommandLine, TEXT("Output="), OutputFilePath))
-	{
-				if (ModeValue.Equals(TEXT("sectiondump"), ESearchCase::IgnoreCase))
-		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_LAZY_DUMP_OUTPUT_REQUIRED: -Mode=sectiondump requires explicit -Output=."));
-		}
-				else if (ModeValue.Equals(TEXT("dependencyquery"), ESearchCase::IgnoreCase))
-		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_OUTPUT_REQUIRED: -Mode=dependencyquery requires explicit -Output=."));
-		}
-				else if (ModeValue.Equals(TEXT("query"), ESearchCase::IgnoreCase))
-		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_OUTPUT_REQUIRED: -Mode=query requires explicit -Output=."));
-		}
-		else if (ModeValue.Equals(TEXT("contextbundle"), ESearchCase::IgnoreCase))
-		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_OUTPUT_REQUIRED: -Mode=contextbundle requires explicit -Output=."));
-		}
-		else
-		{
-			UE_LOG(LogTemp, Error, TEXT("Missing -Output=. Example: -Output=C:/Temp/out.json"));
-		}
-		return 1;
-	}
-
-	if (!bRequireExplicitOutputPath)
-	{
-		GetCmdValue(CommandLine, TEXT("Output="), OutputFilePath);
-	}
-
-	// JsonText는 최종 저장할 JSON 문자열이다.
-	FString JsonText;
-
-	if (ModeValue.Equals(TEXT("makefixtures"), ESearchCase::IgnoreCase))
-	{
-		if (OutputFilePath.IsEmpty())
-		{
-			OutputFilePath = FPaths::Combine(
-				ADumpJson::ResolveWritableDefaultDumpRootDirectory(),
-				TEXT("BPDumpValidationPlugin"),
-				TEXT("fixture_report.json"));
+			LogInputSummaryCheck(TEXT("input_summary explicit unsupported check"), bExplicitUnsupportedPassed);
 		}
 
-		// FixtureFailureCount는 생성/보정 실패 fixture 개수다.
-		int32 FixtureFailureCount = 0;
-		if (!BuildValidationFixtureJson(CommandLine, JsonText, FixtureFailureCount))
 		{
-			return 2;
+			// ImpactBenchmarkDetail은 100k node impact graph의 SCC/closure 결과와 소요 시간이다.
+			FString ImpactBenchmarkDetail;
+			const bool bImpactBenchmarkPassed = VerifyImpactGraphBenchmark(ImpactBenchmarkDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("impact_graph_scc_100k"), bImpactBenchmarkPassed, ImpactBenchmarkDetail);
 		}
 
-		if (!SaveJsonToFile(OutputFilePath, JsonText))
 		{
-			return 3;
+			// ContextBundleBenchmarkDetail은 256 item bundle MaxBytes 절단의 기준 loop 일치 여부와 소요 시간이다.
+			FString ContextBundleBenchmarkDetail;
+			const bool bContextBundleBenchmarkPassed = VerifyAIContextBundleByteFitBenchmark(ContextBundleBenchmarkDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("context_bundle_byte_fit_256"), bContextBundleBenchmarkPassed, ContextBundleBenchmarkDetail);
 		}
 
-		UE_LOG(LogTemp, Display, TEXT("Saved fixture report JSON: %s"), *OutputFilePath);
-		return FixtureFailureCount > 0 ? 2 : 0;
-	}
-	else if (ModeValue.Equals(TEXT("validate"), ESearchCase::IgnoreCase))
-	{
-		// ValidationRootPath는 validate 산출물 루트 폴더다.
-		FString ValidationRootPath;
-		if (!GetCmdValue(CommandLine, TEXT("ValidationRoot="), ValidationRootPath))
 		{
-			ValidationRootPath = FPaths::Combine(ADumpJson::ResolveWritableDefaultDumpRootDirectory(), TEXT("BPDumpValidation"));
+			// OutputCompressionBenchmarkDetail은 codec/압축 강도별 디스크 크기, write/read 시간과 원문 일치 여부다.
+			FString OutputCompressionBenchmarkDetail;
+			const bool bOutputCompressionBenchmarkPassed = VerifyOutputCompressionBenchmark(OutputCompressionBenchmarkDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("output_compression_codecs"), bOutputCompressionBenchmarkPassed, OutputCompressionBenchmarkDetail);
 		}
 
-		if (OutputFilePath.IsEmpty())
 		{
-			OutputFilePath = FPaths::Combine(ValidationRootPath, TEXT("validation_report.json"));
+			// DumpPackDetail은 pack append/commit/복구/열거/export 왕복 결과와 소요 시간이다.
+			FString DumpPackDetail;
+			const bool bDumpPackPassed = VerifyDumpPackRoundTrip(DumpPackDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("dump_pack_roundtrip"), bDumpPackPassed, DumpPackDetail);
 		}
 
-		// ValidationFailureCount는 필수 검증 실패 케이스 개수다.
-		int32 ValidationFailureCount = 0;
-		if (!BuildValidationJson(CommandLine, JsonText, ValidationFailureCount))
 		{
-			return 2;
+			// ContentStoreDedupDetail은 blob 공유, 복원 읽기, GC 회수와 dedup ratio 결과다.
+			FString ContentStoreDedupDetail;
+			const bool bContentStoreDedupPassed = VerifyContentStoreDedup(ContentStoreDedupDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("content_store_dedup"), bContentStoreDedupPassed, ContentStoreDedupDetail);
 		}
 
-		if (!SaveJsonToFile(OutputFilePath, JsonText))
 		{
-			return 3;
+			// IncrementalIndexDetail은 반복 index build의 manifest entry 재사용/재파싱 수와 relation 변화다.
+			FString IncrementalIndexDetail;
+			const bool bIncrementalIndexPassed = VerifyIncrementalIndexReuse(IncrementalIndexDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("incremental_index_reuse"), bIncrementalIndexPassed, IncrementalIndexDetail);
 		}
 
-		UE_LOG(LogTemp, Display, TEXT("Saved validation report JSON: %s"), *OutputFilePath);
-		return ValidationFailureCount > 0 ? 2 : 0;
-	}
-					else if (ModeValue.Equals(TEXT("contextbundle"), ESearchCase::IgnoreCase))
-	{
-		FString InputFilePath;
-		if (!GetCmdValue(CommandLine, TEXT("Input="), InputFilePath)
-			|| InputFilePath.TrimStartAndEnd().IsEmpty())
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_INPUT_REQUIRED: -Mode=contextbundle requires explicit -Input=."));
-			return 1;
+			// WatchQueueDetail은 watch queue batch 순서, lag 값과 caught_up 판정 요약이다.
+			FString WatchQueueDetail;
+			const bool bWatchQueuePassed = VerifyWatchQueueStatus(WatchQueueDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("watch_queue_status"), bWatchQueuePassed, WatchQueueDetail);
 		}
-		InputFilePath = InputFilePath.TrimStartAndEnd();
 
-		const TCHAR* UnsupportedOptionTokenArray[] = {
-			TEXT("DumpRoot="), TEXT("Asset="), TEXT("AssetId="), TEXT("QueryKind="), TEXT("ResultSchema="),
-			TEXT("Sections="), TEXT("Direction="), TEXT("Strength="), TEXT("MaxDepth="), TEXT("MaxNodes="),
-			TEXT("MaxEdges="), TEXT("Intent="), TEXT("Profile=")
-		};
-		for (const TCHAR* UnsupportedOptionToken : UnsupportedOptionTokenArray)
 		{
-			if (CommandLine.Contains(UnsupportedOptionToken, ESearchCase::IgnoreCase))
-			{
-				UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_OPTION_UNSUPPORTED: contextbundle does not accept query or dump-generation options."));
-				return 1;
-			}
+			// WatchPackDeletionDetail은 pack 전용 dump 삭제 후 commit TOC에 남은 항목과 형제 폴더 보존 요약이다.
+			FString WatchPackDeletionDetail;
+			const bool bWatchPackDeletionPassed = VerifyWatchPackDeletion(WatchPackDeletionDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("watch_pack_deletion"), bWatchPackDeletionPassed, WatchPackDeletionDetail);
 		}
 
-		auto TryParseBoundedInteger = [](const FString& InText, int32 InMinimum, int32 InMaximum, int32& OutValue)
 		{
-			if (InText.IsEmpty()) return false;
-			for (int32 CharacterIndex = 0; CharacterIndex < InText.Len(); ++CharacterIndex)
-			{
-				if (!FChar::IsDigit(InText[CharacterIndex])) return false;
-			}
-			OutValue = FCString::Atoi(*InText);
-			return OutValue >= InMinimum && OutValue <= InMaximum;
-		};
+			// RegistryScanCacheDetail은 상태 cache 저장/재사용, stamp 비교와 중복 scan 생략 요약이다.
+			FString RegistryScanCacheDetail;
+			const bool bRegistryScanCachePassed = VerifyRegistryScanCache(RegistryScanCacheDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("registry_scan_cache"), bRegistryScanCachePassed, RegistryScanCacheDetail);
+		}
 
-		int32 MaxItems = 64;
-		FString MaxItemsText;
-		if (CommandLine.Contains(TEXT("MaxItems="), ESearchCase::IgnoreCase))
 		{
-			GetCmdValue(CommandLine, TEXT("MaxItems="), MaxItemsText);
-			if (!TryParseBoundedInteger(MaxItemsText.TrimStartAndEnd(), 1, 256, MaxItems))
-			{
-				UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_MAX_ITEMS_INVALID: MaxItems must be an integer from 1 through 256."));
-				return 1;
-			}
+			// ReadQueryModuleDetail은 query module section registry/파싱 일치와 read-only mode 판정 요약이다.
+			FString ReadQueryModuleDetail;
+			const bool bReadQueryModulePassed = VerifyReadQueryModule(ReadQueryModuleDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("read_query_module"), bReadQueryModulePassed, ReadQueryModuleDetail);
 		}
 
-		int32 MaxBytes = 262144;
-		FString MaxBytesText;
-		if (CommandLine.Contains(TEXT("MaxBytes="), ESearchCase::IgnoreCase))
 		{
-			GetCmdValue(CommandLine, TEXT("MaxBytes="), MaxBytesText);
-			if (!TryParseBoundedInteger(MaxBytesText.TrimStartAndEnd(), 4096, 1048576, MaxBytes))
-			{
-				UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_MAX_BYTES_INVALID: MaxBytes must be an integer from 4096 through 1048576."));
-				return 1;
-			}
+			// SectionDumpArgumentOrderDetail은 위임된 sectiondump 인자 오류 순서 case 수와 불일치 요약이다.
+			FString SectionDumpArgumentOrderDetail;
+			const bool bSectionDumpArgumentOrderPassed = VerifySectionDumpArgumentOrder(SectionDumpArgumentOrderDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("section_dump_argument_order"), bSectionDumpArgumentOrderPassed, SectionDumpArgumentOrderDetail);
 		}
 
-		InputFilePath = FPaths::ConvertRelativePathToFull(InputFilePath);
-		OutputFilePath = FPaths::ConvertRelativePathToFull(OutputFilePath);
-		FPaths::NormalizeFilename(InputFilePath);
-		FPaths::NormalizeFilename(OutputFilePath);
-		FPaths::CollapseRelativeDirectories(InputFilePath);
-		FPaths::CollapseRelativeDirectories(OutputFilePath);
-		if (InputFilePath.Equals(OutputFilePath, ESearchCase::IgnoreCase))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_INPUT_OUTPUT_CONFLICT: Input and Output must resolve to different files."));
-			return 1;
+			// InputBindingIndexDetail은 fixture input index의 key/action 질의와 충돌 종류 요약이다.
+			FString InputBindingIndexDetail;
+			const bool bInputBindingIndexPassed = VerifyInputBindingIndex(InputBindingIndexDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("input_binding_index"), bInputBindingIndexPassed, InputBindingIndexDetail);
 		}
 
-		const int64 InputFileSize = IFileManager::Get().FileSize(*InputFilePath);
-		if (InputFileSize < 0)
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_INPUT_NOT_FOUND: Input file does not exist: %s"), *InputFilePath);
-			return 2;
+			// SymbolSearchIndexDetail은 fixture symbol index의 token/trigram/exact/kind 조회 결과 수 요약이다.
+			FString SymbolSearchIndexDetail;
+			const bool bSymbolSearchIndexPassed = VerifySymbolSearchIndex(SymbolSearchIndexDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("symbol_search_index"), bSymbolSearchIndexPassed, SymbolSearchIndexDetail);
 		}
-		if (InputFileSize > 16ll * 1024ll * 1024ll)
+
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_INPUT_TOO_LARGE: Input file exceeds 16 MiB: %s"), *InputFilePath);
-			return 2;
+			// BatchChangeClosureDetail은 fixture graph의 자산별 redump_reason과 추적/변경 package 수 요약이다.
+			FString BatchChangeClosureDetail;
+			const bool bBatchChangeClosurePassed = VerifyBatchChangeClosure(BatchChangeClosureDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("batch_change_closure"), bBatchChangeClosurePassed, BatchChangeClosureDetail);
 		}
 
-		TSharedPtr<FJsonObject> InputRootObject;
-		if (!LoadCommandletJsonObjectFromFile(InputFilePath, InputRootObject))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_INPUT_JSON_INVALID: Input is not a readable JSON object: %s"), *InputFilePath);
-			return 2;
+			// BatchFileStateRefreshDetail은 전체 실행 cache 뒤 ChangedOnly 실행의 옵션별 redump_reason 요약이다.
+			FString BatchFileStateRefreshDetail;
+			const bool bBatchFileStateRefreshPassed = VerifyBatchFileStateRefresh(BatchFileStateRefreshDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("batch_file_state_refresh"), bBatchFileStateRefreshPassed, BatchFileStateRefreshDetail);
 		}
 
-		FString ContextErrorCode;
-		FString ContextErrorDetail;
-		if (!BuildCommandletAIContextBundleJson(
-			InputRootObject,
-			MaxItems,
-			MaxBytes,
-			JsonText,
-			ContextErrorCode,
-			ContextErrorDetail))
 		{
-			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *ContextErrorCode, *ContextErrorDetail);
-			return 2;
+			// FusedContextBundleDetail은 fixture query의 fused bundle과 두 단계 bundle 일치 case 수 요약이다.
+			FString FusedContextBundleDetail;
+			const bool bFusedContextBundlePassed = VerifyFusedContextBundle(FusedContextBundleDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("fused_context_bundle"), bFusedContextBundlePassed, FusedContextBundleDetail);
 		}
 
-		FString SaveErrorMessage;
-		if (!ADumpJson::SaveJsonTextToFile(OutputFilePath, JsonText, SaveErrorMessage))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_OUTPUT_WRITE_FAILED: %s"), *SaveErrorMessage);
-			return 3;
+			// SelectorSectionSourcesDetail은 fixture section_sources span 사용/거부 여부와 수정 전후 sectiondump 값 요약이다.
+			FString SelectorSectionSourcesDetail;
+			const bool bSelectorSectionSourcesPassed = VerifySelectorSectionSources(SelectorSectionSourcesDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("selector_section_sources"), bSelectorSectionSourcesPassed, SelectorSectionSourcesDetail);
 		}
 
-		UE_LOG(LogTemp, Display, TEXT("Saved AI context bundle JSON: %s"), *OutputFilePath);
-		return 0;
-	}
-	else if (ModeValue.Equals(TEXT("query"), ESearchCase::IgnoreCase))
-	{
-		FString QueryKindText;
-		if (!GetCmdValue(CommandLine, TEXT("QueryKind="), QueryKindText)
-			|| QueryKindText.TrimStartAndEnd().IsEmpty())
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_KIND_REQUIRED: -Mode=query requires -QueryKind=section|dependency."));
-			return 1;
+			// EntityIndexParallelDetail은 entity_index_v1 병렬/단일 thread build 비교 결과 요약이다.
+			FString EntityIndexParallelDetail;
+			const bool bEntityIndexParallelPassed = VerifyEntityIndexParallelMatch(EntityIndexParallelDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("entity_index_parallel"), bEntityIndexParallelPassed, EntityIndexParallelDetail);
 		}
-		QueryKindText = QueryKindText.TrimStartAndEnd().ToLower();
-		if (QueryKindText != TEXT("section") && QueryKindText != TEXT("dependency"))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_KIND_INVALID: QueryKind must be section or dependency."));
-			return 1;
+			// EntityKindTablePagingDetail은 kind table list page와 선형 scan page 비교 결과 요약이다.
+			FString EntityKindTablePagingDetail;
+			const bool bEntityKindTablePagingPassed = VerifyEntityKindTablePaging(EntityKindTablePagingDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("entity_kind_table_paging"), bEntityKindTablePagingPassed, EntityKindTablePagingDetail);
 		}
-
-						FString ResultSchemaText = TEXT("native");
-		FString ExplicitResultSchemaText;
-		const bool bHasResultSchemaOption = CommandLine.Contains(TEXT("ResultSchema="), ESearchCase::IgnoreCase);
-		if (bHasResultSchemaOption)
 		{
-			GetCmdValue(CommandLine, TEXT("ResultSchema="), ExplicitResultSchemaText);
-			ResultSchemaText = ExplicitResultSchemaText.TrimStartAndEnd().ToLower();
-			if (ResultSchemaText != TEXT("native") && ResultSchemaText != TEXT("query_result_v1"))
-			{
-				UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_RESULT_SCHEMA_INVALID: ResultSchema must be native or query_result_v1."));
-				return 1;
-			}
+			// EntityAdjacencyExpandDetail은 CSR expand page와 relation 선형 walk page 비교 결과 요약이다.
+			FString EntityAdjacencyExpandDetail;
+			const bool bEntityAdjacencyExpandPassed = VerifyEntityAdjacencyExpand(EntityAdjacencyExpandDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("entity_adjacency_expand"), bEntityAdjacencyExpandPassed, EntityAdjacencyExpandDetail);
 		}
-
-		FString UnsupportedOptionValue;
-		if (GetCmdValue(CommandLine, TEXT("Intent="), UnsupportedOptionValue)
-			|| GetCmdValue(CommandLine, TEXT("Profile="), UnsupportedOptionValue))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_OPTION_UNSUPPORTED: query mode does not accept Intent or Profile."));
-			return 1;
+			// BackgroundSaveStateMachineDetail은 tick 단계 실행, background 저장과 저장 중/추출 중 취소 결과 요약이다.
+			FString BackgroundSaveStateMachineDetail;
+			const bool bBackgroundSaveStateMachinePassed = VerifyBackgroundSaveStateMachine(BackgroundSaveStateMachineDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("background_save_state_machine"), bBackgroundSaveStateMachinePassed, BackgroundSaveStateMachineDetail);
 		}
-
-		FString AssetIdSelector;
-		const bool bHasAssetSelector = GetCmdValue(CommandLine, TEXT("Asset="), AssetPath) && !AssetPath.IsEmpty();
-		const bool bHasAssetIdSelector = GetCmdValue(CommandLine, TEXT("AssetId="), AssetIdSelector) && !AssetIdSelector.IsEmpty();
-		if (!bHasAssetSelector && !bHasAssetIdSelector)
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_SELECTOR_REQUIRED: Provide exactly one of -Asset= or -AssetId=."));
-			return 1;
+			// ExecLogRingSequenceDetail은 실행 로그 ring의 delta, wraparound와 세션 Reset 경계 조회 결과 요약이다.
+			FString ExecLogRingSequenceDetail;
+			const bool bExecLogRingSequencePassed = VerifyExecLogRingSequence(ExecLogRingSequenceDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("exec_log_ring_sequence"), bExecLogRingSequencePassed, ExecLogRingSequenceDetail);
 		}
-		if (bHasAssetSelector && bHasAssetIdSelector)
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_SELECTOR_CONFLICT: -Asset= and -AssetId= cannot be used together."));
-			return 1;
+			// ExecQueueOutcomesDetail은 queue의 skip/실패/저장 중 취소 집계와 진행률/ETA 결과 요약이다.
+			FString ExecQueueOutcomesDetail;
+			const bool bExecQueueOutcomesPassed = VerifyExecQueueOutcomes(ExecQueueOutcomesDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("exec_queue_outcomes"), bExecQueueOutcomesPassed, ExecQueueOutcomesDetail);
 		}
-
-		FString DumpRootPath;
-		if (!GetCmdValue(CommandLine, TEXT("DumpRoot="), DumpRootPath))
 		{
-			DumpRootPath = FPaths::Combine(ADumpJson::BuildDefaultDumpRootDirectory(), TEXT("BPDump"));
+			// SSOTStageMetaDetail은 SSOT stage 이름/실행 위치, 의존 순서와 -notime 시간 필드 생략 결과 요약이다.
+			FString SSOTStageMetaDetail;
+			const bool bSSOTStageMetaPassed = VerifySSOTStageMeta(SSOTStageMetaDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("ssot_stage_meta"), bSSOTStageMetaPassed, SSOTStageMetaDetail);
 		}
-
-		if (QueryKindText == TEXT("section"))
 		{
-			if (GetCmdValue(CommandLine, TEXT("Direction="), UnsupportedOptionValue)
-				|| GetCmdValue(CommandLine, TEXT("Strength="), UnsupportedOptionValue)
-				|| GetCmdValue(CommandLine, TEXT("MaxDepth="), UnsupportedOptionValue)
-				|| GetCmdValue(CommandLine, TEXT("MaxNodes="), UnsupportedOptionValue)
-				|| GetCmdValue(CommandLine, TEXT("MaxEdges="), UnsupportedOptionValue))
-			{
-				UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_OPTION_UNSUPPORTED: QueryKind=section does not accept dependency traversal options."));
-				return 1;
-			}
+			// SSOTAssetDeltaDetail은 fixture state 기준 SSOT 증분 자산 목록 added/modified/removed와 row 재사용 결과 요약이다.
+			FString SSOTAssetDeltaDetail;
+			const bool bSSOTAssetDeltaPassed = VerifySSOTAssetDelta(SSOTAssetDeltaDetail);
+			AddSectionSmokeCheck(CheckArray, OutFailureCount, TEXT("ssot_asset_delta"), bSSOTAssetDeltaPassed, SSOTAssetDeltaDetail);
+		}
+		// ValidationObject는 validate report에 포함할 섹션 스모크 검사 묶음이다.
+		TSharedRef<FJsonObject> ValidationObject = MakeShared<FJsonObject>();
+		ValidationObject->SetNumberField(TEXT("check_count"), CheckArray.Num());
+		ValidationObject->SetNumberField(TEXT("failure_count"), OutFailureCount);
+		ValidationObject->SetArrayField(TEXT("checks"), CheckArray);
+		return ValidationObject;
+	}
+}
 
-			FString ExplicitSectionListText;
-			if (!GetCmdValue(CommandLine, TEXT("Sections="), ExplicitSectionListText)
-				|| ExplicitSectionListText.TrimStartAndEnd().IsEmpty())
-			{
-				UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_SECTIONS_REQUIRED: QueryKind=section requires explicit -Sections=."));
-				return 1;
-			}
+int32 UAssetDumpCommandlet::Main(const FString& OriginalCommandLine)
+{
+		// CommandLine은 기존 parser와 전용 Entity command가 함께 읽는 원본 실행 문자열이다.
+	const FString& CommandLine = OriginalCommandLine;
 
-			FADumpSectionSelection QuerySectionSelection;
-			FString QuerySectionError;
-			if (!TryParseSectionSelection(CommandLine, QuerySectionSelection, QuerySectionError)
-				|| QuerySectionSelection.IsFullMode())
-			{
-				UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_OPTION_UNSUPPORTED: %s"), *QuerySectionError);
-				return 1;
-			}
+	// RequestedMode는 기존 parser보다 먼저 분리하는 additive Phase 1 command mode다.
+	FString RequestedMode;
+	FParse::Value(*CommandLine, TEXT("Mode="), RequestedMode);
+	RequestedMode.ToLowerInline();
 
-			FString LazyDumpErrorCode;
-			FString LazyDumpErrorDetail;
-			if (!BuildCommandletLazySectionDumpJson(
-				DumpRootPath,
-				bHasAssetSelector ? AssetPath : FString(),
-				bHasAssetIdSelector ? AssetIdSelector : FString(),
-				QuerySectionSelection,
-				JsonText,
-				LazyDumpErrorCode,
-				LazyDumpErrorDetail))
-			{
-				UE_LOG(LogTemp, Error, TEXT("%s: %s"), *LazyDumpErrorCode, *LazyDumpErrorDetail);
-				return 2;
-			}
-		}
-		else
+	// read-only query mode는 에디터 없이도 빌드되는 AssetDumpQuery module이 실행한다.
+	if (ADumpReadQuery::IsReadQueryMode(RequestedMode))
+	{
+		// sectiondump의 Intent/Profile 이름은 commandlet registry로만 검증할 수 있으므로 위임 전에 기존 순서로 인자를 검사한다.
+		FString SectionDumpArgumentError;
+		if (RequestedMode == TEXT("sectiondump") && !ValidateDelegatedSectionDumpArguments(CommandLine, SectionDumpArgumentError))
 		{
-			if (GetCmdValue(CommandLine, TEXT("Sections="), UnsupportedOptionValue))
-			{
-				UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_OPTION_UNSUPPORTED: QueryKind=dependency does not accept Sections."));
-				return 1;
-			}
-
-			FString DirectionText = TEXT("dependencies");
-			GetCmdValue(CommandLine, TEXT("Direction="), DirectionText);
-			DirectionText = DirectionText.TrimStartAndEnd().ToLower();
-			if (DirectionText != TEXT("dependencies")
-				&& DirectionText != TEXT("referencers")
-				&& DirectionText != TEXT("both"))
-			{
-				UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_DIRECTION_INVALID: Direction must be dependencies, referencers or both."));
-				return 1;
-			}
+			UE_LOG(LogTemp, Error, TEXT("%s"), *SectionDumpArgumentError);
+			return 1;
+		}
+		return ADumpReadQuery::RunReadQueryMode(RequestedMode, CommandLine);
+	}
 
-			FString StrengthText = TEXT("all");
-			GetCmdValue(CommandLine, TEXT("Strength="), StrengthText);
-			StrengthText = StrengthText.TrimStartAndEnd().ToLower();
-			if (StrengthText != TEXT("all") && StrengthText != TEXT("hard") && StrengthText != TEXT("soft"))
-			{
-				UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_STRENGTH_INVALID: Strength must be all, hard or soft."));
-				return 1;
-			}
+	if (RequestedMode == TEXT("search"))
+	{
+		// SearchErrorCode와 SearchErrorDetail은 symbol_search_index_v1을 읽는 read-only search 실패를 전달한다.
+		FString SearchErrorCode;
+		FString SearchErrorDetail;
 
-			auto TryParseBoundedInteger = [](const FString& InText, int32 InMinimum, int32 InMaximum, int32& OutValue)
-			{
-				if (InText.IsEmpty()) return false;
-				for (int32 CharacterIndex = 0; CharacterIndex < InText.Len(); ++CharacterIndex)
-				{
-					if (!FChar::IsDigit(InText[CharacterIndex])) return false;
-				}
-				OutValue = FCString::Atoi(*InText);
-				return OutValue >= InMinimum && OutValue <= InMaximum;
-			};
+		// SearchJsonText는 symbol_search_result_v1 success output이다.
+		FString SearchJsonText;
+		if (!ADumpSymbolSearch::BuildSymbolSearchJson(CommandLine, SearchJsonText, SearchErrorCode, SearchErrorDetail))
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *SearchErrorCode, *SearchErrorDetail);
+			return 1;
+		}
 
-			int32 MaxDepth = 1;
-			int32 MaxNodes = 64;
-			int32 MaxEdges = 128;
-			FString BoundText;
-			if (GetCmdValue(CommandLine, TEXT("MaxDepth="), BoundText)
-				&& !TryParseBoundedInteger(BoundText.TrimStartAndEnd(), 1, 8, MaxDepth))
-			{
-				UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_MAX_DEPTH_INVALID: MaxDepth must be an integer from 1 through 8."));
-				return 1;
-			}
-			if (GetCmdValue(CommandLine, TEXT("MaxNodes="), BoundText)
-				&& !TryParseBoundedInteger(BoundText.TrimStartAndEnd(), 1, 256, MaxNodes))
-			{
-				UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_MAX_NODES_INVALID: MaxNodes must be an integer from 1 through 256."));
-				return 1;
-			}
-			if (GetCmdValue(CommandLine, TEXT("MaxEdges="), BoundText)
-				&& !TryParseBoundedInteger(BoundText.TrimStartAndEnd(), 1, 512, MaxEdges))
+		// SearchOutputPath는 선택적인 atomic output 경로다. 생략하면 JSON을 로그에 출력한다.
+		FString SearchOutputPath;
+		FParse::Value(*CommandLine, TEXT("Output="), SearchOutputPath);
+		if (!SearchOutputPath.IsEmpty())
+		{
+			FString SaveError;
+			if (!ADumpJson::SaveJsonTextToFile(SearchOutputPath, SearchJsonText, SaveError))
 			{
-				UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_MAX_EDGES_INVALID: MaxEdges must be an integer from 1 through 512."));
+				UE_LOG(LogTemp, Error, TEXT("JSON_SAVE_FAIL: %s"), *SaveError);
 				return 1;
 			}
+		}
+		else
+		{
+			UE_LOG(LogTemp, Display, TEXT("%s"), *SearchJsonText);
+		}
+		return 0;
+	}
 
-			FString QueryErrorCode;
-			FString QueryErrorDetail;
-			if (!BuildCommandletDependencyTraceQueryJson(
-				DumpRootPath,
-				bHasAssetSelector ? AssetPath : FString(),
-				bHasAssetIdSelector ? AssetIdSelector : FString(),
-				DirectionText,
-				StrengthText,
-				MaxDepth,
-				MaxNodes,
-				MaxEdges,
-				JsonText,
-				QueryErrorCode,
-				QueryErrorDetail))
-			{
-				UE_LOG(LogTemp, Error, TEXT("%s: %s"), *QueryErrorCode, *QueryErrorDetail);
-				return 2;
-			}
+	if (RequestedMode == TEXT("impact"))
+	{
+		// ImpactErrorCode와 ImpactErrorDetail은 impact_index_v1을 읽는 read-only impact query 실패를 전달한다.
+		FString ImpactErrorCode;
+		FString ImpactErrorDetail;
+
+		// ImpactJsonText는 impact_query_result_v1 success output이다.
+		FString ImpactJsonText;
+		if (!ADumpImpactGraph::BuildImpactQueryJson(CommandLine, ImpactJsonText, ImpactErrorCode, ImpactErrorDetail))
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *ImpactErrorCode, *ImpactErrorDetail);
+			return 1;
 		}
 
-				if (ResultSchemaText == TEXT("query_result_v1"))
+		// ImpactOutputPath는 선택적인 atomic output 경로다. 생략하면 JSON을 로그에 출력한다.
+		FString ImpactOutputPath;
+		FParse::Value(*CommandLine, TEXT("Output="), ImpactOutputPath);
+		if (!ImpactOutputPath.IsEmpty())
 		{
-			FString WrappedJsonText;
-			FString WrapErrorDetail;
-			if (!BuildCommandletQueryResultJson(
-				QueryKindText,
-				bHasAssetSelector ? TEXT("object_path") : TEXT("asset_id"),
-				JsonText,
-				WrappedJsonText,
-				WrapErrorDetail))
+			FString SaveError;
+			if (!ADumpJson::SaveJsonTextToFile(ImpactOutputPath, ImpactJsonText, SaveError))
 			{
-				UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_RESULT_WRAP_FAILED: %s"), *WrapErrorDetail);
-				return 2;
+				UE_LOG(LogTemp, Error, TEXT("JSON_SAVE_FAIL: %s"), *SaveError);
+				return 1;
 			}
-			JsonText = MoveTemp(WrappedJsonText);
 		}
-
-		FString SaveErrorMessage;
-		if (!ADumpJson::SaveJsonTextToFile(OutputFilePath, JsonText, SaveErrorMessage))
+		else
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_OUTPUT_WRITE_FAILED: %s"), *SaveErrorMessage);
-			return 3;
+			UE_LOG(LogTemp, Display, TEXT("%s"), *ImpactJsonText);
 		}
-
-		UE_LOG(LogTemp, Display, TEXT("Saved query JSON (%s, result_schema=%s): %s"), *QueryKindText, *ResultSchemaText, *OutputFilePath);
 		return 0;
 	}
-	else if (ModeValue.Equals(TEXT("dependencyquery"), ESearchCase::IgnoreCase))
+
+	if (RequestedMode == TEXT("packexport"))
 	{
-		FString UnsupportedOptionValue;
-				if (GetCmdValue(CommandLine, TEXT("Sections="), UnsupportedOptionValue)
-			|| GetCmdValue(CommandLine, TEXT("Intent="), UnsupportedOptionValue)
-			|| GetCmdValue(CommandLine, TEXT("Profile="), UnsupportedOptionValue)
-			|| GetCmdValue(CommandLine, TEXT("ResultSchema="), UnsupportedOptionValue))
+		// PackDumpRootPath는 dump_pack.adpk가 있는 dump root다.
+		FString PackDumpRootPath;
+		FParse::Value(*CommandLine, TEXT("DumpRoot="), PackDumpRootPath);
+
+		// PackExportDirectoryPath는 directory layout으로 풀어낼 대상 폴더다.
+		FString PackExportDirectoryPath;
+		FParse::Value(*CommandLine, TEXT("OutputDir="), PackExportDirectoryPath);
+		if (PackDumpRootPath.IsEmpty() || PackExportDirectoryPath.IsEmpty())
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_OPTION_UNSUPPORTED: dependencyquery does not accept Sections, Intent, Profile or ResultSchema."));
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_PACK_ARGUMENT_MISSING: -Mode=packexport requires -DumpRoot= and -OutputDir=."));
 			return 1;
 		}
 
-		FString AssetIdSelector;
-		const bool bHasAssetSelector = GetCmdValue(CommandLine, TEXT("Asset="), AssetPath) && !AssetPath.IsEmpty();
-		const bool bHasAssetIdSelector = GetCmdValue(CommandLine, TEXT("AssetId="), AssetIdSelector) && !AssetIdSelector.IsEmpty();
-		if (!bHasAssetSelector && !bHasAssetIdSelector)
+		FString PackErrorCode;
+		FString PackErrorDetail;
+		int32 ExportedFileCount = 0;
+		if (!ADumpPack::ExportPackToDirectory(
+			FPaths::Combine(PackDumpRootPath, ADumpPack::GetPackFileName()),
+			PackExportDirectoryPath,
+			ExportedFileCount,
+			PackErrorCode,
+			PackErrorDetail))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_SELECTOR_REQUIRED: Provide exactly one of -Asset= or -AssetId=."));
+			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *PackErrorCode, *PackErrorDetail);
 			return 1;
 		}
-		if (bHasAssetSelector && bHasAssetIdSelector)
+		UE_LOG(LogTemp, Display, TEXT("Exported %d packed files to %s"), ExportedFileCount, *PackExportDirectoryPath);
+		return 0;
+	}
+
+	if (RequestedMode == TEXT("contentgc"))
+	{
+		// ContentGcDumpRootPath는 content_store가 있는 dump root다.
+		FString ContentGcDumpRootPath;
+		FParse::Value(*CommandLine, TEXT("DumpRoot="), ContentGcDumpRootPath);
+		if (ContentGcDumpRootPath.IsEmpty())
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_SELECTOR_CONFLICT: -Asset= and -AssetId= cannot be used together."));
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTENT_STORE_ARGUMENT_MISSING: -Mode=contentgc requires -DumpRoot=."));
 			return 1;
 		}
 
-		FString DirectionText = TEXT("dependencies");
-		GetCmdValue(CommandLine, TEXT("Direction="), DirectionText);
-		DirectionText = DirectionText.TrimStartAndEnd().ToLower();
-		if (DirectionText != TEXT("dependencies")
-			&& DirectionText != TEXT("referencers")
-			&& DirectionText != TEXT("both"))
+		// bContentGcDryRun은 삭제 없이 참조 수와 회수 예정량만 보고할지 여부다.
+		bool bContentGcDryRun = false;
+		FParse::Bool(*CommandLine, TEXT("DryRun="), bContentGcDryRun);
+
+		FADumpContentStoreReport ContentStoreReport;
+		FString ContentStoreReportFilePath;
+		FString ContentStoreErrorCode;
+		FString ContentStoreErrorDetail;
+		if (!ADumpContentStore::CollectGarbage(
+			ContentGcDumpRootPath,
+			bContentGcDryRun,
+			ContentStoreReport,
+			ContentStoreReportFilePath,
+			ContentStoreErrorCode,
+			ContentStoreErrorDetail))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_DIRECTION_INVALID: Direction must be dependencies, referencers or both."));
+			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *ContentStoreErrorCode, *ContentStoreErrorDetail);
 			return 1;
 		}
+		UE_LOG(LogTemp, Display, TEXT("Content store GC%s - refs:%d, live:%d, deleted:%d, reclaimed_bytes:%lld, dedup_ratio:%.2f (%s)"),
+			bContentGcDryRun ? TEXT(" (dry run)") : TEXT(""),
+			ContentStoreReport.ReferenceCount,
+			ContentStoreReport.LiveBlobCount,
+			ContentStoreReport.DeletedBlobCount,
+			ContentStoreReport.ReclaimedBytes,
+			ContentStoreReport.DedupRatio,
+			*ContentStoreReportFilePath);
+		return ContentStoreReport.DeleteFailedCount > 0 ? 1 : 0;
+	}
+
+				// ModeValue는 list / asset / asset_details / map / bpgraph / bpdump / batchdump / index / batchdiff / watch / validate / makefixtures 중 실행 모드를 고른다.
+	FString ModeValue;
+	// OutputFilePath는 저장할 JSON 파일 경로다.
+	FString OutputFilePath;
+	// FilterPath는 list 모드에서 사용할 검색 경로다. 예: /Game/Prototype
+	FString FilterPath;
+	// AssetPath는 asset / asset_details / bpgraph / bpdump 모드에서 사용할 에셋 경로다.
+	FString AssetPath;
+	// MapAssetPath는 map 모드에서 사용할 맵 경로다.
+	FString MapAssetPath;
+
+	if (!GetCmdValue(CommandLine, TEXT("Mode="), ModeValue))
+	{
+								UE_LOG(LogTemp, Error, TEXT("Missing -Mode=. Use -Mode=list|asset|asset_details|bpgraph|bpdump|batchdump|map|index|batchdiff|watch|sectiondump|dependencyquery|query|contextbundle|entityquery|entitycontext|search|impact|packexport|contentgc|validate|makefixtures"));
+		return 1;
+	}
+
+	// SectionSelection은 Sections > Intent > Profile 우선순위가 적용된 최종 주요 JSON 섹션 선택값이다.
+	FADumpSectionSelection SectionSelection;
+
+	// SectionSelectionError는 알 수 없거나 비어 있는 섹션/Intent 이름의 명확한 실패 메시지다.
+	FString SectionSelectionError;
+
+	// IntentName은 -Intent=에서 받은 정규화된 분석 목적 이름이다.
+	FString IntentName;
+
+	// IntentSectionSelection은 Intent 매핑에서 파생된 정식 섹션 선택값이다.
+	FADumpSectionSelection IntentSectionSelection;
+
+	// ProfileName은 -Profile=에서 받은 정규화된 출력 프리셋 이름이다.
+	FString ProfileName;
+
+	// ProfileSectionSelection은 Profile 매핑에서 파생된 정식 섹션 선택값이다.
+	FADumpSectionSelection ProfileSectionSelection;
+
+	// SectionSource는 최종 섹션 선택 출처(full, profile, intent, sections)다.
+	FString SectionSource = TEXT("full");
+
+	// bUsesSectionSerialization은 주요 dump.json 직렬화를 사용하는 commandlet 모드인지 나타낸다.
+		const bool bUsesSectionSerialization = ModeValue.Equals(TEXT("bpdump"), ESearchCase::IgnoreCase)
+		|| ModeValue.Equals(TEXT("batchdump"), ESearchCase::IgnoreCase)
+		|| ModeValue.Equals(TEXT("watch"), ESearchCase::IgnoreCase);
+	if (bUsesSectionSerialization
+		&& (!TryParseSectionSelection(CommandLine, SectionSelection, SectionSelectionError)
+			|| !TryParseIntentSelection(CommandLine, IntentName, IntentSectionSelection, SectionSelectionError)
+			|| !TryParseProfileSelection(CommandLine, ProfileName, ProfileSectionSelection, SectionSelectionError)))
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s"), *SectionSelectionError);
+		return 1;
+	}
+	if (bUsesSectionSerialization)
+	{
+		// ExplicitSectionSelection은 우선순위 계산 전에 보존한 -Sections= 직접 선택값이다.
+		FADumpSectionSelection ExplicitSectionSelection = SectionSelection;
+		ResolveEffectiveSelection(ExplicitSectionSelection, IntentName, IntentSectionSelection, ProfileName, ProfileSectionSelection, SectionSelection, SectionSource);
+	}
+
+	if (ModeValue.Equals(TEXT("index"), ESearchCase::IgnoreCase))
+	{
+		// DumpRootPath는 index 생성 대상 BPDump 루트 폴더다.
+		FString DumpRootPath;
+		if (!GetCmdValue(CommandLine, TEXT("DumpRoot="), DumpRootPath))
+		{
+			DumpRootPath = FPaths::Combine(ADumpJson::ResolveWritableDefaultDumpRootDirectory(), TEXT("BPDump"));
+		}
+
+		// IndexFilePath는 저장할 index.json 최종 경로다.
+		FString IndexFilePath;
+
+				// DependencyIndexFilePath는 저장할 dependency_index.json 최종 경로다.
+		FString DependencyIndexFilePath;
+
+				// AssetIndexFilePath는 저장할 additive asset_index.json 최종 경로다.
+		FString AssetIndexFilePath;
 
-		FString StrengthText = TEXT("all");
-		GetCmdValue(CommandLine, TEXT("Strength="), StrengthText);
-		StrengthText = StrengthText.TrimStartAndEnd().ToLower();
-		if (StrengthText != TEXT("all") && StrengthText != TEXT("hard") && StrengthText != TEXT("soft"))
+		// SectionIndexFilePath는 저장할 additive section_index.json 최종 경로다.
+		FString SectionIndexFilePath;
+		if (!BuildDumpIndexFiles(DumpRootPath, IndexFilePath, DependencyIndexFilePath, AssetIndexFilePath, SectionIndexFilePath))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_STRENGTH_INVALID: Strength must be all, hard or soft."));
-			return 1;
+			UE_LOG(LogTemp, Error, TEXT("Failed to build dump index files under: %s"), *DumpRootPath);
+			return 2;
 		}
 
-		auto TryParseBoundedInteger = [](const FString& InText, int32 InMinimum, int32 InMaximum, int32& OutValue)
+						int32 AssetIndexAssetCount = 0;
+		FString AssetIndexContractDetail;
+				if (!ValidateCommandletAssetIndexContract(AssetIndexFilePath, AssetIndexAssetCount, AssetIndexContractDetail))
 		{
-			if (InText.IsEmpty()) return false;
-			for (int32 CharacterIndex = 0; CharacterIndex < InText.Len(); ++CharacterIndex)
-			{
-				if (!FChar::IsDigit(InText[CharacterIndex])) return false;
-			}
-			OutValue = FCString::Atoi(*InText);
-			return OutValue >= InMinimum && OutValue <= InMaximum;
-		};
+			UE_LOG(LogTemp, Error, TEXT("Generated asset index contract failed: %s"), *AssetIndexContractDetail);
+			return 2;
+		}
 
-		int32 MaxDepth = 1;
-		int32 MaxNodes = 64;
-		int32 MaxEdges = 128;
-		FString BoundText;
-		if (GetCmdValue(CommandLine, TEXT("MaxDepth="), BoundText)
-			&& !TryParseBoundedInteger(BoundText.TrimStartAndEnd(), 1, 8, MaxDepth))
+		int32 SectionIndexSectionCount = 0;
+		int32 SectionIndexSymbolCount = 0;
+		FString SectionIndexContractDetail;
+		if (!ValidateCommandletSectionIndexContract(
+			SectionIndexFilePath,
+			AssetIndexFilePath,
+			DumpRootPath,
+			SectionIndexSectionCount,
+			SectionIndexSymbolCount,
+			SectionIndexContractDetail))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_MAX_DEPTH_INVALID: MaxDepth must be an integer from 1 through 8."));
-			return 1;
+			UE_LOG(LogTemp, Error, TEXT("Generated section index contract failed: %s"), *SectionIndexContractDetail);
+			return 2;
 		}
-		if (GetCmdValue(CommandLine, TEXT("MaxNodes="), BoundText)
-			&& !TryParseBoundedInteger(BoundText.TrimStartAndEnd(), 1, 256, MaxNodes))
+
+		int32 SelectorIndexAssetCount = 0;
+		int32 SelectorIndexSectionCount = 0;
+		FString SelectorIndexContractDetail;
+		if (!ADumpReadQuery::ValidateSelectorIndexContract(DumpRootPath, SelectorIndexAssetCount, SelectorIndexSectionCount, SelectorIndexContractDetail))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_MAX_NODES_INVALID: MaxNodes must be an integer from 1 through 256."));
-			return 1;
+			UE_LOG(LogTemp, Error, TEXT("Generated selector index contract failed: %s"), *SelectorIndexContractDetail);
+			return 2;
 		}
-		if (GetCmdValue(CommandLine, TEXT("MaxEdges="), BoundText)
-			&& !TryParseBoundedInteger(BoundText.TrimStartAndEnd(), 1, 512, MaxEdges))
+
+		UE_LOG(LogTemp, Display, TEXT("Saved dump index JSON: %s"), *IndexFilePath);
+		UE_LOG(LogTemp, Display, TEXT("Saved dump dependency index JSON: %s"), *DependencyIndexFilePath);
+				UE_LOG(LogTemp, Display, TEXT("Saved dump asset index JSON: %s (%s)"), *AssetIndexFilePath, *AssetIndexContractDetail);
+		UE_LOG(LogTemp, Display, TEXT("Saved dump section index JSON: %s (%s)"), *SectionIndexFilePath, *SectionIndexContractDetail);
+		UE_LOG(LogTemp, Display, TEXT("Saved dump selector index JSON: %s (%s)"), *FPaths::Combine(DumpRootPath, TEXT("selector_index.json")), *SelectorIndexContractDetail);
+		return 0;
+	}
+
+	if (ModeValue.Equals(TEXT("batchdiff"), ESearchCase::IgnoreCase))
+	{
+		// BaselineRootPath는 비교 기준이 되는 이전 BPDump 루트 폴더다.
+		FString BaselineRootPath;
+		if (!GetCmdValue(CommandLine, TEXT("BaselineRoot="), BaselineRootPath) || BaselineRootPath.TrimStartAndEnd().IsEmpty())
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_MAX_EDGES_INVALID: MaxEdges must be an integer from 1 through 512."));
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_BATCH_DIFF_BASELINE_ROOT_REQUIRED: -Mode=batchdiff requires explicit -BaselineRoot=<baseline dump root>."));
 			return 1;
 		}
 
+		// DumpRootPath는 현재 DataAsset dump와 asset_index.json이 있는 BPDump 루트 폴더다.
 		FString DumpRootPath;
 		if (!GetCmdValue(CommandLine, TEXT("DumpRoot="), DumpRootPath))
 		{
 			DumpRootPath = FPaths::Combine(ADumpJson::BuildDefaultDumpRootDirectory(), TEXT("BPDump"));
 		}
 
-		FString QueryErrorCode;
-		FString QueryErrorDetail;
-		if (!BuildCommandletDependencyTraceQueryJson(
-			DumpRootPath,
-			bHasAssetSelector ? AssetPath : FString(),
-			bHasAssetIdSelector ? AssetIdSelector : FString(),
-			DirectionText,
-			StrengthText,
-			MaxDepth,
-			MaxNodes,
-			MaxEdges,
-			JsonText,
-			QueryErrorCode,
-			QueryErrorDetail))
-		{
-			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *QueryErrorCode, *QueryErrorDetail);
+		// BatchDiffReportPath는 data_asset_batch_diff_v1 집계 보고서 저장 경로다.
+		FString BatchDiffReportPath;
+		if (!GetCmdValue(CommandLine, TEXT("Output="), BatchDiffReportPath))
+		{
+			BatchDiffReportPath = FPaths::Combine(DumpRootPath, TEXT("data_asset_batch_diff.json"));
+		}
+
+		FString BatchDiffJsonText;
+		FString BatchDiffErrorCode;
+		FString BatchDiffErrorDetail;
+		if (!ADumpDataDiff::BuildBatchDataAssetDiffJson(BaselineRootPath, DumpRootPath, BatchDiffJsonText, BatchDiffErrorCode, BatchDiffErrorDetail))
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *BatchDiffErrorCode, *BatchDiffErrorDetail);
 			return 2;
 		}
 
 		FString SaveErrorMessage;
-		if (!ADumpJson::SaveJsonTextToFile(OutputFilePath, JsonText, SaveErrorMessage))
+		if (!ADumpJson::SaveJsonTextToFile(BatchDiffReportPath, BatchDiffJsonText, SaveErrorMessage))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_OUTPUT_WRITE_FAILED: %s"), *SaveErrorMessage);
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_BATCH_DIFF_OUTPUT_WRITE_FAILED: %s"), *SaveErrorMessage);
 			return 3;
 		}
 
-		UE_LOG(LogTemp, Display, TEXT("Saved dependency trace query JSON: %s"), *OutputFilePath);
+		UE_LOG(LogTemp, Display, TEXT("Saved DataAsset batch diff JSON: %s"), *BatchDiffReportPath);
 		return 0;
 	}
-	else if (ModeValue.Equals(TEXT("sectiondump"), ESearchCase::IgnoreCase))
+
+	if (ModeValue.Equals(TEXT("watch"), ESearchCase::IgnoreCase))
+	{
+		return RunWatchMode(CommandLine, SectionSelection, IntentName, ProfileName, SectionSource);
+	}
+
+	// bRequireExplicitOutputPath는 레거시 JSON 변환 모드에서 명시 출력 경로를 요구하는지 여부다.
+	const bool bRequireExplicitOutputPath = !ModeValue.Equals(TEXT("bpdump"), ESearchCase::IgnoreCase)
+		&& !ModeValue.Equals(TEXT("batchdump"), ESearchCase::IgnoreCase)
+		&& !ModeValue.Equals(TEXT("validate"), ESearchCase::IgnoreCase)
+		&& !ModeValue.Equals(TEXT("makefixtures"), ESearchCase::IgnoreCase);
+		if (bRequireExplicitOutputPath && !GetCmdValue(CommandLine, TEXT("Output="), OutputFilePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Missing -Output=. Example: -Output=C:/Temp/out.json"));
+		return 1;
+	}
+
+	if (!bRequireExplicitOutputPath)
+	{
+		GetCmdValue(CommandLine, TEXT("Output="), OutputFilePath);
+	}
+
+	// JsonText는 최종 저장할 JSON 문자열이다.
+	FString JsonText;
+
+	if (ModeValue.Equals(TEXT("makefixtures"), ESearchCase::IgnoreCase))
 	{
-		FString ExplicitSectionListText;
-		if (!GetCmdValue(CommandLine, TEXT("Sections="), ExplicitSectionListText)
-			|| ExplicitSectionListText.TrimStartAndEnd().IsEmpty()
-			|| SectionSelection.IsFullMode())
+		if (OutputFilePath.IsEmpty())
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_LAZY_DUMP_SECTIONS_REQUIRED: -Mode=sectiondump requires explicit -Sections=."));
-			return 1;
+			OutputFilePath = FPaths::Combine(
+				ADumpJson::ResolveWritableDefaultDumpRootDirectory(),
+				TEXT("BPDumpValidationPlugin"),
+				TEXT("fixture_report.json"));
 		}
 
-				FString DirectResultSchemaValue;
-		if (!IntentName.IsEmpty()
-			|| !ProfileName.IsEmpty()
-			|| GetCmdValue(CommandLine, TEXT("ResultSchema="), DirectResultSchemaValue))
+		// FixtureFailureCount는 생성/보정 실패 fixture 개수다.
+		int32 FixtureFailureCount = 0;
+		if (!BuildValidationFixtureJson(CommandLine, JsonText, FixtureFailureCount))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_LAZY_DUMP_SELECTION_SOURCE_UNSUPPORTED: -Mode=sectiondump accepts explicit -Sections= only; Intent, Profile and ResultSchema are not supported."));
-			return 1;
+			return 2;
 		}
 
-		FString AssetIdSelector;
-		const bool bHasAssetSelector = GetCmdValue(CommandLine, TEXT("Asset="), AssetPath) && !AssetPath.IsEmpty();
-		const bool bHasAssetIdSelector = GetCmdValue(CommandLine, TEXT("AssetId="), AssetIdSelector) && !AssetIdSelector.IsEmpty();
-		if (!bHasAssetSelector && !bHasAssetIdSelector)
+		if (!SaveJsonToFile(OutputFilePath, JsonText))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_LAZY_DUMP_SELECTOR_REQUIRED: Provide exactly one of -Asset= or -AssetId=."));
-			return 1;
+			return 3;
 		}
-		if (bHasAssetSelector && bHasAssetIdSelector)
+
+		UE_LOG(LogTemp, Display, TEXT("Saved fixture report JSON: %s"), *OutputFilePath);
+		return FixtureFailureCount > 0 ? 2 : 0;
+	}
+	else if (ModeValue.Equals(TEXT("validate"), ESearchCase::IgnoreCase))
+	{
+		// ValidationRootPath는 validate 산출물 루트 폴더다.
+		FString ValidationRootPath;
+		if (!GetCmdValue(CommandLine, TEXT("ValidationRoot="), ValidationRootPath))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_LAZY_DUMP_SELECTOR_CONFLICT: -Asset= and -AssetId= cannot be used together."));
-			return 1;
+			ValidationRootPath = FPaths::Combine(ADumpJson::ResolveWritableDefaultDumpRootDirectory(), TEXT("BPDumpValidation"));
 		}
 
-		FString DumpRootPath;
-		if (!GetCmdValue(CommandLine, TEXT("DumpRoot="), DumpRootPath))
+		if (OutputFilePath.IsEmpty())
 		{
-			DumpRootPath = FPaths::Combine(ADumpJson::BuildDefaultDumpRootDirectory(), TEXT("BPDump"));
+			OutputFilePath = FPaths::Combine(ValidationRootPath, TEXT("validation_report.json"));
 		}
 
-		FString LazyDumpErrorCode;
-		FString LazyDumpErrorDetail;
-		if (!BuildCommandletLazySectionDumpJson(
-			DumpRootPath,
-			bHasAssetSelector ? AssetPath : FString(),
-			bHasAssetIdSelector ? AssetIdSelector : FString(),
-			SectionSelection,
-			JsonText,
-			LazyDumpErrorCode,
-			LazyDumpErrorDetail))
+		// ValidationFailureCount는 필수 검증 실패 케이스 개수다.
+		int32 ValidationFailureCount = 0;
+		if (!BuildValidationJson(CommandLine, JsonText, ValidationFailureCount))
 		{
-			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *LazyDumpErrorCode, *LazyDumpErrorDetail);
 			return 2;
 		}
 
-		FString SaveErrorMessage;
-		if (!ADumpJson::SaveJsonTextToFile(OutputFilePath, JsonText, SaveErrorMessage))
+		if (!SaveJsonToFile(OutputFilePath, JsonText))
 		{
-			UE_LOG(LogTemp, Error, TEXT("ADUMP_LAZY_DUMP_OUTPUT_WRITE_FAILED: %s"), *SaveErrorMessage);
 			return 3;
 		}
 
-		UE_LOG(LogTemp, Display, TEXT("Saved lazy section dump JSON: %s"), *OutputFilePath);
-		return 0;
+		UE_LOG(LogTemp, Display, TEXT("Saved validation report JSON: %s"), *OutputFilePath);
+		return ValidationFailureCount > 0 ? 2 : 0;
 	}
 	else if (ModeValue.Equals(TEXT("list"), ESearchCase::IgnoreCase))
 	{
@@ -8488,6 +11107,27 @@ int32 UAssetDumpCommandlet::Main(const FString& OriginalCommandLine)
 		int32 MaxAssets = 0;
 		FParse::Value(*CommandLine, TEXT("MaxAssets="), MaxAssets);
 
+		// bUsePack은 자산별 폴더 파일 대신 dump root 단일 pack에 결과를 append할지 여부다.
+		bool bUsePack = false;
+		FParse::Bool(*CommandLine, TEXT("Pack="), bUsePack);
+
+		// BatchPackFilePath는 -Pack=true일 때 결과를 append할 dump root pack 경로다.
+		const FString BatchPackFilePath = bUsePack
+			? FPaths::Combine(FPaths::ConvertRelativePathToFull(DumpRootPath), ADumpPack::GetPackFileName())
+			: FString();
+
+		// PendingPackAssetCount는 마지막 pack commit 이후 append한 자산 수다.
+		int32 PendingPackAssetCount = 0;
+
+		// bDedupSections는 section sidecar payload를 dump root content store에 hash blob으로 한 번만 저장할지 여부다.
+		bool bDedupSections = false;
+		FParse::Bool(*CommandLine, TEXT("DedupSections="), bDedupSections);
+
+		// BatchContentStorePath는 -DedupSections=true일 때 section payload blob을 모을 store root다.
+		const FString BatchContentStorePath = bDedupSections
+			? FPaths::Combine(FPaths::ConvertRelativePathToFull(DumpRootPath), ADumpContentStore::GetContentStoreDirectoryName())
+			: FString();
+
 		// ClassFilterText는 자산 클래스 이름 필터 원문이다.
 		FString ClassFilterText;
 		GetCmdValue(CommandLine, TEXT("ClassFilter="), ClassFilterText);
@@ -8504,7 +11144,8 @@ int32 UAssetDumpCommandlet::Main(const FString& OriginalCommandLine)
 		// BatchScanPathArray는 /Game 외 Plugin mount도 Asset Registry에 등록하기 위한 명시적 검색 경로다.
 		TArray<FString> BatchScanPathArray;
 		BatchScanPathArray.Add(BatchFilterPath);
-		AssetRegistryModule.Get().ScanPathsSynchronous(BatchScanPathArray, true);
+		// RegistryScanReports는 scan 생략/상태 cache 재사용 결과다. -RegistryCache=true면 바뀌지 않은 package는 다시 읽지 않는다.
+		const TArray<FADumpRegistryScanReport> RegistryScanReports = ADumpRegistryCache::ScanPathsOnce(BatchScanPathArray, CommandLine);
 
 		// AssetFilter는 배치 대상 자산을 모을 재귀 검색 필터다.
 		FARFilter AssetFilter;
@@ -8547,6 +11188,56 @@ int32 UAssetDumpCommandlet::Main(const FString& OriginalCommandLine)
 		// FailedCount는 덤프 실패 또는 저장 실패 자산 수다.
 		int32 FailedCount = 0;
 
+		// BatchOptionsKeyByObjectPath는 자산별 실행 옵션 비교 키다.
+		TMap<FString, FString> BatchOptionsKeyByObjectPath;
+
+		// BatchOutputFilePathByObjectPath는 자산별 dump.json 후보 경로다.
+		TMap<FString, FString> BatchOutputFilePathByObjectPath;
+
+		// BatchChangePlan은 file-state cache와 reverse dependency closure로 계산한 재덤프 계획이다.
+		// 전체 실행은 이전 cache 없이 계산해 skip 판정에 쓰지 않고, 저장할 package 상태와 옵션 키만 얻는다.
+		FCommandletBatchChangePlan BatchChangePlan;
+		for (const FAssetData& AssetDataItem : FoundAssets)
+		{
+			// PlanAssetObjectPathText는 계획 계산용 자산 경로다.
+			const FString PlanAssetObjectPathText = AssetDataItem.GetObjectPathString();
+
+			// PlanDumpRunOpts는 파일시스템 변경 없이 옵션 키와 출력 경로만 계산할 실행 옵션이다.
+			FADumpRunOpts PlanDumpRunOpts;
+			ConfigureDumpRunOptsFromCommandLine(
+				CommandLine,
+				PlanAssetObjectPathText,
+				BuildBatchAssetOutputDirectoryPath(DumpRootPath, PlanAssetObjectPathText),
+				SectionSelection,
+				IntentName,
+				ProfileName,
+				SectionSource,
+				PlanDumpRunOpts);
+			BatchOptionsKeyByObjectPath.Add(PlanAssetObjectPathText, BuildBatchOptionsKeyText(PlanDumpRunOpts));
+			BatchOutputFilePathByObjectPath.Add(PlanAssetObjectPathText, PlanDumpRunOpts.ResolveOutputFilePathCandidate());
+		}
+
+		BuildBatchChangePlan(
+			AssetRegistryModule,
+			DumpRootPath,
+			BuildBatchFileStateScopeText(BatchFilterPath, ClassFilterText, bWithDependencies, MaxAssets),
+			bChangedOnly,
+			FoundAssets,
+			BatchOptionsKeyByObjectPath,
+			BatchOutputFilePathByObjectPath,
+			BatchChangePlan);
+
+		// bUseChangePlan은 ChangedOnly 판정을 per-asset fingerprint 대신 closure 계획으로 할지 여부다. cache가 없으면 fingerprint로 fallback한다.
+		const bool bUseChangePlan = bChangedOnly && BatchChangePlan.bCacheLoaded;
+
+		// ChangedOnlyStrategyText는 report에 남길 ChangedOnly 판정 방식이다.
+		const FString ChangedOnlyStrategyText = !bChangedOnly
+			? TEXT("disabled")
+			: (bUseChangePlan ? TEXT("reverse_dependency_closure") : TEXT("fingerprint"));
+
+		// BatchAssetRecordByPath는 다음 실행 cache에 저장할 자산별 (options_key, status) 기록이다.
+		TMap<FString, TPair<FString, FString>> BatchAssetRecordByPath;
+
 		for (const FAssetData& AssetDataItem : FoundAssets)
 		{
 			// AssetObjectPathText는 현재 배치에서 처리할 자산 경로다.
@@ -8558,11 +11249,22 @@ int32 UAssetDumpCommandlet::Main(const FString& OriginalCommandLine)
 			// DumpRunOpts는 현재 자산에 적용할 통합 실행 옵션이다.
 			FADumpRunOpts DumpRunOpts;
 			ConfigureDumpRunOptsFromCommandLine(CommandLine, AssetObjectPathText, BatchAssetOutputPath, SectionSelection, IntentName, ProfileName, SectionSource, DumpRunOpts);
-			DumpRunOpts.bSkipIfUpToDate = bChangedOnly;
+			DumpRunOpts.bSkipIfUpToDate = bChangedOnly && !bUseChangePlan;
+			DumpRunOpts.OutputEncoding.PackFilePath = BatchPackFilePath;
+			DumpRunOpts.OutputEncoding.ContentStorePath = BatchContentStorePath;
 
 			// ResolvedOutputFilePath는 현재 자산 dump.json 최종 저장 경로다.
 			const FString ResolvedOutputFilePath = DumpRunOpts.ResolveOutputFilePath();
 
+			// RedumpReasonText는 closure 계획이 정한 재덤프 사유다. nullptr이면 변경 영향이 없는 자산이다.
+			const FString* RedumpReasonText = BatchChangePlan.RedumpReasonByObjectPath.Find(AssetObjectPathText);
+
+			// RedumpViaText는 dependency_changed 자산에 변경을 전파한 package다.
+			const FString* RedumpViaText = BatchChangePlan.RedumpViaByObjectPath.Find(AssetObjectPathText);
+
+			// AssetOptionsKeyText는 cache에 기록할 현재 자산 옵션 키다.
+			const FString AssetOptionsKeyText = BatchOptionsKeyByObjectPath.FindRef(AssetObjectPathText);
+
 			// AssetPackagePathText는 현재 자산 object path에서 계산한 package path다.
 			const FString AssetPackagePathText = FPackageName::ObjectPathToPackageName(AssetObjectPathText);
 
@@ -8595,12 +11297,14 @@ int32 UAssetDumpCommandlet::Main(const FString& OriginalCommandLine)
 					SimulatedFailureMessageText);
 				ResultEntryArray.Add(MakeShared<FJsonValueObject>(ResultEntryObject));
 				FailedEntryArray.Add(MakeShared<FJsonValueObject>(ResultEntryObject));
+				BatchAssetRecordByPath.Add(AssetObjectPathText, TPair<FString, FString>(AssetOptionsKeyText, TEXT("failed")));
 				++FailedCount;
 				UE_LOG(LogTemp, Warning, TEXT("Batch dump simulated failure for asset: %s"), *AssetObjectPathText);
 				continue;
 			}
 
-			if (DumpRunOpts.bSkipIfUpToDate && IsBatchDumpOutputUpToDate(DumpRunOpts, ResolvedOutputFilePath))
+			if ((bUseChangePlan && RedumpReasonText == nullptr)
+				|| (DumpRunOpts.bSkipIfUpToDate && IsBatchDumpOutputUpToDate(DumpRunOpts, ResolvedOutputFilePath)))
 			{
 				// SkippedResult은 skip report에 넣을 최소 결과 구조다.
 				FADumpResult SkippedResult;
@@ -8613,7 +11317,9 @@ int32 UAssetDumpCommandlet::Main(const FString& OriginalCommandLine)
 					ResolvedOutputFilePath,
 					SkippedResult,
 					FString());
+				ResultEntryObject->SetStringField(TEXT("redump_reason"), TEXT("unchanged"));
 				ResultEntryArray.Add(MakeShared<FJsonValueObject>(ResultEntryObject));
+				BatchAssetRecordByPath.Add(AssetObjectPathText, TPair<FString, FString>(AssetOptionsKeyText, TEXT("dumped")));
 				++SkippedCount;
 				continue;
 			}
@@ -8678,13 +11384,91 @@ int32 UAssetDumpCommandlet::Main(const FString& OriginalCommandLine)
 				ResolvedOutputFilePath,
 				DumpResult,
 				FailureMessageText);
+			if (bWasSkipped)
+			{
+				ResultEntryObject->SetStringField(TEXT("redump_reason"), TEXT("unchanged"));
+			}
+			else if (bUseChangePlan)
+			{
+				ResultEntryObject->SetStringField(TEXT("redump_reason"), *RedumpReasonText);
+				if (RedumpViaText != nullptr)
+				{
+					ResultEntryObject->SetStringField(TEXT("redump_via"), *RedumpViaText);
+				}
+			}
+			else
+			{
+				ResultEntryObject->SetStringField(TEXT("redump_reason"), bChangedOnly ? TEXT("fingerprint_changed") : TEXT("full_run"));
+			}
 			ResultEntryArray.Add(MakeShared<FJsonValueObject>(ResultEntryObject));
+			BatchAssetRecordByPath.Add(
+				AssetObjectPathText,
+				TPair<FString, FString>(
+					AssetOptionsKeyText,
+					(ResultStatusText == TEXT("succeeded") || ResultStatusText == TEXT("skipped")) ? TEXT("dumped") : TEXT("failed")));
 
 			if (ResultStatusText != TEXT("succeeded") && ResultStatusText != TEXT("skipped"))
 			{
 				FailedEntryArray.Add(MakeShared<FJsonValueObject>(ResultEntryObject));
 				UE_LOG(LogTemp, Warning, TEXT("Batch dump failed for asset: %s (%s)"), *AssetObjectPathText, *FailureMessageText);
 			}
+
+			// 중단 시 잃는 범위를 제한하도록 일정 자산 수마다 pack TOC를 commit한다.
+			if (!BatchPackFilePath.IsEmpty() && ++PendingPackAssetCount >= BatchPackCommitInterval)
+			{
+				FString PackErrorCode;
+				FString PackErrorDetail;
+				if (!ADumpPack::CommitPack(BatchPackFilePath, PackErrorCode, PackErrorDetail))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("%s: %s"), *PackErrorCode, *PackErrorDetail);
+				}
+				PendingPackAssetCount = 0;
+			}
+		}
+
+		// PackErrorCode와 PackErrorDetail은 마지막 pack commit 실패 사유다.
+		FString PackErrorCode;
+		FString PackErrorDetail;
+
+		// bPackCommitted는 pack 사용 시 마지막 TOC commit 성공 여부다. 실패하면 index 재생성과 종료 코드가 실패를 반영한다.
+		const bool bPackCommitted = BatchPackFilePath.IsEmpty() || ADumpPack::ClosePack(BatchPackFilePath, PackErrorCode, PackErrorDetail);
+		if (!bPackCommitted)
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *PackErrorCode, *PackErrorDetail);
+		}
+
+		// ContentStoreReport는 dedup 저장 시 batch 종료 후 참조 수 집계(삭제 없는 dry run) 결과다. GC 회수는 -Mode=contentgc가 맡는다.
+		FADumpContentStoreReport ContentStoreReport;
+		FString ContentStoreReportFilePath;
+		if (bDedupSections && bPackCommitted)
+		{
+			FString ContentStoreErrorCode;
+			FString ContentStoreErrorDetail;
+			if (!ADumpContentStore::CollectGarbage(DumpRootPath, true, ContentStoreReport, ContentStoreReportFilePath, ContentStoreErrorCode, ContentStoreErrorDetail))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("%s: %s"), *ContentStoreErrorCode, *ContentStoreErrorDetail);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Display, TEXT("Content store dedup - refs:%d, blobs:%d, logical_bytes:%lld, stored_bytes:%lld, dedup_ratio:%.2f"),
+					ContentStoreReport.ReferenceCount,
+					ContentStoreReport.LiveBlobCount,
+					ContentStoreReport.LogicalBytes,
+					ContentStoreReport.StoredBytes,
+					ContentStoreReport.DedupRatio);
+			}
+		}
+
+		// FileStateCacheErrorMessage는 file-state cache 저장 실패 사유다. 실패해도 다음 실행이 fingerprint로 fallback하므로 batch 결과는 유지한다.
+		FString FileStateCacheErrorMessage;
+
+		// bFileStateCacheSaved는 다음 ChangedOnly 실행 기준 cache 저장 성공 여부다. 전체 실행도 이번 옵션 키로 cache를 갱신해, 다른 옵션의 ChangedOnly 실행이 options_changed로 재덤프하게 한다.
+		// pack commit이 실패하면 dumped 기록이 디스크와 맞지 않으므로 기존 cache를 그대로 둔다.
+		const bool bFileStateCacheSaved = bPackCommitted
+			&& SaveBatchFileStateCache(BatchChangePlan, BatchAssetRecordByPath, FileStateCacheErrorMessage);
+		if (bPackCommitted && !bFileStateCacheSaved)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Failed to save batch file-state cache: %s (%s)"), *BatchChangePlan.CacheFilePath, *FileStateCacheErrorMessage);
 		}
 
 		// IndexFilePath는 배치 종료 후 생성한 index.json 경로다.
@@ -8701,7 +11485,7 @@ int32 UAssetDumpCommandlet::Main(const FString& OriginalCommandLine)
 
 		// bIndexBuilt는 배치 종료 후 네 인덱스 재생성 성공 여부다.
 		const bool bIndexBuilt = !bRebuildIndexAfterBatch
-			|| BuildDumpIndexFiles(DumpRootPath, IndexFilePath, DependencyIndexFilePath, AssetIndexFilePath, SectionIndexFilePath);
+			|| (bPackCommitted && BuildDumpIndexFiles(DumpRootPath, IndexFilePath, DependencyIndexFilePath, AssetIndexFilePath, SectionIndexFilePath));
 
 		int32 AssetIndexAssetCount = 0;
 		FString AssetIndexContractDetail = bRebuildIndexAfterBatch ? FString() : TEXT("not_requested");
@@ -8733,8 +11517,32 @@ int32 UAssetDumpCommandlet::Main(const FString& OriginalCommandLine)
 		BatchRootObject->SetStringField(TEXT("dump_root_path"), FPaths::ConvertRelativePathToFull(DumpRootPath));
 		BatchRootObject->SetStringField(TEXT("class_filter"), ClassFilterText);
 		BatchRootObject->SetBoolField(TEXT("changed_only"), bChangedOnly);
+		BatchRootObject->SetStringField(TEXT("changed_only_strategy"), ChangedOnlyStrategyText);
+		BatchRootObject->SetStringField(TEXT("file_state_cache_path"), BatchChangePlan.CacheFilePath);
+		BatchRootObject->SetBoolField(TEXT("file_state_cache_loaded"), BatchChangePlan.bCacheLoaded);
+		BatchRootObject->SetBoolField(TEXT("file_state_cache_saved"), bFileStateCacheSaved);
+		BatchRootObject->SetBoolField(TEXT("dependency_index_loaded"), BatchChangePlan.bDependencyIndexLoaded);
+		BatchRootObject->SetNumberField(TEXT("tracked_package_count"), BatchChangePlan.PackageStateByName.Num());
+		BatchRootObject->SetNumberField(TEXT("changed_package_count"), BatchChangePlan.ChangedPackageCount);
+		BatchRootObject->SetNumberField(TEXT("affected_asset_count"), BatchChangePlan.RedumpReasonByObjectPath.Num());
+		BatchRootObject->SetNumberField(TEXT("propagated_edge_count"), BatchChangePlan.VisitedEdgeCount);
+		BatchRootObject->SetNumberField(TEXT("change_plan_ms"), BatchChangePlan.PlanMilliseconds);
+		BatchRootObject->SetBoolField(TEXT("registry_cache_loaded"), RegistryScanReports.Num() > 0 && RegistryScanReports[0].bCacheLoaded);
+		BatchRootObject->SetBoolField(TEXT("registry_scan_skipped"), RegistryScanReports.Num() > 0 && RegistryScanReports[0].bSkippedInProcess);
+		BatchRootObject->SetNumberField(TEXT("registry_changed_file_count"), RegistryScanReports.Num() > 0 ? RegistryScanReports[0].ChangedFileCount : 0);
+		BatchRootObject->SetNumberField(TEXT("registry_scan_ms"), RegistryScanReports.Num() > 0 ? RegistryScanReports[0].ScanMilliseconds : 0.0);
 		BatchRootObject->SetBoolField(TEXT("with_dependencies"), bWithDependencies);
 		BatchRootObject->SetNumberField(TEXT("max_assets"), MaxAssets);
+		BatchRootObject->SetStringField(TEXT("pack_file_path"), BatchPackFilePath);
+		BatchRootObject->SetBoolField(TEXT("pack_committed"), bPackCommitted);
+		BatchRootObject->SetStringField(TEXT("content_store_path"), BatchContentStorePath);
+		BatchRootObject->SetStringField(TEXT("content_store_report_path"), ContentStoreReportFilePath);
+		BatchRootObject->SetNumberField(TEXT("content_reference_count"), ContentStoreReport.ReferenceCount);
+		BatchRootObject->SetNumberField(TEXT("content_blob_count"), ContentStoreReport.LiveBlobCount);
+		BatchRootObject->SetNumberField(TEXT("content_logical_bytes"), static_cast<double>(ContentStoreReport.LogicalBytes));
+		BatchRootObject->SetNumberField(TEXT("content_stored_bytes"), static_cast<double>(ContentStoreReport.StoredBytes));
+		BatchRootObject->SetNumberField(TEXT("content_dedup_ratio"), ContentStoreReport.DedupRatio);
+		BatchRootObject->SetNumberField(TEXT("content_unreferenced_blob_count"), ContentStoreReport.DeletedBlobCount);
 		BatchRootObject->SetBoolField(TEXT("rebuild_index"), bRebuildIndexAfterBatch);
 		BatchRootObject->SetBoolField(TEXT("index_built"), bIndexBuilt);
 				BatchRootObject->SetStringField(TEXT("index_file_path"), IndexFilePath);
@@ -8775,6 +11583,10 @@ int32 UAssetDumpCommandlet::Main(const FString& OriginalCommandLine)
 
 		UE_LOG(LogTemp, Display, TEXT("Saved batch run report JSON: %s"), *ReportFilePath);
 		UE_LOG(LogTemp, Display, TEXT("Batch dump summary - assets:%d, succeeded:%d, skipped:%d, failed:%d"), FoundAssets.Num(), SucceededCount, SkippedCount, FailedCount);
+		if (!bPackCommitted)
+		{
+			return 3;
+		}
 		return FailedCount > 0 ? 2 : 0;
 	}
 	else if (ModeValue.Equals(TEXT("bpgraph"), ESearchCase::IgnoreCase))
@@ -8833,6 +11645,20 @@ int32 UAssetDumpCommandlet::Main(const FString& OriginalCommandLine)
 	return 0;
 }
 
+bool UAssetDumpCommandlet::RebuildDumpIndexFiles(const FString& DumpRootPath, FString& OutAssetIndexFilePath)
+{
+	// IndexFilePath, DependencyIndexFilePath, SectionIndexFilePath는 index 모드와 같은 고정 출력 경로다.
+	FString IndexFilePath;
+	FString DependencyIndexFilePath;
+	FString SectionIndexFilePath;
+	return BuildDumpIndexFiles(
+		DumpRootPath,
+		IndexFilePath,
+		DependencyIndexFilePath,
+		OutAssetIndexFilePath,
+		SectionIndexFilePath);
+}
+
 bool UAssetDumpCommandlet::BuildAssetListJson(const FString& FilterPath, FString& OutJsonText)
 {
 	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
@@ -8949,12 +11775,17 @@ bool UAssetDumpCommandlet::BuildDumpIndexFiles(
 	OutAssetIndexFilePath.Reset();
 	OutSectionIndexFilePath.Reset();
 
+	// IndexBuildLock은 에디터 background rebuild와 다른 호출이 entry cache와 index 파일을 동시에 쓰지 않게 build 전체를 직렬화한다.
+	FCommandletIndexManifestCache& IndexManifestCache = GetCommandletIndexManifestCache();
+	FScopeLock IndexBuildLock(&IndexManifestCache.BuildLock);
+
 	// NormalizedDumpRootPath는 인덱스 생성 대상 dump 루트 절대 경로다.
 	const FString NormalizedDumpRootPath = FPaths::ConvertRelativePathToFull(DumpRootPath);
 
 	// ManifestFilePathArray는 dump 루트 아래에서 찾은 manifest.json 전체 목록이다.
 	TArray<FString> ManifestFilePathArray;
 	IFileManager::Get().FindFilesRecursive(ManifestFilePathArray, *NormalizedDumpRootPath, TEXT("manifest.json"), true, false);
+	ADumpPack::FindPackedFiles(NormalizedDumpRootPath, TEXT("manifest.json"), ManifestFilePathArray);
 
 	// AssetEntryArray는 index.json 의 assets 배열 누적값이다.
 	TArray<TSharedPtr<FJsonValue>> AssetEntryArray;
@@ -8992,6 +11823,9 @@ bool UAssetDumpCommandlet::BuildDumpIndexFiles(
 		// SelectedGeneratedTimeByObjectPath는 자산 경로별 최신 generated_time 비교 기준이다.
 	TMap<FString, FString> SelectedGeneratedTimeByObjectPath;
 
+	// SelectedManifestRootObjectByObjectPath는 선택된 manifest의 역직렬화 결과이며 두 번째 pass가 다시 읽지 않게 한다.
+	TMap<FString, TSharedPtr<FJsonObject>> SelectedManifestRootObjectByObjectPath;
+
 	// ValidManifestCountByObjectPath는 object_path별 valid manifest 수를 집계한다.
 	TMap<FString, int32> ValidManifestCountByObjectPath;
 
@@ -9027,6 +11861,7 @@ bool UAssetDumpCommandlet::BuildDumpIndexFiles(
 		{
 			SelectedGeneratedTimeByObjectPath.Add(ObjectPathText, GeneratedTimeText);
 			SelectedManifestPathByObjectPath.Add(ObjectPathText, ManifestFilePath);
+			SelectedManifestRootObjectByObjectPath.Add(ObjectPathText, ManifestRootObject);
 		}
 		}
 
@@ -9035,253 +11870,136 @@ bool UAssetDumpCommandlet::BuildDumpIndexFiles(
 		DuplicateManifestCount += FMath::Max(0, ValidManifestCountPair.Value - 1);
 	}
 
-	for (const TPair<FString, FString>& SelectedManifestPair : SelectedManifestPathByObjectPath)
+	// IndexManifestCache는 같은 process 직전 build의 manifest별 entry다. dump root가 바뀌면 비운다.
+	if (IndexManifestCache.DumpRootPath != NormalizedDumpRootPath)
 	{
-		// ManifestFilePath는 최신 manifest selection 결과다.
-		const FString& ManifestFilePath = SelectedManifestPair.Value;
-
-		// ManifestRootObject는 manifest.json 역직렬화 결과다.
-		TSharedPtr<FJsonObject> ManifestRootObject;
-		if (!LoadCommandletJsonObjectFromFile(ManifestFilePath, ManifestRootObject))
-		{
-			continue;
-		}
-
-		// AssetObject는 manifest.asset object다.
-		const TSharedPtr<FJsonObject> AssetObject = GetCommandletNestedObjectField(ManifestRootObject, TEXT("asset"));
-
-		// RunObject는 manifest.run object다.
-		const TSharedPtr<FJsonObject> RunObject = GetCommandletNestedObjectField(ManifestRootObject, TEXT("run"));
-
-		// AssetKeyText는 index entry 식별자다.
-		const FString AssetKeyText = GetCommandletStringFieldOrEmpty(AssetObject, TEXT("asset_key"));
-
-		// ObjectPathText는 현재 dump가 대표하는 자산 경로다.
-		const FString ObjectPathText = GetCommandletStringFieldOrEmpty(AssetObject, TEXT("object_path"));
-
-		// AssetClassText는 자산 클래스 이름이다.
-		const FString AssetClassText = GetCommandletStringFieldOrEmpty(AssetObject, TEXT("asset_class"));
-
-		// DumpStatusText는 manifest 기준 최종 dump 상태다.
-		const FString DumpStatusText = GetCommandletStringFieldOrEmpty(ManifestRootObject, TEXT("dump_status"));
-
-		// GeneratedTimeText는 manifest 생성 시각이다.
-		const FString GeneratedTimeText = GetCommandletStringFieldOrEmpty(ManifestRootObject, TEXT("generated_time"));
-
-		// FingerprintText는 최신성 판정에 사용하는 run fingerprint다.
-		const FString FingerprintText = GetCommandletStringFieldOrEmpty(RunObject, TEXT("fingerprint"));
-
-		// ManifestRelativePath는 프로젝트 루트 기준 상대 manifest 경로다.
-		const FString ManifestRelativePath = MakeCommandletProjectRelativePath(ManifestFilePath);
-
-		// DumpDirectoryPath는 manifest 파일이 들어 있는 dump 폴더 경로다.
-		const FString DumpDirectoryPath = FPaths::GetPath(ManifestFilePath);
-
-		// DigestFilePath는 같은 dump 폴더 안 digest.json 경로다.
-		const FString DigestFilePath = FPaths::Combine(DumpDirectoryPath, TEXT("digest.json"));
-
-		// DigestRelativePath는 index entry에 기록할 상대 digest 경로다.
-		const FString DigestRelativePath = IFileManager::Get().FileExists(*DigestFilePath)
-			? MakeCommandletProjectRelativePath(DigestFilePath)
-			: FString();
-
-		// AssetEntryObject는 index.json assets 배열에 들어갈 항목이다.
-		TSharedRef<FJsonObject> AssetEntryObject = MakeShared<FJsonObject>();
-		AssetEntryObject->SetStringField(TEXT("asset_key"), AssetKeyText);
-		AssetEntryObject->SetStringField(TEXT("object_path"), ObjectPathText);
-		AssetEntryObject->SetStringField(TEXT("asset_class"), AssetClassText);
-		AssetEntryObject->SetStringField(TEXT("dump_status"), DumpStatusText);
-		AssetEntryObject->SetStringField(TEXT("generated_time"), GeneratedTimeText);
-		AssetEntryObject->SetStringField(TEXT("fingerprint"), FingerprintText);
-		AssetEntryObject->SetStringField(TEXT("manifest_path"), ManifestRelativePath);
-				AssetEntryObject->SetStringField(TEXT("digest_path"), DigestRelativePath);
-		AssetEntryArray.Add(MakeShared<FJsonValueObject>(AssetEntryObject));
-
-		// AssetIndexEntryObject는 selected manifest와 실제 output 파일에서 만든 v0.9.0 entry다.
-		TSharedPtr<FJsonObject> AssetIndexEntryObject;
-		bool bAssetIndexEntryReady = false;
-				if (BuildCommandletAssetIndexEntry(ManifestFilePath, NormalizedDumpRootPath, AssetIndexEntryObject, bAssetIndexEntryReady)
-			&& AssetIndexEntryObject.IsValid())
-		{
-			AssetIndexEntryObjectArray.Add(AssetIndexEntryObject);
-			if (bAssetIndexEntryReady)
-			{
-				++ReadyAssetCount;
-			}
-			else
-			{
-				++IncompleteAssetCount;
-			}
-
-			if (!BuildCommandletSectionIndexEntries(
-				AssetIndexEntryObject,
-				NormalizedDumpRootPath,
-				SectionIndexEntryObjectArray,
-				SectionIndexSymbolObjectArray))
-			{
-				return false;
-			}
-		}
-
-				// Material profile의 typed Renderer Resource를 기존 dependency_index relation shape로 추가한다.
-		const FString MainDumpFileName = ResolveCommandletMainDumpFileName(
-			RunObject,
-			GetCommandletStringArrayField(ManifestRootObject, TEXT("generated_files")));
-		const FString MainDumpFilePath = MainDumpFileName.IsEmpty()
-			? FString()
-			: FPaths::Combine(DumpDirectoryPath, MainDumpFileName);
-		TSharedPtr<FJsonObject> MainDumpRootObject;
-		if (!MainDumpFilePath.IsEmpty()
-			&& IFileManager::Get().FileExists(*MainDumpFilePath)
-			&& LoadCommandletJsonObjectFromFile(MainDumpFilePath, MainDumpRootObject))
-		{
-			const TSharedPtr<FJsonObject> EntityEvidenceObject = GetCommandletNestedObjectField(MainDumpRootObject, TEXT("entity_evidence"));
-			if (GetCommandletStringFieldOrEmpty(EntityEvidenceObject, TEXT("adapter_profile")) == TEXT("niagara_material_v1"))
-			{
-				const TArray<TSharedPtr<FJsonValue>>* EntityValueArray = nullptr;
-				if (EntityEvidenceObject.IsValid()
-					&& EntityEvidenceObject->TryGetArrayField(TEXT("entities"), EntityValueArray)
-					&& EntityValueArray)
-				{
-					const FString SourceFileText = MakeCommandletDumpRootRelativePath(MainDumpFilePath, NormalizedDumpRootPath);
-					for (int32 EntityIndex = 0; EntityIndex < EntityValueArray->Num(); ++EntityIndex)
-					{
-						const TSharedPtr<FJsonValue>& EntityValue = (*EntityValueArray)[EntityIndex];
-						const TSharedPtr<FJsonObject> EntityObject = EntityValue.IsValid() ? EntityValue->AsObject() : nullptr;
-						if (GetCommandletStringFieldOrEmpty(EntityObject, TEXT("entity_kind")) != TEXT("niagara_renderer_resource"))
-						{
-							continue;
-						}
-
-						const TSharedPtr<FJsonObject> FacetsObject = GetCommandletNestedObjectField(EntityObject, TEXT("facets"));
-						const TSharedPtr<FJsonObject> ResourceFacetObject = GetCommandletNestedObjectField(FacetsObject, TEXT("niagara_renderer_resource"));
-						const TSharedPtr<FJsonObject> ResourceDataObject = GetCommandletNestedObjectField(ResourceFacetObject, TEXT("data"));
-						const FString TargetPathText = GetCommandletStringFieldOrEmpty(ResourceDataObject, TEXT("object_path"));
-						const FString ReasonText = GetCommandletStringFieldOrEmpty(ResourceDataObject, TEXT("reference_role"));
-						if (!TargetPathText.StartsWith(TEXT("/"))
-							|| (ReasonText != TEXT("renderer_material") && ReasonText != TEXT("renderer_mesh")))
-						{
-							continue;
-						}
-
-						const FString SourcePathText = SourceFileText + FString::Printf(TEXT("#/entity_evidence/entities/%d"), EntityIndex);
-						const FString RelationUniqueKey = FString::Printf(
-							TEXT("%s|%s|%s|hard|%s"),
-							*ObjectPathText,
-							*TargetPathText,
-							*ReasonText,
-							*SourcePathText);
-						if (UniqueRelationKeys.Contains(RelationUniqueKey))
-						{
-							continue;
-						}
-						UniqueRelationKeys.Add(RelationUniqueKey);
-
-						TSharedRef<FJsonObject> RelationEntryObject = MakeShared<FJsonObject>();
-						RelationEntryObject->SetStringField(TEXT("from"), ObjectPathText);
-						RelationEntryObject->SetStringField(TEXT("to"), TargetPathText);
-						RelationEntryObject->SetStringField(TEXT("reason"), ReasonText);
-						RelationEntryObject->SetStringField(TEXT("strength"), TEXT("hard"));
-						RelationEntryObject->SetStringField(TEXT("source_kind"), TEXT("entity_evidence"));
-						RelationEntryObject->SetStringField(TEXT("source_path"), SourcePathText);
-						RelationEntryArray.Add(MakeShared<FJsonValueObject>(RelationEntryObject));
-					}
-				}
-			}
-		}
-
-		// ReferencesFilePath는 dependency_index 생성에 사용할 references.json 경로다.
-		const FString ReferencesFilePath = FPaths::Combine(DumpDirectoryPath, TEXT("references.json"));
-		if (!IFileManager::Get().FileExists(*ReferencesFilePath))
-		{
-			continue;
-		}
-
-		// ReferencesRootObject는 references.json 역직렬화 결과다.
-		TSharedPtr<FJsonObject> ReferencesRootObject;
-		if (!LoadCommandletJsonObjectFromFile(ReferencesFilePath, ReferencesRootObject))
-		{
-			continue;
-		}
-
-		// ReferencesObject는 references 섹션 object다.
-		const TSharedPtr<FJsonObject> ReferencesObject = GetCommandletNestedObjectField(ReferencesRootObject, TEXT("references"));
-		if (!ReferencesObject.IsValid())
-		{
-			continue;
-		}
-
-		for (const bool bIsHardReference : { true, false })
-		{
-			// ArrayFieldName은 hard/soft 중 현재 읽을 references 배열 이름이다.
-			const TCHAR* ArrayFieldName = bIsHardReference ? TEXT("hard") : TEXT("soft");
-
-			// ReferenceValueArray는 현재 강도에 해당하는 references 배열이다.
-			const TArray<TSharedPtr<FJsonValue>>* ReferenceValueArray = nullptr;
-			if (!ReferencesObject->TryGetArrayField(ArrayFieldName, ReferenceValueArray) || !ReferenceValueArray)
-			{
-				continue;
-			}
-
-			for (const TSharedPtr<FJsonValue>& ReferenceValue : *ReferenceValueArray)
-			{
-				if (!ReferenceValue.IsValid())
-				{
-					continue;
-				}
+		IndexManifestCache.DumpRootPath = NormalizedDumpRootPath;
+		IndexManifestCache.EntryByManifestPath.Reset();
+	}
 
-				// ReferenceObject는 reference 한 건의 object다.
-				const TSharedPtr<FJsonObject> ReferenceObject = ReferenceValue->AsObject();
-				if (!ReferenceObject.IsValid())
-				{
-					continue;
-				}
+	// NextEntryByManifestPath는 이번 build가 선택한 manifest entry만 담아 build 성공 후 cache를 교체한다.
+	TMap<FString, FCommandletIndexManifestEntry> NextEntryByManifestPath;
 
-				// TargetPathText는 relation 의 도착 자산 경로다.
-				const FString TargetPathText = GetCommandletStringFieldOrEmpty(ReferenceObject, TEXT("path"));
-				if (!TargetPathText.StartsWith(TEXT("/")))
-				{
-					continue;
-				}
+	// ReusedManifestCount는 입력 stamp가 같아 직전 entry를 재사용한 manifest 수, ParsedManifestCount는 새로 읽은 수다.
+	int32 ReusedManifestCount = 0;
+	int32 ParsedManifestCount = 0;
 
-				// ReasonText는 reference source를 그대로 relation reason으로 사용한다.
-				const FString ReasonText = GetCommandletStringFieldOrEmpty(ReferenceObject, TEXT("source"));
+	for (const TPair<FString, FString>& SelectedManifestPair : SelectedManifestPathByObjectPath)
+	{
+		// ManifestFilePath는 최신 manifest selection 결과다.
+		const FString& ManifestFilePath = SelectedManifestPair.Value;
 
-				// SourcePathText는 관계를 찾은 세부 위치 설명이다.
-				const FString SourcePathText = GetCommandletStringFieldOrEmpty(ReferenceObject, TEXT("source_path"));
+		// ManifestRootObject는 selection pass에서 읽은 manifest.json 역직렬화 결과다.
+		const TSharedPtr<FJsonObject> ManifestRootObject = SelectedManifestRootObjectByObjectPath.FindRef(SelectedManifestPair.Key);
+		if (!ManifestRootObject.IsValid())
+		{
+			continue;
+		}
 
-				// StrengthText는 hard/soft 강도 문자열이다.
-				const FString StrengthText = bIsHardReference ? TEXT("hard") : TEXT("soft");
+		// ManifestEntry는 이 manifest가 index 파일들에 기여하는 entry 묶음이다.
+		FCommandletIndexManifestEntry ManifestEntry;
+		ManifestEntry.InputStamp = BuildCommandletIndexManifestInputStamp(ManifestFilePath, ManifestRootObject);
+		const FCommandletIndexManifestEntry* CachedManifestEntry = IndexManifestCache.EntryByManifestPath.Find(ManifestFilePath);
+		if (CachedManifestEntry && CachedManifestEntry->InputStamp == ManifestEntry.InputStamp)
+		{
+			ManifestEntry = *CachedManifestEntry;
+			++ReusedManifestCount;
+		}
+		else
+		{
+			++ParsedManifestCount;
 
-				// SourceKindText는 relation source_kind 정규화 값이다.
-				const FString SourceKindText = ResolveCommandletReferenceSourceKindText(ReasonText);
+			// AssetObject는 manifest.asset object다.
+			const TSharedPtr<FJsonObject> AssetObject = GetCommandletNestedObjectField(ManifestRootObject, TEXT("asset"));
 
-				// RelationUniqueKey는 중복 relation 누적을 막기 위한 고정 키다.
-				const FString RelationUniqueKey = FString::Printf(
-					TEXT("%s|%s|%s|%s|%s"),
-					*ObjectPathText,
-					*TargetPathText,
-					*ReasonText,
-					*StrengthText,
-					*SourcePathText);
-				if (UniqueRelationKeys.Contains(RelationUniqueKey))
+			// RunObject는 manifest.run object다.
+			const TSharedPtr<FJsonObject> RunObject = GetCommandletNestedObjectField(ManifestRootObject, TEXT("run"));
+
+			// ObjectPathText는 현재 dump가 대표하는 자산 경로다.
+			const FString ObjectPathText = GetCommandletStringFieldOrEmpty(AssetObject, TEXT("object_path"));
+
+			// DumpDirectoryPath는 manifest 파일이 들어 있는 dump 폴더 경로다.
+			const FString DumpDirectoryPath = FPaths::GetPath(ManifestFilePath);
+
+			// DigestFilePath는 같은 dump 폴더 안 digest.json 경로다.
+			const FString DigestFilePath = FPaths::Combine(DumpDirectoryPath, TEXT("digest.json"));
+
+			// AssetEntryObject는 index.json assets 배열에 들어갈 항목이다.
+			TSharedRef<FJsonObject> AssetEntryObject = MakeShared<FJsonObject>();
+			AssetEntryObject->SetStringField(TEXT("asset_key"), GetCommandletStringFieldOrEmpty(AssetObject, TEXT("asset_key")));
+			AssetEntryObject->SetStringField(TEXT("object_path"), ObjectPathText);
+			AssetEntryObject->SetStringField(TEXT("asset_class"), GetCommandletStringFieldOrEmpty(AssetObject, TEXT("asset_class")));
+			AssetEntryObject->SetStringField(TEXT("dump_status"), GetCommandletStringFieldOrEmpty(ManifestRootObject, TEXT("dump_status")));
+			AssetEntryObject->SetStringField(TEXT("generated_time"), GetCommandletStringFieldOrEmpty(ManifestRootObject, TEXT("generated_time")));
+			AssetEntryObject->SetStringField(TEXT("fingerprint"), GetCommandletStringFieldOrEmpty(RunObject, TEXT("fingerprint")));
+			AssetEntryObject->SetStringField(TEXT("manifest_path"), MakeCommandletProjectRelativePath(ManifestFilePath));
+			AssetEntryObject->SetStringField(
+				TEXT("digest_path"),
+				ADumpJson::DoesJsonFileExist(DigestFilePath) ? MakeCommandletProjectRelativePath(DigestFilePath) : FString());
+			ManifestEntry.LegacyAssetEntryObject = AssetEntryObject;
+
+			// AssetIndexEntryObject는 selected manifest와 실제 output 파일에서 만든 v0.9.0 entry다.
+			TSharedPtr<FJsonObject> AssetIndexEntryObject;
+			bool bAssetIndexEntryReady = false;
+			if (BuildCommandletAssetIndexEntry(ManifestFilePath, NormalizedDumpRootPath, AssetIndexEntryObject, bAssetIndexEntryReady)
+				&& AssetIndexEntryObject.IsValid())
+			{
+				ManifestEntry.AssetIndexEntryObject = AssetIndexEntryObject;
+				ManifestEntry.bAssetIndexEntryReady = bAssetIndexEntryReady;
+				if (!BuildCommandletSectionIndexEntries(
+					AssetIndexEntryObject,
+					NormalizedDumpRootPath,
+					ManifestEntry.SectionEntryObjects,
+					ManifestEntry.SymbolEntryObjects))
 				{
-					continue;
+					return false;
 				}
+			}
+
+			// Material profile의 typed Renderer Resource를 기존 dependency_index relation shape로 추가한다.
+			const FString MainDumpFileName = ResolveCommandletMainDumpFileName(
+				RunObject,
+				GetCommandletStringArrayField(ManifestRootObject, TEXT("generated_files")));
+			AppendCommandletEntityEvidenceRelations(
+				ObjectPathText,
+				MainDumpFileName.IsEmpty() ? FString() : FPaths::Combine(DumpDirectoryPath, MainDumpFileName),
+				NormalizedDumpRootPath,
+				ManifestEntry.RelationEntries);
 
-				UniqueRelationKeys.Add(RelationUniqueKey);
+			// references.json hard/soft 배열을 dependency_index relation으로 추가한다.
+			AppendCommandletReferenceRelations(
+				ObjectPathText,
+				FPaths::Combine(DumpDirectoryPath, TEXT("references.json")),
+				ManifestEntry.RelationEntries);
+		}
 
-				// RelationEntryObject는 dependency_index.json 에 추가할 relation object다.
-				TSharedRef<FJsonObject> RelationEntryObject = MakeShared<FJsonObject>();
-				RelationEntryObject->SetStringField(TEXT("from"), ObjectPathText);
-				RelationEntryObject->SetStringField(TEXT("to"), TargetPathText);
-				RelationEntryObject->SetStringField(TEXT("reason"), ReasonText);
-				RelationEntryObject->SetStringField(TEXT("strength"), StrengthText);
-				RelationEntryObject->SetStringField(TEXT("source_kind"), SourceKindText);
-				RelationEntryObject->SetStringField(TEXT("source_path"), SourcePathText);
-				RelationEntryArray.Add(MakeShared<FJsonValueObject>(RelationEntryObject));
+		AssetEntryArray.Add(MakeShared<FJsonValueObject>(ManifestEntry.LegacyAssetEntryObject.ToSharedRef()));
+		if (ManifestEntry.AssetIndexEntryObject.IsValid())
+		{
+			AssetIndexEntryObjectArray.Add(ManifestEntry.AssetIndexEntryObject);
+			if (ManifestEntry.bAssetIndexEntryReady)
+			{
+				++ReadyAssetCount;
+			}
+			else
+			{
+				++IncompleteAssetCount;
+			}
+			SectionIndexEntryObjectArray.Append(ManifestEntry.SectionEntryObjects);
+			SectionIndexSymbolObjectArray.Append(ManifestEntry.SymbolEntryObjects);
+		}
+
+		for (const FCommandletIndexRelationEntry& RelationEntry : ManifestEntry.RelationEntries)
+		{
+			if (UniqueRelationKeys.Contains(RelationEntry.UniqueKey))
+			{
+				continue;
 			}
+			UniqueRelationKeys.Add(RelationEntry.UniqueKey);
+			RelationEntryArray.Add(MakeShared<FJsonValueObject>(RelationEntry.RelationObject.ToSharedRef()));
 		}
+
+		NextEntryByManifestPath.Add(ManifestFilePath, MoveTemp(ManifestEntry));
 	}
 
 	Algo::SortBy(
@@ -9420,6 +12138,8 @@ bool UAssetDumpCommandlet::BuildDumpIndexFiles(
 	AssetIndexRootObject->SetNumberField(TEXT("incomplete_asset_count"), IncompleteAssetCount);
 	AssetIndexRootObject->SetNumberField(TEXT("duplicate_manifest_count"), DuplicateManifestCount);
 		AssetIndexRootObject->SetNumberField(TEXT("malformed_manifest_count"), MalformedManifestCount);
+	AssetIndexRootObject->SetNumberField(TEXT("reused_manifest_count"), ReusedManifestCount);
+	AssetIndexRootObject->SetNumberField(TEXT("parsed_manifest_count"), ParsedManifestCount);
 	AssetIndexRootObject->SetArrayField(TEXT("assets"), AssetIndexEntryArray);
 
 	// SectionIndexRootObject는 additive section_index_v1 최상위 object다.
@@ -9465,6 +12185,29 @@ bool UAssetDumpCommandlet::BuildDumpIndexFiles(
 		return false;
 	}
 
+	// SelectorIndexEntryObjectArray는 asset_index.json assets 배열과 같은 순서의 entry object다.
+	TArray<TSharedPtr<FJsonObject>> SelectorIndexEntryObjectArray;
+	SelectorIndexEntryObjectArray.Reserve(AssetIndexEntryArray.Num());
+	for (const TSharedPtr<FJsonValue>& AssetIndexEntryValue : AssetIndexEntryArray)
+	{
+		SelectorIndexEntryObjectArray.Add(AssetIndexEntryValue->AsObject());
+	}
+
+	// SelectorIndexJsonText는 저장한 asset/section index byte span을 가리키는 additive selector_index.json 문자열이다.
+	FString SelectorIndexJsonText;
+	if (!ADumpReadQuery::BuildSelectorIndexJson(
+		NormalizedDumpRootPath,
+		AssetIndexJsonText,
+		SectionIndexJsonText,
+		SelectorIndexEntryObjectArray,
+		SectionIndexEntryObjectArray,
+		GeneratedTimeText,
+		SelectorIndexJsonText)
+		|| !SaveJsonToFile(FPaths::Combine(NormalizedDumpRootPath, TEXT("selector_index.json")), SelectorIndexJsonText))
+	{
+		return false;
+	}
+
 	// EntityIndexFilePath는 additive entity_index_v1 output이며 기존 네 index의 의미를 변경하지 않는다.
 	FString EntityIndexFilePath;
 	FString EntityIndexErrorCode;
@@ -9478,6 +12221,51 @@ bool UAssetDumpCommandlet::BuildDumpIndexFiles(
 		UE_LOG(LogTemp, Error, TEXT("%s: %s"), *EntityIndexErrorCode, *EntityIndexErrorDetail);
 		return false;
 	}
+
+	// SymbolSearchIndexFilePath는 section_index_v1 symbols에서 파생한 additive 전역 inverted index output이다.
+	FString SymbolSearchIndexFilePath;
+	FString SymbolSearchErrorCode;
+	FString SymbolSearchErrorDetail;
+	if (!ADumpSymbolSearch::BuildSymbolSearchIndex(
+		NormalizedDumpRootPath,
+		SymbolSearchIndexFilePath,
+		SymbolSearchErrorCode,
+		SymbolSearchErrorDetail))
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s: %s"), *SymbolSearchErrorCode, *SymbolSearchErrorDetail);
+		return false;
+	}
+
+	// ImpactIndexFilePath는 dependency_index.json에서 파생한 additive SCC/closure impact index output이다.
+	FString ImpactIndexFilePath;
+	FString ImpactErrorCode;
+	FString ImpactErrorDetail;
+	if (!ADumpImpactGraph::BuildImpactIndex(
+		NormalizedDumpRootPath,
+		ImpactIndexFilePath,
+		ImpactErrorCode,
+		ImpactErrorDetail))
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s: %s"), *ImpactErrorCode, *ImpactErrorDetail);
+		return false;
+	}
+
+	// InputIndexFilePath는 section_index_v1 input_summary에서 파생한 additive 전역 input binding/충돌 index output이다.
+	FString InputIndexFilePath;
+	FString InputIndexErrorCode;
+	FString InputIndexErrorDetail;
+	if (!ADumpInputIndex::BuildInputBindingIndex(
+		NormalizedDumpRootPath,
+		InputIndexFilePath,
+		InputIndexErrorCode,
+		InputIndexErrorDetail))
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s: %s"), *InputIndexErrorCode, *InputIndexErrorDetail);
+		return false;
+	}
+
+	// 모든 index 파일 저장이 끝난 뒤에만 entry cache를 교체한다. 중간 실패 시 다음 build가 이번 entry를 재사용하지 않는다.
+	IndexManifestCache.EntryByManifestPath = MoveTemp(NextEntryByManifestPath);
 	return true;
 }
 
@@ -10319,6 +13107,20 @@ bool UAssetDumpCommandlet::BuildValidationJson(const FString& CommandLine, FStri
 		++OutFailureCount;
 	}
 
+	int32 SelectorIndexAssetCount = 0;
+	int32 SelectorIndexSectionCount = 0;
+	FString SelectorIndexContractDetail;
+	const bool bSelectorIndexContractPassed = bSectionIndexContractPassed
+		&& ADumpReadQuery::ValidateSelectorIndexContract(
+			ValidationRootPath,
+			SelectorIndexAssetCount,
+			SelectorIndexSectionCount,
+			SelectorIndexContractDetail);
+	if (!bSelectorIndexContractPassed)
+	{
+		++OutFailureCount;
+	}
+
 	// SectionSmokeFailureCount는 자산 비의존 섹션 선택 스모크 검사 실패 개수다.
 	int32 SectionSmokeFailureCount = 0;
 
@@ -10349,6 +13151,8 @@ bool UAssetDumpCommandlet::BuildValidationJson(const FString& CommandLine, FStri
 	ValidationRootObject->SetNumberField(TEXT("section_index_section_count"), SectionIndexSectionCount);
 	ValidationRootObject->SetNumberField(TEXT("section_index_symbol_count"), SectionIndexSymbolCount);
 	ValidationRootObject->SetStringField(TEXT("section_index_contract_detail"), SectionIndexContractDetail);
+	ValidationRootObject->SetBoolField(TEXT("selector_index_contract_passed"), bSelectorIndexContractPassed);
+	ValidationRootObject->SetStringField(TEXT("selector_index_contract_detail"), SelectorIndexContractDetail);
 	ValidationRootObject->SetObjectField(TEXT("section_selection"), SectionSmokeValidationObject);
 	ValidationRootObject->SetArrayField(TEXT("cases"), ValidationCaseResultArray);
 
@@ -10505,6 +13309,489 @@ bool UAssetDumpCommandlet::BuildValidationFixtureJson(const FString& CommandLine
 	return SerializeJsonObjectText(FixtureRootObject, OutJsonText);
 }
 
+int32 UAssetDumpCommandlet::RunWatchMode(
+	const FString& CommandLine,
+	const FADumpSectionSelection& SectionSelection,
+	const FString& IntentName,
+	const FString& ProfileName,
+	const FString& SectionSource)
+{
+	// WatchRootPath는 감시하고 다시 덤프할 long package root다. batchdump와 같은 -Root/-Filter 인자를 쓴다.
+	FString WatchRootPath;
+	if (!GetCmdValue(CommandLine, TEXT("Root="), WatchRootPath)
+		&& !GetCmdValue(CommandLine, TEXT("Filter="), WatchRootPath))
+	{
+		WatchRootPath = TEXT("/Game");
+	}
+	WatchRootPath.RemoveFromEnd(TEXT("/"));
+
+	// DumpRootPath는 최초 batchdump와 같은 규칙으로 정한 dump root 절대 경로다.
+	FString DumpRootPath;
+	if (!GetCmdValue(CommandLine, TEXT("DumpRoot="), DumpRootPath))
+	{
+		DumpRootPath = FPaths::Combine(ADumpJson::ResolveWritableDefaultDumpRootDirectory(), TEXT("BPDump"));
+	}
+	DumpRootPath = FPaths::ConvertRelativePathToFull(DumpRootPath);
+
+	// StatusFilePath는 CI가 따라잡음 여부를 확인할 heartbeat 파일 경로다.
+	FString StatusFilePath;
+	if (!GetCmdValue(CommandLine, TEXT("StatusFile="), StatusFilePath))
+	{
+		StatusFilePath = FPaths::Combine(DumpRootPath, TEXT("watch_status.json"));
+	}
+	StatusFilePath = FPaths::ConvertRelativePathToFull(StatusFilePath);
+
+	// WatchBatchSize는 한 번에 다시 덤프할 변경 package 상한이다. batch 사이마다 index와 heartbeat가 갱신된다.
+	int32 WatchBatchSize = 16;
+	FParse::Value(*CommandLine, TEXT("WatchBatchSize="), WatchBatchSize);
+	WatchBatchSize = FMath::Max(1, WatchBatchSize);
+
+	// WatchDebounceSeconds는 마지막 변경 뒤 package를 batch에 넣기까지 기다리는 시간이다.
+	float WatchDebounceSeconds = 2.0f;
+	FParse::Value(*CommandLine, TEXT("WatchDebounceSeconds="), WatchDebounceSeconds);
+
+	// WatchIntervalSeconds는 감시 loop sleep 간격이고, HeartbeatSeconds는 변화가 없어도 status를 다시 쓰는 간격이다.
+	float WatchIntervalSeconds = 0.25f;
+	FParse::Value(*CommandLine, TEXT("WatchIntervalSeconds="), WatchIntervalSeconds);
+	WatchIntervalSeconds = FMath::Max(0.01f, WatchIntervalSeconds);
+	float HeartbeatSeconds = 1.0f;
+	FParse::Value(*CommandLine, TEXT("HeartbeatSeconds="), HeartbeatSeconds);
+
+	// WatchSeconds는 감시 시간 상한이다. 0 이하면 종료 요청까지 계속 감시한다.
+	float WatchSeconds = 0.0f;
+	FParse::Value(*CommandLine, TEXT("WatchSeconds="), WatchSeconds);
+
+	// bInitialBatch는 감시 전에 ChangedOnly batchdump로 dump root를 먼저 맞출지 여부다.
+	bool bInitialBatch = true;
+	FParse::Bool(*CommandLine, TEXT("WatchInitialBatch="), bInitialBatch);
+
+	// bForcePoll은 directory watcher 대신 package 파일 stat 비교로 변경을 찾을지 여부다.
+	bool bForcePoll = false;
+	FParse::Bool(*CommandLine, TEXT("WatchPoll="), bForcePoll);
+
+	// bRebuildIndex는 변경 batch마다 index를 갱신할지 여부다. 바뀌지 않은 manifest entry는 직전 build 결과를 재사용한다.
+	bool bRebuildIndex = true;
+	FParse::Bool(*CommandLine, TEXT("RebuildIndex="), bRebuildIndex);
+
+	// bUsePack과 bDedupSections는 batchdump와 같은 저장 방식으로 재덤프할지 여부다.
+	bool bUsePack = false;
+	FParse::Bool(*CommandLine, TEXT("Pack="), bUsePack);
+	bool bDedupSections = false;
+	FParse::Bool(*CommandLine, TEXT("DedupSections="), bDedupSections);
+	const FString WatchPackFilePath = bUsePack ? FPaths::Combine(DumpRootPath, ADumpPack::GetPackFileName()) : FString();
+	const FString WatchContentStorePath = bDedupSections ? FPaths::Combine(DumpRootPath, ADumpContentStore::GetContentStoreDirectoryName()) : FString();
+
+	// ClassFilterArray는 변경 package 안에서 다시 덤프할 자산 클래스 필터다.
+	FString ClassFilterText;
+	GetCmdValue(CommandLine, TEXT("ClassFilter="), ClassFilterText);
+	const TArray<FString> ClassFilterArray = ParseCommandletListValue(ClassFilterText);
+
+	// WatchDirectoryPath는 root package 경로에 대응하는 content 폴더 절대 경로다.
+	FString WatchDirectoryPath;
+	if (!FPackageName::TryConvertLongPackageNameToFilename(WatchRootPath + TEXT("/"), WatchDirectoryPath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("ADUMP_WATCH_ROOT_INVALID: -Root=%s is not a mounted package path."), *WatchRootPath);
+		return 1;
+	}
+	WatchDirectoryPath = FPaths::ConvertRelativePathToFull(WatchDirectoryPath);
+
+	FCommandletWatchQueue WatchQueue;
+	FCommandletWatchStatus WatchStatus;
+	WatchStatus.DumpRootPath = DumpRootPath;
+	WatchStatus.RootPath = WatchRootPath;
+	WatchStatus.WatchedDirectoryArray.Add(WatchDirectoryPath);
+	WatchStatus.StartedTimeText = FDateTime::UtcNow().ToIso8601();
+
+	// EnqueueDirectoryPackages는 rescan 요청 시 폴더 아래 package 전부를 대기 목록에 넣는다. fingerprint가 같은 자산은 재덤프 단계에서 skip된다.
+	auto EnqueueDirectoryPackages = [&WatchQueue, &WatchRootPath](const FString& InDirectoryPath, double InEventSeconds)
+	{
+		TMap<FString, FString> RescanStampByFilePath;
+		CollectWatchPackageFileStamps(InDirectoryPath, RescanStampByFilePath);
+		for (const TPair<FString, FString>& RescanPair : RescanStampByFilePath)
+		{
+			FString RescanPackageName;
+			if (TryConvertWatchFileToPackageName(RescanPair.Key, WatchRootPath, RescanPackageName))
+			{
+				EnqueueCommandletWatchChange(WatchQueue, RescanPackageName, RescanPair.Key, InEventSeconds);
+			}
+		}
+	};
+
+	// 최초 batch 중 바뀐 파일도 놓치지 않도록 감시를 batch 전에 등록한다. commandlet에는 engine tick이 없으므로 watcher는 loop에서 직접 Tick한다.
+	FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	IDirectoryWatcher* DirectoryWatcher = bForcePoll ? nullptr : DirectoryWatcherModule.Get();
+	FDelegateHandle DirectoryChangedHandle;
+	if (DirectoryWatcher != nullptr)
+	{
+		const bool bRegistered = DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+			WatchDirectoryPath,
+			IDirectoryWatcher::FDirectoryChanged::CreateLambda([&WatchQueue, &WatchRootPath, &EnqueueDirectoryPackages](const TArray<FFileChangeData>& InFileChanges)
+			{
+				const double EventSeconds = FPlatformTime::Seconds();
+				for (const FFileChangeData& FileChange : InFileChanges)
+				{
+					const FString ChangedFilePath = FPaths::ConvertRelativePathToFull(FileChange.Filename);
+					if (FileChange.Action == FFileChangeData::FCA_RescanRequired)
+					{
+						EnqueueDirectoryPackages(ChangedFilePath, EventSeconds);
+						continue;
+					}
+
+					FString ChangedPackageName;
+					if (TryConvertWatchFileToPackageName(ChangedFilePath, WatchRootPath, ChangedPackageName))
+					{
+						EnqueueCommandletWatchChange(WatchQueue, ChangedPackageName, ChangedFilePath, EventSeconds);
+					}
+					else
+					{
+						++WatchQueue.IgnoredEventCount;
+					}
+				}
+			}),
+			DirectoryChangedHandle);
+		if (!bRegistered)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Directory watcher registration failed for %s; falling back to polling."), *WatchDirectoryPath);
+			DirectoryWatcher = nullptr;
+		}
+	}
+	WatchStatus.WatcherKind = DirectoryWatcher != nullptr ? TEXT("directory_watcher") : TEXT("poll");
+
+	// PolledStampByFilePath는 poll 감시의 직전 package 파일 stat이다.
+	TMap<FString, FString> PolledStampByFilePath;
+	if (DirectoryWatcher == nullptr)
+	{
+		CollectWatchPackageFileStamps(WatchDirectoryPath, PolledStampByFilePath);
+	}
+
+	if (bInitialBatch)
+	{
+		SaveCommandletWatchStatus(StatusFilePath, WatchQueue, WatchStatus);
+		WatchStatus.InitialBatchExitCode = Main(BuildWatchInitialBatchCommandLine(CommandLine));
+		if (WatchStatus.InitialBatchExitCode != 0 && WatchStatus.InitialBatchExitCode != 2)
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_WATCH_INITIAL_BATCH_FAILED: initial batchdump exited with %d."), WatchStatus.InitialBatchExitCode);
+			if (DirectoryWatcher != nullptr)
+			{
+				DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(WatchDirectoryPath, DirectoryChangedHandle);
+			}
+			WatchStatus.StateText = TEXT("stopped");
+			SaveCommandletWatchStatus(StatusFilePath, WatchQueue, WatchStatus);
+			return WatchStatus.InitialBatchExitCode;
+		}
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+	WatchStatus.bInitialBatchDone = true;
+	WatchStatus.StateText = TEXT("watching");
+	WatchStatus.LastCaughtUpTimeText = FDateTime::UtcNow().ToIso8601();
+	SaveCommandletWatchStatus(StatusFilePath, WatchQueue, WatchStatus);
+	UE_LOG(LogTemp, Display, TEXT("Watching %s (%s) for dump root %s; status: %s"), *WatchDirectoryPath, *WatchStatus.WatcherKind, *DumpRootPath, *StatusFilePath);
+
+	// HasExistingWatchDump는 watch 인자로 계산한 자산 출력 후보에 dump가 이미 있는지 파일시스템 변경 없이 검사한다.
+	auto HasExistingWatchDump = [&CommandLine, &DumpRootPath, &SectionSelection, &IntentName, &ProfileName, &SectionSource](const FString& InObjectPath)
+	{
+		FADumpRunOpts CandidateRunOpts;
+		ConfigureDumpRunOptsFromCommandLine(
+			CommandLine,
+			InObjectPath,
+			BuildBatchAssetOutputDirectoryPath(DumpRootPath, InObjectPath),
+			SectionSelection,
+			IntentName,
+			ProfileName,
+			SectionSource,
+			CandidateRunOpts);
+		return ADumpJson::DoesJsonFileExist(CandidateRunOpts.ResolveOutputFilePathCandidate());
+	};
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	const double WatchStartSeconds = FPlatformTime::Seconds();
+	double LastLoopSeconds = WatchStartSeconds;
+	double LastHeartbeatSeconds = WatchStartSeconds;
+	double LastPollScanSeconds = WatchStartSeconds;
+	bool bWasCaughtUp = true;
+	while (!IsEngineExitRequested())
+	{
+		const double LoopNowSeconds = FPlatformTime::Seconds();
+		if (WatchSeconds > 0.0f && LoopNowSeconds - WatchStartSeconds >= WatchSeconds)
+		{
+			break;
+		}
+
+		// 감시 event를 받아 대기 목록에 넣는다. poll 감시는 직전 stat과 비교해 추가/수정/삭제 파일을 찾는다.
+		const int32 PreviousEventCount = WatchQueue.EventCount;
+		if (DirectoryWatcher != nullptr)
+		{
+			DirectoryWatcher->Tick(static_cast<float>(LoopNowSeconds - LastLoopSeconds));
+		}
+		else if (LoopNowSeconds - LastPollScanSeconds >= FMath::Max(1.0, static_cast<double>(WatchIntervalSeconds)))
+		{
+			TMap<FString, FString> CurrentStampByFilePath;
+			CollectWatchPackageFileStamps(WatchDirectoryPath, CurrentStampByFilePath);
+			for (const TPair<FString, FString>& CurrentPair : CurrentStampByFilePath)
+			{
+				const FString* PreviousStampText = PolledStampByFilePath.Find(CurrentPair.Key);
+				FString PolledPackageName;
+				if ((PreviousStampText == nullptr || *PreviousStampText != CurrentPair.Value)
+					&& TryConvertWatchFileToPackageName(CurrentPair.Key, WatchRootPath, PolledPackageName))
+				{
+					EnqueueCommandletWatchChange(WatchQueue, PolledPackageName, CurrentPair.Key, LoopNowSeconds);
+				}
+			}
+			for (const TPair<FString, FString>& PreviousPair : PolledStampByFilePath)
+			{
+				FString PolledPackageName;
+				if (!CurrentStampByFilePath.Contains(PreviousPair.Key)
+					&& TryConvertWatchFileToPackageName(PreviousPair.Key, WatchRootPath, PolledPackageName))
+				{
+					EnqueueCommandletWatchChange(WatchQueue, PolledPackageName, PreviousPair.Key, LoopNowSeconds);
+				}
+			}
+			PolledStampByFilePath = MoveTemp(CurrentStampByFilePath);
+			LastPollScanSeconds = LoopNowSeconds;
+		}
+		LastLoopSeconds = LoopNowSeconds;
+		if (WatchQueue.EventCount != PreviousEventCount)
+		{
+			WatchStatus.LastChangeTimeText = FDateTime::UtcNow().ToIso8601();
+		}
+
+		TArray<FCommandletWatchPendingPackage> WatchBatch;
+		if (DequeueCommandletWatchBatch(WatchQueue, LoopNowSeconds, WatchDebounceSeconds, WatchBatchSize, WatchBatch) > 0)
+		{
+			const double BatchStartSeconds = FPlatformTime::Seconds();
+			WatchStatus.StateText = TEXT("dumping");
+			WatchStatus.InFlightPackageCount = WatchBatch.Num();
+			WatchStatus.InFlightFirstEventSeconds = WatchBatch[0].FirstEventSeconds;
+			SaveCommandletWatchStatus(StatusFilePath, WatchQueue, WatchStatus);
+
+			// 이전 batch가 load한 package가 남아 있으면 새 파일 대신 메모리 사본을 덤프하므로 먼저 비운다.
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+			// ExistingFilePathArray와 RemovedPackageNameSet은 처리 시점 파일 존재 여부로 나눈 변경 package다.
+			TArray<FString> ExistingFilePathArray;
+			TArray<FString> RemovedFilePathArray;
+			TSet<FString> RemovedPackageNameSet;
+			TArray<UPackage*> StalePackageArray;
+			for (const FCommandletWatchPendingPackage& BatchPackage : WatchBatch)
+			{
+				if (FPaths::FileExists(BatchPackage.FilePath))
+				{
+					ExistingFilePathArray.Add(BatchPackage.FilePath);
+					if (UPackage* LoadedPackage = FindPackage(nullptr, *BatchPackage.PackageName))
+					{
+						StalePackageArray.Add(LoadedPackage);
+					}
+				}
+				else
+				{
+					RemovedFilePathArray.Add(BatchPackage.FilePath);
+					RemovedPackageNameSet.Add(BatchPackage.PackageName);
+				}
+			}
+			if (StalePackageArray.Num() > 0)
+			{
+				FText ReloadErrorText;
+				if (!UPackageTools::ReloadPackages(StalePackageArray, ReloadErrorText, EReloadPackagesInteractionMode::AssumePositive))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("Watch package reload failed: %s"), *ReloadErrorText.ToString());
+				}
+			}
+
+			// 삭제 package는 registry에 남은 마지막 자산 목록으로 dump 폴더를 지우고, 변경 package만 registry에 다시 scan한다.
+			TArray<FString> TargetObjectPathArray;
+			TSet<FString> TargetObjectPathSet;
+			for (const FString& RemovedPackageName : RemovedPackageNameSet)
+			{
+				TArray<FAssetData> RemovedAssetArray;
+				AssetRegistry.GetAssetsByPackageName(*RemovedPackageName, RemovedAssetArray, true);
+				for (const FAssetData& RemovedAssetData : RemovedAssetArray)
+				{
+					// 정규화한 폴더 이름이 같은 다른 자산의 dump를 지우지 않도록 manifest object_path가 삭제 자산일 때만 지운다. manifest는 pack 안에 있어도 읽힌다.
+					const FString RemovedObjectPath = RemovedAssetData.GetObjectPathString();
+					const FString RemovedDumpDirectoryPath = BuildBatchAssetOutputDirectoryPath(DumpRootPath, RemovedObjectPath);
+					if (ADumpJson::LoadManifestObjectPath(FPaths::Combine(RemovedDumpDirectoryPath, TEXT("manifest.json"))) == RemovedObjectPath
+						&& RemoveWatchAssetDump(RemovedDumpDirectoryPath, WatchPackFilePath))
+					{
+						++WatchStatus.RemovedCount;
+						WatchStatus.bIndexDirty = true;
+					}
+				}
+			}
+			// 지운 package가 다음 batch 역참조 조회나 다음 실행의 registry cache load로 돌아오지 않도록 registry 상태에서도 뺀다.
+			ADumpRegistryCache::RemoveDeletedPackageFiles(RemovedFilePathArray, CommandLine);
+			if (ExistingFilePathArray.Num() > 0)
+			{
+				AssetRegistry.ScanFilesSynchronous(ExistingFilePathArray, true);
+			}
+
+			// 변경 package 자산은 모두, 직접 역참조 자산은 이미 dump가 있을 때만 다시 덤프한다. 역참조 자산은 fingerprint가 같으면 skip된다.
+			for (const FCommandletWatchPendingPackage& BatchPackage : WatchBatch)
+			{
+				if (!RemovedPackageNameSet.Contains(BatchPackage.PackageName))
+				{
+					TArray<FAssetData> ChangedAssetArray;
+					AssetRegistry.GetAssetsByPackageName(*BatchPackage.PackageName, ChangedAssetArray, true);
+					for (const FAssetData& ChangedAssetData : ChangedAssetArray)
+					{
+						const FString ChangedObjectPath = ChangedAssetData.GetObjectPathString();
+						if (DoesAssetMatchClassFilter(ChangedAssetData, ClassFilterArray) && !TargetObjectPathSet.Contains(ChangedObjectPath))
+						{
+							TargetObjectPathSet.Add(ChangedObjectPath);
+							TargetObjectPathArray.Add(ChangedObjectPath);
+						}
+					}
+				}
+
+				TArray<FName> ReferencerPackageNameArray;
+				AssetRegistry.GetReferencers(FName(*BatchPackage.PackageName), ReferencerPackageNameArray);
+				for (const FName& ReferencerPackageName : ReferencerPackageNameArray)
+				{
+					TArray<FAssetData> ReferencerAssetArray;
+					AssetRegistry.GetAssetsByPackageName(ReferencerPackageName, ReferencerAssetArray, true);
+					for (const FAssetData& ReferencerAssetData : ReferencerAssetArray)
+					{
+						const FString ReferencerObjectPath = ReferencerAssetData.GetObjectPathString();
+						if (!TargetObjectPathSet.Contains(ReferencerObjectPath) && HasExistingWatchDump(ReferencerObjectPath))
+						{
+							TargetObjectPathSet.Add(ReferencerObjectPath);
+							TargetObjectPathArray.Add(ReferencerObjectPath);
+						}
+					}
+				}
+			}
+			Algo::Sort(TargetObjectPathArray);
+
+			for (const FString& TargetObjectPath : TargetObjectPathArray)
+			{
+				FADumpRunOpts DumpRunOpts;
+				ConfigureDumpRunOptsFromCommandLine(
+					CommandLine,
+					TargetObjectPath,
+					BuildBatchAssetOutputDirectoryPath(DumpRootPath, TargetObjectPath),
+					SectionSelection,
+					IntentName,
+					ProfileName,
+					SectionSource,
+					DumpRunOpts);
+				DumpRunOpts.bSkipIfUpToDate = true;
+				DumpRunOpts.OutputEncoding.PackFilePath = WatchPackFilePath;
+				DumpRunOpts.OutputEncoding.ContentStorePath = WatchContentStorePath;
+
+				FADumpService DumpService;
+				FADumpResult DumpResult;
+				const bool bDumpSucceeded = DumpService.DumpBlueprint(DumpRunOpts, DumpResult);
+				if (bDumpSucceeded && IsCommandletSkipResult(DumpRunOpts, DumpResult))
+				{
+					++WatchStatus.SkippedCount;
+				}
+				else if (bDumpSucceeded && DidCommandletProduceOutputFile(DumpRunOpts.ResolveOutputFilePath()))
+				{
+					++WatchStatus.DumpedCount;
+					WatchStatus.bIndexDirty = true;
+				}
+				else
+				{
+					++WatchStatus.FailedCount;
+					LogCommandletIssues(DumpResult.Issues);
+					UE_LOG(LogTemp, Warning, TEXT("Watch re-dump failed for asset: %s"), *TargetObjectPath);
+				}
+			}
+
+			if (!WatchPackFilePath.IsEmpty())
+			{
+				FString PackErrorCode;
+				FString PackErrorDetail;
+				if (!ADumpPack::CommitPack(WatchPackFilePath, PackErrorCode, PackErrorDetail))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("%s: %s"), *PackErrorCode, *PackErrorDetail);
+				}
+			}
+
+			++WatchStatus.BatchCount;
+			WatchStatus.LastBatchPackageCount = WatchBatch.Num();
+			WatchStatus.LastBatchAssetCount = TargetObjectPathArray.Num();
+			WatchStatus.LastBatchMilliseconds = (FPlatformTime::Seconds() - BatchStartSeconds) * 1000.0;
+
+			if (WatchStatus.bIndexDirty && bRebuildIndex)
+			{
+				WatchStatus.StateText = TEXT("indexing");
+				SaveCommandletWatchStatus(StatusFilePath, WatchQueue, WatchStatus);
+
+				const double IndexStartSeconds = FPlatformTime::Seconds();
+				FString IndexFilePath;
+				FString DependencyIndexFilePath;
+				FString AssetIndexFilePath;
+				FString SectionIndexFilePath;
+				WatchStatus.bLastIndexBuilt = BuildDumpIndexFiles(DumpRootPath, IndexFilePath, DependencyIndexFilePath, AssetIndexFilePath, SectionIndexFilePath);
+				WatchStatus.LastIndexMilliseconds = (FPlatformTime::Seconds() - IndexStartSeconds) * 1000.0;
+				WatchStatus.bIndexDirty = !WatchStatus.bLastIndexBuilt;
+			}
+			else if (!bRebuildIndex)
+			{
+				WatchStatus.bIndexDirty = false;
+			}
+
+			WatchStatus.InFlightPackageCount = 0;
+			WatchStatus.StateText = TEXT("watching");
+			UE_LOG(LogTemp, Display, TEXT("Watch batch %d - packages:%d, assets:%d, queue:%d, batch_ms:%.1f, index_ms:%.1f"),
+				WatchStatus.BatchCount,
+				WatchStatus.LastBatchPackageCount,
+				WatchStatus.LastBatchAssetCount,
+				WatchQueue.PendingByPackageName.Num(),
+				WatchStatus.LastBatchMilliseconds,
+				WatchStatus.LastIndexMilliseconds);
+			SaveCommandletWatchStatus(StatusFilePath, WatchQueue, WatchStatus);
+			LastHeartbeatSeconds = FPlatformTime::Seconds();
+		}
+
+		// 대기 변경을 모두 반영한 순간을 기록해 CI가 last_caught_up_time과 caught_up으로 대기를 끝낼 수 있게 한다.
+		const bool bCaughtUp = IsCommandletWatchCaughtUp(WatchQueue, WatchStatus);
+		if (bCaughtUp && !bWasCaughtUp)
+		{
+			WatchStatus.LastCaughtUpTimeText = FDateTime::UtcNow().ToIso8601();
+			SaveCommandletWatchStatus(StatusFilePath, WatchQueue, WatchStatus);
+			LastHeartbeatSeconds = FPlatformTime::Seconds();
+		}
+		bWasCaughtUp = bCaughtUp;
+
+		if (FPlatformTime::Seconds() - LastHeartbeatSeconds >= HeartbeatSeconds)
+		{
+			SaveCommandletWatchStatus(StatusFilePath, WatchQueue, WatchStatus);
+			LastHeartbeatSeconds = FPlatformTime::Seconds();
+		}
+
+		FPlatformProcess::Sleep(WatchIntervalSeconds);
+	}
+
+	if (DirectoryWatcher != nullptr)
+	{
+		DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(WatchDirectoryPath, DirectoryChangedHandle);
+	}
+
+	FString PackErrorCode;
+	FString PackErrorDetail;
+	const bool bPackClosed = WatchPackFilePath.IsEmpty() || ADumpPack::ClosePack(WatchPackFilePath, PackErrorCode, PackErrorDetail);
+	if (!bPackClosed)
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s: %s"), *PackErrorCode, *PackErrorDetail);
+	}
+
+	WatchStatus.StateText = TEXT("stopped");
+	SaveCommandletWatchStatus(StatusFilePath, WatchQueue, WatchStatus);
+	UE_LOG(LogTemp, Display, TEXT("Watch stopped - batches:%d, dumped:%d, skipped:%d, failed:%d, removed:%d, queue:%d"),
+		WatchStatus.BatchCount,
+		WatchStatus.DumpedCount,
+		WatchStatus.SkippedCount,
+		WatchStatus.FailedCount,
+		WatchStatus.RemovedCount,
+		WatchQueue.PendingByPackageName.Num());
+	if (!bPackClosed)
+	{
+		return 3;
+	}
+	return WatchStatus.FailedCount > 0 ? 2 : 0;
+}
+
 bool UAssetDumpCommandlet::SaveJsonToFile(const FString& OutputFilePath, const FString& JsonText)
 {
 	const FString NormalizedPath = FPaths::ConvertRelativePathToFull(OutputFilePath);
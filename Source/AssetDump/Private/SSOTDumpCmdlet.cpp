@@ -1,4 +1,8 @@
 ﻿// SSOTDumpCmdlet.cpp
+// v0.7.1 - ssot_meta.json stages 항목에 Main 시작 기준 start_ms/end_ms를 기록해 registry_snapshot→assets, cfg_rules→cfg 선후를 검증 가능하게 함(-notime이면 생략)
+// v0.7.0 - -incremental: root 폴더 package 파일 stamp(크기:수정 시각)를 ssot_assets_state.json과 비교해 바뀐 package만 registry에서 다시 읽고 ssot_assets_delta.json(added/modified/removed)을 전체 ssot_assets.json과 함께 기록. -asset_roots=로 목록 mount root 제한
+// v0.6.0 - registry snapshot을 한 번만 수집하고 assets/cfg 규칙 파싱은 task graph, cfg 값/tags/input/wheel은 game thread에서 겹쳐 실행. 출력은 임시 파일에 UTF-8 stream 저장 후 교체하고 stage별 timing은 마지막에 쓰는 ssot_meta.json에 기록
+// v0.5.0 - /Game 스캔을 ADumpRegistryCache 경유로 바꿔 DumpAssets/DumpInput/DumpWheel/IMC 탐지가 process당 한 번만 scan하고 -RegistryCache=true 상태 cache를 재사용
 // v0.4.1 - 실제 기본 SSOT 출력에서 writable resolver를 사용해 read-only Plugin fallback 유지
 // v0.4.0 - 기본 출력 경로를 Document/SSOT에서 AssetDump 플러그인 Dumped/SSOT로 변경
 // v0.3b patch (path non-fixed)
@@ -11,14 +15,20 @@
 #include "SSOTDumpCmdlet.h"
 
 #include "ADumpJson.h"
+#include "ADumpRegistryCache.h"
 
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "GameplayTagsManager.h"
 #include "InputAction.h"
 #include "InputMappingContext.h"
 
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/CommandLine.h"
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
 #include "Misc/DateTime.h"
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonSerializer.h"
@@ -115,6 +125,189 @@ static FString SSOT_JoinPathSegments(const TArray<FString>& Segments, int32 Coun
 	return Out;
 }
 
+// ---------- v0.6.0: JSON stream 저장 / stage timing ----------
+
+static bool SSOT_WriteJsonFile(const TSharedRef<FJsonObject>& Root, const FString& FilePath)
+{
+	// 중간 FString 없이 임시 파일에 UTF-8로 바로 직렬화한 뒤 교체한다(실패 시 기존 파일 유지)
+	const FString TempFilePath = ADumpJson::BuildTempOutputFilePath(FilePath);
+	{
+		TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*TempFilePath));
+		if (!FileWriter)
+		{
+			return false;
+		}
+
+		TSharedRef<TJsonWriter<UTF8CHAR>> Writer = TJsonWriterFactory<UTF8CHAR>::Create(FileWriter.Get());
+		if (!FJsonSerializer::Serialize(Root, Writer) || !FileWriter->Close())
+		{
+			FileWriter.Reset();
+			IFileManager::Get().Delete(*TempFilePath, false, true);
+			return false;
+		}
+	}
+
+	return IFileManager::Get().Move(*FilePath, *TempFilePath, /*Replace=*/true, /*EvenIfReadOnly=*/true);
+}
+
+template <typename FStageFunc>
+static FSSOTStageTiming SSOT_RunTimedStage(const TCHAR* StageName, const TCHAR* ThreadName, FStageFunc&& StageFunc)
+{
+	// stage 하나를 실행하고 결과/소요 시간을 기록
+	const double StartSeconds = FPlatformTime::Seconds();
+
+	FSSOTStageTiming Timing;
+	Timing.StageName = StageName;
+	Timing.ThreadName = ThreadName;
+	Timing.StartSeconds = StartSeconds;
+	Timing.bOk = StageFunc();
+	Timing.EndSeconds = FPlatformTime::Seconds();
+	Timing.Milliseconds = (Timing.EndSeconds - StartSeconds) * 1000.0;
+	return Timing;
+}
+
+// ---------- v0.7.0: 증분 자산 목록 ----------
+
+// 이전 목록/stamp state 파일과 delta 파일
+static const TCHAR* GSSOT_AssetStateFileName = TEXT("ssot_assets_state.json");
+static const TCHAR* GSSOT_AssetDeltaFileName = TEXT("ssot_assets_delta.json");
+static const TCHAR* GSSOT_AssetStateSchemaVersion = TEXT("ssot_assets_state_v1");
+static const TCHAR* GSSOT_AssetDeltaSchemaVersion = TEXT("ssot_assets_delta_v1");
+
+static bool SSOT_IsPackageUnderRoots(const FString& PackageName, const TArray<FString>& Roots)
+{
+	// "/Game/A"는 "/Game" 아래지만 "/GameX/A"는 아니다
+	for (const FString& Root : Roots)
+	{
+		if (PackageName.StartsWith(Root + TEXT("/")))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+static TSharedPtr<FJsonValue> SSOT_MakeAssetRowJson(const FSSOTAssetRow& Row)
+{
+	// ssot_assets.json과 같은 항목 모양
+	TSharedPtr<FJsonObject> Item = MakeShared<FJsonObject>();
+	Item->SetStringField(TEXT("object_path"), Row.ObjectPath);
+	Item->SetStringField(TEXT("class"), Row.ClassPath);
+	Item->SetStringField(TEXT("package_path"), Row.PackagePath);
+	return MakeShared<FJsonValueObject>(Item);
+}
+
+static TArray<TSharedPtr<FJsonValue>> SSOT_MakeAssetRowArray(const TArray<FSSOTAssetRow>* Rows)
+{
+	TArray<TSharedPtr<FJsonValue>> RowArray;
+	if (Rows)
+	{
+		for (const FSSOTAssetRow& Row : *Rows)
+		{
+			RowArray.Add(SSOT_MakeAssetRowJson(Row));
+		}
+	}
+	return RowArray;
+}
+
+static TArray<TSharedPtr<FJsonValue>> SSOT_MakeStringArray(const TArray<FString>& Values)
+{
+	TArray<TSharedPtr<FJsonValue>> ValueArray;
+	for (const FString& Value : Values)
+	{
+		ValueArray.Add(MakeShared<FJsonValueString>(Value));
+	}
+	return ValueArray;
+}
+
+static bool SSOT_LoadAssetState(
+	const FString& StatePath,
+	const TArray<FString>& Roots,
+	TMap<FString, FString>& OutStampByPackage,
+	TMap<FString, TArray<FSSOTAssetRow>>& OutRowsByPackage,
+	FString& OutNote)
+{
+	// 이전 state 로드: schema/엔진 버전/root가 같을 때만 diff 기준으로 쓴다
+	OutStampByPackage.Reset();
+	OutRowsByPackage.Reset();
+	OutNote.Reset();
+
+	if (!FPaths::FileExists(StatePath))
+	{
+		return false;
+	}
+
+	FString Text;
+	if (!FFileHelper::LoadFileToString(Text, *StatePath))
+	{
+		OutNote = TEXT("previous state could not be read; full listing");
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> StateObj;
+	const TArray<TSharedPtr<FJsonValue>>* RootArray = nullptr;
+	const TArray<TSharedPtr<FJsonValue>>* PackageArray = nullptr;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Text);
+	if (!FJsonSerializer::Deserialize(Reader, StateObj)
+		|| !StateObj.IsValid()
+		|| !StateObj->TryGetArrayField(TEXT("roots"), RootArray)
+		|| !StateObj->TryGetArrayField(TEXT("packages"), PackageArray))
+	{
+		OutNote = TEXT("previous state is not valid json; full listing");
+		return false;
+	}
+
+	TArray<FString> StateRoots;
+	for (const TSharedPtr<FJsonValue>& RootValue : *RootArray)
+	{
+		StateRoots.Add(RootValue.IsValid() ? RootValue->AsString() : FString());
+	}
+
+	if (StateObj->GetStringField(TEXT("schema_version")) != GSSOT_AssetStateSchemaVersion
+		|| StateObj->GetStringField(TEXT("engine_version")) != FEngineVersion::Current().ToString()
+		|| StateRoots != Roots)
+	{
+		OutNote = TEXT("previous state schema, engine version or roots differ; full listing");
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& PackageValue : *PackageArray)
+	{
+		const TSharedPtr<FJsonObject> PackageObj = PackageValue.IsValid() ? PackageValue->AsObject() : nullptr;
+		FString PackageName;
+		FString Stamp;
+		if (!PackageObj.IsValid()
+			|| !PackageObj->TryGetStringField(TEXT("package"), PackageName)
+			|| !PackageObj->TryGetStringField(TEXT("stamp"), Stamp))
+		{
+			OutStampByPackage.Reset();
+			OutRowsByPackage.Reset();
+			OutNote = TEXT("previous state has a malformed package entry; full listing");
+			return false;
+		}
+
+		TArray<FSSOTAssetRow>& Rows = OutRowsByPackage.Add(PackageName);
+		const TArray<TSharedPtr<FJsonValue>>* AssetArray = nullptr;
+		if (PackageObj->TryGetArrayField(TEXT("assets"), AssetArray))
+		{
+			for (const TSharedPtr<FJsonValue>& AssetValue : *AssetArray)
+			{
+				const TSharedPtr<FJsonObject> AssetObj = AssetValue.IsValid() ? AssetValue->AsObject() : nullptr;
+				if (AssetObj.IsValid())
+				{
+					FSSOTAssetRow Row;
+					Row.ObjectPath = AssetObj->GetStringField(TEXT("object_path"));
+					Row.ClassPath = AssetObj->GetStringField(TEXT("class"));
+					Row.PackagePath = AssetObj->GetStringField(TEXT("package_path"));
+					Rows.Add(MoveTemp(Row));
+				}
+			}
+		}
+		OutStampByPackage.Add(PackageName, Stamp);
+	}
+	return true;
+}
+
 // ---------- v0.3b: “최장 공통 prefix 폴더” 구현(요청한 완전 코드) ----------
 
 static bool SSOT_LongestCommonPrefixFolder(
@@ -306,17 +499,8 @@ static bool SSOT_SaveDetectJson(
 		Root->SetStringField(TEXT("note"), Note);
 	}
 
-	// 문자열화
-	FString OutJsonText;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJsonText);
-
-	if (!FJsonSerializer::Serialize(Root.ToSharedRef(), Writer))
-	{
-		return false;
-	}
-
 	const FString FilePath = FPaths::Combine(OutputDir, GSSOT_DetectOutFileName);
-	return FFileHelper::SaveStringToFile(OutJsonText, *FilePath);
+	return SSOT_WriteJsonFile(Root.ToSharedRef(), FilePath);
 }
 
 // ---------- v0.3b: DetectInputRoot (IMC 기반) ----------
@@ -330,12 +514,7 @@ static bool SSOT_DetectInputRootByIMC(
 	OutInputRoot.Reset();
 	OutImcFolderPaths.Reset();
 
-	// /Game 스캔 보장
-	{
-		TArray<FString> ScanPaths;
-		ScanPaths.Add(TEXT("/Game"));
-		AssetRegistry.ScanPathsSynchronous(ScanPaths, /*bForceRescan=*/true);
-	}
+	// /Game 스캔은 Main의 CaptureRegistrySnapshot에서 이미 보장됨
 
 	// IMC 수집: 클래스 경로 문자열만 사용(EnhancedInput 헤더 없이도 컴파일 가능)
 	FARFilter Filter;
@@ -498,6 +677,26 @@ void USSOTDumpCmdlet::ParseArgs(const FString& CmdLine)
 		bWriteTimeToMeta = false;
 	}
 
+	// v0.7.0: 증분 자산 목록(-incremental) / mount root 제한(-asset_roots=/Game,/MyPlugin)
+	bIncrementalAssets = FParse::Param(*CmdLine, TEXT("incremental"));
+
+	AssetRoots.Reset();
+	FString AssetRootsText;
+	if (FParse::Value(*CmdLine, TEXT("-asset_roots="), AssetRootsText, /*bShouldStopOnSeparator=*/false))
+	{
+		TArray<FString> RawRoots;
+		AssetRootsText.ParseIntoArray(RawRoots, TEXT(","), /*CullEmpty=*/true);
+		for (const FString& RawRoot : RawRoots)
+		{
+			const FString Root = SSOT_NormalizeGamePath(RawRoot);
+			if (Root.StartsWith(TEXT("/")) && Root.Len() > 1)
+			{
+				AssetRoots.AddUnique(Root);
+			}
+		}
+		AssetRoots.Sort();
+	}
+
 	OutputDir = NormalizePathSeparators(OutputDir);
 }
 
@@ -519,6 +718,139 @@ FString USSOTDumpCmdlet::MakeOutPath(const FString& FileName) const
 	return FPaths::Combine(AbsDir, PrefixedName);
 }
 
+TArray<FString> USSOTDumpCmdlet::GetAssetListingRoots() const
+{
+	if (!AssetRoots.IsEmpty())
+	{
+		return AssetRoots;
+	}
+
+	// 증분은 stamp를 모을 폴더가 필요하므로 기본 /Game, 전체 목록은 기존처럼 모든 mount
+	TArray<FString> Roots;
+	if (bIncrementalAssets)
+	{
+		Roots.Add(TEXT("/Game"));
+	}
+	return Roots;
+}
+
+bool USSOTDumpCmdlet::PrepareAssetDeltaPlan()
+{
+	AssetDeltaPlan = FSSOTAssetDeltaPlan();
+	const TArray<FString> Roots = GetAssetListingRoots();
+
+	// root 폴더의 package 파일 stamp 수집(크기:수정 시각, ADumpRegistryCache와 같은 형식)
+	for (const FString& Root : Roots)
+	{
+		FString RootDir;
+		if (!FPackageName::TryConvertLongPackageNameToFilename(Root + TEXT("/"), RootDir))
+		{
+			// mount되지 않은 root
+			AssetDeltaPlan.BaseNote = FString::Printf(TEXT("asset root is not mounted: %s"), *Root);
+			return false;
+		}
+		RootDir = FPaths::ConvertRelativePathToFull(RootDir);
+
+		TMap<FString, FString>& StampByPackage = AssetDeltaPlan.StampByPackage;
+		TMap<FString, FString>& FileByPackage = AssetDeltaPlan.FileByPackage;
+		IFileManager::Get().IterateDirectoryStatRecursively(
+			*RootDir,
+			[&StampByPackage, &FileByPackage](const TCHAR* VisitedPath, const FFileStatData& StatData)
+			{
+				const FString FilePath(VisitedPath);
+				if (StatData.bIsDirectory || !FPackageName::IsPackageFilename(FilePath))
+				{
+					return true;
+				}
+
+				FString PackageName;
+				if (FPackageName::TryConvertFilenameToLongPackageName(FilePath, PackageName))
+				{
+					StampByPackage.Add(PackageName, FString::Printf(TEXT("%lld:%lld"), StatData.FileSize, StatData.ModificationTime.GetTicks()));
+					FileByPackage.Add(PackageName, FilePath);
+				}
+				return true;
+			});
+	}
+
+	// 이전 state와 비교: 없거나 맞지 않으면 모든 package가 added(전체 목록)
+	FString BaseNote;
+	AssetDeltaPlan.bBaseLoaded = SSOT_LoadAssetState(
+		MakePath(GSSOT_AssetStateFileName),
+		Roots,
+		AssetDeltaPlan.BaseStampByPackage,
+		AssetDeltaPlan.BaseRowsByPackage,
+		BaseNote);
+	AssetDeltaPlan.BaseNote = BaseNote;
+
+	TArray<FString> ChangedPackages;
+	ADumpRegistryCache::DiffPackageFileStamps(
+		AssetDeltaPlan.BaseStampByPackage,
+		AssetDeltaPlan.StampByPackage,
+		ChangedPackages,
+		AssetDeltaPlan.RemovedPackages);
+
+	for (const FString& PackageName : ChangedPackages)
+	{
+		if (AssetDeltaPlan.BaseStampByPackage.Contains(PackageName))
+		{
+			AssetDeltaPlan.ModifiedPackages.Add(PackageName);
+		}
+		else
+		{
+			AssetDeltaPlan.AddedPackages.Add(PackageName);
+		}
+	}
+	return true;
+}
+
+bool USSOTDumpCmdlet::CaptureRegistrySnapshot(const TArray<FString>& ScanPaths, const bool bChangedPackagesOnly)
+{
+	// AssetRegistry 모듈 로드
+	FAssetRegistryModule& AssetRegistryModule =
+		FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+
+	RegistrySnapshot.Reset();
+
+	if (bChangedPackagesOnly)
+	{
+		// 증분 fast path: 추가·수정 package 파일만 다시 scan하고 그 자산만 수집
+		TArray<FString> ChangedPackages = AssetDeltaPlan.AddedPackages;
+		ChangedPackages.Append(AssetDeltaPlan.ModifiedPackages);
+
+		TArray<FString> ChangedFiles;
+		for (const FString& PackageName : ChangedPackages)
+		{
+			ChangedFiles.Add(AssetDeltaPlan.FileByPackage.FindChecked(PackageName));
+		}
+		if (ChangedFiles.Num() > 0)
+		{
+			AssetRegistry.ScanFilesSynchronous(ChangedFiles, /*bForceRescan=*/true);
+		}
+
+		for (const FString& PackageName : ChangedPackages)
+		{
+			AssetRegistry.GetAssetsByPackageName(FName(*PackageName), RegistrySnapshot, /*bIncludeOnlyOnDiskAssets=*/true);
+		}
+	}
+	else
+	{
+		// scan 보장(process당 한 번)
+		ADumpRegistryCache::ScanPathsOnce(ScanPaths, FCommandLine::Get());
+
+		// 모든 에셋 수집
+		AssetRegistry.GetAllAssets(RegistrySnapshot, true);
+	}
+
+	// 결정성: ObjectPath 정렬
+	RegistrySnapshot.Sort([](const FAssetData& A, const FAssetData& B)
+		{
+			return A.GetObjectPathString() < B.GetObjectPathString();
+		});
+	return true;
+}
+
 int32 USSOTDumpCmdlet::Main(const FString& CmdLine)
 {
 	// 인자 파싱
@@ -533,21 +865,101 @@ int32 USSOTDumpCmdlet::Main(const FString& CmdLine)
 			return DumpTarget.Equals(TEXT("all")) || DumpTarget.Equals(Name);
 		};
 
-	bool bOk = true;
+	const double MainStartSeconds = FPlatformTime::Seconds();
+	TArray<FSSOTStageTiming> StageTimings;
 
-	// meta는 항상 권장
-	bOk &= DumpMeta();
+	// 증분 자산 목록: package 파일 stamp를 이전 state와 먼저 비교
+	bool bAssetDeltaReady = false;
+	if (Want(TEXT("assets")) && bIncrementalAssets)
+	{
+		const FSSOTStageTiming StampTiming = SSOT_RunTimedStage(TEXT("asset_stamps"), TEXT("game_thread"), [this]() { return PrepareAssetDeltaPlan(); });
+		bAssetDeltaReady = StampTiming.bOk;
+		StageTimings.Add(StampTiming);
+	}
 
-	if (Want(TEXT("assets"))) bOk &= DumpAssets();
-	if (Want(TEXT("cfg")))    bOk &= DumpConfig();
-	if (Want(TEXT("tags")))   bOk &= DumpTags();
-	if (Want(TEXT("input")))  bOk &= DumpInput();
-	if (Want(TEXT("wheel")))  bOk &= DumpWheel();
+	// registry snapshot은 game thread에서 한 번만 수집하고 assets/input/wheel이 공유
+	if (Want(TEXT("assets")) || Want(TEXT("input")) || Want(TEXT("wheel")))
+	{
+		// scan 대상: 자산 목록 root(없으면 /Game) + input/wheel용 /Game
+		TArray<FString> ScanPaths = GetAssetListingRoots();
+		if (ScanPaths.IsEmpty() || Want(TEXT("input")) || Want(TEXT("wheel")))
+		{
+			ScanPaths.AddUnique(TEXT("/Game"));
+		}
+
+		// 이전 목록이 있고 assets만 덤프하면 바뀐 package만 registry에서 다시 읽는다
+		const bool bChangedPackagesOnly = bAssetDeltaReady && AssetDeltaPlan.bBaseLoaded && DumpTarget.Equals(TEXT("assets"));
+		StageTimings.Add(SSOT_RunTimedStage(TEXT("registry_snapshot"), TEXT("game_thread"), [this, &ScanPaths, bChangedPackagesOnly]()
+			{
+				return CaptureRegistrySnapshot(ScanPaths, bChangedPackagesOnly);
+			}));
+	}
+
+	// UObject를 만지지 않는 stage는 task graph로 먼저 보낸다
+	TFuture<FSSOTStageTiming> AssetsFuture;
+	if (Want(TEXT("assets")))
+	{
+		AssetsFuture = Async(EAsyncExecution::TaskGraph, [this, bAssetDeltaReady]()
+			{
+				return SSOT_RunTimedStage(TEXT("assets"), TEXT("task_graph"), [this, bAssetDeltaReady]()
+					{
+						// stamp 수집 실패(mount 안 된 root)면 목록을 덮어쓰지 않는다
+						return (!bIncrementalAssets || bAssetDeltaReady) && DumpAssets();
+					});
+			});
+	}
+
+	// cfg 규칙(화이트리스트 읽기 + 파싱)도 task graph에서, GConfig 조회는 game thread에서
+	TSharedRef<TArray<FCfgRule>> CfgRules = MakeShared<TArray<FCfgRule>>();
+	TFuture<FSSOTStageTiming> CfgRulesFuture;
+	if (Want(TEXT("cfg")))
+	{
+		CfgRulesFuture = Async(EAsyncExecution::TaskGraph, [this, CfgRules]()
+			{
+				return SSOT_RunTimedStage(TEXT("cfg_rules"), TEXT("task_graph"), [this, &CfgRules]() { return LoadCfgRules(*CfgRules); });
+			});
+	}
+
+	// game thread stage: task와 겹쳐서 실행
+	if (Want(TEXT("tags")))
+	{
+		StageTimings.Add(SSOT_RunTimedStage(TEXT("tags"), TEXT("game_thread"), [this]() { return DumpTags(); }));
+	}
+	if (Want(TEXT("input")))
+	{
+		StageTimings.Add(SSOT_RunTimedStage(TEXT("input"), TEXT("game_thread"), [this]() { return DumpInput(); }));
+	}
+	if (Want(TEXT("wheel")))
+	{
+		StageTimings.Add(SSOT_RunTimedStage(TEXT("wheel"), TEXT("game_thread"), [this]() { return DumpWheel(); }));
+	}
+	if (CfgRulesFuture.IsValid())
+	{
+		const FSSOTStageTiming CfgRulesTiming = CfgRulesFuture.Get();
+		StageTimings.Add(CfgRulesTiming);
+		StageTimings.Add(SSOT_RunTimedStage(TEXT("cfg"), TEXT("game_thread"), [this, &CfgRules, &CfgRulesTiming]()
+			{
+				return CfgRulesTiming.bOk && DumpConfig(*CfgRules);
+			}));
+	}
+	if (AssetsFuture.IsValid())
+	{
+		StageTimings.Add(AssetsFuture.Get());
+	}
+
+	bool bOk = true;
+	for (const FSSOTStageTiming& Timing : StageTimings)
+	{
+		bOk &= Timing.bOk;
+	}
+
+	// meta는 항상 권장: stage timing을 담기 위해 마지막에 기록
+	bOk &= DumpMeta(StageTimings, MainStartSeconds);
 
 	return bOk ? 0 : 1;
 }
 
-bool USSOTDumpCmdlet::DumpMeta() const
+bool USSOTDumpCmdlet::DumpMeta(const TArray<FSSOTStageTiming>& StageTimings, const double MainStartSeconds) const
 {
 	// 스키마 버전
 	const FString SchemaVersion = TEXT("0.2");
@@ -568,83 +980,172 @@ bool USSOTDumpCmdlet::DumpMeta() const
 	{
 		// 결정성 필요 시 -notime 사용
 		Root->SetStringField(TEXT("dump_time_utc"), FDateTime::UtcNow().ToIso8601());
+		Root->SetNumberField(TEXT("total_ms"), (FPlatformTime::Seconds() - MainStartSeconds) * 1000.0);
 	}
 
-	FString OutJson;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
-	if (!FJsonSerializer::Serialize(Root.ToSharedRef(), Writer))
+	// stages: 실행 순서가 아닌 이름 순(결정성). 선후는 Main 시작 기준 start_ms/end_ms로 본다. -notime이면 시간 필드 생략
+	TArray<FSSOTStageTiming> SortedTimings = StageTimings;
+	SortedTimings.Sort([](const FSSOTStageTiming& A, const FSSOTStageTiming& B)
+		{
+			return A.StageName < B.StageName;
+		});
+
+	TArray<TSharedPtr<FJsonValue>> StageArray;
+	for (const FSSOTStageTiming& Timing : SortedTimings)
 	{
-		return false;
+		TSharedPtr<FJsonObject> StageObj = MakeShared<FJsonObject>();
+		StageObj->SetStringField(TEXT("name"), Timing.StageName);
+		StageObj->SetStringField(TEXT("thread"), Timing.ThreadName);
+		StageObj->SetBoolField(TEXT("ok"), Timing.bOk);
+		if (bWriteTimeToMeta)
+		{
+			StageObj->SetNumberField(TEXT("ms"), Timing.Milliseconds);
+			StageObj->SetNumberField(TEXT("start_ms"), (Timing.StartSeconds - MainStartSeconds) * 1000.0);
+			StageObj->SetNumberField(TEXT("end_ms"), (Timing.EndSeconds - MainStartSeconds) * 1000.0);
+		}
+		StageArray.Add(MakeShared<FJsonValueObject>(StageObj));
 	}
+	Root->SetArrayField(TEXT("stages"), StageArray);
 
-	return FFileHelper::SaveStringToFile(OutJson, *MakePath(TEXT("ssot_meta.json")));
+	return SSOT_WriteJsonFile(Root.ToSharedRef(), MakePath(TEXT("ssot_meta.json")));
 }
 
 bool USSOTDumpCmdlet::DumpAssets() const
 {
-	// AssetRegistry 모듈 로드
-	FAssetRegistryModule& AssetRegistryModule =
-		FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
+	// RegistrySnapshot(이미 ObjectPath 정렬)과 AssetDeltaPlan만 읽으므로 task graph에서 실행 가능
+	const TArray<FString> Roots = GetAssetListingRoots();
+
+	// snapshot을 package별 row로 묶는다(root 밖 제외)
+	TMap<FString, TArray<FSSOTAssetRow>> SnapshotRowsByPackage;
+	for (const FAssetData& AssetData : RegistrySnapshot)
+	{
+		const FString PackageName = AssetData.PackageName.ToString();
+		if (!Roots.IsEmpty() && !SSOT_IsPackageUnderRoots(PackageName, Roots))
+		{
+			continue;
+		}
 
-	// /Game 스캔 보장
-	TArray<FString> ScanPaths;
-	ScanPaths.Add(TEXT("/Game"));
-	AssetRegistry.ScanPathsSynchronous(ScanPaths, true);
+		FSSOTAssetRow Row;
+		Row.ObjectPath = AssetData.GetObjectPathString();
+		Row.ClassPath = AssetData.AssetClassPath.ToString();
+		Row.PackagePath = AssetData.PackagePath.ToString();
+		SnapshotRowsByPackage.FindOrAdd(PackageName).Add(MoveTemp(Row));
+	}
 
-	// 모든 에셋 수집
-	TArray<FAssetData> AllAssets;
-	AssetRegistry.GetAllAssets(AllAssets, true);
+	// 증분이면 package 집합은 stamp를 모은 파일 기준: 바뀐 package는 snapshot, 나머지는 이전 row 재사용
+	TMap<FString, TArray<FSSOTAssetRow>> RowsByPackage;
+	if (bIncrementalAssets)
+	{
+		TSet<FString> ChangedPackages(AssetDeltaPlan.AddedPackages);
+		ChangedPackages.Append(AssetDeltaPlan.ModifiedPackages);
 
-	// 결정성: ObjectPath 정렬
-	AllAssets.Sort([](const FAssetData& A, const FAssetData& B)
+		for (const TPair<FString, FString>& StampPair : AssetDeltaPlan.StampByPackage)
 		{
-			return A.GetObjectPathString() < B.GetObjectPathString();
+			const TArray<FSSOTAssetRow>* Rows = ChangedPackages.Contains(StampPair.Key)
+				? SnapshotRowsByPackage.Find(StampPair.Key)
+				: AssetDeltaPlan.BaseRowsByPackage.Find(StampPair.Key);
+			RowsByPackage.Add(StampPair.Key, Rows ? *Rows : TArray<FSSOTAssetRow>());
+		}
+	}
+	else
+	{
+		RowsByPackage = MoveTemp(SnapshotRowsByPackage);
+	}
+
+	// 전체 목록: 결정성을 위해 ObjectPath 정렬
+	TArray<const FSSOTAssetRow*> SortedRows;
+	for (const TPair<FString, TArray<FSSOTAssetRow>>& PackagePair : RowsByPackage)
+	{
+		for (const FSSOTAssetRow& Row : PackagePair.Value)
+		{
+			SortedRows.Add(&Row);
+		}
+	}
+	SortedRows.Sort([](const FSSOTAssetRow& A, const FSSOTAssetRow& B)
+		{
+			return A.ObjectPath < B.ObjectPath;
 		});
 
-	// JSON 배열 생성
 	TArray<TSharedPtr<FJsonValue>> AssetArray;
-	AssetArray.Reserve(AllAssets.Num());
-
-	for (const FAssetData& AssetData : AllAssets)
+	AssetArray.Reserve(SortedRows.Num());
+	for (const FSSOTAssetRow* Row : SortedRows)
 	{
-		TSharedPtr<FJsonObject> Item = MakeShared<FJsonObject>();
-		Item->SetStringField(TEXT("object_path"), AssetData.GetObjectPathString());
-		Item->SetStringField(TEXT("class"), AssetData.AssetClassPath.ToString());
-		Item->SetStringField(TEXT("package_path"), AssetData.PackagePath.ToString());
-
-		AssetArray.Add(MakeShared<FJsonValueObject>(Item));
+		AssetArray.Add(SSOT_MakeAssetRowJson(*Row));
 	}
 
 	TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
 	Root->SetArrayField(TEXT("assets"), AssetArray);
 
-	FString OutJson;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
-	if (!FJsonSerializer::Serialize(Root.ToSharedRef(), Writer))
+	if (!SSOT_WriteJsonFile(Root.ToSharedRef(), MakePath(TEXT("ssot_assets.json"))))
 	{
 		return false;
 	}
+	if (!bIncrementalAssets)
+	{
+		return true;
+	}
+
+	// delta: 소비자가 바뀐 package만 처리하도록 added/modified(현재 row)와 removed(이전 row)를 기록
+	const auto MakePackageArray = [this](const TArray<FString>& PackageNames, const TMap<FString, TArray<FSSOTAssetRow>>& SourceRows)
+		{
+			TArray<TSharedPtr<FJsonValue>> PackageArray;
+			for (const FString& PackageName : PackageNames)
+			{
+				TSharedPtr<FJsonObject> PackageObj = MakeShared<FJsonObject>();
+				PackageObj->SetStringField(TEXT("package"), PackageName);
+				if (const FString* Stamp = AssetDeltaPlan.StampByPackage.Find(PackageName))
+				{
+					PackageObj->SetStringField(TEXT("stamp"), *Stamp);
+				}
+				PackageObj->SetArrayField(TEXT("assets"), SSOT_MakeAssetRowArray(SourceRows.Find(PackageName)));
+				PackageArray.Add(MakeShared<FJsonValueObject>(PackageObj));
+			}
+			return PackageArray;
+		};
+
+	TSharedPtr<FJsonObject> CountsObj = MakeShared<FJsonObject>();
+	CountsObj->SetNumberField(TEXT("packages"), AssetDeltaPlan.StampByPackage.Num());
+	CountsObj->SetNumberField(TEXT("assets"), SortedRows.Num());
+	CountsObj->SetNumberField(TEXT("added"), AssetDeltaPlan.AddedPackages.Num());
+	CountsObj->SetNumberField(TEXT("modified"), AssetDeltaPlan.ModifiedPackages.Num());
+	CountsObj->SetNumberField(TEXT("removed"), AssetDeltaPlan.RemovedPackages.Num());
+
+	TSharedPtr<FJsonObject> DeltaRoot = MakeShared<FJsonObject>();
+	DeltaRoot->SetStringField(TEXT("schema_version"), GSSOT_AssetDeltaSchemaVersion);
+	DeltaRoot->SetStringField(TEXT("base"), AssetDeltaPlan.bBaseLoaded ? TEXT("previous") : TEXT("none"));
+	if (!AssetDeltaPlan.BaseNote.IsEmpty())
+	{
+		DeltaRoot->SetStringField(TEXT("base_note"), AssetDeltaPlan.BaseNote);
+	}
+	DeltaRoot->SetArrayField(TEXT("roots"), SSOT_MakeStringArray(Roots));
+	DeltaRoot->SetObjectField(TEXT("counts"), CountsObj);
+	DeltaRoot->SetArrayField(TEXT("added"), MakePackageArray(AssetDeltaPlan.AddedPackages, RowsByPackage));
+	DeltaRoot->SetArrayField(TEXT("modified"), MakePackageArray(AssetDeltaPlan.ModifiedPackages, RowsByPackage));
+	DeltaRoot->SetArrayField(TEXT("removed"), MakePackageArray(AssetDeltaPlan.RemovedPackages, AssetDeltaPlan.BaseRowsByPackage));
+
+	if (!SSOT_WriteJsonFile(DeltaRoot.ToSharedRef(), MakePath(GSSOT_AssetDeltaFileName)))
+	{
+		return false;
+	}
+
+	// state: 다음 실행의 diff 기준(package 이름 정렬). 목록/delta 저장 뒤에 교체
+	TArray<FString> SortedPackages;
+	AssetDeltaPlan.StampByPackage.GetKeys(SortedPackages);
+	SortedPackages.Sort();
 
-	return FFileHelper::SaveStringToFile(OutJson, *MakePath(TEXT("ssot_assets.json")));
+	TSharedPtr<FJsonObject> StateRoot = MakeShared<FJsonObject>();
+	StateRoot->SetStringField(TEXT("schema_version"), GSSOT_AssetStateSchemaVersion);
+	StateRoot->SetStringField(TEXT("engine_version"), FEngineVersion::Current().ToString());
+	StateRoot->SetArrayField(TEXT("roots"), SSOT_MakeStringArray(Roots));
+	StateRoot->SetArrayField(TEXT("packages"), MakePackageArray(SortedPackages, RowsByPackage));
+
+	return SSOT_WriteJsonFile(StateRoot.ToSharedRef(), MakePath(GSSOT_AssetStateFileName));
 }
 
 // -------------------------
 // cfg 화이트리스트 덤프 (v0.2)
 // -------------------------
 
-struct FCfgRule
-{
-	// ini 파일명 (DefaultEngine.ini 등)
-	FString IniName;
-
-	// 섹션명
-	FString SectionName;
-
-	// 키명 (또는 *)
-	FString KeyName;
-};
-
 static bool ParseCfgRules(
 	const FString& RuleText,
 	TArray<FCfgRule>& OutRules)
@@ -709,7 +1210,7 @@ static FString ResolveIniPathByName(const FString& IniName)
 	return FString();
 }
 
-bool USSOTDumpCmdlet::DumpConfig() const
+bool USSOTDumpCmdlet::LoadCfgRules(TArray<FCfgRule>& OutRules) const
 {
 	// 화이트리스트 파일 읽기
 	const FString WhitelistPath = MakePath(CfgWhitelistFileName);
@@ -722,12 +1223,13 @@ bool USSOTDumpCmdlet::DumpConfig() const
 	}
 
 	// 룰 파싱
-	TArray<FCfgRule> Rules;
-	if (!ParseCfgRules(RuleText, Rules))
-	{
-		return false;
-	}
+	OutRules.Reset();
+	return ParseCfgRules(RuleText, OutRules);
+}
 
+bool USSOTDumpCmdlet::DumpConfig(const TArray<FCfgRule>& Rules) const
+{
+	// GConfig 조회는 game thread에서 수행(규칙은 LoadCfgRules가 미리 준비)
 	// 출력 구조: (ini, section)별 pairs 묶기
 	// 결정성: ini/section/pairs 모두 정렬
 	struct FSectionDump
@@ -838,14 +1340,7 @@ bool USSOTDumpCmdlet::DumpConfig() const
 	TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
 	Root->SetArrayField(TEXT("cfg"), CfgArray);
 
-	FString OutJson;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
-	if (!FJsonSerializer::Serialize(Root.ToSharedRef(), Writer))
-	{
-		return false;
-	}
-
-	return FFileHelper::SaveStringToFile(OutJson, *MakePath(TEXT("ssot_cfg.json")));
+	return SSOT_WriteJsonFile(Root.ToSharedRef(), MakePath(TEXT("ssot_cfg.json")));
 }
 
 // SSOTDumpCmdlet.cpp
@@ -892,15 +1387,7 @@ bool USSOTDumpCmdlet::DumpTags() const
 	TSharedPtr<FJsonObject> Root = MakeShared<FJsonObject>();
 	Root->SetArrayField(TEXT("tags"), TagArray);
 
-	FString OutJson;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
-
-	if (!FJsonSerializer::Serialize(Root.ToSharedRef(), Writer))
-	{
-		return false;
-	}
-
-	return FFileHelper::SaveStringToFile(OutJson, *MakePath(TEXT("ssot_tags.json")));
+	return SSOT_WriteJsonFile(Root.ToSharedRef(), MakePath(TEXT("ssot_tags.json")));
 }
 
 // -------------------------
@@ -940,10 +1427,7 @@ bool USSOTDumpCmdlet::DumpInput() const
 		FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
 	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-	// /Game 스캔 보장
-	TArray<FString> ScanPaths;
-	ScanPaths.Add(TEXT("/Game"));
-	AssetRegistry.ScanPathsSynchronous(ScanPaths, true);
+	// /Game 스캔은 Main의 CaptureRegistrySnapshot에서 이미 보장됨
 
 	// v0.3b: input_root를 고정하지 않고 해석(Detect + Profile + CLI)
 	// OutputDir는 Commandlet의 출력 폴더(상대/절대 상관없지만 절대면 더 안전)
@@ -1097,14 +1581,7 @@ bool USSOTDumpCmdlet::DumpInput() const
 	Root->SetArrayField(TEXT("input_actions"), IaArray);
 	Root->SetArrayField(TEXT("input_contexts"), ImcArray);
 
-	FString OutJson;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
-	if (!FJsonSerializer::Serialize(Root.ToSharedRef(), Writer))
-	{
-		return false;
-	}
-
-	return FFileHelper::SaveStringToFile(OutJson, *MakePath(TEXT("ssot_input.json")));
+	return SSOT_WriteJsonFile(Root.ToSharedRef(), MakePath(TEXT("ssot_input.json")));
 }
 
 
@@ -1255,27 +1732,14 @@ bool USSOTDumpCmdlet::DumpWheel() const
 	// 기대 우측 Yaw
 	const double ExpectedRightYawDeg = GetNumberFieldSafe(WheelSection, TEXT("expected_right_yaw_deg"), 180.0);
 
-	// AssetRegistry로 BP 찾기
-	FAssetRegistryModule& AssetRegistryModule =
-		FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-	IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-	// /Game 스캔 보장
-	TArray<FString> ScanPaths;
-	ScanPaths.Add(TEXT("/Game"));
-	AssetRegistry.ScanPathsSynchronous(ScanPaths, true);
-
-	// BP 이름으로 후보 검색: (간단/안전) 모든 BP 중 이름 매칭
+	// BP 이름으로 후보 검색: (간단/안전) RegistrySnapshot 중 이름 매칭
 	// 초보자 단계에서는 “이름으로 찾고, 결과를 ssot_wheel에 기록”하는 게 디버깅이 쉽다.
-	TArray<FAssetData> AllAssets;
-	AssetRegistry.GetAllAssets(AllAssets, true);
-
 	FAssetData FoundBp;
 	bool bFound = false;
 
 	if (!VehicleBpName.IsEmpty())
 	{
-		for (const FAssetData& A : AllAssets)
+		for (const FAssetData& A : RegistrySnapshot)
 		{
 			// Blueprint 계열만 빠르게 필터 (정확한 class path는 프로젝트/버전마다 차이가 있어 이름 위주로 진행)
 			if (A.AssetName.ToString().Equals(VehicleBpName))
@@ -1494,14 +1958,7 @@ bool USSOTDumpCmdlet::DumpWheel() const
 	Root->SetObjectField(TEXT("verdict"), VerdictObj);
 
 	// 저장
-	FString OutJson;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutJson);
-	if (!FJsonSerializer::Serialize(Root.ToSharedRef(), Writer))
-	{
-		return false;
-	}
-
-	const bool bSaved = FFileHelper::SaveStringToFile(OutJson, *MakePath(TEXT("ssot_wheel.json")));
+	const bool bSaved = SSOT_WriteJsonFile(Root.ToSharedRef(), MakePath(TEXT("ssot_wheel.json")));
 
 	// strict 모드면 FAIL을 exit code로 반영하려고 Main에서 bOk에 포함시켜야 함.
 	return bSaved && (!bStrictFail || bPass);
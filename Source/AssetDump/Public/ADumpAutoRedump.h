@@ -0,0 +1,122 @@
+// File: ADumpAutoRedump.h
+// Version: v1.0.1
+// Changelog:
+// - v1.0.1: queue 단계 진행은 FADumpExecCtrl core ticker에 맡기고 ticker는 종료만 확인.
+// - v1.0.0: 저장/이름 변경/삭제 event를 debounce해 이미 덤프된 자산과 직접 역참조 자산만 queue로 다시 덤프하고 index를 재생성하는 opt-in 자동 재덤프를 추가.
+// Migration:
+// - 기본값은 꺼짐이며 켜지 않으면 event를 구독하지 않는다. 켜면 기본 출력 경로(<DumpRoot>/BPDump/<자산>/)에 이미 dump가 있는 자산만 대상으로 한다.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+
+struct FAssetData;
+class FObjectPostSaveContext;
+class UPackage;
+
+// FADumpAutoRedump는 에디터 저장 event를 모아 영향받은 자산만 background queue로 다시 덤프하는 싱글톤이다.
+class FADumpAutoRedump
+{
+public:
+	// Get는 전역 단일 자동 재덤프 인스턴스를 반환한다.
+	static FADumpAutoRedump& Get();
+
+	// Startup은 module 시작 시 저장된 opt-in 설정을 읽고 켜져 있으면 event 구독을 시작한다.
+	void Startup();
+
+	// Shutdown은 event 구독과 ticker를 해제하고 진행 중인 index 재생성을 기다린다.
+	void Shutdown();
+
+	// IsEnabled는 자동 재덤프가 켜져 있는지 반환한다.
+	bool IsEnabled() const;
+
+	// SetEnabled는 자동 재덤프를 켜거나 끄고 설정을 에디터 ini에 저장한다. 끄면 대기 중인 event를 버린다.
+	void SetEnabled(bool bInEnabled);
+
+	// GetStatusText는 대기/재덤프/index 재생성 상태 한 줄 요약이다.
+	const FString& GetStatusText() const;
+
+private:
+	// RegisterEvents는 package 저장과 AssetRegistry 이름 변경/삭제 event, ticker를 등록한다.
+	void RegisterEvents();
+
+	// UnregisterEvents는 등록한 event와 ticker를 해제한다.
+	void UnregisterEvents();
+
+	// HandlePackageSaved는 사용자 저장 package를 대기 목록에 넣는다. autosave/procedural/PIE 저장은 무시한다.
+	void HandlePackageSaved(const FString& InPackageFileName, UPackage* InPackage, FObjectPostSaveContext InSaveContext);
+
+	// HandleAssetRenamed는 이전 경로 dump를 stale로, 새 경로를 재덤프 대상으로 기록한다.
+	void HandleAssetRenamed(const FAssetData& InAssetData, const FString& InOldObjectPath);
+
+	// HandleAssetRemoved는 삭제된 자산의 dump를 stale로 기록한다.
+	void HandleAssetRemoved(const FAssetData& InAssetData);
+
+	// HandleTick은 debounce 만료 시 재덤프를 시작하고, 직접 시작한 queue가 끝났는지 확인하며, 끝나면 index 재생성을 시작한다.
+	bool HandleTick(float InDeltaSeconds);
+
+	// StartPendingRedump는 대기 event를 비우고 stale dump 정리와 재덤프 queue 시작을 수행한다.
+	void StartPendingRedump();
+
+	// CollectRedumpTargets는 저장 package 자산과 그 직접 역참조 자산 중 기존 dump가 있는 자산 경로를 모은다.
+	void CollectRedumpTargets(const TSet<FName>& InSavedPackageNames, const TSet<FString>& InForcedObjectPaths, TArray<FString>& OutObjectPaths) const;
+
+	// BuildManifestFilePath는 자산 기본 출력 폴더의 manifest.json 경로다.
+	FString BuildManifestFilePath(const FString& InObjectPath) const;
+
+	// HasExistingDump는 기본 출력 폴더 manifest가 같은 object_path를 가리키는지 검사한다.
+	bool HasExistingDump(const FString& InObjectPath) const;
+
+	// RemoveStaleDump는 삭제/이름 변경된 자산의 기본 출력 폴더를 지운다. 삭제했으면 true다.
+	bool RemoveStaleDump(const FString& InObjectPath);
+
+	// StartIndexRebuild는 dump root index 파일 재생성을 thread pool에서 시작한다.
+	void StartIndexRebuild();
+
+	// SetStatusText는 상태 요약을 갱신하고 로그로 남긴다.
+	void SetStatusText(const FString& InStatusText);
+
+private:
+	// bEnabled는 자동 재덤프 opt-in 여부다.
+	bool bEnabled = false;
+
+	// PackageSavedHandle, AssetRenamedHandle, AssetRemovedHandle은 구독한 event handle이다.
+	FDelegateHandle PackageSavedHandle;
+	FDelegateHandle AssetRenamedHandle;
+	FDelegateHandle AssetRemovedHandle;
+
+	// TickerHandle은 core ticker 등록 handle이다.
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	// PendingSavedPackageNames는 debounce 중인 저장 package 이름이다.
+	TSet<FName> PendingSavedPackageNames;
+
+	// PendingForcedObjectPaths는 이름 변경으로 기존 dump를 이어받아야 하는 새 자산 경로다.
+	TSet<FString> PendingForcedObjectPaths;
+
+	// PendingStaleObjectPaths는 삭제/이름 변경으로 dump를 지워야 하는 이전 자산 경로다.
+	TSet<FString> PendingStaleObjectPaths;
+
+	// LastEventSeconds는 마지막 event 시각이다. 이 시각부터 debounce 시간이 지나야 재덤프를 시작한다.
+	double LastEventSeconds = 0.0;
+
+	// DumpRootPath는 마지막 재덤프 batch의 BPDump 루트다. index 재생성 대상이다.
+	FString DumpRootPath;
+
+	// bOwnsRunningQueue는 현재 FADumpExecCtrl queue를 자동 재덤프가 시작했는지 나타낸다.
+	bool bOwnsRunningQueue = false;
+
+	// bIndexDirty는 dump 변경 뒤 index 재생성이 필요한지 나타낸다.
+	bool bIndexDirty = false;
+
+	// IndexRebuildFuture는 thread pool index 재생성 결과다.
+	TFuture<bool> IndexRebuildFuture;
+
+	// IndexRebuildStartSeconds는 index 재생성 시작 시각이다.
+	double IndexRebuildStartSeconds = 0.0;
+
+	// StatusText는 마지막 상태 요약이다.
+	FString StatusText;
+};
@@ -1,6 +1,9 @@
 // File: ADumpDataDiff.h
-// Version: v1.0.0
+// Version: v1.2.1
 // Changelog:
+// - v1.2.1: batch diff가 section을 쓰지 않은 current asset의 이전 data_asset_diff.json을 지우도록 계약을 명시.
+// - v1.2.0: 두 in-memory data_asset_values_v1 결과를 비교하는 API를 추가.
+// - v1.1.0: 저장 dump 간 비교와 asset_index_v1 기반 batch diff API를 추가.
 // - v1.0.0: data_asset_diff_v1 baseline preflight와 DataAsset 값 비교 API를 추가.
 
 #pragma once
@@ -14,6 +17,9 @@ namespace ADumpDataDiff
 	// GetSchemaVersionText는 DataAsset Diff 전용 스키마 버전을 반환한다.
 	ASSETDUMP_API const TCHAR* GetSchemaVersionText();
 
+	// GetBatchSchemaVersionText는 dump root 간 batch diff 보고서 스키마 버전을 반환한다.
+	ASSETDUMP_API const TCHAR* GetBatchSchemaVersionText();
+
 	// PrepareBaselineFile는 baseline JSON 경로를 검증하고 정규화 경로와 SHA-256을 계산한다.
 	ASSETDUMP_API bool PrepareBaselineFile(
 		const FString& InBaselinePath,
@@ -30,4 +36,30 @@ namespace ADumpDataDiff
 		const FADumpDataAssetValues& InCurrentValues,
 		FADumpDataAssetDiff& OutDataAssetDiff,
 		TArray<FADumpIssue>& OutIssues);
+
+	// BuildDataAssetDiffFromDumpFiles는 저장된 baseline/current dump JSON의 data_asset_values_v1을 UObject 로드 없이 비교한다.
+	ASSETDUMP_API bool BuildDataAssetDiffFromDumpFiles(
+		const FString& InBaselineDumpPath,
+		const FString& InCurrentDumpPath,
+		const FString& InCurrentAssetPath,
+		FADumpDataAssetDiff& OutDataAssetDiff,
+		TArray<FADumpIssue>& OutIssues);
+
+	// BuildBatchDataAssetDiffJson은 두 dump root의 asset_index_v1을 object_path로 짝지어 data_asset_batch_diff_v1 보고서를 만든다.
+	// fingerprint가 같은 쌍은 dump를 읽지 않고 건너뛰며, 비교한 쌍은 current asset 폴더에 data_asset_diff.json section을 남긴다.
+	// 건너뛰거나 실패한 쌍의 이전 section 파일은 다른 baseline 기준일 수 있어 삭제한다.
+	ASSETDUMP_API bool BuildBatchDataAssetDiffJson(
+		const FString& InBaselineRootPath,
+		const FString& InCurrentRootPath,
+		FString& OutJsonText,
+		FString& OutErrorCode,
+		FString& OutErrorDetail);
+
+	// BuildDataAssetDiffFromValues는 파일 없이 두 in-memory data_asset_values_v1 결과를 같은 비교 규칙으로 비교한다.
+	ASSETDUMP_API bool BuildDataAssetDiffFromValues(
+		const FADumpDataAssetValues& InBaselineValues,
+		const FADumpDataAssetValues& InCurrentValues,
+		const FString& InAssetPath,
+		FADumpDataAssetDiff& OutDataAssetDiff,
+		TArray<FADumpIssue>& OutIssues);
 }
@@ -1,6 +1,9 @@
 // File: ADumpEditorApi.h
-// Version: v0.5.0
+// Version: v0.8.0
 // Changelog:
+// - v0.8.0: 저장 시 자동 재덤프 opt-in 설정/조회와 상태 요약 API를 추가.
+// - v0.7.0: Content Browser 선택 자산/폴더 경로 수집과 다중 자산 queue 덤프 시작, queue 진행률/요약 조회 API를 추가.
+// - v0.6.0: 스냅샷 version 조회와 sequence 기반 로그 delta 조회 API를 추가.
 // - v0.5.0: 열린 Blueprint 덤프, 마지막 실패 재시도, 마지막 실행 시간(ms) 조회 API를 추가.
 // - v0.4.1: Compile Before Dump, Skip If Up To Date 옵션을 공통 실행 옵션으로 전달하도록 API 시그니처를 확장.
 // - v0.4.0: 단계 실행형 덤프 시작/진행/취소/상태 조회 API 추가.
@@ -63,6 +66,57 @@ public:
 		const FString& LinkKindText,
 		FString& OutMessage);
 
+	// GetSelectedContentBrowserAssetPaths는 Content Browser에서 선택한 자산과 선택 폴더 아래 자산 경로를 모은다.
+	UFUNCTION(BlueprintCallable, Category = "AssetDump|Editor",
+		meta = (ToolTip = "콘텐츠 브라우저에서 선택한 에셋과 선택한 폴더 아래(하위 폴더 포함) 에셋의 오브젝트 경로를 중복 없이 반환합니다."))
+	static bool GetSelectedContentBrowserAssetPaths(TArray<FString>& OutAssetObjectPaths, FString& OutMessage);
+
+	// StartDumpAssets는 여러 자산을 queue로 연속 덤프한다. 출력은 자산별 기본 경로를 사용한다.
+	UFUNCTION(BlueprintCallable, Category = "AssetDump|Editor",
+		meta = (ToolTip = "여러 에셋을 순서대로 덤프하는 queue를 시작합니다. 앞 에셋 저장과 다음 에셋 추출이 겹쳐 진행되며 출력은 에셋별 기본 경로를 사용합니다."))
+	static bool StartDumpAssets(
+		const TArray<FString>& AssetObjectPaths,
+		bool bIncludeSummary,
+		bool bIncludeDetails,
+		bool bIncludeGraphs,
+		bool bIncludeReferences,
+		bool bCompileBeforeDump,
+		bool bSkipIfUpToDate,
+		const FString& GraphNameFilter,
+		bool bLinksOnly,
+		const FString& LinkKindText,
+		FString& OutMessage);
+
+	// IsDumpQueueRunning은 다중 자산 queue가 실행 중인지 반환한다.
+	UFUNCTION(BlueprintPure, Category = "AssetDump|Editor",
+		meta = (ToolTip = "다중 에셋 덤프 queue가 실행 중인지 반환합니다."))
+	static bool IsDumpQueueRunning();
+
+	// GetDumpQueueProgressPercent01은 queue 전체 진행률(0~1)을 반환한다.
+	UFUNCTION(BlueprintPure, Category = "AssetDump|Editor",
+		meta = (ToolTip = "다중 에셋 덤프 queue 전체 진행률을 0.0 ~ 1.0 범위로 반환합니다."))
+	static float GetDumpQueueProgressPercent01();
+
+	// GetDumpQueueSummaryText는 queue 완료/건너뜀/실패 수와 남은 예상 시간을 한 줄로 반환한다.
+	UFUNCTION(BlueprintPure, Category = "AssetDump|Editor",
+		meta = (ToolTip = "다중 에셋 덤프 queue의 완료/건너뜀/실패 수와 남은 예상 시간을 반환합니다. queue 기록이 없으면 빈 문자열입니다."))
+	static FString GetDumpQueueSummaryText();
+
+	// SetAutoRedumpOnSaveEnabled는 저장/이름 변경/삭제 시 기존 dump 자동 재덤프를 켜거나 끄고 설정을 저장한다.
+	UFUNCTION(BlueprintCallable, Category = "AssetDump|Editor",
+		meta = (ToolTip = "저장한 에셋과 직접 참조하는 에셋 중 이미 덤프된 것을 자동으로 다시 덤프하고 index를 재생성할지 설정합니다."))
+	static void SetAutoRedumpOnSaveEnabled(bool bEnabled);
+
+	// IsAutoRedumpOnSaveEnabled는 자동 재덤프가 켜져 있는지 반환한다.
+	UFUNCTION(BlueprintPure, Category = "AssetDump|Editor",
+		meta = (ToolTip = "저장 시 자동 재덤프가 켜져 있는지 반환합니다."))
+	static bool IsAutoRedumpOnSaveEnabled();
+
+	// GetAutoRedumpStatusText는 자동 재덤프 대기/실행/index 재생성 상태 한 줄을 반환한다.
+	UFUNCTION(BlueprintPure, Category = "AssetDump|Editor",
+		meta = (ToolTip = "자동 재덤프의 마지막 상태 요약을 반환합니다."))
+	static FString GetAutoRedumpStatusText();
+
 	// TickActiveDump는 현재 단계 실행형 덤프의 다음 단계를 한 번 진행한다.
 	UFUNCTION(BlueprintCallable, Category = "AssetDump|Editor",
 		meta = (ToolTip = "현재 실행 중인 덤프의 다음 단계를 한 번 진행합니다."))
@@ -118,11 +172,21 @@ public:
 		meta = (ToolTip = "현재 덤프 상태 메시지를 반환합니다."))
 	static FString GetDumpStatusMessage();
 
-	// GetDumpLogText는 자동 줄바꿈 대상이 되는 전체 로그 문자열을 반환한다.
+	// GetDumpLogText는 ring에 남아 있는 최근 로그 전체를 한 문자열로 반환한다.
 	UFUNCTION(BlueprintPure, Category = "AssetDump|Editor",
-		meta = (ToolTip = "현재 덤프의 전체 로그 문자열을 반환합니다."))
+		meta = (ToolTip = "현재 덤프의 최근 로그 문자열을 반환합니다. 오래된 줄은 보존 한도를 넘으면 생략됩니다."))
 	static FString GetDumpLogText();
 
+	// GetDumpStateVersion은 실행 상태 스냅샷 version을 반환한다. 값이 같으면 상태 조회를 생략해도 된다.
+	UFUNCTION(BlueprintPure, Category = "AssetDump|Editor",
+		meta = (ToolTip = "덤프 실행 상태 스냅샷 version을 반환합니다. 이전 값과 같으면 UI 갱신이 필요 없습니다."))
+	static int64 GetDumpStateVersion();
+
+	// GetDumpLogSince는 Sequence 이후 새 로그 줄과 다음 sequence를 반환한다. false면 이전 표시를 버리고 OutLines로 다시 그려야 한다.
+	UFUNCTION(BlueprintCallable, Category = "AssetDump|Editor",
+		meta = (ToolTip = "Sequence 이후 추가된 로그 줄을 반환합니다. false면 로그가 밀려났거나 새 세션이므로 반환 줄로 전체를 다시 그립니다."))
+	static bool GetDumpLogSince(int64 Sequence, TArray<FString>& OutLines, int64& OutNextSequence);
+
 	// HasRetryableFailedDump는 Retry Last Failed 버튼 활성화 여부를 반환한다.
 	UFUNCTION(BlueprintPure, Category = "AssetDump|Editor",
 		meta = (ToolTip = "마지막 failed 실행을 재시도할 수 있는지 반환합니다."))
@@ -1,6 +1,11 @@
 // File: ADumpEditorTab.h
-// Version: v0.7.0
+// Version: v0.12.0
 // Changelog:
+// - v0.12.0: 덤프 단계 진행을 FADumpExecCtrl core ticker로 옮기고 매 frame 덤프 tick timer를 제거.
+// - v0.11.0: 저장 시 자동 재덤프 체크박스와 상태 줄을 추가.
+// - v0.10.0: 선택 에셋/폴더 queue 덤프 버튼과 queue 집계 진행률/ETA 표시 상태를 추가.
+// - v0.9.0: 스냅샷 version이 같으면 상태 갱신을 생략하고, 로그 패널을 sequence delta로 이어 붙이는 상태를 추가.
+// - v0.8.0: 덤프 단계 tick을 매 frame timer로 분리하고 0.1초 timer는 UI 상태 갱신만 담당.
 // - v0.7.0: Dump Open BP, Retry Last Failed, 마지막 실행 시간(ms) UI 상태와 액션을 추가.
 // - v0.6.1: Compile Before Dump, Skip If Up To Date 체크박스와 ini 저장 상태를 추가.
 // - v0.6.0: 전체 탭 스크롤, 옵션 ini 저장/복원, 출력 경로 정규화 helper 선언 추가.
@@ -50,6 +55,19 @@ private:
 	// LastExecutionMilliseconds는 마지막 종료 실행의 총 처리 시간을 ms 단위로 표시한다.
 	int64 LastExecutionMilliseconds = 0;
 
+	// QueueSummaryText는 queue 완료/건너뜀/실패 수와 남은 예상 시간 표시 문자열이다. queue 기록이 없으면 비어 있다.
+	FString QueueSummaryText;
+
+	// LastSeenStateVersion은 마지막으로 반영한 실행 스냅샷 version이다.
+	int64 LastSeenStateVersion = -1;
+
+	// DisplayedLogNextSequence와 DisplayedLogLineCount는 로그 패널에 이어 붙인 마지막 sequence와 줄 수다.
+	int64 DisplayedLogNextSequence = 0;
+	int32 DisplayedLogLineCount = 0;
+
+	// LogDisplayText는 paint마다 FString 변환을 피하려고 로그 변경 시에만 갱신하는 표시 텍스트다.
+	FText LogDisplayText;
+
 	bool bIsDumpRunning = false;
 
 	// bHasRetryableFailedDump는 Retry Last Failed 버튼 활성화 조건이다.
@@ -64,12 +82,18 @@ private:
 
 	void RefreshSelection();
 	void RefreshRuntimeState();
+	// RefreshLogText는 마지막 표시 sequence 이후 로그만 가져와 패널 텍스트에 이어 붙인다.
+	void RefreshLogText();
+	// SetLogText는 로그 원문과 표시 텍스트를 함께 바꾼다.
+	void SetLogText(const FString& InLogText);
 	EActiveTimerReturnType HandleActiveTimerTick(double InCurrentTime, float InDeltaTime);
 
 	FReply HandleRefreshSelectionClicked();
 	FReply HandleDumpSelectedClicked();
 	// HandleDumpOpenBlueprintClicked는 현재 열려 있는 Blueprint 대상으로 덤프를 시작한다.
 	FReply HandleDumpOpenBlueprintClicked();
+	// HandleDumpSelectedAssetsClicked는 Content Browser 선택 에셋/폴더 전체를 queue로 덤프한다.
+	FReply HandleDumpSelectedAssetsClicked();
 	FReply HandleCancelDumpClicked();
 	// HandleRetryLastFailedClicked는 마지막 failed 실행 옵션으로 재시도를 시작한다.
 	FReply HandleRetryLastFailedClicked();
@@ -85,6 +109,8 @@ private:
 	// HandleSkipIfUpToDateCheckStateChanged는 최신 결과 재사용 옵션 상태를 갱신한다.
 	void HandleSkipIfUpToDateCheckStateChanged(ECheckBoxState InNewState);
 	void HandleLinksOnlyCheckStateChanged(ECheckBoxState InNewState);
+	// HandleAutoRedumpCheckStateChanged는 저장 시 자동 재덤프 opt-in을 갱신한다.
+	void HandleAutoRedumpCheckStateChanged(ECheckBoxState InNewState);
 
 	ECheckBoxState GetIncludeSummaryCheckState() const;
 	ECheckBoxState GetIncludeDetailsCheckState() const;
@@ -95,6 +121,8 @@ private:
 	// GetSkipIfUpToDateCheckState는 최신 결과 재사용 옵션 체크 상태를 반환한다.
 	ECheckBoxState GetSkipIfUpToDateCheckState() const;
 	ECheckBoxState GetLinksOnlyCheckState() const;
+	// GetAutoRedumpCheckState는 저장 시 자동 재덤프 체크 상태를 반환한다.
+	ECheckBoxState GetAutoRedumpCheckState() const;
 
 	FText GetSelectedAssetText() const;
 	FText GetResolvedOutputPathText() const;
@@ -107,6 +135,12 @@ private:
 	FText GetErrorCountText() const;
 	// GetLastExecutionMillisecondsText는 마지막 실행 시간(ms) 표시 문자열을 반환한다.
 	FText GetLastExecutionMillisecondsText() const;
+	// GetQueueSummaryText는 queue 집계 표시 문자열을 반환한다.
+	FText GetQueueSummaryText() const;
+	// GetQueueSummaryVisibility는 queue 기록이 있을 때만 집계 줄을 보이게 한다.
+	EVisibility GetQueueSummaryVisibility() const;
+	// GetAutoRedumpStatusText는 자동 재덤프 상태 요약을 반환한다.
+	FText GetAutoRedumpStatusText() const;
 	FText GetLogText() const;
 
 	bool IsDumpRunningEnabled() const;
@@ -1,6 +1,7 @@
 // File: ADumpEntityEvidence.h
-// Version: v1.4.0
+// Version: v1.5.0
 // Changelog:
+// - v1.5.0: kind registry 선언을 AssetDumpQuery module의 ADumpEntityKinds로 옮기고 using 선언으로 기존 이름을 유지.
 // - v1.4.0: P5-N1 niagara_material_v1 exact 19/12 additive registry와 renderer resource Known-registry union contract를 추가.
 // - v1.3.0: P4-N1 niagara_deep_v1 exact 18/12 registry와 additive Known registry union contract를 추가.
 // - v1.2.0: Phase 1 Core, Niagara MVP와 Internal Known registry를 분리하고 Niagara typed projection contract를 추가.
@@ -15,6 +16,7 @@
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 
+#include "ADumpEntityKinds.h"
 #include "ADumpTypes.h"
 
 // ADumpEntityEvidence는 typed native 증거를 entity_evidence_v1 stored section으로 투영한다.
@@ -23,33 +25,15 @@ namespace ADumpEntityEvidence
 	// BuildEntityEvidenceObject는 FADumpResult의 기존 증거를 변형하지 않고 canonical Entity/Relation JSON을 만든다.
 	TSharedRef<FJsonObject> BuildEntityEvidenceObject(const FADumpResult& InDumpResult);
 
-	// GetEntityKindRegistry는 Phase 1에서 허용된 exact Core Entity Kind를 canonical 순서로 반환한다.
-	const TArray<FString>& GetEntityKindRegistry();
-
-	// GetRelationKindRegistry는 Phase 1에서 허용된 exact Core Relation Kind를 canonical 순서로 반환한다.
-	const TArray<FString>& GetRelationKindRegistry();
-
-	// GetNiagaraEntityKindRegistry는 common asset과 Niagara MVP Entity Kind를 canonical 순서로 반환한다.
-	const TArray<FString>& GetNiagaraEntityKindRegistry();
-
-		// GetNiagaraRelationKindRegistry는 Niagara MVP Relation Kind를 canonical 순서로 반환한다.
-	const TArray<FString>& GetNiagaraRelationKindRegistry();
-
-	// GetNiagaraDeepEntityKindRegistry는 Niagara MVP 뒤에 Deep Entity Kind를 append한 exact 18-kind registry를 반환한다.
-	const TArray<FString>& GetNiagaraDeepEntityKindRegistry();
-
-		// GetNiagaraDeepRelationKindRegistry는 Niagara MVP 뒤에 parameter access Relation을 append한 exact 12-kind registry를 반환한다.
-	const TArray<FString>& GetNiagaraDeepRelationKindRegistry();
-
-	// GetNiagaraMaterialEntityKindRegistry는 Deep 뒤에 renderer resource를 append한 exact 19-kind registry를 반환한다.
-	const TArray<FString>& GetNiagaraMaterialEntityKindRegistry();
-
-	// GetNiagaraMaterialRelationKindRegistry는 Deep exact 12 Relation 의미를 그대로 재사용한다.
-	const TArray<FString>& GetNiagaraMaterialRelationKindRegistry();
-
-	// GetKnownEntityKindRegistry는 Core와 Niagara Material Entity registry의 deterministic union을 반환한다.
-	const TArray<FString>& GetKnownEntityKindRegistry();
-
-	// GetKnownRelationKindRegistry는 Core와 Niagara Material Relation registry의 deterministic union을 반환한다.
-	const TArray<FString>& GetKnownRelationKindRegistry();
+	// Entity/Relation kind registry는 entity query와 공유하도록 ADumpEntityKinds에 정의하고 같은 이름으로 다시 공개한다.
+	using ADumpEntityKinds::GetEntityKindRegistry;
+	using ADumpEntityKinds::GetRelationKindRegistry;
+	using ADumpEntityKinds::GetNiagaraEntityKindRegistry;
+	using ADumpEntityKinds::GetNiagaraRelationKindRegistry;
+	using ADumpEntityKinds::GetNiagaraDeepEntityKindRegistry;
+	using ADumpEntityKinds::GetNiagaraDeepRelationKindRegistry;
+	using ADumpEntityKinds::GetNiagaraMaterialEntityKindRegistry;
+	using ADumpEntityKinds::GetNiagaraMaterialRelationKindRegistry;
+	using ADumpEntityKinds::GetKnownEntityKindRegistry;
+	using ADumpEntityKinds::GetKnownRelationKindRegistry;
 }
\ No newline at end of file
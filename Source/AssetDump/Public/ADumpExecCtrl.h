@@ -1,6 +1,14 @@
 // File: ADumpExecCtrl.h
-// Version: v0.3.1
+// Version: v0.9.1
 // Changelog:
+// - v0.9.1: core ticker 해제를 static 소멸 시점의 소멸자에서 module 종료 때 부르는 Shutdown으로 옮김.
+// - v0.9.0: 같은 frame 중복 tick 방지를 없애고, 전역 인스턴스가 실행 중에만 core ticker를 등록해 탭/자동 재덤프 대신 단계를 진행하도록 변경.
+// - v0.8.1: queue 취소 집계 설명에 추출 전에 취소되어 저장 없이 끝난 진행 중 자산을 포함.
+// - v0.8.0: 로그 ring buffer와 sequence 계산을 FADumpLogRing으로 분리해 wraparound/세션 경계 동작을 컨트롤러 없이 검증할 수 있게 함.
+// - v0.7.0: 여러 tick 출처가 같은 frame에 TickDump를 불러도 한 번만 진행하도록 마지막 tick frame을 기록.
+// - v0.6.0: 여러 자산을 연속 덤프하는 queue(StartDumpAssets), 앞 자산 background 저장과 다음 자산 추출 겹치기, 집계 진행률/ETA와 전체 취소를 추가.
+// - v0.5.0: 스냅샷을 상태 변경 시 한 번만 만드는 versioned cache로 바꾸고, 로그를 고정 크기 ring buffer와 sequence 기반 delta 조회(GetLogSince)로 전환.
+// - v0.4.0: TickDump가 frame budget 안에서 여러 단계를 실행하고 저장을 background task로 넘기며, 스냅샷에 background 저장 여부를 추가.
 // - v0.3.1: 세션 로그 저장 경로 설명을 AssetDump 플러그인 Dumped/BPDump/logs 기준으로 갱신.
 // - v0.3.0: 마지막 실패 재시도와 마지막 실행 시간(ms) 스냅샷 필드를 추가.
 // - v0.2.0: 세션 종료 시 Saved/BPDump/Logs 에 실행 로그 파일 저장 기능 추가.
@@ -9,6 +17,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 
 #include "ADumpService.h"
 
@@ -36,14 +45,83 @@ struct FADumpExecSnapshot
 	// StatusMessage는 최근 상태 메시지다.
 	FString StatusMessage;
 
-	// LogText는 자동 줄바꿈 대상이 되는 전체 로그 문자열이다.
-	FString LogText;
+	// SnapshotVersion은 스냅샷을 다시 만들 때마다 증가한다. UI는 값이 같으면 갱신을 생략한다.
+	uint64 SnapshotVersion = 0;
+
+	// NextLogSequence는 다음에 추가될 로그 줄 sequence다. GetLogSince 호출 기준값으로 쓴다.
+	int64 NextLogSequence = 0;
 
 	// bHasLastFailedRun은 재시도 가능한 마지막 실패 실행 정보 보유 여부다.
 	bool bHasLastFailedRun = false;
 
 	// LastExecutionMilliseconds는 마지막 종료 실행의 총 처리 시간을 ms 단위로 기록한다.
 	int64 LastExecutionMilliseconds = 0;
+
+	// bIsSavingInBackground는 dump 결과를 background task에서 저장 중인지 나타낸다. 이 동안에는 취소할 수 없다.
+	bool bIsSavingInBackground = false;
+
+	// bIsQueueRunning은 다중 자산 queue 실행 중인지 나타낸다.
+	bool bIsQueueRunning = false;
+
+	// QueueTotalCount는 queue 전체 자산 수이고, QueueCompletedCount는 저장까지 끝난 자산 수다.
+	int32 QueueTotalCount = 0;
+	int32 QueueCompletedCount = 0;
+
+	// QueueSkippedCount, QueueFailedCount는 완료 자산 중 최신이라 건너뛴 수와 실패 수이고, QueueCanceledCount는 취소로 시작하지 않았거나 저장 없이 중단된 수다.
+	int32 QueueSkippedCount = 0;
+	int32 QueueFailedCount = 0;
+	int32 QueueCanceledCount = 0;
+
+	// QueueSavingCount는 background 저장 중인 앞 자산 수다.
+	int32 QueueSavingCount = 0;
+
+	// QueueProgress01은 진행 중 자산의 단계 진행률까지 반영한 queue 전체 진행률이다.
+	double QueueProgress01 = 0.0;
+
+	// QueueEtaSeconds는 지금까지 처리 속도 기준 남은 예상 시간이다. 추정할 수 없으면 음수다.
+	double QueueEtaSeconds = -1.0;
+};
+
+// FADumpLogRing은 최근 로그 줄을 고정 개수까지 보존하고 줄마다 단조 증가 sequence를 붙이는 ring buffer다.
+class FADumpLogRing
+{
+public:
+	// FADumpLogRing은 InCapacity 줄까지 보존하는 빈 ring을 만든다.
+	explicit FADumpLogRing(int32 InCapacity);
+
+	// Append는 새 줄을 추가한다. 가득 차 있으면 가장 오래된 줄을 밀어낸다. 빈 줄은 무시한다.
+	void Append(const FString& InLine);
+
+	// Reset은 보존 줄을 비운다. sequence는 하나 건너뛰며 계속 증가해 이전 기준 delta 요청이 끊김으로 판정된다.
+	void Reset();
+
+	// GetSince는 InSequence 이후 줄을 OutLines에 추가하고 다음 sequence를 돌려준다. 요청 줄이 밀려났거나 Reset으로 비워졌으면 보존된 전체 줄을 주고 false를 반환한다.
+	bool GetSince(int64 InSequence, TArray<FString>& OutLines, int64& OutNextSequence) const;
+
+	// GetFirstSequence는 ring에 남아 있는 가장 오래된 줄의 sequence다.
+	int64 GetFirstSequence() const { return FirstSequence; }
+
+	// GetNextSequence는 다음에 추가될 줄의 sequence다.
+	int64 GetNextSequence() const { return NextSequence; }
+
+	// GetDroppedLineCount는 마지막 Reset 뒤 밀려난 줄 수다.
+	int64 GetDroppedLineCount() const { return FirstSequence - BaseSequence; }
+
+private:
+	// Capacity는 보존할 최대 줄 수다.
+	int32 Capacity = 0;
+
+	// Lines는 ring 저장소다.
+	TArray<FString> Lines;
+
+	// BaseSequence는 Lines index 0에 처음 들어간 줄의 sequence다.
+	int64 BaseSequence = 0;
+
+	// FirstSequence는 ring에 남아 있는 가장 오래된 줄의 sequence다.
+	int64 FirstSequence = 0;
+
+	// NextSequence는 다음에 추가될 줄의 sequence다.
+	int64 NextSequence = 0;
 };
 
 // FADumpExecCtrl은 에디터 탭에서 단계 실행형 덤프를 제어하는 싱글톤 컨트롤러다.
@@ -53,13 +131,22 @@ public:
 	// Get는 전역 단일 실행 컨트롤러 인스턴스를 반환한다.
 	static FADumpExecCtrl& Get();
 
+	// FADumpExecCtrl은 생성 시 초기 스냅샷을 만든다. bInTickOnCoreTicker가 true면 실행 중 core ticker로 스스로 단계를 진행한다.
+	explicit FADumpExecCtrl(bool bInTickOnCoreTicker = false);
+
+	// Shutdown은 module 종료 시 등록한 core ticker를 해제하고 이후 실행이 다시 등록하지 않게 한다. 전역 인스턴스는 static 소멸 때 engine을 부르지 않는다.
+	void Shutdown();
+
 	// StartDump는 새 덤프 세션을 시작한다.
 	bool StartDump(const FADumpRunOpts& InRunOpts, FString& OutMessage);
 
-	// TickDump는 다음 단계 하나를 실행하고 최신 스냅샷을 갱신한다.
+	// StartDumpAssets는 자산별 실행 옵션 목록을 queue로 받아 순서대로 덤프를 시작한다.
+	bool StartDumpAssets(const TArray<FADumpRunOpts>& InRunOptsList, FString& OutMessage);
+
+	// TickDump는 frame budget 안에서 다음 단계들을 실행하거나 background 저장 완료를 확인하고 최신 스냅샷을 갱신한다. 호출할 때마다 한 단계 진행한다.
 	bool TickDump(FString& OutMessage);
 
-	// CancelDump는 현재 세션 취소를 요청한다.
+	// CancelDump는 현재 세션 취소를 요청한다. queue 실행 중이면 남은 자산도 모두 취소한다.
 	void CancelDump();
 
 	// RetryLastFailedDump는 마지막 failed 실행의 옵션으로 다시 시작한다.
@@ -68,8 +155,14 @@ public:
 	// IsRunning은 현재 세션이 실행 중인지 반환한다.
 	bool IsRunning() const;
 
-	// GetSnapshot은 현재 UI 표시용 스냅샷을 반환한다.
-	FADumpExecSnapshot GetSnapshot() const;
+	// GetSnapshot은 마지막 상태 변경 때 만든 UI 표시용 스냅샷을 반환한다.
+	const FADumpExecSnapshot& GetSnapshot() const;
+
+	// GetLogSince는 InSequence 이후 로그 줄을 OutLines에 추가하고 다음 sequence를 돌려준다. 요청 줄이 ring에서 밀려났거나 새 세션으로 비워졌으면 보존된 전체 줄을 주고 false를 반환한다.
+	bool GetLogSince(int64 InSequence, TArray<FString>& OutLines, int64& OutNextSequence) const;
+
+	// BuildLogText는 ring에 남아 있는 로그 줄을 한 문자열로 합친다.
+	FString BuildLogText() const;
 
 private:
 	// AppendLogLine은 상태 로그에 새 줄을 추가한다.
@@ -78,6 +171,33 @@ private:
 	// BuildSnapshot은 현재 상태를 UI용 구조체로 만든다.
 	FADumpExecSnapshot BuildSnapshot() const;
 
+	// PublishSnapshot은 상태 변경 뒤 스냅샷을 한 번 다시 만들고 version을 올린다.
+	void PublishSnapshot();
+
+	// RegisterCoreTicker는 core ticker 사용 인스턴스가 실행을 시작할 때 매 frame tick을 등록한다.
+	void RegisterCoreTicker();
+
+	// HandleCoreTick은 실행 중이면 TickDump를 한 번 부르고, 실행이 끝나면 false를 반환해 등록을 해제한다.
+	bool HandleCoreTick(float InDeltaSeconds);
+
+	// TickQueue는 queue 실행의 저장 완료 확인, 현재 자산 진행, 다음 자산 시작을 한 tick만큼 처리한다.
+	bool TickQueue(FString& OutMessage);
+
+	// PollQueueSavingServices는 background 저장이 끝난 앞 자산 서비스를 마무리하고 집계에 반영한다.
+	void PollQueueSavingServices();
+
+	// StartNextQueuedAsset은 queue의 다음 자산 세션을 시작한다. 시작할 자산이 없으면 false다.
+	bool StartNextQueuedAsset();
+
+	// RecordQueueOutcome은 끝난 자산 세션 결과를 queue 집계와 로그에 반영한다.
+	void RecordQueueOutcome(const FADumpService& InFinishedService);
+
+	// FinishQueue는 queue 실행을 종료하고 요약 로그와 세션 로그 파일을 남긴다.
+	void FinishQueue();
+
+	// ResetLogRing은 새 세션 시작 시 보존 로그를 비운다. sequence는 세션 경계에서 하나 건너뛰며 계속 증가한다.
+	void ResetLogRing();
+
 	// BuildLogFilePath는 현재 세션 로그를 저장할 로그 파일 경로를 만든다.
 	FString BuildLogFilePath() const;
 
@@ -106,6 +226,37 @@ private:
 	// LastExecutionMilliseconds는 마지막 종료 실행의 총 처리 시간을 ms 단위로 보관한다.
 	int64 LastExecutionMilliseconds = 0;
 
-	// LogLines는 UI 로그 패널에 표시할 줄 목록이다.
-	TArray<FString> LogLines;
+	// LogRing은 최근 로그 줄을 고정 개수까지 보존하는 ring buffer다.
+	FADumpLogRing LogRing;
+
+	// bIsQueueRunning은 현재 실행이 다중 자산 queue인지 나타낸다.
+	bool bIsQueueRunning = false;
+
+	// bQueueCancelRequested는 queue 전체 취소가 요청되었는지 나타낸다.
+	bool bQueueCancelRequested = false;
+
+	// QueueRunOptsList는 queue 자산별 실행 옵션이고, QueueNextIndex는 다음에 시작할 index다.
+	TArray<FADumpRunOpts> QueueRunOptsList;
+	int32 QueueNextIndex = 0;
+
+	// Queue*Count는 queue 완료/건너뜀/실패/취소 집계다.
+	int32 QueueCompletedCount = 0;
+	int32 QueueSkippedCount = 0;
+	int32 QueueFailedCount = 0;
+	int32 QueueCanceledCount = 0;
+
+	// QueueStartSeconds는 queue ETA 계산 기준 시작 시각이다.
+	double QueueStartSeconds = 0.0;
+
+	// QueueSavingServices는 background 저장 중인 앞 자산 세션이다. 그동안 DumpService는 다음 자산을 추출한다.
+	TArray<TUniquePtr<FADumpService>> QueueSavingServices;
+
+	// bTickOnCoreTicker는 이 인스턴스가 실행 중 core ticker로 스스로 진행하는지 나타낸다. 전역 인스턴스만 true다.
+	bool bTickOnCoreTicker = false;
+
+	// CoreTickerHandle은 실행 중 등록한 core ticker handle이다.
+	FTSTicker::FDelegateHandle CoreTickerHandle;
+
+	// CachedSnapshot은 마지막 PublishSnapshot 결과다.
+	FADumpExecSnapshot CachedSnapshot;
 };
@@ -0,0 +1,72 @@
+// File: ADumpImpactGraph.h
+// Version: v1.0.0
+// Changelog:
+// - v1.0.0: dependency_index SCC condensation, 전이 closure count와 -Mode=impact query 계약을 추가.
+// Migration:
+// - dependency_index.json relation 전체(hard/soft)를 입력으로 쓰는 additive impact_index_v1이며 기존 dependencyquery 의미를 변경하지 않는다.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// FADumpImpactGraph는 node ordinal 기준 dependency graph의 SCC condensation과 SCC별 전이 closure count다.
+struct ASSETDUMP_API FADumpImpactGraph
+{
+	// NodeCount는 graph node 수다.
+	int32 NodeCount = 0;
+
+	// SccCount는 강연결 요소 수다. SCC id는 Tarjan 완료 순서이므로 dependency edge는 항상 큰 id에서 작은 id로 향한다.
+	int32 SccCount = 0;
+
+	// NodeScc는 node ordinal별 SCC id다.
+	TArray<int32> NodeScc;
+
+	// SccMemberOffsets와 SccMembers는 SCC별 오름차순 node ordinal CSR이다.
+	TArray<int32> SccMemberOffsets;
+	TArray<int32> SccMembers;
+
+	// DagForwardOffsets와 DagForwardTargets는 condensed DAG의 dependency 방향 CSR이다.
+	TArray<int32> DagForwardOffsets;
+	TArray<int32> DagForwardTargets;
+
+	// DagReverseOffsets와 DagReverseTargets는 condensed DAG의 dependent 방향 CSR이다.
+	TArray<int32> DagReverseOffsets;
+	TArray<int32> DagReverseTargets;
+
+	// DependencyCounts는 SCC member 하나가 전이적으로 의존하는 node 수(자기 자신 제외)다.
+	TArray<int32> DependencyCounts;
+
+	// DependentCounts는 SCC member 하나에 전이적으로 의존하는 node 수(자기 자신 제외)다.
+	TArray<int32> DependentCounts;
+};
+
+// ADumpImpactGraph는 dependency_index 위의 전역 영향 분석 index 생성과 read-only impact query를 제공한다.
+namespace ADumpImpactGraph
+{
+	// BuildImpactGraph는 node ordinal edge 목록을 SCC로 압축하고 block bitset closure로 양방향 전이 count를 계산한다.
+	ASSETDUMP_API void BuildImpactGraph(
+		int32 InNodeCount,
+		const TArray<TPair<int32, int32>>& InEdges,
+		FADumpImpactGraph& OutGraph);
+
+	// CollectReachableNodes는 InNode에서 도달 가능한 node ordinal을 자기 자신을 제외하고 오름차순으로 모은다.
+	ASSETDUMP_API void CollectReachableNodes(
+		const FADumpImpactGraph& InGraph,
+		int32 InNode,
+		bool bInDependents,
+		TArray<int32>& OutNodes);
+
+	// BuildImpactIndex는 dump root의 dependency_index.json에서 impact_index_v1을 원자 저장한다.
+	ASSETDUMP_API bool BuildImpactIndex(
+		const FString& InDumpRootPath,
+		FString& OutImpactIndexFilePath,
+		FString& OutErrorCode,
+		FString& OutErrorDetail);
+
+	// BuildImpactQueryJson은 -Mode=impact command line을 검증하고 impact_query_result_v1을 만든다.
+	ASSETDUMP_API bool BuildImpactQueryJson(
+		const FString& InCommandLine,
+		FString& OutJsonText,
+		FString& OutErrorCode,
+		FString& OutErrorDetail);
+}
@@ -1,6 +1,14 @@
 // File: ADumpJson.h
-// Version: v0.7.0
+// Version: v0.14.1
 // Changelog:
+// - v0.14.1: ADumpQueryIO의 MakeJsonFileStamp를 같은 이름으로 다시 공개.
+// - v0.14.0: 자산 출력 폴더 manifest가 가리키는 asset.object_path 읽기 helper를 공개.
+// - v0.13.0: 읽기 helper, FADumpJsonValueSpan과 비압축 저장을 ADumpQueryIO로 옮기고 같은 이름으로 다시 공개.
+// - v0.12.0: content store 저장 sidecar를 manifest content_refs와 hash blob에서 복원하는 읽기/존재/stat fallback을 추가.
+// - v0.11.0: output encoding pack 저장, 실제 파일이 없을 때 상위 dump pack을 읽는 JSON 읽기 fallback과 존재/stat helper를 추가.
+// - v0.10.0: gzip/compact output encoding 저장과 압축 여부를 감지해 투명하게 해제하는 JSON 읽기 helper를 추가.
+// - v0.9.0: stored JSON의 root member value byte span scan과 CRC32 검증 span 읽기 helper를 공개.
+// - v0.8.0: batch diff가 per-asset data_asset_diff section을 저장할 수 있도록 diff object 직렬화 helper를 공개.
 // - v0.7.0: request metadata용 candidate output path와 실제 writable output path 해석을 분리.
 // - v0.6.0: mutation 없는 기본 경로 계산과 실제 writable 준비 helper를 분리해 explicit output 실행의 선제 디렉터리 생성을 제거.
 // - v0.5.0: ASSETDUMP_OUTPUT_ROOT, writable PluginRoot/Dumped와 Project/Saved/AssetDump fallback의 source-aware 기본 출력 helper로 확장.
@@ -13,10 +21,25 @@
 
 #include "CoreMinimal.h"
 
+#include "ADumpQueryIO.h"
 #include "ADumpTypes.h"
 
 namespace ADumpJson
 {
+	// 읽기 helper, 임시 경로 계산과 비압축 원자 저장은 에디터 없이 빌드되는 ADumpQueryIO 구현을 그대로 쓴다.
+	using ADumpQueryIO::BuildTempOutputFilePath;
+	using ADumpQueryIO::SaveJsonTextToFile;
+	using ADumpQueryIO::IsCompressedJsonBytes;
+	using ADumpQueryIO::DecompressJsonBytes;
+	using ADumpQueryIO::LoadJsonBytesFromFile;
+	using ADumpQueryIO::LoadJsonTextFromFile;
+	using ADumpQueryIO::DoesJsonFileExist;
+	using ADumpQueryIO::GetJsonFileStat;
+	using ADumpQueryIO::MakeJsonFileStamp;
+	using ADumpQueryIO::ScanRootMemberValueSpans;
+	using ADumpQueryIO::ParseJsonValueSpan;
+	using ADumpQueryIO::LoadJsonValueFromFileSpan;
+
 	// BuildDefaultDumpRootDirectory는 환경 변수 또는 legacy Plugin Dumped 기본 후보를 mutation 없이 계산한다.
 	FString BuildDefaultDumpRootDirectory(FString* OutSource = nullptr);
 
@@ -35,18 +58,24 @@ namespace ADumpJson
 	// ResolveOutputFilePath는 실제 저장용 경로를 계산하며 명시 경로가 없으면 writable 기본 루트를 준비한다.
 	FString ResolveOutputFilePath(const FString& UserOutputPath, const FString& AssetObjectPath);
 
-	// BuildTempOutputFilePath는 원자적 교체를 위한 임시 파일 경로를 계산한다.
-	FString BuildTempOutputFilePath(const FString& FinalOutputFilePath);
+	// LoadManifestObjectPath는 manifest.json의 asset.object_path를 읽는다. 읽을 수 없으면 빈 문자열이다. 폴더 이름이 같은 다른 자산 dump를 구분할 때 쓴다.
+	FString LoadManifestObjectPath(const FString& InManifestFilePath);
 
 	// MakeResultObject는 FADumpResult를 JSON object 트리로 변환한다.
 	TSharedRef<FJsonObject> MakeResultObject(const FADumpResult& InDumpResult);
 
+	// MakeDataAssetDiffSectionObject는 data_asset_diff_v1 section 하나를 dump.json과 같은 형식의 JSON object로 변환한다.
+	TSharedRef<FJsonObject> MakeDataAssetDiffSectionObject(const FADumpDataAssetDiff& InDataAssetDiff);
+
 	// SerializeResult는 결과 구조를 JSON 문자열로 직렬화한다.
 	bool SerializeResult(const FADumpResult& InDumpResult, FString& OutJsonText, bool bPrettyPrint = true);
 
-	// SaveJsonTextToFile은 BOM 없는 UTF-8로 temp -> final 교체 저장을 수행한다.
-	bool SaveJsonTextToFile(const FString& FinalOutputFilePath, const FString& JsonText, FString& OutErrorMessage);
+	// SaveJsonTextToFile은 output encoding의 codec으로 압축한 byte를 temp -> final 교체 저장한다.
+	bool SaveJsonTextToFile(const FString& FinalOutputFilePath, const FString& JsonText, const FADumpOutputEncoding& InOutputEncoding, FString& OutErrorMessage);
 
 	// SaveResultToFile은 결과 구조 직렬화와 저장을 한 번에 수행한다.
 	bool SaveResultToFile(const FString& FinalOutputFilePath, const FADumpResult& InDumpResult, FString& OutErrorMessage);
+
+	// SaveResultToFile은 dump.json과 sidecar를 output encoding의 직렬화 형태와 codec으로 저장한다.
+	bool SaveResultToFile(const FString& FinalOutputFilePath, const FADumpResult& InDumpResult, const FADumpOutputEncoding& InOutputEncoding, FString& OutErrorMessage);
 }
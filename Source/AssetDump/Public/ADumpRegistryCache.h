@@ -0,0 +1,64 @@
+// File: ADumpRegistryCache.h
+// Version: v1.1.0
+// Changelog:
+// - v1.1.0: watch가 지운 package를 registry와 상태 cache에서 빼는 RemoveDeletedPackageFiles를 추가.
+// - v1.0.0: root별 Asset Registry 상태 cache 저장/재사용(package 파일 stamp 증분 검증)과 process당 한 번 scan 보장을 추가.
+// Migration:
+// - 디스크 cache는 opt-in(-RegistryCache=true)이다. 끄면 같은 process의 중복 scan만 생략하고 첫 scan은 기존처럼 ScanPathsSynchronous(force)로 한다.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// FADumpRegistryScanReport는 scan root 하나의 scan 생략/cache 재사용 결과다.
+struct ASSETDUMP_API FADumpRegistryScanReport
+{
+	// RootPath는 scan한 long package root이고, CacheFilePath는 사용한 상태 cache 파일 경로다.
+	FString RootPath;
+	FString CacheFilePath;
+
+	// bSkippedInProcess는 같은 process에서 이미 scan한 root 아래라 아무것도 하지 않았는지 여부다.
+	bool bSkippedInProcess = false;
+
+	// bCacheLoaded는 저장된 상태를 registry에 합치고 바뀐 파일만 다시 scan했는지, bCacheSaved는 이번 상태를 cache로 저장했는지 여부다.
+	bool bCacheLoaded = false;
+	bool bCacheSaved = false;
+
+	// PackageFileCount는 root 폴더의 package 파일 수, ChangedFileCount와 RemovedFileCount는 cache 기준 추가·수정/삭제 파일 수다.
+	int32 PackageFileCount = 0;
+	int32 ChangedFileCount = 0;
+	int32 RemovedFileCount = 0;
+
+	// ScanMilliseconds는 stamp 검증, 상태 적용과 scan 전체 소요 시간이다.
+	double ScanMilliseconds = 0.0;
+
+	// CacheErrorCode와 CacheErrorDetail은 cache를 쓰지 못해 전체 scan으로 fallback한 사유다. 첫 실행처럼 cache가 없으면 비어 있다.
+	FString CacheErrorCode;
+	FString CacheErrorDetail;
+};
+
+// ADumpRegistryCache는 commandlet 시작 시 Asset Registry scan 비용을 root별 상태 cache와 process 내 중복 제거로 줄인다.
+namespace ADumpRegistryCache
+{
+	// IsStateCacheRequested는 명령줄의 -RegistryCache=true 여부다.
+	ASSETDUMP_API bool IsStateCacheRequested(const FString& InCommandLine);
+
+	// GetDefaultCacheDirectory는 -RegistryCacheDir=가 없을 때 쓰는 Project Intermediate 아래 cache 폴더다.
+	ASSETDUMP_API FString GetDefaultCacheDirectory();
+
+	// ScanPathsOnce는 같은 process에서 이미 scan한 root 아래 경로를 건너뛰고, 나머지는 명령줄 opt-in에 따라 상태 cache 또는 전체 scan으로 registry에 올린다.
+	ASSETDUMP_API TArray<FADumpRegistryScanReport> ScanPathsOnce(const TArray<FString>& InPackagePaths, const FString& InCommandLine);
+
+	// ScanRootWithStateCache는 process 기록과 무관하게 root 하나를 cache 검증 후 증분 scan하고, 바뀐 상태를 cache로 다시 저장한다.
+	ASSETDUMP_API FADumpRegistryScanReport ScanRootWithStateCache(const FString& InRootPath, const FString& InCacheDirectory);
+
+	// RemoveDeletedPackageFiles는 지워진 package 파일의 자산을 in-memory registry에서 빼고, 상태 cache를 쓰면 그 파일이 속한 scan root cache를 현재 상태로 다시 저장한다.
+	ASSETDUMP_API void RemoveDeletedPackageFiles(const TArray<FString>& InDeletedFilePaths, const FString& InCommandLine);
+
+	// DiffPackageFileStamps는 cache와 현재 package 파일 stamp를 비교해 추가·수정 파일과 삭제 파일 상대 경로를 정렬해 돌려준다.
+	ASSETDUMP_API void DiffPackageFileStamps(
+		const TMap<FString, FString>& InCachedStampByFile,
+		const TMap<FString, FString>& InCurrentStampByFile,
+		TArray<FString>& OutChangedFiles,
+		TArray<FString>& OutRemovedFiles);
+}
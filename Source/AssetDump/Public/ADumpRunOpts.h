@@ -1,6 +1,7 @@
 // File: ADumpRunOpts.h
-// Version: v0.11.0
+// Version: v0.12.0
 // Changelog:
+// - v0.12.0: dump.json/sidecar 압축 codec과 compact JSON 저장 옵션을 추가.
 // - v0.11.0: bp_search_index builder와 graph dependency helper를 추가.
 // - v0.10.0: request metadata용 비mutation output candidate resolver를 추가.
 // - v0.9.0: component_tree 전용 builder 실행 판단 helper를 추가.
@@ -79,6 +80,9 @@ struct FADumpRunOpts
 	// OutputFilePath는 최종 결과 저장 경로다. 비면 기본 경로를 계산한다.
 	FString OutputFilePath;
 
+	// OutputEncoding은 dump.json과 sidecar 저장 codec과 compact JSON 여부다.
+	FADumpOutputEncoding OutputEncoding;
+
 	// IsValid는 실행 요청의 최소 유효성을 검사한다.
 	bool IsValid() const;
 
@@ -1,6 +1,9 @@
 // File: ADumpService.h
-// Version: v0.6.0
+// Version: v0.9.0
 // Changelog:
+// - v0.9.0: 시작했지만 아직 세션에 반영하지 않은 background 저장이 있는지 조회(IsBackgroundSavePending)를 추가.
+// - v0.8.0: 최신 결과로 세션을 건너뛰었는지 조회(WasSkippedUpToDate)와 세션 대상 자산 경로 조회를 추가해 다중 자산 queue 집계에 사용.
+// - v0.7.0: frame budget 단위 단계 실행(TickDumpSession)과 game thread 밖 background 저장 상태 조회를 추가.
 // - v0.6.0: v0.6.1 섹션 선택 기반 builder phase 제어 책임을 명시.
 // - v0.5.0: 최종 상태를 저장 전 결과에 반영하고 취소 시 부분 저장 경로와 총 처리 시간 추적을 추가.
 // - v0.4.1: dump 파일 실제 저장 여부를 추적해 저장 실패 상태를 별도로 판정.
@@ -11,6 +14,8 @@
 
 #include "CoreMinimal.h"
 
+#include "Async/Future.h"
+
 #include "ADumpRunOpts.h"
 #include "ADumpTypes.h"
 
@@ -24,9 +29,21 @@ public:
 	// BeginDumpSession은 단계 실행형 덤프 세션을 시작한다.
 	bool BeginDumpSession(const FADumpRunOpts& InRunOpts, FString& OutMessage);
 
-	// ExecuteNextStep는 현재 세션의 다음 단계를 한 번만 실행한다.
+	// ExecuteNextStep는 현재 세션의 다음 단계를 한 번만 실행한다. background 저장이 진행 중이면 끝날 때까지 기다린다.
 	bool ExecuteNextStep(FString& OutMessage);
 
+	// TickDumpSession은 frame budget 안에서 game thread 단계를 이어 실행하고, 저장 단계는 background task로 넘긴 뒤 완료를 polling한다.
+	bool TickDumpSession(double InFrameBudgetSeconds, FString& OutMessage);
+
+	// IsBackgroundSaveInFlight는 background 저장 task가 아직 끝나지 않았는지 반환한다.
+	bool IsBackgroundSaveInFlight() const;
+
+	// IsBackgroundSavePending은 background 저장을 시작했고 그 결과를 아직 세션에 반영하지 않았는지 반환한다.
+	bool IsBackgroundSavePending() const;
+
+	// WasSkippedUpToDate는 마지막 세션이 manifest fingerprint 최신성 판정으로 건너뛰어졌는지 반환한다.
+	bool WasSkippedUpToDate() const;
+
 	// SaveDumpJson은 결과 구조를 JSON 파일로 저장한다.
 	bool SaveDumpJson(const FString& InFilePath, const FADumpResult& InResult, FString& OutErrorMessage) const;
 
@@ -51,6 +68,9 @@ public:
 	// GetErrorCount는 현재 세션 기준 error 개수를 반환한다.
 	int32 GetErrorCount() const;
 
+	// GetActiveAssetObjectPath는 현재 또는 마지막 세션의 대상 자산 경로를 반환한다.
+	const FString& GetActiveAssetObjectPath() const;
+
 	// GetResolvedOutputFilePath는 현재 세션의 최종 출력 파일 경로를 반환한다.
 	FString GetResolvedOutputFilePath() const;
 
@@ -82,6 +102,28 @@ private:
 	// ResolveNextPhase는 현재 단계 다음에 실행할 활성 단계를 계산한다.
 	EADumpPhase ResolveNextPhase(EADumpPhase InCurrentPhase) const;
 
+	// PrepareResultToWrite는 저장 단계 진행 상태를 갱신하고 최종 상태가 반영된 저장용 결과를 만든다.
+	FADumpResult PrepareResultToWrite();
+
+	// ApplySaveOutcome은 동기/background 저장 결과를 세션 결과와 상태에 반영하고 세션을 종료한다.
+	bool ApplySaveOutcome(
+		FADumpResult&& InResultToWrite,
+		const FString& InResolvedOutputFilePath,
+		bool bInSaveSucceeded,
+		bool bInOutputFileExists,
+		const FString& InSaveErrorMessage,
+		double InSaveSeconds,
+		FString& OutMessage);
+
+	// BeginBackgroundSave는 game thread에서 fingerprint를 미리 계산한 결과를 background task 저장으로 넘긴다.
+	void BeginBackgroundSave(FString& OutMessage);
+
+	// CompleteBackgroundSave는 끝난 background 저장 결과를 game thread에서 세션에 반영한다.
+	bool CompleteBackgroundSave(FString& OutMessage);
+
+	// FBackgroundSaveState는 background 저장 task와 game thread가 공유하는 입력/결과 묶음이다.
+	struct FBackgroundSaveState;
+
 private:
 	// ActiveRunOpts는 현재 단계 실행 세션에 사용 중인 옵션이다.
 	FADumpRunOpts ActiveRunOpts;
@@ -110,9 +152,18 @@ private:
 	// bOutputFileSaved는 이번 세션에서 최종 dump 파일이 실제로 확보되었는지 추적한다.
 	bool bOutputFileSaved = false;
 
+	// bSkippedUpToDate는 이번 세션이 최신 결과 판정으로 건너뛰어졌는지 나타낸다.
+	bool bSkippedUpToDate = false;
+
 	// StatusMessage는 사용자 표시용 최근 상태 문구다.
 	FString StatusMessage;
 
 	// SessionStartSeconds는 총 처리 시간 계산에 사용할 세션 시작 시각이다.
 	double SessionStartSeconds = 0.0;
+
+	// BackgroundSaveState는 진행 중 background 저장의 공유 상태다. 저장 중이 아니면 비어 있다.
+	TSharedPtr<FBackgroundSaveState, ESPMode::ThreadSafe> BackgroundSaveState;
+
+	// BackgroundSaveFuture는 background 저장 task 완료 신호다.
+	TFuture<void> BackgroundSaveFuture;
 };
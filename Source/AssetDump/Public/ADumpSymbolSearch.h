@@ -0,0 +1,28 @@
+// File: ADumpSymbolSearch.h
+// Version: v1.0.0
+// Changelog:
+// - v1.0.0: dump root 전역 symbol_search_index_v1 inverted index와 -Mode=search query 계약을 추가.
+// Migration:
+// - section_index_v1의 symbols 배열을 입력으로 쓰는 additive index이며 기존 index 파일의 의미를 변경하지 않는다.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// ADumpSymbolSearch는 dump root 전체 Blueprint symbol의 token/trigram inverted index와 read-only 검색 경로를 제공한다.
+namespace ADumpSymbolSearch
+{
+	// BuildSymbolSearchIndex는 dump root의 section_index.json symbols에서 symbol_search_index_v1을 원자 저장한다.
+	ASSETDUMP_API bool BuildSymbolSearchIndex(
+		const FString& InDumpRootPath,
+		FString& OutSymbolSearchIndexFilePath,
+		FString& OutErrorCode,
+		FString& OutErrorDetail);
+
+	// BuildSymbolSearchJson은 -Mode=search command line을 검증하고 symbol_search_result_v1을 만든다.
+	ASSETDUMP_API bool BuildSymbolSearchJson(
+		const FString& InCommandLine,
+		FString& OutJsonText,
+		FString& OutErrorCode,
+		FString& OutErrorDetail);
+}
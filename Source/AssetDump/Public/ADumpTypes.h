@@ -1,6 +1,13 @@
 // File: ADumpTypes.h
-// Version: v0.30.1
+// Version: v0.35.2
 // Changelog:
+// - v0.35.2: AssetDumpQuery module의 ADumpEntityQuery.h와 중복되던 ADumpEntityQuery forward 선언을 제거.
+// - v0.35.1: ADumpEntityQuery::BuildEntityIndex forward 선언에 단일 thread 비교 옵션을 맞춤.
+// - v0.35.0: background 저장이 UObject/AssetRegistry를 읽지 않도록 game thread에서 미리 계산한 fingerprint(PrecomputedFingerprint)를 FADumpResult에 추가.
+// - v0.34.0: FADumpOutputEncoding에 section payload content-addressed store 경로(ContentStorePath)를 추가.
+// - v0.33.0: FADumpOutputEncoding에 dump root 단일 pack 저장 경로(PackFilePath)를 추가.
+// - v0.32.0: dump.json/sidecar 저장 codec, 압축 강도와 compact JSON 선택을 담는 FADumpOutputEncoding을 추가.
+// - v0.31.0: data_asset_diff 비교용 value structural hash를 FADumpDataAssetDiffValue에 추가.
 // - v0.30.1: cross-process 변동하는 UNiagaraSystem::GetAssetGuid()를 deterministic evidence에서 제외하고 object-path/stable-key identity를 유지.
 // - v0.30.0: AIRE Core Settings Coverage용 Niagara System/Emitter의 bounds, scalability, simulation/local-space, determinism과 inventory summary typed evidence를 additive하게 추가.
 // - v0.29.0: P5-MI v1 material_instance_detail_v1용 immediate parent, direct scalar/vector/texture/static-switch override와 effective/base-property evidence를 additive하게 추가.
@@ -106,6 +113,40 @@ enum class EADumpLinksMeta : uint8
 	Min
 };
 
+// EADumpOutputCompression은 dump.json과 sidecar 파일의 저장 codec이다.
+enum class EADumpOutputCompression : uint8
+{
+	None,
+	Gzip
+};
+
+// EADumpOutputCompressionLevel은 codec 압축 강도 선택이다.
+enum class EADumpOutputCompressionLevel : uint8
+{
+	Fast,
+	Default,
+	Max
+};
+
+// FADumpOutputEncoding은 dump.json과 sidecar의 직렬화 형태와 압축 옵션이다. 파일 이름은 codec과 무관하게 유지한다.
+struct FADumpOutputEncoding
+{
+	// Compression은 저장 codec이다.
+	EADumpOutputCompression Compression = EADumpOutputCompression::None;
+
+	// CompressionLevel은 Compression이 None이 아닐 때의 압축 강도다.
+	EADumpOutputCompressionLevel CompressionLevel = EADumpOutputCompressionLevel::Default;
+
+	// bCompactJson은 pretty print 대신 condensed JSON으로 직렬화할지 여부다.
+	bool bCompactJson = false;
+
+	// PackFilePath가 비어 있지 않으면 개별 파일 대신 이 pack에 같은 상대 경로로 append한다.
+	FString PackFilePath;
+
+	// ContentStorePath가 비어 있지 않으면 공통 필드를 뺀 section sidecar payload를 이 store에 hash blob으로 한 번만 저장하고 manifest가 hash를 참조한다.
+	FString ContentStorePath;
+};
+
 // ADumpEntityEvidence forward contract는 stored section serializer가 pure Entity builder를 호출할 수 있게 한다.
 class FJsonObject;
 struct FADumpResult;
@@ -115,19 +156,6 @@ namespace ADumpEntityEvidence
 	TSharedRef<FJsonObject> BuildEntityEvidenceObject(const FADumpResult& InDumpResult);
 }
 
-// ADumpEntityQuery forward contract는 Commandlet가 전용 Entity index/query/context core를 호출할 수 있게 한다.
-namespace ADumpEntityQuery
-{
-	// BuildEntityIndex는 현재 dump root의 stored Entity evidence를 entity_index_v1으로 만든다.
-	bool BuildEntityIndex(const FString& InDumpRootPath, FString& OutEntityIndexFilePath, FString& OutErrorCode, FString& OutErrorDetail);
-
-	// BuildEntityQueryJson은 entityquery list/get/expand success JSON을 만든다.
-	bool BuildEntityQueryJson(const FString& InCommandLine, FString& OutJsonText, FString& OutErrorCode, FString& OutErrorDetail);
-
-	// BuildEntityContextJson은 entity_query_result_v1을 entity_context_bundle_v1로 변환한다.
-	bool BuildEntityContextJson(const FString& InCommandLine, FString& OutJsonText, FString& OutErrorCode, FString& OutErrorDetail);
-}
-
 struct FADumpIssue;
 struct FADumpNiagaraEvidence;
 namespace ADumpNiagara
@@ -1042,9 +1070,12 @@ struct FADumpDataAssetDiffValue
 	// ValueKind는 data_asset_values_v1의 value_kind 문자열이다.
 	FString ValueKind;
 
-	// ValueJson은 구조화된 canonical 비교 값이다.
+	// ValueJson은 구조화된 비교 값이며 변경 항목에 들어갈 때 canonical 사본으로 바뀐다.
 	TSharedPtr<FJsonValue> ValueJson;
 
+	// ValueHash는 ValueJson의 object key 순서 무관 structural 64-bit hash다.
+	uint64 ValueHash = 0;
+
 	// ValueText는 구조화가 어렵거나 잘린 값의 텍스트 백업이다.
 	FString ValueText;
 
@@ -2377,6 +2408,9 @@ struct FADumpResult
 	// Progress는 마지막 진행 상태 스냅샷이다.
 	FADumpProgressState Progress;
 
+	// PrecomputedFingerprint는 저장 직전 game thread에서 계산한 asset fingerprint다. 비어 있으면 serializer가 직접 계산한다(game thread 전용).
+	FString PrecomputedFingerprint;
+
 	// CreateDefault는 기본 메타 필드가 채워진 결과 구조를 만든다.
 	static FADumpResult CreateDefault();
 };
@@ -1,6 +1,9 @@
 // File: AssetDumpCommandlet.h
-// Version: v0.4.2
+// Version: v0.4.5
 // Changelog:
+// - v0.4.5: index build와 JSON 저장을 static으로 바꿔 에디터 background rebuild가 CDO를 거치지 않게 함.
+// - v0.4.4: content 폴더 변경을 감시해 dump root를 따라잡게 하는 watch 모드 실행 선언을 추가.
+// - v0.4.3: 에디터 자동 재덤프가 index 모드와 같은 index 파일을 다시 만드는 RebuildDumpIndexFiles 공개 계약을 추가.
 // - v0.4.2: single-query ai_context_bundle_v1 export command mode 계약을 추가.
 // - v0.4.1: additive query_result_v1 success envelope과 native default 보존을 추가.
 // - v0.4.0: native-response section/dependency routing을 제공하는 generic query command mode를 추가.
@@ -28,6 +31,8 @@
 #include "Commandlets/Commandlet.h"
 #include "AssetDumpCommandlet.generated.h"
 
+struct FADumpSectionSelection;
+
 UCLASS()
 class UAssetDumpCommandlet : public UCommandlet
 {
@@ -37,6 +42,10 @@ public:
 	// Main은 AssetDump 커맨드렛의 진입점을 실행한다.
 	virtual int32 Main(const FString& CommandLine) override;
 
+	// RebuildDumpIndexFiles는 index 모드와 같은 index 파일 일체를 다시 만든다. 같은 process 직전 build와 입력 stamp가 같은 manifest entry는 다시 읽지 않는다.
+	// UObject 상태를 건드리지 않으므로 어느 thread에서도 호출할 수 있고, 동시 호출은 내부 lock으로 직렬화된다.
+	static bool RebuildDumpIndexFiles(const FString& DumpRootPath, FString& OutAssetIndexFilePath);
+
 private:
 	// EAssetDumpBpLinkKind는 그래프 링크를 의미 단위로 필터링한다.
 	enum class EAssetDumpBpLinkKind : uint8
@@ -65,14 +74,22 @@ private:
 	// BuildMapJson은 맵의 액터 이름과 트랜스폼을 직렬화한다.
 	bool BuildMapJson(const FString& MapAssetPath, FString& OutJsonText);
 
-			// BuildDumpIndexFiles는 저장된 BPDump 폴더를 스캔해 legacy index 두 파일과 asset/section index를 생성한다.
-	bool BuildDumpIndexFiles(
+			// BuildDumpIndexFiles는 저장된 BPDump 폴더를 스캔해 legacy index 두 파일과 asset/section index를 생성한다. 파일 I/O와 JSON만 쓰므로 static이다.
+	static bool BuildDumpIndexFiles(
 		const FString& DumpRootPath,
 		FString& OutIndexFilePath,
 		FString& OutDependencyIndexFilePath,
 				FString& OutAssetIndexFilePath,
 		FString& OutSectionIndexFilePath);
 
+	// RunWatchMode는 최초 batchdump 뒤 root content 폴더를 감시해 변경 package와 직접 역참조 자산을 작은 batch로 다시 덤프하고 index와 watch_status.json heartbeat를 갱신한다.
+	int32 RunWatchMode(
+		const FString& CommandLine,
+		const FADumpSectionSelection& SectionSelection,
+		const FString& IntentName,
+		const FString& ProfileName,
+		const FString& SectionSource);
+
 	// BuildValidationJson은 대표 샘플 자산을 덤프하고 산출물 기본 검증 결과를 JSON으로 직렬화한다.
 	bool BuildValidationJson(const FString& CommandLine, FString& OutJsonText, int32& OutFailureCount);
 
@@ -80,7 +97,7 @@ private:
 	bool BuildValidationFixtureJson(const FString& CommandLine, FString& OutJsonText, int32& OutFailureCount);
 
 	// SaveJsonToFile은 BOM 없는 UTF-8로 JSON 텍스트를 디스크에 저장한다.
-	bool SaveJsonToFile(const FString& OutputFilePath, const FString& JsonText);
+	static bool SaveJsonToFile(const FString& OutputFilePath, const FString& JsonText);
 
 	// GetCmdValue는 -Key=Value 형식의 커맨드라인 값을 읽는다.
 	bool GetCmdValue(const FString& CommandLine, const TCHAR* Key, FString& OutValue);
@@ -1,11 +1,84 @@
 ﻿// SSOTDumpCmdlet.h
+// v0.7.1 - stage timing에 Main 시작 기준 시작/종료 시각을 추가해 ssot_meta.json에서 stage 간 선후를 확인할 수 있게 함
+// v0.7.0 - -incremental 자산 목록(package 파일 stamp diff, ssot_assets_delta.json/ssot_assets_state.json)과 -asset_roots= mount root 제한 선언 추가
+// v0.6.0 - registry snapshot 1회 수집, stage 병렬 실행과 stage별 timing(ssot_meta.json) 기록을 위한 선언 추가
 // v0.3 - Wheel SSOT 덤프(ssot_roots.json + ssot_wheel.json)
 
 #pragma once
 
+#include "AssetRegistry/AssetData.h"
 #include "Commandlets/Commandlet.h"
 #include "SSOTDumpCmdlet.generated.h"
 
+// cfg 화이트리스트 한 줄(ini|section|key)
+struct FCfgRule
+{
+	// ini 파일명 (DefaultEngine.ini 등)
+	FString IniName;
+
+	// 섹션명
+	FString SectionName;
+
+	// 키명 (또는 *)
+	FString KeyName;
+};
+
+// stage 하나의 실행 결과와 소요 시간(ssot_meta.json stages 항목)
+struct FSSOTStageTiming
+{
+	// stage 이름 (registry_snapshot, assets, cfg_rules, cfg, tags, input, wheel)
+	FString StageName;
+
+	// 실행 위치: game_thread 또는 task_graph
+	FString ThreadName;
+
+	// 시작/종료 시각(FPlatformTime::Seconds)
+	double StartSeconds = 0.0;
+	double EndSeconds = 0.0;
+
+	// 소요 시간(ms)
+	double Milliseconds = 0.0;
+
+	// stage 성공 여부
+	bool bOk = false;
+};
+
+// 자산 목록 한 줄(ssot_assets.json assets 항목)
+struct FSSOTAssetRow
+{
+	// 오브젝트 경로
+	FString ObjectPath;
+
+	// 클래스 경로
+	FString ClassPath;
+
+	// 패키지 폴더 경로
+	FString PackagePath;
+};
+
+// -incremental 자산 목록 계획: package 파일 stamp(크기:수정 시각)를 이전 state와 비교한 결과
+struct FSSOTAssetDeltaPlan
+{
+	// 이전 state를 읽어 diff 적용이 가능한지 여부
+	bool bBaseLoaded = false;
+
+	// 이전 state를 못 쓴 사유(첫 실행이면 비어 있음)
+	FString BaseNote;
+
+	// 현재 package → stamp / 파일 절대 경로
+	TMap<FString, FString> StampByPackage;
+	TMap<FString, FString> FileByPackage;
+
+	// 이전 state의 package → stamp / 자산 row
+	TMap<FString, FString> BaseStampByPackage;
+	TMap<FString, TArray<FSSOTAssetRow>> BaseRowsByPackage;
+
+	// 추가 / 수정 / 삭제 package(정렬)
+	TArray<FString> AddedPackages;
+	TArray<FString> ModifiedPackages;
+	TArray<FString> RemovedPackages;
+};
+
 UCLASS()
 class USSOTDumpCmdlet : public UCommandlet
 {
@@ -37,13 +110,38 @@ private:
 	// 엄격 모드: FAIL 하나라도 있으면 exit code 1
 	bool bStrictFail = true;
 
+	// assets/input/wheel이 공유하는 /Game scan 후 GetAllAssets 결과(ObjectPath 정렬)
+	// 증분 fast path에서는 추가·수정 package의 자산만 담는다
+	TArray<FAssetData> RegistrySnapshot;
+
+	// 자산 목록 mount root 제한(-asset_roots=/Game,/MyPlugin). 비어 있으면 전체 mount
+	TArray<FString> AssetRoots;
+
+	// 이전 목록 기준 증분 자산 목록(-incremental)
+	bool bIncrementalAssets = false;
+
+	// PrepareAssetDeltaPlan 결과
+	FSSOTAssetDeltaPlan AssetDeltaPlan;
+
 	// 커맨드라인 파싱
 	void ParseArgs(const FString& CmdLine);
 
+	// 자산 목록 대상 root (-asset_roots= 우선, -incremental이면 기본 /Game, 아니면 빈 목록=전체 mount)
+	TArray<FString> GetAssetListingRoots() const;
+
+	// root 폴더 package 파일 stamp를 모으고 이전 state와 비교한다 (game thread)
+	bool PrepareAssetDeltaPlan();
+
+	// registry scan을 한 번 보장하고 RegistrySnapshot을 채운다 (game thread)
+	// bChangedPackagesOnly면 추가·수정 package 파일만 다시 scan하고 그 자산만 담는다
+	bool CaptureRegistrySnapshot(const TArray<FString>& ScanPaths, bool bChangedPackagesOnly);
+
 	// 개별 덤프
-	bool DumpMeta() const;
+	// DumpMeta / DumpAssets / LoadCfgRules는 UObject를 만지지 않으므로 task graph에서 실행할 수 있다.
+	bool DumpMeta(const TArray<FSSOTStageTiming>& StageTimings, double MainStartSeconds) const;
 	bool DumpAssets() const;
-	bool DumpConfig() const;
+	bool LoadCfgRules(TArray<FCfgRule>& OutRules) const;
+	bool DumpConfig(const TArray<FCfgRule>& Rules) const;
 	bool DumpTags() const;
 	bool DumpInput() const;
 
@@ -0,0 +1,27 @@
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
+
+// File: AssetDumpQuery.Build.cs
+// Version: v0.1.0
+// Changelog:
+// - v0.1.0: dump root JSON만 읽는 query 경로(entity/section/dependency/context)를 Core + Json 전용 module로 분리.
+// Purpose: 에디터와 독립 query program이 함께 링크하는 read-only query module의 의존성을 명시한다.
+// Migration:
+// - CoreUObject/Engine 의존성을 추가하지 않는다. 추가하면 AssetDumpQueryTool program이 더 이상 에디터 없이 빌드되지 않는다.
+
+using UnrealBuildTool;
+
+public class AssetDumpQuery : ModuleRules
+{
+	public AssetDumpQuery(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"Json"
+			}
+		);
+	}
+}
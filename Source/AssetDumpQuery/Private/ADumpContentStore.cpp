@@ -0,0 +1,382 @@
+// File: ADumpContentStore.cpp
+// Version: v1.0.2
+// Changelog:
+// - v1.0.2: GC가 진행 중인 writer의 임시 blob을 지우지 않도록 일정 시간 이상 지난 *.tmp만 회수.
+// - v1.0.1: AssetDumpQuery module로 옮기고 manifest 읽기/보고서 저장을 ADumpQueryIO로 교체.
+// - v1.0.0: SHA-1 hash blob 원자 저장/재사용, manifest content_store 경로 해석과 manifest 참조 mark-sweep GC·dedup 보고서를 구현.
+// Migration:
+// - blob 이름은 저장 형태와 무관한 비압축 payload hash이므로 gzip/plain blob이 같은 hash를 공유할 수 있다. 읽는 쪽은 gzip magic으로 구분한다.
+// - 참조 수는 별도 counter 파일 없이 GC 때 manifest content_refs를 다시 세어 만들므로 중단된 batch가 counter를 어긋나게 하지 않는다.
+
+#include "ADumpContentStore.h"
+#include "ADumpPack.h"
+#include "ADumpQueryIO.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	// ContentStoreDirectoryName은 dump root 아래 content store 폴더 이름이다.
+	const TCHAR* ContentStoreDirectoryName = TEXT("content_store");
+
+	// ContentStoreReportFileName은 dump root 아래 GC 보고서 파일 이름이다.
+	const TCHAR* ContentStoreReportFileName = TEXT("content_store_report.json");
+
+	// StaleTempFileAgeSeconds는 GC가 중단된 writer의 임시 blob으로 보고 회수하기 전까지 기다리는 수정 후 경과 시간이다. 그보다 새 임시 파일은 쓰는 중일 수 있다.
+	constexpr double StaleTempFileAgeSeconds = 3600.0;
+
+	// ContentStoreTopSharedLimit은 보고서에 남길 최다 참조 blob 수다.
+	constexpr int32 ContentStoreTopSharedLimit = 16;
+
+	// NormalizeContentStorePath는 비교 가능한 절대 '/' 경로로 정규화한다.
+	FString NormalizeContentStorePath(const FString& InPath)
+	{
+		FString FullPath = FPaths::ConvertRelativePathToFull(InPath);
+		FPaths::NormalizeFilename(FullPath);
+		FPaths::RemoveDuplicateSlashes(FullPath);
+		FPaths::CollapseRelativeDirectories(FullPath);
+		while (FullPath.Len() > 1 && FullPath.EndsWith(TEXT("/")))
+		{
+			FullPath.LeftChopInline(1, false);
+		}
+		return FullPath;
+	}
+
+	// CollectManifestContentRefs는 manifest 하나의 content_refs hash 목록과 store root를 읽는다. 참조가 없으면 false다.
+	bool CollectManifestContentRefs(const FString& InManifestFilePath, FString& OutStoreRootPath, TArray<FString>& OutContentHashes)
+	{
+		OutStoreRootPath.Reset();
+		OutContentHashes.Reset();
+
+		FString ManifestText;
+		if (!ADumpQueryIO::LoadJsonTextFromFile(InManifestFilePath, ManifestText))
+		{
+			return false;
+		}
+
+		TSharedPtr<FJsonObject> ManifestObject;
+		const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ManifestText);
+		if (!FJsonSerializer::Deserialize(JsonReader, ManifestObject) || !ManifestObject.IsValid())
+		{
+			return false;
+		}
+
+		FString ContentStoreText;
+		const TSharedPtr<FJsonObject>* ContentRefsObject = nullptr;
+		if (!ManifestObject->TryGetStringField(TEXT("content_store"), ContentStoreText)
+			|| !ManifestObject->TryGetObjectField(TEXT("content_refs"), ContentRefsObject)
+			|| !ContentRefsObject || !ContentRefsObject->IsValid())
+		{
+			return false;
+		}
+
+		OutStoreRootPath = ADumpContentStore::ResolveManifestStoreRootPath(InManifestFilePath, ContentStoreText);
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& RefPair : (*ContentRefsObject)->Values)
+		{
+			FString ContentHash;
+			if (RefPair.Value.IsValid() && RefPair.Value->TryGetString(ContentHash) && ADumpContentStore::IsValidContentHash(ContentHash))
+			{
+				OutContentHashes.Add(ContentHash);
+			}
+		}
+		return true;
+	}
+
+	// MakeContentStoreReportObject는 content_store_report_v1 JSON object를 만든다.
+	TSharedRef<FJsonObject> MakeContentStoreReportObject(
+		const FADumpContentStoreReport& InReport,
+		const TMap<FString, int32>& InRefCountByHash,
+		const TMap<FString, int64>& InBlobBytesByHash)
+	{
+		TSharedRef<FJsonObject> ReportObject = MakeShared<FJsonObject>();
+		ReportObject->SetStringField(TEXT("schema_version"), TEXT("content_store_report_v1"));
+		ReportObject->SetStringField(TEXT("generated_time"), FDateTime::UtcNow().ToIso8601());
+		ReportObject->SetStringField(TEXT("store_root_path"), InReport.StoreRootPath);
+		ReportObject->SetBoolField(TEXT("dry_run"), InReport.bDryRun);
+		ReportObject->SetNumberField(TEXT("manifest_count"), InReport.ManifestCount);
+		ReportObject->SetNumberField(TEXT("referencing_manifest_count"), InReport.ReferencingManifestCount);
+		ReportObject->SetNumberField(TEXT("reference_count"), InReport.ReferenceCount);
+		ReportObject->SetNumberField(TEXT("referenced_blob_count"), InReport.ReferencedBlobCount);
+		ReportObject->SetNumberField(TEXT("live_blob_count"), InReport.LiveBlobCount);
+		ReportObject->SetNumberField(TEXT("missing_blob_count"), InReport.MissingBlobCount);
+		ReportObject->SetNumberField(TEXT("deleted_blob_count"), InReport.DeletedBlobCount);
+		ReportObject->SetNumberField(TEXT("delete_failed_count"), InReport.DeleteFailedCount);
+		ReportObject->SetNumberField(TEXT("reclaimed_bytes"), static_cast<double>(InReport.ReclaimedBytes));
+		ReportObject->SetNumberField(TEXT("logical_bytes"), static_cast<double>(InReport.LogicalBytes));
+		ReportObject->SetNumberField(TEXT("stored_bytes"), static_cast<double>(InReport.StoredBytes));
+		ReportObject->SetNumberField(TEXT("saved_bytes"), static_cast<double>(InReport.LogicalBytes - InReport.StoredBytes));
+		ReportObject->SetNumberField(TEXT("dedup_ratio"), InReport.DedupRatio);
+
+		// SharedHashes는 참조 수 2 이상 live blob을 참조 수 내림차순, hash 오름차순으로 정렬한 목록이다.
+		TArray<FString> SharedHashes;
+		for (const TPair<FString, int32>& RefPair : InRefCountByHash)
+		{
+			if (RefPair.Value > 1 && InBlobBytesByHash.Contains(RefPair.Key))
+			{
+				SharedHashes.Add(RefPair.Key);
+			}
+		}
+		SharedHashes.Sort([&InRefCountByHash](const FString& Left, const FString& Right)
+		{
+			const int32 LeftCount = InRefCountByHash.FindChecked(Left);
+			const int32 RightCount = InRefCountByHash.FindChecked(Right);
+			return LeftCount != RightCount ? LeftCount > RightCount : Left < Right;
+		});
+
+		TArray<TSharedPtr<FJsonValue>> TopSharedArray;
+		for (int32 SharedIndex = 0; SharedIndex < SharedHashes.Num() && SharedIndex < ContentStoreTopSharedLimit; ++SharedIndex)
+		{
+			const FString& ContentHash = SharedHashes[SharedIndex];
+			TSharedRef<FJsonObject> SharedObject = MakeShared<FJsonObject>();
+			SharedObject->SetStringField(TEXT("content_hash"), ContentHash);
+			SharedObject->SetNumberField(TEXT("ref_count"), InRefCountByHash.FindChecked(ContentHash));
+			SharedObject->SetNumberField(TEXT("stored_bytes"), static_cast<double>(InBlobBytesByHash.FindChecked(ContentHash)));
+			TopSharedArray.Add(MakeShared<FJsonValueObject>(SharedObject));
+		}
+		ReportObject->SetNumberField(TEXT("shared_blob_count"), SharedHashes.Num());
+		ReportObject->SetArrayField(TEXT("top_shared_blobs"), TopSharedArray);
+		return ReportObject;
+	}
+}
+
+namespace ADumpContentStore
+{
+	const TCHAR* GetContentStoreDirectoryName()
+	{
+		return ContentStoreDirectoryName;
+	}
+
+	const TCHAR* GetContentStoreReportFileName()
+	{
+		return ContentStoreReportFileName;
+	}
+
+	FString BuildContentHash(const TArray<uint8>& InBytes)
+	{
+		FSHAHash Hash;
+		FSHA1::HashBuffer(InBytes.GetData(), static_cast<uint64>(InBytes.Num()), Hash.Hash);
+		return Hash.ToString().ToLower();
+	}
+
+	bool IsValidContentHash(const FString& InContentHash)
+	{
+		if (InContentHash.Len() != 40)
+		{
+			return false;
+		}
+		for (const TCHAR Character : InContentHash)
+		{
+			if (!((Character >= TEXT('0') && Character <= TEXT('9')) || (Character >= TEXT('a') && Character <= TEXT('f'))))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	FString BuildContentBlobPath(const FString& InStoreRootPath, const FString& InContentHash)
+	{
+		return FPaths::Combine(InStoreRootPath, InContentHash.Left(2), InContentHash + TEXT(".json"));
+	}
+
+	FString ResolveManifestStoreRootPath(const FString& InManifestFilePath, const FString& InContentStoreText)
+	{
+		if (InContentStoreText.IsEmpty())
+		{
+			return FString();
+		}
+		return NormalizeContentStorePath(FPaths::IsRelative(InContentStoreText)
+			? FPaths::Combine(FPaths::GetPath(InManifestFilePath), InContentStoreText)
+			: InContentStoreText);
+	}
+
+	bool StoreContent(
+		const FString& InStoreRootPath,
+		const FString& InContentHash,
+		const TArray<uint8>& InStoredBytes,
+		bool& bOutReused,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		bOutReused = false;
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+
+		if (InStoreRootPath.IsEmpty() || !IsValidContentHash(InContentHash))
+		{
+			OutErrorCode = TEXT("ADUMP_CONTENT_STORE_HASH_INVALID");
+			OutErrorDetail = FString::Printf(TEXT("Content store root or hash is invalid: %s / %s"), *InStoreRootPath, *InContentHash);
+			return false;
+		}
+
+		// blob은 이름이 내용 hash이고 임시 파일 + move로만 생기므로 존재 자체가 완전한 같은 payload를 뜻한다.
+		const FString BlobFilePath = BuildContentBlobPath(InStoreRootPath, InContentHash);
+		if (IFileManager::Get().FileExists(*BlobFilePath))
+		{
+			bOutReused = true;
+			return true;
+		}
+
+		// TempFilePath는 병렬 writer끼리 겹치지 않는 임시 blob 경로다.
+		const FString TempFilePath = FString::Printf(TEXT("%s.%s.tmp"), *BlobFilePath, *FGuid::NewGuid().ToString(EGuidFormats::Digits));
+		if (!IFileManager::Get().MakeDirectory(*FPaths::GetPath(BlobFilePath), true)
+			|| !FFileHelper::SaveArrayToFile(InStoredBytes, *TempFilePath))
+		{
+			IFileManager::Get().Delete(*TempFilePath, false, true, true);
+			OutErrorCode = TEXT("ADUMP_CONTENT_STORE_WRITE_FAILED");
+			OutErrorDetail = FString::Printf(TEXT("Failed to write content blob: %s"), *TempFilePath);
+			return false;
+		}
+
+		if (!IFileManager::Get().Move(*BlobFilePath, *TempFilePath, false, true, false, true))
+		{
+			IFileManager::Get().Delete(*TempFilePath, false, true, true);
+			if (IFileManager::Get().FileExists(*BlobFilePath))
+			{
+				// 다른 writer가 같은 hash blob을 먼저 공개했다.
+				bOutReused = true;
+				return true;
+			}
+
+			OutErrorCode = TEXT("ADUMP_CONTENT_STORE_WRITE_FAILED");
+			OutErrorDetail = FString::Printf(TEXT("Failed to move content blob to final path: %s"), *BlobFilePath);
+			return false;
+		}
+		return true;
+	}
+
+	bool TryLoadContent(const FString& InStoreRootPath, const FString& InContentHash, TArray<uint8>& OutStoredBytes)
+	{
+		OutStoredBytes.Reset();
+		return !InStoreRootPath.IsEmpty()
+			&& IsValidContentHash(InContentHash)
+			&& FFileHelper::LoadFileToArray(OutStoredBytes, *BuildContentBlobPath(InStoreRootPath, InContentHash), FILEREAD_Silent);
+	}
+
+	bool CollectGarbage(
+		const FString& InDumpRootPath,
+		bool bInDryRun,
+		FADumpContentStoreReport& OutReport,
+		FString& OutReportFilePath,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutReport = FADumpContentStoreReport();
+		OutReportFilePath.Reset();
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+
+		const FString DumpRootPath = NormalizeContentStorePath(InDumpRootPath);
+		if (InDumpRootPath.IsEmpty() || !IFileManager::Get().DirectoryExists(*DumpRootPath))
+		{
+			OutErrorCode = TEXT("ADUMP_CONTENT_STORE_ROOT_MISSING");
+			OutErrorDetail = FString::Printf(TEXT("Dump root does not exist: %s"), *DumpRootPath);
+			return false;
+		}
+
+		OutReport.StoreRootPath = NormalizeContentStorePath(FPaths::Combine(DumpRootPath, ContentStoreDirectoryName));
+		OutReport.bDryRun = bInDryRun;
+
+		// mark: 실제 파일과 pack 안 manifest의 content_refs 중 이 store를 가리키는 항목만 센다.
+		TArray<FString> ManifestFilePaths;
+		IFileManager::Get().FindFilesRecursive(ManifestFilePaths, *DumpRootPath, TEXT("manifest.json"), true, false);
+		ADumpPack::FindPackedFiles(DumpRootPath, TEXT("manifest.json"), ManifestFilePaths);
+		ManifestFilePaths.Sort();
+
+		TMap<FString, int32> RefCountByHash;
+		TArray<FString> ContentHashes;
+		for (const FString& ManifestFilePath : ManifestFilePaths)
+		{
+			++OutReport.ManifestCount;
+			FString ManifestStoreRootPath;
+			if (!CollectManifestContentRefs(ManifestFilePath, ManifestStoreRootPath, ContentHashes)
+				|| !ManifestStoreRootPath.Equals(OutReport.StoreRootPath, ESearchCase::IgnoreCase))
+			{
+				continue;
+			}
+
+			++OutReport.ReferencingManifestCount;
+			for (const FString& ContentHash : ContentHashes)
+			{
+				++RefCountByHash.FindOrAdd(ContentHash);
+				++OutReport.ReferenceCount;
+			}
+		}
+		OutReport.ReferencedBlobCount = RefCountByHash.Num();
+
+		// sweep: 참조 수 0인 hash blob과 중단된 writer가 남긴 오래된 임시 파일을 회수한다.
+		TMap<FString, int64> BlobBytesByHash;
+		const FDateTime SweepTime = FDateTime::UtcNow();
+		if (IFileManager::Get().DirectoryExists(*OutReport.StoreRootPath))
+		{
+			TArray<FString> StoreFilePaths;
+			IFileManager::Get().FindFilesRecursive(StoreFilePaths, *OutReport.StoreRootPath, TEXT("*"), true, false);
+			StoreFilePaths.Sort();
+			for (const FString& StoreFilePath : StoreFilePaths)
+			{
+				const FString StoreFileName = FPaths::GetCleanFilename(StoreFilePath);
+				const FString ContentHash = FPaths::GetBaseFilename(StoreFilePath);
+				const bool bTempFile = StoreFileName.EndsWith(TEXT(".tmp"));
+				if (!bTempFile && (!StoreFileName.EndsWith(TEXT(".json")) || !IsValidContentHash(ContentHash)))
+				{
+					continue;
+				}
+				if (bTempFile && (SweepTime - IFileManager::Get().GetTimeStamp(*StoreFilePath)).GetTotalSeconds() < StaleTempFileAgeSeconds)
+				{
+					continue;
+				}
+
+				const int64 FileBytes = FMath::Max<int64>(IFileManager::Get().FileSize(*StoreFilePath), 0);
+				const int32* RefCount = bTempFile ? nullptr : RefCountByHash.Find(ContentHash);
+				if (RefCount != nullptr)
+				{
+					++OutReport.LiveBlobCount;
+					OutReport.StoredBytes += FileBytes;
+					OutReport.LogicalBytes += FileBytes * (*RefCount);
+					BlobBytesByHash.Add(ContentHash, FileBytes);
+					continue;
+				}
+
+				if (!bInDryRun && !IFileManager::Get().Delete(*StoreFilePath, false, true, true))
+				{
+					++OutReport.DeleteFailedCount;
+					continue;
+				}
+				OutReport.DeletedBlobCount += bTempFile ? 0 : 1;
+				OutReport.ReclaimedBytes += FileBytes;
+			}
+		}
+
+		OutReport.MissingBlobCount = OutReport.ReferencedBlobCount - OutReport.LiveBlobCount;
+		OutReport.DedupRatio = OutReport.StoredBytes > 0
+			? static_cast<double>(OutReport.LogicalBytes) / static_cast<double>(OutReport.StoredBytes)
+			: 1.0;
+
+		FString ReportJsonText;
+		const TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&ReportJsonText);
+		if (!FJsonSerializer::Serialize(MakeContentStoreReportObject(OutReport, RefCountByHash, BlobBytesByHash), JsonWriter))
+		{
+			OutErrorCode = TEXT("ADUMP_CONTENT_STORE_REPORT_WRITE_FAILED");
+			OutErrorDetail = TEXT("Failed to serialize content store report.");
+			return false;
+		}
+
+		OutReportFilePath = FPaths::Combine(DumpRootPath, ContentStoreReportFileName);
+		FString SaveErrorMessage;
+		if (!ADumpQueryIO::SaveJsonTextToFile(OutReportFilePath, ReportJsonText, SaveErrorMessage))
+		{
+			OutErrorCode = TEXT("ADUMP_CONTENT_STORE_REPORT_WRITE_FAILED");
+			OutErrorDetail = SaveErrorMessage;
+			return false;
+		}
+		return true;
+	}
+}
@@ -0,0 +1,143 @@
+// File: ADumpEntityKinds.cpp
+// Version: v1.0.0
+// Changelog:
+// - v1.0.0: ADumpEntityEvidence의 Core, Niagara MVP/Deep/Material와 Known Entity/Relation kind registry 정의를 그대로 옮김.
+// Migration:
+// - registry 순서와 내용은 바꾸지 않는다. entity_index_v1 kind ordinal과 source 검증이 이 순서에 묶여 있다.
+
+#include "ADumpEntityKinds.h"
+
+namespace ADumpEntityKinds
+{
+	const TArray<FString>& GetEntityKindRegistry()
+	{
+		static const TArray<FString> Registry = {
+			TEXT("asset"),
+			TEXT("blueprint_component"),
+			TEXT("blueprint_graph"),
+			TEXT("blueprint_graph_node"),
+			TEXT("blueprint_graph_pin")
+		};
+		return Registry;
+	}
+
+	const TArray<FString>& GetRelationKindRegistry()
+	{
+		static const TArray<FString> Registry = {
+			TEXT("owns"),
+			TEXT("contains"),
+			TEXT("attached_to"),
+			TEXT("executes_before"),
+			TEXT("data_flows_to")
+		};
+		return Registry;
+	}
+
+				const TArray<FString>& GetNiagaraEntityKindRegistry()
+	{
+		static const TArray<FString> Registry = {
+			TEXT("asset"),
+			TEXT("niagara_system"),
+			TEXT("niagara_emitter"),
+			TEXT("niagara_execution_group"),
+			TEXT("niagara_module"),
+			TEXT("niagara_module_input"),
+			TEXT("niagara_renderer"),
+			TEXT("niagara_parameter"),
+			TEXT("niagara_parameter_binding"),
+			TEXT("niagara_data_interface"),
+			TEXT("niagara_simulation_stage"),
+			TEXT("asset_reference")
+		};
+		return Registry;
+	}
+
+	const TArray<FString>& GetNiagaraRelationKindRegistry()
+	{
+		static const TArray<FString> Registry = {
+			TEXT("owns"),
+			TEXT("contains"),
+			TEXT("executes_before"),
+			TEXT("uses_script"),
+			TEXT("binds_to"),
+			TEXT("reads_attribute"),
+			TEXT("renders_with"),
+			TEXT("references"),
+			TEXT("inherits_from"),
+			TEXT("overrides")
+		};
+		return Registry;
+	}
+
+		const TArray<FString>& GetNiagaraDeepEntityKindRegistry()
+	{
+		static const TArray<FString> Registry = []
+		{
+			TArray<FString> Values = GetNiagaraEntityKindRegistry();
+			Values.Add(TEXT("niagara_dynamic_input"));
+			Values.Add(TEXT("niagara_static_switch"));
+			Values.Add(TEXT("niagara_rapid_iteration_value"));
+			Values.Add(TEXT("niagara_module_output"));
+			Values.Add(TEXT("niagara_parameter_read"));
+			Values.Add(TEXT("niagara_parameter_write"));
+			return Values;
+		}();
+		return Registry;
+	}
+
+	const TArray<FString>& GetNiagaraDeepRelationKindRegistry()
+	{
+		static const TArray<FString> Registry = []
+		{
+			TArray<FString> Values = GetNiagaraRelationKindRegistry();
+			Values.Add(TEXT("reads_parameter"));
+			Values.Add(TEXT("writes_parameter"));
+			return Values;
+		}();
+		return Registry;
+	}
+
+		const TArray<FString>& GetNiagaraMaterialEntityKindRegistry()
+	{
+		static const TArray<FString> Registry = []
+		{
+			TArray<FString> Values = GetNiagaraDeepEntityKindRegistry();
+			Values.Add(TEXT("niagara_renderer_resource"));
+			return Values;
+		}();
+		return Registry;
+	}
+
+	const TArray<FString>& GetNiagaraMaterialRelationKindRegistry()
+	{
+		return GetNiagaraDeepRelationKindRegistry();
+	}
+
+	const TArray<FString>& GetKnownEntityKindRegistry()
+	{
+		static const TArray<FString> Registry = []
+		{
+			TArray<FString> Values = GetEntityKindRegistry();
+						for (const FString& Kind : GetNiagaraMaterialEntityKindRegistry())
+			{
+				Values.AddUnique(Kind);
+			}
+			return Values;
+		}();
+		return Registry;
+	}
+
+		const TArray<FString>& GetKnownRelationKindRegistry()
+	{
+		static const TArray<FString> Registry = []
+		{
+			TArray<FString> Values = GetRelationKindRegistry();
+						for (const FString& Kind : GetNiagaraMaterialRelationKindRegistry())
+			{
+				Values.AddUnique(Kind);
+			}
+			return Values;
+		}();
+		return Registry;
+	}
+}
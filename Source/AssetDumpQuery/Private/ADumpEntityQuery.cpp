@@ -1,6 +1,16 @@
 // File: ADumpEntityQuery.cpp
-// Version: v1.5.0
+// Version: v1.12.3
 // Changelog:
+// - v1.12.3: entity_index root cache와 session stamp를 ADumpQueryIO::TStampedFileCache/MakeJsonFileStamp로 교체.
+// - v1.12.2: session cache helper 사이에 밀려 있던 ResolveIndexedSource 설명 주석을 함수 위로 되돌림.
+// - v1.12.1: 해석한 entity_index root를 파일 stamp별로 process cache에 두어 selector가 달라도 다시 읽지 않고, entity_id/stable_key ordinal 조회표를 resolved source에 한 번만 만들어 session cache가 복사 없이 공유.
+// - v1.12.0: BuildEntityIndex가 validate 비교용으로 source 읽기를 단일 thread(EParallelForFlags::ForceSingleThread)로 강제할 수 있게 함.
+// - v1.11.0: 에디터 없이 빌드되는 AssetDumpQuery module로 옮기고 kind registry/JSON 읽기를 ADumpEntityKinds/ADumpQueryIO로 교체.
+// - v1.10.0: dump pack 안의 *.dump.json도 entity source로 열거하고, pack 항목은 크기/CRC stamp로 재사용과 session cache를 판정.
+// - v1.9.0: gzip으로 저장된 dump/index JSON을 magic byte로 감지해 투명하게 해제해 읽고, 압축 source에는 evidence byte span을 기록하지 않음.
+// - v1.8.0: asset별 entity ordinal 기준 forward/reverse relation CSR(entity_adjacency)을 색인하고 expand를 bitset BFS로 수행.
+// - v1.7.0: asset별 entity/relation entry 구간과 kind ordinal table을 색인하고, entityquery가 process session cache의 resolved source/filter 결과로 cursor page를 바로 잘라내도록 변경.
+// - v1.6.0: entity_index를 병렬 source 읽기와 정렬 순서 직렬 병합으로 만들고, 크기/수정 시각이 같은 source는 직전 entry를 재사용하며 evidence byte span만 해석.
 // - v1.5.0: P5-N1 niagara_material_v1 19/12 adapter registry와 loaded-index source validation을 추가.
 // - v1.4.0: P4-N1 niagara_deep_v1 adapter profile, 18/12 source registry와 loaded-index query compatibility를 추가.
 // - v1.3.1: EntityKinds/RelationKinds/Facets comma-list option이 separator에서 잘리지 않도록 전체 token을 파싱.
@@ -14,19 +24,25 @@
 // - v1.0.1: Unity Build에서 Evidence helper와 충돌하지 않도록 Query JSON string-array helper를 고유 이름으로 분리.
 // - v1.0.0: validated nested locator, list/get/expand, cursor, bounds와 native-preserving context bundle을 구현.
 // Migration:
+// - entity_index_v1 asset entry의 entity_adjacency는 additive이며 id가 유일하지 않거나 검증에 실패하면 기존 relation 선형 expand를 쓴다.
+// - entity_index_v1 asset entry의 entity_entry_begin/relation_entry_begin/entity_kind_ordinals는 additive 필드이며, 없거나 경계가 맞지 않으면 전체 entry 선형 검색으로 되돌아간다.
+// - entity_index_v1 asset entry의 adapter_profile, source_file_bytes/timestamp, evidence_byte_*와 root scanned_source_files/reused_source_count/parsed_source_count는 additive 필드다.
 // - 외부 JSON Pointer는 실행하지 않으며 entity_index_v1이 생성한 두 canonical array pointer 형식만 해석한다.
 // - comma-list option은 기존 single-value 입력과 호환되며 둘 이상의 값을 모두 normalized query와 필터에 반영한다.
 
 #include "ADumpEntityQuery.h"
 
-#include "ADumpEntityEvidence.h"
-#include "ADumpJson.h"
+#include "ADumpEntityKinds.h"
+#include "ADumpPack.h"
+#include "ADumpQueryIO.h"
 
+#include "Async/ParallelFor.h"
 #include "Dom/JsonObject.h"
 #include "HAL/FileManager.h"
 #include "Misc/Crc.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Serialization/JsonWriter.h"
@@ -82,6 +98,32 @@ namespace
 		FString ObjectPath;
 		FString AssetId;
 		FString Fingerprint;
+		TMap<FString, TArray<int32>> EntityKindOrdinals;
+		TArray<int32> RelationFromOrdinals;
+		TArray<int32> RelationToOrdinals;
+		TArray<int32> ForwardOffsets;
+		TArray<int32> ForwardRelations;
+		TArray<int32> ReverseOffsets;
+		TArray<int32> ReverseRelations;
+		TMap<FString, int32> EntityOrdinalById;
+		TMap<FString, TArray<int32>> EntityOrdinalsByStableKey;
+	};
+
+	// FEntityQueryFilterResult는 normalized query 하나의 선택 entity와 canonical 순서 후보 ordinal이다.
+	struct FEntityQueryFilterResult
+	{
+		int32 SelectedEntityOrdinal = INDEX_NONE;
+		TArray<int32> EntityOrdinals;
+		TArray<int32> RelationOrdinals;
+	};
+
+	// FEntityQuerySessionEntry는 한 process 안에서 재사용하는 resolved source와 query별 filter 결과다.
+	struct FEntityQuerySessionEntry
+	{
+		FString IndexStamp;
+		FString SourceStamp;
+		TSharedPtr<const FResolvedEntitySource> Source;
+		TMap<FString, FEntityQueryFilterResult> FilterResults;
 	};
 
 	// SerializeJsonObject는 JSON object를 stable pretty JSON text로 직렬화한다.
@@ -92,12 +134,12 @@ namespace
 		return FJsonSerializer::Serialize(InRootObject, Writer);
 	}
 
-	// LoadJsonObject는 UTF-8 JSON 파일을 object로 읽는다.
+	// LoadJsonObject는 UTF-8 또는 gzip JSON 파일을 object로 읽는다.
 	bool LoadJsonObject(const FString& InFilePath, TSharedPtr<FJsonObject>& OutRootObject)
 	{
 		OutRootObject.Reset();
 		FString JsonText;
-		if (!FFileHelper::LoadFileToString(JsonText, *InFilePath))
+		if (!ADumpQueryIO::LoadJsonTextFromFile(InFilePath, JsonText))
 		{
 			return false;
 		}
@@ -142,6 +184,17 @@ namespace
 		return FMath::RoundToInt(Value);
 	}
 
+	// GetInt64Field는 number field를 64-bit 정수로 읽고 없으면 기본값을 반환한다.
+	int64 GetInt64Field(const TSharedPtr<FJsonObject>& InObject, const TCHAR* InFieldName, int64 InDefaultValue)
+	{
+		double Value = 0.0;
+		if (!InObject.IsValid() || !InObject->TryGetNumberField(InFieldName, Value))
+		{
+			return InDefaultValue;
+		}
+		return static_cast<int64>(Value);
+	}
+
 	// GetBoolField는 bool field를 읽고 없으면 기본값을 반환한다.
 	bool GetBoolField(const TSharedPtr<FJsonObject>& InObject, const TCHAR* InFieldName, bool bDefaultValue = false)
 	{
@@ -365,23 +418,23 @@ namespace
 		const TArray<FString>* RelationRegistry = nullptr;
 		if (InAdapterProfile == TEXT("blueprint_core_v1"))
 		{
-			EntityRegistry = &ADumpEntityEvidence::GetEntityKindRegistry();
-			RelationRegistry = &ADumpEntityEvidence::GetRelationKindRegistry();
+			EntityRegistry = &ADumpEntityKinds::GetEntityKindRegistry();
+			RelationRegistry = &ADumpEntityKinds::GetRelationKindRegistry();
 		}
 				else if (InAdapterProfile == TEXT("niagara_mvp_v1"))
 		{
-			EntityRegistry = &ADumpEntityEvidence::GetNiagaraEntityKindRegistry();
-			RelationRegistry = &ADumpEntityEvidence::GetNiagaraRelationKindRegistry();
+			EntityRegistry = &ADumpEntityKinds::GetNiagaraEntityKindRegistry();
+			RelationRegistry = &ADumpEntityKinds::GetNiagaraRelationKindRegistry();
 		}
 				else if (InAdapterProfile == TEXT("niagara_deep_v1"))
 		{
-			EntityRegistry = &ADumpEntityEvidence::GetNiagaraDeepEntityKindRegistry();
-			RelationRegistry = &ADumpEntityEvidence::GetNiagaraDeepRelationKindRegistry();
+			EntityRegistry = &ADumpEntityKinds::GetNiagaraDeepEntityKindRegistry();
+			RelationRegistry = &ADumpEntityKinds::GetNiagaraDeepRelationKindRegistry();
 		}
 		else if (InAdapterProfile == TEXT("niagara_material_v1"))
 		{
-			EntityRegistry = &ADumpEntityEvidence::GetNiagaraMaterialEntityKindRegistry();
-			RelationRegistry = &ADumpEntityEvidence::GetNiagaraMaterialRelationKindRegistry();
+			EntityRegistry = &ADumpEntityKinds::GetNiagaraMaterialEntityKindRegistry();
+			RelationRegistry = &ADumpEntityKinds::GetNiagaraMaterialRelationKindRegistry();
 		}
 		else
 		{
@@ -541,6 +594,176 @@ namespace
 		return true;
 	}
 
+	// MakeEntityQueryIntegerArray는 int32 배열을 JSON number 배열로 만든다.
+	TArray<TSharedPtr<FJsonValue>> MakeEntityQueryIntegerArray(const TArray<int32>& InValues)
+	{
+		TArray<TSharedPtr<FJsonValue>> Values;
+		Values.Reserve(InValues.Num());
+		for (const int32 Value : InValues)
+		{
+			Values.Add(MakeShared<FJsonValueNumber>(Value));
+		}
+		return Values;
+	}
+
+	// ReadEntityQueryIntegerArray는 JSON number 배열을 int32 배열로 읽고 number가 아닌 원소가 있으면 false를 반환한다.
+	bool ReadEntityQueryIntegerArray(const TSharedPtr<FJsonObject>& InObject, const TCHAR* InFieldName, TArray<int32>& OutValues)
+	{
+		OutValues.Reset();
+		const TArray<TSharedPtr<FJsonValue>>* Values = GetArrayField(InObject, InFieldName);
+		if (!Values)
+		{
+			return false;
+		}
+		OutValues.Reserve(Values->Num());
+		for (const TSharedPtr<FJsonValue>& Value : *Values)
+		{
+			if (!Value.IsValid() || Value->Type != EJson::Number)
+			{
+				return false;
+			}
+			OutValues.Add(static_cast<int32>(Value->AsNumber()));
+		}
+		return true;
+	}
+
+	// BuildEntityAdjacencyObject는 asset 하나의 relation을 asset 내부 entity ordinal 기준 forward/reverse CSR로 만든다.
+	// entity_id 또는 relation_id가 asset 안에서 유일하지 않으면 id 기반 expand와 같은 결과를 보장할 수 없으므로 만들지 않는다.
+	TSharedPtr<FJsonObject> BuildEntityAdjacencyObject(
+		TConstArrayView<FEntityIndexDraft> InEntities,
+		TConstArrayView<FRelationIndexDraft> InRelations)
+	{
+		TMap<FString, int32> EntityOrdinalById;
+		for (int32 EntityOrdinal = 0; EntityOrdinal < InEntities.Num(); ++EntityOrdinal)
+		{
+			EntityOrdinalById.Add(InEntities[EntityOrdinal].EntityId, EntityOrdinal);
+			if (EntityOrdinalById.Num() != EntityOrdinal + 1)
+			{
+				return nullptr;
+			}
+		}
+		TSet<FString> RelationIds;
+		TArray<int32> FromOrdinals;
+		TArray<int32> ToOrdinals;
+		TArray<int32> ForwardCounts;
+		TArray<int32> ReverseCounts;
+		ForwardCounts.SetNumZeroed(InEntities.Num());
+		ReverseCounts.SetNumZeroed(InEntities.Num());
+		for (const FRelationIndexDraft& Relation : InRelations)
+		{
+			bool bAlreadyInSet = false;
+			RelationIds.Add(Relation.RelationId, &bAlreadyInSet);
+			if (bAlreadyInSet)
+			{
+				return nullptr;
+			}
+			const int32* FromOrdinal = EntityOrdinalById.Find(Relation.FromEntityId);
+			const int32* ToOrdinal = EntityOrdinalById.Find(Relation.ToEntityId);
+			const bool bLinked = FromOrdinal && ToOrdinal;
+			FromOrdinals.Add(bLinked ? *FromOrdinal : INDEX_NONE);
+			ToOrdinals.Add(bLinked ? *ToOrdinal : INDEX_NONE);
+			if (bLinked)
+			{
+				++ForwardCounts[*FromOrdinal];
+				++ReverseCounts[*ToOrdinal];
+			}
+		}
+
+		TArray<int32> ForwardOffsets = { 0 };
+		TArray<int32> ReverseOffsets = { 0 };
+		for (int32 EntityOrdinal = 0; EntityOrdinal < InEntities.Num(); ++EntityOrdinal)
+		{
+			ForwardOffsets.Add(ForwardOffsets.Last() + ForwardCounts[EntityOrdinal]);
+			ReverseOffsets.Add(ReverseOffsets.Last() + ReverseCounts[EntityOrdinal]);
+		}
+		TArray<int32> ForwardRelations;
+		TArray<int32> ReverseRelations;
+		ForwardRelations.SetNumUninitialized(ForwardOffsets.Last());
+		ReverseRelations.SetNumUninitialized(ReverseOffsets.Last());
+		TArray<int32> ForwardCursor = ForwardOffsets;
+		TArray<int32> ReverseCursor = ReverseOffsets;
+		for (int32 RelationOrdinal = 0; RelationOrdinal < InRelations.Num(); ++RelationOrdinal)
+		{
+			if (FromOrdinals[RelationOrdinal] != INDEX_NONE)
+			{
+				ForwardRelations[ForwardCursor[FromOrdinals[RelationOrdinal]]++] = RelationOrdinal;
+				ReverseRelations[ReverseCursor[ToOrdinals[RelationOrdinal]]++] = RelationOrdinal;
+			}
+		}
+
+		TSharedRef<FJsonObject> AdjacencyObject = MakeShared<FJsonObject>();
+		AdjacencyObject->SetArrayField(TEXT("relation_from"), MakeEntityQueryIntegerArray(FromOrdinals));
+		AdjacencyObject->SetArrayField(TEXT("relation_to"), MakeEntityQueryIntegerArray(ToOrdinals));
+		AdjacencyObject->SetArrayField(TEXT("forward_offsets"), MakeEntityQueryIntegerArray(ForwardOffsets));
+		AdjacencyObject->SetArrayField(TEXT("forward_relations"), MakeEntityQueryIntegerArray(ForwardRelations));
+		AdjacencyObject->SetArrayField(TEXT("reverse_offsets"), MakeEntityQueryIntegerArray(ReverseOffsets));
+		AdjacencyObject->SetArrayField(TEXT("reverse_relations"), MakeEntityQueryIntegerArray(ReverseRelations));
+		return AdjacencyObject;
+	}
+
+	// IsEntityAdjacencyCsrValid는 CSR offset이 0에서 단조 증가해 relation 목록 끝에 닿고 모든 relation ordinal이 범위 안인지 검사한다.
+	bool IsEntityAdjacencyCsrValid(const TArray<int32>& InOffsets, const TArray<int32>& InRelations, int32 InEntityCount, int32 InRelationCount)
+	{
+		if (InOffsets.Num() != InEntityCount + 1 || InOffsets[0] != 0 || InOffsets.Last() != InRelations.Num())
+		{
+			return false;
+		}
+		for (int32 OffsetIndex = 1; OffsetIndex < InOffsets.Num(); ++OffsetIndex)
+		{
+			if (InOffsets[OffsetIndex] < InOffsets[OffsetIndex - 1])
+			{
+				return false;
+			}
+		}
+		for (const int32 RelationOrdinal : InRelations)
+		{
+			if (RelationOrdinal < 0 || RelationOrdinal >= InRelationCount)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// FindIndexedAssetEntryRange는 asset entry가 기록한 global entry 구간이 그 asset만 빠짐없이 담으면 그 구간을, 아니면 전체 배열을 반환한다.
+	TArrayView<const TSharedPtr<FJsonValue>> FindIndexedAssetEntryRange(
+		const TArray<TSharedPtr<FJsonValue>>& InEntryValues,
+		const TSharedPtr<FJsonObject>& InAssetEntry,
+		const TCHAR* InBeginFieldName,
+		const TCHAR* InCountFieldName,
+		const FString& InObjectPath)
+	{
+		const int32 Begin = GetIntegerField(InAssetEntry, InBeginFieldName, INDEX_NONE);
+		const int32 Count = GetIntegerField(InAssetEntry, InCountFieldName, INDEX_NONE);
+		auto IsAssetEntry = [&InEntryValues, &InObjectPath](int32 InEntryIndex)
+		{
+			return InEntryValues.IsValidIndex(InEntryIndex)
+				&& InEntryValues[InEntryIndex].IsValid()
+				&& InEntryValues[InEntryIndex]->Type == EJson::Object
+				&& GetStringField(InEntryValues[InEntryIndex]->AsObject(), TEXT("object_path")) == InObjectPath;
+		};
+		if (Begin < 0 || Count < 0 || Begin + Count > InEntryValues.Num()
+			|| IsAssetEntry(Begin - 1)
+			|| IsAssetEntry(Begin + Count)
+			|| (Count > 0 && (!IsAssetEntry(Begin) || !IsAssetEntry(Begin + Count - 1))))
+		{
+			return MakeArrayView(InEntryValues);
+		}
+		return MakeArrayView(InEntryValues.GetData() + Begin, Count);
+	}
+
+	// LoadSessionEntityIndexRoot는 entity_index.json을 해석하고, 파일 stamp가 같으면 다른 selector가 이미 해석한 root를 공유한다.
+	// root는 읽기 전용으로만 쓰므로 여러 resolved source가 같은 object를 가리켜도 된다.
+	bool LoadSessionEntityIndexRoot(const FString& InEntityIndexPath, TSharedPtr<FJsonObject>& OutIndexRoot)
+	{
+		static ADumpQueryIO::TStampedFileCache<TSharedPtr<FJsonObject>> IndexRootCache;
+
+		return IndexRootCache.FindOrLoad(InEntityIndexPath, OutIndexRoot, [&InEntityIndexPath](TSharedPtr<FJsonObject>& OutLoadedRoot)
+		{
+			return LoadJsonObject(InEntityIndexPath, OutLoadedRoot);
+		});
+	}
+
 	// ResolveIndexedSource는 entity_index_v1 selector와 validated pointers를 native evidence objects로 해석한다.
 	bool ResolveIndexedSource(
 		const FString& InDumpRootPath,
@@ -566,7 +789,7 @@ namespace
 		}
 
 		TSharedPtr<FJsonObject> IndexRoot;
-		if (!LoadJsonObject(EntityIndexPath, IndexRoot))
+		if (!LoadSessionEntityIndexRoot(EntityIndexPath, IndexRoot))
 		{
 			return Fail(TEXT("ADUMP_ENTITY_INDEX_JSON_INVALID"), TEXT("entity_index.json is not a readable JSON object."));
 		}
@@ -581,12 +804,12 @@ namespace
 		if (!TryReadCanonicalRegistry(
 				IndexRoot,
 				TEXT("entity_kind_registry"),
-				ADumpEntityEvidence::GetKnownEntityKindRegistry(),
+				ADumpEntityKinds::GetKnownEntityKindRegistry(),
 				LoadedEntityKindRegistry)
 			|| !TryReadCanonicalRegistry(
 				IndexRoot,
 				TEXT("relation_kind_registry"),
-				ADumpEntityEvidence::GetKnownRelationKindRegistry(),
+				ADumpEntityKinds::GetKnownRelationKindRegistry(),
 				LoadedRelationKindRegistry))
 		{
 			return Fail(TEXT("ADUMP_ENTITY_INDEX_SCHEMA_UNSUPPORTED"), TEXT("entity_index_v1 registries must be canonical ordered unique subsets of the known registries."));
@@ -630,17 +853,37 @@ namespace
 		{
 			return Fail(TEXT("ADUMP_ENTITY_SOURCE_FILE_NOT_FOUND"), TEXT("Indexed entity source path is invalid or escapes the dump root."));
 		}
-		if (!IFileManager::Get().FileExists(*SourceFilePath))
+		if (!ADumpQueryIO::DoesJsonFileExist(SourceFilePath))
 		{
 			return Fail(TEXT("ADUMP_ENTITY_SOURCE_FILE_NOT_FOUND"), FString::Printf(TEXT("Indexed entity source file does not exist: %s"), *SourceFile));
 		}
 
-		TSharedPtr<FJsonObject> SourceRoot;
-		if (!LoadJsonObject(SourceFilePath, SourceRoot))
+		// 기록된 evidence byte span이 크기/CRC32까지 일치하면 source 전체 대신 entity_evidence 구간만 해석한다.
+		TSharedPtr<FJsonObject> EvidenceRoot;
+		FADumpJsonValueSpan EvidenceSpan;
+		EvidenceSpan.Offset = GetInt64Field(ResolvedAssetEntry, TEXT("evidence_byte_offset"), -1);
+		EvidenceSpan.Length = GetInt64Field(ResolvedAssetEntry, TEXT("evidence_byte_length"), 0);
+		EvidenceSpan.Crc = static_cast<uint32>(GetInt64Field(ResolvedAssetEntry, TEXT("evidence_crc32"), 0));
+		TSharedPtr<FJsonValue> EvidenceValue;
+		if (EvidenceSpan.Offset >= 0
+			&& ADumpQueryIO::LoadJsonValueFromFileSpan(
+				SourceFilePath,
+				GetInt64Field(ResolvedAssetEntry, TEXT("source_file_bytes"), -1),
+				EvidenceSpan,
+				EvidenceValue)
+			&& EvidenceValue->Type == EJson::Object)
+		{
+			EvidenceRoot = EvidenceValue->AsObject();
+		}
+		else
 		{
-			return Fail(TEXT("ADUMP_ENTITY_SOURCE_JSON_INVALID"), FString::Printf(TEXT("Indexed source is not a readable JSON object: %s"), *SourceFile));
+			TSharedPtr<FJsonObject> SourceRoot;
+			if (!LoadJsonObject(SourceFilePath, SourceRoot))
+			{
+				return Fail(TEXT("ADUMP_ENTITY_SOURCE_JSON_INVALID"), FString::Printf(TEXT("Indexed source is not a readable JSON object: %s"), *SourceFile));
+			}
+			EvidenceRoot = GetObjectField(SourceRoot, TEXT("entity_evidence"));
 		}
-		const TSharedPtr<FJsonObject> EvidenceRoot = GetObjectField(SourceRoot, TEXT("entity_evidence"));
 		if (!EvidenceRoot.IsValid() || GetStringField(EvidenceRoot, TEXT("schema_version")) != TEXT("entity_evidence_v1"))
 		{
 			return Fail(TEXT("ADUMP_ENTITY_SOURCE_JSON_INVALID"), TEXT("Indexed source does not contain entity_evidence_v1."));
@@ -662,8 +905,22 @@ namespace
 			return Fail(TEXT("ADUMP_ENTITY_SOURCE_JSON_INVALID"), TEXT("entity_evidence_v1 entities or relations array is missing."));
 		}
 
+		// entity_index가 asset별 연속 entry 구간을 기록했으면 그 구간만 검증·해석하고, 경계가 맞지 않으면 전체 배열을 훑는다.
+		const TArrayView<const TSharedPtr<FJsonValue>> AssetEntityEntries = FindIndexedAssetEntryRange(
+			*EntityEntryValues,
+			ResolvedAssetEntry,
+			TEXT("entity_entry_begin"),
+			TEXT("entity_count"),
+			ObjectPath);
+		const TArrayView<const TSharedPtr<FJsonValue>> AssetRelationEntries = FindIndexedAssetEntryRange(
+			*RelationEntryValues,
+			ResolvedAssetEntry,
+			TEXT("relation_entry_begin"),
+			TEXT("relation_count"),
+			ObjectPath);
+
 		TArray<TSharedPtr<FJsonObject>> ResolvedEntities;
-				for (const TSharedPtr<FJsonValue>& EntryValue : *EntityEntryValues)
+				for (const TSharedPtr<FJsonValue>& EntryValue : AssetEntityEntries)
 		{
 			if (!EntryValue.IsValid() || EntryValue->Type != EJson::Object)
 			{
@@ -706,7 +963,7 @@ namespace
 		}
 
 		TArray<TSharedPtr<FJsonObject>> ResolvedRelations;
-				for (const TSharedPtr<FJsonValue>& EntryValue : *RelationEntryValues)
+				for (const TSharedPtr<FJsonValue>& EntryValue : AssetRelationEntries)
 		{
 			if (!EntryValue.IsValid() || EntryValue->Type != EJson::Object)
 			{
@@ -758,6 +1015,198 @@ namespace
 		OutSource.ObjectPath = ObjectPath;
 		OutSource.AssetId = GetStringField(ResolvedAssetEntry, TEXT("asset_id"));
 		OutSource.Fingerprint = Fingerprint;
+
+		// entity_id/stable_key 조회표는 resolved source마다 한 번만 만들어 같은 source의 query와 page가 공유한다.
+		OutSource.EntityOrdinalById.Reserve(OutSource.Entities.Num());
+		for (int32 EntityOrdinal = 0; EntityOrdinal < OutSource.Entities.Num(); ++EntityOrdinal)
+		{
+			const TSharedPtr<FJsonObject>& Entity = OutSource.Entities[EntityOrdinal];
+			OutSource.EntityOrdinalById.Add(GetStringField(Entity, TEXT("entity_id")), EntityOrdinal);
+			OutSource.EntityOrdinalsByStableKey.FindOrAdd(GetStringField(GetObjectField(Entity, TEXT("stable_identity")), TEXT("stable_key"))).Add(EntityOrdinal);
+		}
+		if (const TSharedPtr<FJsonObject> KindOrdinalsObject = GetObjectField(ResolvedAssetEntry, TEXT("entity_kind_ordinals")))
+		{
+			for (const auto& KindPair : KindOrdinalsObject->Values)
+			{
+				TArray<int32>& Ordinals = OutSource.EntityKindOrdinals.Add(FString(KindPair.Key));
+				const TArray<TSharedPtr<FJsonValue>>* OrdinalValues = nullptr;
+				if (KindPair.Value.IsValid() && KindPair.Value->TryGetArray(OrdinalValues) && OrdinalValues)
+				{
+					for (const TSharedPtr<FJsonValue>& OrdinalValue : *OrdinalValues)
+					{
+						Ordinals.Add(OrdinalValue.IsValid() ? static_cast<int32>(OrdinalValue->AsNumber()) : INDEX_NONE);
+					}
+				}
+			}
+		}
+
+		// entity_adjacency가 resolved entity/relation 수와 맞고 endpoint ordinal이 실제 id와 일치할 때만 expand CSR로 쓴다.
+		const TSharedPtr<FJsonObject> AdjacencyObject = GetObjectField(ResolvedAssetEntry, TEXT("entity_adjacency"));
+		const int32 EntityCount = OutSource.Entities.Num();
+		const int32 RelationCount = OutSource.Relations.Num();
+		bool bAdjacencyValid = AdjacencyObject.IsValid()
+			&& ReadEntityQueryIntegerArray(AdjacencyObject, TEXT("relation_from"), OutSource.RelationFromOrdinals)
+			&& ReadEntityQueryIntegerArray(AdjacencyObject, TEXT("relation_to"), OutSource.RelationToOrdinals)
+			&& ReadEntityQueryIntegerArray(AdjacencyObject, TEXT("forward_offsets"), OutSource.ForwardOffsets)
+			&& ReadEntityQueryIntegerArray(AdjacencyObject, TEXT("forward_relations"), OutSource.ForwardRelations)
+			&& ReadEntityQueryIntegerArray(AdjacencyObject, TEXT("reverse_offsets"), OutSource.ReverseOffsets)
+			&& ReadEntityQueryIntegerArray(AdjacencyObject, TEXT("reverse_relations"), OutSource.ReverseRelations)
+			&& OutSource.RelationFromOrdinals.Num() == RelationCount
+			&& OutSource.RelationToOrdinals.Num() == RelationCount
+			&& IsEntityAdjacencyCsrValid(OutSource.ForwardOffsets, OutSource.ForwardRelations, EntityCount, RelationCount)
+			&& IsEntityAdjacencyCsrValid(OutSource.ReverseOffsets, OutSource.ReverseRelations, EntityCount, RelationCount);
+		for (int32 RelationOrdinal = 0; bAdjacencyValid && RelationOrdinal < RelationCount; ++RelationOrdinal)
+		{
+			const int32 FromOrdinal = OutSource.RelationFromOrdinals[RelationOrdinal];
+			const int32 ToOrdinal = OutSource.RelationToOrdinals[RelationOrdinal];
+			const TSharedPtr<FJsonObject>& Relation = OutSource.Relations[RelationOrdinal];
+			bAdjacencyValid = (FromOrdinal == INDEX_NONE && ToOrdinal == INDEX_NONE)
+				|| (OutSource.Entities.IsValidIndex(FromOrdinal)
+					&& OutSource.Entities.IsValidIndex(ToOrdinal)
+					&& GetStringField(OutSource.Entities[FromOrdinal], TEXT("entity_id")) == GetStringField(Relation, TEXT("from_entity_id"))
+					&& GetStringField(OutSource.Entities[ToOrdinal], TEXT("entity_id")) == GetStringField(Relation, TEXT("to_entity_id")));
+		}
+		if (!bAdjacencyValid)
+		{
+			OutSource.RelationFromOrdinals.Reset();
+			OutSource.RelationToOrdinals.Reset();
+			OutSource.ForwardOffsets.Reset();
+			OutSource.ForwardRelations.Reset();
+			OutSource.ReverseOffsets.Reset();
+			OutSource.ReverseRelations.Reset();
+		}
+		return true;
+	}
+
+	// GetEntityQuerySessionLock와 GetEntityQuerySessionEntries는 process 수명 entity query cache와 그 lock이다.
+	FCriticalSection& GetEntityQuerySessionLock()
+	{
+		static FCriticalSection SessionLock;
+		return SessionLock;
+	}
+
+	TMap<FString, FEntityQuerySessionEntry>& GetEntityQuerySessionEntries()
+	{
+		static TMap<FString, FEntityQuerySessionEntry> SessionEntries;
+		return SessionEntries;
+	}
+
+	// ResolveSessionIndexedSource는 entity_index와 source 파일 stamp가 그대로이면 같은 process의 resolved source를 복사 없이 재사용한다.
+	bool ResolveSessionIndexedSource(
+		const FString& InDumpRootPath,
+		const FString& InObjectPathSelector,
+		const FString& InAssetIdSelector,
+		FString& OutSessionKey,
+		TSharedPtr<const FResolvedEntitySource>& OutSource,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		const FString NormalizedDumpRoot = NormalizeDumpRoot(InDumpRootPath);
+		const FString IndexStamp = ADumpQueryIO::MakeJsonFileStamp(FPaths::Combine(NormalizedDumpRoot, TEXT("entity_index.json")));
+		OutSessionKey = FString::Printf(TEXT("%s|%s|%s"), *NormalizedDumpRoot, *InObjectPathSelector, *InAssetIdSelector);
+		{
+			FScopeLock SessionScope(&GetEntityQuerySessionLock());
+			const FEntityQuerySessionEntry* SessionEntry = GetEntityQuerySessionEntries().Find(OutSessionKey);
+			FString CachedSourceFilePath;
+			if (SessionEntry
+				&& !IndexStamp.IsEmpty()
+				&& SessionEntry->IndexStamp == IndexStamp
+				&& ResolveSafeSourceFile(NormalizedDumpRoot, SessionEntry->Source->SourceFile, CachedSourceFilePath)
+				&& SessionEntry->SourceStamp == ADumpQueryIO::MakeJsonFileStamp(CachedSourceFilePath))
+			{
+				OutSource = SessionEntry->Source;
+				return true;
+			}
+		}
+
+		TSharedRef<FResolvedEntitySource> ResolvedSource = MakeShared<FResolvedEntitySource>();
+		if (!ResolveIndexedSource(InDumpRootPath, InObjectPathSelector, InAssetIdSelector, *ResolvedSource, OutErrorCode, OutErrorDetail))
+		{
+			return false;
+		}
+		OutSource = ResolvedSource;
+		FString SourceFilePath;
+		if (!IndexStamp.IsEmpty() && ResolveSafeSourceFile(NormalizedDumpRoot, ResolvedSource->SourceFile, SourceFilePath))
+		{
+			FEntityQuerySessionEntry SessionEntry;
+			SessionEntry.IndexStamp = IndexStamp;
+			SessionEntry.SourceStamp = ADumpQueryIO::MakeJsonFileStamp(SourceFilePath);
+			SessionEntry.Source = OutSource;
+			FScopeLock SessionScope(&GetEntityQuerySessionLock());
+			TMap<FString, FEntityQuerySessionEntry>& SessionEntries = GetEntityQuerySessionEntries();
+			if (SessionEntries.Num() >= 32)
+			{
+				SessionEntries.Reset();
+			}
+			SessionEntries.Add(OutSessionKey, MoveTemp(SessionEntry));
+		}
+		return true;
+	}
+
+	// FindSessionFilterResult는 같은 resolved source와 normalized query의 filter 결과를 찾는다.
+	bool FindSessionFilterResult(const FString& InSessionKey, const FString& InNormalizedQuery, FEntityQueryFilterResult& OutResult)
+	{
+		FScopeLock SessionScope(&GetEntityQuerySessionLock());
+		const FEntityQuerySessionEntry* SessionEntry = GetEntityQuerySessionEntries().Find(InSessionKey);
+		const FEntityQueryFilterResult* FilterResult = SessionEntry ? SessionEntry->FilterResults.Find(InNormalizedQuery) : nullptr;
+		if (!FilterResult)
+		{
+			return false;
+		}
+		OutResult = *FilterResult;
+		return true;
+	}
+
+	// StoreSessionFilterResult는 resolved source session entry에 normalized query의 filter 결과를 보관한다.
+	void StoreSessionFilterResult(const FString& InSessionKey, const FString& InNormalizedQuery, const FEntityQueryFilterResult& InResult)
+	{
+		FScopeLock SessionScope(&GetEntityQuerySessionLock());
+		FEntityQuerySessionEntry* SessionEntry = GetEntityQuerySessionEntries().Find(InSessionKey);
+		if (SessionEntry)
+		{
+			if (SessionEntry->FilterResults.Num() >= 64)
+			{
+				SessionEntry->FilterResults.Reset();
+			}
+			SessionEntry->FilterResults.Add(InNormalizedQuery, InResult);
+		}
+	}
+
+	// CollectKindTableEntityOrdinals는 asset별 kind ordinal table에서 EntityKinds 후보를 canonical 순서로 모으고, table이 맞지 않으면 false를 반환한다.
+	bool CollectKindTableEntityOrdinals(
+		const FResolvedEntitySource& InSource,
+		const TArray<FString>& InEntityKinds,
+		TArray<int32>& OutOrdinals)
+	{
+		OutOrdinals.Reset();
+		int32 TableOrdinalCount = 0;
+		for (const TPair<FString, TArray<int32>>& KindPair : InSource.EntityKindOrdinals)
+		{
+			TableOrdinalCount += KindPair.Value.Num();
+		}
+		if (TableOrdinalCount != InSource.Entities.Num())
+		{
+			return false;
+		}
+		for (const FString& EntityKind : InEntityKinds)
+		{
+			const TArray<int32>* KindOrdinals = InSource.EntityKindOrdinals.Find(EntityKind);
+			if (!KindOrdinals)
+			{
+				continue;
+			}
+			for (const int32 Ordinal : *KindOrdinals)
+			{
+				if (!InSource.Entities.IsValidIndex(Ordinal)
+					|| GetStringField(InSource.Entities[Ordinal], TEXT("entity_kind")) != EntityKind)
+				{
+					OutOrdinals.Reset();
+					return false;
+				}
+				OutOrdinals.Add(Ordinal);
+			}
+		}
+		OutOrdinals.Sort();
 		return true;
 	}
 
@@ -892,6 +1341,418 @@ namespace
 		RootObject->SetBoolField(TEXT("all_resolved"), true);
 		return RootObject;
 	}
+
+	// FEntityIndexSourceResult는 dump 파일 하나에서 만든 entity_index_v1 asset entry와 draft, 또는 첫 실패다.
+	struct FEntityIndexSourceResult
+	{
+		FString SourceFile;
+		int64 SourceFileBytes = -1;
+		FString SourceFileTimestamp;
+		bool bHasEvidence = false;
+		bool bReused = false;
+		bool bParsed = false;
+		FString AdapterProfile;
+		TSharedPtr<FJsonObject> AssetEntry;
+		TArray<FEntityIndexDraft> EntityDrafts;
+		TArray<FRelationIndexDraft> RelationDrafts;
+		FString ErrorCode;
+		FString ErrorDetail;
+	};
+
+	// FPreviousEntityIndex는 incremental 재사용 판단에 쓰는 직전 entity_index_v1의 source_file별 entry다.
+	struct FPreviousEntityIndex
+	{
+		TMap<FString, TSharedPtr<FJsonObject>> AssetsBySource;
+		TMap<FString, TArray<TSharedPtr<FJsonObject>>> EntitiesBySource;
+		TMap<FString, TArray<TSharedPtr<FJsonObject>>> RelationsBySource;
+		TMap<FString, TSharedPtr<FJsonObject>> ScannedSourcesBySource;
+	};
+
+	// LoadPreviousEntityIndex는 기존 entity_index_v1을 source_file 기준으로 묶고, 호환되지 않으면 빈 결과로 둔다.
+	void LoadPreviousEntityIndex(const FString& InEntityIndexPath, FPreviousEntityIndex& OutPrevious)
+	{
+		OutPrevious = FPreviousEntityIndex();
+		TSharedPtr<FJsonObject> PreviousRoot;
+		if (!IFileManager::Get().FileExists(*InEntityIndexPath)
+			|| !LoadJsonObject(InEntityIndexPath, PreviousRoot)
+			|| GetStringField(PreviousRoot, TEXT("schema_version")) != TEXT("entity_index_v1")
+			|| GetStringField(PreviousRoot, TEXT("entity_evidence_schema_version")) != TEXT("entity_evidence_v1"))
+		{
+			return;
+		}
+
+		auto GroupBySource = [](const TArray<TSharedPtr<FJsonValue>>* InValues, TMap<FString, TArray<TSharedPtr<FJsonObject>>>& OutGroups)
+		{
+			if (!InValues)
+			{
+				return;
+			}
+			for (const TSharedPtr<FJsonValue>& EntryValue : *InValues)
+			{
+				if (EntryValue.IsValid() && EntryValue->Type == EJson::Object)
+				{
+					const TSharedPtr<FJsonObject> Entry = EntryValue->AsObject();
+					OutGroups.FindOrAdd(GetStringField(Entry, TEXT("source_file"))).Add(Entry);
+				}
+			}
+		};
+		GroupBySource(GetArrayField(PreviousRoot, TEXT("entities")), OutPrevious.EntitiesBySource);
+		GroupBySource(GetArrayField(PreviousRoot, TEXT("relations")), OutPrevious.RelationsBySource);
+
+		TMap<FString, TArray<TSharedPtr<FJsonObject>>> AssetGroups;
+		TMap<FString, TArray<TSharedPtr<FJsonObject>>> ScannedGroups;
+		GroupBySource(GetArrayField(PreviousRoot, TEXT("assets")), AssetGroups);
+		GroupBySource(GetArrayField(PreviousRoot, TEXT("scanned_source_files")), ScannedGroups);
+		for (const TPair<FString, TArray<TSharedPtr<FJsonObject>>>& AssetGroup : AssetGroups)
+		{
+			if (!AssetGroup.Key.IsEmpty() && AssetGroup.Value.Num() == 1)
+			{
+				OutPrevious.AssetsBySource.Add(AssetGroup.Key, AssetGroup.Value[0]);
+			}
+		}
+		for (const TPair<FString, TArray<TSharedPtr<FJsonObject>>>& ScannedGroup : ScannedGroups)
+		{
+			if (!ScannedGroup.Key.IsEmpty() && ScannedGroup.Value.Num() == 1)
+			{
+				OutPrevious.ScannedSourcesBySource.Add(ScannedGroup.Key, ScannedGroup.Value[0]);
+			}
+		}
+	}
+
+	// IsPreviousEntitySourceCurrent는 직전 entry가 같은 source_file의 크기/수정 시각을 기록했는지 검사한다.
+	bool IsPreviousEntitySourceCurrent(const TSharedPtr<FJsonObject>& InPreviousEntry, const FEntityIndexSourceResult& InResult)
+	{
+		return InPreviousEntry.IsValid()
+			&& InResult.SourceFileBytes >= 0
+			&& GetInt64Field(InPreviousEntry, TEXT("source_file_bytes"), -1) == InResult.SourceFileBytes
+			&& GetStringField(InPreviousEntry, TEXT("source_file_timestamp")) == InResult.SourceFileTimestamp;
+	}
+
+	// TryReusePreviousEntitySource는 source 파일과 asset_index fingerprint가 그대로인 직전 entry로 draft를 복원한다.
+	bool TryReusePreviousEntitySource(
+		const FPreviousEntityIndex& InPrevious,
+		const TMap<FString, TSharedPtr<FJsonObject>>& InAssetIndexByObjectPath,
+		FEntityIndexSourceResult& InOutResult)
+	{
+		const TSharedPtr<FJsonObject> PreviousAsset = InPrevious.AssetsBySource.FindRef(InOutResult.SourceFile);
+		if (!IsPreviousEntitySourceCurrent(PreviousAsset, InOutResult))
+		{
+			return false;
+		}
+
+		const FString ObjectPath = GetStringField(PreviousAsset, TEXT("object_path"));
+		const FString Fingerprint = GetStringField(PreviousAsset, TEXT("fingerprint"));
+		const FString AdapterProfile = GetStringField(PreviousAsset, TEXT("adapter_profile"));
+		const TSharedPtr<FJsonObject> AssetIndexEntry = InAssetIndexByObjectPath.FindRef(ObjectPath);
+		const TArray<TSharedPtr<FJsonObject>>* PreviousEntities = InPrevious.EntitiesBySource.Find(InOutResult.SourceFile);
+		const TArray<TSharedPtr<FJsonObject>>* PreviousRelations = InPrevious.RelationsBySource.Find(InOutResult.SourceFile);
+		const int32 PreviousEntityCount = PreviousEntities ? PreviousEntities->Num() : 0;
+		const int32 PreviousRelationCount = PreviousRelations ? PreviousRelations->Num() : 0;
+		if (ObjectPath.IsEmpty()
+			|| Fingerprint.IsEmpty()
+			|| AdapterProfile.IsEmpty()
+			|| !AssetIndexEntry.IsValid()
+			|| GetStringField(AssetIndexEntry, TEXT("fingerprint")) != Fingerprint
+			|| GetIntegerField(PreviousAsset, TEXT("entity_count"), -1) != PreviousEntityCount
+			|| GetIntegerField(PreviousAsset, TEXT("relation_count"), -1) != PreviousRelationCount)
+		{
+			return false;
+		}
+
+		const FString AssetId = GetStringField(AssetIndexEntry, TEXT("asset_id"));
+		TSharedRef<FJsonObject> AssetEntry = MakeShared<FJsonObject>();
+		AssetEntry->Values = PreviousAsset->Values;
+		AssetEntry->RemoveField(TEXT("entity_asset_entry_id"));
+		AssetEntry->SetStringField(TEXT("asset_id"), AssetId);
+
+		TArray<FEntityIndexDraft> EntityDrafts;
+		for (int32 EntryIndex = 0; EntryIndex < PreviousEntityCount; ++EntryIndex)
+		{
+			const TSharedPtr<FJsonObject>& Entry = (*PreviousEntities)[EntryIndex];
+			FEntityIndexDraft Draft;
+			Draft.AssetId = AssetId;
+			Draft.ObjectPath = ObjectPath;
+			Draft.Fingerprint = Fingerprint;
+			Draft.EntityId = GetStringField(Entry, TEXT("entity_id"));
+			Draft.EntityKind = GetStringField(Entry, TEXT("entity_kind"));
+			Draft.StableKey = GetStringField(Entry, TEXT("stable_key"));
+			Draft.IdentityQuality = GetStringField(Entry, TEXT("identity_quality"));
+			Draft.SourceFile = InOutResult.SourceFile;
+			Draft.JsonPointer = GetStringField(Entry, TEXT("json_pointer"));
+			Draft.CanonicalOrder = GetIntegerField(Entry, TEXT("canonical_order"), INDEX_NONE);
+			Draft.OwnerEntityId = Entry->TryGetField(TEXT("owner_entity_id"));
+			Draft.State = GetStringField(Entry, TEXT("state"));
+			if (const TArray<TSharedPtr<FJsonValue>>* FacetValues = GetArrayField(Entry, TEXT("available_facets")))
+			{
+				for (const TSharedPtr<FJsonValue>& FacetValue : *FacetValues)
+				{
+					Draft.FacetNames.Add(FacetValue.IsValid() ? FacetValue->AsString() : FString());
+				}
+			}
+			if (GetStringField(Entry, TEXT("object_path")) != ObjectPath || Draft.EntityId.IsEmpty() || Draft.JsonPointer.IsEmpty())
+			{
+				return false;
+			}
+			EntityDrafts.Add(MoveTemp(Draft));
+		}
+
+		TArray<FRelationIndexDraft> RelationDrafts;
+		for (int32 EntryIndex = 0; EntryIndex < PreviousRelationCount; ++EntryIndex)
+		{
+			const TSharedPtr<FJsonObject>& Entry = (*PreviousRelations)[EntryIndex];
+			FRelationIndexDraft Draft;
+			Draft.AssetId = AssetId;
+			Draft.ObjectPath = ObjectPath;
+			Draft.Fingerprint = Fingerprint;
+			Draft.RelationId = GetStringField(Entry, TEXT("relation_id"));
+			Draft.RelationKind = GetStringField(Entry, TEXT("relation_kind"));
+			Draft.FromEntityId = GetStringField(Entry, TEXT("from_entity_id"));
+			Draft.ToEntityId = GetStringField(Entry, TEXT("to_entity_id"));
+			Draft.SourceFile = InOutResult.SourceFile;
+			Draft.JsonPointer = GetStringField(Entry, TEXT("json_pointer"));
+			Draft.CanonicalOrder = GetIntegerField(Entry, TEXT("canonical_order"), INDEX_NONE);
+			Draft.State = GetStringField(Entry, TEXT("state"));
+			if (GetStringField(Entry, TEXT("object_path")) != ObjectPath || Draft.RelationId.IsEmpty() || Draft.JsonPointer.IsEmpty())
+			{
+				return false;
+			}
+			RelationDrafts.Add(MoveTemp(Draft));
+		}
+
+		InOutResult.bHasEvidence = true;
+		InOutResult.bReused = true;
+		InOutResult.AdapterProfile = AdapterProfile;
+		InOutResult.AssetEntry = AssetEntry;
+		InOutResult.EntityDrafts = MoveTemp(EntityDrafts);
+		InOutResult.RelationDrafts = MoveTemp(RelationDrafts);
+		return true;
+	}
+
+	// LoadEntityEvidenceRoot는 dump 파일 byte에서 top-level entity_evidence span만 해석하고, span을 못 찾으면 전체 DOM으로 되돌아간다.
+	// gzip source의 span은 해제된 byte 기준이라 파일 구간 읽기에 쓸 수 없으므로 기록하지 않는다.
+	bool LoadEntityEvidenceRoot(
+		const FString& InDumpFilePath,
+		TSharedPtr<FJsonObject>& OutEvidenceRoot,
+		FADumpJsonValueSpan& OutEvidenceSpan)
+	{
+		OutEvidenceRoot.Reset();
+		OutEvidenceSpan = FADumpJsonValueSpan();
+		TArray<uint8> SourceBytes;
+		bool bSourceCompressed = false;
+		if (!ADumpQueryIO::LoadJsonBytesFromFile(InDumpFilePath, SourceBytes, &bSourceCompressed))
+		{
+			return false;
+		}
+
+		FADumpJsonValueSpan RootSpan;
+		TMap<FString, FADumpJsonValueSpan> MemberSpans;
+		if (ADumpQueryIO::ScanRootMemberValueSpans(SourceBytes, RootSpan, MemberSpans))
+		{
+			const FADumpJsonValueSpan* EvidenceSpan = MemberSpans.Find(TEXT("entity_evidence"));
+			if (!EvidenceSpan)
+			{
+				return false;
+			}
+			TSharedPtr<FJsonValue> EvidenceValue;
+			if (ADumpQueryIO::ParseJsonValueSpan(SourceBytes, *EvidenceSpan, EvidenceValue))
+			{
+				if (EvidenceValue->Type != EJson::Object)
+				{
+					return false;
+				}
+				OutEvidenceRoot = EvidenceValue->AsObject();
+				if (!bSourceCompressed)
+				{
+					OutEvidenceSpan = *EvidenceSpan;
+				}
+				return OutEvidenceRoot.IsValid();
+			}
+		}
+
+		TSharedPtr<FJsonObject> DumpRoot;
+		if (!LoadJsonObject(InDumpFilePath, DumpRoot))
+		{
+			return false;
+		}
+		OutEvidenceRoot = GetObjectField(DumpRoot, TEXT("entity_evidence"));
+		return OutEvidenceRoot.IsValid();
+	}
+
+	// ReadEntityIndexSource는 dump 파일 하나의 entity_evidence를 검증해 asset entry와 draft를 만든다. worker thread에서 호출된다.
+	bool ReadEntityIndexSource(
+		const FString& InDumpFilePath,
+		const FString& InDumpRootPath,
+		const TMap<FString, TSharedPtr<FJsonObject>>& InAssetIndexByObjectPath,
+		FEntityIndexSourceResult& InOutResult)
+	{
+		auto Fail = [&InOutResult](const TCHAR* InCode, const FString& InDetail)
+		{
+			InOutResult.ErrorCode = InCode;
+			InOutResult.ErrorDetail = InDetail;
+			return false;
+		};
+
+		InOutResult.bParsed = true;
+		TSharedPtr<FJsonObject> EvidenceRoot;
+		FADumpJsonValueSpan EvidenceSpan;
+		if (!LoadEntityEvidenceRoot(InDumpFilePath, EvidenceRoot, EvidenceSpan))
+		{
+			return true;
+		}
+		if (GetStringField(EvidenceRoot, TEXT("schema_version")) != TEXT("entity_evidence_v1"))
+		{
+			return Fail(TEXT("ADUMP_ENTITY_INDEX_SCHEMA_UNSUPPORTED"), FString::Printf(TEXT("Unsupported entity evidence schema in: %s"), *InDumpFilePath));
+		}
+
+		FString AdapterProfile = GetStringField(EvidenceRoot, TEXT("adapter_profile"));
+		if (AdapterProfile.IsEmpty())
+		{
+			AdapterProfile = TEXT("blueprint_core_v1");
+		}
+		TSet<FString> ProfileEntityKinds;
+		TSet<FString> ProfileRelationKinds;
+		if (!AddAdapterProfileRegistry(AdapterProfile, ProfileEntityKinds, ProfileRelationKinds))
+		{
+			return Fail(TEXT("ADUMP_ENTITY_INDEX_SCHEMA_UNSUPPORTED"), FString::Printf(TEXT("Unsupported entity evidence adapter profile in: %s"), *InDumpFilePath));
+		}
+		InOutResult.bHasEvidence = true;
+		InOutResult.AdapterProfile = AdapterProfile;
+
+		const TSharedPtr<FJsonObject> EvidenceAsset = GetObjectField(EvidenceRoot, TEXT("asset"));
+		const FString ObjectPath = GetStringField(EvidenceAsset, TEXT("object_path"));
+		const FString Fingerprint = GetStringField(EvidenceAsset, TEXT("fingerprint"));
+		const TSharedPtr<FJsonObject> AssetIndexEntry = InAssetIndexByObjectPath.FindRef(ObjectPath);
+		if (ObjectPath.IsEmpty() || Fingerprint.IsEmpty() || !AssetIndexEntry.IsValid())
+		{
+			return Fail(TEXT("ADUMP_ENTITY_INDEX_SCHEMA_UNSUPPORTED"), TEXT("entity_evidence_v1 asset is not present in asset_index_v1."));
+		}
+		if (GetStringField(AssetIndexEntry, TEXT("fingerprint")) != Fingerprint)
+		{
+			return Fail(TEXT("ADUMP_ENTITY_FINGERPRINT_MISMATCH"), FString::Printf(TEXT("Asset fingerprint mismatch while indexing: %s"), *ObjectPath));
+		}
+
+		FString SourceFile;
+		if (!MakeDumpRootRelativePath(InDumpFilePath, InDumpRootPath, SourceFile))
+		{
+			return Fail(TEXT("ADUMP_ENTITY_SOURCE_FILE_NOT_FOUND"), TEXT("Entity evidence source is outside the dump root."));
+		}
+		const TArray<TSharedPtr<FJsonValue>>* EntityValues = GetArrayField(EvidenceRoot, TEXT("entities"));
+		const TArray<TSharedPtr<FJsonValue>>* RelationValues = GetArrayField(EvidenceRoot, TEXT("relations"));
+		if (!EntityValues || !RelationValues)
+		{
+			return Fail(TEXT("ADUMP_ENTITY_SOURCE_JSON_INVALID"), FString::Printf(TEXT("entity_evidence_v1 arrays are missing: %s"), *SourceFile));
+		}
+
+		const TArray<FString>& SourceEntityRegistry = AdapterProfile == TEXT("niagara_material_v1")
+			? ADumpEntityKinds::GetNiagaraMaterialEntityKindRegistry()
+			: (AdapterProfile == TEXT("niagara_deep_v1")
+				? ADumpEntityKinds::GetNiagaraDeepEntityKindRegistry()
+				: (AdapterProfile == TEXT("niagara_mvp_v1")
+					? ADumpEntityKinds::GetNiagaraEntityKindRegistry()
+					: ADumpEntityKinds::GetEntityKindRegistry()));
+		const TArray<FString>& SourceRelationRegistry = AdapterProfile == TEXT("niagara_material_v1")
+			? ADumpEntityKinds::GetNiagaraMaterialRelationKindRegistry()
+			: (AdapterProfile == TEXT("niagara_deep_v1")
+				? ADumpEntityKinds::GetNiagaraDeepRelationKindRegistry()
+				: (AdapterProfile == TEXT("niagara_mvp_v1")
+					? ADumpEntityKinds::GetNiagaraRelationKindRegistry()
+					: ADumpEntityKinds::GetRelationKindRegistry()));
+
+		TSharedRef<FJsonObject> AssetEntry = MakeShared<FJsonObject>();
+		AssetEntry->SetStringField(TEXT("asset_id"), GetStringField(AssetIndexEntry, TEXT("asset_id")));
+		AssetEntry->SetStringField(TEXT("object_path"), ObjectPath);
+		AssetEntry->SetStringField(TEXT("fingerprint"), Fingerprint);
+		AssetEntry->SetStringField(TEXT("source_file"), SourceFile);
+		AssetEntry->SetStringField(TEXT("json_pointer"), TEXT("/entity_evidence"));
+		AssetEntry->SetNumberField(TEXT("entity_count"), EntityValues->Num());
+		AssetEntry->SetNumberField(TEXT("relation_count"), RelationValues->Num());
+		AssetEntry->SetStringField(TEXT("adapter_profile"), AdapterProfile);
+		AssetEntry->SetNumberField(TEXT("source_file_bytes"), static_cast<double>(InOutResult.SourceFileBytes));
+		AssetEntry->SetStringField(TEXT("source_file_timestamp"), InOutResult.SourceFileTimestamp);
+		if (EvidenceSpan.Offset >= 0)
+		{
+			AssetEntry->SetNumberField(TEXT("evidence_byte_offset"), static_cast<double>(EvidenceSpan.Offset));
+			AssetEntry->SetNumberField(TEXT("evidence_byte_length"), static_cast<double>(EvidenceSpan.Length));
+			AssetEntry->SetNumberField(TEXT("evidence_crc32"), static_cast<double>(EvidenceSpan.Crc));
+		}
+		InOutResult.AssetEntry = AssetEntry;
+
+		for (int32 EntityIndex = 0; EntityIndex < EntityValues->Num(); ++EntityIndex)
+		{
+			const TSharedPtr<FJsonValue>& EntityValue = (*EntityValues)[EntityIndex];
+			if (!EntityValue.IsValid() || EntityValue->Type != EJson::Object)
+			{
+				return Fail(TEXT("ADUMP_ENTITY_SOURCE_JSON_INVALID"), TEXT("entity_evidence_v1 contains a non-object entity."));
+			}
+			const TSharedPtr<FJsonObject> EntityObject = EntityValue->AsObject();
+			const TSharedPtr<FJsonObject> StableIdentity = GetObjectField(EntityObject, TEXT("stable_identity"));
+			const TSharedPtr<FJsonObject> FacetsObject = GetObjectField(EntityObject, TEXT("facets"));
+			FEntityIndexDraft Draft;
+			Draft.AssetId = GetStringField(AssetIndexEntry, TEXT("asset_id"));
+			Draft.ObjectPath = ObjectPath;
+			Draft.Fingerprint = Fingerprint;
+			Draft.EntityId = GetStringField(EntityObject, TEXT("entity_id"));
+			Draft.EntityKind = GetStringField(EntityObject, TEXT("entity_kind"));
+			Draft.StableKey = GetStringField(StableIdentity, TEXT("stable_key"));
+			Draft.IdentityQuality = GetStringField(StableIdentity, TEXT("quality"));
+			Draft.SourceFile = SourceFile;
+			Draft.JsonPointer = FString::Printf(TEXT("/entity_evidence/entities/%d"), EntityIndex);
+			Draft.CanonicalOrder = GetIntegerField(EntityObject, TEXT("canonical_order"), EntityIndex);
+			Draft.OwnerEntityId = EntityObject->TryGetField(TEXT("owner_entity_id"));
+			Draft.State = GetStringField(EntityObject, TEXT("state"));
+			if (FacetsObject.IsValid())
+			{
+				for (const auto& FacetPair : FacetsObject->Values)
+				{
+					Draft.FacetNames.Add(FString(FacetPair.Key));
+				}
+				Draft.FacetNames.Sort();
+			}
+			if (Draft.EntityId.IsEmpty()
+				|| !ADumpEntityKinds::GetKnownEntityKindRegistry().Contains(Draft.EntityKind)
+				|| !SourceEntityRegistry.Contains(Draft.EntityKind)
+				|| Draft.StableKey.IsEmpty()
+				|| (Draft.IdentityQuality != TEXT("exact") && Draft.IdentityQuality != TEXT("composite") && Draft.IdentityQuality != TEXT("fallback"))
+				|| !IsEntityQueryCompletenessState(Draft.State))
+			{
+				return Fail(TEXT("ADUMP_ENTITY_SOURCE_JSON_INVALID"), TEXT("entity_evidence_v1 contains an invalid entity identity contract."));
+			}
+			InOutResult.EntityDrafts.Add(MoveTemp(Draft));
+		}
+
+		for (int32 RelationIndex = 0; RelationIndex < RelationValues->Num(); ++RelationIndex)
+		{
+			const TSharedPtr<FJsonValue>& RelationValue = (*RelationValues)[RelationIndex];
+			if (!RelationValue.IsValid() || RelationValue->Type != EJson::Object)
+			{
+				return Fail(TEXT("ADUMP_ENTITY_SOURCE_JSON_INVALID"), TEXT("entity_evidence_v1 contains a non-object relation."));
+			}
+			const TSharedPtr<FJsonObject> RelationObject = RelationValue->AsObject();
+			FRelationIndexDraft Draft;
+			Draft.AssetId = GetStringField(AssetIndexEntry, TEXT("asset_id"));
+			Draft.ObjectPath = ObjectPath;
+			Draft.Fingerprint = Fingerprint;
+			Draft.RelationId = GetStringField(RelationObject, TEXT("relation_id"));
+			Draft.RelationKind = GetStringField(RelationObject, TEXT("relation_kind"));
+			Draft.FromEntityId = GetStringField(RelationObject, TEXT("from_entity_id"));
+			Draft.ToEntityId = GetStringField(RelationObject, TEXT("to_entity_id"));
+			Draft.SourceFile = SourceFile;
+			Draft.JsonPointer = FString::Printf(TEXT("/entity_evidence/relations/%d"), RelationIndex);
+			Draft.CanonicalOrder = RelationIndex;
+			Draft.State = GetStringField(RelationObject, TEXT("state"));
+			if (Draft.RelationId.IsEmpty()
+				|| !ADumpEntityKinds::GetKnownRelationKindRegistry().Contains(Draft.RelationKind)
+				|| !SourceRelationRegistry.Contains(Draft.RelationKind)
+				|| Draft.FromEntityId.IsEmpty()
+				|| Draft.ToEntityId.IsEmpty()
+				|| !IsEntityQueryCompletenessState(Draft.State))
+			{
+				return Fail(TEXT("ADUMP_ENTITY_SOURCE_JSON_INVALID"), TEXT("entity_evidence_v1 contains an invalid relation contract."));
+			}
+			InOutResult.RelationDrafts.Add(MoveTemp(Draft));
+		}
+		return true;
+	}
 }
 
 namespace ADumpEntityQuery
@@ -933,7 +1794,8 @@ namespace ADumpEntityQuery
 		const FString& InDumpRootPath,
 		FString& OutEntityIndexFilePath,
 		FString& OutErrorCode,
-		FString& OutErrorDetail)
+		FString& OutErrorDetail,
+		bool bInForceSingleThread)
 	{
 		OutEntityIndexFilePath.Reset();
 		OutErrorCode.Reset();
@@ -982,179 +1844,170 @@ namespace ADumpEntityQuery
 
 		TArray<FString> DumpFilePaths;
 		IFileManager::Get().FindFilesRecursive(DumpFilePaths, *NormalizedDumpRoot, TEXT("*.dump.json"), true, false, false);
+		ADumpPack::FindPackedFiles(NormalizedDumpRoot, TEXT("*.dump.json"), DumpFilePaths);
 		DumpFilePaths.Sort();
 
-				TArray<TSharedPtr<FJsonObject>> AssetEntries;
-		TArray<FEntityIndexDraft> EntityDrafts;
-		TArray<FRelationIndexDraft> RelationDrafts;
-		TSet<FString> ActiveEntityKinds;
-		TSet<FString> ActiveRelationKinds;
-		bool bSawEntityEvidence = false;
-		for (const FString& DumpFilePath : DumpFilePaths)
+		// 직전 entity_index_v1에서 크기/수정 시각이 같은 source는 재사용하고 나머지만 worker에서 읽는다.
+		FPreviousEntityIndex PreviousIndex;
+		LoadPreviousEntityIndex(FPaths::Combine(NormalizedDumpRoot, TEXT("entity_index.json")), PreviousIndex);
+
+		TArray<FEntityIndexSourceResult> SourceResults;
+		SourceResults.SetNum(DumpFilePaths.Num());
+		TArray<int32> PendingSourceOrdinals;
+		for (int32 SourceOrdinal = 0; SourceOrdinal < DumpFilePaths.Num(); ++SourceOrdinal)
 		{
-			TSharedPtr<FJsonObject> DumpRoot;
-			if (!LoadJsonObject(DumpFilePath, DumpRoot))
+			FEntityIndexSourceResult& SourceResult = SourceResults[SourceOrdinal];
+			if (!ADumpQueryIO::GetJsonFileStat(DumpFilePaths[SourceOrdinal], SourceResult.SourceFileBytes, SourceResult.SourceFileTimestamp))
 			{
-				continue;
+				SourceResult.SourceFileBytes = -1;
+				SourceResult.SourceFileTimestamp.Reset();
 			}
-			const TSharedPtr<FJsonObject> EvidenceRoot = GetObjectField(DumpRoot, TEXT("entity_evidence"));
-			if (!EvidenceRoot.IsValid())
+			if (MakeDumpRootRelativePath(DumpFilePaths[SourceOrdinal], NormalizedDumpRoot, SourceResult.SourceFile)
+				&& (IsPreviousEntitySourceCurrent(PreviousIndex.ScannedSourcesBySource.FindRef(SourceResult.SourceFile), SourceResult)
+					|| TryReusePreviousEntitySource(PreviousIndex, AssetIndexByObjectPath, SourceResult)))
 			{
 				continue;
 			}
-						if (GetStringField(EvidenceRoot, TEXT("schema_version")) != TEXT("entity_evidence_v1"))
-			{
-				return Fail(TEXT("ADUMP_ENTITY_INDEX_SCHEMA_UNSUPPORTED"), FString::Printf(TEXT("Unsupported entity evidence schema in: %s"), *DumpFilePath));
-			}
-
-			FString AdapterProfile = GetStringField(EvidenceRoot, TEXT("adapter_profile"));
-			if (AdapterProfile.IsEmpty())
-			{
-				AdapterProfile = TEXT("blueprint_core_v1");
-			}
-			if (!AddAdapterProfileRegistry(AdapterProfile, ActiveEntityKinds, ActiveRelationKinds))
-			{
-				return Fail(TEXT("ADUMP_ENTITY_INDEX_SCHEMA_UNSUPPORTED"), FString::Printf(TEXT("Unsupported entity evidence adapter profile in: %s"), *DumpFilePath));
-			}
-			bSawEntityEvidence = true;
-									const TArray<FString>& SourceEntityRegistry = AdapterProfile == TEXT("niagara_material_v1")
-				? ADumpEntityEvidence::GetNiagaraMaterialEntityKindRegistry()
-				: (AdapterProfile == TEXT("niagara_deep_v1")
-					? ADumpEntityEvidence::GetNiagaraDeepEntityKindRegistry()
-					: (AdapterProfile == TEXT("niagara_mvp_v1")
-						? ADumpEntityEvidence::GetNiagaraEntityKindRegistry()
-						: ADumpEntityEvidence::GetEntityKindRegistry()));
-			const TArray<FString>& SourceRelationRegistry = AdapterProfile == TEXT("niagara_material_v1")
-				? ADumpEntityEvidence::GetNiagaraMaterialRelationKindRegistry()
-				: (AdapterProfile == TEXT("niagara_deep_v1")
-					? ADumpEntityEvidence::GetNiagaraDeepRelationKindRegistry()
-					: (AdapterProfile == TEXT("niagara_mvp_v1")
-						? ADumpEntityEvidence::GetNiagaraRelationKindRegistry()
-						: ADumpEntityEvidence::GetRelationKindRegistry()));
+			PendingSourceOrdinals.Add(SourceOrdinal);
+		}
 
-			const TSharedPtr<FJsonObject> EvidenceAsset = GetObjectField(EvidenceRoot, TEXT("asset"));
-			const FString ObjectPath = GetStringField(EvidenceAsset, TEXT("object_path"));
-			const FString Fingerprint = GetStringField(EvidenceAsset, TEXT("fingerprint"));
-			const TSharedPtr<FJsonObject> AssetIndexEntry = AssetIndexByObjectPath.FindRef(ObjectPath);
-			if (ObjectPath.IsEmpty() || Fingerprint.IsEmpty() || !AssetIndexEntry.IsValid())
-			{
-				return Fail(TEXT("ADUMP_ENTITY_INDEX_SCHEMA_UNSUPPORTED"), TEXT("entity_evidence_v1 asset is not present in asset_index_v1."));
-			}
-			if (GetStringField(AssetIndexEntry, TEXT("fingerprint")) != Fingerprint)
-			{
-				return Fail(TEXT("ADUMP_ENTITY_FINGERPRINT_MISMATCH"), FString::Printf(TEXT("Asset fingerprint mismatch while indexing: %s"), *ObjectPath));
-			}
+		ParallelFor(PendingSourceOrdinals.Num(), [&](int32 PendingIndex)
+		{
+			const int32 SourceOrdinal = PendingSourceOrdinals[PendingIndex];
+			ReadEntityIndexSource(DumpFilePaths[SourceOrdinal], NormalizedDumpRoot, AssetIndexByObjectPath, SourceResults[SourceOrdinal]);
+		}, bInForceSingleThread ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
 
-			FString SourceFile;
-			if (!MakeDumpRootRelativePath(DumpFilePath, NormalizedDumpRoot, SourceFile))
+		// 병합은 정렬된 파일 순서로 직렬 수행하므로 첫 실패와 최종 출력은 worker 완료 순서와 무관하다.
+		TArray<TSharedPtr<FJsonObject>> AssetEntries;
+		TArray<FEntityIndexDraft> EntityDrafts;
+		TArray<FRelationIndexDraft> RelationDrafts;
+		TArray<TSharedPtr<FJsonValue>> ScannedSourceValues;
+		TSet<FString> ActiveEntityKinds;
+		TSet<FString> ActiveRelationKinds;
+		bool bSawEntityEvidence = false;
+		int32 ReusedSourceCount = 0;
+		int32 ParsedSourceCount = 0;
+		for (FEntityIndexSourceResult& SourceResult : SourceResults)
+		{
+			if (!SourceResult.ErrorCode.IsEmpty())
 			{
-				return Fail(TEXT("ADUMP_ENTITY_SOURCE_FILE_NOT_FOUND"), TEXT("Entity evidence source is outside the dump root."));
+				return Fail(*SourceResult.ErrorCode, SourceResult.ErrorDetail);
 			}
-			const TArray<TSharedPtr<FJsonValue>>* EntityValues = GetArrayField(EvidenceRoot, TEXT("entities"));
-			const TArray<TSharedPtr<FJsonValue>>* RelationValues = GetArrayField(EvidenceRoot, TEXT("relations"));
-			if (!EntityValues || !RelationValues)
+			ReusedSourceCount += SourceResult.bReused ? 1 : 0;
+			ParsedSourceCount += SourceResult.bParsed ? 1 : 0;
+			if (!SourceResult.bHasEvidence)
 			{
-				return Fail(TEXT("ADUMP_ENTITY_SOURCE_JSON_INVALID"), FString::Printf(TEXT("entity_evidence_v1 arrays are missing: %s"), *SourceFile));
+				if (!SourceResult.SourceFile.IsEmpty() && SourceResult.SourceFileBytes >= 0)
+				{
+					TSharedRef<FJsonObject> ScannedSource = MakeShared<FJsonObject>();
+					ScannedSource->SetStringField(TEXT("source_file"), SourceResult.SourceFile);
+					ScannedSource->SetNumberField(TEXT("source_file_bytes"), static_cast<double>(SourceResult.SourceFileBytes));
+					ScannedSource->SetStringField(TEXT("source_file_timestamp"), SourceResult.SourceFileTimestamp);
+					ScannedSourceValues.Add(MakeShared<FJsonValueObject>(ScannedSource));
+				}
+				continue;
 			}
+			AddAdapterProfileRegistry(SourceResult.AdapterProfile, ActiveEntityKinds, ActiveRelationKinds);
+			bSawEntityEvidence = true;
+			AssetEntries.Add(SourceResult.AssetEntry);
+			EntityDrafts.Append(MoveTemp(SourceResult.EntityDrafts));
+			RelationDrafts.Append(MoveTemp(SourceResult.RelationDrafts));
+		}
 
-			TSharedRef<FJsonObject> AssetEntry = MakeShared<FJsonObject>();
-			AssetEntry->SetStringField(TEXT("asset_id"), GetStringField(AssetIndexEntry, TEXT("asset_id")));
-			AssetEntry->SetStringField(TEXT("object_path"), ObjectPath);
-			AssetEntry->SetStringField(TEXT("fingerprint"), Fingerprint);
-			AssetEntry->SetStringField(TEXT("source_file"), SourceFile);
-			AssetEntry->SetStringField(TEXT("json_pointer"), TEXT("/entity_evidence"));
-			AssetEntry->SetNumberField(TEXT("entity_count"), EntityValues->Num());
-			AssetEntry->SetNumberField(TEXT("relation_count"), RelationValues->Num());
-			AssetEntries.Add(AssetEntry);
+		AssetEntries.Sort([](const TSharedPtr<FJsonObject>& Left, const TSharedPtr<FJsonObject>& Right)
+		{
+			return GetStringField(Left, TEXT("object_path")) < GetStringField(Right, TEXT("object_path"));
+		});
+		EntityDrafts.Sort([](const FEntityIndexDraft& Left, const FEntityIndexDraft& Right)
+		{
+			return MakeIndexEntitySortKey(Left) < MakeIndexEntitySortKey(Right);
+		});
+		RelationDrafts.Sort([](const FRelationIndexDraft& Left, const FRelationIndexDraft& Right)
+		{
+			return MakeIndexRelationSortKey(Left) < MakeIndexRelationSortKey(Right);
+		});
 
-			for (int32 EntityIndex = 0; EntityIndex < EntityValues->Num(); ++EntityIndex)
+		// 정렬된 global 배열에서 asset별 연속 구간 시작과 asset 내부 ordinal 기준 kind table을 기록해 query가 전체 배열을 훑지 않게 한다.
+		TMap<FString, TSharedPtr<FJsonObject>> AssetEntryByObjectPath;
+		for (const TSharedPtr<FJsonObject>& AssetEntry : AssetEntries)
+		{
+			AssetEntry->SetNumberField(TEXT("entity_entry_begin"), 0);
+			AssetEntry->SetNumberField(TEXT("relation_entry_begin"), 0);
+			AssetEntry->SetObjectField(TEXT("entity_kind_ordinals"), MakeShared<FJsonObject>());
+			AssetEntryByObjectPath.Add(GetStringField(AssetEntry, TEXT("object_path")), AssetEntry);
+		}
+		{
+			FString CurrentObjectPath;
+			int32 CurrentBegin = 0;
+			TMap<FString, TArray<TSharedPtr<FJsonValue>>> CurrentKindOrdinals;
+			auto FlushKindOrdinals = [&AssetEntryByObjectPath, &CurrentObjectPath, &CurrentKindOrdinals]()
 			{
-				const TSharedPtr<FJsonValue>& EntityValue = (*EntityValues)[EntityIndex];
-				if (!EntityValue.IsValid() || EntityValue->Type != EJson::Object)
-				{
-					return Fail(TEXT("ADUMP_ENTITY_SOURCE_JSON_INVALID"), TEXT("entity_evidence_v1 contains a non-object entity."));
-				}
-				const TSharedPtr<FJsonObject> EntityObject = EntityValue->AsObject();
-				const TSharedPtr<FJsonObject> StableIdentity = GetObjectField(EntityObject, TEXT("stable_identity"));
-				const TSharedPtr<FJsonObject> FacetsObject = GetObjectField(EntityObject, TEXT("facets"));
-				FEntityIndexDraft Draft;
-				Draft.AssetId = GetStringField(AssetIndexEntry, TEXT("asset_id"));
-				Draft.ObjectPath = ObjectPath;
-				Draft.Fingerprint = Fingerprint;
-				Draft.EntityId = GetStringField(EntityObject, TEXT("entity_id"));
-				Draft.EntityKind = GetStringField(EntityObject, TEXT("entity_kind"));
-				Draft.StableKey = GetStringField(StableIdentity, TEXT("stable_key"));
-				Draft.IdentityQuality = GetStringField(StableIdentity, TEXT("quality"));
-				Draft.SourceFile = SourceFile;
-				Draft.JsonPointer = FString::Printf(TEXT("/entity_evidence/entities/%d"), EntityIndex);
-				Draft.CanonicalOrder = GetIntegerField(EntityObject, TEXT("canonical_order"), EntityIndex);
-								Draft.OwnerEntityId = EntityObject->TryGetField(TEXT("owner_entity_id"));
-				Draft.State = GetStringField(EntityObject, TEXT("state"));
-								if (FacetsObject.IsValid())
+				const TSharedPtr<FJsonObject> AssetEntry = AssetEntryByObjectPath.FindRef(CurrentObjectPath);
+				if (AssetEntry.IsValid())
 				{
-					for (const auto& FacetPair : FacetsObject->Values)
+					TSharedRef<FJsonObject> KindOrdinalsObject = MakeShared<FJsonObject>();
+					CurrentKindOrdinals.KeySort(TLess<FString>());
+					for (TPair<FString, TArray<TSharedPtr<FJsonValue>>>& KindPair : CurrentKindOrdinals)
 					{
-						Draft.FacetNames.Add(FString(FacetPair.Key));
+						KindOrdinalsObject->SetArrayField(KindPair.Key, KindPair.Value);
 					}
-					Draft.FacetNames.Sort();
+					AssetEntry->SetObjectField(TEXT("entity_kind_ordinals"), KindOrdinalsObject);
 				}
-												if (Draft.EntityId.IsEmpty()
-					|| !ADumpEntityEvidence::GetKnownEntityKindRegistry().Contains(Draft.EntityKind)
-					|| !SourceEntityRegistry.Contains(Draft.EntityKind)
-					|| Draft.StableKey.IsEmpty()
-					|| (Draft.IdentityQuality != TEXT("exact") && Draft.IdentityQuality != TEXT("composite") && Draft.IdentityQuality != TEXT("fallback"))
-					|| !IsEntityQueryCompletenessState(Draft.State))
+				CurrentKindOrdinals.Reset();
+			};
+			for (int32 EntityIndex = 0; EntityIndex < EntityDrafts.Num(); ++EntityIndex)
+			{
+				const FEntityIndexDraft& Draft = EntityDrafts[EntityIndex];
+				if (EntityIndex == 0 || Draft.ObjectPath != CurrentObjectPath)
 				{
-					return Fail(TEXT("ADUMP_ENTITY_SOURCE_JSON_INVALID"), TEXT("entity_evidence_v1 contains an invalid entity identity contract."));
+					if (EntityIndex > 0)
+					{
+						FlushKindOrdinals();
+					}
+					CurrentObjectPath = Draft.ObjectPath;
+					CurrentBegin = EntityIndex;
+					if (const TSharedPtr<FJsonObject> AssetEntry = AssetEntryByObjectPath.FindRef(CurrentObjectPath))
+					{
+						AssetEntry->SetNumberField(TEXT("entity_entry_begin"), EntityIndex);
+					}
 				}
-				EntityDrafts.Add(MoveTemp(Draft));
+				CurrentKindOrdinals.FindOrAdd(Draft.EntityKind).Add(MakeShared<FJsonValueNumber>(EntityIndex - CurrentBegin));
 			}
-
-			for (int32 RelationIndex = 0; RelationIndex < RelationValues->Num(); ++RelationIndex)
+			if (!EntityDrafts.IsEmpty())
 			{
-				const TSharedPtr<FJsonValue>& RelationValue = (*RelationValues)[RelationIndex];
-				if (!RelationValue.IsValid() || RelationValue->Type != EJson::Object)
-				{
-					return Fail(TEXT("ADUMP_ENTITY_SOURCE_JSON_INVALID"), TEXT("entity_evidence_v1 contains a non-object relation."));
-				}
-				const TSharedPtr<FJsonObject> RelationObject = RelationValue->AsObject();
-				FRelationIndexDraft Draft;
-				Draft.AssetId = GetStringField(AssetIndexEntry, TEXT("asset_id"));
-				Draft.ObjectPath = ObjectPath;
-				Draft.Fingerprint = Fingerprint;
-				Draft.RelationId = GetStringField(RelationObject, TEXT("relation_id"));
-				Draft.RelationKind = GetStringField(RelationObject, TEXT("relation_kind"));
-				Draft.FromEntityId = GetStringField(RelationObject, TEXT("from_entity_id"));
-				Draft.ToEntityId = GetStringField(RelationObject, TEXT("to_entity_id"));
-				Draft.SourceFile = SourceFile;
-								Draft.JsonPointer = FString::Printf(TEXT("/entity_evidence/relations/%d"), RelationIndex);
-				Draft.CanonicalOrder = RelationIndex;
-				Draft.State = GetStringField(RelationObject, TEXT("state"));
-												if (Draft.RelationId.IsEmpty()
-					|| !ADumpEntityEvidence::GetKnownRelationKindRegistry().Contains(Draft.RelationKind)
-					|| !SourceRelationRegistry.Contains(Draft.RelationKind)
-					|| Draft.FromEntityId.IsEmpty()
-					|| Draft.ToEntityId.IsEmpty()
-					|| !IsEntityQueryCompletenessState(Draft.State))
+				FlushKindOrdinals();
+			}
+			for (int32 RelationIndex = 0; RelationIndex < RelationDrafts.Num(); ++RelationIndex)
+			{
+				if (RelationIndex == 0 || RelationDrafts[RelationIndex].ObjectPath != RelationDrafts[RelationIndex - 1].ObjectPath)
 				{
-					return Fail(TEXT("ADUMP_ENTITY_SOURCE_JSON_INVALID"), TEXT("entity_evidence_v1 contains an invalid relation contract."));
+					if (const TSharedPtr<FJsonObject> AssetEntry = AssetEntryByObjectPath.FindRef(RelationDrafts[RelationIndex].ObjectPath))
+					{
+						AssetEntry->SetNumberField(TEXT("relation_entry_begin"), RelationIndex);
+					}
 				}
-				RelationDrafts.Add(MoveTemp(Draft));
 			}
 		}
 
-		AssetEntries.Sort([](const TSharedPtr<FJsonObject>& Left, const TSharedPtr<FJsonObject>& Right)
-		{
-			return GetStringField(Left, TEXT("object_path")) < GetStringField(Right, TEXT("object_path"));
-		});
-		EntityDrafts.Sort([](const FEntityIndexDraft& Left, const FEntityIndexDraft& Right)
-		{
-			return MakeIndexEntitySortKey(Left) < MakeIndexEntitySortKey(Right);
-		});
-		RelationDrafts.Sort([](const FRelationIndexDraft& Left, const FRelationIndexDraft& Right)
+		for (const TSharedPtr<FJsonObject>& AssetEntry : AssetEntries)
 		{
-			return MakeIndexRelationSortKey(Left) < MakeIndexRelationSortKey(Right);
-		});
+			const int32 EntityBegin = GetIntegerField(AssetEntry, TEXT("entity_entry_begin"), 0);
+			const int32 EntityCount = GetIntegerField(AssetEntry, TEXT("entity_count"), 0);
+			const int32 RelationBegin = GetIntegerField(AssetEntry, TEXT("relation_entry_begin"), 0);
+			const int32 RelationCount = GetIntegerField(AssetEntry, TEXT("relation_count"), 0);
+			AssetEntry->RemoveField(TEXT("entity_adjacency"));
+			if (EntityBegin + EntityCount > EntityDrafts.Num() || RelationBegin + RelationCount > RelationDrafts.Num())
+			{
+				continue;
+			}
+			const TSharedPtr<FJsonObject> AdjacencyObject = BuildEntityAdjacencyObject(
+				TConstArrayView<FEntityIndexDraft>(EntityDrafts.GetData() + EntityBegin, EntityCount),
+				TConstArrayView<FRelationIndexDraft>(RelationDrafts.GetData() + RelationBegin, RelationCount));
+			if (AdjacencyObject.IsValid())
+			{
+				AssetEntry->SetObjectField(TEXT("entity_adjacency"), AdjacencyObject);
+			}
+		}
 
 		TArray<TSharedPtr<FJsonValue>> AssetValues;
 		for (int32 AssetIndex = 0; AssetIndex < AssetEntries.Num(); ++AssetIndex)
@@ -1210,10 +2063,10 @@ namespace ADumpEntityQuery
 			AddAdapterProfileRegistry(TEXT("blueprint_core_v1"), ActiveEntityKinds, ActiveRelationKinds);
 		}
 		const TArray<FString> ActiveEntityKindRegistry = BuildActiveRegistry(
-			ADumpEntityEvidence::GetKnownEntityKindRegistry(),
+			ADumpEntityKinds::GetKnownEntityKindRegistry(),
 			ActiveEntityKinds);
 		const TArray<FString> ActiveRelationKindRegistry = BuildActiveRegistry(
-			ADumpEntityEvidence::GetKnownRelationKindRegistry(),
+			ADumpEntityKinds::GetKnownRelationKindRegistry(),
 			ActiveRelationKinds);
 
 		TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
@@ -1229,6 +2082,9 @@ namespace ADumpEntityQuery
 		RootObject->SetArrayField(TEXT("assets"), AssetValues);
 		RootObject->SetArrayField(TEXT("entities"), EntityEntryValues);
 		RootObject->SetArrayField(TEXT("relations"), RelationEntryValues);
+		RootObject->SetArrayField(TEXT("scanned_source_files"), ScannedSourceValues);
+		RootObject->SetNumberField(TEXT("reused_source_count"), ReusedSourceCount);
+		RootObject->SetNumberField(TEXT("parsed_source_count"), ParsedSourceCount);
 
 		FString IndexJsonText;
 		if (!SerializeJsonObject(RootObject, IndexJsonText))
@@ -1237,7 +2093,7 @@ namespace ADumpEntityQuery
 		}
 		OutEntityIndexFilePath = FPaths::Combine(NormalizedDumpRoot, TEXT("entity_index.json"));
 		FString SaveError;
-		if (!ADumpJson::SaveJsonTextToFile(OutEntityIndexFilePath, IndexJsonText, SaveError))
+		if (!ADumpQueryIO::SaveJsonTextToFile(OutEntityIndexFilePath, IndexJsonText, SaveError))
 		{
 			OutEntityIndexFilePath.Reset();
 			return Fail(TEXT("ADUMP_ENTITY_INDEX_JSON_INVALID"), FString::Printf(TEXT("Failed to atomically save entity_index_v1: %s"), *SaveError));
@@ -1264,7 +2120,7 @@ namespace ADumpEntityQuery
 		FString DumpRoot = GetOptionValue(InCommandLine, TEXT("DumpRoot="));
 		if (DumpRoot.IsEmpty())
 		{
-			DumpRoot = ADumpJson::BuildDefaultDumpRootDirectory();
+			DumpRoot = ADumpQueryIO::BuildDefaultDumpRootDirectory();
 		}
 		FString ObjectPath = GetOptionValue(InCommandLine, TEXT("ObjectPath="));
 		if (ObjectPath.IsEmpty()) ObjectPath = GetOptionValue(InCommandLine, TEXT("Asset="));
@@ -1330,153 +2186,243 @@ namespace ADumpEntityQuery
 			return Fail(TEXT("ADUMP_ENTITY_BOUNDS_INVALID"), TEXT("Bounds must satisfy depth 0..16, entities 1..1024, relations 0..4096 and bytes 4096..1048576."));
 		}
 
-				FResolvedEntitySource Source;
-		if (!ResolveIndexedSource(DumpRoot, ObjectPath, AssetId, Source, OutErrorCode, OutErrorDetail))
+		TSharedPtr<const FResolvedEntitySource> SourcePtr;
+		FString SessionKey;
+		if (!ResolveSessionIndexedSource(DumpRoot, ObjectPath, AssetId, SessionKey, SourcePtr, OutErrorCode, OutErrorDetail))
 		{
 			return false;
 		}
+		const FResolvedEntitySource& Source = *SourcePtr;
 		if (!IsRegistrySubset(EntityKinds, Source.EntityKindRegistry)
 			|| !IsRegistrySubset(RelationKinds, Source.RelationKindRegistry))
 		{
 			return Fail(TEXT("ADUMP_ENTITY_OPERATION_UNSUPPORTED"), TEXT("EntityKinds or RelationKinds contains a value outside the loaded entity_index_v1 registry."));
 		}
 
-		TMap<FString, TSharedPtr<FJsonObject>> EntityById;
-		TMap<FString, TArray<TSharedPtr<FJsonObject>>> EntitiesByStableKey;
-		for (const TSharedPtr<FJsonObject>& Entity : Source.Entities)
-		{
-			const FString NativeEntityId = GetStringField(Entity, TEXT("entity_id"));
-			const TSharedPtr<FJsonObject> StableIdentity = GetObjectField(Entity, TEXT("stable_identity"));
-			const FString NativeStableKey = GetStringField(StableIdentity, TEXT("stable_key"));
-			EntityById.Add(NativeEntityId, Entity);
-			EntitiesByStableKey.FindOrAdd(NativeStableKey).Add(Entity);
-		}
+		const FString SelectorKind = !EntityId.IsEmpty() ? TEXT("entity_id") : (!StableKey.IsEmpty() ? TEXT("stable_key") : TEXT("none"));
+		const FString NormalizedQuery = MakeNormalizedQuery(
+			Operation,
+			Source.ObjectPath,
+			EntityId,
+			StableKey,
+			EntityKinds,
+			RelationKinds,
+			Facets,
+			Direction,
+			MaxDepth,
+			MaxEntities,
+			MaxRelations,
+			MaxBytes);
 
-		TSharedPtr<FJsonObject> SelectedEntity;
-		if (!EntityId.IsEmpty())
-		{
-			SelectedEntity = EntityById.FindRef(EntityId);
-		}
-		else if (!StableKey.IsEmpty())
+		// 같은 process에서 같은 normalized query의 다음 page는 filter 결과를 재사용해 cursor offset으로 바로 잘라낸다.
+		FEntityQueryFilterResult FilterResult;
+		if (!FindSessionFilterResult(SessionKey, NormalizedQuery, FilterResult))
 		{
-			const TArray<TSharedPtr<FJsonObject>>* Matches = EntitiesByStableKey.Find(StableKey);
-			if (Matches && Matches->Num() > 1)
+			const TMap<FString, int32>& EntityOrdinalById = Source.EntityOrdinalById;
+			const TMap<FString, TArray<int32>>& EntityOrdinalsByStableKey = Source.EntityOrdinalsByStableKey;
+			if (!EntityId.IsEmpty())
 			{
-				return Fail(TEXT("ADUMP_ENTITY_DUPLICATE"), TEXT("StableKey resolved to more than one native entity."));
+				if (const int32* SelectedOrdinal = EntityOrdinalById.Find(EntityId))
+				{
+					FilterResult.SelectedEntityOrdinal = *SelectedOrdinal;
+				}
 			}
-			if (Matches && Matches->Num() == 1)
+			else if (!StableKey.IsEmpty())
 			{
-				SelectedEntity = (*Matches)[0];
+				const TArray<int32>* Matches = EntityOrdinalsByStableKey.Find(StableKey);
+				if (Matches && Matches->Num() > 1)
+				{
+					return Fail(TEXT("ADUMP_ENTITY_DUPLICATE"), TEXT("StableKey resolved to more than one native entity."));
+				}
+				if (Matches && Matches->Num() == 1)
+				{
+					FilterResult.SelectedEntityOrdinal = (*Matches)[0];
+				}
+			}
+			if (Operation != TEXT("list") && FilterResult.SelectedEntityOrdinal == INDEX_NONE)
+			{
+				return Fail(TEXT("ADUMP_ENTITY_NOT_FOUND"), TEXT("The exact entity selector did not resolve."));
 			}
-		}
-		if (Operation != TEXT("list") && !SelectedEntity.IsValid())
-		{
-			return Fail(TEXT("ADUMP_ENTITY_NOT_FOUND"), TEXT("The exact entity selector did not resolve."));
-		}
 
-		TSet<FString> SelectedEntityIds;
-		TSet<FString> SelectedRelationIds;
-		if (Operation == TEXT("list"))
-		{
-			for (const TSharedPtr<FJsonObject>& Entity : Source.Entities)
+			TSet<FString> SelectedEntityIds;
+			TSet<FString> SelectedRelationIds;
+			if (Operation == TEXT("list"))
 			{
-				const FString Kind = GetStringField(Entity, TEXT("entity_kind"));
-				if ((EntityKinds.IsEmpty() || EntityKinds.Contains(Kind)) && HasRequestedFacets(Entity, Facets))
+				// kind table 경로는 후보 ordinal을 직접 만들므로 아래 entity id 재수집이 필요 없다.
+				const bool bUsedKindTable = !EntityKinds.IsEmpty()
+					&& Facets.IsEmpty()
+					&& CollectKindTableEntityOrdinals(Source, EntityKinds, FilterResult.EntityOrdinals);
+				if (!bUsedKindTable)
 				{
-					SelectedEntityIds.Add(GetStringField(Entity, TEXT("entity_id")));
+					for (const TSharedPtr<FJsonObject>& Entity : Source.Entities)
+					{
+						const FString Kind = GetStringField(Entity, TEXT("entity_kind"));
+						if ((EntityKinds.IsEmpty() || EntityKinds.Contains(Kind)) && HasRequestedFacets(Entity, Facets))
+						{
+							SelectedEntityIds.Add(GetStringField(Entity, TEXT("entity_id")));
+						}
+					}
 				}
 			}
-		}
-		else
-		{
-			const FString RootEntityId = GetStringField(SelectedEntity, TEXT("entity_id"));
-			SelectedEntityIds.Add(RootEntityId);
-			if (Operation == TEXT("expand") && MaxDepth > 0)
+			else
 			{
-				TArray<FString> CurrentFrontier = { RootEntityId };
-				for (int32 Depth = 0; Depth < MaxDepth && !CurrentFrontier.IsEmpty(); ++Depth)
+				const FString RootEntityId = GetStringField(Source.Entities[FilterResult.SelectedEntityOrdinal], TEXT("entity_id"));
+				SelectedEntityIds.Add(RootEntityId);
+				if (Operation == TEXT("expand") && MaxDepth > 0 && !Source.ForwardOffsets.IsEmpty())
 				{
-					TArray<FString> NextFrontier;
-					for (const FString& CurrentEntityId : CurrentFrontier)
+					// CSR 경로는 entity ordinal bitset BFS로 id 기반 경로와 같은 entity/relation 집합을 만든다.
+					const int32 EntityCount = Source.Entities.Num();
+					TBitArray<> VisitedEntities(false, EntityCount);
+					TBitArray<> SelectedRelations(false, Source.Relations.Num());
+					TArray<int8> AdmissibleEntities;
+					AdmissibleEntities.Init(-1, EntityCount);
+					auto IsAdmissibleEntity = [&Source, &EntityKinds, &Facets, &AdmissibleEntities](int32 InEntityOrdinal)
 					{
-						for (const TSharedPtr<FJsonObject>& Relation : Source.Relations)
+						if (AdmissibleEntities[InEntityOrdinal] < 0)
 						{
-							const FString RelationKind = GetStringField(Relation, TEXT("relation_kind"));
-							if (!RelationKinds.IsEmpty() && !RelationKinds.Contains(RelationKind))
-							{
-								continue;
-							}
-							const FString FromEntityId = GetStringField(Relation, TEXT("from_entity_id"));
-							const FString ToEntityId = GetStringField(Relation, TEXT("to_entity_id"));
-							FString AdjacentEntityId;
-														if ((Direction == TEXT("out") || Direction == TEXT("both")) && FromEntityId == CurrentEntityId)
+							const TSharedPtr<FJsonObject>& Entity = Source.Entities[InEntityOrdinal];
+							AdmissibleEntities[InEntityOrdinal] = (EntityKinds.IsEmpty() || EntityKinds.Contains(GetStringField(Entity, TEXT("entity_kind"))))
+								&& HasRequestedFacets(Entity, Facets) ? 1 : 0;
+						}
+						return AdmissibleEntities[InEntityOrdinal] == 1;
+					};
+
+					TArray<int32> CurrentFrontier = { FilterResult.SelectedEntityOrdinal };
+					VisitedEntities[FilterResult.SelectedEntityOrdinal] = true;
+					for (int32 Depth = 0; Depth < MaxDepth && !CurrentFrontier.IsEmpty(); ++Depth)
+					{
+						TArray<int32> NextFrontier;
+						auto VisitRelation = [&](int32 InRelationOrdinal, int32 InAdjacentOrdinal)
+						{
+							if ((!RelationKinds.IsEmpty() && !RelationKinds.Contains(GetStringField(Source.Relations[InRelationOrdinal], TEXT("relation_kind"))))
+								|| !IsAdmissibleEntity(InAdjacentOrdinal))
 							{
-								AdjacentEntityId = ToEntityId;
+								return;
 							}
-														else if ((Direction == TEXT("in") || Direction == TEXT("both")) && ToEntityId == CurrentEntityId)
+							SelectedRelations[InRelationOrdinal] = true;
+							if (!VisitedEntities[InAdjacentOrdinal])
 							{
-								AdjacentEntityId = FromEntityId;
+								VisitedEntities[InAdjacentOrdinal] = true;
+								NextFrontier.Add(InAdjacentOrdinal);
 							}
-							if (AdjacentEntityId.IsEmpty())
+						};
+						for (const int32 CurrentOrdinal : CurrentFrontier)
+						{
+							if (Direction == TEXT("out") || Direction == TEXT("both"))
 							{
-								continue;
+								for (int32 EdgeIndex = Source.ForwardOffsets[CurrentOrdinal]; EdgeIndex < Source.ForwardOffsets[CurrentOrdinal + 1]; ++EdgeIndex)
+								{
+									const int32 RelationOrdinal = Source.ForwardRelations[EdgeIndex];
+									VisitRelation(RelationOrdinal, Source.RelationToOrdinals[RelationOrdinal]);
+								}
 							}
-														const TSharedPtr<FJsonObject> AdjacentEntity = EntityById.FindRef(AdjacentEntityId);
-							if (!AdjacentEntity.IsValid()
-								|| (!EntityKinds.IsEmpty() && !EntityKinds.Contains(GetStringField(AdjacentEntity, TEXT("entity_kind"))))
-								|| !HasRequestedFacets(AdjacentEntity, Facets))
+							if (Direction == TEXT("in") || Direction == TEXT("both"))
 							{
-								continue;
+								for (int32 EdgeIndex = Source.ReverseOffsets[CurrentOrdinal]; EdgeIndex < Source.ReverseOffsets[CurrentOrdinal + 1]; ++EdgeIndex)
+								{
+									const int32 RelationOrdinal = Source.ReverseRelations[EdgeIndex];
+									VisitRelation(RelationOrdinal, Source.RelationFromOrdinals[RelationOrdinal]);
+								}
 							}
+						}
+						CurrentFrontier = MoveTemp(NextFrontier);
+					}
 
-							SelectedRelationIds.Add(GetStringField(Relation, TEXT("relation_id")));
-							if (!SelectedEntityIds.Contains(AdjacentEntityId))
+					SelectedEntityIds.Reset();
+					for (TConstSetBitIterator<> VisitedIt(VisitedEntities); VisitedIt; ++VisitedIt)
+					{
+						FilterResult.EntityOrdinals.Add(VisitedIt.GetIndex());
+					}
+					for (TConstSetBitIterator<> SelectedIt(SelectedRelations); SelectedIt; ++SelectedIt)
+					{
+						FilterResult.RelationOrdinals.Add(SelectedIt.GetIndex());
+					}
+				}
+				else if (Operation == TEXT("expand") && MaxDepth > 0)
+				{
+					TArray<FString> CurrentFrontier = { RootEntityId };
+					for (int32 Depth = 0; Depth < MaxDepth && !CurrentFrontier.IsEmpty(); ++Depth)
+					{
+						TArray<FString> NextFrontier;
+						for (const FString& CurrentEntityId : CurrentFrontier)
+						{
+							for (const TSharedPtr<FJsonObject>& Relation : Source.Relations)
 							{
-								SelectedEntityIds.Add(AdjacentEntityId);
-								NextFrontier.Add(AdjacentEntityId);
+								const FString RelationKind = GetStringField(Relation, TEXT("relation_kind"));
+								if (!RelationKinds.IsEmpty() && !RelationKinds.Contains(RelationKind))
+								{
+									continue;
+								}
+								const FString FromEntityId = GetStringField(Relation, TEXT("from_entity_id"));
+								const FString ToEntityId = GetStringField(Relation, TEXT("to_entity_id"));
+								FString AdjacentEntityId;
+								if ((Direction == TEXT("out") || Direction == TEXT("both")) && FromEntityId == CurrentEntityId)
+								{
+									AdjacentEntityId = ToEntityId;
+								}
+								else if ((Direction == TEXT("in") || Direction == TEXT("both")) && ToEntityId == CurrentEntityId)
+								{
+									AdjacentEntityId = FromEntityId;
+								}
+								if (AdjacentEntityId.IsEmpty())
+								{
+									continue;
+								}
+								const int32* AdjacentOrdinal = EntityOrdinalById.Find(AdjacentEntityId);
+								const TSharedPtr<FJsonObject> AdjacentEntity = AdjacentOrdinal ? Source.Entities[*AdjacentOrdinal] : nullptr;
+								if (!AdjacentEntity.IsValid()
+									|| (!EntityKinds.IsEmpty() && !EntityKinds.Contains(GetStringField(AdjacentEntity, TEXT("entity_kind"))))
+									|| !HasRequestedFacets(AdjacentEntity, Facets))
+								{
+									continue;
+								}
+
+								SelectedRelationIds.Add(GetStringField(Relation, TEXT("relation_id")));
+								if (!SelectedEntityIds.Contains(AdjacentEntityId))
+								{
+									SelectedEntityIds.Add(AdjacentEntityId);
+									NextFrontier.Add(AdjacentEntityId);
+								}
 							}
 						}
+						CurrentFrontier = MoveTemp(NextFrontier);
 					}
-					CurrentFrontier = MoveTemp(NextFrontier);
 				}
 			}
-		}
 
-		TArray<TSharedPtr<FJsonObject>> CandidateEntities;
-		for (const TSharedPtr<FJsonObject>& Entity : Source.Entities)
-		{
-			if (SelectedEntityIds.Contains(GetStringField(Entity, TEXT("entity_id"))))
+			if (!SelectedEntityIds.IsEmpty())
 			{
-				CandidateEntities.Add(Entity);
+				for (int32 EntityOrdinal = 0; EntityOrdinal < Source.Entities.Num(); ++EntityOrdinal)
+				{
+					if (SelectedEntityIds.Contains(GetStringField(Source.Entities[EntityOrdinal], TEXT("entity_id"))))
+					{
+						FilterResult.EntityOrdinals.Add(EntityOrdinal);
+					}
+				}
 			}
-		}
-		TArray<TSharedPtr<FJsonObject>> CandidateRelations;
-				for (const TSharedPtr<FJsonObject>& Relation : Source.Relations)
-		{
-			const FString FromEntityId = GetStringField(Relation, TEXT("from_entity_id"));
-			const FString ToEntityId = GetStringField(Relation, TEXT("to_entity_id"));
-			if (SelectedRelationIds.Contains(GetStringField(Relation, TEXT("relation_id")))
-				&& SelectedEntityIds.Contains(FromEntityId)
-				&& SelectedEntityIds.Contains(ToEntityId))
+			if (!SelectedRelationIds.IsEmpty())
 			{
-				CandidateRelations.Add(Relation);
+				for (int32 RelationOrdinal = 0; RelationOrdinal < Source.Relations.Num(); ++RelationOrdinal)
+				{
+					const TSharedPtr<FJsonObject>& Relation = Source.Relations[RelationOrdinal];
+					const FString FromEntityId = GetStringField(Relation, TEXT("from_entity_id"));
+					const FString ToEntityId = GetStringField(Relation, TEXT("to_entity_id"));
+					if (SelectedRelationIds.Contains(GetStringField(Relation, TEXT("relation_id")))
+						&& SelectedEntityIds.Contains(FromEntityId)
+						&& SelectedEntityIds.Contains(ToEntityId))
+					{
+						FilterResult.RelationOrdinals.Add(RelationOrdinal);
+					}
+				}
 			}
+			StoreSessionFilterResult(SessionKey, NormalizedQuery, FilterResult);
 		}
+		const TSharedPtr<FJsonObject> SelectedEntity = Source.Entities.IsValidIndex(FilterResult.SelectedEntityOrdinal)
+			? Source.Entities[FilterResult.SelectedEntityOrdinal]
+			: nullptr;
+		const TArray<int32>& CandidateEntityOrdinals = FilterResult.EntityOrdinals;
+		const TArray<int32>& CandidateRelationOrdinals = FilterResult.RelationOrdinals;
 
-		const FString SelectorKind = !EntityId.IsEmpty() ? TEXT("entity_id") : (!StableKey.IsEmpty() ? TEXT("stable_key") : TEXT("none"));
-		const FString NormalizedQuery = MakeNormalizedQuery(
-			Operation,
-			Source.ObjectPath,
-			EntityId,
-			StableKey,
-			EntityKinds,
-			RelationKinds,
-			Facets,
-			Direction,
-			MaxDepth,
-			MaxEntities,
-			MaxRelations,
-			MaxBytes);
 		const FString Cursor = GetOptionValue(InCommandLine, TEXT("Cursor="));
 		int32 CanonicalOffset = 0;
 		bool bCursorStale = false;
@@ -1487,7 +2433,7 @@ namespace ADumpEntityQuery
 				bCursorStale ? TEXT("Cursor binding does not match the current fingerprint/schema/query/offset.") : TEXT("Cursor format is invalid."));
 		}
 
-		const int32 TotalCandidateCount = CandidateEntities.Num() + CandidateRelations.Num();
+		const int32 TotalCandidateCount = CandidateEntityOrdinals.Num() + CandidateRelationOrdinals.Num();
 		if (CanonicalOffset > TotalCandidateCount)
 		{
 			return Fail(TEXT("ADUMP_ENTITY_CURSOR_STALE"), TEXT("Cursor canonical offset is beyond the current result set."));
@@ -1499,18 +2445,18 @@ namespace ADumpEntityQuery
 		int32 NextOffset = CanonicalOffset;
 		for (int32 FlatIndex = CanonicalOffset; FlatIndex < TotalCandidateCount; ++FlatIndex)
 		{
-			if (FlatIndex < CandidateEntities.Num())
+			if (FlatIndex < CandidateEntityOrdinals.Num())
 			{
 				if (IncludedEntities.Num() >= MaxEntities)
 				{
 					TruncationReasons.AddUnique(TEXT("max_entities"));
 					break;
 				}
-				IncludedEntities.Add(MakeShared<FJsonValueObject>(CandidateEntities[FlatIndex].ToSharedRef()));
+				IncludedEntities.Add(MakeShared<FJsonValueObject>(Source.Entities[CandidateEntityOrdinals[FlatIndex]].ToSharedRef()));
 			}
 						else
 			{
-				const int32 RelationIndex = FlatIndex - CandidateEntities.Num();
+				const int32 RelationIndex = FlatIndex - CandidateEntityOrdinals.Num();
 				if (MaxRelations == 0)
 				{
 					TruncationReasons.AddUnique(TEXT("max_relations"));
@@ -1522,7 +2468,7 @@ namespace ADumpEntityQuery
 					TruncationReasons.AddUnique(TEXT("max_relations"));
 					break;
 				}
-				IncludedRelations.Add(MakeShared<FJsonValueObject>(CandidateRelations[RelationIndex].ToSharedRef()));
+				IncludedRelations.Add(MakeShared<FJsonValueObject>(Source.Relations[CandidateRelationOrdinals[RelationIndex]].ToSharedRef()));
 			}
 			NextOffset = FlatIndex + 1;
 		}
@@ -1558,8 +2504,8 @@ namespace ADumpEntityQuery
 				MaxBytes,
 				CanonicalOffset,
 				NextOffset,
-				CandidateEntities.Num(),
-				CandidateRelations.Num(),
+				CandidateEntityOrdinals.Num(),
+				CandidateRelationOrdinals.Num(),
 				IncludedEntities,
 				IncludedRelations,
 				CurrentReasons,
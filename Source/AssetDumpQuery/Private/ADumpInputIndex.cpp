@@ -0,0 +1,1187 @@
+// File: ADumpInputIndex.cpp
+// Version: v1.0.0
+// Changelog:
+// - v1.0.0: input_summary section 한 번 순회로 context/action/binding table, key 범위, action/context 역참조 posting과 충돌 집합을 가진 compact input_binding_index_v1과 -Mode=inputquery를 구현.
+// Migration:
+// - binding ordinal은 (소문자 key, context ordinal, mapping source_index, action ordinal) 오름차순이며 역참조 posting은 그 ordinal의 delta encoding이다.
+
+#include "ADumpInputIndex.h"
+
+#include "ADumpQueryIO.h"
+
+#include "Algo/BinarySearch.h"
+#include "Async/ParallelFor.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	// InputBindingIndexFileName은 dump root 아래 전역 input binding index 파일 이름이다.
+	const TCHAR* InputBindingIndexFileName = TEXT("input_binding_index.json");
+
+	// InputBindingIndexSchemaVersion은 index 파일 schema 이름이다.
+	const TCHAR* InputBindingIndexSchemaVersion = TEXT("input_binding_index_v1");
+
+	// FInputMappingRead는 input_summary mappings 항목 한 건에서 index에 필요한 필드만 읽은 값이다.
+	struct FInputMappingRead
+	{
+		int32 SourceIndex = 0;
+		FString ActionPath;
+		FString ActionName;
+		FString KeyName;
+		FString KeyDisplayName;
+		TArray<FString> Triggers;
+		TArray<FString> Modifiers;
+	};
+
+	// FInputSummaryRead는 section_index input_summary entry 하나를 읽은 결과다. ErrorCode가 있으면 index build 실패다.
+	struct FInputSummaryRead
+	{
+		FString ObjectPath;
+		FString SourceFile;
+		FString JsonPointer;
+		bool bSupported = false;
+		FString AssetKind;
+		FString ValueType;
+		int32 MappingCount = 0;
+		bool bMappingTruncated = false;
+		TArray<FString> ActionTriggers;
+		TArray<FString> ActionModifiers;
+		TArray<FInputMappingRead> Mappings;
+		FString ErrorCode;
+		FString ErrorDetail;
+	};
+
+	// FInputActionDraft는 action table 한 행의 build 중간값이다. bDumped는 IA 자신의 input_summary를 읽었는지 여부다.
+	struct FInputActionDraft
+	{
+		FString Name;
+		FString ValueType;
+		bool bDumped = false;
+		TArray<FString> Triggers;
+		TArray<FString> Modifiers;
+	};
+
+	// FInputBindingDraft는 binding table 한 행의 build 중간값이다.
+	struct FInputBindingDraft
+	{
+		int32 ContextOrdinal = INDEX_NONE;
+		int32 ActionOrdinal = INDEX_NONE;
+		int32 SourceIndex = 0;
+		FString NormalizedKey;
+		FString KeyName;
+		FString KeyDisplayName;
+		TArray<FString> Triggers;
+		TArray<FString> Modifiers;
+	};
+
+	// FInputContextRow는 decode된 context table 한 행이다.
+	struct FInputContextRow
+	{
+		FString ObjectPath;
+		FString SourceFile;
+		int32 MappingCount = 0;
+		bool bMappingTruncated = false;
+		TArray<int32> BindingOrdinals;
+	};
+
+	// FInputActionRow는 decode된 action table 한 행이다.
+	struct FInputActionRow
+	{
+		FString ActionPath;
+		FString Name;
+		FString ValueType;
+		bool bDumped = false;
+		TArray<FString> Triggers;
+		TArray<FString> Modifiers;
+		TArray<int32> BindingOrdinals;
+	};
+
+	// FInputBindingRow는 decode된 binding table 한 행이다.
+	struct FInputBindingRow
+	{
+		int32 ContextOrdinal = INDEX_NONE;
+		int32 ActionOrdinal = INDEX_NONE;
+		FString KeyName;
+		FString KeyDisplayName;
+		TArray<FString> Triggers;
+		TArray<FString> Modifiers;
+		int32 SourceIndex = 0;
+	};
+
+	// FInputConflictRow는 decode된 충돌 집합 한 행이다.
+	struct FInputConflictRow
+	{
+		FString NormalizedKey;
+		FString Kind;
+		bool bTriggerDistinct = false;
+		TArray<int32> BindingOrdinals;
+	};
+
+	// FLoadedInputBindingIndex는 decode된 input_binding_index_v1이다. Keys는 소문자 key 오름차순이고 KeyRanges는 binding ordinal [first, count]다.
+	struct FLoadedInputBindingIndex
+	{
+		FString GeneratedTime;
+		TArray<FInputContextRow> Contexts;
+		TArray<FInputActionRow> Actions;
+		TArray<FInputBindingRow> Bindings;
+		TArray<FString> Keys;
+		TArray<TPair<int32, int32>> KeyRanges;
+		TArray<FInputConflictRow> Conflicts;
+	};
+
+	// LoadInputIndexJsonObject는 gzip/pack/content store를 투명하게 읽는 JSON object 로드다.
+	bool LoadInputIndexJsonObject(const FString& InFilePath, TSharedPtr<FJsonObject>& OutRootObject)
+	{
+		OutRootObject.Reset();
+		FString JsonText;
+		if (!ADumpQueryIO::LoadJsonTextFromFile(InFilePath, JsonText))
+		{
+			return false;
+		}
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
+		return FJsonSerializer::Deserialize(Reader, OutRootObject) && OutRootObject.IsValid();
+	}
+
+	// GetInputStringField는 없거나 type이 다른 string field를 빈 문자열로 처리한다.
+	FString GetInputStringField(const TSharedPtr<FJsonObject>& InObject, const TCHAR* InFieldName)
+	{
+		FString Value;
+		if (InObject.IsValid())
+		{
+			InObject->TryGetStringField(InFieldName, Value);
+		}
+		return Value;
+	}
+
+	// GetInputArrayField는 JSON array field 포인터를 안전하게 읽는다.
+	const TArray<TSharedPtr<FJsonValue>>* GetInputArrayField(const TSharedPtr<FJsonObject>& InObject, const TCHAR* InFieldName)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		if (!InObject.IsValid() || !InObject->TryGetArrayField(InFieldName, Values))
+		{
+			return nullptr;
+		}
+		return Values;
+	}
+
+	// NormalizeInputDumpRoot는 dump root를 절대 normalized directory로 변환한다.
+	FString NormalizeInputDumpRoot(const FString& InDumpRootPath)
+	{
+		FString NormalizedPath = FPaths::ConvertRelativePathToFull(InDumpRootPath);
+		FPaths::NormalizeDirectoryName(NormalizedPath);
+		return NormalizedPath;
+	}
+
+	// NormalizeInputKey는 FKey 이름 비교용 소문자 key다. FName 비교처럼 대소문자를 무시한다.
+	FString NormalizeInputKey(const FString& InKeyName)
+	{
+		return InKeyName.TrimStartAndEnd().ToLower();
+	}
+
+	// ReadInputDescriptorClassNames는 modifier/trigger descriptor 배열의 class_name을 원본 순서로 읽는다.
+	TArray<FString> ReadInputDescriptorClassNames(const TSharedPtr<FJsonObject>& InObject, const TCHAR* InFieldName)
+	{
+		TArray<FString> ClassNames;
+		if (const TArray<TSharedPtr<FJsonValue>>* DescriptorValues = GetInputArrayField(InObject, InFieldName))
+		{
+			for (const TSharedPtr<FJsonValue>& DescriptorValue : *DescriptorValues)
+			{
+				const TSharedPtr<FJsonObject> DescriptorObject = DescriptorValue.IsValid() ? DescriptorValue->AsObject() : nullptr;
+				const FString ClassName = GetInputStringField(DescriptorObject, TEXT("class_name"));
+				if (!ClassName.IsEmpty())
+				{
+					ClassNames.Add(ClassName);
+				}
+			}
+		}
+		return ClassNames;
+	}
+
+	// ReadInputSummarySource는 entry의 source 파일을 읽고 json_pointer 위치의 input_summary를 해석한다.
+	void ReadInputSummarySource(const FString& InNormalizedDumpRoot, FInputSummaryRead& InOutRead)
+	{
+		auto Fail = [&InOutRead](const TCHAR* InCode, const FString& InDetail)
+		{
+			InOutRead.ErrorCode = InCode;
+			InOutRead.ErrorDetail = InDetail;
+		};
+
+		if (InOutRead.SourceFile.IsEmpty()
+			|| !FPaths::IsRelative(InOutRead.SourceFile)
+			|| InOutRead.SourceFile.Contains(TEXT("\\"))
+			|| InOutRead.SourceFile.StartsWith(TEXT("../")))
+		{
+			Fail(TEXT("ADUMP_INPUT_INDEX_SOURCE_INVALID"), FString::Printf(TEXT("Invalid indexed input_summary source path: %s"), *InOutRead.SourceFile));
+			return;
+		}
+
+		const FString SourceFilePath = FPaths::Combine(InNormalizedDumpRoot, InOutRead.SourceFile);
+		if (!ADumpQueryIO::DoesJsonFileExist(SourceFilePath))
+		{
+			Fail(TEXT("ADUMP_INPUT_INDEX_SOURCE_NOT_FOUND"), FString::Printf(TEXT("Indexed input_summary source does not exist: %s"), *InOutRead.SourceFile));
+			return;
+		}
+
+		TSharedPtr<FJsonObject> SourceRootObject;
+		if (!LoadInputIndexJsonObject(SourceFilePath, SourceRootObject))
+		{
+			Fail(TEXT("ADUMP_INPUT_INDEX_SOURCE_JSON_INVALID"), FString::Printf(TEXT("Indexed input_summary source is not a readable JSON object: %s"), *InOutRead.SourceFile));
+			return;
+		}
+
+		TSharedPtr<FJsonObject> SummaryObject;
+		if (InOutRead.JsonPointer == TEXT("/"))
+		{
+			SummaryObject = SourceRootObject;
+		}
+		else if (InOutRead.JsonPointer.StartsWith(TEXT("/"))
+			&& InOutRead.JsonPointer.Len() > 1
+			&& !InOutRead.JsonPointer.Mid(1).Contains(TEXT("/")))
+		{
+			const TSharedPtr<FJsonValue> SummaryValue = SourceRootObject->TryGetField(*InOutRead.JsonPointer.Mid(1));
+			SummaryObject = SummaryValue.IsValid() && SummaryValue->Type == EJson::Object ? SummaryValue->AsObject() : nullptr;
+		}
+		else
+		{
+			Fail(TEXT("ADUMP_INPUT_INDEX_POINTER_UNSUPPORTED"), FString::Printf(TEXT("Nested or malformed input_summary pointer: %s"), *InOutRead.JsonPointer));
+			return;
+		}
+		if (!SummaryObject.IsValid())
+		{
+			Fail(TEXT("ADUMP_INPUT_INDEX_POINTER_NOT_FOUND"), FString::Printf(TEXT("input_summary pointer does not resolve: %s%s"), *InOutRead.SourceFile, *InOutRead.JsonPointer));
+			return;
+		}
+
+		SummaryObject->TryGetBoolField(TEXT("supported"), InOutRead.bSupported);
+		SummaryObject->TryGetBoolField(TEXT("mapping_truncated"), InOutRead.bMappingTruncated);
+		SummaryObject->TryGetNumberField(TEXT("mapping_count"), InOutRead.MappingCount);
+		InOutRead.AssetKind = GetInputStringField(SummaryObject, TEXT("asset_kind"));
+		InOutRead.ValueType = GetInputStringField(SummaryObject, TEXT("value_type"));
+		InOutRead.ActionTriggers = ReadInputDescriptorClassNames(SummaryObject, TEXT("triggers"));
+		InOutRead.ActionModifiers = ReadInputDescriptorClassNames(SummaryObject, TEXT("modifiers"));
+
+		if (const TArray<TSharedPtr<FJsonValue>>* MappingValues = GetInputArrayField(SummaryObject, TEXT("mappings")))
+		{
+			InOutRead.Mappings.Reserve(MappingValues->Num());
+			for (const TSharedPtr<FJsonValue>& MappingValue : *MappingValues)
+			{
+				const TSharedPtr<FJsonObject> MappingObject = MappingValue.IsValid() ? MappingValue->AsObject() : nullptr;
+				if (!MappingObject.IsValid())
+				{
+					continue;
+				}
+				FInputMappingRead& MappingRead = InOutRead.Mappings.AddDefaulted_GetRef();
+				MappingObject->TryGetNumberField(TEXT("source_index"), MappingRead.SourceIndex);
+				MappingRead.ActionPath = GetInputStringField(MappingObject, TEXT("action_path"));
+				MappingRead.ActionName = GetInputStringField(MappingObject, TEXT("action_name"));
+				MappingRead.KeyName = GetInputStringField(MappingObject, TEXT("key_name"));
+				MappingRead.KeyDisplayName = GetInputStringField(MappingObject, TEXT("key_display_name"));
+				MappingRead.Triggers = ReadInputDescriptorClassNames(MappingObject, TEXT("triggers"));
+				MappingRead.Modifiers = ReadInputDescriptorClassNames(MappingObject, TEXT("modifiers"));
+			}
+		}
+	}
+
+	// MakeInputStringArrayValue는 문자열 배열을 JSON array value로 만든다.
+	TSharedRef<FJsonValueArray> MakeInputStringArrayValue(const TArray<FString>& InValues)
+	{
+		TArray<TSharedPtr<FJsonValue>> Values;
+		Values.Reserve(InValues.Num());
+		for (const FString& Value : InValues)
+		{
+			Values.Add(MakeShared<FJsonValueString>(Value));
+		}
+		return MakeShared<FJsonValueArray>(Values);
+	}
+
+	// MakeInputDeltaArrayValue는 오름차순 ordinal 목록을 delta encoding JSON array로 만든다.
+	TSharedRef<FJsonValueArray> MakeInputDeltaArrayValue(const TArray<int32>& InOrdinals)
+	{
+		TArray<TSharedPtr<FJsonValue>> DeltaValues;
+		DeltaValues.Reserve(InOrdinals.Num());
+		int32 PreviousOrdinal = 0;
+		for (const int32 Ordinal : InOrdinals)
+		{
+			DeltaValues.Add(MakeShared<FJsonValueNumber>(Ordinal - PreviousOrdinal));
+			PreviousOrdinal = Ordinal;
+		}
+		return MakeShared<FJsonValueArray>(DeltaValues);
+	}
+
+	// TryReadInputTupleString은 tuple 위치의 string 값을 읽는다.
+	bool TryReadInputTupleString(const TArray<TSharedPtr<FJsonValue>>& InTuple, int32 InIndex, FString& OutValue)
+	{
+		return InTuple.IsValidIndex(InIndex) && InTuple[InIndex].IsValid() && InTuple[InIndex]->TryGetString(OutValue);
+	}
+
+	// TryReadInputTupleInteger는 tuple 위치의 정수 값을 읽는다.
+	bool TryReadInputTupleInteger(const TArray<TSharedPtr<FJsonValue>>& InTuple, int32 InIndex, int32& OutValue)
+	{
+		double Number = 0.0;
+		if (!InTuple.IsValidIndex(InIndex) || !InTuple[InIndex].IsValid() || !InTuple[InIndex]->TryGetNumber(Number))
+		{
+			return false;
+		}
+		OutValue = FMath::RoundToInt(Number);
+		return true;
+	}
+
+	// TryReadInputTupleStrings는 tuple 위치의 문자열 배열을 읽는다.
+	bool TryReadInputTupleStrings(const TArray<TSharedPtr<FJsonValue>>& InTuple, int32 InIndex, TArray<FString>& OutValues)
+	{
+		OutValues.Reset();
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		if (!InTuple.IsValidIndex(InIndex) || !InTuple[InIndex].IsValid() || !InTuple[InIndex]->TryGetArray(Values) || !Values)
+		{
+			return false;
+		}
+		for (const TSharedPtr<FJsonValue>& Value : *Values)
+		{
+			FString Text;
+			if (!Value.IsValid() || !Value->TryGetString(Text))
+			{
+				return false;
+			}
+			OutValues.Add(MoveTemp(Text));
+		}
+		return true;
+	}
+
+	// TryReadInputTupleDeltas는 tuple 위치의 delta array를 InLimit 미만 오름차순 절대 ordinal로 복원한다.
+	bool TryReadInputTupleDeltas(const TArray<TSharedPtr<FJsonValue>>& InTuple, int32 InIndex, int32 InLimit, TArray<int32>& OutOrdinals)
+	{
+		OutOrdinals.Reset();
+		const TArray<TSharedPtr<FJsonValue>>* DeltaValues = nullptr;
+		if (!InTuple.IsValidIndex(InIndex) || !InTuple[InIndex].IsValid() || !InTuple[InIndex]->TryGetArray(DeltaValues) || !DeltaValues)
+		{
+			return false;
+		}
+		int32 Ordinal = 0;
+		for (int32 DeltaIndex = 0; DeltaIndex < DeltaValues->Num(); ++DeltaIndex)
+		{
+			double DeltaNumber = 0.0;
+			if (!(*DeltaValues)[DeltaIndex].IsValid() || !(*DeltaValues)[DeltaIndex]->TryGetNumber(DeltaNumber))
+			{
+				return false;
+			}
+			const int32 Delta = FMath::RoundToInt(DeltaNumber);
+			if (Delta < 0 || (DeltaIndex > 0 && Delta == 0))
+			{
+				return false;
+			}
+			Ordinal += Delta;
+			if (Ordinal >= InLimit)
+			{
+				return false;
+			}
+			OutOrdinals.Add(Ordinal);
+		}
+		return true;
+	}
+
+	// GetInputTuple은 JSON value가 기대 길이의 array인지 확인하고 포인터를 반환한다.
+	const TArray<TSharedPtr<FJsonValue>>* GetInputTuple(const TSharedPtr<FJsonValue>& InValue, int32 InExpectedLength)
+	{
+		const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+		if (!InValue.IsValid() || !InValue->TryGetArray(Values) || !Values || Values->Num() != InExpectedLength)
+		{
+			return nullptr;
+		}
+		return Values;
+	}
+
+	// TryDecodeInputBindingIndex는 input_binding_index_v1 table을 검증하고 decode한다.
+	bool TryDecodeInputBindingIndex(const TSharedPtr<FJsonObject>& InRootObject, FLoadedInputBindingIndex& OutIndex)
+	{
+		OutIndex = FLoadedInputBindingIndex();
+		OutIndex.GeneratedTime = GetInputStringField(InRootObject, TEXT("generated_time"));
+
+		const TArray<TSharedPtr<FJsonValue>>* ContextValues = GetInputArrayField(InRootObject, TEXT("contexts"));
+		const TArray<TSharedPtr<FJsonValue>>* ActionValues = GetInputArrayField(InRootObject, TEXT("actions"));
+		const TArray<TSharedPtr<FJsonValue>>* BindingValues = GetInputArrayField(InRootObject, TEXT("bindings"));
+		const TArray<TSharedPtr<FJsonValue>>* KeyValues = GetInputArrayField(InRootObject, TEXT("keys"));
+		const TArray<TSharedPtr<FJsonValue>>* ConflictValues = GetInputArrayField(InRootObject, TEXT("conflicts"));
+		if (!ContextValues || !ActionValues || !BindingValues || !KeyValues || !ConflictValues)
+		{
+			return false;
+		}
+		const int32 BindingCount = BindingValues->Num();
+
+		for (const TSharedPtr<FJsonValue>& ContextValue : *ContextValues)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Tuple = GetInputTuple(ContextValue, 5);
+			FInputContextRow& ContextRow = OutIndex.Contexts.AddDefaulted_GetRef();
+			if (!Tuple
+				|| !TryReadInputTupleString(*Tuple, 0, ContextRow.ObjectPath)
+				|| !TryReadInputTupleString(*Tuple, 1, ContextRow.SourceFile)
+				|| !TryReadInputTupleInteger(*Tuple, 2, ContextRow.MappingCount)
+				|| !(*Tuple)[3].IsValid()
+				|| !(*Tuple)[3]->TryGetBool(ContextRow.bMappingTruncated)
+				|| !TryReadInputTupleDeltas(*Tuple, 4, BindingCount, ContextRow.BindingOrdinals))
+			{
+				return false;
+			}
+		}
+
+		for (const TSharedPtr<FJsonValue>& ActionValue : *ActionValues)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Tuple = GetInputTuple(ActionValue, 7);
+			FInputActionRow& ActionRow = OutIndex.Actions.AddDefaulted_GetRef();
+			if (!Tuple
+				|| !TryReadInputTupleString(*Tuple, 0, ActionRow.ActionPath)
+				|| !TryReadInputTupleString(*Tuple, 1, ActionRow.Name)
+				|| !TryReadInputTupleString(*Tuple, 2, ActionRow.ValueType)
+				|| !(*Tuple)[3].IsValid()
+				|| !(*Tuple)[3]->TryGetBool(ActionRow.bDumped)
+				|| !TryReadInputTupleStrings(*Tuple, 4, ActionRow.Triggers)
+				|| !TryReadInputTupleStrings(*Tuple, 5, ActionRow.Modifiers)
+				|| !TryReadInputTupleDeltas(*Tuple, 6, BindingCount, ActionRow.BindingOrdinals))
+			{
+				return false;
+			}
+		}
+
+		OutIndex.Bindings.Reserve(BindingCount);
+		for (const TSharedPtr<FJsonValue>& BindingValue : *BindingValues)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Tuple = GetInputTuple(BindingValue, 7);
+			FInputBindingRow& BindingRow = OutIndex.Bindings.AddDefaulted_GetRef();
+			if (!Tuple
+				|| !TryReadInputTupleInteger(*Tuple, 0, BindingRow.ContextOrdinal)
+				|| !TryReadInputTupleInteger(*Tuple, 1, BindingRow.ActionOrdinal)
+				|| !TryReadInputTupleString(*Tuple, 2, BindingRow.KeyName)
+				|| !TryReadInputTupleString(*Tuple, 3, BindingRow.KeyDisplayName)
+				|| !TryReadInputTupleStrings(*Tuple, 4, BindingRow.Triggers)
+				|| !TryReadInputTupleStrings(*Tuple, 5, BindingRow.Modifiers)
+				|| !TryReadInputTupleInteger(*Tuple, 6, BindingRow.SourceIndex)
+				|| !OutIndex.Contexts.IsValidIndex(BindingRow.ContextOrdinal)
+				|| !OutIndex.Actions.IsValidIndex(BindingRow.ActionOrdinal))
+			{
+				return false;
+			}
+		}
+
+		for (const TSharedPtr<FJsonValue>& KeyValue : *KeyValues)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Tuple = GetInputTuple(KeyValue, 3);
+			FString Key;
+			int32 FirstOrdinal = 0;
+			int32 RangeCount = 0;
+			if (!Tuple
+				|| !TryReadInputTupleString(*Tuple, 0, Key)
+				|| !TryReadInputTupleInteger(*Tuple, 1, FirstOrdinal)
+				|| !TryReadInputTupleInteger(*Tuple, 2, RangeCount)
+				|| Key.IsEmpty()
+				|| FirstOrdinal < 0
+				|| RangeCount <= 0
+				|| FirstOrdinal + RangeCount > BindingCount
+				|| (!OutIndex.Keys.IsEmpty() && OutIndex.Keys.Last().Compare(Key, ESearchCase::CaseSensitive) >= 0))
+			{
+				return false;
+			}
+			OutIndex.Keys.Add(MoveTemp(Key));
+			OutIndex.KeyRanges.Emplace(FirstOrdinal, RangeCount);
+		}
+
+		for (const TSharedPtr<FJsonValue>& ConflictValue : *ConflictValues)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* Tuple = GetInputTuple(ConflictValue, 4);
+			FInputConflictRow& ConflictRow = OutIndex.Conflicts.AddDefaulted_GetRef();
+			if (!Tuple
+				|| !TryReadInputTupleString(*Tuple, 0, ConflictRow.NormalizedKey)
+				|| !TryReadInputTupleString(*Tuple, 1, ConflictRow.Kind)
+				|| !(*Tuple)[2].IsValid()
+				|| !(*Tuple)[2]->TryGetBool(ConflictRow.bTriggerDistinct)
+				|| !TryReadInputTupleDeltas(*Tuple, 3, BindingCount, ConflictRow.BindingOrdinals)
+				|| ConflictRow.BindingOrdinals.Num() < 2)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// AppendInputConflict는 binding 묶음 하나를 충돌 draft로 추가한다. trigger_distinct는 모든 binding의 trigger chain이 서로 다를 때 true다.
+	void AppendInputConflict(
+		const TArray<FInputBindingDraft>& InBindings,
+		const FString& InNormalizedKey,
+		const TCHAR* InKind,
+		const TArray<int32>& InBindingOrdinals,
+		TArray<TSharedPtr<FJsonValue>>& InOutConflictValues)
+	{
+		TSet<FString> TriggerChains;
+		for (const int32 BindingOrdinal : InBindingOrdinals)
+		{
+			TriggerChains.Add(FString::Join(InBindings[BindingOrdinal].Triggers, TEXT("|")));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> ConflictTuple;
+		ConflictTuple.Add(MakeShared<FJsonValueString>(InNormalizedKey));
+		ConflictTuple.Add(MakeShared<FJsonValueString>(InKind));
+		ConflictTuple.Add(MakeShared<FJsonValueBoolean>(TriggerChains.Num() == InBindingOrdinals.Num()));
+		ConflictTuple.Add(MakeInputDeltaArrayValue(InBindingOrdinals));
+		InOutConflictValues.Add(MakeShared<FJsonValueArray>(ConflictTuple));
+	}
+
+	// CollectInputKeyConflicts는 한 key의 binding 범위에서 같은 context 다중 action, 같은 context 중복 binding, context 간 다른 action 충돌을 모은다.
+	void CollectInputKeyConflicts(
+		const TArray<FInputBindingDraft>& InBindings,
+		int32 InFirstOrdinal,
+		int32 InCount,
+		TArray<TSharedPtr<FJsonValue>>& InOutConflictValues)
+	{
+		const FString& NormalizedKey = InBindings[InFirstOrdinal].NormalizedKey;
+		TSet<int32> KeyActions;
+		TSet<int32> KeyContexts;
+		for (int32 Ordinal = InFirstOrdinal; Ordinal < InFirstOrdinal + InCount; ++Ordinal)
+		{
+			KeyActions.Add(InBindings[Ordinal].ActionOrdinal);
+			KeyContexts.Add(InBindings[Ordinal].ContextOrdinal);
+		}
+
+		// binding은 key 다음 context 순으로 정렬돼 있어 같은 context 묶음이 연속 구간이다.
+		for (int32 GroupStart = InFirstOrdinal; GroupStart < InFirstOrdinal + InCount;)
+		{
+			int32 GroupEnd = GroupStart + 1;
+			while (GroupEnd < InFirstOrdinal + InCount && InBindings[GroupEnd].ContextOrdinal == InBindings[GroupStart].ContextOrdinal)
+			{
+				++GroupEnd;
+			}
+
+			TArray<int32> GroupOrdinals;
+			TSet<int32> GroupActions;
+			TMap<int32, TArray<int32>> OrdinalsByAction;
+			for (int32 Ordinal = GroupStart; Ordinal < GroupEnd; ++Ordinal)
+			{
+				GroupOrdinals.Add(Ordinal);
+				GroupActions.Add(InBindings[Ordinal].ActionOrdinal);
+				OrdinalsByAction.FindOrAdd(InBindings[Ordinal].ActionOrdinal).Add(Ordinal);
+			}
+			if (GroupActions.Num() > 1)
+			{
+				AppendInputConflict(InBindings, NormalizedKey, TEXT("same_context"), GroupOrdinals, InOutConflictValues);
+			}
+
+			TArray<int32> DuplicateActions;
+			OrdinalsByAction.GetKeys(DuplicateActions);
+			DuplicateActions.Sort();
+			for (const int32 ActionOrdinal : DuplicateActions)
+			{
+				const TArray<int32>& ActionOrdinals = OrdinalsByAction.FindChecked(ActionOrdinal);
+				if (ActionOrdinals.Num() > 1)
+				{
+					AppendInputConflict(InBindings, NormalizedKey, TEXT("duplicate_binding"), ActionOrdinals, InOutConflictValues);
+				}
+			}
+			GroupStart = GroupEnd;
+		}
+
+		// 여러 context가 같은 key를 다른 action에 묶으면 동시에 활성일 때 priority가 승자를 정한다.
+		if (KeyContexts.Num() > 1 && KeyActions.Num() > 1)
+		{
+			TArray<int32> KeyOrdinals;
+			for (int32 Ordinal = InFirstOrdinal; Ordinal < InFirstOrdinal + InCount; ++Ordinal)
+			{
+				KeyOrdinals.Add(Ordinal);
+			}
+			AppendInputConflict(InBindings, NormalizedKey, TEXT("cross_context"), KeyOrdinals, InOutConflictValues);
+		}
+	}
+
+	// FindInputKeyIndex는 소문자 key 오름차순 배열에서 정확히 일치하는 위치를 찾는다.
+	int32 FindInputKeyIndex(const TArray<FString>& InSortedKeys, const FString& InKey)
+	{
+		const int32 KeyIndex = Algo::LowerBound(InSortedKeys, InKey, [](const FString& Left, const FString& Right)
+		{
+			return Left.Compare(Right, ESearchCase::CaseSensitive) < 0;
+		});
+		return InSortedKeys.IsValidIndex(KeyIndex) && InSortedKeys[KeyIndex].Equals(InKey, ESearchCase::CaseSensitive)
+			? KeyIndex
+			: INDEX_NONE;
+	}
+
+	// GetInputAssetName은 object path의 마지막 '.' 뒤 asset 이름을 반환한다.
+	FString GetInputAssetName(const FString& InObjectPath)
+	{
+		int32 DotIndex = INDEX_NONE;
+		return InObjectPath.FindLastChar(TEXT('.'), DotIndex) ? InObjectPath.Mid(DotIndex + 1) : InObjectPath;
+	}
+
+	// MakeInputBindingResultObject는 binding row를 context/action 경로와 함께 result object로 만든다.
+	TSharedRef<FJsonObject> MakeInputBindingResultObject(const FLoadedInputBindingIndex& InIndex, int32 InBindingOrdinal)
+	{
+		const FInputBindingRow& BindingRow = InIndex.Bindings[InBindingOrdinal];
+		const FInputContextRow& ContextRow = InIndex.Contexts[BindingRow.ContextOrdinal];
+		const FInputActionRow& ActionRow = InIndex.Actions[BindingRow.ActionOrdinal];
+		TSharedRef<FJsonObject> BindingObject = MakeShared<FJsonObject>();
+		BindingObject->SetNumberField(TEXT("binding_ordinal"), InBindingOrdinal);
+		BindingObject->SetStringField(TEXT("key_name"), BindingRow.KeyName);
+		BindingObject->SetStringField(TEXT("key_display_name"), BindingRow.KeyDisplayName);
+		BindingObject->SetStringField(TEXT("context_path"), ContextRow.ObjectPath);
+		BindingObject->SetStringField(TEXT("action_path"), ActionRow.ActionPath);
+		BindingObject->SetStringField(TEXT("action_name"), ActionRow.Name);
+		BindingObject->SetField(TEXT("triggers"), MakeInputStringArrayValue(BindingRow.Triggers));
+		BindingObject->SetField(TEXT("modifiers"), MakeInputStringArrayValue(BindingRow.Modifiers));
+		BindingObject->SetNumberField(TEXT("source_index"), BindingRow.SourceIndex);
+		BindingObject->SetStringField(TEXT("source_file"), ContextRow.SourceFile);
+		return BindingObject;
+	}
+
+	// MakeInputActionResultObject는 action row와 action 레벨 trigger/modifier, binding 수를 result object로 만든다.
+	TSharedRef<FJsonObject> MakeInputActionResultObject(const FInputActionRow& InActionRow)
+	{
+		TSharedRef<FJsonObject> ActionObject = MakeShared<FJsonObject>();
+		ActionObject->SetStringField(TEXT("action_path"), InActionRow.ActionPath);
+		ActionObject->SetStringField(TEXT("action_name"), InActionRow.Name);
+		ActionObject->SetStringField(TEXT("value_type"), InActionRow.ValueType);
+		ActionObject->SetBoolField(TEXT("dumped"), InActionRow.bDumped);
+		ActionObject->SetField(TEXT("triggers"), MakeInputStringArrayValue(InActionRow.Triggers));
+		ActionObject->SetField(TEXT("modifiers"), MakeInputStringArrayValue(InActionRow.Modifiers));
+		ActionObject->SetNumberField(TEXT("binding_count"), InActionRow.BindingOrdinals.Num());
+		return ActionObject;
+	}
+
+	// IntersectInputOrdinals는 두 오름차순 ordinal 목록의 교집합을 만든다.
+	TArray<int32> IntersectInputOrdinals(const TArray<int32>& InLeft, const TArray<int32>& InRight)
+	{
+		TArray<int32> Result;
+		int32 LeftIndex = 0;
+		int32 RightIndex = 0;
+		while (LeftIndex < InLeft.Num() && RightIndex < InRight.Num())
+		{
+			if (InLeft[LeftIndex] < InRight[RightIndex])
+			{
+				++LeftIndex;
+			}
+			else if (InRight[RightIndex] < InLeft[LeftIndex])
+			{
+				++RightIndex;
+			}
+			else
+			{
+				Result.Add(InLeft[LeftIndex]);
+				++LeftIndex;
+				++RightIndex;
+			}
+		}
+		return Result;
+	}
+
+	// UnionInputOrdinals는 여러 오름차순 ordinal 목록을 중복 없는 오름차순 하나로 합친다.
+	TArray<int32> UnionInputOrdinals(const TArray<const TArray<int32>*>& InOrdinalLists)
+	{
+		TArray<int32> Result;
+		for (const TArray<int32>* OrdinalList : InOrdinalLists)
+		{
+			Result.Append(*OrdinalList);
+		}
+		Result.Sort();
+		int32 UniqueCount = 0;
+		for (int32 Index = 0; Index < Result.Num(); ++Index)
+		{
+			if (UniqueCount == 0 || Result[UniqueCount - 1] != Result[Index])
+			{
+				Result[UniqueCount++] = Result[Index];
+			}
+		}
+		Result.SetNum(UniqueCount, EAllowShrinking::No);
+		return Result;
+	}
+
+	// GetInputQueryOptionValue는 -Key=Value command option을 읽는다.
+	FString GetInputQueryOptionValue(const FString& InCommandLine, const TCHAR* InKey)
+	{
+		FString Value;
+		FParse::Value(*InCommandLine, InKey, Value);
+		Value.TrimStartAndEndInline();
+		return Value;
+	}
+}
+
+namespace ADumpInputIndex
+{
+	bool BuildInputBindingIndex(
+		const FString& InDumpRootPath,
+		FString& OutInputIndexFilePath,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutInputIndexFilePath.Reset();
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+		auto Fail = [&](const TCHAR* InCode, const FString& InDetail)
+		{
+			OutErrorCode = InCode;
+			OutErrorDetail = InDetail;
+			return false;
+		};
+
+		const FString NormalizedDumpRoot = NormalizeInputDumpRoot(InDumpRootPath);
+		const FString SectionIndexPath = FPaths::Combine(NormalizedDumpRoot, TEXT("section_index.json"));
+		if (!IFileManager::Get().FileExists(*SectionIndexPath))
+		{
+			return Fail(TEXT("ADUMP_INPUT_INDEX_SECTION_INDEX_NOT_FOUND"), TEXT("section_index.json must exist before input_binding_index_v1 is built."));
+		}
+		TSharedPtr<FJsonObject> SectionIndexRoot;
+		if (!LoadInputIndexJsonObject(SectionIndexPath, SectionIndexRoot))
+		{
+			return Fail(TEXT("ADUMP_INPUT_INDEX_SECTION_INDEX_JSON_INVALID"), TEXT("section_index.json is not readable while building input_binding_index_v1."));
+		}
+		if (GetInputStringField(SectionIndexRoot, TEXT("schema_version")) != TEXT("section_index_v1"))
+		{
+			return Fail(TEXT("ADUMP_INPUT_INDEX_SECTION_INDEX_SCHEMA_UNSUPPORTED"), TEXT("input_binding_index_v1 requires section_index_v1."));
+		}
+		const TArray<TSharedPtr<FJsonValue>>* SectionValues = GetInputArrayField(SectionIndexRoot, TEXT("sections"));
+		if (!SectionValues)
+		{
+			return Fail(TEXT("ADUMP_INPUT_INDEX_SECTION_INDEX_JSON_INVALID"), TEXT("section_index.json has no sections array."));
+		}
+
+		// SummaryReads는 input_summary entry별 source 해석 결과다. source 읽기는 worker에서 병렬로 한다.
+		TArray<FInputSummaryRead> SummaryReads;
+		for (const TSharedPtr<FJsonValue>& SectionValue : *SectionValues)
+		{
+			const TSharedPtr<FJsonObject> SectionObject = SectionValue.IsValid() ? SectionValue->AsObject() : nullptr;
+			if (GetInputStringField(SectionObject, TEXT("section_name")) != TEXT("input_summary"))
+			{
+				continue;
+			}
+			FInputSummaryRead& SummaryRead = SummaryReads.AddDefaulted_GetRef();
+			SummaryRead.ObjectPath = GetInputStringField(SectionObject, TEXT("object_path"));
+			SummaryRead.SourceFile = GetInputStringField(SectionObject, TEXT("source_file"));
+			SummaryRead.JsonPointer = GetInputStringField(SectionObject, TEXT("json_pointer"));
+		}
+		SummaryReads.Sort([](const FInputSummaryRead& Left, const FInputSummaryRead& Right)
+		{
+			return Left.ObjectPath.Compare(Right.ObjectPath, ESearchCase::CaseSensitive) < 0;
+		});
+
+		ParallelFor(SummaryReads.Num(), [&SummaryReads, &NormalizedDumpRoot](int32 ReadIndex)
+		{
+			ReadInputSummarySource(NormalizedDumpRoot, SummaryReads[ReadIndex]);
+		});
+
+		// 병합은 object path 순서로 직렬 수행하므로 첫 실패와 최종 출력은 worker 완료 순서와 무관하다.
+		TArray<const FInputSummaryRead*> ContextReads;
+		TMap<FString, FInputActionDraft> ActionDraftByPath;
+		int32 NullActionMappingCount = 0;
+		for (const FInputSummaryRead& SummaryRead : SummaryReads)
+		{
+			if (!SummaryRead.ErrorCode.IsEmpty())
+			{
+				return Fail(*SummaryRead.ErrorCode, SummaryRead.ErrorDetail);
+			}
+			if (!SummaryRead.bSupported)
+			{
+				continue;
+			}
+			if (SummaryRead.AssetKind == TEXT("input_action"))
+			{
+				FInputActionDraft& ActionDraft = ActionDraftByPath.FindOrAdd(SummaryRead.ObjectPath);
+				ActionDraft.Name = GetInputAssetName(SummaryRead.ObjectPath);
+				ActionDraft.ValueType = SummaryRead.ValueType;
+				ActionDraft.bDumped = true;
+				ActionDraft.Triggers = SummaryRead.ActionTriggers;
+				ActionDraft.Modifiers = SummaryRead.ActionModifiers;
+			}
+			else if (SummaryRead.AssetKind == TEXT("input_mapping_context"))
+			{
+				ContextReads.Add(&SummaryRead);
+				for (const FInputMappingRead& MappingRead : SummaryRead.Mappings)
+				{
+					if (MappingRead.ActionPath.IsEmpty())
+					{
+						++NullActionMappingCount;
+						continue;
+					}
+					FInputActionDraft& ActionDraft = ActionDraftByPath.FindOrAdd(MappingRead.ActionPath);
+					if (ActionDraft.Name.IsEmpty())
+					{
+						ActionDraft.Name = MappingRead.ActionName.IsEmpty() ? GetInputAssetName(MappingRead.ActionPath) : MappingRead.ActionName;
+					}
+				}
+			}
+		}
+
+		// ActionPaths는 action ordinal 순서(경로 오름차순)다.
+		TArray<FString> ActionPaths;
+		ActionDraftByPath.GetKeys(ActionPaths);
+		ActionPaths.Sort([](const FString& Left, const FString& Right)
+		{
+			return Left.Compare(Right, ESearchCase::CaseSensitive) < 0;
+		});
+		TMap<FString, int32> ActionOrdinalByPath;
+		for (int32 ActionOrdinal = 0; ActionOrdinal < ActionPaths.Num(); ++ActionOrdinal)
+		{
+			ActionOrdinalByPath.Add(ActionPaths[ActionOrdinal], ActionOrdinal);
+		}
+
+		TArray<FInputBindingDraft> BindingDrafts;
+		for (int32 ContextOrdinal = 0; ContextOrdinal < ContextReads.Num(); ++ContextOrdinal)
+		{
+			for (const FInputMappingRead& MappingRead : ContextReads[ContextOrdinal]->Mappings)
+			{
+				const FString NormalizedKey = NormalizeInputKey(MappingRead.KeyName);
+				if (MappingRead.ActionPath.IsEmpty() || NormalizedKey.IsEmpty())
+				{
+					continue;
+				}
+				FInputBindingDraft& BindingDraft = BindingDrafts.AddDefaulted_GetRef();
+				BindingDraft.ContextOrdinal = ContextOrdinal;
+				BindingDraft.ActionOrdinal = ActionOrdinalByPath.FindChecked(MappingRead.ActionPath);
+				BindingDraft.SourceIndex = MappingRead.SourceIndex;
+				BindingDraft.NormalizedKey = NormalizedKey;
+				BindingDraft.KeyName = MappingRead.KeyName;
+				BindingDraft.KeyDisplayName = MappingRead.KeyDisplayName;
+				BindingDraft.Triggers = MappingRead.Triggers;
+				BindingDraft.Modifiers = MappingRead.Modifiers;
+			}
+		}
+		BindingDrafts.Sort([](const FInputBindingDraft& Left, const FInputBindingDraft& Right)
+		{
+			const int32 KeyCompare = Left.NormalizedKey.Compare(Right.NormalizedKey, ESearchCase::CaseSensitive);
+			if (KeyCompare != 0)
+			{
+				return KeyCompare < 0;
+			}
+			if (Left.ContextOrdinal != Right.ContextOrdinal)
+			{
+				return Left.ContextOrdinal < Right.ContextOrdinal;
+			}
+			if (Left.SourceIndex != Right.SourceIndex)
+			{
+				return Left.SourceIndex < Right.SourceIndex;
+			}
+			return Left.ActionOrdinal < Right.ActionOrdinal;
+		});
+
+		// binding table, key 범위, context/action 역참조와 충돌 집합을 정렬된 binding 한 번 순회로 만든다.
+		TArray<TArray<int32>> BindingOrdinalsByContext;
+		BindingOrdinalsByContext.SetNum(ContextReads.Num());
+		TArray<TArray<int32>> BindingOrdinalsByAction;
+		BindingOrdinalsByAction.SetNum(ActionPaths.Num());
+		TArray<TSharedPtr<FJsonValue>> BindingTableValues;
+		BindingTableValues.Reserve(BindingDrafts.Num());
+		TArray<TSharedPtr<FJsonValue>> KeyTableValues;
+		TArray<TSharedPtr<FJsonValue>> ConflictTableValues;
+		for (int32 BindingOrdinal = 0; BindingOrdinal < BindingDrafts.Num(); ++BindingOrdinal)
+		{
+			const FInputBindingDraft& BindingDraft = BindingDrafts[BindingOrdinal];
+			BindingOrdinalsByContext[BindingDraft.ContextOrdinal].Add(BindingOrdinal);
+			BindingOrdinalsByAction[BindingDraft.ActionOrdinal].Add(BindingOrdinal);
+
+			TArray<TSharedPtr<FJsonValue>> BindingTuple;
+			BindingTuple.Add(MakeShared<FJsonValueNumber>(BindingDraft.ContextOrdinal));
+			BindingTuple.Add(MakeShared<FJsonValueNumber>(BindingDraft.ActionOrdinal));
+			BindingTuple.Add(MakeShared<FJsonValueString>(BindingDraft.KeyName));
+			BindingTuple.Add(MakeShared<FJsonValueString>(BindingDraft.KeyDisplayName));
+			BindingTuple.Add(MakeInputStringArrayValue(BindingDraft.Triggers));
+			BindingTuple.Add(MakeInputStringArrayValue(BindingDraft.Modifiers));
+			BindingTuple.Add(MakeShared<FJsonValueNumber>(BindingDraft.SourceIndex));
+			BindingTableValues.Add(MakeShared<FJsonValueArray>(BindingTuple));
+
+			const bool bKeyRangeEnds = BindingOrdinal + 1 == BindingDrafts.Num()
+				|| !BindingDrafts[BindingOrdinal + 1].NormalizedKey.Equals(BindingDraft.NormalizedKey, ESearchCase::CaseSensitive);
+			if (bKeyRangeEnds)
+			{
+				int32 FirstOrdinal = BindingOrdinal;
+				while (FirstOrdinal > 0 && BindingDrafts[FirstOrdinal - 1].NormalizedKey.Equals(BindingDraft.NormalizedKey, ESearchCase::CaseSensitive))
+				{
+					--FirstOrdinal;
+				}
+				const int32 RangeCount = BindingOrdinal - FirstOrdinal + 1;
+				TArray<TSharedPtr<FJsonValue>> KeyTuple;
+				KeyTuple.Add(MakeShared<FJsonValueString>(BindingDraft.NormalizedKey));
+				KeyTuple.Add(MakeShared<FJsonValueNumber>(FirstOrdinal));
+				KeyTuple.Add(MakeShared<FJsonValueNumber>(RangeCount));
+				KeyTableValues.Add(MakeShared<FJsonValueArray>(KeyTuple));
+				CollectInputKeyConflicts(BindingDrafts, FirstOrdinal, RangeCount, ConflictTableValues);
+			}
+		}
+
+		TArray<TSharedPtr<FJsonValue>> ContextTableValues;
+		for (int32 ContextOrdinal = 0; ContextOrdinal < ContextReads.Num(); ++ContextOrdinal)
+		{
+			const FInputSummaryRead& ContextRead = *ContextReads[ContextOrdinal];
+			TArray<TSharedPtr<FJsonValue>> ContextTuple;
+			ContextTuple.Add(MakeShared<FJsonValueString>(ContextRead.ObjectPath));
+			ContextTuple.Add(MakeShared<FJsonValueString>(ContextRead.SourceFile));
+			ContextTuple.Add(MakeShared<FJsonValueNumber>(ContextRead.MappingCount));
+			ContextTuple.Add(MakeShared<FJsonValueBoolean>(ContextRead.bMappingTruncated));
+			ContextTuple.Add(MakeInputDeltaArrayValue(BindingOrdinalsByContext[ContextOrdinal]));
+			ContextTableValues.Add(MakeShared<FJsonValueArray>(ContextTuple));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> ActionTableValues;
+		for (int32 ActionOrdinal = 0; ActionOrdinal < ActionPaths.Num(); ++ActionOrdinal)
+		{
+			const FInputActionDraft& ActionDraft = ActionDraftByPath.FindChecked(ActionPaths[ActionOrdinal]);
+			TArray<TSharedPtr<FJsonValue>> ActionTuple;
+			ActionTuple.Add(MakeShared<FJsonValueString>(ActionPaths[ActionOrdinal]));
+			ActionTuple.Add(MakeShared<FJsonValueString>(ActionDraft.Name));
+			ActionTuple.Add(MakeShared<FJsonValueString>(ActionDraft.ValueType));
+			ActionTuple.Add(MakeShared<FJsonValueBoolean>(ActionDraft.bDumped));
+			ActionTuple.Add(MakeInputStringArrayValue(ActionDraft.Triggers));
+			ActionTuple.Add(MakeInputStringArrayValue(ActionDraft.Modifiers));
+			ActionTuple.Add(MakeInputDeltaArrayValue(BindingOrdinalsByAction[ActionOrdinal]));
+			ActionTableValues.Add(MakeShared<FJsonValueArray>(ActionTuple));
+		}
+
+		TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+		RootObject->SetStringField(TEXT("schema_version"), InputBindingIndexSchemaVersion);
+		RootObject->SetStringField(TEXT("generated_time"), FDateTime::UtcNow().ToIso8601());
+		RootObject->SetStringField(TEXT("section_index_schema_version"), TEXT("section_index_v1"));
+		RootObject->SetStringField(TEXT("section_index_generated_time"), GetInputStringField(SectionIndexRoot, TEXT("generated_time")));
+		RootObject->SetStringField(TEXT("posting_encoding"), TEXT("delta_ordinal_v1"));
+		RootObject->SetNumberField(TEXT("context_count"), ContextTableValues.Num());
+		RootObject->SetNumberField(TEXT("action_count"), ActionTableValues.Num());
+		RootObject->SetNumberField(TEXT("binding_count"), BindingTableValues.Num());
+		RootObject->SetNumberField(TEXT("key_count"), KeyTableValues.Num());
+		RootObject->SetNumberField(TEXT("conflict_count"), ConflictTableValues.Num());
+		RootObject->SetNumberField(TEXT("null_action_mapping_count"), NullActionMappingCount);
+		RootObject->SetArrayField(TEXT("contexts"), ContextTableValues);
+		RootObject->SetArrayField(TEXT("actions"), ActionTableValues);
+		RootObject->SetArrayField(TEXT("bindings"), BindingTableValues);
+		RootObject->SetArrayField(TEXT("keys"), KeyTableValues);
+		RootObject->SetArrayField(TEXT("conflicts"), ConflictTableValues);
+
+		FString IndexJsonText;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&IndexJsonText);
+		if (!FJsonSerializer::Serialize(RootObject, Writer))
+		{
+			return Fail(TEXT("ADUMP_INPUT_INDEX_WRITE_FAILED"), TEXT("Failed to serialize input_binding_index_v1."));
+		}
+		OutInputIndexFilePath = FPaths::Combine(NormalizedDumpRoot, InputBindingIndexFileName);
+		FString SaveError;
+		if (!ADumpQueryIO::SaveJsonTextToFile(OutInputIndexFilePath, IndexJsonText, SaveError))
+		{
+			OutInputIndexFilePath.Reset();
+			return Fail(TEXT("ADUMP_INPUT_INDEX_WRITE_FAILED"), FString::Printf(TEXT("Failed to atomically save input_binding_index_v1: %s"), *SaveError));
+		}
+		return true;
+	}
+
+	bool BuildInputQueryJson(
+		const FString& InCommandLine,
+		FString& OutJsonText,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutJsonText.Reset();
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+		auto Fail = [&](const TCHAR* InCode, const FString& InDetail)
+		{
+			OutErrorCode = InCode;
+			OutErrorDetail = InDetail;
+			return false;
+		};
+
+		FString DumpRoot = GetInputQueryOptionValue(InCommandLine, TEXT("DumpRoot="));
+		if (DumpRoot.IsEmpty())
+		{
+			DumpRoot = FPaths::Combine(ADumpQueryIO::BuildDefaultDumpRootDirectory(), TEXT("BPDump"));
+		}
+
+		const FString KeyText = GetInputQueryOptionValue(InCommandLine, TEXT("Key="));
+		const FString ActionText = GetInputQueryOptionValue(InCommandLine, TEXT("Action="));
+		const FString ContextText = GetInputQueryOptionValue(InCommandLine, TEXT("Context="));
+		bool bConflictsRequested = false;
+		FParse::Bool(*InCommandLine, TEXT("Conflicts="), bConflictsRequested);
+		if (KeyText.IsEmpty() && ActionText.IsEmpty() && ContextText.IsEmpty() && !bConflictsRequested)
+		{
+			return Fail(TEXT("ADUMP_INPUT_QUERY_SELECTOR_REQUIRED"), TEXT("inputquery requires -Key=, -Action=, -Context= or -Conflicts=true."));
+		}
+
+		int32 Limit = 100;
+		FParse::Value(*InCommandLine, TEXT("Limit="), Limit);
+		if (Limit < 1 || Limit > 1000)
+		{
+			return Fail(TEXT("ADUMP_INPUT_QUERY_BOUNDS_INVALID"), TEXT("inputquery Limit must be between 1 and 1000."));
+		}
+
+		const double StartSeconds = FPlatformTime::Seconds();
+		const FString IndexPath = FPaths::Combine(NormalizeInputDumpRoot(DumpRoot), InputBindingIndexFileName);
+		if (!IFileManager::Get().FileExists(*IndexPath))
+		{
+			return Fail(TEXT("ADUMP_INPUT_QUERY_INDEX_NOT_FOUND"), TEXT("input_binding_index.json was not found. Run -Mode=index first."));
+		}
+		TSharedPtr<FJsonObject> IndexRoot;
+		if (!LoadInputIndexJsonObject(IndexPath, IndexRoot))
+		{
+			return Fail(TEXT("ADUMP_INPUT_QUERY_INDEX_JSON_INVALID"), TEXT("input_binding_index.json is not valid JSON."));
+		}
+		if (GetInputStringField(IndexRoot, TEXT("schema_version")) != InputBindingIndexSchemaVersion)
+		{
+			return Fail(TEXT("ADUMP_INPUT_QUERY_INDEX_SCHEMA_UNSUPPORTED"), TEXT("inputquery requires input_binding_index_v1."));
+		}
+		FLoadedInputBindingIndex Index;
+		if (!TryDecodeInputBindingIndex(IndexRoot, Index))
+		{
+			return Fail(TEXT("ADUMP_INPUT_QUERY_INDEX_JSON_INVALID"), TEXT("input_binding_index.json tables are malformed."));
+		}
+		IndexRoot.Reset();
+		const double LoadedSeconds = FPlatformTime::Seconds();
+
+		// 선택자마다 binding ordinal 후보를 만들고 교집합을 취한다. 선택자가 없으면(-Conflicts=true만) 후보는 비어 있다.
+		bool bHasBindingSelector = false;
+		TArray<int32> MatchOrdinals;
+		auto ApplySelector = [&bHasBindingSelector, &MatchOrdinals](TArray<int32>&& InSelectorOrdinals)
+		{
+			MatchOrdinals = bHasBindingSelector ? IntersectInputOrdinals(MatchOrdinals, InSelectorOrdinals) : MoveTemp(InSelectorOrdinals);
+			bHasBindingSelector = true;
+		};
+
+		const FString NormalizedKey = NormalizeInputKey(KeyText);
+		if (!NormalizedKey.IsEmpty())
+		{
+			TArray<int32> KeyOrdinals;
+			const int32 KeyIndex = FindInputKeyIndex(Index.Keys, NormalizedKey);
+			if (KeyIndex != INDEX_NONE)
+			{
+				for (int32 Offset = 0; Offset < Index.KeyRanges[KeyIndex].Value; ++Offset)
+				{
+					KeyOrdinals.Add(Index.KeyRanges[KeyIndex].Key + Offset);
+				}
+			}
+			ApplySelector(MoveTemp(KeyOrdinals));
+		}
+
+		// Action=과 Context=는 object path 정확 일치 또는 asset 이름 대소문자 무시 일치다.
+		TArray<int32> MatchedActionOrdinals;
+		if (!ActionText.IsEmpty())
+		{
+			TArray<const TArray<int32>*> ActionOrdinalLists;
+			for (int32 ActionOrdinal = 0; ActionOrdinal < Index.Actions.Num(); ++ActionOrdinal)
+			{
+				const FInputActionRow& ActionRow = Index.Actions[ActionOrdinal];
+				if (ActionRow.ActionPath.Equals(ActionText, ESearchCase::CaseSensitive) || ActionRow.Name.Equals(ActionText, ESearchCase::IgnoreCase))
+				{
+					MatchedActionOrdinals.Add(ActionOrdinal);
+					ActionOrdinalLists.Add(&ActionRow.BindingOrdinals);
+				}
+			}
+			ApplySelector(UnionInputOrdinals(ActionOrdinalLists));
+		}
+		if (!ContextText.IsEmpty())
+		{
+			TArray<const TArray<int32>*> ContextOrdinalLists;
+			for (const FInputContextRow& ContextRow : Index.Contexts)
+			{
+				if (ContextRow.ObjectPath.Equals(ContextText, ESearchCase::CaseSensitive)
+					|| GetInputAssetName(ContextRow.ObjectPath).Equals(ContextText, ESearchCase::IgnoreCase))
+				{
+					ContextOrdinalLists.Add(&ContextRow.BindingOrdinals);
+				}
+			}
+			ApplySelector(UnionInputOrdinals(ContextOrdinalLists));
+		}
+
+		// 충돌은 -Conflicts=true 또는 -Key= 질의에 포함한다. binding 선택자가 있으면 결과 binding을 하나라도 포함한 충돌만 남긴다.
+		TArray<int32> MatchConflictOrdinals;
+		if (bConflictsRequested || !NormalizedKey.IsEmpty())
+		{
+			for (int32 ConflictOrdinal = 0; ConflictOrdinal < Index.Conflicts.Num(); ++ConflictOrdinal)
+			{
+				if (!bHasBindingSelector || !IntersectInputOrdinals(Index.Conflicts[ConflictOrdinal].BindingOrdinals, MatchOrdinals).IsEmpty())
+				{
+					MatchConflictOrdinals.Add(ConflictOrdinal);
+				}
+			}
+		}
+
+		const int32 ReturnedBindingCount = FMath::Min(Limit, MatchOrdinals.Num());
+		TArray<TSharedPtr<FJsonValue>> BindingValues;
+		BindingValues.Reserve(ReturnedBindingCount);
+		for (int32 ResultIndex = 0; ResultIndex < ReturnedBindingCount; ++ResultIndex)
+		{
+			BindingValues.Add(MakeShared<FJsonValueObject>(MakeInputBindingResultObject(Index, MatchOrdinals[ResultIndex])));
+		}
+
+		const int32 ReturnedConflictCount = FMath::Min(Limit, MatchConflictOrdinals.Num());
+		TArray<TSharedPtr<FJsonValue>> ConflictValues;
+		ConflictValues.Reserve(ReturnedConflictCount);
+		for (int32 ResultIndex = 0; ResultIndex < ReturnedConflictCount; ++ResultIndex)
+		{
+			const FInputConflictRow& ConflictRow = Index.Conflicts[MatchConflictOrdinals[ResultIndex]];
+			TArray<FString> ContextPaths;
+			TArray<FString> ActionPaths;
+			TArray<TSharedPtr<FJsonValue>> ConflictBindingValues;
+			for (const int32 BindingOrdinal : ConflictRow.BindingOrdinals)
+			{
+				const FInputBindingRow& BindingRow = Index.Bindings[BindingOrdinal];
+				ContextPaths.AddUnique(Index.Contexts[BindingRow.ContextOrdinal].ObjectPath);
+				ActionPaths.AddUnique(Index.Actions[BindingRow.ActionOrdinal].ActionPath);
+				ConflictBindingValues.Add(MakeShared<FJsonValueObject>(MakeInputBindingResultObject(Index, BindingOrdinal)));
+			}
+
+			TSharedRef<FJsonObject> ConflictObject = MakeShared<FJsonObject>();
+			ConflictObject->SetStringField(TEXT("key_name"), Index.Bindings[ConflictRow.BindingOrdinals[0]].KeyName);
+			ConflictObject->SetStringField(TEXT("kind"), ConflictRow.Kind);
+			ConflictObject->SetBoolField(TEXT("trigger_distinct"), ConflictRow.bTriggerDistinct);
+			ConflictObject->SetNumberField(TEXT("binding_count"), ConflictRow.BindingOrdinals.Num());
+			ConflictObject->SetField(TEXT("context_paths"), MakeInputStringArrayValue(ContextPaths));
+			ConflictObject->SetField(TEXT("action_paths"), MakeInputStringArrayValue(ActionPaths));
+			ConflictObject->SetArrayField(TEXT("bindings"), ConflictBindingValues);
+			ConflictValues.Add(MakeShared<FJsonValueObject>(ConflictObject));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> ActionValues;
+		for (const int32 ActionOrdinal : MatchedActionOrdinals)
+		{
+			ActionValues.Add(MakeShared<FJsonValueObject>(MakeInputActionResultObject(Index.Actions[ActionOrdinal])));
+		}
+		const double QueriedSeconds = FPlatformTime::Seconds();
+
+		TSharedRef<FJsonObject> QueryObject = MakeShared<FJsonObject>();
+		QueryObject->SetStringField(TEXT("key"), KeyText);
+		QueryObject->SetStringField(TEXT("normalized_key"), NormalizedKey);
+		QueryObject->SetStringField(TEXT("action"), ActionText);
+		QueryObject->SetStringField(TEXT("context"), ContextText);
+		QueryObject->SetBoolField(TEXT("conflicts"), bConflictsRequested);
+		QueryObject->SetNumberField(TEXT("limit"), Limit);
+
+		TSharedRef<FJsonObject> IndexObject = MakeShared<FJsonObject>();
+		IndexObject->SetStringField(TEXT("schema_version"), InputBindingIndexSchemaVersion);
+		IndexObject->SetStringField(TEXT("generated_time"), Index.GeneratedTime);
+		IndexObject->SetNumberField(TEXT("context_count"), Index.Contexts.Num());
+		IndexObject->SetNumberField(TEXT("action_count"), Index.Actions.Num());
+		IndexObject->SetNumberField(TEXT("binding_count"), Index.Bindings.Num());
+		IndexObject->SetNumberField(TEXT("conflict_count"), Index.Conflicts.Num());
+
+		TSharedRef<FJsonObject> PerfObject = MakeShared<FJsonObject>();
+		PerfObject->SetNumberField(TEXT("load_ms"), (LoadedSeconds - StartSeconds) * 1000.0);
+		PerfObject->SetNumberField(TEXT("query_ms"), (QueriedSeconds - LoadedSeconds) * 1000.0);
+
+		TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+		RootObject->SetStringField(TEXT("schema_version"), TEXT("input_query_result_v1"));
+		RootObject->SetObjectField(TEXT("query"), QueryObject);
+		RootObject->SetObjectField(TEXT("index"), IndexObject);
+		RootObject->SetArrayField(TEXT("matched_actions"), ActionValues);
+		RootObject->SetNumberField(TEXT("total_binding_count"), MatchOrdinals.Num());
+		RootObject->SetNumberField(TEXT("returned_binding_count"), BindingValues.Num());
+		RootObject->SetBoolField(TEXT("bindings_truncated"), ReturnedBindingCount < MatchOrdinals.Num());
+		RootObject->SetArrayField(TEXT("bindings"), BindingValues);
+		RootObject->SetNumberField(TEXT("total_conflict_count"), MatchConflictOrdinals.Num());
+		RootObject->SetNumberField(TEXT("returned_conflict_count"), ConflictValues.Num());
+		RootObject->SetBoolField(TEXT("conflicts_truncated"), ReturnedConflictCount < MatchConflictOrdinals.Num());
+		RootObject->SetArrayField(TEXT("conflicts"), ConflictValues);
+		RootObject->SetObjectField(TEXT("perf"), PerfObject);
+
+		TSharedRef<TJsonWriter<>> ResultWriter = TJsonWriterFactory<>::Create(&OutJsonText);
+		if (!FJsonSerializer::Serialize(RootObject, ResultWriter))
+		{
+			return Fail(TEXT("ADUMP_INPUT_QUERY_SERIALIZE_FAILED"), TEXT("Failed to serialize input_query_result_v1."));
+		}
+		return true;
+	}
+}
@@ -0,0 +1,915 @@
+// File: ADumpPack.cpp
+// Version: v1.1.0
+// Changelog:
+// - v1.1.0: RemovePackedDirectory가 폴더 prefix 항목을 writer TOC에서 빼고 dirty로 표시해 다음 commit에 반영.
+// - v1.0.2: FindPackForFile이 폴더별 pack 조회 결과를 cache해 읽기마다 상위 폴더 전체를 FileExists로 확인하지 않도록 함.
+// - v1.0.1: AssetDumpQuery module로 옮김. 구현 변경은 없다.
+// - v1.0.0: append-only pack writer registry, footer TOC commit/복구 scan, mmap reader cache와 directory export를 구현.
+// Migration:
+// - pack 파일은 header magic 8 byte, payload들, commit마다 TOC JSON + 32 byte footer 순서로만 늘어난다.
+// - 마지막 유효 footer가 최신 commit이며, 잘린 꼬리는 이전 footer까지 역방향 scan으로 건너뛴다.
+
+#include "ADumpPack.h"
+
+#include "Async/MappedFileHandle.h"
+#include "Dom/JsonObject.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	// PackFileName은 dump root 아래 pack 파일 이름이다.
+	const TCHAR* PackFileName = TEXT("dump_pack.adpk");
+
+	// PackHeaderMagic과 PackFooterMagic은 pack 시작과 TOC footer를 식별하는 8 byte magic이다.
+	const uint8 PackHeaderMagic[8] = { 'A', 'D', 'P', 'K', 'D', 'A', 'T', '1' };
+	const uint8 PackFooterMagic[8] = { 'A', 'D', 'P', 'K', 'T', 'O', 'C', '1' };
+
+	// PackHeaderBytes와 PackFooterBytes는 header와 footer(magic, toc offset, toc length, toc crc, footer crc) 크기다.
+	constexpr int64 PackHeaderBytes = 8;
+	constexpr int64 PackFooterBytes = 32;
+
+	// PackLookupMissCacheSeconds는 pack이 없다고 확인한 폴더 결과를 다시 확인하기 전까지 재사용하는 시간이다. 다른 process가 만든 pack을 이 시간 뒤에 본다.
+	constexpr double PackLookupMissCacheSeconds = 2.0;
+
+	// PackFooterScanChunkBytes는 잘린 꼬리 뒤 이전 footer를 찾는 역방향 scan 한 번의 byte 수다.
+	constexpr int64 PackFooterScanChunkBytes = 64 * 1024;
+
+	// FPackReader는 commit된 최신 TOC와 mmap(불가하면 file reader) payload 접근이다.
+	class FPackReader
+	{
+	public:
+		// Open은 pack을 열고 마지막 유효 footer의 TOC를 읽는다. header만 있는 pack은 빈 TOC로 연다.
+		bool Open(const FString& InPackFilePath, FString& OutErrorCode, FString& OutErrorDetail)
+		{
+			PackFilePath = InPackFilePath;
+			FileBytes = IFileManager::Get().FileSize(*PackFilePath);
+			if (FileBytes < PackHeaderBytes)
+			{
+				OutErrorCode = TEXT("ADUMP_PACK_INVALID");
+				OutErrorDetail = FString::Printf(TEXT("Pack file is missing or shorter than its header: %s"), *PackFilePath);
+				return false;
+			}
+
+			MappedHandle.Reset(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*PackFilePath));
+			if (MappedHandle.IsValid())
+			{
+				MappedRegion.Reset(MappedHandle->MapRegion(0, FileBytes));
+			}
+
+			uint8 HeaderBytes[PackHeaderBytes];
+			if (!ReadBytes(0, PackHeaderBytes, HeaderBytes) || FMemory::Memcmp(HeaderBytes, PackHeaderMagic, PackHeaderBytes) != 0)
+			{
+				OutErrorCode = TEXT("ADUMP_PACK_INVALID");
+				OutErrorDetail = FString::Printf(TEXT("Pack header magic does not match: %s"), *PackFilePath);
+				return false;
+			}
+
+			Entries.Reset();
+			Generation = 0;
+			CommittedBytes = PackHeaderBytes;
+			if (!LoadLatestToc())
+			{
+				if (FileBytes > PackHeaderBytes)
+				{
+					UE_LOG(LogTemp, Warning, TEXT("ADUMP_PACK_TOC_MISSING: no committed TOC in %s; pack opened empty."), *PackFilePath);
+				}
+			}
+			return true;
+		}
+
+		// ReadBytes는 pack byte 구간을 복사한다.
+		bool ReadBytes(int64 InOffset, int64 InLength, uint8* OutBytes) const
+		{
+			if (InOffset < 0 || InLength < 0 || InOffset + InLength > FileBytes)
+			{
+				return false;
+			}
+			if (MappedRegion.IsValid())
+			{
+				FMemory::Memcpy(OutBytes, MappedRegion->GetMappedPtr() + InOffset, InLength);
+				return true;
+			}
+
+			TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*PackFilePath, FILEREAD_Silent));
+			if (!FileReader.IsValid())
+			{
+				return false;
+			}
+			FileReader->Seek(InOffset);
+			FileReader->Serialize(OutBytes, InLength);
+			return !FileReader->IsError();
+		}
+
+		// ReadEntry는 TOC entry payload를 읽고 CRC32를 검증한다.
+		bool ReadEntry(const FADumpPackEntry& InEntry, TArray<uint8>& OutBytes) const
+		{
+			OutBytes.Reset();
+			if (InEntry.Length > MAX_int32)
+			{
+				return false;
+			}
+			OutBytes.SetNumUninitialized(static_cast<int32>(InEntry.Length));
+			if (!ReadBytes(InEntry.Offset, InEntry.Length, OutBytes.GetData())
+				|| FCrc::MemCrc32(OutBytes.GetData(), OutBytes.Num()) != InEntry.Crc)
+			{
+				OutBytes.Reset();
+				return false;
+			}
+			return true;
+		}
+
+		// Entries는 상대 경로별 최신 payload 위치다.
+		TMap<FString, FADumpPackEntry> Entries;
+
+		// Generation은 최신 commit 번호다. 아직 commit이 없으면 0이다.
+		int64 Generation = 0;
+
+		// CommittedBytes는 최신 footer 끝 byte 위치다.
+		int64 CommittedBytes = 0;
+
+		// FileBytes는 연 시점의 pack 파일 크기다.
+		int64 FileBytes = 0;
+
+		// Stamp는 reader cache 무효화용 크기/수정 시각이다.
+		FString Stamp;
+
+	private:
+		// TryParseFooter는 InFooterOffset의 footer와 그 TOC를 검증해 Entries를 채운다.
+		bool TryParseFooter(int64 InFooterOffset)
+		{
+			uint8 FooterBytes[PackFooterBytes];
+			if (!ReadBytes(InFooterOffset, PackFooterBytes, FooterBytes)
+				|| FMemory::Memcmp(FooterBytes, PackFooterMagic, sizeof(PackFooterMagic)) != 0)
+			{
+				return false;
+			}
+
+			// footer 필드는 little-endian 고정 폭이며 지원 platform이 모두 little-endian이라 그대로 복사한다.
+			int64 TocOffset = 0;
+			int64 TocLength = 0;
+			uint32 TocCrc = 0;
+			uint32 FooterCrc = 0;
+			FMemory::Memcpy(&TocOffset, FooterBytes + 8, sizeof(TocOffset));
+			FMemory::Memcpy(&TocLength, FooterBytes + 16, sizeof(TocLength));
+			FMemory::Memcpy(&TocCrc, FooterBytes + 24, sizeof(TocCrc));
+			FMemory::Memcpy(&FooterCrc, FooterBytes + 28, sizeof(FooterCrc));
+			if (FCrc::MemCrc32(FooterBytes, 28) != FooterCrc
+				|| TocOffset < PackHeaderBytes
+				|| TocLength <= 0
+				|| TocLength > MAX_int32
+				|| TocOffset + TocLength != InFooterOffset)
+			{
+				return false;
+			}
+
+			TArray<uint8> TocBytes;
+			TocBytes.SetNumUninitialized(static_cast<int32>(TocLength));
+			if (!ReadBytes(TocOffset, TocLength, TocBytes.GetData()) || FCrc::MemCrc32(TocBytes.GetData(), TocBytes.Num()) != TocCrc)
+			{
+				return false;
+			}
+
+			const FUTF8ToTCHAR TocText(reinterpret_cast<const ANSICHAR*>(TocBytes.GetData()), TocBytes.Num());
+			TSharedPtr<FJsonObject> TocObject;
+			TSharedRef<TJsonReader<>> TocReader = TJsonReaderFactory<>::Create(FString(TocText.Length(), TocText.Get()));
+			const TArray<TSharedPtr<FJsonValue>>* EntryValues = nullptr;
+			FString SchemaVersion;
+			if (!FJsonSerializer::Deserialize(TocReader, TocObject)
+				|| !TocObject.IsValid()
+				|| !TocObject->TryGetStringField(TEXT("schema_version"), SchemaVersion)
+				|| SchemaVersion != TEXT("dump_pack_toc_v1")
+				|| !TocObject->TryGetArrayField(TEXT("entries"), EntryValues))
+			{
+				return false;
+			}
+
+			TMap<FString, FADumpPackEntry> LoadedEntries;
+			LoadedEntries.Reserve(EntryValues->Num());
+			for (const TSharedPtr<FJsonValue>& EntryValue : *EntryValues)
+			{
+				const TArray<TSharedPtr<FJsonValue>>* EntryRow = nullptr;
+				if (!EntryValue.IsValid() || !EntryValue->TryGetArray(EntryRow) || EntryRow->Num() != 4)
+				{
+					return false;
+				}
+				FADumpPackEntry Entry;
+				double OffsetNumber = 0.0;
+				double LengthNumber = 0.0;
+				double CrcNumber = 0.0;
+				if (!(*EntryRow)[0]->TryGetString(Entry.RelativePath)
+					|| !(*EntryRow)[1]->TryGetNumber(OffsetNumber)
+					|| !(*EntryRow)[2]->TryGetNumber(LengthNumber)
+					|| !(*EntryRow)[3]->TryGetNumber(CrcNumber))
+				{
+					return false;
+				}
+				Entry.Offset = static_cast<int64>(OffsetNumber);
+				Entry.Length = static_cast<int64>(LengthNumber);
+				Entry.Crc = static_cast<uint32>(CrcNumber);
+				if (Entry.RelativePath.IsEmpty() || Entry.Offset < PackHeaderBytes || Entry.Length < 0 || Entry.Offset + Entry.Length > TocOffset)
+				{
+					return false;
+				}
+				const FString EntryKey = Entry.RelativePath;
+				LoadedEntries.Add(EntryKey, MoveTemp(Entry));
+			}
+
+			Entries = MoveTemp(LoadedEntries);
+			Generation = static_cast<int64>(TocObject->GetNumberField(TEXT("generation")));
+			CommittedBytes = InFooterOffset + PackFooterBytes;
+			return true;
+		}
+
+		// LoadLatestToc는 파일 끝 footer부터, 실패하면 역방향으로 마지막 유효 footer를 찾는다.
+		bool LoadLatestToc()
+		{
+			if (FileBytes >= PackHeaderBytes + PackFooterBytes && TryParseFooter(FileBytes - PackFooterBytes))
+			{
+				return true;
+			}
+
+			TArray<uint8> ChunkBytes;
+			int64 ChunkEnd = FileBytes - PackFooterBytes;
+			while (ChunkEnd > PackHeaderBytes)
+			{
+				const int64 ChunkStart = FMath::Max<int64>(PackHeaderBytes, ChunkEnd - PackFooterScanChunkBytes);
+				const int64 ReadEnd = FMath::Min<int64>(FileBytes, ChunkEnd + sizeof(PackFooterMagic) - 1);
+				ChunkBytes.SetNumUninitialized(static_cast<int32>(ReadEnd - ChunkStart));
+				if (!ReadBytes(ChunkStart, ChunkBytes.Num(), ChunkBytes.GetData()))
+				{
+					return false;
+				}
+				for (int64 Candidate = ChunkEnd - 1; Candidate >= ChunkStart; --Candidate)
+				{
+					const int64 LocalOffset = Candidate - ChunkStart;
+					if (LocalOffset + static_cast<int64>(sizeof(PackFooterMagic)) <= ChunkBytes.Num()
+						&& FMemory::Memcmp(ChunkBytes.GetData() + LocalOffset, PackFooterMagic, sizeof(PackFooterMagic)) == 0
+						&& TryParseFooter(Candidate))
+					{
+						return true;
+					}
+				}
+				ChunkEnd = ChunkStart;
+			}
+			return false;
+		}
+
+		// PackFilePath는 열린 pack 절대 경로다.
+		FString PackFilePath;
+
+		// MappedHandle과 MappedRegion은 pack 전체 읽기 전용 mapping이다. region이 handle보다 먼저 해제되도록 이 순서로 둔다.
+		TUniquePtr<IMappedFileHandle> MappedHandle;
+		TUniquePtr<IMappedFileRegion> MappedRegion;
+	};
+
+	// FPackWriterState는 process 안에서 열린 pack 하나의 append handle과 pending TOC다.
+	struct FPackWriterState
+	{
+		FString PackFilePath;
+		TUniquePtr<FArchive> FileWriter;
+		int64 WriteOffset = 0;
+		int64 Generation = 0;
+		TMap<FString, FADumpPackEntry> Entries;
+		bool bDirty = false;
+	};
+
+	// GetPackRegistryLock은 writer/reader registry 공용 lock이다.
+	FCriticalSection& GetPackRegistryLock()
+	{
+		static FCriticalSection RegistryLock;
+		return RegistryLock;
+	}
+
+	// GetPackWriters는 pack 절대 경로별 열린 writer다.
+	TMap<FString, TSharedPtr<FPackWriterState>>& GetPackWriters()
+	{
+		static TMap<FString, TSharedPtr<FPackWriterState>> PackWriters;
+		return PackWriters;
+	}
+
+	// GetPackReaders는 pack 절대 경로별 cached reader다.
+	TMap<FString, TSharedPtr<FPackReader>>& GetPackReaders()
+	{
+		static TMap<FString, TSharedPtr<FPackReader>> PackReaders;
+		return PackReaders;
+	}
+
+	// FPackLookupEntry는 파일 폴더 하나의 pack 조회 결과다. PackFilePath가 비어 있으면 상위 폴더에 pack이 없었다.
+	struct FPackLookupEntry
+	{
+		FString PackFilePath;
+		double CheckedSeconds = 0.0;
+	};
+
+	// GetPackLookups는 파일 폴더 절대 경로별 pack 조회 cache다. writer를 새로 열면 비운다.
+	TMap<FString, FPackLookupEntry>& GetPackLookups()
+	{
+		static TMap<FString, FPackLookupEntry> PackLookups;
+		return PackLookups;
+	}
+
+	// NormalizePackPath는 비교 가능한 '/' 구분 절대 경로를 만든다.
+	FString NormalizePackPath(const FString& InPath)
+	{
+		FString FullPath = FPaths::ConvertRelativePathToFull(InPath);
+		FPaths::NormalizeFilename(FullPath);
+		FPaths::RemoveDuplicateSlashes(FullPath);
+		return FullPath;
+	}
+
+	// MakePackStamp는 pack 파일 크기와 수정 시각 stamp다.
+	FString MakePackStamp(const FString& InPackFilePath)
+	{
+		const FFileStatData StatData = IFileManager::Get().GetStatData(*InPackFilePath);
+		return StatData.bIsValid
+			? FString::Printf(TEXT("%lld|%s"), StatData.FileSize, *StatData.ModificationTime.ToIso8601())
+			: FString();
+	}
+
+	// IsSafePackRelativePath는 export와 append 대상 상대 경로가 pack 폴더를 벗어나지 않는지 검사한다.
+	bool IsSafePackRelativePath(const FString& InRelativePath)
+	{
+		if (InRelativePath.IsEmpty() || InRelativePath.StartsWith(TEXT("/")) || InRelativePath.Contains(TEXT(":")))
+		{
+			return false;
+		}
+		TArray<FString> PathParts;
+		InRelativePath.ParseIntoArray(PathParts, TEXT("/"), true);
+		for (const FString& PathPart : PathParts)
+		{
+			if (PathPart == TEXT("..") || PathPart == TEXT("."))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// MakePackRelativePath는 pack 폴더 아래 파일의 상대 경로를 만든다.
+	bool MakePackRelativePath(const FString& InPackFilePath, const FString& InFilePath, FString& OutRelativePath)
+	{
+		const FString PackDirectory = FPaths::GetPath(InPackFilePath) + TEXT("/");
+		const FString FullFilePath = NormalizePackPath(InFilePath);
+		if (!FullFilePath.StartsWith(PackDirectory))
+		{
+			return false;
+		}
+		OutRelativePath = FullFilePath.RightChop(PackDirectory.Len());
+		return IsSafePackRelativePath(OutRelativePath);
+	}
+
+	// FindPackForFile은 InFilePath의 상위 폴더를 올라가며 열린 writer 또는 pack 파일을 찾는다. 폴더별 결과는 cache한다.
+	bool FindPackForFile(const FString& InFilePath, FString& OutPackFilePath, FString& OutRelativePath)
+	{
+		const FString FullFilePath = NormalizePackPath(InFilePath);
+		const FString FileDirectoryPath = FPaths::GetPath(FullFilePath);
+		const double NowSeconds = FPlatformTime::Seconds();
+
+		// PackFilePath는 찾은 pack 경로다. cache가 없거나 miss 결과가 만료되었을 때만 상위 폴더를 올라간다.
+		FString PackFilePath;
+		bool bCached = false;
+		{
+			FScopeLock RegistryScope(&GetPackRegistryLock());
+			if (const FPackLookupEntry* LookupEntry = GetPackLookups().Find(FileDirectoryPath))
+			{
+				if (!LookupEntry->PackFilePath.IsEmpty() || NowSeconds - LookupEntry->CheckedSeconds < PackLookupMissCacheSeconds)
+				{
+					PackFilePath = LookupEntry->PackFilePath;
+					bCached = true;
+				}
+			}
+		}
+
+		if (!bCached)
+		{
+			FString DirectoryPath = FileDirectoryPath;
+			while (!DirectoryPath.IsEmpty())
+			{
+				const FString CandidatePackPath = DirectoryPath / PackFileName;
+				bool bHasWriter = false;
+				{
+					FScopeLock RegistryScope(&GetPackRegistryLock());
+					bHasWriter = GetPackWriters().Contains(CandidatePackPath);
+				}
+				if (bHasWriter || IFileManager::Get().FileExists(*CandidatePackPath))
+				{
+					PackFilePath = CandidatePackPath;
+					break;
+				}
+
+				const FString ParentPath = FPaths::GetPath(DirectoryPath);
+				if (ParentPath == DirectoryPath)
+				{
+					break;
+				}
+				DirectoryPath = ParentPath;
+			}
+
+			FScopeLock RegistryScope(&GetPackRegistryLock());
+			FPackLookupEntry& LookupEntry = GetPackLookups().FindOrAdd(FileDirectoryPath);
+			LookupEntry.PackFilePath = PackFilePath;
+			LookupEntry.CheckedSeconds = NowSeconds;
+		}
+
+		if (PackFilePath.IsEmpty())
+		{
+			return false;
+		}
+		OutPackFilePath = PackFilePath;
+		OutRelativePath = FullFilePath.RightChop(FPaths::GetPath(PackFilePath).Len() + 1);
+		return true;
+	}
+
+	// GetCachedPackReader는 stamp가 같은 cached reader를 재사용하고 달라졌으면 다시 연다.
+	TSharedPtr<FPackReader> GetCachedPackReader(const FString& InPackFilePath)
+	{
+		const FString Stamp = MakePackStamp(InPackFilePath);
+		if (Stamp.IsEmpty())
+		{
+			return nullptr;
+		}
+
+		{
+			FScopeLock RegistryScope(&GetPackRegistryLock());
+			if (const TSharedPtr<FPackReader>* CachedReader = GetPackReaders().Find(InPackFilePath))
+			{
+				if ((*CachedReader)->Stamp == Stamp)
+				{
+					return *CachedReader;
+				}
+			}
+		}
+
+		TSharedPtr<FPackReader> PackReader = MakeShared<FPackReader>();
+		FString ErrorCode;
+		FString ErrorDetail;
+		if (!PackReader->Open(InPackFilePath, ErrorCode, ErrorDetail))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s: %s"), *ErrorCode, *ErrorDetail);
+			return nullptr;
+		}
+		PackReader->Stamp = Stamp;
+
+		FScopeLock RegistryScope(&GetPackRegistryLock());
+		GetPackReaders().Add(InPackFilePath, PackReader);
+		return PackReader;
+	}
+
+	// FindPackEntry는 열린 writer(pending 포함)를 우선하고 없으면 commit된 reader TOC에서 entry를 찾는다.
+	bool FindPackEntry(const FString& InPackFilePath, const FString& InRelativePath, FADumpPackEntry& OutEntry, TSharedPtr<FPackWriterState>& OutWriter, TSharedPtr<FPackReader>& OutReader)
+	{
+		{
+			FScopeLock RegistryScope(&GetPackRegistryLock());
+			if (const TSharedPtr<FPackWriterState>* Writer = GetPackWriters().Find(InPackFilePath))
+			{
+				const FADumpPackEntry* WriterEntry = (*Writer)->Entries.Find(InRelativePath);
+				if (!WriterEntry)
+				{
+					return false;
+				}
+				OutEntry = *WriterEntry;
+				OutWriter = *Writer;
+				return true;
+			}
+		}
+
+		OutReader = GetCachedPackReader(InPackFilePath);
+		const FADumpPackEntry* ReaderEntry = OutReader.IsValid() ? OutReader->Entries.Find(InRelativePath) : nullptr;
+		if (!ReaderEntry)
+		{
+			return false;
+		}
+		OutEntry = *ReaderEntry;
+		return true;
+	}
+
+	// OpenPackWriter는 기존 TOC를 이어받는 append writer를 만든다. 호출자는 registry lock을 잡고 있어야 한다.
+	TSharedPtr<FPackWriterState> OpenPackWriter(const FString& InPackFilePath, FString& OutErrorCode, FString& OutErrorDetail)
+	{
+		if (const TSharedPtr<FPackWriterState>* ExistingWriter = GetPackWriters().Find(InPackFilePath))
+		{
+			return *ExistingWriter;
+		}
+
+		TSharedPtr<FPackWriterState> Writer = MakeShared<FPackWriterState>();
+		Writer->PackFilePath = InPackFilePath;
+		const bool bPackExists = IFileManager::Get().FileExists(*InPackFilePath);
+		if (bPackExists)
+		{
+			FPackReader ExistingReader;
+			if (!ExistingReader.Open(InPackFilePath, OutErrorCode, OutErrorDetail))
+			{
+				return nullptr;
+			}
+			Writer->Entries = MoveTemp(ExistingReader.Entries);
+			Writer->Generation = ExistingReader.Generation;
+		}
+		else if (!IFileManager::Get().MakeDirectory(*FPaths::GetPath(InPackFilePath), true))
+		{
+			OutErrorCode = TEXT("ADUMP_PACK_WRITE_FAILED");
+			OutErrorDetail = FString::Printf(TEXT("Failed to create pack directory: %s"), *FPaths::GetPath(InPackFilePath));
+			return nullptr;
+		}
+
+		// mapping이 잡힌 채 append하지 않도록 이 pack의 cached reader를 먼저 버린다.
+		GetPackReaders().Remove(InPackFilePath);
+
+		Writer->FileWriter.Reset(IFileManager::Get().CreateFileWriter(*InPackFilePath, FILEWRITE_Append | FILEWRITE_AllowRead));
+		if (!Writer->FileWriter.IsValid())
+		{
+			OutErrorCode = TEXT("ADUMP_PACK_WRITE_FAILED");
+			OutErrorDetail = FString::Printf(TEXT("Failed to open pack for append: %s"), *InPackFilePath);
+			return nullptr;
+		}
+		if (!bPackExists)
+		{
+			Writer->FileWriter->Serialize(const_cast<uint8*>(PackHeaderMagic), PackHeaderBytes);
+		}
+		Writer->WriteOffset = Writer->FileWriter->TotalSize();
+
+		GetPackWriters().Add(InPackFilePath, Writer);
+
+		// 새 pack이 기존 조회 결과보다 가까운 폴더에 생겼을 수 있으므로 폴더별 조회 cache를 비운다.
+		GetPackLookups().Reset();
+		return Writer;
+	}
+
+	// CommitPackWriter는 TOC JSON과 footer를 append하고 flush한다. 호출자는 registry lock을 잡고 있어야 한다.
+	bool CommitPackWriter(FPackWriterState& InOutWriter, FString& OutErrorCode, FString& OutErrorDetail)
+	{
+		if (!InOutWriter.bDirty)
+		{
+			return true;
+		}
+
+		TArray<FString> RelativePaths;
+		InOutWriter.Entries.GetKeys(RelativePaths);
+		RelativePaths.Sort();
+
+		TArray<TSharedPtr<FJsonValue>> EntryValues;
+		EntryValues.Reserve(RelativePaths.Num());
+		for (const FString& RelativePath : RelativePaths)
+		{
+			const FADumpPackEntry& Entry = InOutWriter.Entries.FindChecked(RelativePath);
+			TArray<TSharedPtr<FJsonValue>> EntryRow;
+			EntryRow.Add(MakeShared<FJsonValueString>(Entry.RelativePath));
+			EntryRow.Add(MakeShared<FJsonValueNumber>(static_cast<double>(Entry.Offset)));
+			EntryRow.Add(MakeShared<FJsonValueNumber>(static_cast<double>(Entry.Length)));
+			EntryRow.Add(MakeShared<FJsonValueNumber>(static_cast<double>(Entry.Crc)));
+			EntryValues.Add(MakeShared<FJsonValueArray>(EntryRow));
+		}
+
+		TSharedRef<FJsonObject> TocObject = MakeShared<FJsonObject>();
+		TocObject->SetStringField(TEXT("schema_version"), TEXT("dump_pack_toc_v1"));
+		TocObject->SetNumberField(TEXT("generation"), static_cast<double>(InOutWriter.Generation + 1));
+		TocObject->SetNumberField(TEXT("entry_count"), EntryValues.Num());
+		TocObject->SetArrayField(TEXT("entries"), EntryValues);
+
+		FString TocText;
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> TocWriter =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&TocText);
+		if (!FJsonSerializer::Serialize(TocObject, TocWriter))
+		{
+			OutErrorCode = TEXT("ADUMP_PACK_WRITE_FAILED");
+			OutErrorDetail = TEXT("Failed to serialize pack TOC.");
+			return false;
+		}
+
+		const FTCHARToUTF8 TocUtf8(*TocText);
+		const int64 TocOffset = InOutWriter.WriteOffset;
+		const int64 TocLength = TocUtf8.Length();
+		const uint32 TocCrc = FCrc::MemCrc32(TocUtf8.Get(), TocUtf8.Length());
+
+		uint8 FooterBytes[PackFooterBytes];
+		FMemory::Memcpy(FooterBytes, PackFooterMagic, sizeof(PackFooterMagic));
+		FMemory::Memcpy(FooterBytes + 8, &TocOffset, sizeof(TocOffset));
+		FMemory::Memcpy(FooterBytes + 16, &TocLength, sizeof(TocLength));
+		FMemory::Memcpy(FooterBytes + 24, &TocCrc, sizeof(TocCrc));
+		const uint32 FooterCrc = FCrc::MemCrc32(FooterBytes, 28);
+		FMemory::Memcpy(FooterBytes + 28, &FooterCrc, sizeof(FooterCrc));
+
+		// footer가 마지막 write이므로 중간에 끊기면 reader는 이전 footer의 TOC를 최신으로 본다.
+		InOutWriter.FileWriter->Serialize(const_cast<ANSICHAR*>(TocUtf8.Get()), TocLength);
+		InOutWriter.FileWriter->Serialize(FooterBytes, PackFooterBytes);
+		InOutWriter.FileWriter->Flush();
+		if (InOutWriter.FileWriter->IsError())
+		{
+			OutErrorCode = TEXT("ADUMP_PACK_WRITE_FAILED");
+			OutErrorDetail = FString::Printf(TEXT("Failed to append pack TOC: %s"), *InOutWriter.PackFilePath);
+			return false;
+		}
+
+		InOutWriter.WriteOffset += TocLength + PackFooterBytes;
+		++InOutWriter.Generation;
+		InOutWriter.bDirty = false;
+		return true;
+	}
+}
+
+namespace ADumpPack
+{
+	const TCHAR* GetPackFileName()
+	{
+		return PackFileName;
+	}
+
+	bool AppendPackedFile(
+		const FString& InPackFilePath,
+		const FString& InFilePath,
+		const TArray<uint8>& InBytes,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+
+		const FString PackFilePath = NormalizePackPath(InPackFilePath);
+		FString RelativePath;
+		if (!MakePackRelativePath(PackFilePath, InFilePath, RelativePath))
+		{
+			OutErrorCode = TEXT("ADUMP_PACK_PATH_OUTSIDE_ROOT");
+			OutErrorDetail = FString::Printf(TEXT("Output path is not under the pack directory: %s"), *InFilePath);
+			return false;
+		}
+
+		FScopeLock RegistryScope(&GetPackRegistryLock());
+		TSharedPtr<FPackWriterState> Writer = OpenPackWriter(PackFilePath, OutErrorCode, OutErrorDetail);
+		if (!Writer.IsValid())
+		{
+			return false;
+		}
+
+		Writer->FileWriter->Serialize(const_cast<uint8*>(InBytes.GetData()), InBytes.Num());
+		if (Writer->FileWriter->IsError())
+		{
+			OutErrorCode = TEXT("ADUMP_PACK_WRITE_FAILED");
+			OutErrorDetail = FString::Printf(TEXT("Failed to append %s to pack: %s"), *RelativePath, *PackFilePath);
+			return false;
+		}
+
+		FADumpPackEntry& Entry = Writer->Entries.FindOrAdd(RelativePath);
+		Entry.RelativePath = RelativePath;
+		Entry.Offset = Writer->WriteOffset;
+		Entry.Length = InBytes.Num();
+		Entry.Crc = FCrc::MemCrc32(InBytes.GetData(), InBytes.Num());
+		Writer->WriteOffset += InBytes.Num();
+		Writer->bDirty = true;
+		return true;
+	}
+
+	bool CommitPack(const FString& InPackFilePath, FString& OutErrorCode, FString& OutErrorDetail)
+	{
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+
+		FScopeLock RegistryScope(&GetPackRegistryLock());
+		const TSharedPtr<FPackWriterState>* Writer = GetPackWriters().Find(NormalizePackPath(InPackFilePath));
+		return !Writer || CommitPackWriter(**Writer, OutErrorCode, OutErrorDetail);
+	}
+
+	bool RemovePackedDirectory(
+		const FString& InPackFilePath,
+		const FString& InDirectoryPath,
+		int32& OutRemovedFileCount,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutRemovedFileCount = 0;
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+
+		const FString PackFilePath = NormalizePackPath(InPackFilePath);
+		FString RelativeDirectoryPath;
+		if (!MakePackRelativePath(PackFilePath, InDirectoryPath, RelativeDirectoryPath))
+		{
+			OutErrorCode = TEXT("ADUMP_PACK_PATH_OUTSIDE_ROOT");
+			OutErrorDetail = FString::Printf(TEXT("Directory path is not under the pack directory: %s"), *InDirectoryPath);
+			return false;
+		}
+
+		FScopeLock RegistryScope(&GetPackRegistryLock());
+		// pack이 없으면 뺄 항목도 없다. 빈 pack을 새로 만들지 않도록 writer를 열기 전에 확인한다.
+		if (!GetPackWriters().Contains(PackFilePath) && !IFileManager::Get().FileExists(*PackFilePath))
+		{
+			return true;
+		}
+
+		TSharedPtr<FPackWriterState> Writer = OpenPackWriter(PackFilePath, OutErrorCode, OutErrorDetail);
+		if (!Writer.IsValid())
+		{
+			return false;
+		}
+
+		// RelativePrefix는 같은 이름으로 시작하는 형제 폴더를 지우지 않도록 '/'까지 포함한다.
+		RelativeDirectoryPath.RemoveFromEnd(TEXT("/"));
+		const FString RelativePrefix = RelativeDirectoryPath + TEXT("/");
+		for (auto EntryIt = Writer->Entries.CreateIterator(); EntryIt; ++EntryIt)
+		{
+			if (EntryIt.Key().StartsWith(RelativePrefix))
+			{
+				EntryIt.RemoveCurrent();
+				++OutRemovedFileCount;
+			}
+		}
+		if (OutRemovedFileCount > 0)
+		{
+			Writer->bDirty = true;
+		}
+		return true;
+	}
+
+	bool ClosePack(const FString& InPackFilePath, FString& OutErrorCode, FString& OutErrorDetail)
+	{
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+
+		const FString PackFilePath = NormalizePackPath(InPackFilePath);
+		FScopeLock RegistryScope(&GetPackRegistryLock());
+		const TSharedPtr<FPackWriterState>* Writer = GetPackWriters().Find(PackFilePath);
+		if (!Writer)
+		{
+			return true;
+		}
+
+		const bool bCommitted = CommitPackWriter(**Writer, OutErrorCode, OutErrorDetail);
+		(*Writer)->FileWriter->Close();
+		GetPackWriters().Remove(PackFilePath);
+		return bCommitted;
+	}
+
+	bool TryLoadPackedFile(const FString& InFilePath, TArray<uint8>& OutBytes)
+	{
+		OutBytes.Reset();
+
+		FString PackFilePath;
+		FString RelativePath;
+		FADumpPackEntry Entry;
+		TSharedPtr<FPackWriterState> Writer;
+		TSharedPtr<FPackReader> Reader;
+		if (!FindPackForFile(InFilePath, PackFilePath, RelativePath)
+			|| !FindPackEntry(PackFilePath, RelativePath, Entry, Writer, Reader))
+		{
+			return false;
+		}
+		if (Reader.IsValid())
+		{
+			return Reader->ReadEntry(Entry, OutBytes);
+		}
+
+		// 열린 writer의 pending entry는 flush 후 별도 handle로 읽는다.
+		FScopeLock RegistryScope(&GetPackRegistryLock());
+		Writer->FileWriter->Flush();
+		TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*PackFilePath, FILEREAD_Silent | FILEREAD_AllowWrite));
+		if (!FileReader.IsValid() || Entry.Length > MAX_int32 || Entry.Offset + Entry.Length > FileReader->TotalSize())
+		{
+			return false;
+		}
+		OutBytes.SetNumUninitialized(static_cast<int32>(Entry.Length));
+		FileReader->Seek(Entry.Offset);
+		FileReader->Serialize(OutBytes.GetData(), Entry.Length);
+		if (FileReader->IsError() || FCrc::MemCrc32(OutBytes.GetData(), OutBytes.Num()) != Entry.Crc)
+		{
+			OutBytes.Reset();
+			return false;
+		}
+		return true;
+	}
+
+	bool TryGetPackedFileStat(const FString& InFilePath, int64& OutFileBytes, FString& OutStampText)
+	{
+		OutFileBytes = -1;
+		OutStampText.Reset();
+
+		FString PackFilePath;
+		FString RelativePath;
+		FADumpPackEntry Entry;
+		TSharedPtr<FPackWriterState> Writer;
+		TSharedPtr<FPackReader> Reader;
+		if (!FindPackForFile(InFilePath, PackFilePath, RelativePath)
+			|| !FindPackEntry(PackFilePath, RelativePath, Entry, Writer, Reader))
+		{
+			return false;
+		}
+		OutFileBytes = Entry.Length;
+		OutStampText = FString::Printf(TEXT("pack:%08x"), Entry.Crc);
+		return true;
+	}
+
+	bool HasPackedFile(const FString& InFilePath)
+	{
+		int64 FileBytes = -1;
+		FString StampText;
+		return TryGetPackedFileStat(InFilePath, FileBytes, StampText);
+	}
+
+	void FindPackedFiles(const FString& InRootPath, const FString& InFileNameWildcard, TArray<FString>& OutFilePaths)
+	{
+		const FString RootPath = NormalizePackPath(InRootPath);
+		FString PackFilePath;
+		FString RootRelativePath;
+		if (!FindPackForFile(RootPath / PackFileName, PackFilePath, RootRelativePath))
+		{
+			return;
+		}
+
+		const FString PackDirectory = FPaths::GetPath(PackFilePath);
+		TArray<FString> RelativePaths;
+		{
+			FScopeLock RegistryScope(&GetPackRegistryLock());
+			if (const TSharedPtr<FPackWriterState>* Writer = GetPackWriters().Find(PackFilePath))
+			{
+				(*Writer)->Entries.GetKeys(RelativePaths);
+			}
+		}
+		if (RelativePaths.IsEmpty())
+		{
+			const TSharedPtr<FPackReader> Reader = GetCachedPackReader(PackFilePath);
+			if (Reader.IsValid())
+			{
+				Reader->Entries.GetKeys(RelativePaths);
+			}
+		}
+
+		const FString RootPrefix = RootPath + TEXT("/");
+		for (const FString& RelativePath : RelativePaths)
+		{
+			const FString FilePath = PackDirectory / RelativePath;
+			if (FilePath.StartsWith(RootPrefix)
+				&& FPaths::GetCleanFilename(RelativePath).MatchesWildcard(InFileNameWildcard)
+				&& !IFileManager::Get().FileExists(*FilePath))
+			{
+				OutFilePaths.Add(FilePath);
+			}
+		}
+	}
+
+	bool ExportPackToDirectory(
+		const FString& InPackFilePath,
+		const FString& InOutputDirectoryPath,
+		int32& OutExportedFileCount,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutExportedFileCount = 0;
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+
+		const FString PackFilePath = NormalizePackPath(InPackFilePath);
+		if (!CommitPack(PackFilePath, OutErrorCode, OutErrorDetail))
+		{
+			return false;
+		}
+
+		FPackReader PackReader;
+		if (!PackReader.Open(PackFilePath, OutErrorCode, OutErrorDetail))
+		{
+			return false;
+		}
+
+		TArray<FString> RelativePaths;
+		PackReader.Entries.GetKeys(RelativePaths);
+		RelativePaths.Sort();
+
+		const FString OutputDirectoryPath = NormalizePackPath(InOutputDirectoryPath);
+		TArray<uint8> EntryBytes;
+		for (const FString& RelativePath : RelativePaths)
+		{
+			if (!IsSafePackRelativePath(RelativePath))
+			{
+				OutErrorCode = TEXT("ADUMP_PACK_ENTRY_PATH_INVALID");
+				OutErrorDetail = FString::Printf(TEXT("Pack entry path escapes the export directory: %s"), *RelativePath);
+				return false;
+			}
+			if (!PackReader.ReadEntry(PackReader.Entries.FindChecked(RelativePath), EntryBytes))
+			{
+				OutErrorCode = TEXT("ADUMP_PACK_ENTRY_CRC_MISMATCH");
+				OutErrorDetail = FString::Printf(TEXT("Pack entry could not be read or failed CRC32: %s"), *RelativePath);
+				return false;
+			}
+
+			const FString FinalFilePath = OutputDirectoryPath / RelativePath;
+			const FString TempFilePath = FinalFilePath + TEXT(".tmp");
+			if (!IFileManager::Get().MakeDirectory(*FPaths::GetPath(FinalFilePath), true)
+				|| !FFileHelper::SaveArrayToFile(EntryBytes, *TempFilePath)
+				|| !IFileManager::Get().Move(*FinalFilePath, *TempFilePath, true, true, false, false))
+			{
+				OutErrorCode = TEXT("ADUMP_PACK_EXPORT_WRITE_FAILED");
+				OutErrorDetail = FString::Printf(TEXT("Failed to export pack entry: %s"), *FinalFilePath);
+				return false;
+			}
+			++OutExportedFileCount;
+		}
+		return true;
+	}
+}
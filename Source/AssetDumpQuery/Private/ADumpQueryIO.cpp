@@ -0,0 +1,660 @@
+// File: ADumpQueryIO.cpp
+// Version: v1.2.0
+// Changelog:
+// - v1.2.0: 파일 stamp cache가 같이 쓰는 MakeJsonFileStamp를 추가.
+// - v1.1.0: sidecar 읽기/존재/stat이 상위 pack보다 manifest content_refs(content store)를 먼저 보고, stat은 manifest content_sizes의 복원 byte 수를 써서 sidecar를 다시 만들지 않음.
+// - v1.0.0: ADumpJson의 JSON 읽기/content store sidecar 복원/value span/원자 저장 구현을 그대로 옮기고 등록형 기본 dump root를 추가.
+
+#include "ADumpQueryIO.h"
+
+#include "ADumpContentStore.h"
+#include "ADumpPack.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMisc.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	// DefaultDumpRootLock은 기본 dump root 등록과 조회를 보호한다.
+	FCriticalSection DefaultDumpRootLock;
+
+	// RegisteredDefaultDumpRootDirectory는 host module이 등록한 기본 dump root다. 비어 있으면 실행 폴더 기준 Dumped를 쓴다.
+	FString RegisteredDefaultDumpRootDirectory;
+
+	// NormalizeQueryOutputPath는 경로를 절대 경로 기준으로 정규화한다.
+	FString NormalizeQueryOutputPath(const FString& InOutputPath)
+	{
+		if (InOutputPath.IsEmpty())
+		{
+			return FString();
+		}
+
+		FString FullOutputPath = FPaths::ConvertRelativePathToFull(InOutputPath);
+		FPaths::NormalizeFilename(FullOutputPath);
+		return FullOutputPath;
+	}
+
+	// SerializeCondensedJsonObjectText는 복원한 sidecar root를 저장 형식과 같은 condensed JSON으로 직렬화한다.
+	bool SerializeCondensedJsonObjectText(const TSharedRef<FJsonObject>& InRootObject, FString& OutJsonText)
+	{
+		OutJsonText.Reset();
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutJsonText);
+		return FJsonSerializer::Serialize(InRootObject, JsonWriter);
+	}
+
+	// FContentStoreManifestRefs는 manifest stamp 기준으로 재사용하는 content_refs 해석 결과다. 참조가 없는 manifest도 빈 map으로 기억한다.
+	struct FContentStoreManifestRefs
+	{
+		// StampText는 manifest byte 수와 수정 시각 또는 pack stamp다.
+		FString StampText;
+
+		// StoreRootPath는 manifest content_store를 정규화한 store root다.
+		FString StoreRootPath;
+
+		// ContentHashByFileName은 sidecar 파일명별 content hash다.
+		TMap<FString, FString> ContentHashByFileName;
+
+		// ContentBytesByFileName은 manifest content_sizes의 sidecar 파일명별 복원 byte 수다. 이전 manifest에는 없다.
+		TMap<FString, int64> ContentBytesByFileName;
+	};
+
+	// ContentStoreManifestRefsLock은 manifest 참조 cache를 병렬 index/query 읽기에서 보호한다.
+	FCriticalSection ContentStoreManifestRefsLock;
+
+	// ContentStoreManifestRefsByPath는 manifest 경로별 content_refs cache다. 공통 필드 object는 크기 때문에 cache하지 않는다.
+	TMap<FString, FContentStoreManifestRefs> ContentStoreManifestRefsByPath;
+
+	// LoadContentStoreManifestObject는 sibling manifest를 pack/gzip 투명 읽기로 parse한다.
+	bool LoadContentStoreManifestObject(const FString& InManifestFilePath, TSharedPtr<FJsonObject>& OutManifestObject)
+	{
+		OutManifestObject.Reset();
+		FString ManifestText;
+		if (!ADumpQueryIO::LoadJsonTextFromFile(InManifestFilePath, ManifestText))
+		{
+			return false;
+		}
+
+		TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(ManifestText);
+		return FJsonSerializer::Deserialize(JsonReader, OutManifestObject) && OutManifestObject.IsValid();
+	}
+
+	// TryResolveContentStoreSidecar는 sidecar 경로의 sibling manifest content_refs에서 store root와 hash를 찾는다. OutContentBytes는 기록된 복원 byte 수이며 없으면 -1이다.
+	bool TryResolveContentStoreSidecar(const FString& InFilePath, FString& OutManifestFilePath, FString& OutStoreRootPath, FString& OutContentHash, FString& OutManifestStampText, int64& OutContentBytes)
+	{
+		OutContentBytes = -1;
+		const FString FileName = FPaths::GetCleanFilename(InFilePath);
+		if (!ADumpQueryIO::IsContentStoreSidecarFileName(FileName))
+		{
+			return false;
+		}
+
+		OutManifestFilePath = FPaths::Combine(FPaths::GetPath(InFilePath), TEXT("manifest.json"));
+		int64 ManifestFileBytes = 0;
+		FString ManifestStampText;
+		if (!ADumpQueryIO::GetJsonFileStat(OutManifestFilePath, ManifestFileBytes, ManifestStampText))
+		{
+			return false;
+		}
+		OutManifestStampText = FString::Printf(TEXT("%lld|%s"), ManifestFileBytes, *ManifestStampText);
+
+		auto FindCachedHash = [&]()
+		{
+			const FContentStoreManifestRefs* CachedRefs = ContentStoreManifestRefsByPath.Find(OutManifestFilePath);
+			if (CachedRefs == nullptr || CachedRefs->StampText != OutManifestStampText)
+			{
+				return false;
+			}
+			const FString* ContentHash = CachedRefs->ContentHashByFileName.Find(FileName);
+			const int64* ContentBytes = CachedRefs->ContentBytesByFileName.Find(FileName);
+			OutStoreRootPath = CachedRefs->StoreRootPath;
+			OutContentHash = ContentHash != nullptr ? *ContentHash : FString();
+			OutContentBytes = ContentBytes != nullptr ? *ContentBytes : -1;
+			return true;
+		};
+
+		{
+			FScopeLock CacheLock(&ContentStoreManifestRefsLock);
+			if (FindCachedHash())
+			{
+				return !OutContentHash.IsEmpty();
+			}
+		}
+
+		FContentStoreManifestRefs ManifestRefs;
+		ManifestRefs.StampText = OutManifestStampText;
+		TSharedPtr<FJsonObject> ManifestObject;
+		if (LoadContentStoreManifestObject(OutManifestFilePath, ManifestObject))
+		{
+			FString ContentStoreText;
+			const TSharedPtr<FJsonObject>* ContentRefsObject = nullptr;
+			if (ManifestObject->TryGetStringField(TEXT("content_store"), ContentStoreText)
+				&& ManifestObject->TryGetObjectField(TEXT("content_refs"), ContentRefsObject)
+				&& ContentRefsObject && ContentRefsObject->IsValid())
+			{
+				ManifestRefs.StoreRootPath = ADumpContentStore::ResolveManifestStoreRootPath(OutManifestFilePath, ContentStoreText);
+				for (const TPair<FString, TSharedPtr<FJsonValue>>& RefPair : (*ContentRefsObject)->Values)
+				{
+					FString ContentHash;
+					if (RefPair.Value.IsValid() && RefPair.Value->TryGetString(ContentHash) && ADumpContentStore::IsValidContentHash(ContentHash))
+					{
+						ManifestRefs.ContentHashByFileName.Add(RefPair.Key, ContentHash);
+					}
+				}
+
+				const TSharedPtr<FJsonObject>* ContentSizesObject = nullptr;
+				if (ManifestObject->TryGetObjectField(TEXT("content_sizes"), ContentSizesObject) && ContentSizesObject && ContentSizesObject->IsValid())
+				{
+					for (const TPair<FString, TSharedPtr<FJsonValue>>& SizePair : (*ContentSizesObject)->Values)
+					{
+						double ContentBytesNumber = -1.0;
+						if (SizePair.Value.IsValid() && SizePair.Value->TryGetNumber(ContentBytesNumber) && ContentBytesNumber >= 0.0)
+						{
+							ManifestRefs.ContentBytesByFileName.Add(SizePair.Key, static_cast<int64>(ContentBytesNumber));
+						}
+					}
+				}
+			}
+		}
+
+		FScopeLock CacheLock(&ContentStoreManifestRefsLock);
+		ContentStoreManifestRefsByPath.Add(OutManifestFilePath, MoveTemp(ManifestRefs));
+		FindCachedHash();
+		return !OutContentHash.IsEmpty() && !OutStoreRootPath.IsEmpty();
+	}
+
+	// TryLoadContentStoreSidecar는 manifest content_common과 hash 검증한 blob payload를 합쳐 원래 sidecar JSON byte를 복원한다.
+	bool TryLoadContentStoreSidecar(const FString& InFilePath, TArray<uint8>& OutBytes)
+	{
+		OutBytes.Reset();
+		FString ManifestFilePath;
+		FString StoreRootPath;
+		FString ContentHash;
+		FString ManifestStampText;
+		int64 ContentBytes = -1;
+		if (!TryResolveContentStoreSidecar(InFilePath, ManifestFilePath, StoreRootPath, ContentHash, ManifestStampText, ContentBytes))
+		{
+			return false;
+		}
+
+		TArray<uint8> StoredBytes;
+		TArray<uint8> PayloadBytes;
+		if (!ADumpContentStore::TryLoadContent(StoreRootPath, ContentHash, StoredBytes))
+		{
+			return false;
+		}
+		if (!ADumpQueryIO::IsCompressedJsonBytes(StoredBytes))
+		{
+			PayloadBytes = MoveTemp(StoredBytes);
+		}
+		else if (!ADumpQueryIO::DecompressJsonBytes(StoredBytes, PayloadBytes))
+		{
+			return false;
+		}
+		if (ADumpContentStore::BuildContentHash(PayloadBytes) != ContentHash)
+		{
+			return false;
+		}
+
+		TSharedPtr<FJsonObject> ManifestObject;
+		if (!LoadContentStoreManifestObject(ManifestFilePath, ManifestObject))
+		{
+			return false;
+		}
+
+		FString PayloadText;
+		FFileHelper::BufferToString(PayloadText, PayloadBytes.GetData(), PayloadBytes.Num());
+		TSharedPtr<FJsonObject> PayloadObject;
+		TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(PayloadText);
+		if (!FJsonSerializer::Deserialize(JsonReader, PayloadObject) || !PayloadObject.IsValid())
+		{
+			return false;
+		}
+
+		// SidecarObject는 저장 전과 같은 순서(공통 필드 뒤 section payload)의 sidecar root다.
+		TSharedRef<FJsonObject> SidecarObject = MakeShared<FJsonObject>();
+		const TSharedPtr<FJsonObject>* CommonObject = nullptr;
+		if (ManifestObject->TryGetObjectField(TEXT("content_common"), CommonObject) && CommonObject && CommonObject->IsValid())
+		{
+			SidecarObject->Values = (*CommonObject)->Values;
+		}
+		for (const TPair<FString, TSharedPtr<FJsonValue>>& PayloadPair : PayloadObject->Values)
+		{
+			SidecarObject->SetField(PayloadPair.Key, PayloadPair.Value);
+		}
+
+		FString SidecarText;
+		if (!SerializeCondensedJsonObjectText(SidecarObject, SidecarText))
+		{
+			return false;
+		}
+		const FTCHARToUTF8 SidecarUtf8(*SidecarText);
+		OutBytes.Append(reinterpret_cast<const uint8*>(SidecarUtf8.Get()), SidecarUtf8.Length());
+		return true;
+	}
+}
+
+namespace ADumpQueryIO
+{
+	void SetDefaultDumpRootDirectory(const FString& InDumpRootDirectory)
+	{
+		FScopeLock DefaultRootLock(&DefaultDumpRootLock);
+		RegisteredDefaultDumpRootDirectory = NormalizeQueryOutputPath(InDumpRootDirectory);
+	}
+
+	FString BuildDefaultDumpRootDirectory()
+	{
+		const FString EnvironmentOutputRoot = FPlatformMisc::GetEnvironmentVariable(TEXT("ASSETDUMP_OUTPUT_ROOT"));
+		if (!EnvironmentOutputRoot.IsEmpty())
+		{
+			return NormalizeQueryOutputPath(EnvironmentOutputRoot);
+		}
+
+		{
+			FScopeLock DefaultRootLock(&DefaultDumpRootLock);
+			if (!RegisteredDefaultDumpRootDirectory.IsEmpty())
+			{
+				return RegisteredDefaultDumpRootDirectory;
+			}
+		}
+
+		// 독립 query program은 플러그인 관리자가 없으므로 플러그인 루트에서 실행한다고 보고 <실행 폴더>/Dumped를 쓴다.
+		return NormalizeQueryOutputPath(FPaths::Combine(FPaths::LaunchDir(), TEXT("Dumped")));
+	}
+
+	FString BuildTempOutputFilePath(const FString& FinalOutputFilePath)
+	{
+		const FString DirectoryPath = FPaths::GetPath(FinalOutputFilePath);
+		const FString FinalFileName = FPaths::GetCleanFilename(FinalOutputFilePath);
+		const FString BaseFileName = FPaths::GetBaseFilename(FinalFileName, false);
+		const FString TempFileName = FString::Printf(TEXT("%s.tmp.json"), *BaseFileName);
+		return FPaths::Combine(DirectoryPath, TempFileName);
+	}
+
+	bool SaveJsonTextToFile(const FString& FinalOutputFilePath, const FString& JsonText, FString& OutErrorMessage)
+	{
+		OutErrorMessage.Reset();
+
+		const FString OutputDirectory = FPaths::GetPath(FinalOutputFilePath);
+		if (!OutputDirectory.IsEmpty() && !IFileManager::Get().MakeDirectory(*OutputDirectory, true))
+		{
+			OutErrorMessage = FString::Printf(TEXT("Failed to create output directory: %s"), *OutputDirectory);
+			return false;
+		}
+
+		const FString TempOutputPath = BuildTempOutputFilePath(FinalOutputFilePath);
+		if (!FFileHelper::SaveStringToFile(JsonText, *TempOutputPath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+		{
+			OutErrorMessage = FString::Printf(TEXT("Failed to write temp json file: %s"), *TempOutputPath);
+			return false;
+		}
+
+		if (IFileManager::Get().FileExists(*FinalOutputFilePath))
+		{
+			IFileManager::Get().Delete(*FinalOutputFilePath, false, true);
+		}
+
+		if (!IFileManager::Get().Move(*FinalOutputFilePath, *TempOutputPath, true, true, false, false))
+		{
+			OutErrorMessage = FString::Printf(TEXT("Failed to move temp json file to final path: %s"), *FinalOutputFilePath);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool IsContentStoreSidecarFileName(const FString& InFileName)
+	{
+		return InFileName.Equals(TEXT("summary.json"), ESearchCase::IgnoreCase)
+			|| InFileName.Equals(TEXT("details.json"), ESearchCase::IgnoreCase)
+			|| InFileName.Equals(TEXT("graphs.json"), ESearchCase::IgnoreCase)
+			|| InFileName.Equals(TEXT("references.json"), ESearchCase::IgnoreCase);
+	}
+
+	bool IsCompressedJsonBytes(const TArray<uint8>& InBytes)
+	{
+		// gzip member header는 ID1=0x1F, ID2=0x8B, CM=8(deflate)로 시작하고 UTF-8 JSON 첫 byte와 겹치지 않는다.
+		return InBytes.Num() >= 18 && InBytes[0] == 0x1F && InBytes[1] == 0x8B && InBytes[2] == 0x08;
+	}
+
+	bool DecompressJsonBytes(const TArray<uint8>& InBytes, TArray<uint8>& OutBytes)
+	{
+		OutBytes.Reset();
+		if (!IsCompressedJsonBytes(InBytes))
+		{
+			return false;
+		}
+
+		// UncompressedSize는 gzip trailer ISIZE(원본 길이 mod 2^32, little-endian)다. 저장 경로는 2GiB 미만 단일 member만 만든다.
+		const int32 TrailerOffset = InBytes.Num() - 4;
+		const uint32 UncompressedSize = static_cast<uint32>(InBytes[TrailerOffset])
+			| (static_cast<uint32>(InBytes[TrailerOffset + 1]) << 8)
+			| (static_cast<uint32>(InBytes[TrailerOffset + 2]) << 16)
+			| (static_cast<uint32>(InBytes[TrailerOffset + 3]) << 24);
+		if (UncompressedSize > static_cast<uint32>(MAX_int32))
+		{
+			return false;
+		}
+
+		OutBytes.SetNumUninitialized(static_cast<int32>(UncompressedSize));
+		if (!FCompression::UncompressMemory(NAME_Gzip, OutBytes.GetData(), static_cast<int32>(UncompressedSize), InBytes.GetData(), InBytes.Num()))
+		{
+			OutBytes.Reset();
+			return false;
+		}
+
+		return true;
+	}
+
+	bool LoadJsonBytesFromFile(const FString& InFilePath, TArray<uint8>& OutBytes, bool* bOutWasCompressed)
+	{
+		OutBytes.Reset();
+		if (bOutWasCompressed != nullptr)
+		{
+			*bOutWasCompressed = false;
+		}
+
+		// FileBytes는 디스크 또는 상위 dump pack에 저장된 원본 byte다.
+		TArray<uint8> FileBytes;
+		if (!FFileHelper::LoadFileToArray(FileBytes, *InFilePath, FILEREAD_Silent))
+		{
+			// 현재 manifest가 content store를 참조하면 그 blob이 pack에 남은 이전 sidecar보다 새롭다. 복원 byte는 이미 해제된 UTF-8 JSON이다.
+			if (TryLoadContentStoreSidecar(InFilePath, OutBytes))
+			{
+				return true;
+			}
+			if (!ADumpPack::TryLoadPackedFile(InFilePath, FileBytes))
+			{
+				return false;
+			}
+		}
+
+		if (!IsCompressedJsonBytes(FileBytes))
+		{
+			OutBytes = MoveTemp(FileBytes);
+			return true;
+		}
+
+		if (bOutWasCompressed != nullptr)
+		{
+			*bOutWasCompressed = true;
+		}
+		return DecompressJsonBytes(FileBytes, OutBytes);
+	}
+
+	bool LoadJsonTextFromFile(const FString& InFilePath, FString& OutJsonText)
+	{
+		OutJsonText.Reset();
+
+		// JsonBytes는 gzip 해제까지 끝난 UTF-8 JSON byte다.
+		TArray<uint8> JsonBytes;
+		if (!LoadJsonBytesFromFile(InFilePath, JsonBytes))
+		{
+			return false;
+		}
+
+		FFileHelper::BufferToString(OutJsonText, JsonBytes.GetData(), JsonBytes.Num());
+		return true;
+	}
+
+	bool DoesJsonFileExist(const FString& InFilePath)
+	{
+		if (InFilePath.IsEmpty())
+		{
+			return false;
+		}
+		if (IFileManager::Get().FileExists(*InFilePath))
+		{
+			return true;
+		}
+
+		// content store 참조가 있으면 pack의 이전 sidecar와 무관하게 blob 존재로 판단한다.
+		FString ManifestFilePath;
+		FString StoreRootPath;
+		FString ContentHash;
+		FString ManifestStampText;
+		int64 ContentBytes = -1;
+		if (TryResolveContentStoreSidecar(InFilePath, ManifestFilePath, StoreRootPath, ContentHash, ManifestStampText, ContentBytes))
+		{
+			return IFileManager::Get().FileExists(*ADumpContentStore::BuildContentBlobPath(StoreRootPath, ContentHash));
+		}
+		return ADumpPack::HasPackedFile(InFilePath);
+	}
+
+	bool GetJsonFileStat(const FString& InFilePath, int64& OutFileBytes, FString& OutStampText)
+	{
+		const FFileStatData StatData = IFileManager::Get().GetStatData(*InFilePath);
+		if (StatData.bIsValid && !StatData.bIsDirectory)
+		{
+			OutFileBytes = StatData.FileSize;
+			OutStampText = StatData.ModificationTime.ToIso8601();
+			return true;
+		}
+
+		// content store sidecar는 복원 byte 수와 manifest stamp + hash를 stat으로 쓴다. 공통 필드나 payload가 바뀌면 stamp도 바뀐다.
+		FString ManifestFilePath;
+		FString StoreRootPath;
+		FString ContentHash;
+		FString ManifestStampText;
+		int64 ContentBytes = -1;
+		if (TryResolveContentStoreSidecar(InFilePath, ManifestFilePath, StoreRootPath, ContentHash, ManifestStampText, ContentBytes))
+		{
+			// content_sizes가 없는 이전 manifest만 sidecar를 복원해 크기를 잰다.
+			if (ContentBytes < 0)
+			{
+				TArray<uint8> SidecarBytes;
+				if (!TryLoadContentStoreSidecar(InFilePath, SidecarBytes))
+				{
+					return false;
+				}
+				ContentBytes = SidecarBytes.Num();
+			}
+			OutFileBytes = ContentBytes;
+			OutStampText = FString::Printf(TEXT("cas:%s:%s"), *ContentHash, *ManifestStampText);
+			return true;
+		}
+		return ADumpPack::TryGetPackedFileStat(InFilePath, OutFileBytes, OutStampText);
+	}
+
+	FString MakeJsonFileStamp(const FString& InFilePath)
+	{
+		int64 FileBytes = -1;
+		FString StampText;
+		return GetJsonFileStat(InFilePath, FileBytes, StampText)
+			? FString::Printf(TEXT("%lld|%s"), FileBytes, *StampText)
+			: FString();
+	}
+
+	// JSON 구조 문자는 모두 ASCII이고 UTF-8 multi-byte 안에 ASCII byte가 나타나지 않으므로 byte 단위 scan으로 충분하다.
+	bool ScanRootMemberValueSpans(const TArray<uint8>& InBytes, FADumpJsonValueSpan& OutRootSpan, TMap<FString, FADumpJsonValueSpan>& OutMemberSpans)
+	{
+		OutRootSpan = FADumpJsonValueSpan();
+		OutMemberSpans.Reset();
+
+		int32 Depth = 0;
+		bool bInString = false;
+		bool bEscaped = false;
+		bool bInValue = false;
+		int64 KeyStart = -1;
+		bool bKeyEscaped = false;
+		FString PendingKey;
+		int64 ValueStart = -1;
+		int64 LastSignificantEnd = 0;
+
+		auto FinishValue = [&InBytes, &OutMemberSpans, &PendingKey, &ValueStart, &LastSignificantEnd]()
+		{
+			if (!PendingKey.IsEmpty() && ValueStart >= 0 && LastSignificantEnd > ValueStart)
+			{
+				FADumpJsonValueSpan MemberSpan;
+				MemberSpan.Offset = ValueStart;
+				MemberSpan.Length = LastSignificantEnd - ValueStart;
+				MemberSpan.Crc = FCrc::MemCrc32(InBytes.GetData() + ValueStart, static_cast<int32>(MemberSpan.Length));
+				OutMemberSpans.Add(PendingKey, MemberSpan);
+			}
+			PendingKey.Reset();
+			ValueStart = -1;
+		};
+
+		for (int64 ByteIndex = 0; ByteIndex < InBytes.Num(); ++ByteIndex)
+		{
+			const uint8 Byte = InBytes[ByteIndex];
+			if (bInString)
+			{
+				if (bEscaped)
+				{
+					bEscaped = false;
+				}
+				else if (Byte == '\\')
+				{
+					bEscaped = true;
+					bKeyEscaped = bKeyEscaped || KeyStart >= 0;
+				}
+				else if (Byte == '"')
+				{
+					bInString = false;
+					LastSignificantEnd = ByteIndex + 1;
+					if (KeyStart >= 0)
+					{
+						if (!bKeyEscaped)
+						{
+							FUTF8ToTCHAR KeyText(reinterpret_cast<const ANSICHAR*>(InBytes.GetData() + KeyStart), static_cast<int32>(ByteIndex - KeyStart));
+							PendingKey = FString(KeyText.Length(), KeyText.Get());
+						}
+						KeyStart = -1;
+					}
+				}
+				continue;
+			}
+
+			if (Byte == ' ' || Byte == '\t' || Byte == '\r' || Byte == '\n')
+			{
+				continue;
+			}
+
+			if (Depth == 1 && !bInValue && Byte == ':')
+			{
+				bInValue = true;
+				ValueStart = -1;
+				continue;
+			}
+			if (Depth == 1 && bInValue && ValueStart < 0)
+			{
+				ValueStart = ByteIndex;
+			}
+
+			if (Byte == '"')
+			{
+				bInString = true;
+				if (Depth == 1 && !bInValue)
+				{
+					KeyStart = ByteIndex + 1;
+					bKeyEscaped = false;
+				}
+				continue;
+			}
+
+			if (Byte == '{' || Byte == '[')
+			{
+				if (Depth == 0)
+				{
+					if (Byte != '{')
+					{
+						return false;
+					}
+					OutRootSpan.Offset = ByteIndex;
+				}
+				++Depth;
+			}
+			else if (Byte == '}' || Byte == ']')
+			{
+				--Depth;
+				if (Depth == 0)
+				{
+					if (bInValue)
+					{
+						FinishValue();
+					}
+					OutRootSpan.Length = ByteIndex + 1 - OutRootSpan.Offset;
+					OutRootSpan.Crc = FCrc::MemCrc32(InBytes.GetData() + OutRootSpan.Offset, static_cast<int32>(OutRootSpan.Length));
+					return true;
+				}
+				if (Depth < 0)
+				{
+					return false;
+				}
+			}
+			else if (Byte == ',' && Depth == 1)
+			{
+				FinishValue();
+				bInValue = false;
+				continue;
+			}
+			LastSignificantEnd = ByteIndex + 1;
+		}
+		return false;
+	}
+
+	bool ParseJsonValueSpan(const TArray<uint8>& InBytes, const FADumpJsonValueSpan& InSpan, TSharedPtr<FJsonValue>& OutValue)
+	{
+		OutValue.Reset();
+		if (InSpan.Offset < 0 || InSpan.Length <= 0 || InSpan.Offset + InSpan.Length > InBytes.Num()
+			|| FCrc::MemCrc32(InBytes.GetData() + InSpan.Offset, static_cast<int32>(InSpan.Length)) != InSpan.Crc)
+		{
+			return false;
+		}
+
+		// WrappedJsonText는 scalar/array value도 object reader로 해석하도록 span을 value field 하나짜리 object로 감싼 문자열이다.
+		FUTF8ToTCHAR SpanText(reinterpret_cast<const ANSICHAR*>(InBytes.GetData() + InSpan.Offset), static_cast<int32>(InSpan.Length));
+		const FString WrappedJsonText = TEXT("{\"value\":") + FString(SpanText.Length(), SpanText.Get()) + TEXT("}");
+		TSharedPtr<FJsonObject> WrappedObject;
+		TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(WrappedJsonText);
+		if (!FJsonSerializer::Deserialize(JsonReader, WrappedObject) || !WrappedObject.IsValid())
+		{
+			return false;
+		}
+		OutValue = WrappedObject->TryGetField(TEXT("value"));
+		return OutValue.IsValid();
+	}
+
+	bool LoadJsonValueFromFileSpan(const FString& InFilePath, int64 InExpectedFileBytes, const FADumpJsonValueSpan& InSpan, TSharedPtr<FJsonValue>& OutValue)
+	{
+		OutValue.Reset();
+		if (InSpan.Offset < 0 || InSpan.Length <= 0 || InSpan.Length > MAX_int32)
+		{
+			return false;
+		}
+
+		TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*InFilePath));
+		if (!FileReader.IsValid()
+			|| FileReader->TotalSize() != InExpectedFileBytes
+			|| InSpan.Offset + InSpan.Length > InExpectedFileBytes)
+		{
+			return false;
+		}
+
+		// SpanBytes는 파일에서 읽은 value 구간 원문 UTF-8 byte다.
+		TArray<uint8> SpanBytes;
+		SpanBytes.SetNumUninitialized(static_cast<int32>(InSpan.Length));
+		FileReader->Seek(InSpan.Offset);
+		FileReader->Serialize(SpanBytes.GetData(), InSpan.Length);
+		if (FileReader->IsError() || !FileReader->Close())
+		{
+			return false;
+		}
+
+		FADumpJsonValueSpan LocalSpan = InSpan;
+		LocalSpan.Offset = 0;
+		return ParseJsonValueSpan(SpanBytes, LocalSpan, OutValue);
+	}
+}
@@ -0,0 +1,3658 @@
+// File: ADumpReadQuery.cpp
+// Version: v1.1.3
+// Changelog:
+// - v1.1.3: sectiondump 인자 검사를 ValidateSectionDumpArguments로 공개해 commandlet이 Intent/Profile 이름 검증 뒤 같은 순서로 호출할 수 있게 함.
+// - v1.1.2: selector asset probe가 같은 key의 ordinal을 모두 모아 중복 selector를 선형 경로처럼 모호한 match로 처리하고, dependencyquery selector 경로가 asset_index_v1 root header와 asset identity 계약을 선형 경로와 같은 오류로 검사.
+// - v1.1.1: selector_index가 source를 ADumpQueryIO로 읽어 gzip/pack/content store source를 span 없는 source로 span_less_sources에 이유와 함께 기록하고 요약 로그를 남김.
+// - v1.1.0: input_binding_index_v1을 읽는 read-only inputquery mode를 추가.
+// - v1.0.0: selector_index_v1, sectiondump, dependencyquery, query, contextbundle과 entityquery/entitycontext 실행 경로를 commandlet에서 에디터 없는 query module로 분리.
+// Migration:
+// - 오류 코드, 종료 코드(인자 1, 생성 2, 저장 3)와 출력 JSON은 commandlet 구현과 같다. sectiondump는 Intent/Profile 값을 해석하지 않고 지정 자체를 선택 source 미지원으로 거부하며, commandlet 경로는 위임 전에 이름을 검증해 기존 Unknown intent/profile 오류를 유지한다.
+
+#include "ADumpReadQuery.h"
+
+#include "ADumpEntityQuery.h"
+#include "ADumpInputIndex.h"
+#include "ADumpQueryIO.h"
+
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "HAL/FileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	// SerializeReadQueryJsonObjectText는 루트 JsonObject를 JSON 문자열로 직렬화한다.
+	bool SerializeReadQueryJsonObjectText(const TSharedRef<FJsonObject>& InRootObject, FString& OutJsonText)
+	{
+		TSharedRef<TJsonWriter<>> JsonWriter = TJsonWriterFactory<>::Create(&OutJsonText);
+		return FJsonSerializer::Serialize(InRootObject, JsonWriter);
+	}
+
+	// GetReadQueryUtf8ByteLength는 저장할 JSON 문자열의 BOM 없는 UTF-8 byte 수를 반환한다.
+	int32 GetReadQueryUtf8ByteLength(const FString& InText)
+	{
+		FTCHARToUTF8 Utf8Text(*InText);
+		return Utf8Text.Length();
+	}
+
+	// LoadReadQueryJsonObjectFromFile는 UTF-8 또는 gzip JSON 파일을 읽어 JsonObject로 역직렬화한다.
+	bool LoadReadQueryJsonObjectFromFile(const FString& InFilePath, TSharedPtr<FJsonObject>& OutRootObject)
+	{
+		OutRootObject.Reset();
+
+		// JsonText는 파일에서 읽어 필요하면 gzip 해제한 원문 JSON 문자열이다.
+		FString JsonText;
+		if (!ADumpQueryIO::LoadJsonTextFromFile(InFilePath, JsonText))
+		{
+			return false;
+		}
+
+		// JsonReader는 문자열을 JsonObject로 해석할 reader다.
+		TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonText);
+		return FJsonSerializer::Deserialize(JsonReader, OutRootObject) && OutRootObject.IsValid();
+	}
+
+	// GetReadQueryNestedObjectField는 중첩 object 필드를 안전하게 읽는다.
+	TSharedPtr<FJsonObject> GetReadQueryNestedObjectField(const TSharedPtr<FJsonObject>& InRootObject, const TCHAR* InFieldName)
+	{
+		if (!InRootObject.IsValid())
+		{
+			return nullptr;
+		}
+
+		// NestedObjectPtr는 JSON object field를 가리키는 포인터다.
+		const TSharedPtr<FJsonObject>* NestedObjectPtr = nullptr;
+		if (InRootObject->TryGetObjectField(FStringView(InFieldName), NestedObjectPtr) && NestedObjectPtr)
+		{
+			return *NestedObjectPtr;
+		}
+
+		return nullptr;
+	}
+
+	// GetReadQueryStringFieldOrEmpty는 string field가 없으면 빈 문자열을 반환한다.
+	FString GetReadQueryStringFieldOrEmpty(const TSharedPtr<FJsonObject>& InRootObject, const TCHAR* InFieldName)
+	{
+		if (!InRootObject.IsValid())
+		{
+			return FString();
+		}
+
+		// FieldValue는 현재 필드에서 읽어낸 문자열 값이다.
+		FString FieldValue;
+		InRootObject->TryGetStringField(InFieldName, FieldValue);
+		return FieldValue;
+	}
+
+	// GetReadQueryBoolFieldOrDefault는 bool field가 없으면 기본값을 반환한다.
+	bool GetReadQueryBoolFieldOrDefault(const TSharedPtr<FJsonObject>& InRootObject, const TCHAR* InFieldName, bool bDefaultValue = false)
+	{
+		if (!InRootObject.IsValid())
+		{
+			return bDefaultValue;
+		}
+
+		bool bFieldValue = bDefaultValue;
+		InRootObject->TryGetBoolField(InFieldName, bFieldValue);
+		return bFieldValue;
+	}
+
+	// GetReadQueryIntegerFieldOrDefault는 number field가 없으면 기본 정수를 반환한다.
+	int32 GetReadQueryIntegerFieldOrDefault(const TSharedPtr<FJsonObject>& InRootObject, const TCHAR* InFieldName, int32 DefaultValue = 0)
+	{
+		if (!InRootObject.IsValid())
+		{
+			return DefaultValue;
+		}
+
+		double FieldValue = static_cast<double>(DefaultValue);
+		if (!InRootObject->TryGetNumberField(InFieldName, FieldValue))
+		{
+			return DefaultValue;
+		}
+
+		return FMath::RoundToInt(FieldValue);
+	}
+
+	// AddReadQueryStringArrayField는 FString 배열을 JSON string array로 기록한다.
+	void AddReadQueryStringArrayField(const TSharedRef<FJsonObject>& InOutObject, const TCHAR* InFieldName, const TArray<FString>& InValues)
+	{
+		TArray<TSharedPtr<FJsonValue>> JsonValueArray;
+		JsonValueArray.Reserve(InValues.Num());
+		for (const FString& ValueText : InValues)
+		{
+			JsonValueArray.Add(MakeShared<FJsonValueString>(ValueText));
+		}
+		InOutObject->SetArrayField(InFieldName, JsonValueArray);
+	}
+
+	// FReadQuerySelectorIndex는 selector_index_v1에서 읽은 selector hash table과 index entry byte span이다.
+	struct FReadQuerySelectorIndex
+	{
+		FString AssetIndexFilePath;
+		FString SectionIndexFilePath;
+		int64 AssetIndexHeaderBytes = 0;
+		int32 SlotMask = 0;
+		TArray<FString> AssetObjectPaths;
+		TArray<FString> AssetIds;
+		TArray<int64> AssetSpanOffsets;
+		TArray<int64> AssetSpanLengths;
+		TArray<FString> SectionNames;
+		TArray<int32> SectionAssetOrdinals;
+		TArray<int64> SectionSpanOffsets;
+		TArray<int64> SectionSpanLengths;
+		TArray<int64> SectionSourceFileBytes;
+		TArray<int64> SectionSourceOffsets;
+		TArray<int64> SectionSourceLengths;
+		TArray<uint32> SectionSourceCrcs;
+		TArray<int32> ObjectPathSlots;
+		TArray<int32> AssetIdSlots;
+		TArray<int32> SectionSlots;
+	};
+
+	// GetReadQueryUtf8CharByteWidth는 TCHAR 하나가 BOM 없는 UTF-8 파일에서 차지하는 byte 수다. UTF-16 surrogate 반쪽은 2 byte씩 합쳐 4가 된다.
+	int32 GetReadQueryUtf8CharByteWidth(TCHAR InChar)
+	{
+		const uint32 CodePoint = static_cast<uint32>(InChar);
+		if (CodePoint < 0x80u)
+		{
+			return 1;
+		}
+		if (CodePoint < 0x800u || (CodePoint >= 0xD800u && CodePoint <= 0xDFFFu))
+		{
+			return 2;
+		}
+		return CodePoint < 0x10000u ? 3 : 4;
+	}
+
+	// GetReadQuerySelectorHash는 platform TCHAR 폭과 무관하도록 UTF-8 byte 기준 CRC32로 selector key를 hash한다.
+	uint32 GetReadQuerySelectorHash(const FString& InKey)
+	{
+		FTCHARToUTF8 Utf8Key(*InKey);
+		return FCrc::MemCrc32(Utf8Key.Get(), Utf8Key.Length());
+	}
+
+	// MakeReadQuerySelectorSectionKey는 (asset ordinal, section_name) section selector key다.
+	FString MakeReadQuerySelectorSectionKey(int32 InAssetOrdinal, const FString& InSectionName)
+	{
+		return FString::Printf(TEXT("%d|%s"), InAssetOrdinal, *InSectionName);
+	}
+
+	// CollectReadQueryJsonArrayElementSpans는 직렬화된 root object의 InArrayFieldName 배열 원소 object별 UTF-8 byte span을 찾는다.
+	// OutArrayStartBytes는 배열 '[' 위치이며 그 앞은 generated_time과 count를 담은 root header다.
+	bool CollectReadQueryJsonArrayElementSpans(
+		const FString& InJsonText,
+		const FString& InArrayFieldName,
+		int64& OutArrayStartBytes,
+		TArray<int64>& OutSpanOffsets,
+		TArray<int64>& OutSpanLengths)
+	{
+		OutArrayStartBytes = -1;
+		OutSpanOffsets.Reset();
+		OutSpanLengths.Reset();
+
+		int32 Depth = 0;
+		bool bInString = false;
+		bool bEscaped = false;
+		bool bKeyMatched = false;
+		int32 StringStartIndex = 0;
+		int32 TargetArrayDepth = INDEX_NONE;
+		int64 ElementStartBytes = 0;
+		int64 ByteOffset = 0;
+		for (int32 CharIndex = 0; CharIndex < InJsonText.Len(); ++CharIndex)
+		{
+			const TCHAR Char = InJsonText[CharIndex];
+			if (bInString)
+			{
+				if (bEscaped)
+				{
+					bEscaped = false;
+				}
+				else if (Char == TCHAR('\\'))
+				{
+					bEscaped = true;
+				}
+				else if (Char == TCHAR('"'))
+				{
+					bInString = false;
+					bKeyMatched = Depth == 1
+						&& TargetArrayDepth == INDEX_NONE
+						&& FStringView(*InJsonText + StringStartIndex, CharIndex - StringStartIndex).Equals(InArrayFieldName, ESearchCase::CaseSensitive);
+				}
+			}
+			else if (Char == TCHAR('"'))
+			{
+				bInString = true;
+				StringStartIndex = CharIndex + 1;
+			}
+			else if (Char == TCHAR('{') || Char == TCHAR('['))
+			{
+				if (Char == TCHAR('[') && bKeyMatched)
+				{
+					TargetArrayDepth = Depth + 1;
+					OutArrayStartBytes = ByteOffset;
+				}
+				else if (TargetArrayDepth != INDEX_NONE && Depth == TargetArrayDepth)
+				{
+					ElementStartBytes = ByteOffset;
+				}
+				bKeyMatched = false;
+				++Depth;
+			}
+			else if (Char == TCHAR('}') || Char == TCHAR(']'))
+			{
+				--Depth;
+				if (TargetArrayDepth != INDEX_NONE && Depth == TargetArrayDepth)
+				{
+					if (Char != TCHAR('}'))
+					{
+						return false;
+					}
+					OutSpanOffsets.Add(ElementStartBytes);
+					OutSpanLengths.Add(ByteOffset + 1 - ElementStartBytes);
+				}
+				else if (TargetArrayDepth != INDEX_NONE && Depth == TargetArrayDepth - 1)
+				{
+					return true;
+				}
+				bKeyMatched = false;
+			}
+			else if (Char != TCHAR(':') && !FChar::IsWhitespace(Char))
+			{
+				bKeyMatched = false;
+			}
+			ByteOffset += GetReadQueryUtf8CharByteWidth(Char);
+		}
+		return false;
+	}
+
+	// GetReadQueryUtf8PrefixCrc는 JSON 문자열 앞 InByteCount UTF-8 byte의 CRC32다.
+	uint32 GetReadQueryUtf8PrefixCrc(const FString& InJsonText, int64 InByteCount)
+	{
+		FTCHARToUTF8 Utf8Text(*InJsonText);
+		return FCrc::MemCrc32(Utf8Text.Get(), static_cast<int32>(FMath::Min<int64>(InByteCount, Utf8Text.Length())));
+	}
+
+	// FReadQuerySourceSpanTable은 source dump 파일 하나의 크기, root object와 top-level member value span이다.
+	// SpanlessReason이 비어 있지 않으면 raw file offset으로 읽을 수 없는 source이며 모든 section이 전체 DOM 경로를 쓴다.
+	struct FReadQuerySourceSpanTable
+	{
+		int64 FileBytes = -1;
+		FADumpJsonValueSpan RootSpan;
+		TMap<FString, FADumpJsonValueSpan> MemberSpans;
+		FString SpanlessReason;
+	};
+
+	// ScanReadQuerySourceSpanTable은 source를 ADumpQueryIO로 읽어 span table을 채운다. span 읽기는 디스크의 비압축 원본 byte offset만 쓰므로 그 밖의 저장 형태는 이유를 남긴다.
+	void ScanReadQuerySourceSpanTable(const FString& InDumpRootPath, const FString& InSourceFileText, FReadQuerySourceSpanTable& OutTable)
+	{
+		OutTable = FReadQuerySourceSpanTable();
+		if (InSourceFileText.IsEmpty())
+		{
+			OutTable.SpanlessReason = TEXT("no_source_file");
+			return;
+		}
+
+		const FString SourceFilePath = FPaths::Combine(InDumpRootPath, InSourceFileText);
+		if (!IFileManager::Get().FileExists(*SourceFilePath))
+		{
+			// pack 항목과 content store 복원 sidecar는 디스크 offset이 없다.
+			OutTable.SpanlessReason = ADumpQueryIO::DoesJsonFileExist(SourceFilePath) ? TEXT("not_on_disk") : TEXT("missing");
+			return;
+		}
+
+		TArray<uint8> SourceBytes;
+		bool bWasCompressed = false;
+		if (!ADumpQueryIO::LoadJsonBytesFromFile(SourceFilePath, SourceBytes, &bWasCompressed))
+		{
+			OutTable.SpanlessReason = TEXT("missing");
+			return;
+		}
+		if (bWasCompressed)
+		{
+			OutTable.SpanlessReason = TEXT("compressed");
+			return;
+		}
+		if (!ADumpQueryIO::ScanRootMemberValueSpans(SourceBytes, OutTable.RootSpan, OutTable.MemberSpans))
+		{
+			OutTable = FReadQuerySourceSpanTable();
+			OutTable.SpanlessReason = TEXT("unscannable");
+			return;
+		}
+		OutTable.FileBytes = SourceBytes.Num();
+	}
+
+	// FindReadQuerySourceValueSpan은 json_pointer가 "/" 또는 "/<top-level field>"일 때 scan한 value span을 찾는다.
+	const FADumpJsonValueSpan* FindReadQuerySourceValueSpan(const FReadQuerySourceSpanTable& InTable, const FString& InJsonPointer)
+	{
+		if (InJsonPointer == TEXT("/"))
+		{
+			return InTable.RootSpan.Offset >= 0 ? &InTable.RootSpan : nullptr;
+		}
+		if (InJsonPointer.StartsWith(TEXT("/")) && InJsonPointer.Len() > 1 && !InJsonPointer.Mid(1).Contains(TEXT("/")))
+		{
+			return InTable.MemberSpans.Find(InJsonPointer.Mid(1));
+		}
+		return nullptr;
+	}
+
+	// AddReadQuerySelectorSlot은 open addressing slot 배열에 ordinal을 linear probing으로 넣는다.
+	void AddReadQuerySelectorSlot(TArray<int32>& InOutSlots, int32 InSlotMask, const FString& InKey, int32 InOrdinal)
+	{
+		int32 SlotIndex = static_cast<int32>(GetReadQuerySelectorHash(InKey) & static_cast<uint32>(InSlotMask));
+		while (InOutSlots[SlotIndex] != INDEX_NONE)
+		{
+			SlotIndex = (SlotIndex + 1) & InSlotMask;
+		}
+		InOutSlots[SlotIndex] = InOrdinal;
+	}
+
+	// AddReadQuerySelectorIntegerArrayField는 int32 배열을 JSON number 배열 field로 기록한다.
+	void AddReadQuerySelectorIntegerArrayField(const TSharedRef<FJsonObject>& InObject, const TCHAR* InFieldName, const TArray<int32>& InValues)
+	{
+		TArray<TSharedPtr<FJsonValue>> ValueArray;
+		ValueArray.Reserve(InValues.Num());
+		for (const int32 Value : InValues)
+		{
+			ValueArray.Add(MakeShared<FJsonValueNumber>(Value));
+		}
+		InObject->SetArrayField(InFieldName, ValueArray);
+	}
+
+	// BuildReadQuerySelectorIndexJson은 저장 직전 asset/section index 문자열에서 selector_index_v1 compact JSON을 만든다.
+	// object_path, asset_id, (asset ordinal, section_name) key를 open addressing table로 두고 각 entry의 byte span을 함께 기록한다.
+	bool BuildReadQuerySelectorIndexJson(
+		const FString& InDumpRootPath,
+		const FString& InAssetIndexJsonText,
+		const FString& InSectionIndexJsonText,
+		const TArray<TSharedPtr<FJsonObject>>& InAssetEntryObjects,
+		const TArray<TSharedPtr<FJsonObject>>& InSectionEntryObjects,
+		const FString& InGeneratedTimeText,
+		FString& OutJsonText)
+	{
+		OutJsonText.Reset();
+
+		int64 AssetArrayStartBytes = -1;
+		int64 SectionArrayStartBytes = -1;
+		TArray<int64> AssetSpanOffsets;
+		TArray<int64> AssetSpanLengths;
+		TArray<int64> SectionSpanOffsets;
+		TArray<int64> SectionSpanLengths;
+		if (!CollectReadQueryJsonArrayElementSpans(InAssetIndexJsonText, TEXT("assets"), AssetArrayStartBytes, AssetSpanOffsets, AssetSpanLengths)
+			|| !CollectReadQueryJsonArrayElementSpans(InSectionIndexJsonText, TEXT("sections"), SectionArrayStartBytes, SectionSpanOffsets, SectionSpanLengths)
+			|| AssetSpanOffsets.Num() != InAssetEntryObjects.Num()
+			|| SectionSpanOffsets.Num() != InSectionEntryObjects.Num())
+		{
+			return false;
+		}
+
+		// SlotCount는 load factor 0.5 이하를 보장하는 2의 거듭제곱 slot 수다.
+		const int32 SlotCount = static_cast<int32>(FMath::RoundUpToPowerOfTwo(
+			static_cast<uint32>(FMath::Max(16, 2 * FMath::Max(InAssetEntryObjects.Num(), InSectionEntryObjects.Num())))));
+		const int32 SlotMask = SlotCount - 1;
+		TArray<int32> ObjectPathSlots;
+		TArray<int32> AssetIdSlots;
+		TArray<int32> SectionSlots;
+		ObjectPathSlots.Init(INDEX_NONE, SlotCount);
+		AssetIdSlots.Init(INDEX_NONE, SlotCount);
+		SectionSlots.Init(INDEX_NONE, SlotCount);
+
+		TMap<FString, int32> AssetOrdinalByObjectPath;
+		TArray<TSharedPtr<FJsonValue>> AssetRowArray;
+		AssetRowArray.Reserve(InAssetEntryObjects.Num());
+		for (int32 AssetOrdinal = 0; AssetOrdinal < InAssetEntryObjects.Num(); ++AssetOrdinal)
+		{
+			const FString ObjectPathText = GetReadQueryStringFieldOrEmpty(InAssetEntryObjects[AssetOrdinal], TEXT("object_path"));
+			const FString AssetIdText = GetReadQueryStringFieldOrEmpty(InAssetEntryObjects[AssetOrdinal], TEXT("asset_id"));
+			AssetOrdinalByObjectPath.Add(ObjectPathText, AssetOrdinal);
+			AddReadQuerySelectorSlot(ObjectPathSlots, SlotMask, ObjectPathText, AssetOrdinal);
+			AddReadQuerySelectorSlot(AssetIdSlots, SlotMask, AssetIdText, AssetOrdinal);
+
+			TArray<TSharedPtr<FJsonValue>> AssetRow;
+			AssetRow.Add(MakeShared<FJsonValueString>(ObjectPathText));
+			AssetRow.Add(MakeShared<FJsonValueString>(AssetIdText));
+			AssetRow.Add(MakeShared<FJsonValueNumber>(static_cast<double>(AssetSpanOffsets[AssetOrdinal])));
+			AssetRow.Add(MakeShared<FJsonValueNumber>(static_cast<double>(AssetSpanLengths[AssetOrdinal])));
+			AssetRowArray.Add(MakeShared<FJsonValueArray>(AssetRow));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> SectionRowArray;
+		SectionRowArray.Reserve(InSectionEntryObjects.Num());
+
+		// SectionSourceRowArray는 section별 source 파일 크기와 value byte span/CRC32이며 scan할 수 없는 section은 null이다.
+		TArray<TSharedPtr<FJsonValue>> SectionSourceRowArray;
+		SectionSourceRowArray.Reserve(InSectionEntryObjects.Num());
+		TMap<FString, FReadQuerySourceSpanTable> SourceSpanTableByRelativePath;
+		for (int32 SectionOrdinal = 0; SectionOrdinal < InSectionEntryObjects.Num(); ++SectionOrdinal)
+		{
+			const FString SectionNameText = GetReadQueryStringFieldOrEmpty(InSectionEntryObjects[SectionOrdinal], TEXT("section_name"));
+			const int32* AssetOrdinalPtr = AssetOrdinalByObjectPath.Find(
+				GetReadQueryStringFieldOrEmpty(InSectionEntryObjects[SectionOrdinal], TEXT("object_path")));
+			if (!AssetOrdinalPtr)
+			{
+				return false;
+			}
+			AddReadQuerySelectorSlot(SectionSlots, SlotMask, MakeReadQuerySelectorSectionKey(*AssetOrdinalPtr, SectionNameText), SectionOrdinal);
+
+			TArray<TSharedPtr<FJsonValue>> SectionRow;
+			SectionRow.Add(MakeShared<FJsonValueString>(SectionNameText));
+			SectionRow.Add(MakeShared<FJsonValueNumber>(*AssetOrdinalPtr));
+			SectionRow.Add(MakeShared<FJsonValueNumber>(static_cast<double>(SectionSpanOffsets[SectionOrdinal])));
+			SectionRow.Add(MakeShared<FJsonValueNumber>(static_cast<double>(SectionSpanLengths[SectionOrdinal])));
+			SectionRowArray.Add(MakeShared<FJsonValueArray>(SectionRow));
+
+			const FString SourceFileText = GetReadQueryStringFieldOrEmpty(InSectionEntryObjects[SectionOrdinal], TEXT("source_file"));
+			FReadQuerySourceSpanTable* SourceSpanTable = SourceSpanTableByRelativePath.Find(SourceFileText);
+			if (!SourceSpanTable)
+			{
+				SourceSpanTable = &SourceSpanTableByRelativePath.Add(SourceFileText);
+				ScanReadQuerySourceSpanTable(InDumpRootPath, SourceFileText, *SourceSpanTable);
+			}
+
+			const FADumpJsonValueSpan* SourceValueSpan = SourceSpanTable->FileBytes >= 0
+				? FindReadQuerySourceValueSpan(*SourceSpanTable, GetReadQueryStringFieldOrEmpty(InSectionEntryObjects[SectionOrdinal], TEXT("json_pointer")))
+				: nullptr;
+			if (!SourceValueSpan)
+			{
+				SectionSourceRowArray.Add(MakeShared<FJsonValueNull>());
+				continue;
+			}
+
+			TArray<TSharedPtr<FJsonValue>> SectionSourceRow;
+			SectionSourceRow.Add(MakeShared<FJsonValueNumber>(static_cast<double>(SourceSpanTable->FileBytes)));
+			SectionSourceRow.Add(MakeShared<FJsonValueNumber>(static_cast<double>(SourceValueSpan->Offset)));
+			SectionSourceRow.Add(MakeShared<FJsonValueNumber>(static_cast<double>(SourceValueSpan->Length)));
+			SectionSourceRow.Add(MakeShared<FJsonValueNumber>(SourceValueSpan->Crc));
+			SectionSourceRowArray.Add(MakeShared<FJsonValueArray>(SectionSourceRow));
+		}
+
+		// SpanlessSourceRowArray는 span을 만들 수 없던 source [source_file, reason]이다. 이 source의 section_sources null은 member가 없어서가 아니다.
+		TArray<TSharedPtr<FJsonValue>> SpanlessSourceRowArray;
+		TMap<FString, int32> SpanlessCountByReason;
+		SourceSpanTableByRelativePath.KeySort(TLess<FString>());
+		for (const TPair<FString, FReadQuerySourceSpanTable>& SourceSpanPair : SourceSpanTableByRelativePath)
+		{
+			if (SourceSpanPair.Value.SpanlessReason.IsEmpty())
+			{
+				continue;
+			}
+			TArray<TSharedPtr<FJsonValue>> SpanlessSourceRow;
+			SpanlessSourceRow.Add(MakeShared<FJsonValueString>(SourceSpanPair.Key));
+			SpanlessSourceRow.Add(MakeShared<FJsonValueString>(SourceSpanPair.Value.SpanlessReason));
+			SpanlessSourceRowArray.Add(MakeShared<FJsonValueArray>(SpanlessSourceRow));
+			++SpanlessCountByReason.FindOrAdd(SourceSpanPair.Value.SpanlessReason);
+		}
+		if (SpanlessSourceRowArray.Num() > 0)
+		{
+			FString ReasonSummaryText;
+			for (const TPair<FString, int32>& ReasonPair : SpanlessCountByReason)
+			{
+				ReasonSummaryText += FString::Printf(TEXT("%s%s=%d"), ReasonSummaryText.IsEmpty() ? TEXT("") : TEXT(" "), *ReasonPair.Key, ReasonPair.Value);
+			}
+			UE_LOG(LogTemp, Display, TEXT("selector_index: %d of %d sources have no section spans and use full DOM reads (%s)."),
+				SpanlessSourceRowArray.Num(), SourceSpanTableByRelativePath.Num(), *ReasonSummaryText);
+		}
+
+		TSharedRef<FJsonObject> SelectorRootObject = MakeShared<FJsonObject>();
+		SelectorRootObject->SetStringField(TEXT("schema_version"), TEXT("selector_index_v1"));
+		SelectorRootObject->SetStringField(TEXT("generated_time"), InGeneratedTimeText);
+		SelectorRootObject->SetStringField(TEXT("hash_function"), TEXT("crc32_utf8"));
+		SelectorRootObject->SetNumberField(TEXT("asset_index_file_bytes"), static_cast<double>(GetReadQueryUtf8ByteLength(InAssetIndexJsonText)));
+		SelectorRootObject->SetNumberField(TEXT("asset_index_header_bytes"), static_cast<double>(AssetArrayStartBytes));
+		SelectorRootObject->SetNumberField(TEXT("asset_index_header_crc"), GetReadQueryUtf8PrefixCrc(InAssetIndexJsonText, AssetArrayStartBytes));
+		SelectorRootObject->SetNumberField(TEXT("section_index_file_bytes"), static_cast<double>(GetReadQueryUtf8ByteLength(InSectionIndexJsonText)));
+		SelectorRootObject->SetNumberField(TEXT("section_index_header_bytes"), static_cast<double>(SectionArrayStartBytes));
+		SelectorRootObject->SetNumberField(TEXT("section_index_header_crc"), GetReadQueryUtf8PrefixCrc(InSectionIndexJsonText, SectionArrayStartBytes));
+		SelectorRootObject->SetNumberField(TEXT("asset_count"), AssetRowArray.Num());
+		SelectorRootObject->SetNumberField(TEXT("section_count"), SectionRowArray.Num());
+		SelectorRootObject->SetNumberField(TEXT("slot_count"), SlotCount);
+		SelectorRootObject->SetArrayField(TEXT("assets"), AssetRowArray);
+		SelectorRootObject->SetArrayField(TEXT("sections"), SectionRowArray);
+		SelectorRootObject->SetArrayField(TEXT("section_sources"), SectionSourceRowArray);
+		SelectorRootObject->SetArrayField(TEXT("span_less_sources"), SpanlessSourceRowArray);
+		AddReadQuerySelectorIntegerArrayField(SelectorRootObject, TEXT("object_path_slots"), ObjectPathSlots);
+		AddReadQuerySelectorIntegerArrayField(SelectorRootObject, TEXT("asset_id_slots"), AssetIdSlots);
+		AddReadQuerySelectorIntegerArrayField(SelectorRootObject, TEXT("section_slots"), SectionSlots);
+
+		TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> SelectorWriter =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutJsonText);
+		return FJsonSerializer::Serialize(SelectorRootObject, SelectorWriter);
+	}
+
+	// ReadReadQueryFileBytes는 파일의 [InOffset, InOffset + InLength) byte 구간만 읽는다.
+	bool ReadReadQueryFileBytes(const FString& InFilePath, int64 InOffset, int64 InLength, TArray<uint8>& OutBytes)
+	{
+		OutBytes.Reset();
+		if (InOffset < 0 || InLength < 0 || InLength > MAX_int32)
+		{
+			return false;
+		}
+
+		TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*InFilePath));
+		if (!FileReader.IsValid() || InOffset + InLength > FileReader->TotalSize())
+		{
+			return false;
+		}
+
+		OutBytes.SetNumUninitialized(static_cast<int32>(InLength));
+		FileReader->Seek(InOffset);
+		FileReader->Serialize(OutBytes.GetData(), InLength);
+		return !FileReader->IsError() && FileReader->Close();
+	}
+
+	// LoadReadQueryJsonObjectFromFileSpan은 UTF-8 JSON 파일의 byte span 하나만 읽어 JsonObject로 역직렬화한다.
+	bool LoadReadQueryJsonObjectFromFileSpan(const FString& InFilePath, int64 InOffset, int64 InLength, TSharedPtr<FJsonObject>& OutObject)
+	{
+		OutObject.Reset();
+
+		TArray<uint8> SpanBytes;
+		if (!ReadReadQueryFileBytes(InFilePath, InOffset, InLength, SpanBytes))
+		{
+			return false;
+		}
+
+		FUTF8ToTCHAR SpanText(reinterpret_cast<const ANSICHAR*>(SpanBytes.GetData()), SpanBytes.Num());
+		const FString JsonText(SpanText.Length(), SpanText.Get());
+		TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonText);
+		return FJsonSerializer::Deserialize(JsonReader, OutObject) && OutObject.IsValid();
+	}
+
+	// IsReadQuerySelectorIndexHeaderCurrent는 index 파일 크기와 root header CRC가 selector_index 기록과 같은지 본다.
+	bool IsReadQuerySelectorIndexHeaderCurrent(
+		const FString& InIndexFilePath,
+		const TSharedPtr<FJsonObject>& InSelectorRootObject,
+		const TCHAR* InFileBytesFieldName,
+		const TCHAR* InHeaderBytesFieldName,
+		const TCHAR* InHeaderCrcFieldName)
+	{
+		double FileBytesValue = -1.0;
+		double HeaderBytesValue = -1.0;
+		double HeaderCrcValue = -1.0;
+		if (!InSelectorRootObject->TryGetNumberField(InFileBytesFieldName, FileBytesValue)
+			|| !InSelectorRootObject->TryGetNumberField(InHeaderBytesFieldName, HeaderBytesValue)
+			|| !InSelectorRootObject->TryGetNumberField(InHeaderCrcFieldName, HeaderCrcValue)
+			|| IFileManager::Get().FileSize(*InIndexFilePath) != static_cast<int64>(FileBytesValue))
+		{
+			return false;
+		}
+
+		TArray<uint8> HeaderBytes;
+		return ReadReadQueryFileBytes(InIndexFilePath, 0, static_cast<int64>(HeaderBytesValue), HeaderBytes)
+			&& FCrc::MemCrc32(HeaderBytes.GetData(), HeaderBytes.Num()) == static_cast<uint32>(HeaderCrcValue);
+	}
+
+	// LoadReadQuerySelectorIndex는 현재 asset/section index와 일치하는 selector_index_v1만 읽는다. 없거나 오래되면 false로 선형 경로를 쓴다.
+	bool LoadReadQuerySelectorIndex(const FString& InDumpRootPath, FReadQuerySelectorIndex& OutSelectorIndex)
+	{
+		OutSelectorIndex = FReadQuerySelectorIndex();
+		OutSelectorIndex.AssetIndexFilePath = FPaths::Combine(InDumpRootPath, TEXT("asset_index.json"));
+		OutSelectorIndex.SectionIndexFilePath = FPaths::Combine(InDumpRootPath, TEXT("section_index.json"));
+
+		const FString SelectorIndexFilePath = FPaths::Combine(InDumpRootPath, TEXT("selector_index.json"));
+		TSharedPtr<FJsonObject> SelectorRootObject;
+		if (!IFileManager::Get().FileExists(*SelectorIndexFilePath)
+			|| !LoadReadQueryJsonObjectFromFile(SelectorIndexFilePath, SelectorRootObject)
+			|| GetReadQueryStringFieldOrEmpty(SelectorRootObject, TEXT("schema_version")) != TEXT("selector_index_v1")
+			|| GetReadQueryStringFieldOrEmpty(SelectorRootObject, TEXT("hash_function")) != TEXT("crc32_utf8")
+			|| !IsReadQuerySelectorIndexHeaderCurrent(
+				OutSelectorIndex.AssetIndexFilePath, SelectorRootObject,
+				TEXT("asset_index_file_bytes"), TEXT("asset_index_header_bytes"), TEXT("asset_index_header_crc"))
+			|| !IsReadQuerySelectorIndexHeaderCurrent(
+				OutSelectorIndex.SectionIndexFilePath, SelectorRootObject,
+				TEXT("section_index_file_bytes"), TEXT("section_index_header_bytes"), TEXT("section_index_header_crc")))
+		{
+			return false;
+		}
+
+		const int32 SlotCount = GetReadQueryIntegerFieldOrDefault(SelectorRootObject, TEXT("slot_count"), 0);
+		if (SlotCount <= 0 || !FMath::IsPowerOfTwo(SlotCount))
+		{
+			return false;
+		}
+		OutSelectorIndex.AssetIndexHeaderBytes = static_cast<int64>(SelectorRootObject->GetNumberField(TEXT("asset_index_header_bytes")));
+		OutSelectorIndex.SlotMask = SlotCount - 1;
+
+		auto ReadSlots = [&SelectorRootObject, SlotCount](const TCHAR* InFieldName, int32 InOrdinalCount, TArray<int32>& OutSlots)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* SlotValueArray = nullptr;
+			if (!SelectorRootObject->TryGetArrayField(InFieldName, SlotValueArray) || !SlotValueArray || SlotValueArray->Num() != SlotCount)
+			{
+				return false;
+			}
+			OutSlots.SetNumUninitialized(SlotCount);
+			for (int32 SlotIndex = 0; SlotIndex < SlotCount; ++SlotIndex)
+			{
+				const int32 Ordinal = (*SlotValueArray)[SlotIndex].IsValid()
+					? static_cast<int32>((*SlotValueArray)[SlotIndex]->AsNumber())
+					: INDEX_NONE;
+				if (Ordinal < INDEX_NONE || Ordinal >= InOrdinalCount)
+				{
+					return false;
+				}
+				OutSlots[SlotIndex] = Ordinal;
+			}
+			return true;
+		};
+
+		const TArray<TSharedPtr<FJsonValue>>* AssetRowArray = nullptr;
+		const TArray<TSharedPtr<FJsonValue>>* SectionRowArray = nullptr;
+		if (!SelectorRootObject->TryGetArrayField(TEXT("assets"), AssetRowArray) || !AssetRowArray
+			|| !SelectorRootObject->TryGetArrayField(TEXT("sections"), SectionRowArray) || !SectionRowArray)
+		{
+			return false;
+		}
+
+		const int32 AssetCount = AssetRowArray->Num();
+		for (const TSharedPtr<FJsonValue>& AssetRowValue : *AssetRowArray)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* AssetRow = nullptr;
+			if (!AssetRowValue.IsValid() || !AssetRowValue->TryGetArray(AssetRow) || !AssetRow || AssetRow->Num() != 4)
+			{
+				return false;
+			}
+			OutSelectorIndex.AssetObjectPaths.Add((*AssetRow)[0]->AsString());
+			OutSelectorIndex.AssetIds.Add((*AssetRow)[1]->AsString());
+			OutSelectorIndex.AssetSpanOffsets.Add(static_cast<int64>((*AssetRow)[2]->AsNumber()));
+			OutSelectorIndex.AssetSpanLengths.Add(static_cast<int64>((*AssetRow)[3]->AsNumber()));
+		}
+
+		for (const TSharedPtr<FJsonValue>& SectionRowValue : *SectionRowArray)
+		{
+			const TArray<TSharedPtr<FJsonValue>>* SectionRow = nullptr;
+			if (!SectionRowValue.IsValid() || !SectionRowValue->TryGetArray(SectionRow) || !SectionRow || SectionRow->Num() != 4)
+			{
+				return false;
+			}
+			const int32 AssetOrdinal = static_cast<int32>((*SectionRow)[1]->AsNumber());
+			if (AssetOrdinal < 0 || AssetOrdinal >= AssetCount)
+			{
+				return false;
+			}
+			OutSelectorIndex.SectionNames.Add((*SectionRow)[0]->AsString());
+			OutSelectorIndex.SectionAssetOrdinals.Add(AssetOrdinal);
+			OutSelectorIndex.SectionSpanOffsets.Add(static_cast<int64>((*SectionRow)[2]->AsNumber()));
+			OutSelectorIndex.SectionSpanLengths.Add(static_cast<int64>((*SectionRow)[3]->AsNumber()));
+		}
+
+		// section_sources는 선택적이다. 없거나 null인 section은 source 전체 DOM 경로로 읽는다.
+		const int32 SectionCount = SectionRowArray->Num();
+		OutSelectorIndex.SectionSourceFileBytes.Init(-1, SectionCount);
+		OutSelectorIndex.SectionSourceOffsets.Init(-1, SectionCount);
+		OutSelectorIndex.SectionSourceLengths.Init(0, SectionCount);
+		OutSelectorIndex.SectionSourceCrcs.Init(0, SectionCount);
+		const TArray<TSharedPtr<FJsonValue>>* SectionSourceRowArray = nullptr;
+		if (SelectorRootObject->TryGetArrayField(TEXT("section_sources"), SectionSourceRowArray)
+			&& SectionSourceRowArray
+			&& SectionSourceRowArray->Num() == SectionCount)
+		{
+			for (int32 SectionOrdinal = 0; SectionOrdinal < SectionCount; ++SectionOrdinal)
+			{
+				const TArray<TSharedPtr<FJsonValue>>* SectionSourceRow = nullptr;
+				if (!(*SectionSourceRowArray)[SectionOrdinal].IsValid()
+					|| !(*SectionSourceRowArray)[SectionOrdinal]->TryGetArray(SectionSourceRow)
+					|| !SectionSourceRow
+					|| SectionSourceRow->Num() != 4)
+				{
+					continue;
+				}
+				OutSelectorIndex.SectionSourceFileBytes[SectionOrdinal] = static_cast<int64>((*SectionSourceRow)[0]->AsNumber());
+				OutSelectorIndex.SectionSourceOffsets[SectionOrdinal] = static_cast<int64>((*SectionSourceRow)[1]->AsNumber());
+				OutSelectorIndex.SectionSourceLengths[SectionOrdinal] = static_cast<int64>((*SectionSourceRow)[2]->AsNumber());
+				OutSelectorIndex.SectionSourceCrcs[SectionOrdinal] = static_cast<uint32>((*SectionSourceRow)[3]->AsNumber());
+			}
+		}
+
+		return ReadSlots(TEXT("object_path_slots"), AssetCount, OutSelectorIndex.ObjectPathSlots)
+			&& ReadSlots(TEXT("asset_id_slots"), AssetCount, OutSelectorIndex.AssetIdSlots)
+			&& ReadSlots(TEXT("section_slots"), SectionRowArray->Num(), OutSelectorIndex.SectionSlots);
+	}
+
+	// FindReadQuerySelectorAssetOrdinals는 object_path 또는 asset_id selector가 hash probe로 닿는 asset ordinal을 모두 오름차순으로 모은다.
+	// asset_index에 같은 key가 여러 번 있으면 선형 경로처럼 match가 둘 이상 남는다.
+	void FindReadQuerySelectorAssetOrdinals(
+		const FReadQuerySelectorIndex& InSelectorIndex,
+		bool bInByAssetId,
+		const FString& InKey,
+		TArray<int32>& OutAssetOrdinals)
+	{
+		OutAssetOrdinals.Reset();
+		const TArray<int32>& Slots = bInByAssetId ? InSelectorIndex.AssetIdSlots : InSelectorIndex.ObjectPathSlots;
+		const TArray<FString>& Keys = bInByAssetId ? InSelectorIndex.AssetIds : InSelectorIndex.AssetObjectPaths;
+		int32 SlotIndex = static_cast<int32>(GetReadQuerySelectorHash(InKey) & static_cast<uint32>(InSelectorIndex.SlotMask));
+		for (int32 ProbeCount = 0; ProbeCount < Slots.Num() && Slots[SlotIndex] != INDEX_NONE; ++ProbeCount)
+		{
+			if (Keys[Slots[SlotIndex]].Equals(InKey, ESearchCase::CaseSensitive))
+			{
+				OutAssetOrdinals.Add(Slots[SlotIndex]);
+			}
+			SlotIndex = (SlotIndex + 1) & InSelectorIndex.SlotMask;
+		}
+		OutAssetOrdinals.Sort();
+	}
+
+	// FindReadQuerySelectorAssetOrdinal은 selector가 정확히 한 asset ordinal에 닿을 때 그 ordinal을, 없거나 모호하면 INDEX_NONE을 돌려준다.
+	int32 FindReadQuerySelectorAssetOrdinal(const FReadQuerySelectorIndex& InSelectorIndex, bool bInByAssetId, const FString& InKey)
+	{
+		TArray<int32> AssetOrdinals;
+		FindReadQuerySelectorAssetOrdinals(InSelectorIndex, bInByAssetId, InKey, AssetOrdinals);
+		return AssetOrdinals.Num() == 1 ? AssetOrdinals[0] : INDEX_NONE;
+	}
+
+	// ValidateReadQuerySelectorAssetContract는 selector 경로가 asset_index.json 전체를 읽지 않고도 선형 dependencyquery와 같은 asset_index_v1 계약을 검사한다.
+	// root header의 schema_version/asset_count는 header byte 뒤에 빈 배열을 닫아 읽고, identity 형식과 중복은 selector table의 key로 본다.
+	// header를 해석할 수 없으면 OutErrorDetail을 비운 채 false를 돌려 호출자가 선형 경로로 같은 검사를 다시 하게 한다.
+	bool ValidateReadQuerySelectorAssetContract(const FReadQuerySelectorIndex& InSelectorIndex, FString& OutErrorDetail)
+	{
+		OutErrorDetail.Reset();
+
+		TArray<uint8> HeaderBytes;
+		if (!ReadReadQueryFileBytes(InSelectorIndex.AssetIndexFilePath, 0, InSelectorIndex.AssetIndexHeaderBytes, HeaderBytes))
+		{
+			return false;
+		}
+		FUTF8ToTCHAR HeaderText(reinterpret_cast<const ANSICHAR*>(HeaderBytes.GetData()), HeaderBytes.Num());
+		const FString HeaderJsonText = FString(HeaderText.Length(), HeaderText.Get()) + TEXT("[]}");
+		TSharedPtr<FJsonObject> HeaderRootObject;
+		TSharedRef<TJsonReader<>> HeaderReader = TJsonReaderFactory<>::Create(HeaderJsonText);
+		if (!FJsonSerializer::Deserialize(HeaderReader, HeaderRootObject) || !HeaderRootObject.IsValid())
+		{
+			return false;
+		}
+
+		if (GetReadQueryStringFieldOrEmpty(HeaderRootObject, TEXT("schema_version")) != TEXT("asset_index_v1"))
+		{
+			OutErrorDetail = TEXT("The selected asset index is not asset_index_v1.");
+			return false;
+		}
+
+		double AssetCountValue = -1.0;
+		if (!HeaderRootObject->TryGetNumberField(TEXT("asset_count"), AssetCountValue)
+			|| !FMath::IsNearlyEqual(AssetCountValue, static_cast<double>(InSelectorIndex.AssetObjectPaths.Num())))
+		{
+			OutErrorDetail = TEXT("asset_index_v1 asset_count does not agree with assets[].");
+			return false;
+		}
+
+		TSet<FString> SeenObjectPathSet;
+		TSet<FString> SeenAssetIdSet;
+		SeenObjectPathSet.Reserve(InSelectorIndex.AssetObjectPaths.Num());
+		SeenAssetIdSet.Reserve(InSelectorIndex.AssetIds.Num());
+		for (int32 AssetOrdinal = 0; AssetOrdinal < InSelectorIndex.AssetObjectPaths.Num(); ++AssetOrdinal)
+		{
+			const FString& ObjectPathText = InSelectorIndex.AssetObjectPaths[AssetOrdinal];
+			const FString& AssetIdText = InSelectorIndex.AssetIds[AssetOrdinal];
+			bool bObjectPathSeen = false;
+			bool bAssetIdSeen = false;
+			SeenObjectPathSet.Add(ObjectPathText, &bObjectPathSeen);
+			SeenAssetIdSet.Add(AssetIdText, &bAssetIdSeen);
+			if (AssetIdText.IsEmpty()
+				|| ObjectPathText.IsEmpty()
+				|| !ObjectPathText.StartsWith(TEXT("/"))
+				|| bObjectPathSeen
+				|| bAssetIdSeen)
+			{
+				OutErrorDetail = TEXT("asset_index_v1 contains an invalid or duplicate asset identity.");
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// FindReadQuerySelectorSectionOrdinals는 (asset ordinal, section_name)에 색인된 section ordinal을 모두 오름차순으로 모은다.
+	void FindReadQuerySelectorSectionOrdinals(
+		const FReadQuerySelectorIndex& InSelectorIndex,
+		int32 InAssetOrdinal,
+		const FString& InSectionName,
+		TArray<int32>& OutSectionOrdinals)
+	{
+		OutSectionOrdinals.Reset();
+		const TArray<int32>& Slots = InSelectorIndex.SectionSlots;
+		int32 SlotIndex = static_cast<int32>(
+			GetReadQuerySelectorHash(MakeReadQuerySelectorSectionKey(InAssetOrdinal, InSectionName)) & static_cast<uint32>(InSelectorIndex.SlotMask));
+		for (int32 ProbeCount = 0; ProbeCount < Slots.Num() && Slots[SlotIndex] != INDEX_NONE; ++ProbeCount)
+		{
+			const int32 SectionOrdinal = Slots[SlotIndex];
+			if (InSelectorIndex.SectionAssetOrdinals[SectionOrdinal] == InAssetOrdinal
+				&& InSelectorIndex.SectionNames[SectionOrdinal].Equals(InSectionName, ESearchCase::CaseSensitive))
+			{
+				OutSectionOrdinals.Add(SectionOrdinal);
+			}
+			SlotIndex = (SlotIndex + 1) & InSelectorIndex.SlotMask;
+		}
+		OutSectionOrdinals.Sort();
+	}
+
+	// LoadReadQuerySelectorAssetObject는 asset ordinal의 asset_index entry span만 읽고 identity가 table과 같은지 확인한다.
+	bool LoadReadQuerySelectorAssetObject(const FReadQuerySelectorIndex& InSelectorIndex, int32 InAssetOrdinal, TSharedPtr<FJsonObject>& OutAssetObject)
+	{
+		return LoadReadQueryJsonObjectFromFileSpan(
+				InSelectorIndex.AssetIndexFilePath,
+				InSelectorIndex.AssetSpanOffsets[InAssetOrdinal],
+				InSelectorIndex.AssetSpanLengths[InAssetOrdinal],
+				OutAssetObject)
+			&& GetReadQueryStringFieldOrEmpty(OutAssetObject, TEXT("object_path")) == InSelectorIndex.AssetObjectPaths[InAssetOrdinal]
+			&& GetReadQueryStringFieldOrEmpty(OutAssetObject, TEXT("asset_id")) == InSelectorIndex.AssetIds[InAssetOrdinal];
+	}
+
+	// LoadReadQuerySelectorSectionObject는 section ordinal의 section_index entry span만 읽고 identity가 table과 같은지 확인한다.
+	bool LoadReadQuerySelectorSectionObject(const FReadQuerySelectorIndex& InSelectorIndex, int32 InSectionOrdinal, TSharedPtr<FJsonObject>& OutSectionObject)
+	{
+		return LoadReadQueryJsonObjectFromFileSpan(
+				InSelectorIndex.SectionIndexFilePath,
+				InSelectorIndex.SectionSpanOffsets[InSectionOrdinal],
+				InSelectorIndex.SectionSpanLengths[InSectionOrdinal],
+				OutSectionObject)
+			&& GetReadQueryStringFieldOrEmpty(OutSectionObject, TEXT("section_name")) == InSelectorIndex.SectionNames[InSectionOrdinal]
+			&& GetReadQueryStringFieldOrEmpty(OutSectionObject, TEXT("object_path"))
+				== InSelectorIndex.AssetObjectPaths[InSelectorIndex.SectionAssetOrdinals[InSectionOrdinal]];
+	}
+
+	// LoadReadQuerySelectorSectionData는 source 파일 크기와 value span CRC32가 index 기록과 같을 때 그 byte 구간만 읽어 section data로 해석한다.
+	bool LoadReadQuerySelectorSectionData(
+		const FReadQuerySelectorIndex& InSelectorIndex,
+		int32 InSectionOrdinal,
+		const FString& InSourceFilePath,
+		TSharedPtr<FJsonValue>& OutDataValue)
+	{
+		OutDataValue.Reset();
+		if (!InSelectorIndex.SectionSourceOffsets.IsValidIndex(InSectionOrdinal)
+			|| InSelectorIndex.SectionSourceOffsets[InSectionOrdinal] < 0)
+		{
+			return false;
+		}
+
+		FADumpJsonValueSpan SourceValueSpan;
+		SourceValueSpan.Offset = InSelectorIndex.SectionSourceOffsets[InSectionOrdinal];
+		SourceValueSpan.Length = InSelectorIndex.SectionSourceLengths[InSectionOrdinal];
+		SourceValueSpan.Crc = InSelectorIndex.SectionSourceCrcs[InSectionOrdinal];
+		return ADumpQueryIO::LoadJsonValueFromFileSpan(
+			InSourceFilePath,
+			InSelectorIndex.SectionSourceFileBytes[InSectionOrdinal],
+			SourceValueSpan,
+			OutDataValue);
+	}
+
+	// ValidateReadQuerySelectorIndexContract는 모든 asset/section key가 hash probe로 자기 ordinal에 닿고 span이 같은 entry를 가리키는지 검사한다.
+	bool ValidateReadQuerySelectorIndexContract(const FString& InDumpRootPath, int32& OutAssetCount, int32& OutSectionCount, FString& OutDetail)
+	{
+		OutAssetCount = 0;
+		OutSectionCount = 0;
+		OutDetail.Reset();
+
+		FReadQuerySelectorIndex SelectorIndex;
+		if (!LoadReadQuerySelectorIndex(InDumpRootPath, SelectorIndex))
+		{
+			OutDetail = TEXT("selector_index_unreadable_or_stale");
+			return false;
+		}
+
+		TArray<int32> PathAssetOrdinals;
+		TArray<int32> IdAssetOrdinals;
+		for (int32 AssetOrdinal = 0; AssetOrdinal < SelectorIndex.AssetObjectPaths.Num(); ++AssetOrdinal)
+		{
+			TSharedPtr<FJsonObject> AssetObject;
+			FindReadQuerySelectorAssetOrdinals(SelectorIndex, false, SelectorIndex.AssetObjectPaths[AssetOrdinal], PathAssetOrdinals);
+			FindReadQuerySelectorAssetOrdinals(SelectorIndex, true, SelectorIndex.AssetIds[AssetOrdinal], IdAssetOrdinals);
+			if (!PathAssetOrdinals.Contains(AssetOrdinal) || !IdAssetOrdinals.Contains(AssetOrdinal))
+			{
+				OutDetail = FString::Printf(TEXT("asset_probe_mismatch:%d"), AssetOrdinal);
+				return false;
+			}
+			if (PathAssetOrdinals.Num() != 1 || IdAssetOrdinals.Num() != 1)
+			{
+				OutDetail = FString::Printf(TEXT("asset_key_duplicate:%d"), AssetOrdinal);
+				return false;
+			}
+			if (!LoadReadQuerySelectorAssetObject(SelectorIndex, AssetOrdinal, AssetObject))
+			{
+				OutDetail = FString::Printf(TEXT("asset_span_mismatch:%d"), AssetOrdinal);
+				return false;
+			}
+		}
+
+		TArray<int32> SectionOrdinals;
+		int32 SourceSpanCount = 0;
+		for (int32 SectionOrdinal = 0; SectionOrdinal < SelectorIndex.SectionNames.Num(); ++SectionOrdinal)
+		{
+			TSharedPtr<FJsonObject> SectionObject;
+			FindReadQuerySelectorSectionOrdinals(
+				SelectorIndex,
+				SelectorIndex.SectionAssetOrdinals[SectionOrdinal],
+				SelectorIndex.SectionNames[SectionOrdinal],
+				SectionOrdinals);
+			if (!SectionOrdinals.Contains(SectionOrdinal))
+			{
+				OutDetail = FString::Printf(TEXT("section_probe_mismatch:%d"), SectionOrdinal);
+				return false;
+			}
+			if (!LoadReadQuerySelectorSectionObject(SelectorIndex, SectionOrdinal, SectionObject))
+			{
+				OutDetail = FString::Printf(TEXT("section_span_mismatch:%d"), SectionOrdinal);
+				return false;
+			}
+
+			TSharedPtr<FJsonValue> SectionDataValue;
+			if (SelectorIndex.SectionSourceOffsets[SectionOrdinal] >= 0)
+			{
+				const FString SourceFilePath = FPaths::Combine(InDumpRootPath, GetReadQueryStringFieldOrEmpty(SectionObject, TEXT("source_file")));
+				if (!LoadReadQuerySelectorSectionData(SelectorIndex, SectionOrdinal, SourceFilePath, SectionDataValue))
+				{
+					OutDetail = FString::Printf(TEXT("section_source_span_mismatch:%d"), SectionOrdinal);
+					return false;
+				}
+				++SourceSpanCount;
+			}
+		}
+
+		OutAssetCount = SelectorIndex.AssetObjectPaths.Num();
+		OutSectionCount = SelectorIndex.SectionNames.Num();
+		OutDetail = FString::Printf(TEXT("assets=%d sections=%d source_spans=%d slots=%d"), OutAssetCount, OutSectionCount, SourceSpanCount, SelectorIndex.SlotMask + 1);
+		return true;
+	}
+
+	// BuildReadQueryLazySectionDumpObject는 accepted index에서 요청 section만 읽어 lazy_section_dump_v1 object를 만든다.
+	// InLoadItemLimit/InLoadByteLimit를 넘는 뒤쪽 section은 index 검증만 하고 source를 읽지 않아 data가 null로 남는다.
+	bool BuildReadQueryLazySectionDumpObject(
+		const FString& InDumpRootPath,
+		const FString& InAssetObjectPathSelector,
+		const FString& InAssetIdSelector,
+		const TArray<FString>& InRequestedSectionNames,
+		int32 InLoadItemLimit,
+		int64 InLoadByteLimit,
+		TSharedPtr<FJsonObject>& OutRootObject,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutRootObject.Reset();
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+
+		auto Fail = [&OutErrorCode, &OutErrorDetail](const TCHAR* InCode, const FString& InDetail)
+		{
+			OutErrorCode = InCode;
+			OutErrorDetail = InDetail;
+			return false;
+		};
+
+		const FString AssetIndexFilePath = FPaths::Combine(InDumpRootPath, TEXT("asset_index.json"));
+		const FString SectionIndexFilePath = FPaths::Combine(InDumpRootPath, TEXT("section_index.json"));
+		if (!IFileManager::Get().FileExists(*AssetIndexFilePath)
+			|| !IFileManager::Get().FileExists(*SectionIndexFilePath))
+		{
+			return Fail(
+				TEXT("ADUMP_LAZY_DUMP_INDEX_NOT_FOUND"),
+				FString::Printf(TEXT("Required indexes are missing under dump root: %s"), *InDumpRootPath));
+		}
+
+		const TArray<FString>& RequestedSectionArray = InRequestedSectionNames;
+		TSharedPtr<FJsonObject> ResolvedAssetObject;
+		int32 AssetMatchCount = 0;
+
+		// SectionMatchObjectArrays는 요청 section 순서별로 resolved asset에 색인된 section entry 후보다.
+		TArray<TArray<TSharedPtr<FJsonObject>>> SectionMatchObjectArrays;
+		SectionMatchObjectArrays.SetNum(RequestedSectionArray.Num());
+
+		// SectionMatchOrdinals는 selector index로 찾은 요청 section별 마지막 section ordinal이다. 선형 경로에서는 INDEX_NONE이다.
+		TArray<int32> SectionMatchOrdinals;
+		SectionMatchOrdinals.Init(INDEX_NONE, RequestedSectionArray.Num());
+
+		// selector_index_v1이 현재 index와 일치하면 hash probe와 entry byte span 읽기만으로 asset/section을 찾는다.
+		FReadQuerySelectorIndex SelectorIndex;
+		bool bResolvedBySelectorIndex = LoadReadQuerySelectorIndex(InDumpRootPath, SelectorIndex);
+		if (bResolvedBySelectorIndex)
+		{
+			// MatchedAssetOrdinals는 선형 경로의 AssetMatchCount처럼 두 selector 중 하나에 맞는 asset entry를 중복 key까지 모두 센다.
+			TArray<int32> MatchedAssetOrdinals;
+			TArray<int32> SelectorAssetOrdinals;
+			if (!InAssetObjectPathSelector.IsEmpty())
+			{
+				FindReadQuerySelectorAssetOrdinals(SelectorIndex, false, InAssetObjectPathSelector, SelectorAssetOrdinals);
+				for (const int32 PathAssetOrdinal : SelectorAssetOrdinals)
+				{
+					MatchedAssetOrdinals.AddUnique(PathAssetOrdinal);
+				}
+			}
+			if (!InAssetIdSelector.IsEmpty())
+			{
+				FindReadQuerySelectorAssetOrdinals(SelectorIndex, true, InAssetIdSelector, SelectorAssetOrdinals);
+				for (const int32 IdAssetOrdinal : SelectorAssetOrdinals)
+				{
+					MatchedAssetOrdinals.AddUnique(IdAssetOrdinal);
+				}
+			}
+
+			AssetMatchCount = MatchedAssetOrdinals.Num();
+			if (AssetMatchCount == 1)
+			{
+				const int32 AssetOrdinal = MatchedAssetOrdinals[0];
+				bResolvedBySelectorIndex = LoadReadQuerySelectorAssetObject(SelectorIndex, AssetOrdinal, ResolvedAssetObject);
+
+				TArray<int32> SectionOrdinals;
+				for (int32 RequestedSectionIndex = 0; bResolvedBySelectorIndex && RequestedSectionIndex < RequestedSectionArray.Num(); ++RequestedSectionIndex)
+				{
+					FindReadQuerySelectorSectionOrdinals(SelectorIndex, AssetOrdinal, RequestedSectionArray[RequestedSectionIndex], SectionOrdinals);
+					for (const int32 SectionOrdinal : SectionOrdinals)
+					{
+						TSharedPtr<FJsonObject> SectionObject;
+						if (!LoadReadQuerySelectorSectionObject(SelectorIndex, SectionOrdinal, SectionObject))
+						{
+							bResolvedBySelectorIndex = false;
+							break;
+						}
+						SectionMatchObjectArrays[RequestedSectionIndex].Add(SectionObject);
+						SectionMatchOrdinals[RequestedSectionIndex] = SectionOrdinal;
+					}
+				}
+			}
+		}
+
+		if (!bResolvedBySelectorIndex)
+		{
+			ResolvedAssetObject.Reset();
+			AssetMatchCount = 0;
+			for (TArray<TSharedPtr<FJsonObject>>& SectionMatchObjectArray : SectionMatchObjectArrays)
+			{
+				SectionMatchObjectArray.Reset();
+			}
+			SectionMatchOrdinals.Init(INDEX_NONE, RequestedSectionArray.Num());
+
+			TSharedPtr<FJsonObject> AssetIndexRootObject;
+			TSharedPtr<FJsonObject> SectionIndexRootObject;
+			if (!LoadReadQueryJsonObjectFromFile(AssetIndexFilePath, AssetIndexRootObject)
+				|| !LoadReadQueryJsonObjectFromFile(SectionIndexFilePath, SectionIndexRootObject))
+			{
+				return Fail(
+					TEXT("ADUMP_LAZY_DUMP_INDEX_JSON_INVALID"),
+					TEXT("asset_index.json or section_index.json is not a readable JSON object."));
+			}
+
+			if (GetReadQueryStringFieldOrEmpty(AssetIndexRootObject, TEXT("schema_version")) != TEXT("asset_index_v1")
+				|| GetReadQueryStringFieldOrEmpty(SectionIndexRootObject, TEXT("schema_version")) != TEXT("section_index_v1")
+				|| GetReadQueryStringFieldOrEmpty(SectionIndexRootObject, TEXT("asset_index_schema_version")) != TEXT("asset_index_v1"))
+			{
+				return Fail(
+					TEXT("ADUMP_LAZY_DUMP_INDEX_SCHEMA_UNSUPPORTED"),
+					TEXT("The selected indexes do not satisfy asset_index_v1 + section_index_v1."));
+			}
+
+			const TArray<TSharedPtr<FJsonValue>>* AssetValueArray = nullptr;
+			const TArray<TSharedPtr<FJsonValue>>* SectionValueArray = nullptr;
+			if (!AssetIndexRootObject->TryGetArrayField(TEXT("assets"), AssetValueArray) || !AssetValueArray
+				|| !SectionIndexRootObject->TryGetArrayField(TEXT("sections"), SectionValueArray) || !SectionValueArray)
+			{
+				return Fail(
+					TEXT("ADUMP_LAZY_DUMP_INDEX_SCHEMA_UNSUPPORTED"),
+					TEXT("Required assets or sections array is missing from the selected indexes."));
+			}
+
+			for (const TSharedPtr<FJsonValue>& AssetValue : *AssetValueArray)
+			{
+				const TSharedPtr<FJsonObject> AssetObject = AssetValue.IsValid() ? AssetValue->AsObject() : nullptr;
+				if (!AssetObject.IsValid())
+				{
+					return Fail(
+						TEXT("ADUMP_LAZY_DUMP_INDEX_SCHEMA_UNSUPPORTED"),
+						TEXT("asset_index_v1 contains a non-object asset entry."));
+				}
+
+				const bool bMatchesObjectPath = !InAssetObjectPathSelector.IsEmpty()
+					&& GetReadQueryStringFieldOrEmpty(AssetObject, TEXT("object_path")) == InAssetObjectPathSelector;
+				const bool bMatchesAssetId = !InAssetIdSelector.IsEmpty()
+					&& GetReadQueryStringFieldOrEmpty(AssetObject, TEXT("asset_id")) == InAssetIdSelector;
+				if (bMatchesObjectPath || bMatchesAssetId)
+				{
+					ResolvedAssetObject = AssetObject;
+					++AssetMatchCount;
+				}
+			}
+
+			if (AssetMatchCount == 1 && ResolvedAssetObject.IsValid() && RequestedSectionArray.Num() > 0)
+			{
+				const FString LinearObjectPath = GetReadQueryStringFieldOrEmpty(ResolvedAssetObject, TEXT("object_path"));
+				for (const TSharedPtr<FJsonValue>& SectionValue : *SectionValueArray)
+				{
+					const TSharedPtr<FJsonObject> SectionObject = SectionValue.IsValid() ? SectionValue->AsObject() : nullptr;
+					if (!SectionObject.IsValid())
+					{
+						return Fail(
+							TEXT("ADUMP_LAZY_DUMP_INDEX_SCHEMA_UNSUPPORTED"),
+							TEXT("section_index_v1 contains a non-object section entry."));
+					}
+
+					if (GetReadQueryStringFieldOrEmpty(SectionObject, TEXT("object_path")) != LinearObjectPath)
+					{
+						continue;
+					}
+					const int32 RequestedSectionIndex = RequestedSectionArray.IndexOfByKey(
+						GetReadQueryStringFieldOrEmpty(SectionObject, TEXT("section_name")));
+					if (RequestedSectionIndex != INDEX_NONE)
+					{
+						SectionMatchObjectArrays[RequestedSectionIndex].Add(SectionObject);
+					}
+				}
+			}
+		}
+
+		if (AssetMatchCount != 1 || !ResolvedAssetObject.IsValid())
+		{
+			const FString SelectorText = !InAssetObjectPathSelector.IsEmpty()
+				? InAssetObjectPathSelector
+				: InAssetIdSelector;
+			return Fail(
+				TEXT("ADUMP_LAZY_DUMP_ASSET_NOT_FOUND"),
+				FString::Printf(TEXT("Expected one indexed asset match for selector: %s"), *SelectorText));
+		}
+
+		const FString ResolvedObjectPath = GetReadQueryStringFieldOrEmpty(ResolvedAssetObject, TEXT("object_path"));
+		if (RequestedSectionArray.Num() == 0)
+		{
+			return Fail(
+				TEXT("ADUMP_LAZY_DUMP_SECTIONS_REQUIRED"),
+				TEXT("sectiondump requires at least one explicit canonical section."));
+		}
+
+		TMap<FString, TSharedPtr<FJsonObject>> SourceObjectByRelativePath;
+		TSet<FString> UniqueSourceFileSet;
+		TArray<TSharedPtr<FJsonValue>> SectionResultValueArray;
+		SectionResultValueArray.Reserve(RequestedSectionArray.Num());
+
+		FString NormalizedDumpRootPath = FPaths::ConvertRelativePathToFull(InDumpRootPath);
+		FPaths::NormalizeDirectoryName(NormalizedDumpRootPath);
+		FString DumpRootPrefix = NormalizedDumpRootPath;
+		if (!DumpRootPrefix.EndsWith(TEXT("/")))
+		{
+			DumpRootPrefix += TEXT("/");
+		}
+
+		// LoadedDataLowerBoundBytes는 읽은 section data가 bundle item으로 직렬화될 때의 byte 하한 누적값이다.
+		int64 LoadedDataLowerBoundBytes = 0;
+		for (int32 RequestedSectionIndex = 0; RequestedSectionIndex < RequestedSectionArray.Num(); ++RequestedSectionIndex)
+		{
+			const FString& RequestedSectionName = RequestedSectionArray[RequestedSectionIndex];
+			const TArray<TSharedPtr<FJsonObject>>& SectionMatchObjectArray = SectionMatchObjectArrays[RequestedSectionIndex];
+			const int32 SectionMatchCount = SectionMatchObjectArray.Num();
+			const TSharedPtr<FJsonObject> ResolvedSectionEntryObject = SectionMatchCount > 0 ? SectionMatchObjectArray.Last() : nullptr;
+			if (SectionMatchCount == 0)
+			{
+				return Fail(
+					TEXT("ADUMP_LAZY_DUMP_SECTION_NOT_AVAILABLE"),
+					FString::Printf(TEXT("Section '%s' is not indexed for asset: %s"), *RequestedSectionName, *ResolvedObjectPath));
+			}
+			if (SectionMatchCount != 1 || !ResolvedSectionEntryObject.IsValid())
+			{
+				return Fail(
+					TEXT("ADUMP_LAZY_DUMP_SECTION_DUPLICATE"),
+					FString::Printf(TEXT("Section '%s' has %d matching index entries for asset: %s"), *RequestedSectionName, SectionMatchCount, *ResolvedObjectPath));
+			}
+
+			const FString SourceFileText = GetReadQueryStringFieldOrEmpty(ResolvedSectionEntryObject, TEXT("source_file"));
+			const FString JsonPointerText = GetReadQueryStringFieldOrEmpty(ResolvedSectionEntryObject, TEXT("json_pointer"));
+			if (SourceFileText.IsEmpty()
+				|| !FPaths::IsRelative(SourceFileText)
+				|| SourceFileText.Contains(TEXT("\\"))
+				|| SourceFileText.StartsWith(TEXT("../")))
+			{
+				return Fail(
+					TEXT("ADUMP_LAZY_DUMP_INDEX_SCHEMA_UNSUPPORTED"),
+					FString::Printf(TEXT("Invalid indexed source path for section '%s': %s"), *RequestedSectionName, *SourceFileText));
+			}
+
+			FString SourceFilePath = FPaths::ConvertRelativePathToFull(FPaths::Combine(NormalizedDumpRootPath, SourceFileText));
+			FPaths::NormalizeFilename(SourceFilePath);
+			if (!SourceFilePath.StartsWith(DumpRootPrefix, ESearchCase::IgnoreCase))
+			{
+				return Fail(
+					TEXT("ADUMP_LAZY_DUMP_INDEX_SCHEMA_UNSUPPORTED"),
+					FString::Printf(TEXT("Indexed source escapes dump root for section '%s': %s"), *RequestedSectionName, *SourceFileText));
+			}
+
+			// 앞쪽 section만으로 item 수나 byte 하한이 budget을 넘으면 이 section은 bundle에 들어갈 수 없으므로 source를 읽지 않는다.
+			if (RequestedSectionIndex >= InLoadItemLimit || LoadedDataLowerBoundBytes > InLoadByteLimit)
+			{
+				TSharedRef<FJsonObject> SkippedSectionResultObject = MakeShared<FJsonObject>();
+				SkippedSectionResultObject->SetStringField(TEXT("section_name"), RequestedSectionName);
+				SkippedSectionResultObject->SetStringField(TEXT("section_schema_version"), GetReadQueryStringFieldOrEmpty(ResolvedSectionEntryObject, TEXT("section_schema_version")));
+				SkippedSectionResultObject->SetStringField(TEXT("source_file"), SourceFileText);
+				SkippedSectionResultObject->SetStringField(TEXT("json_pointer"), JsonPointerText);
+				SkippedSectionResultObject->SetStringField(TEXT("storage_kind"), GetReadQueryStringFieldOrEmpty(ResolvedSectionEntryObject, TEXT("storage_kind")));
+				SkippedSectionResultObject->SetField(TEXT("data"), MakeShared<FJsonValueNull>());
+				SectionResultValueArray.Add(MakeShared<FJsonValueObject>(SkippedSectionResultObject));
+				UniqueSourceFileSet.Add(SourceFileText);
+				continue;
+			}
+
+			if (!ADumpQueryIO::DoesJsonFileExist(SourceFilePath))
+			{
+				return Fail(
+					TEXT("ADUMP_LAZY_DUMP_SOURCE_FILE_NOT_FOUND"),
+					FString::Printf(TEXT("Indexed source file does not exist for section '%s': %s"), *RequestedSectionName, *SourceFileText));
+			}
+
+			// 이미 DOM으로 읽은 source가 아니면 index에 기록된 value byte span만 읽는다. 크기나 CRC32가 다르면 전체 DOM 경로로 읽는다.
+			TSharedPtr<FJsonValue> ResolvedDataValue;
+			if (SectionMatchOrdinals[RequestedSectionIndex] != INDEX_NONE && !SourceObjectByRelativePath.Contains(SourceFileText))
+			{
+				LoadReadQuerySelectorSectionData(SelectorIndex, SectionMatchOrdinals[RequestedSectionIndex], SourceFilePath, ResolvedDataValue);
+			}
+
+			if (!ResolvedDataValue.IsValid())
+			{
+				TSharedPtr<FJsonObject> SourceRootObject = SourceObjectByRelativePath.FindRef(SourceFileText);
+				if (!SourceRootObject.IsValid())
+				{
+					if (!LoadReadQueryJsonObjectFromFile(SourceFilePath, SourceRootObject))
+					{
+						return Fail(
+							TEXT("ADUMP_LAZY_DUMP_SOURCE_JSON_INVALID"),
+							FString::Printf(TEXT("Indexed source is not a readable JSON object: %s"), *SourceFileText));
+					}
+					SourceObjectByRelativePath.Add(SourceFileText, SourceRootObject);
+				}
+
+				if (JsonPointerText == TEXT("/"))
+				{
+					ResolvedDataValue = MakeShared<FJsonValueObject>(SourceRootObject.ToSharedRef());
+				}
+				else if (JsonPointerText.StartsWith(TEXT("/"))
+					&& JsonPointerText.Len() > 1
+					&& !JsonPointerText.Mid(1).Contains(TEXT("/")))
+				{
+					const FString TopLevelFieldName = JsonPointerText.Mid(1);
+					const TSharedPtr<FJsonValue> IndexedValue = SourceRootObject->TryGetField(*TopLevelFieldName);
+					if (!IndexedValue.IsValid())
+					{
+						return Fail(
+							TEXT("ADUMP_LAZY_DUMP_POINTER_NOT_FOUND"),
+							FString::Printf(TEXT("Indexed pointer does not resolve for section '%s': %s"), *RequestedSectionName, *JsonPointerText));
+					}
+					ResolvedDataValue = IndexedValue;
+				}
+				else
+				{
+					return Fail(
+						TEXT("ADUMP_LAZY_DUMP_POINTER_UNSUPPORTED"),
+						FString::Printf(TEXT("Nested or malformed pointer is outside v0.9.2 scope for section '%s': %s"), *RequestedSectionName, *JsonPointerText));
+				}
+			}
+
+			TSharedRef<FJsonObject> SectionResultObject = MakeShared<FJsonObject>();
+			SectionResultObject->SetStringField(TEXT("section_name"), RequestedSectionName);
+			SectionResultObject->SetStringField(TEXT("section_schema_version"), GetReadQueryStringFieldOrEmpty(ResolvedSectionEntryObject, TEXT("section_schema_version")));
+			SectionResultObject->SetStringField(TEXT("source_file"), SourceFileText);
+			SectionResultObject->SetStringField(TEXT("json_pointer"), JsonPointerText);
+			SectionResultObject->SetStringField(TEXT("storage_kind"), GetReadQueryStringFieldOrEmpty(ResolvedSectionEntryObject, TEXT("storage_kind")));
+			SectionResultObject->SetField(TEXT("data"), ResolvedDataValue);
+			SectionResultValueArray.Add(MakeShared<FJsonValueObject>(SectionResultObject));
+			UniqueSourceFileSet.Add(SourceFileText);
+
+			if (InLoadByteLimit < MAX_int64)
+			{
+				// DataProbeObject는 data를 depth 1에 둔 probe다. bundle item 안의 data는 더 깊게 들여쓰므로 wrapper 15 byte를 뺀 값이 하한이다.
+				TSharedRef<FJsonObject> DataProbeObject = MakeShared<FJsonObject>();
+				DataProbeObject->SetField(TEXT("data"), ResolvedDataValue);
+				FString DataProbeText;
+				if (SerializeReadQueryJsonObjectText(DataProbeObject, DataProbeText))
+				{
+					LoadedDataLowerBoundBytes += FMath::Max(0, GetReadQueryUtf8ByteLength(DataProbeText) - 16);
+				}
+			}
+		}
+
+		TArray<FString> SourceFileArray = UniqueSourceFileSet.Array();
+		SourceFileArray.Sort([](const FString& InLeft, const FString& InRight)
+		{
+			return InLeft < InRight;
+		});
+
+		TSharedRef<FJsonObject> AssetEnvelopeObject = MakeShared<FJsonObject>();
+		AssetEnvelopeObject->SetStringField(TEXT("asset_id"), GetReadQueryStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_id")));
+		AssetEnvelopeObject->SetStringField(TEXT("asset_key"), GetReadQueryStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_key")));
+		AssetEnvelopeObject->SetStringField(TEXT("object_path"), ResolvedObjectPath);
+		AssetEnvelopeObject->SetStringField(TEXT("asset_class"), GetReadQueryStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_class")));
+		AssetEnvelopeObject->SetStringField(TEXT("asset_family"), GetReadQueryStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_family")));
+		AssetEnvelopeObject->SetStringField(TEXT("fingerprint"), GetReadQueryStringFieldOrEmpty(ResolvedAssetObject, TEXT("fingerprint")));
+
+		TSharedRef<FJsonObject> ResponseRootObject = MakeShared<FJsonObject>();
+		ResponseRootObject->SetStringField(TEXT("schema_version"), TEXT("lazy_section_dump_v1"));
+		ResponseRootObject->SetStringField(TEXT("generated_time"), FDateTime::UtcNow().ToIso8601());
+		ResponseRootObject->SetStringField(TEXT("source_contract"), TEXT("indexed_stored_evidence"));
+		ResponseRootObject->SetStringField(TEXT("asset_index_schema_version"), TEXT("asset_index_v1"));
+		ResponseRootObject->SetStringField(TEXT("section_index_schema_version"), TEXT("section_index_v1"));
+		ResponseRootObject->SetObjectField(TEXT("asset"), AssetEnvelopeObject);
+		AddReadQueryStringArrayField(ResponseRootObject, TEXT("requested_sections"), RequestedSectionArray);
+		ResponseRootObject->SetNumberField(TEXT("section_count"), SectionResultValueArray.Num());
+		ResponseRootObject->SetNumberField(TEXT("source_file_count"), SourceFileArray.Num());
+		AddReadQueryStringArrayField(ResponseRootObject, TEXT("source_files"), SourceFileArray);
+		ResponseRootObject->SetArrayField(TEXT("sections"), SectionResultValueArray);
+		ResponseRootObject->SetBoolField(TEXT("all_resolved"), true);
+
+		OutRootObject = ResponseRootObject;
+		return true;
+	}
+
+	// BuildReadQueryLazySectionDumpJson은 accepted index에서 요청 section만 읽어 compact response를 만든다.
+	bool BuildReadQueryLazySectionDumpJson(
+		const FString& InDumpRootPath,
+		const FString& InAssetObjectPathSelector,
+		const FString& InAssetIdSelector,
+		const TArray<FString>& InRequestedSectionNames,
+		FString& OutJsonText,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutJsonText.Reset();
+
+		TSharedPtr<FJsonObject> ResponseRootObject;
+		if (!BuildReadQueryLazySectionDumpObject(
+			InDumpRootPath,
+			InAssetObjectPathSelector,
+			InAssetIdSelector,
+			InRequestedSectionNames,
+			MAX_int32,
+			MAX_int64,
+			ResponseRootObject,
+			OutErrorCode,
+			OutErrorDetail))
+		{
+			return false;
+		}
+
+		if (!SerializeReadQueryJsonObjectText(ResponseRootObject.ToSharedRef(), OutJsonText))
+		{
+			OutErrorCode = TEXT("ADUMP_LAZY_DUMP_SOURCE_JSON_INVALID");
+			OutErrorDetail = TEXT("Failed to serialize lazy_section_dump_v1 response.");
+			return false;
+		}
+		return true;
+	}
+
+		struct FReadQueryDependencyQueryRelation
+	{
+		FString From;
+		FString To;
+		FString Reason;
+		FString Strength;
+		FString SourceKind;
+		FString SourcePath;
+	};
+
+	struct FReadQueryDependencyQueryCandidate
+	{
+		int32 RelationIndex = INDEX_NONE;
+		FString TraversalDirection;
+		FString TraversalFrom;
+		FString TraversalTo;
+	};
+
+	struct FReadQueryDependencyQueryNode
+	{
+		FString ObjectPath;
+		FString AssetId;
+		FString AssetKey;
+		FString AssetClass;
+		FString AssetFamily;
+		bool bIndexed = false;
+		int32 MinDepth = 0;
+		bool bRootRole = false;
+		bool bDependencyRole = false;
+		bool bReferencerRole = false;
+	};
+
+	struct FReadQueryDependencyQueryEdge
+	{
+		FString RelationFrom;
+		FString RelationTo;
+		FString TraversalFrom;
+		FString TraversalTo;
+		FString TraversalDirection;
+		int32 Depth = 0;
+		FString Reason;
+		FString Strength;
+		FString SourceKind;
+		FString SourcePath;
+		bool bClosesCycle = false;
+	};
+
+	int32 GetReadQueryDependencyDirectionRank(const FString& InDirection)
+	{
+		return InDirection == TEXT("dependencies") ? 0 : 1;
+	}
+
+	// BuildReadQueryDependencyTraceQueryObject는 accepted stored indexes 위에서 bounded dependency traversal을 수행한다.
+	bool BuildReadQueryDependencyTraceQueryObject(
+		const FString& InDumpRootPath,
+		const FString& InAssetObjectPathSelector,
+		const FString& InAssetIdSelector,
+		const FString& InDirection,
+		const FString& InStrength,
+		int32 InMaxDepth,
+		int32 InMaxNodes,
+		int32 InMaxEdges,
+		TSharedPtr<FJsonObject>& OutRootObject,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutRootObject.Reset();
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+
+		auto Fail = [&OutErrorCode, &OutErrorDetail](const TCHAR* InCode, const FString& InDetail)
+		{
+			OutErrorCode = InCode;
+			OutErrorDetail = InDetail;
+			return false;
+		};
+
+		const FString AssetIndexFilePath = FPaths::Combine(InDumpRootPath, TEXT("asset_index.json"));
+		const FString DependencyIndexFilePath = FPaths::Combine(InDumpRootPath, TEXT("dependency_index.json"));
+		if (!IFileManager::Get().FileExists(*AssetIndexFilePath)
+			|| !IFileManager::Get().FileExists(*DependencyIndexFilePath))
+		{
+			return Fail(
+				TEXT("ADUMP_DEP_QUERY_INDEX_NOT_FOUND"),
+				FString::Printf(TEXT("Required asset/dependency indexes are missing under dump root: %s"), *InDumpRootPath));
+		}
+
+		TSharedPtr<FJsonObject> DependencyIndexRootObject;
+		if (!LoadReadQueryJsonObjectFromFile(DependencyIndexFilePath, DependencyIndexRootObject))
+		{
+			return Fail(
+				TEXT("ADUMP_DEP_QUERY_INDEX_JSON_INVALID"),
+				TEXT("asset_index.json or dependency_index.json is not a readable JSON object."));
+		}
+
+		// AssetObjectByPath는 object_path별 asset_index entry다. selector index 경로에서는 방문한 node만 채우는 memo다.
+		TMap<FString, TSharedPtr<FJsonObject>> AssetObjectByPath;
+		TSharedPtr<FJsonObject> ResolvedAssetObject;
+
+		// selector_index_v1이 현재 index와 일치하면 asset_index.json 전체 대신 root와 방문 node의 entry span만 읽는다.
+		// 선형 경로와 같은 asset_index_v1 계약 오류는 selector 경로에서도 같은 code/detail로 실패한다.
+		FReadQuerySelectorIndex SelectorIndex;
+		bool bUseSelectorIndex = LoadReadQuerySelectorIndex(InDumpRootPath, SelectorIndex);
+		if (bUseSelectorIndex)
+		{
+			FString SelectorContractErrorDetail;
+			bUseSelectorIndex = ValidateReadQuerySelectorAssetContract(SelectorIndex, SelectorContractErrorDetail);
+			if (!bUseSelectorIndex && !SelectorContractErrorDetail.IsEmpty())
+			{
+				return Fail(TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"), SelectorContractErrorDetail);
+			}
+		}
+		if (bUseSelectorIndex)
+		{
+			const bool bSelectByAssetId = InAssetObjectPathSelector.IsEmpty();
+			const int32 RootAssetOrdinal = FindReadQuerySelectorAssetOrdinal(
+				SelectorIndex,
+				bSelectByAssetId,
+				bSelectByAssetId ? InAssetIdSelector : InAssetObjectPathSelector);
+			if (RootAssetOrdinal != INDEX_NONE)
+			{
+				bUseSelectorIndex = LoadReadQuerySelectorAssetObject(SelectorIndex, RootAssetOrdinal, ResolvedAssetObject);
+				if (bUseSelectorIndex)
+				{
+					AssetObjectByPath.Add(SelectorIndex.AssetObjectPaths[RootAssetOrdinal], ResolvedAssetObject);
+				}
+			}
+		}
+
+		if (!bUseSelectorIndex)
+		{
+			ResolvedAssetObject.Reset();
+			TSharedPtr<FJsonObject> AssetIndexRootObject;
+			if (!LoadReadQueryJsonObjectFromFile(AssetIndexFilePath, AssetIndexRootObject))
+			{
+				return Fail(
+					TEXT("ADUMP_DEP_QUERY_INDEX_JSON_INVALID"),
+					TEXT("asset_index.json or dependency_index.json is not a readable JSON object."));
+			}
+
+			if (GetReadQueryStringFieldOrEmpty(AssetIndexRootObject, TEXT("schema_version")) != TEXT("asset_index_v1"))
+			{
+				return Fail(
+					TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
+					TEXT("The selected asset index is not asset_index_v1."));
+			}
+
+			const TArray<TSharedPtr<FJsonValue>>* AssetValueArray = nullptr;
+			if (!AssetIndexRootObject->TryGetArrayField(TEXT("assets"), AssetValueArray) || !AssetValueArray)
+			{
+				return Fail(
+					TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
+					TEXT("asset_index_v1 assets array is missing."));
+			}
+
+			double AssetCountValue = -1.0;
+			if (!AssetIndexRootObject->TryGetNumberField(TEXT("asset_count"), AssetCountValue)
+				|| !FMath::IsNearlyEqual(AssetCountValue, static_cast<double>(AssetValueArray->Num())))
+			{
+				return Fail(
+					TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
+					TEXT("asset_index_v1 asset_count does not agree with assets[]."));
+			}
+
+			TMap<FString, TSharedPtr<FJsonObject>> AssetObjectById;
+			for (const TSharedPtr<FJsonValue>& AssetValue : *AssetValueArray)
+			{
+				if (!AssetValue.IsValid() || AssetValue->Type != EJson::Object)
+				{
+					return Fail(
+						TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
+						TEXT("asset_index_v1 contains a non-object asset entry."));
+				}
+
+				const TSharedPtr<FJsonObject> AssetObject = AssetValue->AsObject();
+				const FString AssetIdText = GetReadQueryStringFieldOrEmpty(AssetObject, TEXT("asset_id"));
+				const FString ObjectPathText = GetReadQueryStringFieldOrEmpty(AssetObject, TEXT("object_path"));
+				if (AssetIdText.IsEmpty()
+					|| ObjectPathText.IsEmpty()
+					|| !ObjectPathText.StartsWith(TEXT("/"))
+					|| AssetObjectById.Contains(AssetIdText)
+					|| AssetObjectByPath.Contains(ObjectPathText))
+				{
+					return Fail(
+						TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
+						TEXT("asset_index_v1 contains an invalid or duplicate asset identity."));
+				}
+				AssetObjectById.Add(AssetIdText, AssetObject);
+				AssetObjectByPath.Add(ObjectPathText, AssetObject);
+			}
+
+			if (!InAssetObjectPathSelector.IsEmpty())
+			{
+				ResolvedAssetObject = AssetObjectByPath.FindRef(InAssetObjectPathSelector);
+			}
+			else if (!InAssetIdSelector.IsEmpty())
+			{
+				ResolvedAssetObject = AssetObjectById.FindRef(InAssetIdSelector);
+			}
+		}
+
+		if (!ResolvedAssetObject.IsValid())
+		{
+			const FString SelectorText = !InAssetObjectPathSelector.IsEmpty()
+				? InAssetObjectPathSelector
+				: InAssetIdSelector;
+			return Fail(
+				TEXT("ADUMP_DEP_QUERY_ASSET_NOT_FOUND"),
+				FString::Printf(TEXT("No indexed asset matches selector: %s"), *SelectorText));
+		}
+
+		FString DependencyGeneratedTime;
+		const TArray<TSharedPtr<FJsonValue>>* RelationValueArray = nullptr;
+		double RelationCountValue = -1.0;
+		if (!DependencyIndexRootObject->TryGetStringField(TEXT("generated_time"), DependencyGeneratedTime)
+			|| DependencyGeneratedTime.IsEmpty()
+			|| !DependencyIndexRootObject->TryGetArrayField(TEXT("relations"), RelationValueArray)
+			|| !RelationValueArray
+			|| !DependencyIndexRootObject->TryGetNumberField(TEXT("relation_count"), RelationCountValue)
+			|| !FMath::IsNearlyEqual(RelationCountValue, static_cast<double>(RelationValueArray ? RelationValueArray->Num() : 0)))
+		{
+			return Fail(
+				TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
+				TEXT("dependency_index.json root contract is unsupported."));
+		}
+
+		TArray<FReadQueryDependencyQueryRelation> RelationArray;
+		RelationArray.Reserve(RelationValueArray->Num());
+		for (const TSharedPtr<FJsonValue>& RelationValue : *RelationValueArray)
+		{
+			if (!RelationValue.IsValid() || RelationValue->Type != EJson::Object)
+			{
+				return Fail(
+					TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
+					TEXT("dependency_index.json contains a non-object relation."));
+			}
+
+			const TSharedPtr<FJsonObject> RelationObject = RelationValue->AsObject();
+			FReadQueryDependencyQueryRelation Relation;
+			if (!RelationObject->TryGetStringField(TEXT("from"), Relation.From)
+				|| !RelationObject->TryGetStringField(TEXT("to"), Relation.To)
+				|| !RelationObject->TryGetStringField(TEXT("reason"), Relation.Reason)
+				|| !RelationObject->TryGetStringField(TEXT("strength"), Relation.Strength)
+				|| !RelationObject->TryGetStringField(TEXT("source_kind"), Relation.SourceKind)
+				|| !RelationObject->TryGetStringField(TEXT("source_path"), Relation.SourcePath)
+				|| Relation.From.IsEmpty()
+				|| Relation.To.IsEmpty()
+				|| !Relation.From.StartsWith(TEXT("/"))
+				|| !Relation.To.StartsWith(TEXT("/"))
+				|| (Relation.Strength != TEXT("hard") && Relation.Strength != TEXT("soft")))
+			{
+				return Fail(
+					TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
+					TEXT("dependency_index.json contains an invalid relation contract."));
+			}
+			RelationArray.Add(MoveTemp(Relation));
+		}
+
+		const FString RootObjectPath = GetReadQueryStringFieldOrEmpty(ResolvedAssetObject, TEXT("object_path"));
+		TArray<FReadQueryDependencyQueryNode> NodeArray;
+		TMap<FString, int32> NodeIndexByPath;
+		TMap<FString, FString> ParentPathByPath;
+		TArray<FString> QueuePathArray;
+		int32 QueueReadIndex = 0;
+
+		// bSelectorSpanMismatch는 traversal 중 selector span이 asset_index entry와 어긋났는지 여부다.
+		bool bSelectorSpanMismatch = false;
+		auto FindIndexedAssetObject = [&AssetObjectByPath, &SelectorIndex, &bSelectorSpanMismatch, bUseSelectorIndex](const FString& InObjectPath)
+		{
+			if (const TSharedPtr<FJsonObject>* CachedAssetObject = AssetObjectByPath.Find(InObjectPath))
+			{
+				return *CachedAssetObject;
+			}
+			TSharedPtr<FJsonObject> AssetObject;
+			if (bUseSelectorIndex)
+			{
+				const int32 AssetOrdinal = FindReadQuerySelectorAssetOrdinal(SelectorIndex, false, InObjectPath);
+				if (AssetOrdinal != INDEX_NONE && !LoadReadQuerySelectorAssetObject(SelectorIndex, AssetOrdinal, AssetObject))
+				{
+					bSelectorSpanMismatch = true;
+					AssetObject.Reset();
+				}
+				AssetObjectByPath.Add(InObjectPath, AssetObject);
+			}
+			return AssetObject;
+		};
+
+		auto MakeNode = [&FindIndexedAssetObject](const FString& InObjectPath, int32 InDepth)
+		{
+			FReadQueryDependencyQueryNode Node;
+			Node.ObjectPath = InObjectPath;
+			Node.MinDepth = InDepth;
+			const TSharedPtr<FJsonObject> IndexedAssetObject = FindIndexedAssetObject(InObjectPath);
+			if (IndexedAssetObject.IsValid())
+			{
+				Node.bIndexed = true;
+				Node.AssetId = GetReadQueryStringFieldOrEmpty(IndexedAssetObject, TEXT("asset_id"));
+				Node.AssetKey = GetReadQueryStringFieldOrEmpty(IndexedAssetObject, TEXT("asset_key"));
+				Node.AssetClass = GetReadQueryStringFieldOrEmpty(IndexedAssetObject, TEXT("asset_class"));
+				Node.AssetFamily = GetReadQueryStringFieldOrEmpty(IndexedAssetObject, TEXT("asset_family"));
+			}
+			return Node;
+		};
+
+		FReadQueryDependencyQueryNode RootNode = MakeNode(RootObjectPath, 0);
+		RootNode.bRootRole = true;
+		NodeIndexByPath.Add(RootObjectPath, NodeArray.Add(MoveTemp(RootNode)));
+		ParentPathByPath.Add(RootObjectPath, FString());
+		QueuePathArray.Add(RootObjectPath);
+
+		TArray<FReadQueryDependencyQueryEdge> EdgeArray;
+		TSet<FString> TruncationReasonSet;
+		bool bStopForEdgeLimit = false;
+
+		while (QueueReadIndex < QueuePathArray.Num() && !bStopForEdgeLimit)
+		{
+			const FString CurrentPath = QueuePathArray[QueueReadIndex++];
+			const int32* CurrentNodeIndexPtr = NodeIndexByPath.Find(CurrentPath);
+			if (!CurrentNodeIndexPtr)
+			{
+				continue;
+			}
+			const int32 CurrentDepth = NodeArray[*CurrentNodeIndexPtr].MinDepth;
+			if (CurrentDepth >= InMaxDepth)
+			{
+				continue;
+			}
+
+			TArray<FReadQueryDependencyQueryCandidate> CandidateArray;
+			for (int32 RelationIndex = 0; RelationIndex < RelationArray.Num(); ++RelationIndex)
+			{
+				const FReadQueryDependencyQueryRelation& Relation = RelationArray[RelationIndex];
+				if (InStrength != TEXT("all") && Relation.Strength != InStrength)
+				{
+					continue;
+				}
+
+				if ((InDirection == TEXT("dependencies") || InDirection == TEXT("both"))
+					&& Relation.From == CurrentPath)
+				{
+					FReadQueryDependencyQueryCandidate Candidate;
+					Candidate.RelationIndex = RelationIndex;
+					Candidate.TraversalDirection = TEXT("dependencies");
+					Candidate.TraversalFrom = CurrentPath;
+					Candidate.TraversalTo = Relation.To;
+					CandidateArray.Add(MoveTemp(Candidate));
+				}
+
+				if ((InDirection == TEXT("referencers") || InDirection == TEXT("both"))
+					&& Relation.To == CurrentPath
+					&& !(InDirection == TEXT("both") && Relation.From == Relation.To))
+				{
+					FReadQueryDependencyQueryCandidate Candidate;
+					Candidate.RelationIndex = RelationIndex;
+					Candidate.TraversalDirection = TEXT("referencers");
+					Candidate.TraversalFrom = CurrentPath;
+					Candidate.TraversalTo = Relation.From;
+					CandidateArray.Add(MoveTemp(Candidate));
+				}
+			}
+
+			CandidateArray.Sort([&RelationArray](const FReadQueryDependencyQueryCandidate& InLeft, const FReadQueryDependencyQueryCandidate& InRight)
+			{
+				const int32 LeftDirectionRank = GetReadQueryDependencyDirectionRank(InLeft.TraversalDirection);
+				const int32 RightDirectionRank = GetReadQueryDependencyDirectionRank(InRight.TraversalDirection);
+				if (LeftDirectionRank != RightDirectionRank)
+				{
+					return LeftDirectionRank < RightDirectionRank;
+				}
+
+								auto CompareText = [](const FString& InA, const FString& InB)
+				{
+					return InA.Compare(InB, ESearchCase::CaseSensitive);
+				};
+
+				int32 CompareResult = CompareText(InLeft.TraversalTo, InRight.TraversalTo);
+				if (CompareResult != 0) return CompareResult < 0;
+				const FReadQueryDependencyQueryRelation& LeftRelation = RelationArray[InLeft.RelationIndex];
+				const FReadQueryDependencyQueryRelation& RightRelation = RelationArray[InRight.RelationIndex];
+				CompareResult = CompareText(LeftRelation.From, RightRelation.From);
+				if (CompareResult != 0) return CompareResult < 0;
+				CompareResult = CompareText(LeftRelation.To, RightRelation.To);
+				if (CompareResult != 0) return CompareResult < 0;
+				CompareResult = CompareText(LeftRelation.Strength, RightRelation.Strength);
+				if (CompareResult != 0) return CompareResult < 0;
+				CompareResult = CompareText(LeftRelation.Reason, RightRelation.Reason);
+				if (CompareResult != 0) return CompareResult < 0;
+				CompareResult = CompareText(LeftRelation.SourceKind, RightRelation.SourceKind);
+				if (CompareResult != 0) return CompareResult < 0;
+				return CompareText(LeftRelation.SourcePath, RightRelation.SourcePath) < 0;
+			});
+
+			for (const FReadQueryDependencyQueryCandidate& Candidate : CandidateArray)
+			{
+				if (EdgeArray.Num() >= InMaxEdges)
+				{
+					TruncationReasonSet.Add(TEXT("max_edges"));
+					bStopForEdgeLimit = true;
+					break;
+				}
+
+				const bool bNodeAlreadyExists = NodeIndexByPath.Contains(Candidate.TraversalTo);
+				if (!bNodeAlreadyExists && NodeArray.Num() >= InMaxNodes)
+				{
+					TruncationReasonSet.Add(TEXT("max_nodes"));
+					continue;
+				}
+
+				bool bClosesCycle = false;
+				FString AncestorPath = CurrentPath;
+				while (!AncestorPath.IsEmpty())
+				{
+					if (Candidate.TraversalTo == AncestorPath)
+					{
+						bClosesCycle = true;
+						break;
+					}
+					const FString* ParentPath = ParentPathByPath.Find(AncestorPath);
+					if (!ParentPath)
+					{
+						break;
+					}
+					AncestorPath = *ParentPath;
+				}
+
+				int32 TargetNodeIndex = INDEX_NONE;
+				if (const int32* ExistingNodeIndex = NodeIndexByPath.Find(Candidate.TraversalTo))
+				{
+					TargetNodeIndex = *ExistingNodeIndex;
+				}
+				else
+				{
+					FReadQueryDependencyQueryNode NewNode = MakeNode(Candidate.TraversalTo, CurrentDepth + 1);
+					TargetNodeIndex = NodeArray.Add(MoveTemp(NewNode));
+					NodeIndexByPath.Add(Candidate.TraversalTo, TargetNodeIndex);
+					ParentPathByPath.Add(Candidate.TraversalTo, CurrentPath);
+					QueuePathArray.Add(Candidate.TraversalTo);
+				}
+
+				if (Candidate.TraversalDirection == TEXT("dependencies"))
+				{
+					NodeArray[TargetNodeIndex].bDependencyRole = true;
+				}
+				else
+				{
+					NodeArray[TargetNodeIndex].bReferencerRole = true;
+				}
+
+				const FReadQueryDependencyQueryRelation& Relation = RelationArray[Candidate.RelationIndex];
+				FReadQueryDependencyQueryEdge Edge;
+				Edge.RelationFrom = Relation.From;
+				Edge.RelationTo = Relation.To;
+				Edge.TraversalFrom = Candidate.TraversalFrom;
+				Edge.TraversalTo = Candidate.TraversalTo;
+				Edge.TraversalDirection = Candidate.TraversalDirection;
+				Edge.Depth = CurrentDepth + 1;
+				Edge.Reason = Relation.Reason;
+				Edge.Strength = Relation.Strength;
+				Edge.SourceKind = Relation.SourceKind;
+				Edge.SourcePath = Relation.SourcePath;
+				Edge.bClosesCycle = bClosesCycle;
+				EdgeArray.Add(MoveTemp(Edge));
+			}
+		}
+
+		if (bSelectorSpanMismatch)
+		{
+			return Fail(
+				TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED"),
+				TEXT("selector_index.json spans do not match asset_index.json; rebuild indexes with -Mode=index."));
+		}
+
+		NodeArray.Sort([](const FReadQueryDependencyQueryNode& InLeft, const FReadQueryDependencyQueryNode& InRight)
+		{
+			if (InLeft.MinDepth != InRight.MinDepth)
+			{
+				return InLeft.MinDepth < InRight.MinDepth;
+			}
+						return InLeft.ObjectPath.Compare(InRight.ObjectPath, ESearchCase::CaseSensitive) < 0;
+		});
+
+		EdgeArray.Sort([](const FReadQueryDependencyQueryEdge& InLeft, const FReadQueryDependencyQueryEdge& InRight)
+		{
+			if (InLeft.Depth != InRight.Depth) return InLeft.Depth < InRight.Depth;
+			const int32 LeftDirectionRank = GetReadQueryDependencyDirectionRank(InLeft.TraversalDirection);
+			const int32 RightDirectionRank = GetReadQueryDependencyDirectionRank(InRight.TraversalDirection);
+			if (LeftDirectionRank != RightDirectionRank) return LeftDirectionRank < RightDirectionRank;
+
+						auto CompareText = [](const FString& InA, const FString& InB)
+			{
+				return InA.Compare(InB, ESearchCase::CaseSensitive);
+			};
+			int32 CompareResult = CompareText(InLeft.TraversalFrom, InRight.TraversalFrom);
+			if (CompareResult != 0) return CompareResult < 0;
+			CompareResult = CompareText(InLeft.TraversalTo, InRight.TraversalTo);
+			if (CompareResult != 0) return CompareResult < 0;
+			CompareResult = CompareText(InLeft.RelationFrom, InRight.RelationFrom);
+			if (CompareResult != 0) return CompareResult < 0;
+			CompareResult = CompareText(InLeft.RelationTo, InRight.RelationTo);
+			if (CompareResult != 0) return CompareResult < 0;
+			CompareResult = CompareText(InLeft.Strength, InRight.Strength);
+			if (CompareResult != 0) return CompareResult < 0;
+			CompareResult = CompareText(InLeft.Reason, InRight.Reason);
+			if (CompareResult != 0) return CompareResult < 0;
+			CompareResult = CompareText(InLeft.SourceKind, InRight.SourceKind);
+			if (CompareResult != 0) return CompareResult < 0;
+			return CompareText(InLeft.SourcePath, InRight.SourcePath) < 0;
+		});
+
+		TArray<TSharedPtr<FJsonValue>> NodeValueArray;
+		NodeValueArray.Reserve(NodeArray.Num());
+		int32 MaxObservedDepth = 0;
+		for (int32 NodeIndex = 0; NodeIndex < NodeArray.Num(); ++NodeIndex)
+		{
+			const FReadQueryDependencyQueryNode& Node = NodeArray[NodeIndex];
+			MaxObservedDepth = FMath::Max(MaxObservedDepth, Node.MinDepth);
+			TSharedRef<FJsonObject> NodeObject = MakeShared<FJsonObject>();
+			NodeObject->SetStringField(TEXT("node_id"), FString::Printf(TEXT("node_%04d"), NodeIndex));
+			NodeObject->SetStringField(TEXT("object_path"), Node.ObjectPath);
+			NodeObject->SetStringField(TEXT("asset_id"), Node.AssetId);
+			NodeObject->SetStringField(TEXT("asset_key"), Node.AssetKey);
+			NodeObject->SetStringField(TEXT("asset_class"), Node.AssetClass);
+			NodeObject->SetStringField(TEXT("asset_family"), Node.AssetFamily);
+			NodeObject->SetBoolField(TEXT("indexed"), Node.bIndexed);
+			NodeObject->SetNumberField(TEXT("min_depth"), Node.MinDepth);
+			TArray<FString> RoleArray;
+			if (Node.bRootRole) RoleArray.Add(TEXT("root"));
+			if (Node.bDependencyRole) RoleArray.Add(TEXT("dependency"));
+			if (Node.bReferencerRole) RoleArray.Add(TEXT("referencer"));
+			AddReadQueryStringArrayField(NodeObject, TEXT("roles"), RoleArray);
+			NodeValueArray.Add(MakeShared<FJsonValueObject>(NodeObject));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> EdgeValueArray;
+		EdgeValueArray.Reserve(EdgeArray.Num());
+		int32 CycleEdgeCount = 0;
+		for (int32 EdgeIndex = 0; EdgeIndex < EdgeArray.Num(); ++EdgeIndex)
+		{
+			const FReadQueryDependencyQueryEdge& Edge = EdgeArray[EdgeIndex];
+			if (Edge.bClosesCycle) ++CycleEdgeCount;
+			TSharedRef<FJsonObject> EdgeObject = MakeShared<FJsonObject>();
+			EdgeObject->SetStringField(TEXT("edge_id"), FString::Printf(TEXT("edge_%06d"), EdgeIndex));
+			EdgeObject->SetStringField(TEXT("relation_from"), Edge.RelationFrom);
+			EdgeObject->SetStringField(TEXT("relation_to"), Edge.RelationTo);
+			EdgeObject->SetStringField(TEXT("traversal_from"), Edge.TraversalFrom);
+			EdgeObject->SetStringField(TEXT("traversal_to"), Edge.TraversalTo);
+			EdgeObject->SetStringField(TEXT("traversal_direction"), Edge.TraversalDirection);
+			EdgeObject->SetNumberField(TEXT("depth"), Edge.Depth);
+			EdgeObject->SetStringField(TEXT("reason"), Edge.Reason);
+			EdgeObject->SetStringField(TEXT("strength"), Edge.Strength);
+			EdgeObject->SetStringField(TEXT("source_kind"), Edge.SourceKind);
+			EdgeObject->SetStringField(TEXT("source_path"), Edge.SourcePath);
+			EdgeObject->SetBoolField(TEXT("closes_cycle"), Edge.bClosesCycle);
+			EdgeValueArray.Add(MakeShared<FJsonValueObject>(EdgeObject));
+		}
+
+		TArray<FString> TruncationReasonArray;
+		if (TruncationReasonSet.Contains(TEXT("max_nodes"))) TruncationReasonArray.Add(TEXT("max_nodes"));
+		if (TruncationReasonSet.Contains(TEXT("max_edges"))) TruncationReasonArray.Add(TEXT("max_edges"));
+
+		TSharedRef<FJsonObject> QueryObject = MakeShared<FJsonObject>();
+		QueryObject->SetStringField(TEXT("selector_kind"), !InAssetObjectPathSelector.IsEmpty() ? TEXT("object_path") : TEXT("asset_id"));
+		QueryObject->SetStringField(TEXT("root_object_path"), RootObjectPath);
+		QueryObject->SetStringField(TEXT("direction"), InDirection);
+		QueryObject->SetStringField(TEXT("strength"), InStrength);
+		QueryObject->SetNumberField(TEXT("max_depth"), InMaxDepth);
+		QueryObject->SetNumberField(TEXT("max_nodes"), InMaxNodes);
+		QueryObject->SetNumberField(TEXT("max_edges"), InMaxEdges);
+
+		TSharedRef<FJsonObject> RootAssetObject = MakeShared<FJsonObject>();
+		RootAssetObject->SetStringField(TEXT("asset_id"), GetReadQueryStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_id")));
+		RootAssetObject->SetStringField(TEXT("asset_key"), GetReadQueryStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_key")));
+		RootAssetObject->SetStringField(TEXT("object_path"), RootObjectPath);
+		RootAssetObject->SetStringField(TEXT("asset_class"), GetReadQueryStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_class")));
+		RootAssetObject->SetStringField(TEXT("asset_family"), GetReadQueryStringFieldOrEmpty(ResolvedAssetObject, TEXT("asset_family")));
+		RootAssetObject->SetStringField(TEXT("fingerprint"), GetReadQueryStringFieldOrEmpty(ResolvedAssetObject, TEXT("fingerprint")));
+
+		TSharedRef<FJsonObject> ResponseRootObject = MakeShared<FJsonObject>();
+		ResponseRootObject->SetStringField(TEXT("schema_version"), TEXT("dependency_trace_query_v1"));
+		ResponseRootObject->SetStringField(TEXT("generated_time"), FDateTime::UtcNow().ToIso8601());
+		ResponseRootObject->SetStringField(TEXT("source_contract"), TEXT("indexed_dependency_evidence"));
+		ResponseRootObject->SetStringField(TEXT("asset_index_schema_version"), TEXT("asset_index_v1"));
+		ResponseRootObject->SetStringField(TEXT("dependency_index_contract_version"), TEXT("legacy_dependency_index_v1"));
+		ResponseRootObject->SetObjectField(TEXT("query"), QueryObject);
+		ResponseRootObject->SetObjectField(TEXT("root_asset"), RootAssetObject);
+		ResponseRootObject->SetNumberField(TEXT("node_count"), NodeValueArray.Num());
+		ResponseRootObject->SetNumberField(TEXT("edge_count"), EdgeValueArray.Num());
+		ResponseRootObject->SetNumberField(TEXT("max_observed_depth"), MaxObservedDepth);
+		ResponseRootObject->SetNumberField(TEXT("cycle_edge_count"), CycleEdgeCount);
+		ResponseRootObject->SetBoolField(TEXT("truncated"), TruncationReasonArray.Num() > 0);
+		AddReadQueryStringArrayField(ResponseRootObject, TEXT("truncation_reasons"), TruncationReasonArray);
+		ResponseRootObject->SetArrayField(TEXT("nodes"), NodeValueArray);
+		ResponseRootObject->SetArrayField(TEXT("edges"), EdgeValueArray);
+		ResponseRootObject->SetBoolField(TEXT("all_resolved"), true);
+
+		OutRootObject = ResponseRootObject;
+		return true;
+	}
+
+	// BuildReadQueryDependencyTraceQueryJson은 dependency_trace_query_v1 object를 native response 문자열로 직렬화한다.
+	bool BuildReadQueryDependencyTraceQueryJson(
+		const FString& InDumpRootPath,
+		const FString& InAssetObjectPathSelector,
+		const FString& InAssetIdSelector,
+		const FString& InDirection,
+		const FString& InStrength,
+		int32 InMaxDepth,
+		int32 InMaxNodes,
+		int32 InMaxEdges,
+		FString& OutJsonText,
+		FString& OutErrorCode,
+		FString& OutErrorDetail)
+	{
+		OutJsonText.Reset();
+
+		TSharedPtr<FJsonObject> ResponseRootObject;
+		if (!BuildReadQueryDependencyTraceQueryObject(
+			InDumpRootPath,
+			InAssetObjectPathSelector,
+			InAssetIdSelector,
+			InDirection,
+			InStrength,
+			InMaxDepth,
+			InMaxNodes,
+			InMaxEdges,
+			ResponseRootObject,
+			OutErrorCode,
+			OutErrorDetail))
+		{
+			return false;
+		}
+
+		if (!SerializeReadQueryJsonObjectText(ResponseRootObject.ToSharedRef(), OutJsonText))
+		{
+			OutErrorCode = TEXT("ADUMP_DEP_QUERY_INDEX_CONTRACT_UNSUPPORTED");
+			OutErrorDetail = TEXT("Failed to serialize dependency_trace_query_v1 response.");
+			return false;
+		}
+		return true;
+	}
+
+	// BuildReadQueryQueryResultObject는 accepted native query object를 query_result_v1 success envelope object로 감싼다.
+	bool BuildReadQueryQueryResultObject(
+		const FString& InQueryKind,
+		const FString& InSelectorKind,
+		const TSharedPtr<FJsonObject>& InNativeRootObject,
+		TSharedPtr<FJsonObject>& OutWrapperRootObject,
+		FString& OutErrorDetail)
+	{
+		OutWrapperRootObject.Reset();
+		OutErrorDetail.Reset();
+
+		if (!InNativeRootObject.IsValid())
+		{
+			OutErrorDetail = TEXT("Native query response is not a readable JSON object.");
+			return false;
+		}
+
+		const FString ExpectedNativeSchema = InQueryKind == TEXT("section")
+			? TEXT("lazy_section_dump_v1")
+			: TEXT("dependency_trace_query_v1");
+		const FString ExpectedSourceContract = InQueryKind == TEXT("section")
+			? TEXT("indexed_stored_evidence")
+			: TEXT("indexed_dependency_evidence");
+		const FString NativeSchema = GetReadQueryStringFieldOrEmpty(InNativeRootObject, TEXT("schema_version"));
+		const FString NativeSourceContract = GetReadQueryStringFieldOrEmpty(InNativeRootObject, TEXT("source_contract"));
+		const FString GeneratedTime = GetReadQueryStringFieldOrEmpty(InNativeRootObject, TEXT("generated_time"));
+		if (NativeSchema != ExpectedNativeSchema
+			|| NativeSourceContract != ExpectedSourceContract
+			|| GeneratedTime.IsEmpty()
+			|| !GetReadQueryBoolFieldOrDefault(InNativeRootObject, TEXT("all_resolved"), false))
+		{
+			OutErrorDetail = FString::Printf(
+				TEXT("Native response contract mismatch: kind=%s schema=%s source_contract=%s"),
+				*InQueryKind,
+				*NativeSchema,
+				*NativeSourceContract);
+			return false;
+		}
+
+		const TSharedPtr<FJsonObject> NativeAssetObject = InQueryKind == TEXT("section")
+			? GetReadQueryNestedObjectField(InNativeRootObject, TEXT("asset"))
+			: GetReadQueryNestedObjectField(InNativeRootObject, TEXT("root_asset"));
+		const FString RootObjectPath = GetReadQueryStringFieldOrEmpty(NativeAssetObject, TEXT("object_path"));
+		if (RootObjectPath.IsEmpty() || !RootObjectPath.StartsWith(TEXT("/")))
+		{
+			OutErrorDetail = TEXT("Native response does not contain a valid resolved root object path.");
+			return false;
+		}
+
+		TSharedRef<FJsonObject> QueryObject = MakeShared<FJsonObject>();
+		QueryObject->SetStringField(TEXT("mode"), TEXT("query"));
+		QueryObject->SetStringField(TEXT("query_kind"), InQueryKind);
+		QueryObject->SetStringField(TEXT("selector_kind"), InSelectorKind);
+		QueryObject->SetStringField(TEXT("root_object_path"), RootObjectPath);
+		QueryObject->SetStringField(TEXT("result_schema"), TEXT("query_result_v1"));
+
+		TSharedRef<FJsonObject> ResultObject = MakeShared<FJsonObject>();
+		ResultObject->SetStringField(TEXT("native_schema_version"), NativeSchema);
+		ResultObject->SetStringField(TEXT("native_source_contract"), NativeSourceContract);
+		ResultObject->SetObjectField(TEXT("payload"), InNativeRootObject.ToSharedRef());
+
+		TSharedRef<FJsonObject> WrapperRootObject = MakeShared<FJsonObject>();
+		WrapperRootObject->SetStringField(TEXT("schema_version"), TEXT("query_result_v1"));
+		WrapperRootObject->SetStringField(TEXT("generated_time"), GeneratedTime);
+		WrapperRootObject->SetStringField(TEXT("status"), TEXT("succeeded"));
+		WrapperRootObject->SetObjectField(TEXT("query"), QueryObject);
+		WrapperRootObject->SetObjectField(TEXT("result"), ResultObject);
+		WrapperRootObject->SetBoolField(TEXT("all_resolved"), true);
+
+		OutWrapperRootObject = WrapperRootObject;
+		return true;
+	}
+
+	// BuildReadQueryQueryResultJson은 accepted native query response를 query_result_v1 success envelope으로 감싼다.
+	bool BuildReadQueryQueryResultJson(
+		const FString& InQueryKind,
+		const FString& InSelectorKind,
+		const FString& InNativeJsonText,
+		FString& OutJsonText,
+		FString& OutErrorDetail)
+	{
+		OutJsonText.Reset();
+		OutErrorDetail.Reset();
+
+		TSharedPtr<FJsonObject> NativeRootObject;
+		TSharedRef<TJsonReader<>> NativeReader = TJsonReaderFactory<>::Create(InNativeJsonText);
+		if (!FJsonSerializer::Deserialize(NativeReader, NativeRootObject) || !NativeRootObject.IsValid())
+		{
+			OutErrorDetail = TEXT("Native query response is not a readable JSON object.");
+			return false;
+		}
+
+		TSharedPtr<FJsonObject> WrapperRootObject;
+		if (!BuildReadQueryQueryResultObject(InQueryKind, InSelectorKind, NativeRootObject, WrapperRootObject, OutErrorDetail))
+		{
+			return false;
+		}
+
+		if (!SerializeReadQueryJsonObjectText(WrapperRootObject.ToSharedRef(), OutJsonText))
+		{
+			OutErrorDetail = TEXT("Failed to serialize query_result_v1 response.");
+			return false;
+		}
+		return true;
+	}
+
+		// CopyReadQueryJsonField는 기존 JSON field를 의미 변경 없이 새 object에 복사한다.
+	bool CopyReadQueryJsonField(
+		const TSharedPtr<FJsonObject>& InSourceObject,
+		const TCHAR* InFieldName,
+		const TSharedRef<FJsonObject>& InTargetObject)
+	{
+		if (!InSourceObject.IsValid())
+		{
+			return false;
+		}
+
+		const TSharedPtr<FJsonValue> SourceValue = InSourceObject->TryGetField(InFieldName);
+		if (!SourceValue.IsValid())
+		{
+			return false;
+		}
+
+		InTargetObject->SetField(InFieldName, SourceValue);
+		return true;
+	}
+
+	// BuildReadQueryAIContextBundleJson은 accepted query_result_v1을 bounded ai_context_bundle_v1로 변환한다.
+	// bInUseReferenceByteFit은 validate 벤치마크가 item을 하나씩 빼며 전체를 재직렬화하는 기준 구현과 출력을 비교할 때만 켠다.
+	bool BuildReadQueryAIContextBundleJson(
+		const TSharedPtr<FJsonObject>& InQueryResultObject,
+		int32 InMaxItems,
+		int32 InMaxBytes,
+		FString& OutJsonText,
+		FString& OutErrorCode,
+		FString& OutErrorDetail,
+		bool bInUseReferenceByteFit = false)
+	{
+		OutJsonText.Reset();
+		OutErrorCode.Reset();
+		OutErrorDetail.Reset();
+
+		auto Fail = [&](const TCHAR* InCode, const FString& InDetail)
+		{
+			OutErrorCode = InCode;
+			OutErrorDetail = InDetail;
+			return false;
+		};
+
+		if (!InQueryResultObject.IsValid()
+			|| GetReadQueryStringFieldOrEmpty(InQueryResultObject, TEXT("schema_version")) != TEXT("query_result_v1"))
+		{
+			return Fail(TEXT("ADUMP_CONTEXT_INPUT_SCHEMA_UNSUPPORTED"), TEXT("Input schema_version must be query_result_v1."));
+		}
+
+		const FString StatusText = GetReadQueryStringFieldOrEmpty(InQueryResultObject, TEXT("status"));
+		const FString GeneratedTimeText = GetReadQueryStringFieldOrEmpty(InQueryResultObject, TEXT("generated_time"));
+		if (StatusText != TEXT("succeeded")
+			|| GeneratedTimeText.IsEmpty()
+			|| !GetReadQueryBoolFieldOrDefault(InQueryResultObject, TEXT("all_resolved"), false))
+		{
+			return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Input query_result_v1 must be succeeded, resolved, and contain generated_time."));
+		}
+
+		const TSharedPtr<FJsonObject> QueryObject = GetReadQueryNestedObjectField(InQueryResultObject, TEXT("query"));
+		const TSharedPtr<FJsonObject> ResultObject = GetReadQueryNestedObjectField(InQueryResultObject, TEXT("result"));
+		const TSharedPtr<FJsonObject> PayloadObject = GetReadQueryNestedObjectField(ResultObject, TEXT("payload"));
+		if (!QueryObject.IsValid() || !ResultObject.IsValid() || !PayloadObject.IsValid())
+		{
+			return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Input query_result_v1 requires query, result, and result.payload objects."));
+		}
+
+		const FString QueryModeText = GetReadQueryStringFieldOrEmpty(QueryObject, TEXT("mode"));
+		const FString QueryKindText = GetReadQueryStringFieldOrEmpty(QueryObject, TEXT("query_kind"));
+		const FString SelectorKindText = GetReadQueryStringFieldOrEmpty(QueryObject, TEXT("selector_kind"));
+		const FString RootObjectPath = GetReadQueryStringFieldOrEmpty(QueryObject, TEXT("root_object_path"));
+		const FString ResultSchemaText = GetReadQueryStringFieldOrEmpty(QueryObject, TEXT("result_schema"));
+		if (QueryModeText != TEXT("query")
+			|| (QueryKindText != TEXT("section") && QueryKindText != TEXT("dependency"))
+			|| (SelectorKindText != TEXT("object_path") && SelectorKindText != TEXT("asset_id"))
+			|| RootObjectPath.IsEmpty()
+			|| !RootObjectPath.StartsWith(TEXT("/"))
+			|| ResultSchemaText != TEXT("query_result_v1"))
+		{
+			return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Input query metadata is outside the accepted query_result_v1 contract."));
+		}
+
+		const FString NativeSchemaText = GetReadQueryStringFieldOrEmpty(ResultObject, TEXT("native_schema_version"));
+		const FString NativeSourceContractText = GetReadQueryStringFieldOrEmpty(ResultObject, TEXT("native_source_contract"));
+		const FString PayloadSchemaText = GetReadQueryStringFieldOrEmpty(PayloadObject, TEXT("schema_version"));
+		const FString PayloadSourceContractText = GetReadQueryStringFieldOrEmpty(PayloadObject, TEXT("source_contract"));
+		const FString PayloadGeneratedTimeText = GetReadQueryStringFieldOrEmpty(PayloadObject, TEXT("generated_time"));
+		if (PayloadGeneratedTimeText != GeneratedTimeText
+			|| !GetReadQueryBoolFieldOrDefault(PayloadObject, TEXT("all_resolved"), false))
+		{
+			return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Input wrapper and native payload generated_time/all_resolved values do not agree."));
+		}
+
+		const FString ExpectedNativeSchema = QueryKindText == TEXT("section")
+			? TEXT("lazy_section_dump_v1")
+			: TEXT("dependency_trace_query_v1");
+		const FString ExpectedNativeSourceContract = QueryKindText == TEXT("section")
+			? TEXT("indexed_stored_evidence")
+			: TEXT("indexed_dependency_evidence");
+		if (NativeSchemaText != ExpectedNativeSchema
+			|| NativeSourceContractText != ExpectedNativeSourceContract
+			|| PayloadSchemaText != ExpectedNativeSchema
+			|| PayloadSourceContractText != ExpectedNativeSourceContract)
+		{
+			return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Input native schema/source pair does not match query_kind."));
+		}
+
+		const TSharedPtr<FJsonObject> NativeRootAssetObject = QueryKindText == TEXT("section")
+			? GetReadQueryNestedObjectField(PayloadObject, TEXT("asset"))
+			: GetReadQueryNestedObjectField(PayloadObject, TEXT("root_asset"));
+		if (!NativeRootAssetObject.IsValid()
+			|| GetReadQueryStringFieldOrEmpty(NativeRootAssetObject, TEXT("object_path")) != RootObjectPath)
+		{
+			return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Input native root object path does not match wrapper query.root_object_path."));
+		}
+
+		TArray<TSharedPtr<FJsonValue>> CandidateItemArray;
+		bool bSourceTruncated = false;
+		TArray<FString> SourceTruncationReasonArray;
+
+		if (QueryKindText == TEXT("section"))
+		{
+			const TArray<TSharedPtr<FJsonValue>>* SectionValueArray = nullptr;
+			const int32 SectionCount = GetReadQueryIntegerFieldOrDefault(PayloadObject, TEXT("section_count"), -1);
+			if (!PayloadObject->TryGetArrayField(TEXT("sections"), SectionValueArray)
+				|| !SectionValueArray
+				|| SectionCount != SectionValueArray->Num())
+			{
+				return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Section payload section_count/sections contract is invalid."));
+			}
+
+			CandidateItemArray.Reserve(SectionValueArray->Num());
+			for (int32 SectionIndex = 0; SectionIndex < SectionValueArray->Num(); ++SectionIndex)
+			{
+				const TSharedPtr<FJsonValue>& SectionValue = (*SectionValueArray)[SectionIndex];
+				if (!SectionValue.IsValid() || SectionValue->Type != EJson::Object)
+				{
+					return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Section payload contains a non-object section item."));
+				}
+
+				const TSharedPtr<FJsonObject> SectionObject = SectionValue->AsObject();
+				const FString SectionNameText = GetReadQueryStringFieldOrEmpty(SectionObject, TEXT("section_name"));
+				const FString SectionSchemaText = GetReadQueryStringFieldOrEmpty(SectionObject, TEXT("section_schema_version"));
+				const FString SourceFileText = GetReadQueryStringFieldOrEmpty(SectionObject, TEXT("source_file"));
+				const FString JsonPointerText = GetReadQueryStringFieldOrEmpty(SectionObject, TEXT("json_pointer"));
+				const FString StorageKindText = GetReadQueryStringFieldOrEmpty(SectionObject, TEXT("storage_kind"));
+				const TSharedPtr<FJsonValue> DataValue = SectionObject.IsValid() ? SectionObject->TryGetField(TEXT("data")) : nullptr;
+								if (SectionNameText.IsEmpty()
+					|| !SectionObject->HasField(TEXT("section_schema_version"))
+					|| SourceFileText.IsEmpty()
+					|| !FPaths::IsRelative(SourceFileText)
+					|| SourceFileText.Contains(TEXT("\\"))
+					|| SourceFileText.StartsWith(TEXT("../"))
+					|| !JsonPointerText.StartsWith(TEXT("/"))
+					|| StorageKindText.IsEmpty()
+					|| !DataValue.IsValid())
+				{
+					return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Section payload item is missing required evidence fields."));
+				}
+
+				TSharedRef<FJsonObject> ItemObject = MakeShared<FJsonObject>();
+				ItemObject->SetStringField(TEXT("item_id"), FString::Printf(TEXT("item_%04d"), SectionIndex));
+				ItemObject->SetStringField(TEXT("item_kind"), TEXT("section"));
+				ItemObject->SetNumberField(TEXT("source_index"), SectionIndex);
+				ItemObject->SetStringField(TEXT("object_path"), RootObjectPath);
+				ItemObject->SetStringField(TEXT("section_name"), SectionNameText);
+				ItemObject->SetStringField(TEXT("section_schema_version"), SectionSchemaText);
+				ItemObject->SetStringField(TEXT("source_file"), SourceFileText);
+				ItemObject->SetStringField(TEXT("json_pointer"), JsonPointerText);
+				ItemObject->SetStringField(TEXT("storage_kind"), StorageKindText);
+				ItemObject->SetField(TEXT("data"), DataValue);
+				CandidateItemArray.Add(MakeShared<FJsonValueObject>(ItemObject));
+			}
+		}
+		else
+		{
+			const TArray<TSharedPtr<FJsonValue>>* NodeValueArray = nullptr;
+			const TArray<TSharedPtr<FJsonValue>>* EdgeValueArray = nullptr;
+			const int32 NodeCount = GetReadQueryIntegerFieldOrDefault(PayloadObject, TEXT("node_count"), -1);
+			const int32 EdgeCount = GetReadQueryIntegerFieldOrDefault(PayloadObject, TEXT("edge_count"), -1);
+			if (!PayloadObject->TryGetArrayField(TEXT("nodes"), NodeValueArray)
+				|| !PayloadObject->TryGetArrayField(TEXT("edges"), EdgeValueArray)
+				|| !NodeValueArray
+				|| !EdgeValueArray
+				|| NodeCount != NodeValueArray->Num()
+				|| EdgeCount != EdgeValueArray->Num())
+			{
+				return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency payload node/edge counts do not match their arrays."));
+			}
+
+			bool bNativeTruncated = false;
+			if (!PayloadObject->TryGetBoolField(TEXT("truncated"), bNativeTruncated))
+			{
+				return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency payload is missing truncated."));
+			}
+			bSourceTruncated = bNativeTruncated;
+
+			const TArray<TSharedPtr<FJsonValue>>* NativeReasonValueArray = nullptr;
+			if (!PayloadObject->TryGetArrayField(TEXT("truncation_reasons"), NativeReasonValueArray) || !NativeReasonValueArray)
+			{
+				return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency payload is missing truncation_reasons."));
+			}
+			for (const TSharedPtr<FJsonValue>& ReasonValue : *NativeReasonValueArray)
+			{
+				FString ReasonText;
+				if (!ReasonValue.IsValid() || !ReasonValue->TryGetString(ReasonText)
+					|| (ReasonText != TEXT("max_nodes") && ReasonText != TEXT("max_edges"))
+					|| SourceTruncationReasonArray.Contains(ReasonText))
+				{
+					return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency source truncation reasons are invalid."));
+				}
+				SourceTruncationReasonArray.Add(ReasonText);
+			}
+			TArray<FString> CanonicalSourceReasonArray;
+			if (SourceTruncationReasonArray.Contains(TEXT("max_nodes"))) CanonicalSourceReasonArray.Add(TEXT("max_nodes"));
+			if (SourceTruncationReasonArray.Contains(TEXT("max_edges"))) CanonicalSourceReasonArray.Add(TEXT("max_edges"));
+			if (SourceTruncationReasonArray != CanonicalSourceReasonArray
+				|| bSourceTruncated != (SourceTruncationReasonArray.Num() > 0))
+			{
+				return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency source truncation flag/reason ordering is invalid."));
+			}
+
+			CandidateItemArray.Reserve(NodeValueArray->Num() + EdgeValueArray->Num());
+			for (int32 NodeIndex = 0; NodeIndex < NodeValueArray->Num(); ++NodeIndex)
+			{
+				const TSharedPtr<FJsonValue>& NodeValue = (*NodeValueArray)[NodeIndex];
+				if (!NodeValue.IsValid() || NodeValue->Type != EJson::Object)
+				{
+					return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency payload contains a non-object node."));
+				}
+
+				const TSharedPtr<FJsonObject> NodeObject = NodeValue->AsObject();
+				FString NodeIdText;
+				FString NodeObjectPath;
+				FString AssetIdText;
+				FString AssetKeyText;
+				FString AssetClassText;
+				FString AssetFamilyText;
+				bool bIndexed = false;
+				double MinDepth = -1.0;
+				const TArray<TSharedPtr<FJsonValue>>* RoleValueArray = nullptr;
+				if (!NodeObject.IsValid()
+					|| !NodeObject->TryGetStringField(TEXT("node_id"), NodeIdText)
+					|| !NodeObject->TryGetStringField(TEXT("object_path"), NodeObjectPath)
+					|| !NodeObject->TryGetStringField(TEXT("asset_id"), AssetIdText)
+					|| !NodeObject->TryGetStringField(TEXT("asset_key"), AssetKeyText)
+					|| !NodeObject->TryGetStringField(TEXT("asset_class"), AssetClassText)
+					|| !NodeObject->TryGetStringField(TEXT("asset_family"), AssetFamilyText)
+					|| !NodeObject->TryGetBoolField(TEXT("indexed"), bIndexed)
+					|| !NodeObject->TryGetNumberField(TEXT("min_depth"), MinDepth)
+					|| !NodeObject->TryGetArrayField(TEXT("roles"), RoleValueArray)
+					|| !RoleValueArray
+					|| NodeIdText.IsEmpty()
+					|| NodeObjectPath.IsEmpty()
+					|| !NodeObjectPath.StartsWith(TEXT("/"))
+					|| MinDepth < 0.0)
+				{
+					return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency node contract is invalid."));
+				}
+
+				for (const TSharedPtr<FJsonValue>& RoleValue : *RoleValueArray)
+				{
+					FString RoleText;
+					if (!RoleValue.IsValid() || !RoleValue->TryGetString(RoleText)
+						|| (RoleText != TEXT("root") && RoleText != TEXT("dependency") && RoleText != TEXT("referencer")))
+					{
+						return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency node roles contract is invalid."));
+					}
+				}
+
+				const int32 CandidateIndex = CandidateItemArray.Num();
+				TSharedRef<FJsonObject> ItemObject = MakeShared<FJsonObject>();
+				ItemObject->SetStringField(TEXT("item_id"), FString::Printf(TEXT("item_%04d"), CandidateIndex));
+				ItemObject->SetStringField(TEXT("item_kind"), TEXT("asset"));
+				ItemObject->SetNumberField(TEXT("source_index"), CandidateIndex);
+				for (const TCHAR* FieldName : { TEXT("node_id"), TEXT("object_path"), TEXT("asset_id"), TEXT("asset_key"), TEXT("asset_class"), TEXT("asset_family"), TEXT("indexed"), TEXT("min_depth"), TEXT("roles") })
+				{
+					if (!CopyReadQueryJsonField(NodeObject, FieldName, ItemObject))
+					{
+						return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency node field copy failed."));
+					}
+				}
+				CandidateItemArray.Add(MakeShared<FJsonValueObject>(ItemObject));
+			}
+
+			for (int32 EdgeIndex = 0; EdgeIndex < EdgeValueArray->Num(); ++EdgeIndex)
+			{
+				const TSharedPtr<FJsonValue>& EdgeValue = (*EdgeValueArray)[EdgeIndex];
+				if (!EdgeValue.IsValid() || EdgeValue->Type != EJson::Object)
+				{
+					return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency payload contains a non-object edge."));
+				}
+
+				const TSharedPtr<FJsonObject> EdgeObject = EdgeValue->AsObject();
+				FString EdgeIdText;
+				FString TraversalDirectionText;
+				FString TraversalFromText;
+				FString TraversalToText;
+				FString RelationFromText;
+				FString RelationToText;
+				FString StrengthText;
+				FString ReasonText;
+				FString SourceKindText;
+				FString SourcePathText;
+				double Depth = -1.0;
+				bool bClosesCycle = false;
+				if (!EdgeObject.IsValid()
+					|| !EdgeObject->TryGetStringField(TEXT("edge_id"), EdgeIdText)
+					|| !EdgeObject->TryGetStringField(TEXT("traversal_direction"), TraversalDirectionText)
+					|| !EdgeObject->TryGetStringField(TEXT("traversal_from"), TraversalFromText)
+					|| !EdgeObject->TryGetStringField(TEXT("traversal_to"), TraversalToText)
+					|| !EdgeObject->TryGetStringField(TEXT("relation_from"), RelationFromText)
+					|| !EdgeObject->TryGetStringField(TEXT("relation_to"), RelationToText)
+					|| !EdgeObject->TryGetStringField(TEXT("strength"), StrengthText)
+					|| !EdgeObject->TryGetStringField(TEXT("reason"), ReasonText)
+					|| !EdgeObject->TryGetStringField(TEXT("source_kind"), SourceKindText)
+					|| !EdgeObject->TryGetStringField(TEXT("source_path"), SourcePathText)
+					|| !EdgeObject->TryGetNumberField(TEXT("depth"), Depth)
+					|| !EdgeObject->TryGetBoolField(TEXT("closes_cycle"), bClosesCycle)
+					|| EdgeIdText.IsEmpty()
+					|| TraversalFromText.IsEmpty()
+					|| TraversalToText.IsEmpty()
+					|| RelationFromText.IsEmpty()
+					|| RelationToText.IsEmpty()
+					|| Depth < 0.0)
+				{
+					return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency edge contract is invalid."));
+				}
+
+				const int32 CandidateIndex = CandidateItemArray.Num();
+				TSharedRef<FJsonObject> ItemObject = MakeShared<FJsonObject>();
+				ItemObject->SetStringField(TEXT("item_id"), FString::Printf(TEXT("item_%04d"), CandidateIndex));
+				ItemObject->SetStringField(TEXT("item_kind"), TEXT("relation"));
+				ItemObject->SetNumberField(TEXT("source_index"), CandidateIndex);
+				for (const TCHAR* FieldName : { TEXT("edge_id"), TEXT("depth"), TEXT("traversal_direction"), TEXT("traversal_from"), TEXT("traversal_to"), TEXT("relation_from"), TEXT("relation_to"), TEXT("strength"), TEXT("reason"), TEXT("source_kind"), TEXT("source_path"), TEXT("closes_cycle") })
+				{
+					if (!CopyReadQueryJsonField(EdgeObject, FieldName, ItemObject))
+					{
+						return Fail(TEXT("ADUMP_CONTEXT_INPUT_CONTRACT_INVALID"), TEXT("Dependency edge field copy failed."));
+					}
+				}
+				CandidateItemArray.Add(MakeShared<FJsonValueObject>(ItemObject));
+			}
+		}
+
+		const bool bMaxItemsTruncated = CandidateItemArray.Num() > InMaxItems;
+		const int32 InitialIncludedCount = FMath::Min(CandidateItemArray.Num(), InMaxItems);
+
+		// BuildBundleRootObject는 included item 수와 max_bytes 절단 여부에 맞는 bundle root를 InItemArray items로 만든다.
+		auto BuildBundleRootObject = [&](const TArray<TSharedPtr<FJsonValue>>& InItemArray, int32 InIncludedCount, bool bInMaxBytesTruncated)
+		{
+			TSharedRef<FJsonObject> SourceObject = MakeShared<FJsonObject>();
+			SourceObject->SetStringField(TEXT("query_result_schema_version"), TEXT("query_result_v1"));
+			SourceObject->SetStringField(TEXT("query_kind"), QueryKindText);
+			SourceObject->SetStringField(TEXT("selector_kind"), SelectorKindText);
+			SourceObject->SetStringField(TEXT("root_object_path"), RootObjectPath);
+			SourceObject->SetStringField(TEXT("native_schema_version"), NativeSchemaText);
+			SourceObject->SetStringField(TEXT("native_source_contract"), NativeSourceContractText);
+			SourceObject->SetBoolField(TEXT("source_truncated"), bSourceTruncated);
+			AddReadQueryStringArrayField(SourceObject, TEXT("source_truncation_reasons"), SourceTruncationReasonArray);
+
+			TSharedRef<FJsonObject> LimitsObject = MakeShared<FJsonObject>();
+			LimitsObject->SetNumberField(TEXT("max_items"), InMaxItems);
+			LimitsObject->SetNumberField(TEXT("max_bytes"), InMaxBytes);
+
+			TSharedRef<FJsonObject> CountsObject = MakeShared<FJsonObject>();
+			CountsObject->SetNumberField(TEXT("available_item_count"), CandidateItemArray.Num());
+			CountsObject->SetNumberField(TEXT("included_item_count"), InIncludedCount);
+			CountsObject->SetNumberField(TEXT("omitted_item_count"), CandidateItemArray.Num() - InIncludedCount);
+
+			TArray<FString> BundleTruncationReasonArray;
+			if (bSourceTruncated) BundleTruncationReasonArray.Add(TEXT("source_truncated"));
+			if (bMaxItemsTruncated) BundleTruncationReasonArray.Add(TEXT("max_items"));
+			if (bInMaxBytesTruncated) BundleTruncationReasonArray.Add(TEXT("max_bytes"));
+
+			TSharedRef<FJsonObject> RootObject = MakeShared<FJsonObject>();
+			RootObject->SetStringField(TEXT("schema_version"), TEXT("ai_context_bundle_v1"));
+			RootObject->SetStringField(TEXT("generated_time"), GeneratedTimeText);
+			RootObject->SetStringField(TEXT("status"), TEXT("succeeded"));
+			RootObject->SetObjectField(TEXT("source"), SourceObject);
+			RootObject->SetObjectField(TEXT("limits"), LimitsObject);
+			RootObject->SetObjectField(TEXT("counts"), CountsObject);
+			RootObject->SetBoolField(TEXT("truncated"), BundleTruncationReasonArray.Num() > 0);
+			AddReadQueryStringArrayField(RootObject, TEXT("truncation_reasons"), BundleTruncationReasonArray);
+			RootObject->SetArrayField(TEXT("items"), InItemArray);
+			RootObject->SetBoolField(TEXT("all_resolved"), true);
+			return RootObject;
+		};
+
+		// IncludedItemArray는 최종 bundle에 넣을 앞쪽 candidate item이다.
+		TArray<TSharedPtr<FJsonValue>> IncludedItemArray;
+		IncludedItemArray.Reserve(InitialIncludedCount);
+		for (int32 ItemIndex = 0; ItemIndex < InitialIncludedCount; ++ItemIndex)
+		{
+			IncludedItemArray.Add(CandidateItemArray[ItemIndex]);
+		}
+
+		// FitByReferenceLoop는 trailing item을 하나씩 빼며 전체 bundle을 재직렬화하는 기준 절단이다.
+		auto FitByReferenceLoop = [&]()
+		{
+			bool bMaxBytesTruncated = false;
+			while (true)
+			{
+				const TSharedRef<FJsonObject> BundleRootObject = BuildBundleRootObject(IncludedItemArray, IncludedItemArray.Num(), bMaxBytesTruncated);
+				FString CandidateJsonText;
+				if (!SerializeReadQueryJsonObjectText(BundleRootObject, CandidateJsonText))
+				{
+					return Fail(TEXT("ADUMP_CONTEXT_BUNDLE_BUILD_FAILED"), TEXT("Failed to serialize ai_context_bundle_v1."));
+				}
+
+				if (GetReadQueryUtf8ByteLength(CandidateJsonText) <= InMaxBytes)
+				{
+					OutJsonText = MoveTemp(CandidateJsonText);
+					return true;
+				}
+
+				bMaxBytesTruncated = true;
+				if (IncludedItemArray.Num() == 0)
+				{
+					return Fail(TEXT("ADUMP_CONTEXT_BUNDLE_LIMIT_TOO_SMALL"), TEXT("MaxBytes cannot fit the zero-item ai_context_bundle_v1 envelope."));
+				}
+				IncludedItemArray.RemoveAt(IncludedItemArray.Num() - 1, 1, EAllowShrinking::No);
+			}
+		};
+
+		if (bInUseReferenceByteFit)
+		{
+			return FitByReferenceLoop();
+		}
+
+		// MeasureJsonObjectBytes는 bundle과 같은 pretty writer로 직렬화한 UTF-8 byte 수를 잰다.
+		auto MeasureJsonObjectBytes = [](const TSharedRef<FJsonObject>& InObject, int64& OutByteCount)
+		{
+			FString MeasuredJsonText;
+			if (!SerializeReadQueryJsonObjectText(InObject, MeasuredJsonText))
+			{
+				return false;
+			}
+			OutByteCount = GetReadQueryUtf8ByteLength(MeasuredJsonText);
+			return true;
+		};
+
+		// MeasureItemsFieldBytes는 root 직속 items 배열만 가진 object의 byte 수를 잰다. items 들여쓰기 깊이가 bundle과 같다.
+		auto MeasureItemsFieldBytes = [&](const TArray<TSharedPtr<FJsonValue>>& InItemArray, int64& OutByteCount)
+		{
+			TSharedRef<FJsonObject> ItemsOnlyObject = MakeShared<FJsonObject>();
+			ItemsOnlyObject->SetArrayField(TEXT("items"), InItemArray);
+			return MeasureJsonObjectBytes(ItemsOnlyObject, OutByteCount);
+		};
+
+		// ItemPrefixBytes[k]는 앞 k개 item이 빈 items 배열 대비 늘리는 byte 합이다. item별 직렬화는 한 번만 한다.
+		TArray<int64> ItemPrefixBytes;
+		ItemPrefixBytes.SetNumZeroed(InitialIncludedCount + 1);
+
+		// ItemSeparatorAdjustBytes는 두 번째 item부터 item 단독 증가분에 더해지는 구분자 보정값이다.
+		int64 ItemSeparatorAdjustBytes = 0;
+		{
+			int64 EmptyItemsBytes = 0;
+			TArray<TSharedPtr<FJsonValue>> ProbeItemArray;
+			if (!MeasureItemsFieldBytes(ProbeItemArray, EmptyItemsBytes))
+			{
+				return Fail(TEXT("ADUMP_CONTEXT_BUNDLE_BUILD_FAILED"), TEXT("Failed to serialize ai_context_bundle_v1."));
+			}
+
+			ProbeItemArray.SetNum(1);
+			for (int32 ItemIndex = 0; ItemIndex < InitialIncludedCount; ++ItemIndex)
+			{
+				ProbeItemArray[0] = CandidateItemArray[ItemIndex];
+				int64 SingleItemBytes = 0;
+				if (!MeasureItemsFieldBytes(ProbeItemArray, SingleItemBytes))
+				{
+					return Fail(TEXT("ADUMP_CONTEXT_BUNDLE_BUILD_FAILED"), TEXT("Failed to serialize ai_context_bundle_v1."));
+				}
+				ItemPrefixBytes[ItemIndex + 1] = ItemPrefixBytes[ItemIndex] + (SingleItemBytes - EmptyItemsBytes);
+			}
+
+			if (InitialIncludedCount >= 2)
+			{
+				ProbeItemArray = { CandidateItemArray[0], CandidateItemArray[1] };
+				int64 PairItemsBytes = 0;
+				if (!MeasureItemsFieldBytes(ProbeItemArray, PairItemsBytes))
+				{
+					return Fail(TEXT("ADUMP_CONTEXT_BUNDLE_BUILD_FAILED"), TEXT("Failed to serialize ai_context_bundle_v1."));
+				}
+				ItemSeparatorAdjustBytes = PairItemsBytes - EmptyItemsBytes - ItemPrefixBytes[2];
+			}
+		}
+
+		// EnvelopeBytesByShape는 빈 items bundle byte 수 cache다. count 자릿수와 max_bytes 절단 여부만 envelope 길이를 바꾼다.
+		TMap<int32, int64> EnvelopeBytesByShape;
+		const TArray<TSharedPtr<FJsonValue>> EmptyItemArray;
+		auto PredictBundleBytes = [&](int32 InIncludedCount, bool bInMaxBytesTruncated, int64& OutByteCount)
+		{
+			const int32 ShapeKey = FString::FromInt(InIncludedCount).Len() * 1000
+				+ FString::FromInt(CandidateItemArray.Num() - InIncludedCount).Len() * 10
+				+ (bInMaxBytesTruncated ? 1 : 0);
+			int64* EnvelopeBytes = EnvelopeBytesByShape.Find(ShapeKey);
+			if (!EnvelopeBytes)
+			{
+				int64 MeasuredEnvelopeBytes = 0;
+				if (!MeasureJsonObjectBytes(BuildBundleRootObject(EmptyItemArray, InIncludedCount, bInMaxBytesTruncated), MeasuredEnvelopeBytes))
+				{
+					return false;
+				}
+				EnvelopeBytes = &EnvelopeBytesByShape.Add(ShapeKey, MeasuredEnvelopeBytes);
+			}
+
+			OutByteCount = *EnvelopeBytes;
+			if (InIncludedCount > 0)
+			{
+				OutByteCount += ItemPrefixBytes[InIncludedCount] + (InIncludedCount - 1) * ItemSeparatorAdjustBytes;
+			}
+			return true;
+		};
+
+		// FittedCount와 bFittedMaxBytesTruncated는 기준 loop와 같은 순서로 찾은 가장 긴 fitting prefix다.
+		int32 FittedCount = INDEX_NONE;
+		bool bFittedMaxBytesTruncated = false;
+		int64 PredictedBytes = 0;
+		if (!PredictBundleBytes(InitialIncludedCount, false, PredictedBytes))
+		{
+			return Fail(TEXT("ADUMP_CONTEXT_BUNDLE_BUILD_FAILED"), TEXT("Failed to serialize ai_context_bundle_v1."));
+		}
+		if (PredictedBytes <= InMaxBytes)
+		{
+			FittedCount = InitialIncludedCount;
+		}
+		else
+		{
+			bFittedMaxBytesTruncated = true;
+			for (int32 CandidateCount = InitialIncludedCount - 1; CandidateCount >= 0; --CandidateCount)
+			{
+				if (!PredictBundleBytes(CandidateCount, true, PredictedBytes))
+				{
+					return Fail(TEXT("ADUMP_CONTEXT_BUNDLE_BUILD_FAILED"), TEXT("Failed to serialize ai_context_bundle_v1."));
+				}
+				if (PredictedBytes <= InMaxBytes)
+				{
+					FittedCount = CandidateCount;
+					break;
+				}
+			}
+		}
+
+		if (FittedCount == INDEX_NONE)
+		{
+			return Fail(TEXT("ADUMP_CONTEXT_BUNDLE_LIMIT_TOO_SMALL"), TEXT("MaxBytes cannot fit the zero-item ai_context_bundle_v1 envelope."));
+		}
+
+		IncludedItemArray.SetNum(FittedCount, EAllowShrinking::No);
+		FString FittedJsonText;
+		if (!SerializeReadQueryJsonObjectText(BuildBundleRootObject(IncludedItemArray, FittedCount, bFittedMaxBytesTruncated), FittedJsonText))
+		{
+			return Fail(TEXT("ADUMP_CONTEXT_BUNDLE_BUILD_FAILED"), TEXT("Failed to serialize ai_context_bundle_v1."));
+		}
+
+		if (GetReadQueryUtf8ByteLength(FittedJsonText) != PredictedBytes)
+		{
+			// 예측이 실제 직렬화와 다르면 writer 형식 가정이 깨진 것이므로 기준 loop로 같은 결과를 보장한다.
+			IncludedItemArray.Reset();
+			for (int32 ItemIndex = 0; ItemIndex < InitialIncludedCount; ++ItemIndex)
+			{
+				IncludedItemArray.Add(CandidateItemArray[ItemIndex]);
+			}
+			return FitByReferenceLoop();
+		}
+
+		OutJsonText = MoveTemp(FittedJsonText);
+		return true;
+	}
+
+	// TryGetReadQueryOutputPath는 필수 -Output= 값을 읽고, 없으면 mode별 안정 오류 코드를 로그에 남긴다.
+	bool TryGetReadQueryOutputPath(const FString& InCommandLine, const TCHAR* InMissingMessage, FString& OutOutputFilePath)
+	{
+		if (FParse::Value(*InCommandLine, TEXT("Output="), OutOutputFilePath))
+		{
+			return true;
+		}
+		UE_LOG(LogTemp, Error, TEXT("%s"), InMissingMessage);
+		return false;
+	}
+
+	// RunReadQueryEntityQueryMode는 기존 entity_index_v1을 읽는 read-only entityquery를 실행한다. -Output=이 없으면 JSON을 로그에 출력한다.
+	int32 RunReadQueryEntityQueryMode(const FString& InCommandLine)
+	{
+		FString EntityErrorCode;
+		FString EntityErrorDetail;
+		FString EntityQueryJsonText;
+		if (!ADumpEntityQuery::BuildEntityQueryJson(InCommandLine, EntityQueryJsonText, EntityErrorCode, EntityErrorDetail))
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *EntityErrorCode, *EntityErrorDetail);
+			return 1;
+		}
+
+		FString EntityOutputPath;
+		FParse::Value(*InCommandLine, TEXT("Output="), EntityOutputPath);
+		if (!EntityOutputPath.IsEmpty())
+		{
+			FString SaveError;
+			if (!ADumpQueryIO::SaveJsonTextToFile(EntityOutputPath, EntityQueryJsonText, SaveError))
+			{
+				UE_LOG(LogTemp, Error, TEXT("JSON_SAVE_FAIL: %s"), *SaveError);
+				return 1;
+			}
+		}
+		else
+		{
+			UE_LOG(LogTemp, Display, TEXT("%s"), *EntityQueryJsonText);
+		}
+		return 0;
+	}
+
+	// RunReadQueryInputQueryMode는 input_binding_index_v1에서 key/action/context binding과 충돌 집합을 조회한다. -Output=이 없으면 JSON을 로그에 출력한다.
+	int32 RunReadQueryInputQueryMode(const FString& InCommandLine)
+	{
+		FString InputErrorCode;
+		FString InputErrorDetail;
+		FString InputQueryJsonText;
+		if (!ADumpInputIndex::BuildInputQueryJson(InCommandLine, InputQueryJsonText, InputErrorCode, InputErrorDetail))
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *InputErrorCode, *InputErrorDetail);
+			return 1;
+		}
+
+		FString InputOutputPath;
+		FParse::Value(*InCommandLine, TEXT("Output="), InputOutputPath);
+		if (!InputOutputPath.IsEmpty())
+		{
+			FString SaveError;
+			if (!ADumpQueryIO::SaveJsonTextToFile(InputOutputPath, InputQueryJsonText, SaveError))
+			{
+				UE_LOG(LogTemp, Error, TEXT("JSON_SAVE_FAIL: %s"), *SaveError);
+				return 1;
+			}
+		}
+		else
+		{
+			UE_LOG(LogTemp, Display, TEXT("%s"), *InputQueryJsonText);
+		}
+		return 0;
+	}
+
+	// RunReadQueryEntityContextMode는 native Entity/Relation object를 유지하는 entity_context_bundle_v1을 필수 -Output=에 저장한다.
+	int32 RunReadQueryEntityContextMode(const FString& InCommandLine)
+	{
+		FString EntityContextJsonText;
+		FString EntityErrorCode;
+		FString EntityErrorDetail;
+		if (!ADumpEntityQuery::BuildEntityContextJson(InCommandLine, EntityContextJsonText, EntityErrorCode, EntityErrorDetail))
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *EntityErrorCode, *EntityErrorDetail);
+			return 1;
+		}
+
+		FString EntityOutputPath;
+		FParse::Value(*InCommandLine, TEXT("Output="), EntityOutputPath);
+		FString SaveError;
+		if (!ADumpQueryIO::SaveJsonTextToFile(EntityOutputPath, EntityContextJsonText, SaveError))
+		{
+			UE_LOG(LogTemp, Error, TEXT("JSON_SAVE_FAIL: %s"), *SaveError);
+			return 1;
+		}
+		return 0;
+	}
+
+	// RunReadQueryContextBundleMode는 query_result_v1 입력 파일을 bounded ai_context_bundle_v1로 변환해 저장한다.
+	int32 RunReadQueryContextBundleMode(const FString& InCommandLine)
+	{
+		FString OutputFilePath;
+		if (!TryGetReadQueryOutputPath(InCommandLine, TEXT("ADUMP_CONTEXT_OUTPUT_REQUIRED: -Mode=contextbundle requires explicit -Output=."), OutputFilePath))
+		{
+			return 1;
+		}
+
+		FString JsonText;
+		FString InputFilePath;
+		if (!FParse::Value(*InCommandLine, TEXT("Input="), InputFilePath)
+			|| InputFilePath.TrimStartAndEnd().IsEmpty())
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_INPUT_REQUIRED: -Mode=contextbundle requires explicit -Input=."));
+			return 1;
+		}
+		InputFilePath = InputFilePath.TrimStartAndEnd();
+
+		const TCHAR* UnsupportedOptionTokenArray[] = {
+			TEXT("DumpRoot="), TEXT("Asset="), TEXT("AssetId="), TEXT("QueryKind="), TEXT("ResultSchema="),
+			TEXT("Sections="), TEXT("Direction="), TEXT("Strength="), TEXT("MaxDepth="), TEXT("MaxNodes="),
+			TEXT("MaxEdges="), TEXT("Intent="), TEXT("Profile=")
+		};
+		for (const TCHAR* UnsupportedOptionToken : UnsupportedOptionTokenArray)
+		{
+			if (InCommandLine.Contains(UnsupportedOptionToken, ESearchCase::IgnoreCase))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_OPTION_UNSUPPORTED: contextbundle does not accept query or dump-generation options."));
+				return 1;
+			}
+		}
+
+		auto TryParseBoundedInteger = [](const FString& InText, int32 InMinimum, int32 InMaximum, int32& OutValue)
+		{
+			if (InText.IsEmpty()) return false;
+			for (int32 CharacterIndex = 0; CharacterIndex < InText.Len(); ++CharacterIndex)
+			{
+				if (!FChar::IsDigit(InText[CharacterIndex])) return false;
+			}
+			OutValue = FCString::Atoi(*InText);
+			return OutValue >= InMinimum && OutValue <= InMaximum;
+		};
+
+		int32 MaxItems = 64;
+		FString MaxItemsText;
+		if (InCommandLine.Contains(TEXT("MaxItems="), ESearchCase::IgnoreCase))
+		{
+			FParse::Value(*InCommandLine, TEXT("MaxItems="), MaxItemsText);
+			if (!TryParseBoundedInteger(MaxItemsText.TrimStartAndEnd(), 1, 256, MaxItems))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_MAX_ITEMS_INVALID: MaxItems must be an integer from 1 through 256."));
+				return 1;
+			}
+		}
+
+		int32 MaxBytes = 262144;
+		FString MaxBytesText;
+		if (InCommandLine.Contains(TEXT("MaxBytes="), ESearchCase::IgnoreCase))
+		{
+			FParse::Value(*InCommandLine, TEXT("MaxBytes="), MaxBytesText);
+			if (!TryParseBoundedInteger(MaxBytesText.TrimStartAndEnd(), 4096, 1048576, MaxBytes))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_MAX_BYTES_INVALID: MaxBytes must be an integer from 4096 through 1048576."));
+				return 1;
+			}
+		}
+
+		InputFilePath = FPaths::ConvertRelativePathToFull(InputFilePath);
+		OutputFilePath = FPaths::ConvertRelativePathToFull(OutputFilePath);
+		FPaths::NormalizeFilename(InputFilePath);
+		FPaths::NormalizeFilename(OutputFilePath);
+		FPaths::CollapseRelativeDirectories(InputFilePath);
+		FPaths::CollapseRelativeDirectories(OutputFilePath);
+		if (InputFilePath.Equals(OutputFilePath, ESearchCase::IgnoreCase))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_INPUT_OUTPUT_CONFLICT: Input and Output must resolve to different files."));
+			return 1;
+		}
+
+		const int64 InputFileSize = IFileManager::Get().FileSize(*InputFilePath);
+		if (InputFileSize < 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_INPUT_NOT_FOUND: Input file does not exist: %s"), *InputFilePath);
+			return 2;
+		}
+		if (InputFileSize > 16ll * 1024ll * 1024ll)
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_INPUT_TOO_LARGE: Input file exceeds 16 MiB: %s"), *InputFilePath);
+			return 2;
+		}
+
+		TSharedPtr<FJsonObject> InputRootObject;
+		if (!LoadReadQueryJsonObjectFromFile(InputFilePath, InputRootObject))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_INPUT_JSON_INVALID: Input is not a readable JSON object: %s"), *InputFilePath);
+			return 2;
+		}
+
+		FString ContextErrorCode;
+		FString ContextErrorDetail;
+		if (!BuildReadQueryAIContextBundleJson(
+			InputRootObject,
+			MaxItems,
+			MaxBytes,
+			JsonText,
+			ContextErrorCode,
+			ContextErrorDetail))
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *ContextErrorCode, *ContextErrorDetail);
+			return 2;
+		}
+
+		FString SaveErrorMessage;
+		if (!ADumpQueryIO::SaveJsonTextToFile(OutputFilePath, JsonText, SaveErrorMessage))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_OUTPUT_WRITE_FAILED: %s"), *SaveErrorMessage);
+			return 3;
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("Saved AI context bundle JSON: %s"), *OutputFilePath);
+		return 0;
+	}
+
+	// RunReadQuerySectionOrDependencyMode는 QueryKind=section|dependency를 native, query_result_v1 또는 fused ai_context_bundle_v1 응답으로 저장한다.
+	int32 RunReadQuerySectionOrDependencyMode(const FString& InCommandLine)
+	{
+		FString OutputFilePath;
+		if (!TryGetReadQueryOutputPath(InCommandLine, TEXT("ADUMP_QUERY_OUTPUT_REQUIRED: -Mode=query requires explicit -Output=."), OutputFilePath))
+		{
+			return 1;
+		}
+
+		FString JsonText;
+		FString AssetPath;
+		FString QueryKindText;
+		if (!FParse::Value(*InCommandLine, TEXT("QueryKind="), QueryKindText)
+			|| QueryKindText.TrimStartAndEnd().IsEmpty())
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_KIND_REQUIRED: -Mode=query requires -QueryKind=section|dependency."));
+			return 1;
+		}
+		QueryKindText = QueryKindText.TrimStartAndEnd().ToLower();
+		if (QueryKindText != TEXT("section") && QueryKindText != TEXT("dependency"))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_KIND_INVALID: QueryKind must be section or dependency."));
+			return 1;
+		}
+
+		FString ResultSchemaText = TEXT("native");
+		FString ExplicitResultSchemaText;
+		const bool bHasResultSchemaOption = InCommandLine.Contains(TEXT("ResultSchema="), ESearchCase::IgnoreCase);
+		if (bHasResultSchemaOption)
+		{
+			FParse::Value(*InCommandLine, TEXT("ResultSchema="), ExplicitResultSchemaText);
+			ResultSchemaText = ExplicitResultSchemaText.TrimStartAndEnd().ToLower();
+			if (ResultSchemaText != TEXT("native")
+				&& ResultSchemaText != TEXT("query_result_v1")
+				&& ResultSchemaText != TEXT("ai_context_bundle_v1"))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_RESULT_SCHEMA_INVALID: ResultSchema must be native, query_result_v1 or ai_context_bundle_v1."));
+				return 1;
+			}
+		}
+
+		// bFusedContextBundle은 query_result_v1을 파일로 내보내지 않고 메모리에서 바로 ai_context_bundle_v1로 변환하는 단일 실행 경로다.
+		const bool bFusedContextBundle = ResultSchemaText == TEXT("ai_context_bundle_v1");
+		const bool bHasBundleBoundOption = InCommandLine.Contains(TEXT("MaxItems="), ESearchCase::IgnoreCase)
+			|| InCommandLine.Contains(TEXT("MaxBytes="), ESearchCase::IgnoreCase);
+		if (bHasBundleBoundOption && !bFusedContextBundle)
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_OPTION_UNSUPPORTED: MaxItems and MaxBytes require ResultSchema=ai_context_bundle_v1."));
+			return 1;
+		}
+
+		auto TryParseBundleBoundInteger = [](const FString& InText, int32 InMinimum, int32 InMaximum, int32& OutValue)
+		{
+			if (InText.IsEmpty()) return false;
+			for (int32 CharacterIndex = 0; CharacterIndex < InText.Len(); ++CharacterIndex)
+			{
+				if (!FChar::IsDigit(InText[CharacterIndex])) return false;
+			}
+			OutValue = FCString::Atoi(*InText);
+			return OutValue >= InMinimum && OutValue <= InMaximum;
+		};
+
+		// BundleMaxItems와 BundleMaxBytes는 contextbundle 모드와 같은 기본값/범위의 bundle 한도다.
+		int32 BundleMaxItems = 64;
+		int32 BundleMaxBytes = 262144;
+		if (bFusedContextBundle)
+		{
+			FString BundleBoundText;
+			if (InCommandLine.Contains(TEXT("MaxItems="), ESearchCase::IgnoreCase)
+				&& (!FParse::Value(*InCommandLine, TEXT("MaxItems="), BundleBoundText)
+					|| !TryParseBundleBoundInteger(BundleBoundText.TrimStartAndEnd(), 1, 256, BundleMaxItems)))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_MAX_ITEMS_INVALID: MaxItems must be an integer from 1 through 256."));
+				return 1;
+			}
+			if (InCommandLine.Contains(TEXT("MaxBytes="), ESearchCase::IgnoreCase)
+				&& (!FParse::Value(*InCommandLine, TEXT("MaxBytes="), BundleBoundText)
+					|| !TryParseBundleBoundInteger(BundleBoundText.TrimStartAndEnd(), 4096, 1048576, BundleMaxBytes)))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_CONTEXT_MAX_BYTES_INVALID: MaxBytes must be an integer from 4096 through 1048576."));
+				return 1;
+			}
+		}
+
+		// NativeQueryRootObject는 fused 경로에서 직렬화 없이 넘길 native query response object다.
+		TSharedPtr<FJsonObject> NativeQueryRootObject;
+
+		FString UnsupportedOptionValue;
+		if (FParse::Value(*InCommandLine, TEXT("Intent="), UnsupportedOptionValue)
+			|| FParse::Value(*InCommandLine, TEXT("Profile="), UnsupportedOptionValue))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_OPTION_UNSUPPORTED: query mode does not accept Intent or Profile."));
+			return 1;
+		}
+
+		FString AssetIdSelector;
+		const bool bHasAssetSelector = FParse::Value(*InCommandLine, TEXT("Asset="), AssetPath) && !AssetPath.IsEmpty();
+		const bool bHasAssetIdSelector = FParse::Value(*InCommandLine, TEXT("AssetId="), AssetIdSelector) && !AssetIdSelector.IsEmpty();
+		if (!bHasAssetSelector && !bHasAssetIdSelector)
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_SELECTOR_REQUIRED: Provide exactly one of -Asset= or -AssetId=."));
+			return 1;
+		}
+		if (bHasAssetSelector && bHasAssetIdSelector)
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_SELECTOR_CONFLICT: -Asset= and -AssetId= cannot be used together."));
+			return 1;
+		}
+
+		FString DumpRootPath;
+		if (!FParse::Value(*InCommandLine, TEXT("DumpRoot="), DumpRootPath))
+		{
+			DumpRootPath = FPaths::Combine(ADumpQueryIO::BuildDefaultDumpRootDirectory(), TEXT("BPDump"));
+		}
+
+		if (QueryKindText == TEXT("section"))
+		{
+			if (FParse::Value(*InCommandLine, TEXT("Direction="), UnsupportedOptionValue)
+				|| FParse::Value(*InCommandLine, TEXT("Strength="), UnsupportedOptionValue)
+				|| FParse::Value(*InCommandLine, TEXT("MaxDepth="), UnsupportedOptionValue)
+				|| FParse::Value(*InCommandLine, TEXT("MaxNodes="), UnsupportedOptionValue)
+				|| FParse::Value(*InCommandLine, TEXT("MaxEdges="), UnsupportedOptionValue))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_OPTION_UNSUPPORTED: QueryKind=section does not accept dependency traversal options."));
+				return 1;
+			}
+
+			FString ExplicitSectionListText;
+			if (!FParse::Value(*InCommandLine, TEXT("Sections="), ExplicitSectionListText)
+				|| ExplicitSectionListText.TrimStartAndEnd().IsEmpty())
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_SECTIONS_REQUIRED: QueryKind=section requires explicit -Sections=."));
+				return 1;
+			}
+
+			TArray<FString> QuerySectionNames;
+			FString QuerySectionError;
+			if (!ADumpReadQuery::TryParseSectionNames(InCommandLine, QuerySectionNames, QuerySectionError)
+				|| QuerySectionNames.IsEmpty())
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_OPTION_UNSUPPORTED: %s"), *QuerySectionError);
+				return 1;
+			}
+
+			FString LazyDumpErrorCode;
+			FString LazyDumpErrorDetail;
+			const bool bLazyDumpBuilt = bFusedContextBundle
+				? BuildReadQueryLazySectionDumpObject(
+					DumpRootPath,
+					bHasAssetSelector ? AssetPath : FString(),
+					bHasAssetIdSelector ? AssetIdSelector : FString(),
+					QuerySectionNames,
+					BundleMaxItems,
+					BundleMaxBytes,
+					NativeQueryRootObject,
+					LazyDumpErrorCode,
+					LazyDumpErrorDetail)
+				: BuildReadQueryLazySectionDumpJson(
+					DumpRootPath,
+					bHasAssetSelector ? AssetPath : FString(),
+					bHasAssetIdSelector ? AssetIdSelector : FString(),
+					QuerySectionNames,
+					JsonText,
+					LazyDumpErrorCode,
+					LazyDumpErrorDetail);
+			if (!bLazyDumpBuilt)
+			{
+				UE_LOG(LogTemp, Error, TEXT("%s: %s"), *LazyDumpErrorCode, *LazyDumpErrorDetail);
+				return 2;
+			}
+		}
+		else
+		{
+			if (FParse::Value(*InCommandLine, TEXT("Sections="), UnsupportedOptionValue))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_OPTION_UNSUPPORTED: QueryKind=dependency does not accept Sections."));
+				return 1;
+			}
+
+			FString DirectionText = TEXT("dependencies");
+			FParse::Value(*InCommandLine, TEXT("Direction="), DirectionText);
+			DirectionText = DirectionText.TrimStartAndEnd().ToLower();
+			if (DirectionText != TEXT("dependencies")
+				&& DirectionText != TEXT("referencers")
+				&& DirectionText != TEXT("both"))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_DIRECTION_INVALID: Direction must be dependencies, referencers or both."));
+				return 1;
+			}
+
+			FString StrengthText = TEXT("all");
+			FParse::Value(*InCommandLine, TEXT("Strength="), StrengthText);
+			StrengthText = StrengthText.TrimStartAndEnd().ToLower();
+			if (StrengthText != TEXT("all") && StrengthText != TEXT("hard") && StrengthText != TEXT("soft"))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_STRENGTH_INVALID: Strength must be all, hard or soft."));
+				return 1;
+			}
+
+			auto TryParseBoundedInteger = [](const FString& InText, int32 InMinimum, int32 InMaximum, int32& OutValue)
+			{
+				if (InText.IsEmpty()) return false;
+				for (int32 CharacterIndex = 0; CharacterIndex < InText.Len(); ++CharacterIndex)
+				{
+					if (!FChar::IsDigit(InText[CharacterIndex])) return false;
+				}
+				OutValue = FCString::Atoi(*InText);
+				return OutValue >= InMinimum && OutValue <= InMaximum;
+			};
+
+			int32 MaxDepth = 1;
+			int32 MaxNodes = 64;
+			int32 MaxEdges = 128;
+			FString BoundText;
+			if (FParse::Value(*InCommandLine, TEXT("MaxDepth="), BoundText)
+				&& !TryParseBoundedInteger(BoundText.TrimStartAndEnd(), 1, 8, MaxDepth))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_MAX_DEPTH_INVALID: MaxDepth must be an integer from 1 through 8."));
+				return 1;
+			}
+			if (FParse::Value(*InCommandLine, TEXT("MaxNodes="), BoundText)
+				&& !TryParseBoundedInteger(BoundText.TrimStartAndEnd(), 1, 256, MaxNodes))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_MAX_NODES_INVALID: MaxNodes must be an integer from 1 through 256."));
+				return 1;
+			}
+			if (FParse::Value(*InCommandLine, TEXT("MaxEdges="), BoundText)
+				&& !TryParseBoundedInteger(BoundText.TrimStartAndEnd(), 1, 512, MaxEdges))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_MAX_EDGES_INVALID: MaxEdges must be an integer from 1 through 512."));
+				return 1;
+			}
+
+			FString QueryErrorCode;
+			FString QueryErrorDetail;
+			const bool bDependencyQueryBuilt = bFusedContextBundle
+				? BuildReadQueryDependencyTraceQueryObject(
+					DumpRootPath,
+					bHasAssetSelector ? AssetPath : FString(),
+					bHasAssetIdSelector ? AssetIdSelector : FString(),
+					DirectionText,
+					StrengthText,
+					MaxDepth,
+					MaxNodes,
+					MaxEdges,
+					NativeQueryRootObject,
+					QueryErrorCode,
+					QueryErrorDetail)
+				: BuildReadQueryDependencyTraceQueryJson(
+					DumpRootPath,
+					bHasAssetSelector ? AssetPath : FString(),
+					bHasAssetIdSelector ? AssetIdSelector : FString(),
+					DirectionText,
+					StrengthText,
+					MaxDepth,
+					MaxNodes,
+					MaxEdges,
+					JsonText,
+					QueryErrorCode,
+					QueryErrorDetail);
+			if (!bDependencyQueryBuilt)
+			{
+				UE_LOG(LogTemp, Error, TEXT("%s: %s"), *QueryErrorCode, *QueryErrorDetail);
+				return 2;
+			}
+		}
+
+		if (bFusedContextBundle)
+		{
+			TSharedPtr<FJsonObject> QueryResultRootObject;
+			FString WrapErrorDetail;
+			if (!BuildReadQueryQueryResultObject(
+				QueryKindText,
+				bHasAssetSelector ? TEXT("object_path") : TEXT("asset_id"),
+				NativeQueryRootObject,
+				QueryResultRootObject,
+				WrapErrorDetail))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_RESULT_WRAP_FAILED: %s"), *WrapErrorDetail);
+				return 2;
+			}
+
+			FString ContextErrorCode;
+			FString ContextErrorDetail;
+			if (!BuildReadQueryAIContextBundleJson(
+				QueryResultRootObject,
+				BundleMaxItems,
+				BundleMaxBytes,
+				JsonText,
+				ContextErrorCode,
+				ContextErrorDetail))
+			{
+				UE_LOG(LogTemp, Error, TEXT("%s: %s"), *ContextErrorCode, *ContextErrorDetail);
+				return 2;
+			}
+		}
+		else if (ResultSchemaText == TEXT("query_result_v1"))
+		{
+			FString WrappedJsonText;
+			FString WrapErrorDetail;
+			if (!BuildReadQueryQueryResultJson(
+				QueryKindText,
+				bHasAssetSelector ? TEXT("object_path") : TEXT("asset_id"),
+				JsonText,
+				WrappedJsonText,
+				WrapErrorDetail))
+			{
+				UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_RESULT_WRAP_FAILED: %s"), *WrapErrorDetail);
+				return 2;
+			}
+			JsonText = MoveTemp(WrappedJsonText);
+		}
+
+		FString SaveErrorMessage;
+		if (!ADumpQueryIO::SaveJsonTextToFile(OutputFilePath, JsonText, SaveErrorMessage))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_OUTPUT_WRITE_FAILED: %s"), *SaveErrorMessage);
+			return 3;
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("Saved query JSON (%s, result_schema=%s): %s"), *QueryKindText, *ResultSchemaText, *OutputFilePath);
+		return 0;
+	}
+
+	// RunReadQueryDependencyTraceMode는 dependency_index에서 bounded dependency_trace_query_v1을 만들어 저장한다.
+	int32 RunReadQueryDependencyTraceMode(const FString& InCommandLine)
+	{
+		FString OutputFilePath;
+		if (!TryGetReadQueryOutputPath(InCommandLine, TEXT("ADUMP_DEP_QUERY_OUTPUT_REQUIRED: -Mode=dependencyquery requires explicit -Output=."), OutputFilePath))
+		{
+			return 1;
+		}
+
+		FString JsonText;
+		FString AssetPath;
+		FString UnsupportedOptionValue;
+		if (FParse::Value(*InCommandLine, TEXT("Sections="), UnsupportedOptionValue)
+			|| FParse::Value(*InCommandLine, TEXT("Intent="), UnsupportedOptionValue)
+			|| FParse::Value(*InCommandLine, TEXT("Profile="), UnsupportedOptionValue)
+			|| FParse::Value(*InCommandLine, TEXT("ResultSchema="), UnsupportedOptionValue))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_OPTION_UNSUPPORTED: dependencyquery does not accept Sections, Intent, Profile or ResultSchema."));
+			return 1;
+		}
+
+		FString AssetIdSelector;
+		const bool bHasAssetSelector = FParse::Value(*InCommandLine, TEXT("Asset="), AssetPath) && !AssetPath.IsEmpty();
+		const bool bHasAssetIdSelector = FParse::Value(*InCommandLine, TEXT("AssetId="), AssetIdSelector) && !AssetIdSelector.IsEmpty();
+		if (!bHasAssetSelector && !bHasAssetIdSelector)
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_SELECTOR_REQUIRED: Provide exactly one of -Asset= or -AssetId=."));
+			return 1;
+		}
+		if (bHasAssetSelector && bHasAssetIdSelector)
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_SELECTOR_CONFLICT: -Asset= and -AssetId= cannot be used together."));
+			return 1;
+		}
+
+		FString DirectionText = TEXT("dependencies");
+		FParse::Value(*InCommandLine, TEXT("Direction="), DirectionText);
+		DirectionText = DirectionText.TrimStartAndEnd().ToLower();
+		if (DirectionText != TEXT("dependencies")
+			&& DirectionText != TEXT("referencers")
+			&& DirectionText != TEXT("both"))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_DIRECTION_INVALID: Direction must be dependencies, referencers or both."));
+			return 1;
+		}
+
+		FString StrengthText = TEXT("all");
+		FParse::Value(*InCommandLine, TEXT("Strength="), StrengthText);
+		StrengthText = StrengthText.TrimStartAndEnd().ToLower();
+		if (StrengthText != TEXT("all") && StrengthText != TEXT("hard") && StrengthText != TEXT("soft"))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_STRENGTH_INVALID: Strength must be all, hard or soft."));
+			return 1;
+		}
+
+		auto TryParseBoundedInteger = [](const FString& InText, int32 InMinimum, int32 InMaximum, int32& OutValue)
+		{
+			if (InText.IsEmpty()) return false;
+			for (int32 CharacterIndex = 0; CharacterIndex < InText.Len(); ++CharacterIndex)
+			{
+				if (!FChar::IsDigit(InText[CharacterIndex])) return false;
+			}
+			OutValue = FCString::Atoi(*InText);
+			return OutValue >= InMinimum && OutValue <= InMaximum;
+		};
+
+		int32 MaxDepth = 1;
+		int32 MaxNodes = 64;
+		int32 MaxEdges = 128;
+		FString BoundText;
+		if (FParse::Value(*InCommandLine, TEXT("MaxDepth="), BoundText)
+			&& !TryParseBoundedInteger(BoundText.TrimStartAndEnd(), 1, 8, MaxDepth))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_MAX_DEPTH_INVALID: MaxDepth must be an integer from 1 through 8."));
+			return 1;
+		}
+		if (FParse::Value(*InCommandLine, TEXT("MaxNodes="), BoundText)
+			&& !TryParseBoundedInteger(BoundText.TrimStartAndEnd(), 1, 256, MaxNodes))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_MAX_NODES_INVALID: MaxNodes must be an integer from 1 through 256."));
+			return 1;
+		}
+		if (FParse::Value(*InCommandLine, TEXT("MaxEdges="), BoundText)
+			&& !TryParseBoundedInteger(BoundText.TrimStartAndEnd(), 1, 512, MaxEdges))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_MAX_EDGES_INVALID: MaxEdges must be an integer from 1 through 512."));
+			return 1;
+		}
+
+		FString DumpRootPath;
+		if (!FParse::Value(*InCommandLine, TEXT("DumpRoot="), DumpRootPath))
+		{
+			DumpRootPath = FPaths::Combine(ADumpQueryIO::BuildDefaultDumpRootDirectory(), TEXT("BPDump"));
+		}
+
+		FString QueryErrorCode;
+		FString QueryErrorDetail;
+		if (!BuildReadQueryDependencyTraceQueryJson(
+			DumpRootPath,
+			bHasAssetSelector ? AssetPath : FString(),
+			bHasAssetIdSelector ? AssetIdSelector : FString(),
+			DirectionText,
+			StrengthText,
+			MaxDepth,
+			MaxNodes,
+			MaxEdges,
+			JsonText,
+			QueryErrorCode,
+			QueryErrorDetail))
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *QueryErrorCode, *QueryErrorDetail);
+			return 2;
+		}
+
+		FString SaveErrorMessage;
+		if (!ADumpQueryIO::SaveJsonTextToFile(OutputFilePath, JsonText, SaveErrorMessage))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_DEP_QUERY_OUTPUT_WRITE_FAILED: %s"), *SaveErrorMessage);
+			return 3;
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("Saved dependency trace query JSON: %s"), *OutputFilePath);
+		return 0;
+	}
+
+	// FReadQuerySectionDumpArguments는 검사를 통과한 sectiondump 명령줄 인자다.
+	struct FReadQuerySectionDumpArguments
+	{
+		TArray<FString> SectionNames;
+		FString OutputFilePath;
+		FString AssetPath;
+		FString AssetIdSelector;
+		FString DumpRootPath;
+	};
+
+	// TryParseReadQuerySectionDumpArguments는 commandlet과 같은 순서(section 이름, -Output=, -Sections= 필수, 선택 source, selector)로 인자를 검사하고 첫 오류 줄을 돌려준다.
+	bool TryParseReadQuerySectionDumpArguments(const FString& InCommandLine, FReadQuerySectionDumpArguments& OutArguments, FString& OutErrorMessage)
+	{
+		OutArguments = FReadQuerySectionDumpArguments();
+		OutErrorMessage.Reset();
+
+		// section 이름 오류는 commandlet의 -Sections= 선택 파싱처럼 출력 경로 검사보다 먼저 보고한다.
+		if (!ADumpReadQuery::TryParseSectionNames(InCommandLine, OutArguments.SectionNames, OutErrorMessage))
+		{
+			return false;
+		}
+
+		if (!FParse::Value(*InCommandLine, TEXT("Output="), OutArguments.OutputFilePath))
+		{
+			OutErrorMessage = TEXT("ADUMP_LAZY_DUMP_OUTPUT_REQUIRED: -Mode=sectiondump requires explicit -Output=.");
+			return false;
+		}
+
+		FString ExplicitSectionListText;
+		if (!FParse::Value(*InCommandLine, TEXT("Sections="), ExplicitSectionListText)
+			|| ExplicitSectionListText.TrimStartAndEnd().IsEmpty()
+			|| OutArguments.SectionNames.IsEmpty())
+		{
+			OutErrorMessage = TEXT("ADUMP_LAZY_DUMP_SECTIONS_REQUIRED: -Mode=sectiondump requires explicit -Sections=.");
+			return false;
+		}
+
+		// Intent/Profile 이름 검증은 registry를 가진 commandlet이 위임 전에 하므로 여기서는 지정 자체만 거부한다.
+		FString DirectSelectionSourceValue;
+		if (FParse::Value(*InCommandLine, TEXT("Intent="), DirectSelectionSourceValue)
+			|| FParse::Value(*InCommandLine, TEXT("Profile="), DirectSelectionSourceValue)
+			|| FParse::Value(*InCommandLine, TEXT("ResultSchema="), DirectSelectionSourceValue))
+		{
+			OutErrorMessage = TEXT("ADUMP_LAZY_DUMP_SELECTION_SOURCE_UNSUPPORTED: -Mode=sectiondump accepts explicit -Sections= only; Intent, Profile and ResultSchema are not supported.");
+			return false;
+		}
+
+		const bool bHasAssetSelector = FParse::Value(*InCommandLine, TEXT("Asset="), OutArguments.AssetPath) && !OutArguments.AssetPath.IsEmpty();
+		const bool bHasAssetIdSelector = FParse::Value(*InCommandLine, TEXT("AssetId="), OutArguments.AssetIdSelector) && !OutArguments.AssetIdSelector.IsEmpty();
+		if (!bHasAssetSelector && !bHasAssetIdSelector)
+		{
+			OutErrorMessage = TEXT("ADUMP_LAZY_DUMP_SELECTOR_REQUIRED: Provide exactly one of -Asset= or -AssetId=.");
+			return false;
+		}
+		if (bHasAssetSelector && bHasAssetIdSelector)
+		{
+			OutErrorMessage = TEXT("ADUMP_LAZY_DUMP_SELECTOR_CONFLICT: -Asset= and -AssetId= cannot be used together.");
+			return false;
+		}
+		if (!bHasAssetSelector)
+		{
+			OutArguments.AssetPath.Reset();
+		}
+		if (!bHasAssetIdSelector)
+		{
+			OutArguments.AssetIdSelector.Reset();
+		}
+
+		if (!FParse::Value(*InCommandLine, TEXT("DumpRoot="), OutArguments.DumpRootPath))
+		{
+			OutArguments.DumpRootPath = FPaths::Combine(ADumpQueryIO::BuildDefaultDumpRootDirectory(), TEXT("BPDump"));
+		}
+		return true;
+	}
+
+	// RunReadQuerySectionDumpMode는 accepted index에서 요청 section만 읽은 lazy_section_dump_v1을 저장한다.
+	int32 RunReadQuerySectionDumpMode(const FString& InCommandLine)
+	{
+		FReadQuerySectionDumpArguments Arguments;
+		FString ArgumentError;
+		if (!TryParseReadQuerySectionDumpArguments(InCommandLine, Arguments, ArgumentError))
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s"), *ArgumentError);
+			return 1;
+		}
+
+		FString JsonText;
+		FString LazyDumpErrorCode;
+		FString LazyDumpErrorDetail;
+		if (!BuildReadQueryLazySectionDumpJson(
+			Arguments.DumpRootPath,
+			Arguments.AssetPath,
+			Arguments.AssetIdSelector,
+			Arguments.SectionNames,
+			JsonText,
+			LazyDumpErrorCode,
+			LazyDumpErrorDetail))
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: %s"), *LazyDumpErrorCode, *LazyDumpErrorDetail);
+			return 2;
+		}
+
+		FString SaveErrorMessage;
+		if (!ADumpQueryIO::SaveJsonTextToFile(Arguments.OutputFilePath, JsonText, SaveErrorMessage))
+		{
+			UE_LOG(LogTemp, Error, TEXT("ADUMP_LAZY_DUMP_OUTPUT_WRITE_FAILED: %s"), *SaveErrorMessage);
+			return 3;
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("Saved lazy section dump JSON: %s"), *Arguments.OutputFilePath);
+		return 0;
+	}
+}
+
+namespace ADumpReadQuery
+{
+	const TArray<FString>& GetSectionNameRegistry()
+	{
+		// SectionNameRegistry는 FADumpSectionSelection::GetEnabledNames와 같은 정식 section 순서다.
+		static const TArray<FString> SectionNameRegistry = {
+			TEXT("summary"),
+			TEXT("digest"),
+			TEXT("details"),
+			TEXT("data_asset_values"),
+			TEXT("data_asset_diff"),
+			TEXT("input_summary"),
+			TEXT("component_tree"),
+			TEXT("bp_search_index"),
+			TEXT("graphs"),
+			TEXT("references"),
+			TEXT("widget_designer"),
+			TEXT("entity_evidence")
+		};
+		return SectionNameRegistry;
+	}
+
+	bool TryParseSectionNames(const FString& InCommandLine, TArray<FString>& OutSectionNames, FString& OutErrorMessage)
+	{
+		OutSectionNames.Reset();
+		OutErrorMessage.Reset();
+
+		// SectionListText는 쉼표를 보존한 -Sections= 토큰 원문이다. FParse::Value는 쉼표에서 값을 자른다.
+		FString SectionListText;
+		bool bHasSectionList = false;
+		const TCHAR* CommandLineCursor = *InCommandLine;
+		FString CommandToken;
+		while (!bHasSectionList && FParse::Token(CommandLineCursor, CommandToken, true))
+		{
+			CommandToken.RemoveFromStart(TEXT("-"));
+			if (CommandToken.StartsWith(TEXT("Sections="), ESearchCase::IgnoreCase))
+			{
+				SectionListText = CommandToken.Mid(9);
+				bHasSectionList = true;
+			}
+		}
+		if (!bHasSectionList)
+		{
+			return true;
+		}
+
+		const TArray<FString>& SectionNameRegistry = GetSectionNameRegistry();
+		const FString ValidSectionNamesText = FString::Join(SectionNameRegistry, TEXT(","));
+
+		// bEnabledByOrdinal은 중복 이름을 한 번만 세고 결과를 registry 순서로 돌려주기 위한 표시다.
+		TArray<bool> bEnabledByOrdinal;
+		bEnabledByOrdinal.Init(false, SectionNameRegistry.Num());
+
+		TArray<FString> SectionNameArray;
+		SectionListText.ParseIntoArray(SectionNameArray, TEXT(","), false);
+		for (FString& SectionName : SectionNameArray)
+		{
+			SectionName.TrimStartAndEndInline();
+			SectionName.ToLowerInline();
+			if (SectionName.IsEmpty())
+			{
+				OutErrorMessage = FString::Printf(TEXT("Invalid empty section name in -Sections=. Valid sections: %s"), *ValidSectionNamesText);
+				return false;
+			}
+
+			const int32 SectionOrdinal = SectionNameRegistry.IndexOfByKey(SectionName);
+			if (SectionOrdinal == INDEX_NONE)
+			{
+				OutErrorMessage = FString::Printf(TEXT("Unknown section '%s' in -Sections=. Valid sections: %s"), *SectionName, *ValidSectionNamesText);
+				return false;
+			}
+			bEnabledByOrdinal[SectionOrdinal] = true;
+		}
+
+		for (int32 SectionOrdinal = 0; SectionOrdinal < SectionNameRegistry.Num(); ++SectionOrdinal)
+		{
+			if (bEnabledByOrdinal[SectionOrdinal])
+			{
+				OutSectionNames.Add(SectionNameRegistry[SectionOrdinal]);
+			}
+		}
+		if (OutSectionNames.IsEmpty())
+		{
+			OutErrorMessage = FString::Printf(TEXT("-Sections= requires at least one section. Valid sections: %s"), *ValidSectionNamesText);
+			return false;
+		}
+		return true;
+	}
+
+	bool ValidateSectionDumpArguments(const FString& InCommandLine, FString& OutErrorMessage)
+	{
+		FReadQuerySectionDumpArguments Arguments;
+		return TryParseReadQuerySectionDumpArguments(InCommandLine, Arguments, OutErrorMessage);
+	}
+
+	bool BuildSelectorIndexJson(
+		const FString& InDumpRootPath,
+		const FString& InAssetIndexJsonText,
+		const FString& InSectionIndexJsonText,
+		const TArray<TSharedPtr<FJsonObject>>& InAssetEntryObjects,
+		const TArray<TSharedPtr<FJsonObject>>& InSectionEntryObjects,
+		const FString& InGeneratedTimeText,
+		FString& OutJsonText)
+	{
+		return BuildReadQuerySelectorIndexJson(
+			InDumpRootPath,
+			InAssetIndexJsonText,
+			InSectionIndexJsonText,
+			InAssetEntryObjects,
+			InSectionEntryObjects,
+			InGeneratedTimeText,
+			OutJsonText);
+	}
+
+	bool ValidateSelectorIndexContract(const FString& InDumpRootPath, int32& OutAssetCount, int32& OutSectionCount, FString& OutDetail)
+	{
+		return ValidateReadQuerySelectorIndexContract(InDumpRootPath, OutAssetCount, OutSectionCount, OutDetail);
+	}
+
+	bool BuildAIContextBundleJson(
+		const TSharedPtr<FJsonObject>& InQueryResultObject,
+		int32 InMaxItems,
+		int32 InMaxBytes,
+		FString& OutJsonText,
+		FString& OutErrorCode,
+		FString& OutErrorDetail,
+		bool bInUseReferenceByteFit)
+	{
+		return BuildReadQueryAIContextBundleJson(
+			InQueryResultObject,
+			InMaxItems,
+			InMaxBytes,
+			OutJsonText,
+			OutErrorCode,
+			OutErrorDetail,
+			bInUseReferenceByteFit);
+	}
+
+	bool IsReadQueryMode(const FString& InMode)
+	{
+		return InMode.Equals(TEXT("entityquery"), ESearchCase::IgnoreCase)
+			|| InMode.Equals(TEXT("entitycontext"), ESearchCase::IgnoreCase)
+			|| InMode.Equals(TEXT("sectiondump"), ESearchCase::IgnoreCase)
+			|| InMode.Equals(TEXT("dependencyquery"), ESearchCase::IgnoreCase)
+			|| InMode.Equals(TEXT("query"), ESearchCase::IgnoreCase)
+			|| InMode.Equals(TEXT("contextbundle"), ESearchCase::IgnoreCase)
+			|| InMode.Equals(TEXT("inputquery"), ESearchCase::IgnoreCase);
+	}
+
+	int32 RunReadQueryMode(const FString& InMode, const FString& InCommandLine)
+	{
+		if (InMode.Equals(TEXT("entityquery"), ESearchCase::IgnoreCase))
+		{
+			return RunReadQueryEntityQueryMode(InCommandLine);
+		}
+		if (InMode.Equals(TEXT("entitycontext"), ESearchCase::IgnoreCase))
+		{
+			return RunReadQueryEntityContextMode(InCommandLine);
+		}
+		if (InMode.Equals(TEXT("sectiondump"), ESearchCase::IgnoreCase))
+		{
+			return RunReadQuerySectionDumpMode(InCommandLine);
+		}
+		if (InMode.Equals(TEXT("dependencyquery"), ESearchCase::IgnoreCase))
+		{
+			return RunReadQueryDependencyTraceMode(InCommandLine);
+		}
+		if (InMode.Equals(TEXT("query"), ESearchCase::IgnoreCase))
+		{
+			return RunReadQuerySectionOrDependencyMode(InCommandLine);
+		}
+		if (InMode.Equals(TEXT("contextbundle"), ESearchCase::IgnoreCase))
+		{
+			return RunReadQueryContextBundleMode(InCommandLine);
+		}
+		if (InMode.Equals(TEXT("inputquery"), ESearchCase::IgnoreCase))
+		{
+			return RunReadQueryInputQueryMode(InCommandLine);
+		}
+
+		UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_MODE_UNSUPPORTED: -Mode=%s is not a read-only query mode."), *InMode);
+		return 1;
+	}
+}
@@ -0,0 +1,8 @@
+// File: AssetDumpQueryModule.cpp
+// Version: v0.1.0
+// Changelog:
+// - v0.1.0: 에디터 module과 AssetDumpQueryTool program이 함께 쓰는 read-only query module 등록을 추가.
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, AssetDumpQuery)
@@ -0,0 +1,89 @@
+// File: ADumpContentStore.h
+// Version: v1.0.2
+// Changelog:
+// - v1.0.2: GC가 쓰는 중일 수 있는 최근 임시 blob을 남기도록 계약을 좁힘.
+// - v1.0.1: content store sidecar 복원 읽기와 함께 AssetDumpQuery module로 옮기고 export macro를 교체.
+// - v1.0.0: section payload content-addressed store(content_store/<hash 앞 2자>/<hash>.json), manifest 참조 mark-sweep GC와 dedup 보고 계약을 추가.
+// Migration:
+// - store는 opt-in(-DedupSections=true batchdump)이며 manifest content_refs가 없는 기존 dump의 sidecar 파일 의미를 변경하지 않는다.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// FADumpContentStoreReport는 content store GC 한 번의 참조 집계와 회수 결과다.
+struct ASSETDUMPQUERY_API FADumpContentStoreReport
+{
+	// StoreRootPath는 집계한 content store 폴더 절대 경로다.
+	FString StoreRootPath;
+
+	// bDryRun은 삭제 없이 집계만 했는지 여부다.
+	bool bDryRun = false;
+
+	// ManifestCount는 검사한 manifest 수이고, ReferencingManifestCount는 그중 store를 참조한 manifest 수다.
+	int32 ManifestCount = 0;
+	int32 ReferencingManifestCount = 0;
+
+	// ReferenceCount는 manifest content_refs 항목 총수이고, ReferencedBlobCount는 서로 다른 참조 hash 수다.
+	int32 ReferenceCount = 0;
+	int32 ReferencedBlobCount = 0;
+
+	// LiveBlobCount는 참조가 남은 blob 수, MissingBlobCount는 참조됐지만 파일이 없는 hash 수다.
+	int32 LiveBlobCount = 0;
+	int32 MissingBlobCount = 0;
+
+	// DeletedBlobCount와 ReclaimedBytes는 참조 수 0인 blob과 남은 임시 파일의 회수 결과다. dry run이면 회수 예정 값이다.
+	int32 DeletedBlobCount = 0;
+	int32 DeleteFailedCount = 0;
+	int64 ReclaimedBytes = 0;
+
+	// LogicalBytes는 참조마다 blob을 따로 저장했을 때 byte 수이고, StoredBytes는 실제 live blob byte 수다.
+	int64 LogicalBytes = 0;
+	int64 StoredBytes = 0;
+
+	// DedupRatio는 LogicalBytes / StoredBytes다. live blob이 없으면 1이다.
+	double DedupRatio = 1.0;
+};
+
+// ADumpContentStore는 같은 section payload를 hash 이름 blob 하나로 공유하는 content-addressed 저장과 GC를 제공한다.
+namespace ADumpContentStore
+{
+	// GetContentStoreDirectoryName은 dump root 아래 content store 폴더 이름이다.
+	ASSETDUMPQUERY_API const TCHAR* GetContentStoreDirectoryName();
+
+	// GetContentStoreReportFileName은 dump root 아래 GC 보고서 파일 이름이다.
+	ASSETDUMPQUERY_API const TCHAR* GetContentStoreReportFileName();
+
+	// BuildContentHash는 payload byte의 소문자 SHA-1 hex hash다.
+	ASSETDUMPQUERY_API FString BuildContentHash(const TArray<uint8>& InBytes);
+
+	// IsValidContentHash는 40자 소문자 hex hash인지 검사한다.
+	ASSETDUMPQUERY_API bool IsValidContentHash(const FString& InContentHash);
+
+	// BuildContentBlobPath는 store root 아래 hash blob 파일 경로다.
+	ASSETDUMPQUERY_API FString BuildContentBlobPath(const FString& InStoreRootPath, const FString& InContentHash);
+
+	// ResolveManifestStoreRootPath는 manifest content_store 값(manifest 폴더 기준 상대 또는 절대 경로)을 정규화한 store root로 바꾼다.
+	ASSETDUMPQUERY_API FString ResolveManifestStoreRootPath(const FString& InManifestFilePath, const FString& InContentStoreText);
+
+	// StoreContent는 hash blob이 없을 때만 저장 형태 byte를 임시 파일 + move로 원자 저장한다. 이미 있으면 bOutReused가 true다.
+	ASSETDUMPQUERY_API bool StoreContent(
+		const FString& InStoreRootPath,
+		const FString& InContentHash,
+		const TArray<uint8>& InStoredBytes,
+		bool& bOutReused,
+		FString& OutErrorCode,
+		FString& OutErrorDetail);
+
+	// TryLoadContent는 hash blob의 저장 형태 byte를 읽는다. 압축 해제와 hash 검증은 호출자 몫이다.
+	ASSETDUMPQUERY_API bool TryLoadContent(const FString& InStoreRootPath, const FString& InContentHash, TArray<uint8>& OutStoredBytes);
+
+	// CollectGarbage는 dump root manifest(pack 포함)의 content_refs로 blob 참조 수를 세고 참조 수 0 blob과 한 시간 넘게 남은 임시 파일을 지운 뒤 보고서를 원자 저장한다.
+	ASSETDUMPQUERY_API bool CollectGarbage(
+		const FString& InDumpRootPath,
+		bool bInDryRun,
+		FADumpContentStoreReport& OutReport,
+		FString& OutReportFilePath,
+		FString& OutErrorCode,
+		FString& OutErrorDetail);
+}
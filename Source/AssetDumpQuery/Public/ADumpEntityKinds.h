@@ -0,0 +1,44 @@
+// File: ADumpEntityKinds.h
+// Version: v1.0.0
+// Changelog:
+// - v1.0.0: entity evidence 생성과 read-only entity query가 공유하는 Entity/Relation kind registry를 Core 전용 module로 분리.
+// Migration:
+// - ADumpEntityEvidence의 같은 이름 함수는 using 선언으로 이 registry를 그대로 가리킨다.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// ADumpEntityKinds는 entity_evidence_v1 adapter profile별 canonical Entity/Relation kind 순서를 제공한다.
+namespace ADumpEntityKinds
+{
+	// GetEntityKindRegistry는 Phase 1에서 허용된 exact Core Entity Kind를 canonical 순서로 반환한다.
+	ASSETDUMPQUERY_API const TArray<FString>& GetEntityKindRegistry();
+
+	// GetRelationKindRegistry는 Phase 1에서 허용된 exact Core Relation Kind를 canonical 순서로 반환한다.
+	ASSETDUMPQUERY_API const TArray<FString>& GetRelationKindRegistry();
+
+	// GetNiagaraEntityKindRegistry는 common asset과 Niagara MVP Entity Kind를 canonical 순서로 반환한다.
+	ASSETDUMPQUERY_API const TArray<FString>& GetNiagaraEntityKindRegistry();
+
+	// GetNiagaraRelationKindRegistry는 Niagara MVP Relation Kind를 canonical 순서로 반환한다.
+	ASSETDUMPQUERY_API const TArray<FString>& GetNiagaraRelationKindRegistry();
+
+	// GetNiagaraDeepEntityKindRegistry는 Niagara MVP 뒤에 Deep Entity Kind를 append한 exact 18-kind registry를 반환한다.
+	ASSETDUMPQUERY_API const TArray<FString>& GetNiagaraDeepEntityKindRegistry();
+
+	// GetNiagaraDeepRelationKindRegistry는 Niagara MVP 뒤에 parameter access Relation을 append한 exact 12-kind registry를 반환한다.
+	ASSETDUMPQUERY_API const TArray<FString>& GetNiagaraDeepRelationKindRegistry();
+
+	// GetNiagaraMaterialEntityKindRegistry는 Deep 뒤에 renderer resource를 append한 exact 19-kind registry를 반환한다.
+	ASSETDUMPQUERY_API const TArray<FString>& GetNiagaraMaterialEntityKindRegistry();
+
+	// GetNiagaraMaterialRelationKindRegistry는 Deep exact 12 Relation 의미를 그대로 재사용한다.
+	ASSETDUMPQUERY_API const TArray<FString>& GetNiagaraMaterialRelationKindRegistry();
+
+	// GetKnownEntityKindRegistry는 Core와 Niagara Material Entity registry의 deterministic union을 반환한다.
+	ASSETDUMPQUERY_API const TArray<FString>& GetKnownEntityKindRegistry();
+
+	// GetKnownRelationKindRegistry는 Core와 Niagara Material Relation registry의 deterministic union을 반환한다.
+	ASSETDUMPQUERY_API const TArray<FString>& GetKnownRelationKindRegistry();
+}
@@ -1,6 +1,8 @@
 // File: ADumpEntityQuery.h
-// Version: v1.1.0
+// Version: v1.3.0
 // Changelog:
+// - v1.3.0: BuildEntityIndex에 source 읽기를 단일 thread로 강제하는 validate 비교용 옵션을 추가.
+// - v1.2.0: AssetDumpQuery module로 옮기고 commandlet과 독립 query program이 함께 링크하도록 export.
 // - v1.1.0: read-only entityquery와 frozen query/context success envelope 계약을 반영.
 // - v1.0.0: entity_index_v1, entityquery와 entitycontext public command core 계약을 추가.
 // Migration:
@@ -14,26 +16,28 @@
 namespace ADumpEntityQuery
 {
 	// BuildEntityIndex는 dump root의 entity_evidence_v1 section을 entity_index_v1으로 원자 저장한다.
-	bool BuildEntityIndex(
+	// bInForceSingleThread는 validate가 병렬 source 읽기 결과를 직렬 build와 비교할 때만 켠다.
+	ASSETDUMPQUERY_API bool BuildEntityIndex(
 		const FString& InDumpRootPath,
 		FString& OutEntityIndexFilePath,
 		FString& OutErrorCode,
-		FString& OutErrorDetail);
+		FString& OutErrorDetail,
+		bool bInForceSingleThread = false);
 
 	// BuildEntityQueryJson은 -Mode=entityquery command line을 검증하고 entity_query_result_v1을 만든다.
-	bool BuildEntityQueryJson(
+	ASSETDUMPQUERY_API bool BuildEntityQueryJson(
 		const FString& InCommandLine,
 		FString& OutJsonText,
 		FString& OutErrorCode,
 		FString& OutErrorDetail);
 
 	// BuildEntityContextJson은 성공한 entity_query_result_v1을 bounded entity_context_bundle_v1으로 변환한다.
-	bool BuildEntityContextJson(
+	ASSETDUMPQUERY_API bool BuildEntityContextJson(
 		const FString& InCommandLine,
 		FString& OutJsonText,
 		FString& OutErrorCode,
 		FString& OutErrorDetail);
 
 	// GetStableFailureRegistry는 AIRE-G1에서 동결한 stable failure code를 canonical 순서로 반환한다.
-	const TArray<FString>& GetStableFailureRegistry();
+	ASSETDUMPQUERY_API const TArray<FString>& GetStableFailureRegistry();
 }
@@ -0,0 +1,28 @@
+// File: ADumpInputIndex.h
+// Version: v1.0.0
+// Changelog:
+// - v1.0.0: dump된 input_summary section만 읽어 만드는 전역 input_binding_index_v1(key posting, action 역참조, 충돌 집합)과 -Mode=inputquery 계약을 추가.
+// Migration:
+// - section_index_v1의 input_summary entry를 입력으로 쓰는 additive index이며 자산을 로드하지 않고 기존 index 파일의 의미를 변경하지 않는다.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// ADumpInputIndex는 모든 Input Mapping Context의 binding을 key/action 기준으로 교차 조회하는 read-only 경로를 제공한다.
+namespace ADumpInputIndex
+{
+	// BuildInputBindingIndex는 dump root의 section_index.json input_summary entry에서 input_binding_index_v1을 원자 저장한다.
+	ASSETDUMPQUERY_API bool BuildInputBindingIndex(
+		const FString& InDumpRootPath,
+		FString& OutInputIndexFilePath,
+		FString& OutErrorCode,
+		FString& OutErrorDetail);
+
+	// BuildInputQueryJson은 -Mode=inputquery command line(-Key=, -Action=, -Context=, -Conflicts=true)을 검증하고 input_query_result_v1을 만든다.
+	ASSETDUMPQUERY_API bool BuildInputQueryJson(
+		const FString& InCommandLine,
+		FString& OutJsonText,
+		FString& OutErrorCode,
+		FString& OutErrorDetail);
+}
@@ -0,0 +1,83 @@
+// File: ADumpPack.h
+// Version: v1.1.0
+// Changelog:
+// - v1.1.0: 삭제 자산 dump를 다음 commit TOC에서 빼는 RemovePackedDirectory를 추가.
+// - v1.0.1: 에디터 없이 빌드되는 AssetDumpQuery module로 옮기고 export macro를 교체.
+// - v1.0.0: dump root 단일 append-only pack(dump_pack.adpk), footer TOC 원자 commit, mmap 읽기와 directory export 계약을 추가.
+// Migration:
+// - pack은 opt-in(-Pack=true batchdump)이며 pack 밖의 실제 파일이 항상 우선한다. 기존 directory layout dump root의 의미를 변경하지 않는다.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// FADumpPackEntry는 pack TOC의 파일 한 개 위치다.
+struct ASSETDUMPQUERY_API FADumpPackEntry
+{
+	// RelativePath는 pack이 있는 폴더 기준 '/' 구분 상대 경로다.
+	FString RelativePath;
+
+	// Offset은 pack 파일 안 payload 시작 byte 위치다.
+	int64 Offset = 0;
+
+	// Length는 payload byte 수다.
+	int64 Length = 0;
+
+	// Crc는 payload CRC32다.
+	uint32 Crc = 0;
+};
+
+// ADumpPack은 dump root 파일들을 data 파일 하나와 footer TOC로 묶는 append-only pack 저장/읽기 경로를 제공한다.
+namespace ADumpPack
+{
+	// GetPackFileName은 dump root 아래 pack 파일 이름이다.
+	ASSETDUMPQUERY_API const TCHAR* GetPackFileName();
+
+	// AppendPackedFile은 InFilePath 위치에 해당하는 pack 상대 경로로 payload를 append한다. commit 전까지 같은 process에서만 보인다.
+	ASSETDUMPQUERY_API bool AppendPackedFile(
+		const FString& InPackFilePath,
+		const FString& InFilePath,
+		const TArray<uint8>& InBytes,
+		FString& OutErrorCode,
+		FString& OutErrorDetail);
+
+	// CommitPack은 현재 TOC와 footer를 append해 지금까지 쓴 파일을 원자적으로 공개한다.
+	ASSETDUMPQUERY_API bool CommitPack(
+		const FString& InPackFilePath,
+		FString& OutErrorCode,
+		FString& OutErrorDetail);
+
+	// RemovePackedDirectory는 InDirectoryPath 아래 항목을 writer TOC에서 뺀다. 다음 commit부터 reader에게 보이지 않으며 payload byte는 append-only라 남는다.
+	ASSETDUMPQUERY_API bool RemovePackedDirectory(
+		const FString& InPackFilePath,
+		const FString& InDirectoryPath,
+		int32& OutRemovedFileCount,
+		FString& OutErrorCode,
+		FString& OutErrorDetail);
+
+	// ClosePack은 열린 writer를 commit 후 닫는다.
+	ASSETDUMPQUERY_API bool ClosePack(
+		const FString& InPackFilePath,
+		FString& OutErrorCode,
+		FString& OutErrorDetail);
+
+	// TryLoadPackedFile은 InFilePath의 상위 폴더 pack에서 같은 상대 경로 payload를 읽고 CRC32를 검증한다.
+	ASSETDUMPQUERY_API bool TryLoadPackedFile(const FString& InFilePath, TArray<uint8>& OutBytes);
+
+	// TryGetPackedFileStat은 packed 파일의 byte 수와 내용 기반 stamp(crc32)를 반환한다.
+	ASSETDUMPQUERY_API bool TryGetPackedFileStat(const FString& InFilePath, int64& OutFileBytes, FString& OutStampText);
+
+	// HasPackedFile은 InFilePath가 상위 폴더 pack 안에 있는지 검사한다.
+	ASSETDUMPQUERY_API bool HasPackedFile(const FString& InFilePath);
+
+	// FindPackedFiles는 InRootPath 아래 pack 항목 중 파일 이름이 wildcard와 맞는 것을 절대 경로로 모은다. 실제 파일이 있는 경로는 제외한다.
+	ASSETDUMPQUERY_API void FindPackedFiles(const FString& InRootPath, const FString& InFileNameWildcard, TArray<FString>& OutFilePaths);
+
+	// ExportPackToDirectory는 pack의 최신 TOC 항목을 directory layout 파일로 원자 저장한다.
+	ASSETDUMPQUERY_API bool ExportPackToDirectory(
+		const FString& InPackFilePath,
+		const FString& InOutputDirectoryPath,
+		int32& OutExportedFileCount,
+		FString& OutErrorCode,
+		FString& OutErrorDetail);
+}
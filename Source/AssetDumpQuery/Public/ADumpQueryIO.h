@@ -0,0 +1,132 @@
+// File: ADumpQueryIO.h
+// Version: v1.2.0
+// Changelog:
+// - v1.2.0: GetJsonFileStat 크기/stamp를 합친 MakeJsonFileStamp와 decode 결과를 파일 stamp별로 재사용하는 TStampedFileCache를 추가.
+// - v1.1.0: 실제 파일이 없을 때 manifest content store 참조를 상위 pack 항목보다 먼저 보도록 읽기/존재/stat 우선순위를 바꿈.
+// - v1.0.0: dump root JSON 읽기(gzip/pack/content store fallback, value span)와 원자 저장, 기본 dump root 계산을 Core + Json 전용 query module로 분리.
+// Migration:
+// - ADumpJson의 같은 이름 함수는 이 구현을 그대로 가리키므로 기존 호출 코드는 바뀌지 않는다.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+
+class FJsonValue;
+
+// FADumpJsonValueSpan은 UTF-8 JSON 파일 안 value 하나의 byte 구간과 그 구간의 CRC32다.
+struct FADumpJsonValueSpan
+{
+	int64 Offset = -1;
+	int64 Length = 0;
+	uint32 Crc = 0;
+};
+
+// ADumpQueryIO는 에디터 없이도 dump root JSON을 읽고 query 결과를 저장하는 파일 I/O 경로다.
+namespace ADumpQueryIO
+{
+	// SetDefaultDumpRootDirectory는 ASSETDUMP_OUTPUT_ROOT가 없을 때 쓸 기본 dump root를 등록한다. 에디터 module은 플러그인 Dumped 후보를 등록한다.
+	ASSETDUMPQUERY_API void SetDefaultDumpRootDirectory(const FString& InDumpRootDirectory);
+
+	// BuildDefaultDumpRootDirectory는 ASSETDUMP_OUTPUT_ROOT, 등록된 기본값, 실행 폴더의 Dumped 순서로 mutation 없이 기본 dump root를 계산한다.
+	ASSETDUMPQUERY_API FString BuildDefaultDumpRootDirectory();
+
+	// BuildTempOutputFilePath는 원자적 교체를 위한 임시 파일 경로를 계산한다.
+	ASSETDUMPQUERY_API FString BuildTempOutputFilePath(const FString& FinalOutputFilePath);
+
+	// SaveJsonTextToFile은 BOM 없는 UTF-8로 temp -> final 교체 저장을 수행한다.
+	ASSETDUMPQUERY_API bool SaveJsonTextToFile(const FString& FinalOutputFilePath, const FString& JsonText, FString& OutErrorMessage);
+
+	// IsCompressedJsonBytes는 파일 byte가 gzip frame으로 시작하는지 검사한다.
+	ASSETDUMPQUERY_API bool IsCompressedJsonBytes(const TArray<uint8>& InBytes);
+
+	// DecompressJsonBytes는 gzip frame 하나를 원본 UTF-8 JSON byte로 해제한다.
+	ASSETDUMPQUERY_API bool DecompressJsonBytes(const TArray<uint8>& InBytes, TArray<uint8>& OutBytes);
+
+	// IsContentStoreSidecarFileName은 content store로 저장될 수 있는 section sidecar 파일명인지 검사한다.
+	ASSETDUMPQUERY_API bool IsContentStoreSidecarFileName(const FString& InFileName);
+
+	// LoadJsonBytesFromFile은 파일 byte를 읽고 gzip frame이면 해제한 UTF-8 JSON byte를 반환한다. 실제 파일이 없으면 manifest가 참조하는 content store blob, 그다음 상위 pack 순서로 찾는다.
+	ASSETDUMPQUERY_API bool LoadJsonBytesFromFile(const FString& InFilePath, TArray<uint8>& OutBytes, bool* bOutWasCompressed = nullptr);
+
+	// LoadJsonTextFromFile은 일반 또는 gzip JSON 파일을 같은 문자열로 읽는다.
+	ASSETDUMPQUERY_API bool LoadJsonTextFromFile(const FString& InFilePath, FString& OutJsonText);
+
+	// DoesJsonFileExist는 실제 파일, manifest가 참조하는 content store blob 또는 상위 dump pack 항목이 있는지 같은 우선순위로 검사한다.
+	ASSETDUMPQUERY_API bool DoesJsonFileExist(const FString& InFilePath);
+
+	// GetJsonFileStat은 실제 파일의 크기/수정 시각, content store 복원 크기(manifest content_sizes)/hash stamp 또는 pack 항목의 크기/CRC stamp를 반환한다.
+	ASSETDUMPQUERY_API bool GetJsonFileStat(const FString& InFilePath, int64& OutFileBytes, FString& OutStampText);
+
+	// MakeJsonFileStamp는 GetJsonFileStat의 byte 수와 stamp를 "크기|stamp" 문자열 하나로 합친다. stat을 얻지 못하면 빈 문자열이다.
+	ASSETDUMPQUERY_API FString MakeJsonFileStamp(const FString& InFilePath);
+
+	// StampedFileCacheCapacity는 TStampedFileCache 하나가 기억하는 파일 경로 수 상한이다. 가득 차면 전체를 비우고 다시 채운다.
+	inline constexpr int32 StampedFileCacheCapacity = 4;
+
+	// TStampedFileCache는 파일 경로별로 MakeJsonFileStamp가 직전 읽기와 같으면 decode 결과를 재사용하는 process cache다.
+	// ValueType은 읽기 전용으로 공유되는 shared pointer여야 하며, stamp를 얻지 못한 파일은 매번 다시 읽고 기억하지 않는다.
+	template <typename ValueType>
+	class TStampedFileCache
+	{
+	public:
+		// FindOrLoad는 stamp가 같은 값을 돌려주고, 없거나 다르면 InLoadValue(ValueType&)로 다시 읽어 교체한다. 읽기가 실패하면 cache를 바꾸지 않는다.
+		template <typename LoadValueFunc>
+		bool FindOrLoad(const FString& InFilePath, ValueType& OutValue, LoadValueFunc&& InLoadValue)
+		{
+			const FString FileStamp = MakeJsonFileStamp(InFilePath);
+			if (!FileStamp.IsEmpty())
+			{
+				FScopeLock EntryScope(&EntryLock);
+				const FEntry* Entry = Entries.Find(InFilePath);
+				if (Entry && Entry->FileStamp == FileStamp)
+				{
+					OutValue = Entry->Value;
+					return true;
+				}
+			}
+
+			if (!InLoadValue(OutValue))
+			{
+				return false;
+			}
+			if (!FileStamp.IsEmpty())
+			{
+				FScopeLock EntryScope(&EntryLock);
+				if (Entries.Num() >= StampedFileCacheCapacity)
+				{
+					Entries.Reset();
+				}
+				FEntry& Entry = Entries.FindOrAdd(InFilePath);
+				Entry.FileStamp = FileStamp;
+				Entry.Value = OutValue;
+			}
+			return true;
+		}
+
+	private:
+		// FEntry는 파일 하나의 읽기 시점 stamp와 decode 결과다.
+		struct FEntry
+		{
+			FString FileStamp;
+			ValueType Value;
+		};
+
+		// EntryLock은 병렬 query 읽기에서 Entries를 보호한다. decode는 lock 밖에서 한다.
+		FCriticalSection EntryLock;
+
+		// Entries는 파일 경로별 cache entry다.
+		TMap<FString, FEntry> Entries;
+	};
+
+	// ScanRootMemberValueSpans는 DOM 없이 UTF-8 byte를 한 번 훑어 root object와 escape 없는 top-level member value span을 찾는다.
+	ASSETDUMPQUERY_API bool ScanRootMemberValueSpans(const TArray<uint8>& InBytes, FADumpJsonValueSpan& OutRootSpan, TMap<FString, FADumpJsonValueSpan>& OutMemberSpans);
+
+	// ParseJsonValueSpan은 이미 읽은 byte 안의 구간 CRC32가 기대값과 같을 때 그 구간만 JSON value로 해석한다.
+	ASSETDUMPQUERY_API bool ParseJsonValueSpan(const TArray<uint8>& InBytes, const FADumpJsonValueSpan& InSpan, TSharedPtr<FJsonValue>& OutValue);
+
+	// LoadJsonValueFromFileSpan은 파일 크기와 구간 CRC32가 기대값과 같을 때 그 구간만 읽어 JSON value로 해석한다.
+	ASSETDUMPQUERY_API bool LoadJsonValueFromFileSpan(const FString& InFilePath, int64 InExpectedFileBytes, const FADumpJsonValueSpan& InSpan, TSharedPtr<FJsonValue>& OutValue);
+}
@@ -0,0 +1,58 @@
+// File: ADumpReadQuery.h
+// Version: v1.2.0
+// Changelog:
+// - v1.2.0: commandlet 위임 경로와 smoke check가 쓰는 sectiondump 인자 검사 ValidateSectionDumpArguments를 공개.
+// - v1.1.0: read-only mode에 inputquery를 추가.
+// - v1.0.0: dump root만 읽는 query mode(sectiondump, dependencyquery, query, contextbundle, entityquery, entitycontext)와 selector_index_v1 생성/검증을 에디터 없는 module로 분리.
+// Migration:
+// - commandlet은 같은 mode를 이 진입점으로 위임하므로 명령줄, 오류 코드와 출력 JSON은 바뀌지 않는다.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+// ADumpReadQuery는 CoreUObject/Engine 없이 dump root 파일만 읽어 query 응답을 만드는 실행 경로다.
+namespace ADumpReadQuery
+{
+	// GetSectionNameRegistry는 -Sections=가 허용하는 정식 section 이름을 registry 순서로 반환한다.
+	ASSETDUMPQUERY_API const TArray<FString>& GetSectionNameRegistry();
+
+	// TryParseSectionNames는 -Sections= 목록을 검증해 registry 순서의 중복 없는 이름으로 돌려준다. 옵션이 없으면 빈 목록과 true다.
+	ASSETDUMPQUERY_API bool TryParseSectionNames(const FString& InCommandLine, TArray<FString>& OutSectionNames, FString& OutErrorMessage);
+
+	// ValidateSectionDumpArguments는 sectiondump 인자를 section 이름, -Output=, -Sections= 필수, 선택 source, selector 순서로 검사해 첫 오류 줄을 돌려준다.
+	// Intent/Profile 이름은 검증하지 않으므로 registry를 가진 호출자가 먼저 검사해야 commandlet 오류 순서와 같아진다.
+	ASSETDUMPQUERY_API bool ValidateSectionDumpArguments(const FString& InCommandLine, FString& OutErrorMessage);
+
+	// BuildSelectorIndexJson은 저장 직전 asset/section index 문자열과 entry object로 selector_index_v1 compact JSON을 만든다.
+	ASSETDUMPQUERY_API bool BuildSelectorIndexJson(
+		const FString& InDumpRootPath,
+		const FString& InAssetIndexJsonText,
+		const FString& InSectionIndexJsonText,
+		const TArray<TSharedPtr<FJsonObject>>& InAssetEntryObjects,
+		const TArray<TSharedPtr<FJsonObject>>& InSectionEntryObjects,
+		const FString& InGeneratedTimeText,
+		FString& OutJsonText);
+
+	// ValidateSelectorIndexContract는 dump root의 selector_index_v1이 모든 asset/section key를 자기 entry span으로 해석하는지 검사한다.
+	ASSETDUMPQUERY_API bool ValidateSelectorIndexContract(const FString& InDumpRootPath, int32& OutAssetCount, int32& OutSectionCount, FString& OutDetail);
+
+	// BuildAIContextBundleJson은 query_result_v1 object를 item/UTF-8 byte 한도 안의 ai_context_bundle_v1로 변환한다.
+	// bInUseReferenceByteFit은 validate 벤치마크가 기준 재직렬화 loop와 결과를 비교할 때만 켠다.
+	ASSETDUMPQUERY_API bool BuildAIContextBundleJson(
+		const TSharedPtr<FJsonObject>& InQueryResultObject,
+		int32 InMaxItems,
+		int32 InMaxBytes,
+		FString& OutJsonText,
+		FString& OutErrorCode,
+		FString& OutErrorDetail,
+		bool bInUseReferenceByteFit = false);
+
+	// IsReadQueryMode는 -Mode= 값이 이 module이 실행하는 read-only mode인지 대소문자 무시로 판정한다.
+	ASSETDUMPQUERY_API bool IsReadQueryMode(const FString& InMode);
+
+	// RunReadQueryMode는 read-only mode 하나를 실행하고 commandlet과 같은 종료 코드(성공 0, 인자 1, 생성 2, 저장 3)를 반환한다.
+	ASSETDUMPQUERY_API int32 RunReadQueryMode(const FString& InMode, const FString& InCommandLine);
+}
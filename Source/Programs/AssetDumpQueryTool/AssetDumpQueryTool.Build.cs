@@ -0,0 +1,27 @@
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
+
+// File: AssetDumpQueryTool.Build.cs
+// Version: v0.1.0
+// Changelog:
+// - v0.1.0: read-only query program의 launch module 의존성을 명시.
+// Purpose: program 진입점은 Core/Json과 AssetDumpQuery만 링크하고, GEngineLoop 초기화를 위해 Launch 헤더 경로만 참조한다.
+
+using UnrealBuildTool;
+
+public class AssetDumpQueryTool : ModuleRules
+{
+	public AssetDumpQueryTool(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PrivateIncludePathModuleNames.Add("Launch");
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"Json",
+				"Projects",
+				"AssetDumpQuery"
+			}
+		);
+	}
+}
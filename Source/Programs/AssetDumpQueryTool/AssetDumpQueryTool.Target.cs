@@ -0,0 +1,34 @@
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
+
+// File: AssetDumpQueryTool.Target.cs
+// Version: v0.1.1
+// Changelog:
+// - v0.1.1: AssetDumpQuery module이 program target에서도 컴파일되도록 플러그인 module type 전제를 명시.
+// - v0.1.0: 에디터 없이 dump root만 읽는 read-only query mode를 실행하는 console program target을 추가.
+// Purpose: AssetDumpQuery module만 링크한 단일 실행 파일을 만든다. Engine/CoreUObject는 컴파일하지 않는다.
+
+using UnrealBuildTool;
+
+[SupportedPlatforms(UnrealPlatformClass.Desktop)]
+public class AssetDumpQueryToolTarget : TargetRules
+{
+	public AssetDumpQueryToolTarget(TargetInfo Target) : base(Target)
+	{
+		Type = TargetType.Program;
+		LinkType = TargetLinkType.Monolithic;
+		LaunchModuleName = "AssetDumpQueryTool";
+		DefaultBuildSettings = BuildSettingsVersion.Latest;
+		IncludeOrderVersion = EngineIncludeOrderVersion.Latest;
+
+		bBuildDeveloperTools = false;
+		bCompileAgainstEngine = false;
+		bCompileAgainstCoreUObject = false;
+		bCompileAgainstApplicationCore = false;
+		bCompileICU = false;
+		bIsBuildingConsoleApplication = true;
+
+		// AssetDumpQuery module은 AssetDump 플러그인 안에 있으므로 플러그인을 명시적으로 켠다.
+		// uplugin에서 RuntimeAndProgram + ProgramAllowList로 선언해야 program target에 포함된다. DeveloperTool은 위 bBuildDeveloperTools=false로 빠진다.
+		EnablePlugins.Add("AssetDump");
+	}
+}
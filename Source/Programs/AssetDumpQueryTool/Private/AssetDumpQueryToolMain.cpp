@@ -0,0 +1,37 @@
+// File: AssetDumpQueryToolMain.cpp
+// Version: v0.2.0
+// Changelog:
+// - v0.2.0: 지원 mode 안내에 inputquery를 추가.
+// - v0.1.0: -Mode=sectiondump|dependencyquery|query|contextbundle|entityquery|entitycontext를 에디터 실행 없이 처리하는 console 진입점을 추가.
+// Migration:
+// - 인자, 오류 코드와 종료 코드는 UnrealEditor-Cmd -run=AssetDump 실행과 같다. 기본 dump root는 ASSETDUMP_OUTPUT_ROOT 또는 실행 폴더 Dumped다.
+
+#include "ADumpReadQuery.h"
+
+#include "RequiredProgramMainCPPInclude.h"
+
+IMPLEMENT_APPLICATION(AssetDumpQueryTool, "AssetDumpQueryTool");
+
+INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
+{
+	// ToolCommandLine은 GEngineLoop 초기화 뒤 -Mode= 등 query 옵션을 읽을 전체 명령줄이다.
+	const FString ToolCommandLine = FCommandLine::BuildFromArgV(nullptr, ArgC, ArgV, nullptr);
+	GEngineLoop.PreInit(*ToolCommandLine);
+
+	FString RequestedMode;
+	FParse::Value(*ToolCommandLine, TEXT("Mode="), RequestedMode);
+
+	int32 ExitCode = 1;
+	if (ADumpReadQuery::IsReadQueryMode(RequestedMode))
+	{
+		ExitCode = ADumpReadQuery::RunReadQueryMode(RequestedMode, ToolCommandLine);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Error, TEXT("ADUMP_QUERY_MODE_UNSUPPORTED: Use -Mode=sectiondump|dependencyquery|query|contextbundle|entityquery|entitycontext|inputquery. Other modes require UnrealEditor-Cmd -run=AssetDump."));
+	}
+
+	FEngineLoop::AppPreExit();
+	FEngineLoop::AppExit();
+	return ExitCode;
+}